@@ -0,0 +1,140 @@
+/**
+ * @file profiling.h
+ * @brief CPU profiling: scoped zones, counters, frame marks, Chrome trace export.
+ *
+ * Events are appended to a per-thread ring buffer without locks. Capture is off until
+ * ProfilerSetEnabled(true); while off, a zone costs one relaxed atomic load. Define
+ * TE_CORE_PROFILING=0 to compile the TE_PROFILE_* macros out entirely.
+ *
+ * Zone and counter names are stored by pointer: pass string literals, __func__, or
+ * strings returned by ProfilerInternString.
+ */
+#ifndef TE_CORE_PROFILING_H
+#define TE_CORE_PROFILING_H
+
+#ifndef TE_CORE_PROFILING
+#define TE_CORE_PROFILING 1
+#endif
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <vector>
+
+namespace te {
+namespace core {
+
+/** Profile event kind. */
+enum class ProfileEventType : std::uint8_t {
+  ZoneBegin,
+  ZoneEnd,
+  Counter,
+  FrameMark,
+};
+
+/** One recorded event. */
+struct ProfileEvent {
+  std::uint64_t timestampNs;  ///< Nanoseconds since profiler start
+  char const* name;           ///< Zone / counter name (null for frame marks)
+  double value;               ///< Counter value, or frame index for frame marks
+  std::uint32_t threadId;     ///< Profiler thread index (0, 1, ... in first-use order)
+  ProfileEventType type;
+};
+
+namespace detail {
+extern std::atomic<bool> g_profilerEnabled;
+}  // namespace detail
+
+/** True while capture is enabled. */
+inline bool ProfilerIsEnabled() {
+  return detail::g_profilerEnabled.load(std::memory_order_relaxed);
+}
+
+/** Start or stop capture. Recorded events are kept until ProfilerClear. */
+void ProfilerSetEnabled(bool enabled);
+
+/** Per-thread ring capacity in events for buffers created afterwards. Default: 65536. */
+void ProfilerSetThreadBufferCapacity(std::size_t events);
+
+/** Name the calling thread in exported traces (copied; shown once the thread records events). */
+void ProfilerSetThreadName(char const* name);
+
+/** Record zone begin / end on the calling thread. Prefer TE_PROFILE_ZONE. */
+void ProfilerBeginZone(char const* name);
+void ProfilerEndZone(char const* name);
+
+/** Record a counter / plot sample. */
+void ProfilerCounter(char const* name, double value);
+
+/** Mark the end of a frame (call once per main-loop iteration). Always advances the frame index. */
+void ProfilerFrameMark();
+
+/** Number of frame marks so far. */
+std::uint64_t ProfilerGetFrameIndex();
+
+/** Return a stable copy of \a s for use as a zone or counter name. Thread-safe; takes a lock. */
+char const* ProfilerInternString(char const* s);
+
+/**
+ * Copy the recorded events of all threads into \a out, sorted by timestamp.
+ * May run while other threads record; events overwritten during the copy are dropped.
+ * Events of threads that have exited are returned once; their buffers are then reused
+ * by threads that start recording later.
+ */
+void ProfilerCollect(std::vector<ProfileEvent>& out);
+
+/** Recorded events as Chrome trace JSON (chrome://tracing, Perfetto UI). */
+std::string ProfilerExportChromeTrace();
+
+/** Write ProfilerExportChromeTrace() to \a path. Returns false on I/O failure. */
+bool ProfilerWriteChromeTrace(char const* path);
+
+/** Discard recorded events (buffers and names of live threads are kept). */
+void ProfilerClear();
+
+/** RAII zone; records nothing if capture was disabled at construction. */
+class ProfileZone {
+ public:
+  explicit ProfileZone(char const* name) : name_(ProfilerIsEnabled() ? name : nullptr) {
+    if (name_) ProfilerBeginZone(name_);
+  }
+  ~ProfileZone() {
+    if (name_) ProfilerEndZone(name_);
+  }
+  ProfileZone(ProfileZone const&) = delete;
+  ProfileZone& operator=(ProfileZone const&) = delete;
+
+ private:
+  char const* name_;
+};
+
+}  // namespace core
+}  // namespace te
+
+#if TE_CORE_PROFILING
+#define TE_PROFILE_CONCAT_IMPL(a, b) a##b
+#define TE_PROFILE_CONCAT(a, b) TE_PROFILE_CONCAT_IMPL(a, b)
+/** Profile the enclosing scope as \a name. */
+#define TE_PROFILE_ZONE(name) ::te::core::ProfileZone TE_PROFILE_CONCAT(te_profile_zone_, __LINE__)(name)
+/** Profile the enclosing function. */
+#define TE_PROFILE_FUNCTION() TE_PROFILE_ZONE(__func__)
+/** Record a counter / plot sample. */
+#define TE_PROFILE_COUNTER(name, value)                                     \
+  do {                                                                      \
+    if (::te::core::ProfilerIsEnabled())                                    \
+      ::te::core::ProfilerCounter((name), static_cast<double>(value));      \
+  } while (0)
+/** Mark the end of a frame. */
+#define TE_PROFILE_FRAME_MARK() ::te::core::ProfilerFrameMark()
+/** Name the calling thread. */
+#define TE_PROFILE_THREAD_NAME(name) ::te::core::ProfilerSetThreadName(name)
+#else
+#define TE_PROFILE_ZONE(name) ((void)0)
+#define TE_PROFILE_FUNCTION() ((void)0)
+#define TE_PROFILE_COUNTER(name, value) ((void)0)
+#define TE_PROFILE_FRAME_MARK() ((void)0)
+#define TE_PROFILE_THREAD_NAME(name) ((void)0)
+#endif
+
+#endif  // TE_CORE_PROFILING_H
@@ -0,0 +1,295 @@
+/**
+ * @file profiling.cpp
+ * @brief Implementation of per-thread profile event buffers and Chrome trace export.
+ * Writers never lock; the registry lock is taken once per thread and by readers.
+ */
+
+#include "te/core/profiling.h"
+#include <algorithm>
+#include <chrono>
+#include <cstdio>
+#include <memory>
+#include <mutex>
+#include <unordered_set>
+
+namespace te {
+namespace core {
+
+namespace detail {
+std::atomic<bool> g_profilerEnabled{false};
+}  // namespace detail
+
+namespace {
+
+/** Owner of a buffer: a live thread, an exited thread whose events are not yet collected, or none. */
+enum class BufferState : std::uint32_t { Owned, Retired, Free };
+
+/** Single-producer ring: only the owning thread writes; readers copy and validate. */
+struct ThreadBuffer {
+  std::vector<ProfileEvent> events;
+  std::atomic<BufferState> state{BufferState::Owned};
+  std::atomic<std::uint64_t> head{0};   // Total events written
+  std::atomic<std::uint64_t> base{0};   // Events before this index were cleared
+  std::uint32_t threadId = 0;
+  std::string name;                     // Guarded by Registry::mutex
+};
+
+struct Registry {
+  std::mutex mutex;
+  std::vector<std::unique_ptr<ThreadBuffer>> buffers;  // Reused once a retired buffer is collected
+  std::unordered_set<std::string> interned;
+  std::size_t capacity = 65536;
+  std::uint32_t nextThreadId = 0;
+  std::atomic<std::uint64_t> frameIndex{0};
+  std::chrono::steady_clock::time_point start = std::chrono::steady_clock::now();
+};
+
+Registry& GetRegistry() {
+  // Never destroyed: threads may still record during static destruction
+  static Registry* s_registry = new Registry();
+  return *s_registry;
+}
+
+/** Retires the thread's buffer on exit; its events stay readable until the next collect. */
+struct BufferLease {
+  ThreadBuffer* buffer = nullptr;
+  ~BufferLease() {
+    if (buffer) buffer->state.store(BufferState::Retired, std::memory_order_release);
+  }
+};
+
+thread_local BufferLease t_lease;
+thread_local std::string t_pendingName;  // Name set before the thread recorded anything
+
+ThreadBuffer& GetThreadBuffer() {
+  if (t_lease.buffer) return *t_lease.buffer;
+  Registry& r = GetRegistry();
+  std::lock_guard<std::mutex> lock(r.mutex);
+  ThreadBuffer* buffer = nullptr;
+  for (auto& candidate : r.buffers) {
+    if (candidate->state.load(std::memory_order_relaxed) == BufferState::Free) {
+      buffer = candidate.get();
+      break;
+    }
+  }
+  if (!buffer) {
+    r.buffers.push_back(std::make_unique<ThreadBuffer>());
+    buffer = r.buffers.back().get();
+  }
+  // Readers only touch buffers under the lock, so resetting here is safe
+  buffer->events.resize(std::max<std::size_t>(1, r.capacity));
+  buffer->head.store(0, std::memory_order_relaxed);
+  buffer->base.store(0, std::memory_order_relaxed);
+  buffer->threadId = r.nextThreadId++;
+  buffer->name = std::move(t_pendingName);
+  buffer->state.store(BufferState::Owned, std::memory_order_relaxed);
+  t_lease.buffer = buffer;
+  return *buffer;
+}
+
+std::uint64_t NowNs() {
+  auto const elapsed = std::chrono::steady_clock::now() - GetRegistry().start;
+  return static_cast<std::uint64_t>(std::chrono::duration_cast<std::chrono::nanoseconds>(elapsed).count());
+}
+
+void Record(ProfileEventType type, char const* name, double value) {
+  ThreadBuffer& b = GetThreadBuffer();
+  std::uint64_t const h = b.head.load(std::memory_order_relaxed);
+  ProfileEvent& e = b.events[h % b.events.size()];
+  e.timestampNs = NowNs();
+  e.name = name;
+  e.value = value;
+  e.threadId = b.threadId;
+  e.type = type;
+  b.head.store(h + 1, std::memory_order_release);
+}
+
+void AppendJsonString(std::string& out, char const* s) {
+  out += '"';
+  for (; s && *s; ++s) {
+    char const c = *s;
+    if (c == '"' || c == '\\') {
+      out += '\\';
+      out += c;
+    } else if (static_cast<unsigned char>(c) < 0x20) {
+      char buf[8];
+      std::snprintf(buf, sizeof(buf), "\\u%04x", static_cast<unsigned>(c));
+      out += buf;
+    } else {
+      out += c;
+    }
+  }
+  out += '"';
+}
+
+void AppendEventHeader(std::string& out, char const* ph, char const* name, std::uint64_t ns, std::uint32_t tid) {
+  char buf[96];
+  out += "{\"ph\":\"";
+  out += ph;
+  out += "\",\"name\":";
+  AppendJsonString(out, name);
+  std::snprintf(buf, sizeof(buf), ",\"pid\":1,\"tid\":%u,\"ts\":%.3f", tid, static_cast<double>(ns) / 1000.0);
+  out += buf;
+}
+
+}  // namespace
+
+void ProfilerSetEnabled(bool enabled) {
+  detail::g_profilerEnabled.store(enabled, std::memory_order_relaxed);
+}
+
+void ProfilerSetThreadBufferCapacity(std::size_t events) {
+  Registry& r = GetRegistry();
+  std::lock_guard<std::mutex> lock(r.mutex);
+  r.capacity = events;
+}
+
+void ProfilerSetThreadName(char const* name) {
+  if (!t_lease.buffer) {
+    // Buffers are allocated on first record, so naming a thread costs nothing while idle
+    t_pendingName = name ? name : "";
+    return;
+  }
+  Registry& r = GetRegistry();
+  std::lock_guard<std::mutex> lock(r.mutex);
+  t_lease.buffer->name = name ? name : "";
+}
+
+void ProfilerBeginZone(char const* name) {
+  Record(ProfileEventType::ZoneBegin, name, 0.0);
+}
+
+void ProfilerEndZone(char const* name) {
+  Record(ProfileEventType::ZoneEnd, name, 0.0);
+}
+
+void ProfilerCounter(char const* name, double value) {
+  Record(ProfileEventType::Counter, name, value);
+}
+
+void ProfilerFrameMark() {
+  std::uint64_t const frame = GetRegistry().frameIndex.fetch_add(1, std::memory_order_relaxed);
+  if (ProfilerIsEnabled()) {
+    Record(ProfileEventType::FrameMark, nullptr, static_cast<double>(frame));
+  }
+}
+
+std::uint64_t ProfilerGetFrameIndex() {
+  return GetRegistry().frameIndex.load(std::memory_order_relaxed);
+}
+
+char const* ProfilerInternString(char const* s) {
+  if (!s) return nullptr;
+  Registry& r = GetRegistry();
+  std::lock_guard<std::mutex> lock(r.mutex);
+  return r.interned.insert(s).first->c_str();
+}
+
+void ProfilerCollect(std::vector<ProfileEvent>& out) {
+  out.clear();
+  Registry& r = GetRegistry();
+  std::lock_guard<std::mutex> lock(r.mutex);
+  for (auto const& b : r.buffers) {
+    // Read before head: a retired owner wrote its last event before retiring
+    BufferState const state = b->state.load(std::memory_order_acquire);
+    if (state == BufferState::Free) continue;
+    std::uint64_t const capacity = b->events.size();
+    std::uint64_t const head = b->head.load(std::memory_order_acquire);
+    // The writer may be overwriting slot head % capacity (event head - capacity) right now
+    std::uint64_t const first = std::max(b->base.load(std::memory_order_relaxed),
+                                         head + 1 > capacity ? head + 1 - capacity : 0);
+    std::size_t const copiedFrom = out.size();
+    for (std::uint64_t i = first; i < head; ++i) {
+      out.push_back(b->events[i % capacity]);
+    }
+    // Entries the writer lapped during the copy may be torn; drop them
+    std::uint64_t const after = b->head.load(std::memory_order_acquire);
+    std::uint64_t const safeFrom = after + 1 > capacity ? after + 1 - capacity : 0;
+    if (safeFrom > first) {
+      std::uint64_t const lost = std::min(safeFrom - first, head - first);
+      out.erase(out.begin() + static_cast<std::ptrdiff_t>(copiedFrom),
+                out.begin() + static_cast<std::ptrdiff_t>(copiedFrom + lost));
+    }
+    // The exited thread's events have been reported once; hand the buffer to the next thread
+    if (state == BufferState::Retired) b->state.store(BufferState::Free, std::memory_order_relaxed);
+  }
+  std::stable_sort(out.begin(), out.end(), [](ProfileEvent const& a, ProfileEvent const& b) {
+    return a.timestampNs < b.timestampNs;
+  });
+}
+
+std::string ProfilerExportChromeTrace() {
+  std::string out;
+  out += "{\"displayTimeUnit\":\"ms\",\"traceEvents\":[";
+  bool first = true;
+  auto separator = [&]() {
+    if (!first) out += ",\n";
+    first = false;
+  };
+
+  // Names first: collecting frees the buffers of exited threads
+  {
+    Registry& r = GetRegistry();
+    std::lock_guard<std::mutex> lock(r.mutex);
+    for (auto const& b : r.buffers) {
+      if (b->name.empty() || b->state.load(std::memory_order_relaxed) == BufferState::Free) continue;
+      separator();
+      AppendEventHeader(out, "M", "thread_name", 0, b->threadId);
+      out += ",\"args\":{\"name\":";
+      AppendJsonString(out, b->name.c_str());
+      out += "}}";
+    }
+  }
+
+  std::vector<ProfileEvent> events;
+  ProfilerCollect(events);
+  out.reserve(out.size() + events.size() * 80);
+  char buf[64];
+  for (auto const& e : events) {
+    separator();
+    switch (e.type) {
+      case ProfileEventType::ZoneBegin:
+        AppendEventHeader(out, "B", e.name, e.timestampNs, e.threadId);
+        out += "}";
+        break;
+      case ProfileEventType::ZoneEnd:
+        AppendEventHeader(out, "E", e.name, e.timestampNs, e.threadId);
+        out += "}";
+        break;
+      case ProfileEventType::Counter:
+        AppendEventHeader(out, "C", e.name, e.timestampNs, e.threadId);
+        std::snprintf(buf, sizeof(buf), ",\"args\":{\"value\":%.17g}}", e.value);
+        out += buf;
+        break;
+      case ProfileEventType::FrameMark:
+        AppendEventHeader(out, "i", "Frame", e.timestampNs, e.threadId);
+        std::snprintf(buf, sizeof(buf), ",\"s\":\"g\",\"args\":{\"frame\":%.0f}}", e.value);
+        out += buf;
+        break;
+    }
+  }
+  out += "]}\n";
+  return out;
+}
+
+bool ProfilerWriteChromeTrace(char const* path) {
+  if (!path) return false;
+  std::string const json = ProfilerExportChromeTrace();
+  FILE* f = std::fopen(path, "wb");
+  if (!f) return false;
+  bool const ok = std::fwrite(json.data(), 1, json.size(), f) == json.size();
+  return std::fclose(f) == 0 && ok;
+}
+
+void ProfilerClear() {
+  Registry& r = GetRegistry();
+  std::lock_guard<std::mutex> lock(r.mutex);
+  for (auto const& b : r.buffers) {
+    b->base.store(b->head.load(std::memory_order_acquire), std::memory_order_relaxed);
+    BufferState expected = BufferState::Retired;
+    b->state.compare_exchange_strong(expected, BufferState::Free, std::memory_order_acquire);
+  }
+}
+
+}  // namespace core
+}  // namespace te
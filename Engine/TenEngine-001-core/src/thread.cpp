@@ -5,6 +5,7 @@
  */
 
 #include "te/core/thread.h"
+#include "te/core/profiling.h"
 #include <thread>
 #include <mutex>
 #include <condition_variable>
@@ -153,8 +154,9 @@ struct TaskItem {
 // --- SingleThreadExecutor ---
 class SingleThreadExecutor : public ITaskExecutor {
  public:
-  SingleThreadExecutor() {
-    worker_ = std::thread([this]() {
+  explicit SingleThreadExecutor(char const* name) {
+    worker_ = std::thread([this, name]() {
+      TE_PROFILE_THREAD_NAME(name);
       while (true) {
         std::shared_ptr<TaskItem> item;
         {
@@ -171,7 +173,10 @@ class SingleThreadExecutor : public ITaskExecutor {
           }
         }
         if (item && item->callback) {
-          item->callback(item->user_data);
+          {
+            TE_PROFILE_ZONE("Task");
+            item->callback(item->user_data);
+          }
           item->status.store(TaskStatus::Completed);
           std::lock_guard<std::mutex> lock(m_);
           tasks_.erase(item->taskId);
@@ -256,8 +261,8 @@ struct DefaultThreadPool : IThreadPool {
   CallbackThreadType callbackThreadType_ = CallbackThreadType::WorkerThread;
 
   DefaultThreadPool() {
-    workerExecutor_ = std::make_unique<SingleThreadExecutor>();
-    ioExecutor_ = std::make_unique<SingleThreadExecutor>();
+    workerExecutor_ = std::make_unique<SingleThreadExecutor>("Worker");
+    ioExecutor_ = std::make_unique<SingleThreadExecutor>("IO");
     executors_.resize(static_cast<size_t>(ExecutorType::Count), nullptr);
     executors_[static_cast<size_t>(ExecutorType::Worker)] = workerExecutor_.get();
     executors_[static_cast<size_t>(ExecutorType::IO)] = ioExecutor_.get();
@@ -280,6 +285,7 @@ struct DefaultThreadPool : IThreadPool {
   }
 
   void ProcessMainThreadCallbacks() override {
+    TE_PROFILE_ZONE("MainThreadCallbacks");
     std::vector<std::pair<TaskCallback, void*>> batch;
     {
       std::lock_guard<std::mutex> lock(main_m_);
@@ -11,10 +11,12 @@
 #include "te/core/math.h"
 #include "te/core/module_load.h"
 #include "te/core/platform.h"
+#include "te/core/profiling.h"
 #include "te/core/thread.h"
 
 #include <cassert>
 #include <functional>
+#include <vector>
 
 using namespace te::core;
 
@@ -118,6 +120,19 @@ int main() {
   SetCrashHandler(nullptr);
   (void)CrashHandlerFn{};
 
+  // --- profiling.h ---
+  (void)ProfilerIsEnabled();
+  ProfilerSetEnabled(false);
+  ProfilerSetThreadName("abi");
+  ProfilerFrameMark();
+  (void)ProfilerGetFrameIndex();
+  (void)ProfilerInternString("abi");
+  std::vector<ProfileEvent> profileEvents;
+  ProfilerCollect(profileEvents);
+  (void)ProfilerExportChromeTrace();
+  ProfilerClear();
+  { TE_PROFILE_ZONE("abi"); }
+
   // --- check.h (macros) ---
   CheckWarning(true);
   CheckWarning(true, "msg");
@@ -2,12 +2,16 @@
  * @file PropertyBag.h
  * @brief Property bag system (contract: specs/_contracts/002-object-public-api.md).
  * Provides property access and manipulation based on type descriptors.
+ * Hot paths resolve a PropertyHandle once and then access by handle (typed or batched).
  */
 #ifndef TE_OBJECT_PROPERTY_BAG_H
 #define TE_OBJECT_PROPERTY_BAG_H
 
 #include "te/object/TypeId.h"
 #include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <type_traits>
 
 namespace te {
 namespace object {
@@ -58,11 +62,27 @@ public:
     virtual PropertyDescriptor const* GetProperty(std::size_t index) const = 0;
 };
 
-// Forward declaration
+// Forward declarations
 struct TypeDescriptor;
+struct PropertyNameTable;
+
+/**
+ * Pre-resolved property of one type descriptor: descriptor index plus layout.
+ * Valid for bags constructed with the same TypeDescriptor pointer it was resolved from.
+ */
+struct PropertyHandle {
+    TypeDescriptor const* type = nullptr;    // Descriptor the handle was resolved from
+    std::uint32_t index = 0;                 // Index into type->properties
+    TypeId valueTypeId = kInvalidTypeId;     // Type ID of the property value
+    std::size_t offset = 0;                  // Offset of property in object (bytes)
+    std::size_t size = 0;                    // Size of property (bytes)
+
+    bool IsValid() const { return type != nullptr; }
+};
 
 /**
  * Property bag implementation based on TypeDescriptor.
+ * Name lookups of registered types go through a per-type hash table built on first use.
  */
 class PropertyBag : public IPropertyBag {
 public:
@@ -80,9 +100,75 @@ public:
     std::size_t GetPropertyCount() const override;
     PropertyDescriptor const* GetProperty(std::size_t index) const override;
     
+    /**
+     * Resolve a property of a type to a handle; invalid handle if not found.
+     */
+    static PropertyHandle ResolveProperty(TypeDescriptor const* typeDesc, char const* name);
+    
+    /**
+     * Resolve a property of this bag's type to a handle.
+     */
+    PropertyHandle GetHandle(char const* name) const;
+    
+    /**
+     * Get property value by handle (copies handle.size bytes).
+     */
+    bool GetProperty(void* outValue, PropertyHandle const& handle) const;
+    
+    /**
+     * Set property value by handle (copies handle.size bytes).
+     */
+    bool SetProperty(void const* value, PropertyHandle const& handle);
+    
+    /**
+     * Typed get; fails if sizeof(T) differs from the property size.
+     */
+    template<typename T>
+    bool Get(PropertyHandle const& handle, T& out) const {
+        static_assert(std::is_trivially_copyable<T>::value, "T must be trivially copyable");
+        if (!instance_ || handle.type != typeDesc_ || handle.size != sizeof(T)) {
+            return false;
+        }
+        std::memcpy(&out, static_cast<char const*>(instance_) + handle.offset, sizeof(T));
+        return true;
+    }
+    
+    /**
+     * Typed set; fails if sizeof(T) differs from the property size.
+     */
+    template<typename T>
+    bool Set(PropertyHandle const& handle, T const& value) {
+        static_assert(std::is_trivially_copyable<T>::value, "T must be trivially copyable");
+        if (!instance_ || handle.type != typeDesc_ || handle.size != sizeof(T)) {
+            return false;
+        }
+        std::memcpy(static_cast<char*>(instance_) + handle.offset, &value, sizeof(T));
+        return true;
+    }
+    
+    /**
+     * Read one property from many instances of the handle's type into outValues
+     * (count * handle.size bytes, packed). Null instances are skipped and leave their slot untouched.
+     * Returns the number of instances read.
+     */
+    static std::size_t GetPropertyBatch(PropertyHandle const& handle, void const* const* instances,
+                                        std::size_t count, void* outValues);
+    
+    /**
+     * Write one property on many instances of the handle's type (multi-object editing).
+     * valueStride 0 writes the same value to every instance; otherwise instance i gets
+     * values + i * valueStride. Null instances are skipped. Returns the number of instances written.
+     */
+    static std::size_t SetPropertyBatch(PropertyHandle const& handle, void* const* instances,
+                                        std::size_t count, void const* values, std::size_t valueStride = 0);
+    
 private:
+    PropertyNameTable const* GetNameTable() const;
+    
     void* instance_;
     TypeDescriptor const* typeDesc_;
+    mutable PropertyNameTable const* nameTable_ = nullptr;  // Resolved on first name lookup
+    mutable bool nameTableResolved_ = false;
 };
 
 } // namespace object
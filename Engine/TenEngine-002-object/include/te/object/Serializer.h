@@ -101,15 +101,57 @@ public:
 };
 
 /**
- * Create binary serializer.
+ * Binary wire layout written by a binary serializer.
+ * Tagged: property names and type markers; tolerates schema changes and supports version migration.
+ * Schema: name-free layout from a per-type compiled plan, prefixed with the plan's schema hash;
+ *         readable only where GetBinarySchemaHash matches (save-game caches, network snapshots).
+ */
+enum class BinaryLayout {
+    Tagged,
+    Schema
+};
+
+/**
+ * Create binary serializer (Tagged layout).
  */
 ISerializer* CreateBinarySerializer();
 
+/**
+ * Create binary serializer writing the given layout.
+ * Deserialize accepts both layouts; a Schema buffer whose hash differs from the local plan is rejected.
+ */
+ISerializer* CreateBinarySerializer(BinaryLayout layout);
+
+/**
+ * Schema hash of a registered type's binary plan (property names, sizes and nesting in order).
+ * Returns 0 if the type is not registered.
+ */
+std::uint64_t GetBinarySchemaHash(TypeId typeId);
+
 /**
  * Create JSON serializer.
  */
 ISerializer* CreateJSONSerializer();
 
+/**
+ * Byte sink for streamed serialization output (file, socket, growing buffer).
+ */
+class ISerializeSink {
+public:
+    virtual ~ISerializeSink() = default;
+
+    /**
+     * Append size bytes; return false to abort serialization.
+     */
+    virtual bool Write(void const* data, std::size_t size) = 0;
+};
+
+/**
+ * Serialize object as JSON straight into a sink, flushed in fixed-size chunks as it is written;
+ * output is identical to the JSON serializer's. Returns false if the type is unknown or a Write fails.
+ */
+bool SerializeJSONToSink(ISerializeSink& sink, void const* obj, TypeId typeId);
+
 /**
  * Create XML serializer.
  */
@@ -22,6 +22,18 @@ using TypeId = std::uint32_t;
  */
 constexpr TypeId kInvalidTypeId = 0;
 
+/**
+ * Compile-time type ID from a type name (FNV-1a 32-bit); never returns kInvalidTypeId.
+ * Usable as desc.id so that IDs are stable across builds without a central list.
+ */
+constexpr TypeId HashTypeName(char const* name) {
+    std::uint32_t hash = 2166136261u;
+    for (; *name; ++name) {
+        hash = (hash ^ static_cast<unsigned char>(*name)) * 16777619u;
+    }
+    return hash != kInvalidTypeId ? hash : 1u;
+}
+
 /**
  * Property descriptor: describes a property of a type.
  */
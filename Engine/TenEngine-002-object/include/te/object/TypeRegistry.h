@@ -7,18 +7,21 @@
 #define TE_OBJECT_TYPE_REGISTRY_H
 
 #include "te/object/TypeId.h"
+#include <atomic>
+#include <typeinfo>
 
 namespace te {
 namespace object {
 
 /**
  * Type registry: thread-safe type registration and query system.
+ * After Freeze, lookups go through an immutable table without taking a lock.
  */
 class TypeRegistry {
 public:
     /**
      * Register a type descriptor (thread-safe).
-     * Returns true on success, false if TypeId already registered.
+     * Returns true on success, false if TypeId already registered or the registry is frozen.
      */
     static bool RegisterType(TypeDescriptor const& desc);
     
@@ -61,9 +64,66 @@ public:
      * Calls callback for each registered type.
      */
     static void EnumerateTypes(void (*callback)(TypeDescriptor const*, void*), void* userData);
+    
+    /**
+     * End the registration phase (call once all modules have registered, e.g. after startup).
+     * Builds a dense, immutable lookup table; later lookups are lock-free and RegisterType fails.
+     * Descriptor pointers returned before freezing stay valid. Calling again has no effect.
+     * The editor freezes in main after module initialization (028, 012, 010, 011) and
+     * RegisterWorldModule (005 component types, 029); static registrars run before main.
+     */
+    static void Freeze();
+    
+    /**
+     * Check whether Freeze has been called.
+     */
+    static bool IsFrozen();
 };
 
+/**
+ * Registered name of a C++ type for TypeOf/TypeIdOf; specialize with TE_OBJECT_TYPE_NAME.
+ * Unspecialized types are looked up by typeid(T).name().
+ */
+template<typename T>
+struct TypeName {
+    static constexpr char const* value = nullptr;
+};
+
+/**
+ * Compile-time TypeId of a type named with TE_OBJECT_TYPE_NAME (HashTypeName of the name).
+ */
+template<typename T>
+constexpr TypeId TypeIdOf() {
+    static_assert(TypeName<T>::value != nullptr, "TypeIdOf<T> requires TE_OBJECT_TYPE_NAME(T, name)");
+    return HashTypeName(TypeName<T>::value);
+}
+
+/**
+ * Descriptor registered for T, cached per type after the first successful lookup.
+ * Returns nullptr while T is not registered (the lookup is retried on the next call).
+ */
+template<typename T>
+TypeDescriptor const* TypeOf() {
+    static std::atomic<TypeDescriptor const*> s_cached{nullptr};
+    TypeDescriptor const* desc = s_cached.load(std::memory_order_acquire);
+    if (!desc) {
+        desc = TypeRegistry::GetTypeByName(TypeName<T>::value ? TypeName<T>::value : typeid(T).name());
+        if (desc) {
+            s_cached.store(desc, std::memory_order_release);
+        }
+    }
+    return desc;
+}
+
 } // namespace object
 } // namespace te
 
+// Name a type for TypeOf/TypeIdOf; must be used at global scope (outside any namespace)
+#define TE_OBJECT_TYPE_NAME(T, name) \
+    namespace te { namespace object { \
+        template<> struct TypeName<T> { \
+            static constexpr char const* value = name; \
+        }; \
+    }}
+
 #endif // TE_OBJECT_TYPE_REGISTRY_H
@@ -11,7 +11,11 @@
 #include <cstring>
 #include <vector>
 #include <cstdint>
+#include <memory>
+#include <mutex>
+#include <shared_mutex>
 #include <string>
+#include <unordered_map>
 
 namespace te {
 namespace object {
@@ -32,6 +36,18 @@ struct BinaryHeader {
 constexpr std::uint32_t kBinaryMagic = 0x54454F42;  // "TEOB"
 constexpr std::uint32_t kCurrentVersion = 1;
 
+// Schema layout header; the magic tells it apart from the tagged BinaryHeader
+struct SchemaHeader {
+    std::uint32_t magic;        // Magic number: 0x54454F53 ("TEOS")
+    std::uint32_t version;      // Format version
+    TypeId typeId;              // Type ID
+    std::uint32_t dataSize;     // Size of serialized data (after header)
+    std::uint64_t schemaHash;   // Writer's BinaryPlan::schemaHash
+};
+
+constexpr std::uint32_t kSchemaMagic = 0x54454F53;  // "TEOS"
+constexpr std::size_t kMaxPlanDepth = 32;
+
 // Type markers for binary format
 enum class TypeMarker : std::uint8_t {
     Primitive = 0x01,      // Basic types (int, float, bool, etc.)
@@ -385,17 +401,139 @@ bool DeserializeObject(BinaryReader& reader, void* obj, TypeDescriptor const* de
     return true;
 }
 
+// === Schema layout: compiled per-type plans ===
+
+// Object bytes copied with one memcpy; on the wire spans are packed back to back
+struct PlanSpan {
+    std::size_t offset;
+    std::size_t size;
+};
+
+// Flat plan of a type: nested types inlined at their offsets, adjacent properties merged
+struct BinaryPlan {
+    std::vector<PlanSpan> spans;
+    std::size_t wireSize = 0;
+    std::uint64_t schemaHash = 0;
+};
+
+constexpr std::uint64_t kFnvOffsetBasis = 14695981039346656037ull;
+constexpr std::uint64_t kFnvPrime = 1099511628211ull;
+
+void HashBytes(std::uint64_t& hash, void const* data, std::size_t size) {
+    unsigned char const* bytes = static_cast<unsigned char const*>(data);
+    for (std::size_t i = 0; i < size; ++i) {
+        hash = (hash ^ bytes[i]) * kFnvPrime;
+    }
+}
+
+// Classify like SerializeProperty: GUID/ObjectRef-sized properties are never nested objects
+TypeDescriptor const* GetNestedType(PropertyDescriptor const& prop) {
+    if (prop.size == sizeof(GUID) || prop.size == sizeof(ObjectRef) || prop.valueTypeId == kInvalidTypeId) {
+        return nullptr;
+    }
+    TypeDescriptor const* nested = TypeRegistry::GetTypeById(prop.valueTypeId);
+    return nested && nested->propertyCount > 0 ? nested : nullptr;
+}
+
+// Append desc's properties to plan; the hash covers names, sizes and nesting in order
+// (not offsets or type names, which do not affect the wire layout)
+bool CompilePlan(TypeDescriptor const* desc, std::size_t baseOffset, std::size_t depth, BinaryPlan& plan) {
+    if (depth > kMaxPlanDepth) {
+        return false;  // Descriptor nests itself
+    }
+    for (std::size_t i = 0; i < desc->propertyCount; ++i) {
+        PropertyDescriptor const& prop = desc->properties[i];
+        if (!prop.name) {
+            continue;
+        }
+        HashBytes(plan.schemaHash, prop.name, std::strlen(prop.name) + 1);
+        
+        if (TypeDescriptor const* nested = GetNestedType(prop)) {
+            HashBytes(plan.schemaHash, "{", 1);
+            if (!CompilePlan(nested, baseOffset + prop.offset, depth + 1, plan)) {
+                return false;
+            }
+            HashBytes(plan.schemaHash, "}", 1);
+            continue;
+        }
+        
+        std::uint64_t const size = prop.size;
+        HashBytes(plan.schemaHash, &size, sizeof(size));
+        std::size_t const offset = baseOffset + prop.offset;
+        if (!plan.spans.empty() && plan.spans.back().offset + plan.spans.back().size == offset) {
+            plan.spans.back().size += prop.size;
+        } else if (prop.size > 0) {
+            plan.spans.push_back({offset, prop.size});
+        }
+        plan.wireSize += prop.size;
+    }
+    return true;
+}
+
+// Plans are compiled on first use and kept for the process; registered types are immutable
+struct PlanCache {
+    std::shared_mutex mutex;
+    std::unordered_map<TypeId, std::unique_ptr<BinaryPlan>> plans;
+};
+
+PlanCache& GetPlanCache() {
+    static PlanCache cache;
+    return cache;
+}
+
+BinaryPlan const* GetBinaryPlan(TypeId typeId) {
+    PlanCache& cache = GetPlanCache();
+    {
+        std::shared_lock<std::shared_mutex> lock(cache.mutex);
+        auto it = cache.plans.find(typeId);
+        if (it != cache.plans.end()) {
+            return it->second.get();
+        }
+    }
+    
+    TypeDescriptor const* desc = TypeRegistry::GetTypeById(typeId);
+    if (!desc) {
+        return nullptr;
+    }
+    std::unique_ptr<BinaryPlan> plan(new BinaryPlan());
+    plan->schemaHash = kFnvOffsetBasis;
+    if (!CompilePlan(desc, 0, 0, *plan)) {
+        return nullptr;
+    }
+    
+    std::unique_lock<std::shared_mutex> lock(cache.mutex);
+    std::unique_ptr<BinaryPlan>& slot = cache.plans[typeId];
+    if (!slot) {
+        slot = std::move(plan);  // Another thread may have compiled it meanwhile
+    }
+    return slot.get();
+}
+
+bool IsSchemaBuffer(SerializedBuffer const& buf) {
+    std::uint32_t magic = 0;
+    if (buf.size < sizeof(magic)) {
+        return false;
+    }
+    std::memcpy(&magic, buf.data, sizeof(magic));
+    return magic == kSchemaMagic;
+}
+
 } // namespace
 
 class BinarySerializerImpl : public ISerializer {
 public:
-    BinarySerializerImpl() : version_(kCurrentVersion), migration_(nullptr) {}
+    explicit BinarySerializerImpl(BinaryLayout layout)
+        : version_(kCurrentVersion), migration_(nullptr), layout_(layout) {}
     
     bool Serialize(SerializedBuffer& out, void const* obj, TypeId typeId) override {
         if (!obj || typeId == kInvalidTypeId) {
             return false;
         }
         
+        if (layout_ == BinaryLayout::Schema) {
+            return SerializeSchema(out, obj, typeId);
+        }
+        
         TypeDescriptor const* desc = TypeRegistry::GetTypeById(typeId);
         if (!desc) {
             return false;
@@ -414,6 +552,9 @@ public:
             return false;
         }
         
+        if (layout_ == BinaryLayout::Schema) {
+            return SerializeSchema(out, obj, desc->id);
+        }
         return SerializeInternal(out, obj, desc);
     }
     
@@ -422,6 +563,10 @@ public:
             return false;
         }
         
+        if (IsSchemaBuffer(buf)) {
+            return DeserializeSchema(buf, obj, typeId);
+        }
+        
         TypeDescriptor const* desc = TypeRegistry::GetTypeById(typeId);
         if (!desc) {
             return false;
@@ -440,6 +585,9 @@ public:
             return false;
         }
         
+        if (IsSchemaBuffer(buf)) {
+            return DeserializeSchema(buf, obj, desc->id);
+        }
         return DeserializeInternal(buf, obj, desc);
     }
     
@@ -459,48 +607,100 @@ private:
     bool SerializeInternal(SerializedBuffer& out, void const* obj, TypeDescriptor const* desc) {
         BinaryWriter writer;
         
+        // Reserve the header and patch its size afterwards, so the writer buffer is the output
+        BinaryHeader header{kBinaryMagic, version_, desc->id, 0};
+        if (!writer.WriteValue(header)) {
+            return false;
+        }
+        
         // Write object data
         if (!SerializeObject(writer, obj, desc)) {
             return false;
         }
         
-        // Calculate total size
-        std::size_t headerSize = sizeof(BinaryHeader);
-        std::size_t dataSize = writer.GetSize();
-        std::size_t totalSize = headerSize + dataSize;
+        header.dataSize = static_cast<std::uint32_t>(writer.GetSize() - sizeof(BinaryHeader));
+        std::memcpy(writer.GetData(), &header, sizeof(header));
         
-        // Allocate final buffer
-        void* finalData = te::core::Alloc(totalSize, alignof(std::max_align_t));
-        if (!finalData) {
-            return false;
+        // Update output buffer
+        if (out.data) {
+            te::core::Free(out.data);
         }
+        writer.TransferTo(out);
         
-        // Write header
-        BinaryHeader* header = static_cast<BinaryHeader*>(finalData);
-        header->magic = kBinaryMagic;
-        header->version = version_;
-        header->typeId = desc->id;
-        header->dataSize = static_cast<std::uint32_t>(dataSize);
-        
-        // Copy serialized data
-        std::memcpy(static_cast<char*>(finalData) + headerSize, writer.GetData(), dataSize);
+        return true;
+    }
+    
+    // Name-free layout: header, then the plan's spans back to back (exact size, one allocation)
+    bool SerializeSchema(SerializedBuffer& out, void const* obj, TypeId typeId) {
+        BinaryPlan const* plan = FindPlan(typeId);
+        if (!plan) {
+            return false;
+        }
         
-        // Clean up writer data
-        if (writer.GetData()) {
-            te::core::Free(writer.GetData());
+        std::size_t totalSize = sizeof(SchemaHeader) + plan->wireSize;
+        // Reuse the caller's buffer when it is large enough (repeated snapshots of one type)
+        if (!out.data || out.capacity < totalSize) {
+            void* data = te::core::Alloc(totalSize, alignof(std::max_align_t));
+            if (!data) {
+                return false;
+            }
+            if (out.data) {
+                te::core::Free(out.data);
+            }
+            out.data = data;
+            out.capacity = totalSize;
         }
         
-        // Update output buffer
-        if (out.data) {
-            te::core::Free(out.data);
+        SchemaHeader header{kSchemaMagic, version_, typeId, static_cast<std::uint32_t>(plan->wireSize),
+                            plan->schemaHash};
+        char* dst = static_cast<char*>(out.data);
+        std::memcpy(dst, &header, sizeof(header));
+        dst += sizeof(header);
+        char const* src = static_cast<char const*>(obj);
+        for (PlanSpan const& span : plan->spans) {
+            std::memcpy(dst, src + span.offset, span.size);
+            dst += span.size;
         }
-        out.data = finalData;
         out.size = totalSize;
-        out.capacity = totalSize;
+        return true;
+    }
+    
+    bool DeserializeSchema(SerializedBuffer const& buf, void* obj, TypeId typeId) {
+        if (buf.size < sizeof(SchemaHeader)) {
+            return false;
+        }
+        SchemaHeader header;
+        std::memcpy(&header, buf.data, sizeof(header));
+        if (header.typeId != typeId) {
+            return false;
+        }
         
+        // Without names the data is only meaningful under the writer's exact schema;
+        // schema changes go through the Tagged layout and version migration
+        BinaryPlan const* plan = FindPlan(typeId);
+        if (!plan || header.schemaHash != plan->schemaHash || header.dataSize != plan->wireSize ||
+            buf.size < sizeof(SchemaHeader) + header.dataSize) {
+            return false;
+        }
+        
+        char const* src = static_cast<char const*>(buf.data) + sizeof(SchemaHeader);
+        char* dst = static_cast<char*>(obj);
+        for (PlanSpan const& span : plan->spans) {
+            std::memcpy(dst + span.offset, src, span.size);
+            src += span.size;
+        }
         return true;
     }
     
+    // Remembers the last plan so a run of same-type objects skips the cache lock
+    BinaryPlan const* FindPlan(TypeId typeId) {
+        if (typeId != lastPlanTypeId_ || !lastPlan_) {
+            lastPlan_ = GetBinaryPlan(typeId);
+            lastPlanTypeId_ = typeId;
+        }
+        return lastPlan_;
+    }
+    
     bool DeserializeInternal(SerializedBuffer const& buf, void* obj, TypeDescriptor const* desc) {
         if (buf.size < sizeof(BinaryHeader)) {
             return false;
@@ -543,10 +743,22 @@ private:
     
     std::uint32_t version_;
     IVersionMigration* migration_;
+    BinaryLayout layout_;
+    TypeId lastPlanTypeId_{kInvalidTypeId};
+    BinaryPlan const* lastPlan_{nullptr};
 };
 
 ISerializer* CreateBinarySerializer() {
-    return new BinarySerializerImpl();
+    return new BinarySerializerImpl(BinaryLayout::Tagged);
+}
+
+ISerializer* CreateBinarySerializer(BinaryLayout layout) {
+    return new BinarySerializerImpl(layout);
+}
+
+std::uint64_t GetBinarySchemaHash(TypeId typeId) {
+    BinaryPlan const* plan = GetBinaryPlan(typeId);
+    return plan ? plan->schemaHash : 0;
 }
 
 } // namespace object
@@ -3,20 +3,38 @@
  * @brief Implementation of JSONSerializer (contract: specs/_contracts/002-object-public-api.md).
  * JSON format serialization with readability and debugging support.
  * Supports full type mapping, nested objects, arrays, GUID, ObjectRef, and version migration.
+ *
+ * Each type is compiled once into a JSONTypeInfo (value kinds resolved, perfect-hash key table),
+ * so reading and writing do no registry lookups. The parser is a single forward pass over the
+ * input without copying it; whitespace and string bodies are scanned 16 bytes at a time with
+ * SSE2 where available. The writer appends to one buffer that can be flushed to an
+ * ISerializeSink in chunks.
  */
 
 #include "te/object/Serializer.h"
 #include "te/object/TypeRegistry.h"
 #include "te/object/Guid.h"
 #include "te/core/alloc.h"
-#include <sstream>
-#include <iomanip>
+#include <charconv>
 #include <cstring>
-#include <cctype>
-#include <cmath>
 #include <limits>
 #include <cstdint>
+#include <memory>
+#include <mutex>
+#include <shared_mutex>
 #include <string>
+#include <unordered_map>
+#include <vector>
+
+#if defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+#include <emmintrin.h>
+#if defined(_MSC_VER)
+#include <intrin.h>
+#endif
+#define TE_OBJECT_JSON_SSE2 1
+#else
+#define TE_OBJECT_JSON_SSE2 0
+#endif
 
 namespace te {
 namespace object {
@@ -26,564 +44,819 @@ namespace {
 constexpr std::uint32_t kCurrentVersion = 1;
 constexpr char const* kVersionKey = "$version";
 constexpr char const* kTypeKey = "$type";
+constexpr std::size_t kMaxTypeDepth = 32;
+constexpr std::size_t kSinkChunkSize = 64 * 1024;  // Writer flushes to a sink once this much is buffered
+constexpr std::uint32_t kMaxHashSeeds = 64;        // Seeds tried per table size for the key table
 
-// Helper: Check if type is GUID
-bool IsGUIDType(TypeId typeId) {
-    // GUID is a special type - we'll check by size (16 bytes) and structure
-    // In a full implementation, we'd have a way to identify GUID type
-    // For now, we'll use size as a heuristic
-    TypeDescriptor const* desc = TypeRegistry::GetTypeById(typeId);
-    return desc && desc->size == sizeof(GUID) && desc->name && 
-           std::strcmp(desc->name, "GUID") == 0;
+// === Scanning ===
+
+inline bool IsJSONSpace(char c) {
+    return c == ' ' || c == '\n' || c == '\r' || c == '\t';
 }
 
-// Helper: Check if type is ObjectRef
-bool IsObjectRefType(TypeId typeId) {
-    TypeDescriptor const* desc = TypeRegistry::GetTypeById(typeId);
-    return desc && desc->size == sizeof(ObjectRef) && desc->name && 
-           std::strcmp(desc->name, "ObjectRef") == 0;
+inline bool IsDigit(char c) {
+    return c >= '0' && c <= '9';
 }
 
-// Helper: Escape JSON string
-std::string EscapeJSONString(char const* str) {
-    if (!str) return "";
-    
-    std::ostringstream oss;
-    for (char const* p = str; *p; ++p) {
-        switch (*p) {
-            case '"': oss << "\\\""; break;
-            case '\\': oss << "\\\\"; break;
-            case '\b': oss << "\\b"; break;
-            case '\f': oss << "\\f"; break;
-            case '\n': oss << "\\n"; break;
-            case '\r': oss << "\\r"; break;
-            case '\t': oss << "\\t"; break;
-            default:
-                if (static_cast<unsigned char>(*p) < 0x20) {
-                    oss << "\\u" << std::hex << std::setfill('0') << std::setw(4) 
-                        << static_cast<unsigned int>(*p);
-                } else {
-                    oss << *p;
+#if TE_OBJECT_JSON_SSE2
+inline unsigned CountTrailingZeros(unsigned mask) {
+#if defined(_MSC_VER)
+    unsigned long index = 0;
+    _BitScanForward(&index, mask);
+    return static_cast<unsigned>(index);
+#else
+    return static_cast<unsigned>(__builtin_ctz(mask));
+#endif
+}
+#endif
+
+// First non-whitespace character at or after p (end if none)
+char const* SkipSpaces(char const* p, char const* end) {
+    // Compact JSON rarely has whitespace here: test one byte before paying for vector loads
+    if (p == end || !IsJSONSpace(*p)) {
+        return p;
+    }
+#if TE_OBJECT_JSON_SSE2
+    __m128i const space = _mm_set1_epi8(' ');
+    __m128i const newline = _mm_set1_epi8('\n');
+    __m128i const cr = _mm_set1_epi8('\r');
+    __m128i const tab = _mm_set1_epi8('\t');
+    while (end - p >= 16) {
+        __m128i const chunk = _mm_loadu_si128(reinterpret_cast<__m128i const*>(p));
+        __m128i const ws = _mm_or_si128(_mm_or_si128(_mm_cmpeq_epi8(chunk, space), _mm_cmpeq_epi8(chunk, newline)),
+                                        _mm_or_si128(_mm_cmpeq_epi8(chunk, cr), _mm_cmpeq_epi8(chunk, tab)));
+        unsigned const other = ~static_cast<unsigned>(_mm_movemask_epi8(ws)) & 0xFFFFu;
+        if (other) {
+            return p + CountTrailingZeros(other);
+        }
+        p += 16;
+    }
+#endif
+    while (p != end && IsJSONSpace(*p)) {
+        ++p;
+    }
+    return p;
+}
+
+// First '"' or '\\' at or after p (end if none)
+char const* ScanStringChars(char const* p, char const* end) {
+#if TE_OBJECT_JSON_SSE2
+    __m128i const quote = _mm_set1_epi8('"');
+    __m128i const backslash = _mm_set1_epi8('\\');
+    while (end - p >= 16) {
+        __m128i const chunk = _mm_loadu_si128(reinterpret_cast<__m128i const*>(p));
+        unsigned const hit = static_cast<unsigned>(
+            _mm_movemask_epi8(_mm_or_si128(_mm_cmpeq_epi8(chunk, quote), _mm_cmpeq_epi8(chunk, backslash))));
+        if (hit) {
+            return p + CountTrailingZeros(hit);
+        }
+        p += 16;
+    }
+#endif
+    while (p != end && *p != '"' && *p != '\\') {
+        ++p;
+    }
+    return p;
+}
+
+// === Compiled type layout ===
+
+// How a value is written and read; resolved once per property when the type is compiled
+enum class ValueKind : std::uint8_t {
+    GUID,       // String "xxxxxxxx-..."
+    ObjectRef,  // {"guid": "..."}
+    Object,     // Nested registered type
+    Array,      // Fixed-size array of a property-less registered type
+    Int32,      // 4-byte value (floats round-trip through their bit pattern)
+    Int64,      // 8-byte value
+    Bool,       // 1-byte value
+    Other       // Written as null, skipped when read
+};
+
+struct JSONTypeInfo;
+
+struct JSONValueInfo {
+    ValueKind kind = ValueKind::Other;
+    std::size_t size = 0;
+    JSONTypeInfo const* nested = nullptr;      // Object
+    std::unique_ptr<JSONValueInfo> element;    // Array element
+    std::size_t elementCount = 0;              // Array
+};
+
+struct JSONField {
+    PropertyDescriptor const* prop = nullptr;
+    std::size_t nameLength = 0;
+    JSONValueInfo value;
+};
+
+std::uint32_t HashKey(char const* key, std::size_t length, std::uint32_t seed) {
+    std::uint32_t hash = 2166136261u ^ (seed * 0x9E3779B9u);
+    for (std::size_t i = 0; i < length; ++i) {
+        hash = (hash ^ static_cast<unsigned char>(key[i])) * 16777619u;
+    }
+    return hash ^ (hash >> 16);
+}
+
+// Named properties of a type in declaration order, with a collision-free key table
+struct JSONTypeInfo {
+    TypeDescriptor const* desc = nullptr;
+    std::vector<JSONField> fields;
+    std::vector<std::int32_t> slots;  // Hash slot -> field index, -1 if empty
+    std::uint32_t seed = 0;
+    std::uint32_t mask = 0;
+    bool linearLookup = false;        // No perfect hash found (not expected in practice)
+
+    JSONField const* Find(char const* key, std::size_t length) const {
+        if (linearLookup) {
+            for (JSONField const& field : fields) {
+                if (field.nameLength == length && std::memcmp(field.prop->name, key, length) == 0) {
+                    return &field;
                 }
+            }
+            return nullptr;
+        }
+        if (slots.empty()) {
+            return nullptr;
+        }
+        std::int32_t const index = slots[HashKey(key, length, seed) & mask];
+        if (index < 0) {
+            return nullptr;
+        }
+        JSONField const& field = fields[static_cast<std::size_t>(index)];
+        return field.nameLength == length && std::memcmp(field.prop->name, key, length) == 0 ? &field : nullptr;
+    }
+};
+
+// Find a seed that maps every distinct name to its own slot; the first field of a repeated name wins
+void BuildKeyTable(JSONTypeInfo& info) {
+    std::vector<std::int32_t> keys;
+    for (std::size_t i = 0; i < info.fields.size(); ++i) {
+        JSONField const& field = info.fields[i];
+        bool repeated = false;
+        for (std::int32_t k : keys) {
+            JSONField const& other = info.fields[static_cast<std::size_t>(k)];
+            if (other.nameLength == field.nameLength &&
+                std::memcmp(other.prop->name, field.prop->name, field.nameLength) == 0) {
+                repeated = true;
                 break;
+            }
+        }
+        if (!repeated) {
+            keys.push_back(static_cast<std::int32_t>(i));
+        }
+    }
+    if (keys.empty()) {
+        return;
+    }
+
+    std::uint32_t tableSize = 1;
+    while (tableSize < keys.size() * 2) {
+        tableSize <<= 1;
+    }
+    std::vector<std::int32_t> slots;
+    for (; tableSize <= keys.size() * 64; tableSize <<= 1) {
+        for (std::uint32_t seed = 1; seed <= kMaxHashSeeds; ++seed) {
+            slots.assign(tableSize, -1);
+            bool collision = false;
+            for (std::int32_t k : keys) {
+                JSONField const& field = info.fields[static_cast<std::size_t>(k)];
+                std::int32_t& slot = slots[HashKey(field.prop->name, field.nameLength, seed) & (tableSize - 1)];
+                if (slot >= 0) {
+                    collision = true;
+                    break;
+                }
+                slot = k;
+            }
+            if (!collision) {
+                info.slots = std::move(slots);
+                info.seed = seed;
+                info.mask = tableSize - 1;
+                return;
+            }
+        }
+    }
+    info.linearLookup = true;
+}
+
+// Types compiled on first use and kept for the process; registered types are immutable
+struct JSONTypeCache {
+    std::shared_mutex mutex;
+    std::unordered_map<TypeId, std::unique_ptr<JSONTypeInfo>> infos;
+};
+
+JSONTypeCache& GetJSONTypeCache() {
+    static JSONTypeCache cache;
+    return cache;
+}
+
+JSONTypeInfo const* GetJSONTypeInfo(TypeDescriptor const* desc, std::size_t depth = 0);
+
+bool IsNamedType(TypeDescriptor const* desc, std::size_t size, char const* name) {
+    return desc && desc->size == size && desc->name && std::strcmp(desc->name, name) == 0;
+}
+
+// Classification order matches the original serializer: GUID, ObjectRef, nested object, array, by size
+bool ResolveValue(TypeId valueTypeId, std::size_t size, std::size_t depth, JSONValueInfo& value) {
+    value.size = size;
+    TypeDescriptor const* valueDesc = TypeRegistry::GetTypeById(valueTypeId);
+    if (IsNamedType(valueDesc, sizeof(GUID), "GUID")) {
+        value.kind = ValueKind::GUID;
+    } else if (IsNamedType(valueDesc, sizeof(ObjectRef), "ObjectRef")) {
+        value.kind = ValueKind::ObjectRef;
+    } else if (valueDesc && valueDesc->propertyCount > 0) {
+        value.kind = ValueKind::Object;
+        value.nested = GetJSONTypeInfo(valueDesc, depth + 1);
+        return value.nested != nullptr;
+    } else if (valueDesc && valueDesc->size > 0 && size > valueDesc->size && size % valueDesc->size == 0) {
+        value.kind = ValueKind::Array;
+        value.elementCount = size / valueDesc->size;
+        value.element.reset(new JSONValueInfo());
+        return ResolveValue(valueDesc->id, valueDesc->size, depth + 1, *value.element);
+    } else if (size == sizeof(std::int32_t)) {
+        value.kind = ValueKind::Int32;
+    } else if (size == sizeof(std::int64_t)) {
+        value.kind = ValueKind::Int64;
+    } else if (size == sizeof(bool)) {
+        value.kind = ValueKind::Bool;
+    } else {
+        value.kind = ValueKind::Other;
+    }
+    return true;
+}
+
+JSONTypeInfo const* GetJSONTypeInfo(TypeDescriptor const* desc, std::size_t depth) {
+    JSONTypeCache& cache = GetJSONTypeCache();
+    {
+        std::shared_lock<std::shared_mutex> lock(cache.mutex);
+        auto it = cache.infos.find(desc->id);
+        if (it != cache.infos.end()) {
+            return it->second.get();
+        }
+    }
+    if (depth > kMaxTypeDepth) {
+        return nullptr;  // Descriptor nests itself
+    }
+
+    std::unique_ptr<JSONTypeInfo> info(new JSONTypeInfo());
+    info->desc = desc;
+    for (std::size_t i = 0; i < desc->propertyCount; ++i) {
+        PropertyDescriptor const& prop = desc->properties[i];
+        if (!prop.name) {
+            continue;
         }
+        JSONField field;
+        field.prop = &prop;
+        field.nameLength = std::strlen(prop.name);
+        if (!ResolveValue(prop.valueTypeId, prop.size, depth, field.value)) {
+            return nullptr;
+        }
+        info->fields.push_back(std::move(field));
+    }
+    BuildKeyTable(*info);
+
+    std::unique_lock<std::shared_mutex> lock(cache.mutex);
+    std::unique_ptr<JSONTypeInfo>& slot = cache.infos[desc->id];
+    if (!slot) {
+        slot = std::move(info);  // Another thread may have compiled it meanwhile
     }
-    return oss.str();
+    return slot.get();
 }
 
-// JSON writer with full type support
+// === Writer ===
+
+// JSON writer: appends to one buffer; with a sink, full chunks are flushed as writing proceeds
 class JSONWriter {
 public:
-    JSONWriter() {
-        stream_.precision(17);  // Maximum precision for double
-    }
-    
+    explicit JSONWriter(ISerializeSink* sink = nullptr) : sink_(sink) {}
+
     void StartObject() {
-        stream_ << '{';
+        buffer_ += '{';
         first_ = true;
     }
-    
+
     void EndObject() {
-        stream_ << '}';
+        buffer_ += '}';
     }
-    
+
     void StartArray() {
-        stream_ << '[';
+        buffer_ += '[';
         first_ = true;
     }
-    
+
     void EndArray() {
-        stream_ << ']';
+        buffer_ += ']';
     }
-    
+
     void WriteKey(char const* key) {
-        if (!first_) {
-            stream_ << ',';
-        }
-        first_ = false;
+        Separate();
         WriteString(key);
-        stream_ << ':';
+        buffer_ += ':';
     }
-    
+
+    void WriteArrayElement() {
+        Separate();
+    }
+
     void WriteString(char const* str) {
-        stream_ << '"' << EscapeJSONString(str) << '"';
-    }
-    
-    void WriteNumber(std::int64_t value) {
-        stream_ << value;
-    }
-    
-    void WriteNumber(std::uint64_t value) {
-        stream_ << value;
-    }
-    
-    void WriteNumber(std::int32_t value) {
-        stream_ << value;
-    }
-    
-    void WriteNumber(std::uint32_t value) {
-        stream_ << value;
-    }
-    
-    void WriteNumber(float value) {
-        if (std::isnan(value)) {
-            stream_ << "null";
-        } else if (std::isinf(value)) {
-            stream_ << (value < 0 ? "-1e999" : "1e999");
-        } else {
-            stream_ << value;
+        buffer_ += '"';
+        if (str) {
+            AppendEscaped(str);
         }
+        buffer_ += '"';
     }
-    
-    void WriteNumber(double value) {
-        if (std::isnan(value)) {
-            stream_ << "null";
-        } else if (std::isinf(value)) {
-            stream_ << (value < 0 ? "-1e999" : "1e999");
-        } else {
-            stream_ << value;
-        }
+
+    template<typename T>
+    void WriteNumber(T value) {
+        char digits[24];
+        std::to_chars_result const result = std::to_chars(digits, digits + sizeof(digits), value);
+        buffer_.append(digits, result.ptr);
     }
-    
+
     void WriteBoolean(bool value) {
-        stream_ << (value ? "true" : "false");
+        buffer_ += value ? "true" : "false";
     }
-    
+
     void WriteNull() {
-        stream_ << "null";
+        buffer_ += "null";
     }
-    
+
     void WriteGUID(GUID const& guid) {
         WriteString(guid.ToString().c_str());
     }
-    
+
     void WriteObjectRef(ObjectRef const& ref) {
         StartObject();
         WriteKey("guid");
         WriteGUID(ref.guid);
         EndObject();
     }
-    
-    void WriteArrayElement() {
-        if (!first_) {
-            stream_ << ',';
+
+    /** Flush what is left to the sink; false if any sink write failed. */
+    bool Finish() {
+        if (sink_ && ok_ && !buffer_.empty()) {
+            ok_ = sink_->Write(buffer_.data(), buffer_.size());
+            buffer_.clear();
         }
-        first_ = false;
+        return ok_;
     }
-    
-    std::string GetString() const {
-        return stream_.str();
+
+    bool IsOk() const {
+        return ok_;
     }
-    
-    void ResetFirst() {
-        first_ = true;
+
+    std::string const& GetBuffer() const {
+        return buffer_;
     }
-    
+
 private:
-    std::ostringstream stream_;
+    void Separate() {
+        if (!first_) {
+            buffer_ += ',';
+        }
+        first_ = false;
+        if (sink_ && buffer_.size() >= kSinkChunkSize) {
+            ok_ = ok_ && sink_->Write(buffer_.data(), buffer_.size());
+            buffer_.clear();
+        }
+    }
+
+    void AppendEscaped(char const* str) {
+        char const* run = str;
+        for (char const* p = str; *p; ++p) {
+            unsigned char const c = static_cast<unsigned char>(*p);
+            if (c >= 0x20 && c != '"' && c != '\\') {
+                continue;
+            }
+            buffer_.append(run, p);
+            run = p + 1;
+            switch (c) {
+                case '"': buffer_ += "\\\""; break;
+                case '\\': buffer_ += "\\\\"; break;
+                case '\b': buffer_ += "\\b"; break;
+                case '\f': buffer_ += "\\f"; break;
+                case '\n': buffer_ += "\\n"; break;
+                case '\r': buffer_ += "\\r"; break;
+                case '\t': buffer_ += "\\t"; break;
+                default: {
+                    char const hex[] = "0123456789abcdef";
+                    char escaped[] = {'\\', 'u', '0', '0', hex[c >> 4], hex[c & 0xF]};
+                    buffer_.append(escaped, sizeof(escaped));
+                    break;
+                }
+            }
+        }
+        buffer_.append(run);
+    }
+
+    ISerializeSink* sink_;
+    std::string buffer_;
     bool first_ = true;
+    bool ok_ = true;
 };
 
-// JSON parser with full type support
+void WriteObject(JSONWriter& writer, void const* obj, JSONTypeInfo const& info, std::uint32_t version);
+
+void WriteValue(JSONWriter& writer, void const* ptr, JSONValueInfo const& value) {
+    switch (value.kind) {
+        case ValueKind::GUID:
+            writer.WriteGUID(*static_cast<GUID const*>(ptr));
+            break;
+        case ValueKind::ObjectRef:
+            writer.WriteObjectRef(*static_cast<ObjectRef const*>(ptr));
+            break;
+        case ValueKind::Object:
+            WriteObject(writer, ptr, *value.nested, kCurrentVersion);
+            break;
+        case ValueKind::Array:
+            writer.StartArray();
+            for (std::size_t i = 0; i < value.elementCount; ++i) {
+                writer.WriteArrayElement();
+                WriteValue(writer, static_cast<char const*>(ptr) + i * value.element->size, *value.element);
+            }
+            writer.EndArray();
+            break;
+        case ValueKind::Int32: {
+            std::int32_t v;
+            std::memcpy(&v, ptr, sizeof(v));
+            writer.WriteNumber(v);
+            break;
+        }
+        case ValueKind::Int64: {
+            std::int64_t v;
+            std::memcpy(&v, ptr, sizeof(v));
+            writer.WriteNumber(v);
+            break;
+        }
+        case ValueKind::Bool:
+            writer.WriteBoolean(*static_cast<std::uint8_t const*>(ptr) != 0);
+            break;
+        case ValueKind::Other:
+            writer.WriteNull();
+            break;
+    }
+}
+
+void WriteObject(JSONWriter& writer, void const* obj, JSONTypeInfo const& info, std::uint32_t version) {
+    writer.StartObject();
+
+    // Write version
+    writer.WriteKey(kVersionKey);
+    writer.WriteNumber(version);
+
+    // Write type (optional, for debugging)
+    writer.WriteKey(kTypeKey);
+    writer.WriteString(info.desc->name);
+
+    for (JSONField const& field : info.fields) {
+        writer.WriteKey(field.prop->name);
+        WriteValue(writer, static_cast<char const*>(obj) + field.prop->offset, field.value);
+    }
+
+    writer.EndObject();
+}
+
+// === Parser ===
+
+// JSON parser over [json, json + length); does not require null termination
 class JSONParser {
 public:
-    JSONParser(char const* json) : json_(json), pos_(0), errorPath_("$") {}
-    
+    JSONParser(char const* json, std::size_t length) : p_(json), end_(json + length) {}
+
     bool HasError() const {
         return !errorMessage_.empty();
     }
-    
+
     std::string const& GetError() const {
         return errorMessage_;
     }
-    
-    std::string const& GetErrorPath() const {
-        return errorPath_;
+
+    /** JSONPath of the value being parsed when the error occurred, e.g. "$.transform.position[2]". */
+    std::string GetErrorPath() const {
+        std::string path = "$";
+        for (PathSegment const& segment : path_) {
+            if (segment.key) {
+                path += '.';
+                path += segment.key;
+            } else {
+                path += '[';
+                path += std::to_string(segment.index);
+                path += ']';
+            }
+        }
+        return path;
     }
-    
-    bool ParseObject(void* obj, TypeDescriptor const* desc) {
-        std::string savedPath = errorPath_;
+
+    bool ParseObject(void* obj, JSONTypeInfo const& info) {
         SkipWhitespace();
-        
         if (Peek() != '{') {
             SetError("Expected '{'");
             return false;
         }
-        Advance();  // Skip '{'
-        
+        ++p_;
         SkipWhitespace();
-        
-        // Parse version and type metadata first
+
         std::uint32_t version = kCurrentVersion;
-        bool hasVersion = false;
-        
         while (Peek() != '}') {
-            if (Peek() == '\0') {
+            if (p_ == end_) {
                 SetError("Unexpected end of input");
                 return false;
             }
-            
+
             // Parse key
             if (Peek() != '"') {
                 SetError("Expected '\"' for key");
                 return false;
             }
-            Advance();  // Skip '"'
-            
-            std::string key = ParseString();
-            if (Peek() != '"') {
+            ++p_;
+            char const* key = nullptr;
+            std::size_t keyLength = 0;
+            if (!ParseStringBody(key, keyLength)) {
                 SetError("Expected '\"' after key");
                 return false;
             }
-            Advance();  // Skip '"'
-            
+
             SkipWhitespace();
             if (Peek() != ':') {
                 SetError("Expected ':' after key");
                 return false;
             }
-            Advance();  // Skip ':'
+            ++p_;
             SkipWhitespace();
-            
-            // Handle metadata keys
-            if (key == kVersionKey) {
+
+            // Handle metadata keys, then properties
+            if (KeyEquals(key, keyLength, kVersionKey)) {
                 if (!ParseUInt32(version)) {
                     SetError("Invalid version number");
                     return false;
                 }
-                hasVersion = true;
-            } else if (key == kTypeKey) {
-                // Skip type name (for debugging)
+            } else if (KeyEquals(key, keyLength, kTypeKey)) {
                 SkipValue();
-            } else {
-                // Find property and parse value
-                PropertyDescriptor const* prop = nullptr;
-                for (std::size_t i = 0; i < desc->propertyCount; ++i) {
-                    if (desc->properties[i].name && key == desc->properties[i].name) {
-                        prop = &desc->properties[i];
-                        break;
-                    }
-                }
-                
-                if (prop) {
-                    errorPath_ = savedPath + "." + key;
-                    void* propPtr = static_cast<char*>(obj) + prop->offset;
-                    if (!ParseValue(propPtr, prop)) {
-                        return false;
-                    }
-                    errorPath_ = savedPath;
-                } else {
-                    // Skip unknown property
-                    SkipValue();
+            } else if (JSONField const* field = info.Find(key, keyLength)) {
+                path_.push_back({field->prop->name, 0});
+                if (!ParseValue(static_cast<char*>(obj) + field->prop->offset, field->value)) {
+                    return false;
                 }
+                path_.pop_back();
+            } else {
+                // Skip unknown property
+                SkipValue();
             }
-            
+
             SkipWhitespace();
             if (Peek() == ',') {
-                Advance();
+                ++p_;
                 SkipWhitespace();
             } else if (Peek() != '}') {
                 SetError("Expected ',' or '}'");
                 return false;
             }
         }
-        
-        Advance();  // Skip '}'
-        
-        // Store version for migration check (would be used by caller)
+        ++p_;  // Skip '}'
+
+        // Store version for migration check (the root object finishes last)
         parsedVersion_ = version;
-        
         return true;
     }
-    
+
     std::uint32_t GetParsedVersion() const {
         return parsedVersion_;
     }
-    
-    bool ParseArray(void* arr, TypeDescriptor const* elementDesc, std::size_t elementSize, std::size_t count) {
-        std::string savedPath = errorPath_;
-        SkipWhitespace();
-        
-        if (Peek() != '[') {
-            SetError("Expected '['");
+
+private:
+    struct PathSegment {
+        char const* key;    // Property name, or nullptr for an array index
+        std::size_t index;
+    };
+
+    char Peek() const {
+        return p_ != end_ ? *p_ : '\0';
+    }
+
+    void SkipWhitespace() {
+        p_ = SkipSpaces(p_, end_);
+    }
+
+    void SetError(char const* msg) {
+        errorMessage_ = msg;
+    }
+
+    static bool KeyEquals(char const* key, std::size_t length, char const* literal) {
+        return std::strncmp(key, literal, length) == 0 && literal[length] == '\0';
+    }
+
+    bool Match(char const* literal, std::size_t length) {
+        if (static_cast<std::size_t>(end_ - p_) < length || std::memcmp(p_, literal, length) != 0) {
             return false;
         }
-        Advance();  // Skip '['
-        
-        SkipWhitespace();
-        
-        std::size_t index = 0;
-        while (Peek() != ']') {
-            if (Peek() == '\0') {
-                SetError("Unexpected end of input");
-                return false;
-            }
-            
-            if (index >= count) {
-                SetError("Array index out of bounds");
-                return false;
-            }
-            
-            errorPath_ = savedPath + "[" + std::to_string(index) + "]";
-            void* elementPtr = static_cast<char*>(arr) + (index * elementSize);
-            
-            // Create a temporary PropertyDescriptor for the element
-            PropertyDescriptor elementProp;
-            elementProp.name = nullptr;  // Array element has no name
-            elementProp.valueTypeId = elementDesc ? elementDesc->id : kInvalidTypeId;
-            elementProp.offset = 0;
-            elementProp.size = elementSize;
-            elementProp.defaultValue = nullptr;
-            
-            if (!ParseValue(elementPtr, &elementProp)) {
-                return false;
-            }
-            
-            index++;
-            errorPath_ = savedPath;
-            
-            SkipWhitespace();
-            if (Peek() == ',') {
-                Advance();
-                SkipWhitespace();
-            } else if (Peek() != ']') {
-                SetError("Expected ',' or ']'");
-                return false;
+        p_ += length;
+        return true;
+    }
+
+    // After the opening quote: consume the string and its closing quote. Strings without
+    // escapes are returned in place; escaped ones are decoded into scratch_ (reused)
+    bool ParseStringBody(char const*& str, std::size_t& length) {
+        char const* const start = p_;
+        char const* stop = ScanStringChars(p_, end_);
+        if (stop != end_ && *stop == '"') {
+            str = start;
+            length = static_cast<std::size_t>(stop - start);
+            p_ = stop + 1;
+            return true;
+        }
+
+        scratch_.assign(start, stop);
+        p_ = stop;
+        while (p_ != end_ && *p_ != '"') {
+            if (*p_ == '\\') {
+                ++p_;
+                DecodeEscape();
+            } else {
+                char const* run = ScanStringChars(p_, end_);
+                scratch_.append(p_, run);
+                p_ = run;
             }
         }
-        
-        Advance();  // Skip ']'
+        if (p_ == end_) {
+            return false;
+        }
+        ++p_;
+        str = scratch_.data();
+        length = scratch_.size();
         return true;
     }
-    
-private:
-    char Peek() const {
-        return json_[pos_];
-    }
-    
-    void Advance() {
-        if (json_[pos_]) ++pos_;
-    }
-    
-    void SkipWhitespace() {
-        while (std::isspace(Peek())) {
-            Advance();
+
+    void SkipStringBody() {
+        for (;;) {
+            p_ = ScanStringChars(p_, end_);
+            if (p_ == end_) {
+                return;
+            }
+            if (*p_ == '"') {
+                ++p_;
+                return;
+            }
+            p_ += end_ - p_ >= 2 ? 2 : 1;  // Backslash and the escaped character
         }
     }
-    
-    void SetError(char const* msg) {
-        errorMessage_ = msg;
+
+    static int HexValue(char c) {
+        if (c >= '0' && c <= '9') return c - '0';
+        if (c >= 'a' && c <= 'f') return c - 'a' + 10;
+        if (c >= 'A' && c <= 'F') return c - 'A' + 10;
+        return -1;
     }
-    
-    std::string ParseString() {
-        std::string result;
-        while (Peek() && Peek() != '"') {
-            if (Peek() == '\\') {
-                Advance();
-                char c = Peek();
-                switch (c) {
-                    case '"': result += '"'; Advance(); break;
-                    case '\\': result += '\\'; Advance(); break;
-                    case '/': result += '/'; Advance(); break;
-                    case 'b': result += '\b'; Advance(); break;
-                    case 'f': result += '\f'; Advance(); break;
-                    case 'n': result += '\n'; Advance(); break;
-                    case 'r': result += '\r'; Advance(); break;
-                    case 't': result += '\t'; Advance(); break;
-                    case 'u': {
-                        Advance();  // Skip 'u'
-                        char hex[5] = {0};
-                        for (int i = 0; i < 4 && Peek(); ++i) {
-                            hex[i] = Peek();
-                            Advance();
-                        }
-                        unsigned int code = 0;
-                        std::sscanf(hex, "%x", &code);
-                        if (code < 0x80) {
-                            result += static_cast<char>(code);
-                        } else if (code < 0x800) {
-                            result += static_cast<char>(0xC0 | (code >> 6));
-                            result += static_cast<char>(0x80 | (code & 0x3F));
-                        } else {
-                            result += static_cast<char>(0xE0 | (code >> 12));
-                            result += static_cast<char>(0x80 | ((code >> 6) & 0x3F));
-                            result += static_cast<char>(0x80 | (code & 0x3F));
-                        }
-                        break;
-                    }
-                    default:
-                        result += c;
-                        Advance();
-                        break;
+
+    void DecodeEscape() {
+        if (p_ == end_) {
+            return;
+        }
+        char const c = *p_++;
+        switch (c) {
+            case 'b': scratch_ += '\b'; break;
+            case 'f': scratch_ += '\f'; break;
+            case 'n': scratch_ += '\n'; break;
+            case 'r': scratch_ += '\r'; break;
+            case 't': scratch_ += '\t'; break;
+            case 'u': {
+                unsigned int code = 0;
+                for (int i = 0; i < 4 && p_ != end_ && HexValue(*p_) >= 0; ++i, ++p_) {
+                    code = code * 16 + static_cast<unsigned int>(HexValue(*p_));
                 }
-            } else {
-                result += Peek();
-                Advance();
+                if (code < 0x80) {
+                    scratch_ += static_cast<char>(code);
+                } else if (code < 0x800) {
+                    scratch_ += static_cast<char>(0xC0 | (code >> 6));
+                    scratch_ += static_cast<char>(0x80 | (code & 0x3F));
+                } else {
+                    scratch_ += static_cast<char>(0xE0 | (code >> 12));
+                    scratch_ += static_cast<char>(0x80 | ((code >> 6) & 0x3F));
+                    scratch_ += static_cast<char>(0x80 | (code & 0x3F));
+                }
+                break;
             }
+            default:
+                scratch_ += c;  // '"', '\\', '/'
+                break;
         }
-        return result;
     }
-    
+
     bool ParseInt32(std::int32_t& out) {
-        SkipWhitespace();
-        bool negative = false;
-        if (Peek() == '-') {
-            negative = true;
-            Advance();
+        bool const negative = Peek() == '-';
+        if (negative) {
+            ++p_;
         }
-        
-        if (!std::isdigit(Peek())) {
+        if (!IsDigit(Peek())) {
             return false;
         }
-        
-        int64_t value = 0;
-        while (std::isdigit(Peek())) {
-            value = value * 10 + (Peek() - '0');
+
+        std::int64_t value = 0;
+        while (IsDigit(Peek())) {
+            value = value * 10 + (*p_ - '0');
             if (value > static_cast<std::int64_t>(std::numeric_limits<std::int32_t>::max()) + 1) {
                 return false;
             }
-            Advance();
+            ++p_;
         }
-        
         if (negative) {
             value = -value;
         }
-        
-        if (value < std::numeric_limits<std::int32_t>::min() || 
+        if (value < std::numeric_limits<std::int32_t>::min() ||
             value > std::numeric_limits<std::int32_t>::max()) {
             return false;
         }
-        
         out = static_cast<std::int32_t>(value);
         return true;
     }
-    
+
     bool ParseUInt32(std::uint32_t& out) {
-        SkipWhitespace();
-        if (!std::isdigit(Peek())) {
+        if (!IsDigit(Peek())) {
             return false;
         }
-        
-        uint64_t value = 0;
-        while (std::isdigit(Peek())) {
-            value = value * 10 + (Peek() - '0');
+        std::uint64_t value = 0;
+        while (IsDigit(Peek())) {
+            value = value * 10 + static_cast<std::uint64_t>(*p_ - '0');
             if (value > std::numeric_limits<std::uint32_t>::max()) {
                 return false;
             }
-            Advance();
+            ++p_;
         }
-        
         out = static_cast<std::uint32_t>(value);
         return true;
     }
-    
-    bool ParseInt64(int64_t& out) {
-        SkipWhitespace();
-        bool negative = false;
-        if (Peek() == '-') {
-            negative = true;
-            Advance();
-        }
-        
-        if (!std::isdigit(Peek())) {
-            return false;
-        }
-        
-        std::int64_t value = 0;
-        while (std::isdigit(Peek())) {
-            value = value * 10 + (Peek() - '0');
-            Advance();
-        }
-        
+
+    bool ParseInt64(std::int64_t& out) {
+        bool const negative = Peek() == '-';
         if (negative) {
-            value = -value;
+            ++p_;
         }
-        
-        out = value;
-        return true;
-    }
-    
-    bool ParseDouble(double& out) {
-        SkipWhitespace();
-        char* endPtr = nullptr;
-        double value = std::strtod(json_ + pos_, &endPtr);
-        if (endPtr == json_ + pos_) {
+        if (!IsDigit(Peek())) {
             return false;
         }
-        pos_ = endPtr - json_;
-        out = value;
+        std::uint64_t value = 0;  // Unsigned so the accumulation wraps instead of overflowing
+        while (IsDigit(Peek())) {
+            value = value * 10 + static_cast<std::uint64_t>(*p_ - '0');
+            ++p_;
+        }
+        out = static_cast<std::int64_t>(negative ? 0 - value : value);
         return true;
     }
-    
+
     bool ParseBoolean(bool& out) {
-        SkipWhitespace();
-        if (Peek() == 't') {
-            if (std::strncmp(json_ + pos_, "true", 4) == 0) {
-                pos_ += 4;
-                out = true;
-                return true;
-            }
-        } else if (Peek() == 'f') {
-            if (std::strncmp(json_ + pos_, "false", 5) == 0) {
-                pos_ += 5;
-                out = false;
-                return true;
-            }
+        if (Match("true", 4)) {
+            out = true;
+            return true;
+        }
+        if (Match("false", 5)) {
+            out = false;
+            return true;
         }
         return false;
     }
-    
+
     bool ParseGUID(GUID& out) {
         SkipWhitespace();
         if (Peek() != '"') {
             return false;
         }
-        Advance();  // Skip '"'
-        
-        std::string str = ParseString();
-        if (Peek() != '"') {
+        ++p_;
+        char const* str = nullptr;
+        std::size_t length = 0;
+        if (!ParseStringBody(str, length)) {
             return false;
         }
-        Advance();  // Skip '"'
-        
-        out = GUID::FromString(str.c_str());
+        scratch_.assign(str, length);  // FromString needs a terminated string
+        out = GUID::FromString(scratch_.c_str());
         return true;
     }
-    
+
     bool ParseObjectRef(ObjectRef& out) {
         SkipWhitespace();
         if (Peek() != '{') {
             return false;
         }
-        Advance();  // Skip '{'
-        
+        ++p_;
         SkipWhitespace();
-        
+
         bool hasGuid = false;
         while (Peek() != '}') {
-            if (Peek() == '\0') {
+            if (p_ == end_ || Peek() != '"') {
                 return false;
             }
-            
-            // Parse key
-            if (Peek() != '"') {
+            ++p_;
+            char const* key = nullptr;
+            std::size_t keyLength = 0;
+            if (!ParseStringBody(key, keyLength)) {
                 return false;
             }
-            Advance();
-            std::string key = ParseString();
-            if (Peek() != '"') {
-                return false;
-            }
-            Advance();
-            
+
             SkipWhitespace();
             if (Peek() != ':') {
                 return false;
             }
-            Advance();
+            ++p_;
             SkipWhitespace();
-            
-            if (key == "guid") {
+
+            if (KeyEquals(key, keyLength, "guid")) {
                 if (!ParseGUID(out.guid)) {
                     return false;
                 }
@@ -591,381 +864,257 @@ private:
             } else {
                 SkipValue();
             }
-            
+
             SkipWhitespace();
             if (Peek() == ',') {
-                Advance();
+                ++p_;
                 SkipWhitespace();
             }
         }
-        
-        Advance();  // Skip '}'
+        ++p_;  // Skip '}'
         return hasGuid;
     }
-    
-    bool ParseValue(void* out, PropertyDescriptor const* prop) {
+
+    bool ParseArray(void* arr, JSONValueInfo const& value) {
+        ++p_;  // Skip '['
         SkipWhitespace();
-        char c = Peek();
-        
-        TypeDescriptor const* valueTypeDesc = TypeRegistry::GetTypeById(prop->valueTypeId);
-        
-        // Check for GUID
-        if (IsGUIDType(prop->valueTypeId)) {
-            GUID* guidPtr = static_cast<GUID*>(out);
-            return ParseGUID(*guidPtr);
-        }
-        
-        // Check for ObjectRef
-        if (IsObjectRefType(prop->valueTypeId)) {
-            ObjectRef* refPtr = static_cast<ObjectRef*>(out);
-            return ParseObjectRef(*refPtr);
-        }
-        
-        // Check for nested object
-        if (valueTypeDesc && valueTypeDesc->propertyCount > 0) {
-            if (c == '{') {
-                return ParseObject(out, valueTypeDesc);
-            } else {
-                SetError("Expected object");
+
+        std::size_t index = 0;
+        while (Peek() != ']') {
+            if (p_ == end_) {
+                SetError("Unexpected end of input");
                 return false;
             }
-        }
-        
-        // Check for array (simplified: assume fixed-size array if size > element size)
-        if (valueTypeDesc && prop->size > valueTypeDesc->size && prop->size % valueTypeDesc->size == 0) {
-            std::size_t elementCount = prop->size / valueTypeDesc->size;
-            if (c == '[') {
-                return ParseArray(out, valueTypeDesc, valueTypeDesc->size, elementCount);
-            } else {
-                SetError("Expected array");
+            if (index >= value.elementCount) {
+                SetError("Array index out of bounds");
+                return false;
+            }
+
+            path_.push_back({nullptr, index});
+            if (!ParseValue(static_cast<char*>(arr) + index * value.element->size, *value.element)) {
                 return false;
             }
+            path_.pop_back();
+            ++index;
+
+            SkipWhitespace();
+            if (Peek() == ',') {
+                ++p_;
+                SkipWhitespace();
+            } else if (Peek() != ']') {
+                SetError("Expected ',' or ']'");
+                return false;
+            }
+        }
+        ++p_;  // Skip ']'
+        return true;
+    }
+
+    bool ParseValue(void* out, JSONValueInfo const& value) {
+        SkipWhitespace();
+        char const c = Peek();
+
+        switch (value.kind) {
+            case ValueKind::GUID:
+                return ParseGUID(*static_cast<GUID*>(out));
+            case ValueKind::ObjectRef:
+                return ParseObjectRef(*static_cast<ObjectRef*>(out));
+            case ValueKind::Object:
+                if (c != '{') {
+                    SetError("Expected object");
+                    return false;
+                }
+                return ParseObject(out, *value.nested);
+            case ValueKind::Array:
+                if (c != '[') {
+                    SetError("Expected array");
+                    return false;
+                }
+                return ParseArray(out, value);
+            default:
+                break;
         }
-        
+
         // Basic types
         if (c == '"') {
-            // String
-            Advance();
-            std::string str = ParseString();
-            if (Peek() != '"') {
+            // String storage is not supported by property descriptors: the value is skipped
+            ++p_;
+            char const* str = nullptr;
+            std::size_t length = 0;
+            if (!ParseStringBody(str, length)) {
                 SetError("Expected '\"' after string");
                 return false;
             }
-            Advance();
-            
-            // For string properties, we'd need to handle string storage
-            // For now, assume string is stored as pointer (simplified)
-            if (prop->size >= sizeof(char*)) {
-                // In real implementation, would allocate and copy string
-                // For now, just skip
-            }
             return true;
-        } else if (c == '-' || std::isdigit(c)) {
-            // Number
-            if (prop->size == sizeof(std::int32_t)) {
-                std::int32_t value;
-                if (!ParseInt32(value)) {
+        }
+        if (c == '-' || IsDigit(c)) {
+            if (value.kind == ValueKind::Int32) {
+                std::int32_t v;
+                if (!ParseInt32(v)) {
                     SetError("Invalid int32");
                     return false;
                 }
-                *static_cast<std::int32_t*>(out) = value;
-            } else if (prop->size == sizeof(std::uint32_t)) {
-                std::uint32_t value;
-                if (!ParseUInt32(value)) {
-                    SetError("Invalid uint32");
-                    return false;
-                }
-                *static_cast<std::uint32_t*>(out) = value;
-            } else if (prop->size == sizeof(std::int64_t)) {
-                std::int64_t value;
-                if (!ParseInt64(value)) {
+                std::memcpy(out, &v, sizeof(v));
+            } else if (value.kind == ValueKind::Int64) {
+                std::int64_t v;
+                if (!ParseInt64(v)) {
                     SetError("Invalid int64");
                     return false;
                 }
-                *static_cast<std::int64_t*>(out) = value;
-            } else if (prop->size == sizeof(float)) {
-                double value;
-                if (!ParseDouble(value)) {
-                    SetError("Invalid float");
-                    return false;
-                }
-                *static_cast<float*>(out) = static_cast<float>(value);
-            } else if (prop->size == sizeof(double)) {
-                double value;
-                if (!ParseDouble(value)) {
-                    SetError("Invalid double");
-                    return false;
-                }
-                *static_cast<double*>(out) = value;
+                std::memcpy(out, &v, sizeof(v));
             } else {
                 SkipValue();
             }
             return true;
-        } else if (c == 't' || c == 'f') {
-            // Boolean
-            bool value;
-            if (!ParseBoolean(value)) {
+        }
+        if (c == 't' || c == 'f') {
+            bool v;
+            if (!ParseBoolean(v)) {
                 SetError("Invalid boolean");
                 return false;
             }
-            if (prop->size == sizeof(bool)) {
-                *static_cast<bool*>(out) = value;
+            if (value.size == sizeof(bool)) {
+                *static_cast<bool*>(out) = v;
             }
             return true;
-        } else if (c == 'n') {
-            // Null
-            if (std::strncmp(json_ + pos_, "null", 4) == 0) {
-                pos_ += 4;
-                // Leave value as-is (use default)
+        }
+        if (c == 'n') {
+            // Null leaves the value as-is (default)
+            if (Match("null", 4)) {
                 return true;
             }
             SetError("Invalid null");
             return false;
-        } else if (c == '{') {
-            // Nested object (handled above)
+        }
+        if (c == '{') {
             SetError("Unexpected nested object");
             return false;
-        } else if (c == '[') {
-            // Array (handled above)
+        }
+        if (c == '[') {
             SetError("Unexpected array");
             return false;
         }
-        
         SetError("Unexpected character");
         return false;
     }
-    
+
     void SkipValue() {
         SkipWhitespace();
-        char c = Peek();
+        char const c = Peek();
         if (c == '"') {
-            Advance();
-            while (Peek() && Peek() != '"') {
-                if (Peek() == '\\') Advance();
-                Advance();
-            }
-            if (Peek() == '"') Advance();
-        } else if (c == '{') {
-            int depth = 1;
-            Advance();
-            while (depth > 0 && Peek()) {
-                if (Peek() == '{') ++depth;
-                else if (Peek() == '}') --depth;
-                Advance();
-            }
-        } else if (c == '[') {
-            int depth = 1;
-            Advance();
-            while (depth > 0 && Peek()) {
-                if (Peek() == '[') ++depth;
-                else if (Peek() == ']') --depth;
-                Advance();
+            ++p_;
+            SkipStringBody();
+        } else if (c == '{' || c == '[') {
+            // Brackets inside strings do not count towards the depth
+            int depth = 0;
+            while (p_ != end_) {
+                char const d = *p_++;
+                if (d == '"') {
+                    SkipStringBody();
+                } else if (d == '{' || d == '[') {
+                    ++depth;
+                } else if ((d == '}' || d == ']') && --depth == 0) {
+                    return;
+                }
             }
         } else {
-            while (Peek() && Peek() != ',' && Peek() != '}' && Peek() != ']' && !std::isspace(Peek())) {
-                Advance();
+            while (p_ != end_ && *p_ != ',' && *p_ != '}' && *p_ != ']' && !IsJSONSpace(*p_)) {
+                ++p_;
             }
         }
     }
-    
-    char const* json_;
-    std::size_t pos_;
+
+    char const* p_;
+    char const* end_;
+    std::string scratch_;             // Decoded escaped strings; capacity reused across keys
+    std::vector<PathSegment> path_;   // Property stack, turned into a string only on error
     std::string errorMessage_;
-    std::string errorPath_;
     std::uint32_t parsedVersion_ = kCurrentVersion;
 };
 
-// Helper: Serialize property value recursively
-bool SerializeProperty(JSONWriter& writer, void const* propPtr, PropertyDescriptor const* prop, TypeDescriptor const* valueTypeDesc) {
-    if (IsGUIDType(prop->valueTypeId)) {
-        GUID const* guidPtr = static_cast<GUID const*>(propPtr);
-        writer.WriteGUID(*guidPtr);
-        return true;
-    }
-    
-    if (IsObjectRefType(prop->valueTypeId)) {
-        ObjectRef const* refPtr = static_cast<ObjectRef const*>(propPtr);
-        writer.WriteObjectRef(*refPtr);
-        return true;
-    }
-    
-    // Nested object
-    if (valueTypeDesc && valueTypeDesc->propertyCount > 0) {
-        writer.StartObject();
-        
-        // Write version
-        writer.WriteKey(kVersionKey);
-        writer.WriteNumber(static_cast<std::uint32_t>(kCurrentVersion));
-        
-        // Write type (optional, for debugging)
-        writer.WriteKey(kTypeKey);
-        writer.WriteString(valueTypeDesc->name);
-        
-        // Write properties recursively
-        for (std::size_t i = 0; i < valueTypeDesc->propertyCount; ++i) {
-            PropertyDescriptor const* nestedProp = &valueTypeDesc->properties[i];
-            if (!nestedProp->name) continue;
-            
-            writer.WriteKey(nestedProp->name);
-            void const* nestedPropPtr = static_cast<char const*>(propPtr) + nestedProp->offset;
-            TypeDescriptor const* nestedValueTypeDesc = TypeRegistry::GetTypeById(nestedProp->valueTypeId);
-            
-            if (!SerializeProperty(writer, nestedPropPtr, nestedProp, nestedValueTypeDesc)) {
-                return false;
-            }
-        }
-        
-        writer.EndObject();
-        return true;
-    }
-    
-    // Array (simplified: assume fixed-size array)
-    if (valueTypeDesc && prop->size > valueTypeDesc->size && prop->size % valueTypeDesc->size == 0) {
-        std::size_t elementCount = prop->size / valueTypeDesc->size;
-        writer.StartArray();
-        
-        for (std::size_t i = 0; i < elementCount; ++i) {
-            void const* elementPtr = static_cast<char const*>(propPtr) + (i * valueTypeDesc->size);
-            
-            // Create a temporary PropertyDescriptor for the element
-            PropertyDescriptor elementProp = *prop;
-            elementProp.size = valueTypeDesc->size;
-            elementProp.offset = 0;
-            
-            if (!SerializeProperty(writer, elementPtr, &elementProp, valueTypeDesc)) {
-                return false;
-            }
-        }
-        
-        writer.EndArray();
-        return true;
-    }
-    
-    // Basic types
-    if (prop->size == sizeof(std::int32_t)) {
-        writer.WriteNumber(*static_cast<std::int32_t const*>(propPtr));
-    } else if (prop->size == sizeof(std::uint32_t)) {
-        writer.WriteNumber(*static_cast<std::uint32_t const*>(propPtr));
-    } else if (prop->size == sizeof(std::int64_t)) {
-        writer.WriteNumber(*static_cast<std::int64_t const*>(propPtr));
-    } else if (prop->size == sizeof(std::uint64_t)) {
-        writer.WriteNumber(*static_cast<std::uint64_t const*>(propPtr));
-    } else if (prop->size == sizeof(float)) {
-        writer.WriteNumber(*static_cast<float const*>(propPtr));
-    } else if (prop->size == sizeof(double)) {
-        writer.WriteNumber(*static_cast<double const*>(propPtr));
-    } else if (prop->size == sizeof(bool)) {
-        writer.WriteBoolean(*static_cast<bool const*>(propPtr));
-    } else {
-        // Unknown type - write as string representation or null
-        writer.WriteNull();
-    }
-    
-    return true;
-}
-
 } // namespace
 
 class JSONSerializerImpl : public ISerializer {
 public:
     JSONSerializerImpl() : version_(kCurrentVersion), migration_(nullptr) {}
-    
+
     bool Serialize(SerializedBuffer& out, void const* obj, TypeId typeId) override {
         if (!obj || typeId == kInvalidTypeId) {
             return false;
         }
-        
+
         TypeDescriptor const* desc = TypeRegistry::GetTypeById(typeId);
         if (!desc) {
             return false;
         }
-        
+
         return SerializeInternal(out, obj, desc);
     }
-    
+
     bool Serialize(SerializedBuffer& out, void const* obj, char const* typeName) override {
         if (!obj || !typeName) {
             return false;
         }
-        
+
         TypeDescriptor const* desc = TypeRegistry::GetTypeByName(typeName);
         if (!desc) {
             return false;
         }
-        
+
         return SerializeInternal(out, obj, desc);
     }
-    
+
     bool Deserialize(SerializedBuffer const& buf, void* obj, TypeId typeId) override {
         if (!buf.IsValid() || !obj || typeId == kInvalidTypeId) {
             return false;
         }
-        
+
         TypeDescriptor const* desc = TypeRegistry::GetTypeById(typeId);
         if (!desc) {
             return false;
         }
-        
+
         return DeserializeInternal(buf, obj, desc);
     }
-    
+
     bool Deserialize(SerializedBuffer const& buf, void* obj, char const* typeName) override {
         if (!buf.IsValid() || !obj || !typeName) {
             return false;
         }
-        
+
         TypeDescriptor const* desc = TypeRegistry::GetTypeByName(typeName);
         if (!desc) {
             return false;
         }
-        
+
         return DeserializeInternal(buf, obj, desc);
     }
-    
+
     std::uint32_t GetCurrentVersion() const override {
         return version_;
     }
-    
+
     void SetVersionMigration(IVersionMigration* migration) override {
         migration_ = migration;
     }
-    
+
     SerializationFormat GetFormat() const override {
         return SerializationFormat::JSON;
     }
-    
+
 private:
     bool SerializeInternal(SerializedBuffer& out, void const* obj, TypeDescriptor const* desc) {
-        JSONWriter writer;
-        writer.StartObject();
-        
-        // Write version
-        writer.WriteKey(kVersionKey);
-        writer.WriteNumber(static_cast<std::uint32_t>(version_));
-        
-        // Write type (optional, for debugging)
-        writer.WriteKey(kTypeKey);
-        writer.WriteString(desc->name);
-        
-        // Write properties
-        for (std::size_t i = 0; i < desc->propertyCount; ++i) {
-            PropertyDescriptor const* prop = &desc->properties[i];
-            if (!prop->name) continue;
-            
-            writer.WriteKey(prop->name);
-            void const* propPtr = static_cast<char const*>(obj) + prop->offset;
-            TypeDescriptor const* valueTypeDesc = TypeRegistry::GetTypeById(prop->valueTypeId);
-            
-            if (!SerializeProperty(writer, propPtr, prop, valueTypeDesc)) {
-                return false;
-            }
+        JSONTypeInfo const* info = GetJSONTypeInfo(desc);
+        if (!info) {
+            return false;
         }
-        
-        writer.EndObject();
-        
-        std::string jsonStr = writer.GetString();
-        std::size_t size = jsonStr.size() + 1;  // +1 for null terminator
-        
+
+        JSONWriter writer;
+        WriteObject(writer, obj, *info, version_);
+
+        std::string const& json = writer.GetBuffer();
+        std::size_t size = json.size() + 1;  // +1 for null terminator
+
         if (out.capacity < size) {
             if (out.data) {
                 te::core::Free(out.data);
@@ -976,71 +1125,65 @@ private:
             }
             out.capacity = size;
         }
-        
-        std::memcpy(out.data, jsonStr.c_str(), size);
+
+        std::memcpy(out.data, json.c_str(), size);
         out.size = size - 1;  // Exclude null terminator
-        
+
         return true;
     }
-    
+
     bool DeserializeInternal(SerializedBuffer const& buf, void* obj, TypeDescriptor const* desc) {
-        // Ensure null-terminated string
-        char const* jsonStr = static_cast<char const*>(buf.data);
-        std::size_t len = buf.size;
-        
-        // Check if we need to add null terminator
-        bool needsNullTerm = (len == 0 || jsonStr[len - 1] != '\0');
-        
-        char* jsonCopy = nullptr;
-        if (needsNullTerm) {
-            jsonCopy = static_cast<char*>(te::core::Alloc(len + 1, alignof(char)));
-            if (!jsonCopy) {
-                return false;
-            }
-            std::memcpy(jsonCopy, jsonStr, len);
-            jsonCopy[len] = '\0';
-            jsonStr = jsonCopy;
-        }
-        
-        // Parse JSON
-        JSONParser parser(jsonStr);
-        bool success = parser.ParseObject(obj, desc);
-        
+        JSONTypeInfo const* info = GetJSONTypeInfo(desc);
+        if (!info) {
+            return false;
+        }
+
+        // Parse in place; a trailing null terminator (if counted in size) is not part of the text
+        char const* json = static_cast<char const*>(buf.data);
+        std::size_t length = buf.size;
+        while (length > 0 && json[length - 1] == '\0') {
+            --length;
+        }
+
+        JSONParser parser(json, length);
+        bool success = parser.ParseObject(obj, *info);
+
         if (!success && parser.HasError()) {
             // Error information available via parser.GetError() and parser.GetErrorPath()
             // In production, could log these
         }
-        
+
         // Check version and migrate if needed
-        if (success) {
-            std::uint32_t parsedVersion = parser.GetParsedVersion();
-            if (parsedVersion < version_ && migration_) {
-                // Create mutable buffer for migration
-                SerializedBuffer mutableBuf = buf;
-                if (jsonCopy) {
-                    mutableBuf.data = jsonCopy;
-                    mutableBuf.size = len + 1;
-                    mutableBuf.capacity = len + 1;
-                }
-                
-                if (!migration_->Migrate(mutableBuf, parsedVersion, version_)) {
-                    success = false;
-                } else {
-                    // Re-parse after migration
-                    jsonStr = static_cast<char const*>(mutableBuf.data);
-                    JSONParser migratedParser(jsonStr);
-                    success = migratedParser.ParseObject(obj, desc);
+        if (success && parser.GetParsedVersion() < version_ && migration_) {
+            // Migrate a null-terminated copy so the caller's buffer is left untouched
+            SerializedBuffer migrated{};
+            migrated.data = te::core::Alloc(length + 1, alignof(char));
+            if (!migrated.data) {
+                return false;
+            }
+            std::memcpy(migrated.data, json, length);
+            static_cast<char*>(migrated.data)[length] = '\0';
+            migrated.size = length + 1;
+            migrated.capacity = length + 1;
+
+            if (!migration_->Migrate(migrated, parser.GetParsedVersion(), version_)) {
+                success = false;
+            } else {
+                // Re-parse after migration
+                char const* migratedJson = static_cast<char const*>(migrated.data);
+                std::size_t migratedLength = migrated.size;
+                while (migratedLength > 0 && migratedJson[migratedLength - 1] == '\0') {
+                    --migratedLength;
                 }
+                JSONParser migratedParser(migratedJson, migratedLength);
+                success = migratedParser.ParseObject(obj, *info);
             }
+            te::core::Free(migrated.data);
         }
-        
-        if (jsonCopy) {
-            te::core::Free(jsonCopy);
-        }
-        
+
         return success;
     }
-    
+
     std::uint32_t version_;
     IVersionMigration* migration_;
 };
@@ -1049,5 +1192,20 @@ ISerializer* CreateJSONSerializer() {
     return new JSONSerializerImpl();
 }
 
+bool SerializeJSONToSink(ISerializeSink& sink, void const* obj, TypeId typeId) {
+    if (!obj || typeId == kInvalidTypeId) {
+        return false;
+    }
+    TypeDescriptor const* desc = TypeRegistry::GetTypeById(typeId);
+    JSONTypeInfo const* info = desc ? GetJSONTypeInfo(desc) : nullptr;
+    if (!info) {
+        return false;
+    }
+
+    JSONWriter writer(&sink);
+    WriteObject(writer, obj, *info, kCurrentVersion);
+    return writer.Finish();
+}
+
 } // namespace object
 } // namespace te
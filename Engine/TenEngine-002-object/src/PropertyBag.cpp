@@ -7,10 +7,120 @@
 #include "te/object/PropertyBag.h"
 #include "te/object/TypeRegistry.h"
 #include <cstring>
+#include <memory>
+#include <mutex>
+#include <shared_mutex>
+#include <unordered_map>
+#include <vector>
 
 namespace te {
 namespace object {
 
+// Name -> property index for one registered type (linear probing, at most half full)
+struct PropertyNameTable {
+    TypeDescriptor const* desc = nullptr;
+    std::vector<std::uint32_t> slots;   // Property index + 1, 0 if empty
+    std::vector<TypeId> hashes;         // Name hash per property
+    std::uint32_t mask = 0;
+
+    PropertyDescriptor const* Find(char const* name) const {
+        TypeId const hash = HashTypeName(name);
+        for (std::uint32_t slot = hash & mask;; slot = (slot + 1) & mask) {
+            std::uint32_t const entry = slots[slot];
+            if (entry == 0) {
+                return nullptr;
+            }
+            PropertyDescriptor const& prop = desc->properties[entry - 1];
+            if (hashes[entry - 1] == hash && std::strcmp(prop.name, name) == 0) {
+                return &prop;
+            }
+        }
+    }
+};
+
+namespace {
+
+// Tables of registered types only: their descriptors are immutable and never unregistered
+struct NameTableCache {
+    std::shared_mutex mutex;
+    std::unordered_map<TypeId, std::unique_ptr<PropertyNameTable>> tables;
+};
+
+NameTableCache& GetNameTableCache() {
+    static NameTableCache cache;
+    return cache;
+}
+
+std::unique_ptr<PropertyNameTable> BuildNameTable(TypeDescriptor const* desc) {
+    std::unique_ptr<PropertyNameTable> table(new PropertyNameTable());
+    table->desc = desc;
+    std::uint32_t tableSize = 8;
+    while (tableSize < desc->propertyCount * 2) {
+        tableSize <<= 1;
+    }
+    table->mask = tableSize - 1;
+    table->slots.assign(tableSize, 0);
+    table->hashes.assign(desc->propertyCount, 0);
+    for (std::uint32_t i = 0; i < desc->propertyCount; ++i) {
+        char const* name = desc->properties[i].name;
+        if (!name || table->Find(name)) {
+            continue;  // Unnamed, or a repeated name: the first property wins as in a linear search
+        }
+        TypeId const hash = HashTypeName(name);
+        table->hashes[i] = hash;
+        std::uint32_t slot = hash & table->mask;
+        while (table->slots[slot] != 0) {
+            slot = (slot + 1) & table->mask;
+        }
+        table->slots[slot] = i + 1;
+    }
+    return table;
+}
+
+PropertyNameTable const* FindNameTable(TypeDescriptor const* desc) {
+    if (!desc || !desc->properties || desc->propertyCount == 0 || TypeRegistry::GetTypeById(desc->id) != desc) {
+        return nullptr;  // Caller-owned descriptor: searched linearly
+    }
+    NameTableCache& cache = GetNameTableCache();
+    {
+        std::shared_lock<std::shared_mutex> lock(cache.mutex);
+        auto it = cache.tables.find(desc->id);
+        if (it != cache.tables.end()) {
+            return it->second.get();
+        }
+    }
+    std::unique_ptr<PropertyNameTable> table = BuildNameTable(desc);
+    std::unique_lock<std::shared_mutex> lock(cache.mutex);
+    std::unique_ptr<PropertyNameTable>& slot = cache.tables[desc->id];
+    if (!slot) {
+        slot = std::move(table);
+    }
+    return slot.get();
+}
+
+PropertyDescriptor const* FindPropertyLinear(TypeDescriptor const* desc, char const* name) {
+    for (std::size_t i = 0; i < desc->propertyCount; ++i) {
+        if (desc->properties[i].name && std::strcmp(desc->properties[i].name, name) == 0) {
+            return &desc->properties[i];
+        }
+    }
+    return nullptr;
+}
+
+PropertyHandle MakeHandle(TypeDescriptor const* desc, PropertyDescriptor const* prop) {
+    PropertyHandle handle;
+    if (prop) {
+        handle.type = desc;
+        handle.index = static_cast<std::uint32_t>(prop - desc->properties);
+        handle.valueTypeId = prop->valueTypeId;
+        handle.offset = prop->offset;
+        handle.size = prop->size;
+    }
+    return handle;
+}
+
+} // namespace
+
 PropertyBag::PropertyBag(void* instance, TypeDescriptor const* typeDesc)
     : instance_(instance), typeDesc_(typeDesc) {
 }
@@ -80,13 +190,18 @@ PropertyDescriptor const* PropertyBag::FindProperty(char const* name) const {
         return nullptr;
     }
     
-    for (std::size_t i = 0; i < typeDesc_->propertyCount; ++i) {
-        if (typeDesc_->properties[i].name && std::strcmp(typeDesc_->properties[i].name, name) == 0) {
-            return &typeDesc_->properties[i];
-        }
+    if (PropertyNameTable const* table = GetNameTable()) {
+        return table->Find(name);
     }
-    
-    return nullptr;
+    return FindPropertyLinear(typeDesc_, name);
+}
+
+PropertyNameTable const* PropertyBag::GetNameTable() const {
+    if (!nameTableResolved_) {
+        nameTable_ = FindNameTable(typeDesc_);
+        nameTableResolved_ = true;
+    }
+    return nameTable_;
 }
 
 std::size_t PropertyBag::GetPropertyCount() const {
@@ -101,5 +216,70 @@ PropertyDescriptor const* PropertyBag::GetProperty(std::size_t index) const {
     return &typeDesc_->properties[index];
 }
 
+PropertyHandle PropertyBag::ResolveProperty(TypeDescriptor const* typeDesc, char const* name) {
+    if (!typeDesc || !typeDesc->properties || !name) {
+        return PropertyHandle{};
+    }
+    
+    PropertyNameTable const* table = FindNameTable(typeDesc);
+    return MakeHandle(typeDesc, table ? table->Find(name) : FindPropertyLinear(typeDesc, name));
+}
+
+PropertyHandle PropertyBag::GetHandle(char const* name) const {
+    return MakeHandle(typeDesc_, FindProperty(name));
+}
+
+bool PropertyBag::GetProperty(void* outValue, PropertyHandle const& handle) const {
+    if (!outValue || !instance_ || !handle.IsValid() || handle.type != typeDesc_) {
+        return false;
+    }
+    
+    std::memcpy(outValue, static_cast<char const*>(instance_) + handle.offset, handle.size);
+    return true;
+}
+
+bool PropertyBag::SetProperty(void const* value, PropertyHandle const& handle) {
+    if (!value || !instance_ || !handle.IsValid() || handle.type != typeDesc_) {
+        return false;
+    }
+    
+    std::memcpy(static_cast<char*>(instance_) + handle.offset, value, handle.size);
+    return true;
+}
+
+std::size_t PropertyBag::GetPropertyBatch(PropertyHandle const& handle, void const* const* instances,
+                                          std::size_t count, void* outValues) {
+    if (!handle.IsValid() || !instances || !outValues) {
+        return 0;
+    }
+    
+    std::size_t read = 0;
+    char* out = static_cast<char*>(outValues);
+    for (std::size_t i = 0; i < count; ++i, out += handle.size) {
+        if (instances[i]) {
+            std::memcpy(out, static_cast<char const*>(instances[i]) + handle.offset, handle.size);
+            ++read;
+        }
+    }
+    return read;
+}
+
+std::size_t PropertyBag::SetPropertyBatch(PropertyHandle const& handle, void* const* instances,
+                                          std::size_t count, void const* values, std::size_t valueStride) {
+    if (!handle.IsValid() || !instances || !values) {
+        return 0;
+    }
+    
+    std::size_t written = 0;
+    char const* value = static_cast<char const*>(values);
+    for (std::size_t i = 0; i < count; ++i, value += valueStride) {
+        if (instances[i]) {
+            std::memcpy(static_cast<char*>(instances[i]) + handle.offset, value, handle.size);
+            ++written;
+        }
+    }
+    return written;
+}
+
 } // namespace object
 } // namespace te
@@ -7,7 +7,9 @@
 #include "te/object/Serializer.h"
 #include "te/core/platform.h"
 #include "te/core/alloc.h"
+#include <cstdint>
 #include <cstring>
+#include <string>
 #include <vector>
 #include <cctype>
 
@@ -32,6 +34,22 @@ bool EndsWithIgnoreCase(char const* str, char const* suffix) {
     }
     return true;
 }
+
+// Streams serializer chunks to a file: the first chunk truncates, later ones append
+class FileSink : public ISerializeSink {
+public:
+    explicit FileSink(char const* path) : path_(path) {}
+
+    bool Write(void const* data, std::size_t size) override {
+        std::size_t offset = started_ ? SIZE_MAX : 0;
+        started_ = true;
+        return te::core::FileWriteBinary(path_, data, size, offset);
+    }
+
+private:
+    std::string path_;
+    bool started_ = false;
+};
 }  // namespace
 
 SerializationFormat GetFormatFromPath(char const* path) {
@@ -47,6 +65,12 @@ bool SerializeToFile(char const* path, void const* obj, TypeId typeId, Serializa
     if (!path || !obj || typeId == kInvalidTypeId) {
         return false;
     }
+
+    // JSON is streamed to the file without building the whole document in memory
+    if (format == SerializationFormat::JSON) {
+        FileSink sink(path);
+        return SerializeJSONToSink(sink, obj, typeId);
+    }
     
     // Create serializer
     ISerializer* serializer = nullptr;
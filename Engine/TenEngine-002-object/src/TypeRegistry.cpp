@@ -2,10 +2,15 @@
  * @file TypeRegistry.cpp
  * @brief Implementation of TypeRegistry (contract: specs/_contracts/002-object-public-api.md).
  * Thread-safe type registration and query system.
+ * Before Freeze, lookups take a shared lock; afterwards they probe an immutable open-addressed
+ * table published through an atomic pointer.
  */
 
 #include "te/object/TypeRegistry.h"
 #include "te/core/alloc.h"
+#include <atomic>
+#include <cstring>
+#include <memory>
 #include <unordered_map>
 #include <string>
 #include <shared_mutex>
@@ -16,12 +21,55 @@ namespace object {
 
 namespace {
 
+constexpr std::uint32_t kEmptySlot = 0xFFFFFFFFu;
+
+// Immutable lookup table built by Freeze: descriptors stored densely, two linear-probing
+// indices into them (by id and by name hash). Never modified after it is published
+struct FrozenTable {
+    std::vector<TypeDescriptor const*> descriptors;
+    std::vector<TypeId> nameHashes;        // HashTypeName of each descriptor's name
+    std::vector<std::uint32_t> idSlots;    // Descriptor index or kEmptySlot
+    std::vector<std::uint32_t> nameSlots;  // Descriptor index or kEmptySlot
+    std::uint32_t mask = 0;
+
+    static std::uint32_t IdSlot(TypeId id) {
+        return id * 0x9E3779B1u;  // Spread sequential ids across the table
+    }
+
+    TypeDescriptor const* FindById(TypeId id) const {
+        for (std::uint32_t slot = IdSlot(id) & mask;; slot = (slot + 1) & mask) {
+            std::uint32_t const index = idSlots[slot];
+            if (index == kEmptySlot) {
+                return nullptr;
+            }
+            if (descriptors[index]->id == id) {
+                return descriptors[index];
+            }
+        }
+    }
+
+    TypeDescriptor const* FindByName(char const* name) const {
+        TypeId const hash = HashTypeName(name);
+        for (std::uint32_t slot = hash & mask;; slot = (slot + 1) & mask) {
+            std::uint32_t const index = nameSlots[slot];
+            if (index == kEmptySlot) {
+                return nullptr;
+            }
+            if (nameHashes[index] == hash && std::strcmp(descriptors[index]->name, name) == 0) {
+                return descriptors[index];
+            }
+        }
+    }
+};
+
 // Type registry storage
 struct RegistryStorage {
     std::shared_mutex mutex;  // Read-write lock for thread safety
-    std::unordered_map<TypeId, TypeDescriptor> typesById;
+    std::unordered_map<TypeId, TypeDescriptor> typesById;  // Node-based: descriptor addresses are stable
     std::unordered_map<std::string, TypeId> typesByName;
-    std::vector<TypeDescriptor> descriptors;  // Owned storage for descriptors
+    std::vector<TypeDescriptor const*> descriptors;  // Registration order
+    std::unique_ptr<FrozenTable> frozenStorage;
+    std::atomic<FrozenTable const*> frozen{nullptr};
 };
 
 RegistryStorage& GetRegistry() {
@@ -39,6 +87,10 @@ bool TypeRegistry::RegisterType(TypeDescriptor const& desc) {
     auto& registry = GetRegistry();
     std::unique_lock<std::shared_mutex> lock(registry.mutex);
     
+    if (registry.frozen.load(std::memory_order_relaxed)) {
+        return false;  // Registration phase is over
+    }
+    
     // Check if already registered
     if (registry.typesById.find(desc.id) != registry.typesById.end()) {
         return false;  // Already registered
@@ -48,31 +100,25 @@ bool TypeRegistry::RegisterType(TypeDescriptor const& desc) {
         return false;  // Name already taken
     }
     
-    // Allocate and copy descriptor (using Core Alloc)
-    TypeDescriptor* descCopy = static_cast<TypeDescriptor*>(te::core::Alloc(sizeof(TypeDescriptor), alignof(TypeDescriptor)));
-    if (!descCopy) {
-        return false;
-    }
-    *descCopy = desc;
-    
-    // Allocate and copy properties if present
+    // Copy descriptor; properties are copied with Core Alloc
+    TypeDescriptor descCopy = desc;
     if (desc.properties && desc.propertyCount > 0) {
         PropertyDescriptor* propsCopy = static_cast<PropertyDescriptor*>(
             te::core::Alloc(sizeof(PropertyDescriptor) * desc.propertyCount, alignof(PropertyDescriptor)));
         if (!propsCopy) {
-            te::core::Free(descCopy);
             return false;
         }
         for (std::size_t i = 0; i < desc.propertyCount; ++i) {
             propsCopy[i] = desc.properties[i];
         }
-        const_cast<TypeDescriptor*>(descCopy)->properties = propsCopy;
+        descCopy.properties = propsCopy;
     }
     
     // Register
-    registry.typesById[desc.id] = *descCopy;
+    TypeDescriptor& stored = registry.typesById[desc.id];
+    stored = descCopy;
     registry.typesByName[desc.name] = desc.id;
-    registry.descriptors.push_back(*descCopy);
+    registry.descriptors.push_back(&stored);
     
     return true;
 }
@@ -83,6 +129,9 @@ TypeDescriptor const* TypeRegistry::GetTypeByName(char const* name) {
     }
     
     auto& registry = GetRegistry();
+    if (FrozenTable const* frozen = registry.frozen.load(std::memory_order_acquire)) {
+        return frozen->FindByName(name);
+    }
     std::shared_lock<std::shared_mutex> lock(registry.mutex);
     
     auto it = registry.typesByName.find(name);
@@ -104,6 +153,9 @@ TypeDescriptor const* TypeRegistry::GetTypeById(TypeId id) {
     }
     
     auto& registry = GetRegistry();
+    if (FrozenTable const* frozen = registry.frozen.load(std::memory_order_acquire)) {
+        return frozen->FindById(id);
+    }
     std::shared_lock<std::shared_mutex> lock(registry.mutex);
     
     auto it = registry.typesById.find(id);
@@ -146,6 +198,12 @@ void TypeRegistry::EnumerateTypes(void (*callback)(TypeDescriptor const*, void*)
     }
     
     auto& registry = GetRegistry();
+    if (FrozenTable const* frozen = registry.frozen.load(std::memory_order_acquire)) {
+        for (TypeDescriptor const* desc : frozen->descriptors) {
+            callback(desc, userData);
+        }
+        return;
+    }
     std::shared_lock<std::shared_mutex> lock(registry.mutex);
     
     for (auto const& pair : registry.typesById) {
@@ -153,5 +211,50 @@ void TypeRegistry::EnumerateTypes(void (*callback)(TypeDescriptor const*, void*)
     }
 }
 
+void TypeRegistry::Freeze() {
+    auto& registry = GetRegistry();
+    std::unique_lock<std::shared_mutex> lock(registry.mutex);
+    if (registry.frozen.load(std::memory_order_relaxed)) {
+        return;
+    }
+    
+    std::unique_ptr<FrozenTable> table(new FrozenTable());
+    table->descriptors = registry.descriptors;
+    
+    // At most half full so probe sequences stay short
+    std::uint32_t tableSize = 16;
+    while (tableSize < table->descriptors.size() * 2) {
+        tableSize <<= 1;
+    }
+    table->mask = tableSize - 1;
+    table->idSlots.assign(tableSize, kEmptySlot);
+    table->nameSlots.assign(tableSize, kEmptySlot);
+    table->nameHashes.reserve(table->descriptors.size());
+    
+    for (std::uint32_t i = 0; i < static_cast<std::uint32_t>(table->descriptors.size()); ++i) {
+        TypeDescriptor const* desc = table->descriptors[i];
+        std::uint32_t slot = FrozenTable::IdSlot(desc->id) & table->mask;
+        while (table->idSlots[slot] != kEmptySlot) {
+            slot = (slot + 1) & table->mask;
+        }
+        table->idSlots[slot] = i;
+        
+        TypeId const hash = HashTypeName(desc->name);
+        table->nameHashes.push_back(hash);
+        slot = hash & table->mask;
+        while (table->nameSlots[slot] != kEmptySlot) {
+            slot = (slot + 1) & table->mask;
+        }
+        table->nameSlots[slot] = i;
+    }
+    
+    registry.frozenStorage = std::move(table);
+    registry.frozen.store(registry.frozenStorage.get(), std::memory_order_release);
+}
+
+bool TypeRegistry::IsFrozen() {
+    return GetRegistry().frozen.load(std::memory_order_acquire) != nullptr;
+}
+
 } // namespace object
 } // namespace te
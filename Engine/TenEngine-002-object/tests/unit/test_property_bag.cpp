@@ -87,6 +87,53 @@ int main() {
     assert(prop != nullptr);
     assert(std::strcmp(prop->name, "value") == 0 || std::strcmp(prop->name, "fvalue") == 0);
     
+    // Handles: resolved once, then typed and raw access without name lookups
+    PropertyHandle valueHandle = PropertyBag::ResolveProperty(typeDesc, "value");
+    PropertyHandle fvalueHandle = bag.GetHandle("fvalue");
+    assert(valueHandle.IsValid() && fvalueHandle.IsValid());
+    assert(valueHandle.index == 0 && fvalueHandle.index == 1);
+    assert(fvalueHandle.offset == offsetof(TestStruct, fvalue) && fvalueHandle.size == sizeof(float));
+    assert(!PropertyBag::ResolveProperty(typeDesc, "missing").IsValid());
+    
+    assert(bag.Set(valueHandle, 7));
+    int typed = 0;
+    assert(bag.Get(valueHandle, typed) && typed == 7);
+    double wrongSize = 0.0;
+    assert(!bag.Get(fvalueHandle, wrongSize));  // Size mismatch
+    fvalue = 2.5f;
+    assert(bag.SetProperty(&fvalue, fvalueHandle));
+    float raw = 0.0f;
+    assert(bag.GetProperty(&raw, fvalueHandle) && raw == 2.5f);
+    
+    // A handle only applies to bags of the descriptor it was resolved from
+    PropertyBag localBag(instance, &desc);
+    assert(!localBag.Get(valueHandle, typed));
+    PropertyHandle localHandle = localBag.GetHandle("value");
+    assert(localHandle.IsValid() && localBag.Get(localHandle, typed) && typed == 7);
+    
+    // Batch access across many instances of one type
+    TestStruct objects[64] = {};
+    void* targets[65];
+    for (int i = 0; i < 64; ++i) {
+        targets[i] = &objects[i];
+    }
+    targets[64] = nullptr;
+    int const same = 11;
+    assert(PropertyBag::SetPropertyBatch(valueHandle, targets, 65, &same) == 64);
+    for (TestStruct const& object : objects) {
+        assert(object.value == 11);
+    }
+    float perInstance[64];
+    for (int i = 0; i < 64; ++i) {
+        perInstance[i] = static_cast<float>(i) * 0.5f;
+    }
+    assert(PropertyBag::SetPropertyBatch(fvalueHandle, targets, 64, perInstance, sizeof(float)) == 64);
+    float readBack[65] = {};
+    assert(PropertyBag::GetPropertyBatch(fvalueHandle, targets, 65, readBack) == 64);
+    for (int i = 0; i < 64; ++i) {
+        assert(objects[i].fvalue == perInstance[i] && readBack[i] == perInstance[i]);
+    }
+    
     te::core::Free(instance);
     
     return 0;
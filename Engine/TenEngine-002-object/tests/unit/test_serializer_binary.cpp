@@ -8,7 +8,9 @@
 #include "te/object/TypeId.h"
 #include "te/core/alloc.h"
 #include <cassert>
+#include <cstdint>
 #include <cstring>
+#include <initializer_list>
 
 namespace {
 
@@ -17,6 +19,20 @@ struct TestStruct {
     float fvalue;
 };
 
+struct Vec3 {
+    float x;
+    float y;
+    float z;
+};
+
+// Padding after `id` and after `position`; `position` is a nested type
+struct Snapshot {
+    std::uint8_t id;
+    std::uint32_t flags;
+    Vec3 position;
+    double weight;
+};
+
 void* CreateTestStruct() {
     void* ptr = te::core::Alloc(sizeof(TestStruct), alignof(TestStruct));
     TestStruct* s = static_cast<TestStruct*>(ptr);
@@ -67,10 +83,88 @@ int main() {
     assert(deserialized.value == original.value);
     assert(deserialized.fvalue == original.fvalue);
     
+    // Schema layout: nested Vec3 inlined, adjacent properties merged into spans
+    PropertyDescriptor vecProps[] = {
+        {"x", 0, offsetof(Vec3, x), sizeof(float), nullptr},
+        {"y", 0, offsetof(Vec3, y), sizeof(float), nullptr},
+        {"z", 0, offsetof(Vec3, z), sizeof(float), nullptr}
+    };
+    TypeDescriptor vecDesc;
+    vecDesc.id = 2;
+    vecDesc.name = "Vec3";
+    vecDesc.size = sizeof(Vec3);
+    vecDesc.properties = vecProps;
+    vecDesc.propertyCount = 3;
+    assert(TypeRegistry::RegisterType(vecDesc));
+    
+    PropertyDescriptor snapProps[] = {
+        {"id", 0, offsetof(Snapshot, id), sizeof(std::uint8_t), nullptr},
+        {"flags", 0, offsetof(Snapshot, flags), sizeof(std::uint32_t), nullptr},
+        {"position", 2, offsetof(Snapshot, position), sizeof(Vec3), nullptr},
+        {"weight", 0, offsetof(Snapshot, weight), sizeof(double), nullptr}
+    };
+    TypeDescriptor snapDesc;
+    snapDesc.id = 3;
+    snapDesc.name = "Snapshot";
+    snapDesc.size = sizeof(Snapshot);
+    snapDesc.properties = snapProps;
+    snapDesc.propertyCount = 4;
+    assert(TypeRegistry::RegisterType(snapDesc));
+    
+    std::uint64_t const snapHash = GetBinarySchemaHash(3);
+    assert(snapHash != 0);
+    assert(snapHash == GetBinarySchemaHash(3));
+    assert(snapHash != GetBinarySchemaHash(1));
+    assert(GetBinarySchemaHash(999) == 0);
+    
+    Snapshot snap;
+    std::memset(&snap, 0xCD, sizeof(snap));  // Padding must not matter
+    snap.id = 7;
+    snap.flags = 0xA5A5u;
+    snap.position = {1.0f, -2.0f, 3.5f};
+    snap.weight = 0.25;
+    
+    ISerializer* schema = CreateBinarySerializer(BinaryLayout::Schema);
+    assert(schema != nullptr);
+    SerializedBuffer schemaBuf{};
+    assert(schema->Serialize(schemaBuf, &snap, 3));
+    SerializedBuffer taggedBuf{};
+    assert(serializer->Serialize(taggedBuf, &snap, 3));
+    assert(schemaBuf.size < taggedBuf.size);
+    
+    // Both readers accept both layouts
+    Snapshot fromSchema{};
+    assert(schema->Deserialize(schemaBuf, &fromSchema, 3));
+    Snapshot viaTaggedReader{};
+    assert(serializer->Deserialize(schemaBuf, &viaTaggedReader, "Snapshot"));
+    Snapshot fromTagged{};
+    assert(schema->Deserialize(taggedBuf, &fromTagged, 3));
+    for (Snapshot const* s : {&fromSchema, &viaTaggedReader, &fromTagged}) {
+        assert(s->id == 7 && s->flags == 0xA5A5u);
+        assert(s->position.x == 1.0f && s->position.y == -2.0f && s->position.z == 3.5f);
+        assert(s->weight == 0.25);
+    }
+    
+    // Serializing again into a large enough buffer reuses it
+    void* const schemaData = schemaBuf.data;
+    snap.id = 8;
+    assert(schema->Serialize(schemaBuf, &snap, 3));
+    assert(schemaBuf.data == schemaData);
+    assert(schema->Deserialize(schemaBuf, &fromSchema, 3) && fromSchema.id == 8);
+    
+    // Schema buffers are rejected for another type or a different schema hash
+    assert(!schema->Deserialize(schemaBuf, &fromSchema, 1));
+    std::uint64_t const otherHash = snapHash ^ 1u;
+    std::memcpy(static_cast<char*>(schemaBuf.data) + 16, &otherHash, sizeof(otherHash));
+    assert(!schema->Deserialize(schemaBuf, &fromSchema, 3));
+    
     // Cleanup
     if (buf.data) {
         te::core::Free(buf.data);
     }
+    te::core::Free(schemaBuf.data);
+    te::core::Free(taggedBuf.data);
+    delete schema;
     delete serializer;
     
     return 0;
@@ -8,7 +8,9 @@
 #include "te/object/TypeId.h"
 #include "te/core/alloc.h"
 #include <cassert>
+#include <cstdint>
 #include <cstring>
+#include <string>
 
 namespace {
 
@@ -25,6 +27,43 @@ void* CreateTestStruct() {
     return ptr;
 }
 
+struct Vec3 {
+    float x;
+    float y;
+    float z;
+};
+
+struct Node {
+    std::int32_t ids[3];
+    Vec3 position;
+    bool visible;
+    std::int64_t stamp;
+};
+
+struct Wide {
+    std::int32_t f[24];
+};
+
+class StringSink : public te::object::ISerializeSink {
+public:
+    bool Write(void const* data, std::size_t size) override {
+        text.append(static_cast<char const*>(data), size);
+        ++writes;
+        return true;
+    }
+
+    std::string text;
+    int writes = 0;
+};
+
+te::object::SerializedBuffer MakeBuffer(char const* json) {
+    te::object::SerializedBuffer buf{};
+    buf.data = const_cast<char*>(json);
+    buf.size = std::strlen(json);
+    buf.capacity = buf.size;
+    return buf;
+}
+
 } // namespace
 
 int main() {
@@ -67,6 +106,104 @@ int main() {
     assert(deserialized.value == original.value);
     assert(deserialized.fvalue == original.fvalue);
     
+    // Nested object and int array; commas between array elements
+    TypeDescriptor intDesc;
+    intDesc.id = 10;
+    intDesc.name = "int32";
+    intDesc.size = sizeof(std::int32_t);
+    assert(TypeRegistry::RegisterType(intDesc));
+
+    PropertyDescriptor vecProps[] = {
+        {"x", 0, offsetof(Vec3, x), sizeof(float), nullptr},
+        {"y", 0, offsetof(Vec3, y), sizeof(float), nullptr},
+        {"z", 0, offsetof(Vec3, z), sizeof(float), nullptr}
+    };
+    TypeDescriptor vecDesc;
+    vecDesc.id = 11;
+    vecDesc.name = "Vec3";
+    vecDesc.size = sizeof(Vec3);
+    vecDesc.properties = vecProps;
+    vecDesc.propertyCount = 3;
+    assert(TypeRegistry::RegisterType(vecDesc));
+
+    PropertyDescriptor nodeProps[] = {
+        {"ids", 10, offsetof(Node, ids), sizeof(Node::ids), nullptr},
+        {"position", 11, offsetof(Node, position), sizeof(Vec3), nullptr},
+        {"visible", 0, offsetof(Node, visible), sizeof(bool), nullptr},
+        {"stamp", 0, offsetof(Node, stamp), sizeof(std::int64_t), nullptr}
+    };
+    TypeDescriptor nodeDesc;
+    nodeDesc.id = 12;
+    nodeDesc.name = "Node";
+    nodeDesc.size = sizeof(Node);
+    nodeDesc.properties = nodeProps;
+    nodeDesc.propertyCount = 4;
+    assert(TypeRegistry::RegisterType(nodeDesc));
+
+    Node node{};
+    node.ids[0] = 1;
+    node.ids[1] = -2;
+    node.ids[2] = 2147483647;
+    node.position = {1.5f, -2.25f, 8.0f};
+    node.visible = true;
+    node.stamp = -9000000000LL;
+    assert(serializer->Serialize(buf, &node, 12));
+    std::string const nodeJson(static_cast<char const*>(buf.data), buf.size);
+    assert(nodeJson.find("\"ids\":[1,-2,2147483647]") != std::string::npos);
+
+    Node nodeOut{};
+    assert(serializer->Deserialize(buf, &nodeOut, 12));
+    assert(nodeOut.ids[0] == 1 && nodeOut.ids[1] == -2 && nodeOut.ids[2] == 2147483647);
+    assert(nodeOut.position.x == 1.5f && nodeOut.position.y == -2.25f && nodeOut.position.z == 8.0f);
+    assert(nodeOut.visible && nodeOut.stamp == -9000000000LL);
+
+    // Sink output matches the buffered output
+    StringSink sink;
+    assert(SerializeJSONToSink(sink, &node, 12));
+    assert(sink.text == nodeJson);
+
+    // Whitespace, escaped keys, and unknown values holding quotes and brackets are tolerated
+    char const* loose =
+        "{\n  \"$version\" : 1 ,\n  \"note\": \"a \\\"}]\\\" b\",\n"
+        "  \"extra\": {\"s\": \"}\", \"a\": [1, {\"b\": \"]\"}]},\n"
+        "  \"v\\u0061lue\": -7,\t\"fvalue\": null\n}\n";
+    TestStruct looseOut{5, 2.0f};
+    assert(serializer->Deserialize(MakeBuffer(loose), &looseOut, 1));
+    assert(looseOut.value == -7 && looseOut.fvalue == 2.0f);
+
+    // Malformed input fails
+    TestStruct bad{};
+    assert(!serializer->Deserialize(MakeBuffer("{\"value\": 1 \"fvalue\": 2}"), &bad, 1));
+    assert(!serializer->Deserialize(MakeBuffer("{\"value\": 99999999999}"), &bad, 1));
+    assert(!serializer->Deserialize(MakeBuffer("{\"value\": 1"), &bad, 1));
+
+    // Many properties go through the per-type key table
+    static char const* const kWideNames[24] = {
+        "a0", "a1", "a2", "a3", "a4", "a5", "a6", "a7", "b0", "b1", "b2", "b3",
+        "b4", "b5", "b6", "b7", "c0", "c1", "c2", "c3", "c4", "c5", "c6", "c7"};
+    PropertyDescriptor wideProps[24];
+    for (std::size_t i = 0; i < 24; ++i) {
+        wideProps[i] = {kWideNames[i], 0, offsetof(Wide, f) + i * sizeof(std::int32_t), sizeof(std::int32_t), nullptr};
+    }
+    TypeDescriptor wideDesc;
+    wideDesc.id = 13;
+    wideDesc.name = "Wide";
+    wideDesc.size = sizeof(Wide);
+    wideDesc.properties = wideProps;
+    wideDesc.propertyCount = 24;
+    assert(TypeRegistry::RegisterType(wideDesc));
+
+    Wide wide{};
+    for (std::int32_t i = 0; i < 24; ++i) {
+        wide.f[i] = i * 100 - 1000;
+    }
+    assert(serializer->Serialize(buf, &wide, 13));
+    Wide wideOut{};
+    assert(serializer->Deserialize(buf, &wideOut, "Wide"));
+    for (std::size_t i = 0; i < 24; ++i) {
+        assert(wideOut.f[i] == wide.f[i]);
+    }
+
     // Cleanup
     if (buf.data) {
         te::core::Free(buf.data);
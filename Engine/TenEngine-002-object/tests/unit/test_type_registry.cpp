@@ -8,6 +8,7 @@
 #include "te/core/alloc.h"
 #include <cassert>
 #include <cstring>
+#include <typeinfo>
 
 namespace {
 
@@ -20,8 +21,22 @@ void* CreateTestStruct() {
     return te::core::Alloc(sizeof(TestStruct), alignof(TestStruct));
 }
 
+struct NamedStruct {
+    int value;
+};
+
+struct UnnamedStruct {
+    int value;
+};
+
+void CountType(te::object::TypeDescriptor const*, void* userData) {
+    ++*static_cast<int*>(userData);
+}
+
 } // namespace
 
+TE_OBJECT_TYPE_NAME(NamedStruct, "NamedStruct")
+
 int main() {
     using namespace te::object;
     
@@ -68,5 +83,51 @@ int main() {
     assert(instance != nullptr);
     te::core::Free(instance);
     
+    // Compile-time ids and cached TypeOf lookups
+    static_assert(HashTypeName("NamedStruct") == TypeIdOf<NamedStruct>(), "TypeIdOf hashes the registered name");
+    static_assert(HashTypeName("") != kInvalidTypeId, "hashed ids are never invalid");
+    assert(TypeOf<NamedStruct>() == nullptr);  // Not registered yet; not cached
+    
+    TypeDescriptor named;
+    named.id = TypeIdOf<NamedStruct>();
+    named.name = "NamedStruct";
+    named.size = sizeof(NamedStruct);
+    assert(TypeRegistry::RegisterType(named));
+    
+    TypeDescriptor unnamed;
+    unnamed.id = 2;
+    unnamed.name = typeid(UnnamedStruct).name();
+    unnamed.size = sizeof(UnnamedStruct);
+    assert(TypeRegistry::RegisterType(unnamed));
+    
+    TypeDescriptor const* namedDesc = TypeOf<NamedStruct>();
+    assert(namedDesc != nullptr && namedDesc == TypeRegistry::GetTypeById(TypeIdOf<NamedStruct>()));
+    assert(TypeOf<UnnamedStruct>() == TypeRegistry::GetTypeById(2));
+    
+    // Freeze: same descriptors, lock-free lookups, no further registration
+    TypeDescriptor const* byName = TypeRegistry::GetTypeByName("TestStruct");
+    assert(!TypeRegistry::IsFrozen());
+    TypeRegistry::Freeze();
+    TypeRegistry::Freeze();
+    assert(TypeRegistry::IsFrozen());
+    assert(TypeRegistry::GetTypeByName("TestStruct") == byName);
+    assert(TypeRegistry::GetTypeById(1) == byName);
+    assert(TypeRegistry::GetTypeByName("NamedStruct") == namedDesc);
+    assert(TypeRegistry::GetTypeById(TypeIdOf<NamedStruct>()) == namedDesc);
+    assert(TypeOf<NamedStruct>() == namedDesc);
+    assert(TypeRegistry::GetTypeByName("NonExistent") == nullptr);
+    assert(TypeRegistry::GetTypeById(999) == nullptr);
+    assert(TypeRegistry::GetTypeById(kInvalidTypeId) == nullptr);
+    
+    int typeCount = 0;
+    TypeRegistry::EnumerateTypes(CountType, &typeCount);
+    assert(typeCount == 3);
+    
+    TypeDescriptor late;
+    late.id = 3;
+    late.name = "LateStruct";
+    assert(!TypeRegistry::RegisterType(late));
+    assert(!TypeRegistry::IsTypeRegistered("LateStruct"));
+    
     return 0;
 }
@@ -9,6 +9,7 @@
 #include "Window.h"
 #include "Event.h"
 #include "MainLoop.h"
+#include "FramePacer.h"
 #include <cstdint>
 
 namespace te {
@@ -259,9 +260,37 @@ class IApplication {
   /**
    * @brief Set time step mode per contract.
    * @param mode TimeStepMode (Fixed/Variable/Mixed), Variable is default
+   *
+   * Variable: every tick callback runs once per frame with the frame delta.
+   * Fixed: every tick callback runs zero or more times per frame with the fixed step;
+   *        without a target FPS, frames are paced to the fixed step.
+   * Mixed: fixed tick callbacks run per fixed step, tick callbacks once per frame.
    */
   virtual void SetTimeStepMode(TimeStepMode mode) = 0;
 
+  /**
+   * @brief Set fixed time step for Fixed/Mixed modes.
+   * @param stepSeconds Step length in seconds (default 1/60)
+   * @param maxStepsPerFrame Catch-up limit; steps beyond it are dropped (default 8)
+   */
+  virtual void SetFixedTimeStep(float stepSeconds, uint32_t maxStepsPerFrame = 8) = 0;
+
+  /**
+   * @brief Get fixed time step in seconds.
+   */
+  virtual float GetFixedTimeStep() const = 0;
+
+  /**
+   * @brief Get interpolation alpha in [0, 1): fraction of a fixed step accumulated but not
+   * yet simulated, for blending the previous and current simulation states when rendering.
+   */
+  virtual float GetInterpolationAlpha() const = 0;
+
+  /**
+   * @brief Get frame-time statistics (frame durations, pacing jitter, fixed steps).
+   */
+  virtual FrameTimeStats GetFrameTimeStats() const = 0;
+
   /**
    * @brief Register tick callback with priority per contract.
    * @param callback Tick callback function
@@ -270,6 +299,14 @@ class IApplication {
    */
   virtual TickCallbackId RegisterTickCallback(TickCallback callback, int32_t priority = 0) = 0;
 
+  /**
+   * @brief Register a callback that runs once per fixed step (see SetTimeStepMode).
+   * @param callback Tick callback function, receives the fixed step
+   * @param priority Priority (higher priority executes first, default: 0)
+   * @return TickCallbackId for unregistering via UnregisterTickCallback
+   */
+  virtual TickCallbackId RegisterFixedTickCallback(TickCallback callback, int32_t priority = 0) = 0;
+
   /**
    * @brief Unregister tick callback per contract.
    * @param callbackId Tick callback ID returned from RegisterTickCallback
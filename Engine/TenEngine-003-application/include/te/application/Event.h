@@ -5,6 +5,7 @@
 #ifndef TE_APPLICATION_EVENT_H
 #define TE_APPLICATION_EVENT_H
 
+#include <atomic>
 #include <cstddef>
 #include <cstdint>
 #include "Window.h"
@@ -70,44 +71,84 @@ struct Event {
 /**
  * @brief Thread-safe event queue for Input module to consume directly per contract.
  * 
- * This queue is thread-safe and can be accessed from multiple threads.
- * Events are pushed by the application's event pump and consumed by the Input module.
+ * Bounded lock-free multi-producer / single-consumer ring: any thread may Push
+ * (event pump, input devices, network injection); Pop, Drain and Clear must be
+ * called from one consumer thread at a time. A full queue drops the pushed event.
  */
 class EventQueue {
  public:
+  static constexpr std::size_t kDefaultCapacity = 4096;
+
+  /**
+   * @brief Construct queue.
+   * @param capacity Maximum queued events, rounded up to a power of two
+   */
+  explicit EventQueue(std::size_t capacity = kDefaultCapacity);
+  ~EventQueue();
+
+  EventQueue(EventQueue const&) = delete;
+  EventQueue& operator=(EventQueue const&) = delete;
+
   /**
-   * @brief Pop event from queue (non-blocking).
+   * @brief Pop event from queue (non-blocking, consumer only).
    * @param event Output event
    * @return true if event popped, false if queue empty
    */
   bool Pop(Event& event);
 
   /**
-   * @brief Push event to queue (thread-safe).
+   * @brief Pop up to maxCount events in FIFO order (non-blocking, consumer only).
+   * @param out Output array of at least maxCount events
+   * @param maxCount Maximum number of events to pop
+   * @return Number of events written to out
+   */
+  std::size_t Drain(Event* out, std::size_t maxCount);
+
+  /**
+   * @brief Push event to queue (thread-safe, lock-free).
    * @param event Event to push
+   * @return true if queued, false if the queue was full and the event was dropped
    */
-  void Push(Event const& event);
+  bool Push(Event const& event);
 
   /**
-   * @brief Check if queue is empty.
+   * @brief Check if queue is empty (approximate while producers are active).
    * @return true if empty, false otherwise
    */
   bool Empty() const;
 
   /**
-   * @brief Get queue size.
+   * @brief Get queue size (approximate while producers are active).
    * @return Number of events in queue
    */
   std::size_t Size() const;
 
   /**
-   * @brief Clear all events from queue.
+   * @brief Get queue capacity.
+   */
+  std::size_t Capacity() const { return m_mask + 1; }
+
+  /**
+   * @brief Get number of events dropped because the queue was full.
+   */
+  std::uint64_t GetDroppedCount() const;
+
+  /**
+   * @brief Clear all events from queue (consumer only).
    */
   void Clear();
 
  private:
-  mutable te::core::Mutex m_mutex;  // Mutex for thread safety
-  te::core::Array<Event> m_queue;    // Event queue storage
+  struct Slot {
+    std::atomic<std::size_t> sequence;  // Ring position this slot is ready for
+    Event event;
+  };
+
+  Slot* m_slots = nullptr;
+  std::size_t m_mask = 0;
+  alignas(64) std::atomic<std::size_t> m_enqueuePos{0};  // Shared by producers
+  alignas(64) std::atomic<std::size_t> m_dequeuePos{0};  // Written by the consumer only
+  std::atomic<std::uint64_t> m_dropped{0};
 };
 
 }  // namespace application
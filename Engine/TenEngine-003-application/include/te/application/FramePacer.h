@@ -0,0 +1,164 @@
+/**
+ * @file FramePacer.h
+ * @brief Frame pacing and frame-time statistics (contract: specs/_contracts/003-application-ABI.md).
+ */
+#ifndef TE_APPLICATION_FRAME_PACER_H
+#define TE_APPLICATION_FRAME_PACER_H
+
+#include <cstddef>
+#include <cstdint>
+
+namespace te {
+namespace application {
+
+/**
+ * @brief Frame-time statistics over the most recent frames (seconds).
+ */
+struct FrameTimeStats {
+  double lastFrameTime = 0.0;     // Duration of the last frame
+  double averageFrameTime = 0.0;  // Mean frame duration over the window
+  double minFrameTime = 0.0;      // Shortest frame in the window
+  double maxFrameTime = 0.0;      // Longest frame in the window
+  double jitter = 0.0;            // Mean |frame start - deadline| over the window (paced only)
+  double maxLateness = 0.0;       // Worst frame start past its deadline in the window (paced only)
+  uint32_t sampleCount = 0;       // Frames in the window
+  uint64_t missedDeadlines = 0;   // Frames that started a full period late (deadline resynced)
+  uint64_t fixedSteps = 0;        // Fixed steps executed (Fixed/Mixed time step)
+  uint64_t droppedSteps = 0;      // Fixed steps discarded by the catch-up limit
+};
+
+/**
+ * @brief Time source of a FramePacer (seconds); replaced by tests to run the pacer
+ * deterministically.
+ */
+class IFrameClock {
+ public:
+  virtual ~IFrameClock() = default;
+
+  /**
+   * @brief Current time; the default clock returns te::core::HighResolutionTimer().
+   */
+  virtual double Now() = 0;
+
+  /**
+   * @brief Block for about the given duration; 0 yields the thread.
+   */
+  virtual void Sleep(double seconds) = 0;
+};
+
+/**
+ * @brief Paces frames to a target period with a hybrid sleep-then-spin wait.
+ *
+ * WaitForNextFrame sleeps until shortly before the deadline and spins the rest, so
+ * frames start on time despite scheduler-quantum sleep overshoot; the spin margin
+ * adapts to the overshoot observed on this machine. Deadlines advance by exactly one
+ * period so the long-run rate is exact; a frame more than one period late resyncs.
+ * Not thread-safe; owned by the thread running the loop.
+ */
+class FramePacer {
+ public:
+  static constexpr std::size_t kStatsWindow = 128;
+
+  /**
+   * @brief Construct pacer.
+   * @param clock Time source (not owned); nullptr uses the system clock
+   */
+  explicit FramePacer(IFrameClock* clock = nullptr);
+
+  /**
+   * @brief Set target frame period in seconds (0 disables pacing).
+   */
+  void SetTargetPeriod(double seconds);
+  double GetTargetPeriod() const { return m_period; }
+
+  /**
+   * @brief Restart pacing and statistics at the given time (IFrameClock::Now).
+   */
+  void Reset(double now);
+
+  /**
+   * @brief Block until the next frame deadline; returns the time the frame starts.
+   * With pacing disabled, returns the current time immediately.
+   */
+  double WaitForNextFrame();
+
+  /**
+   * @brief Record a frame that started at frameStart (as returned by WaitForNextFrame).
+   */
+  void RecordFrame(double frameStart);
+
+  /**
+   * @brief Add executed and dropped fixed steps to the statistics.
+   */
+  void RecordFixedSteps(uint32_t executed, uint64_t dropped);
+
+  /**
+   * @brief Statistics over the last kStatsWindow frames.
+   */
+  FrameTimeStats GetStats() const;
+
+ private:
+  void SleepUntil(double deadline);
+
+  IFrameClock* m_clock;
+  double m_period = 0.0;
+  double m_deadline = 0.0;        // Start time of the next paced frame
+  double m_lastFrameStart = -1.0; // < 0 until the first RecordFrame
+  double m_lastLateness = 0.0;    // Lateness of the frame being recorded (paced only)
+  double m_spinMargin;            // Time before the deadline at which sleeping stops
+  double m_frameTimes[kStatsWindow] = {};
+  double m_lateness[kStatsWindow] = {};
+  std::size_t m_sampleCount = 0;
+  std::size_t m_sampleIndex = 0;
+  uint64_t m_missedDeadlines = 0;
+  uint64_t m_fixedSteps = 0;
+  uint64_t m_droppedSteps = 0;
+};
+
+/**
+ * @brief Fixed-timestep accumulator: converts variable frame deltas into whole steps.
+ *
+ * At most maxStepsPerFrame steps run per frame; a backlog beyond that is dropped
+ * rather than replayed in later frames, so a long frame cannot cause a spiral of ever
+ * longer catch-up frames.
+ */
+class FixedStepAccumulator {
+ public:
+  /**
+   * @brief Set the step in seconds (> 0) and the per-frame catch-up limit (>= 1).
+   */
+  void Configure(double stepSeconds, uint32_t maxStepsPerFrame);
+  double GetStep() const { return m_step; }
+  uint32_t GetMaxStepsPerFrame() const { return m_maxStepsPerFrame; }
+
+  /**
+   * @brief Add a frame delta; returns the number of steps to run this frame.
+   */
+  uint32_t Advance(double deltaSeconds);
+
+  /**
+   * @brief Steps discarded by the catch-up limit in the last Advance.
+   */
+  uint64_t GetLastDroppedSteps() const { return m_lastDropped; }
+
+  /**
+   * @brief Fraction of a step accumulated but not simulated, in [0, 1).
+   */
+  float GetAlpha() const { return static_cast<float>(m_accumulator / m_step); }
+
+  /**
+   * @brief Discard accumulated time.
+   */
+  void Reset();
+
+ private:
+  double m_step = 1.0 / 60.0;
+  uint32_t m_maxStepsPerFrame = 8;
+  double m_accumulator = 0.0;  // Unsimulated time
+  uint64_t m_lastDropped = 0;
+};
+
+}  // namespace application
+}  // namespace te
+
+#endif  // TE_APPLICATION_FRAME_PACER_H
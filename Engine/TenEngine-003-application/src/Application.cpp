@@ -7,11 +7,10 @@
 #include "te/core/log.h"
 #include "te/core/check.h"
 #include "te/core/platform.h"
+#include "te/core/profiling.h"
 #include "te/core/thread.h"
 #include "te/application/Platform.h"
 #include <algorithm>
-#include <thread>
-#include <chrono>
 
 namespace te {
 namespace application {
@@ -37,7 +36,9 @@ class Application : public IApplication {
     , m_frameCount(0)
     , m_nextCallbackId(1)
     , m_lastFrameTime(0.0)
-  {}
+  {
+    m_fixedSteps.Configure(static_cast<double>(m_fixedTimeStep), m_fixedSteps.GetMaxStepsPerFrame());
+  }
 
   ~Application() override {
     // Clean up all windows
@@ -112,15 +113,30 @@ class Application : public IApplication {
       RegisterTickCallback(args.tickCallback, 0);
     }
 
+    TE_PROFILE_THREAD_NAME("Main");
+
+    UpdatePacerPeriod();
+    m_framePacer.Reset(te::core::HighResolutionTimer());
+    m_fixedSteps.Reset();
+
     // Main loop
     while (m_isRunning) {
-      double currentTime = te::core::HighResolutionTimer();
+      // Frame rate control: wait for this frame's deadline (no-op when unpaced)
+      double currentTime = 0.0;
+      {
+        TE_PROFILE_ZONE("WaitForFrame");
+        currentTime = m_framePacer.WaitForNextFrame();
+      }
+      m_framePacer.RecordFrame(currentTime);
       m_deltaTime = static_cast<float>(currentTime - m_lastFrameTime);
       m_lastFrameTime = currentTime;
       m_totalTime += m_deltaTime;
 
       // Pump events
-      PumpEvents();
+      {
+        TE_PROFILE_ZONE("PumpEvents");
+        PumpEvents();
+      }
 
       // Check exit condition
       if (!m_isRunning) {
@@ -135,35 +151,32 @@ class Application : public IApplication {
 
       // Execute tick callbacks if not paused
       if (!m_isPaused) {
-        // Sort callbacks by priority (higher priority first)
-        te::core::Array<std::pair<TickCallbackId, TickCallbackData>> sortedCallbacks;
-        for (const auto& pair : m_tickCallbacks) {
-          sortedCallbacks.push_back(pair);
+        // Re-sort only after register/unregister; callbacks (un)registered
+        // during the tick take effect next frame
+        if (m_tickCallbacksDirty) {
+          RebuildSortedTickCallbacks();
         }
-        std::sort(sortedCallbacks.begin(), sortedCallbacks.end(),
-                  [](const auto& a, const auto& b) {
-                    return a.second.priority > b.second.priority;
-                  });
 
         // Execute callbacks
-        for (const auto& pair : sortedCallbacks) {
-          if (pair.second.callback) {
-            pair.second.callback(m_deltaTime);
-          }
-        }
-      }
-
-      // Frame rate control
-      if (m_targetFPS > 0) {
-        double targetFrameTime = 1.0 / static_cast<double>(m_targetFPS);
-        double elapsed = te::core::HighResolutionTimer() - currentTime;
-        if (elapsed < targetFrameTime) {
-          double sleepTime = targetFrameTime - elapsed;
-          std::this_thread::sleep_for(std::chrono::duration<double>(sleepTime));
+        TE_PROFILE_ZONE("Tick");
+        switch (m_timeStepMode) {
+          case TimeStepMode::Fixed:
+            RunFixedSteps(true);
+            break;
+          case TimeStepMode::Mixed:
+            RunFixedSteps(false);
+            RunTickCallbacks(m_sortedTickCallbacks, m_deltaTime);
+            break;
+          case TimeStepMode::Variable:
+          default:
+            RunTickCallbacks(m_sortedTickCallbacks, m_deltaTime);
+            RunTickCallbacks(m_sortedFixedTickCallbacks, m_deltaTime);
+            break;
         }
       }
 
       m_frameCount++;
+      TE_PROFILE_FRAME_MARK();
     }
 
     // Cleanup
@@ -440,13 +453,53 @@ class Application : public IApplication {
 
   void SetTargetFPS(uint32_t fps) override {
     m_targetFPS = fps;
+    UpdatePacerPeriod();
   }
 
   void SetTimeStepMode(TimeStepMode mode) override {
     m_timeStepMode = mode;
+    m_fixedSteps.Reset();
+    UpdatePacerPeriod();
+  }
+
+  void SetFixedTimeStep(float stepSeconds, uint32_t maxStepsPerFrame) override {
+    if (stepSeconds <= 0.0f) {
+      te::core::Log(te::core::LogLevel::Warn, "SetFixedTimeStep: step must be positive");
+      return;
+    }
+    m_fixedTimeStep = stepSeconds;
+    m_fixedSteps.Configure(static_cast<double>(stepSeconds), maxStepsPerFrame);
+    UpdatePacerPeriod();
+  }
+
+  float GetFixedTimeStep() const override {
+    return m_fixedTimeStep;
+  }
+
+  float GetInterpolationAlpha() const override {
+    return m_fixedSteps.GetAlpha();
+  }
+
+  FrameTimeStats GetFrameTimeStats() const override {
+    return m_framePacer.GetStats();
   }
 
   TickCallbackId RegisterTickCallback(TickCallback callback, int32_t priority) override {
+    return AddTickCallback(callback, priority, false);
+  }
+
+  TickCallbackId RegisterFixedTickCallback(TickCallback callback, int32_t priority) override {
+    return AddTickCallback(callback, priority, true);
+  }
+
+  void UnregisterTickCallback(TickCallbackId callbackId) override {
+    if (m_tickCallbacks.erase(callbackId) != 0) {
+      m_tickCallbacksDirty = true;
+    }
+  }
+
+ private:
+  TickCallbackId AddTickCallback(TickCallback callback, int32_t priority, bool fixedStep) {
     if (!callback) {
       return 0;
     }
@@ -455,15 +508,70 @@ class Application : public IApplication {
     TickCallbackData data;
     data.callback = callback;
     data.priority = priority;
+    data.fixedStep = fixedStep;
     m_tickCallbacks[id] = data;
+    m_tickCallbacksDirty = true;
     return id;
   }
 
-  void UnregisterTickCallback(TickCallbackId callbackId) override {
-    m_tickCallbacks.erase(callbackId);
+  /**
+   * @brief Pace to the target FPS, or to the fixed step in Fixed mode without one.
+   */
+  void UpdatePacerPeriod() {
+    double period = 0.0;
+    if (m_targetFPS > 0) {
+      period = 1.0 / static_cast<double>(m_targetFPS);
+    } else if (m_timeStepMode == TimeStepMode::Fixed) {
+      period = static_cast<double>(m_fixedTimeStep);
+    }
+    m_framePacer.SetTargetPeriod(period);
+  }
+
+  static void RunTickCallbacks(te::core::Array<TickCallbackData> const& callbacks, float deltaTime) {
+    for (const auto& data : callbacks) {
+      data.callback(deltaTime);
+    }
+  }
+
+  /**
+   * @brief Advance the fixed-step accumulator by the frame delta and run whole steps.
+   * @param allCallbacks Run tick callbacks per step as well (Fixed mode)
+   */
+  void RunFixedSteps(bool allCallbacks) {
+    uint32_t const steps = m_fixedSteps.Advance(static_cast<double>(m_deltaTime));
+    for (uint32_t i = 0; i < steps; ++i) {
+      if (allCallbacks) {
+        RunTickCallbacks(m_sortedTickCallbacks, m_fixedTimeStep);
+      }
+      RunTickCallbacks(m_sortedFixedTickCallbacks, m_fixedTimeStep);
+    }
+    m_framePacer.RecordFixedSteps(steps, m_fixedSteps.GetLastDroppedSteps());
+  }
+
+  /**
+   * @brief Rebuild the tick lists: higher priority first, registration order within a priority.
+   */
+  void RebuildSortedTickCallbacks() {
+    te::core::Array<std::pair<TickCallbackId, TickCallbackData>> sorted(m_tickCallbacks.begin(),
+                                                                          m_tickCallbacks.end());
+    std::sort(sorted.begin(), sorted.end(), [](const auto& a, const auto& b) {
+      if (a.second.priority != b.second.priority) {
+        return a.second.priority > b.second.priority;
+      }
+      return a.first < b.first;  // Ids increase with registration
+    });
+    m_sortedTickCallbacks.clear();
+    m_sortedFixedTickCallbacks.clear();
+    for (const auto& pair : sorted) {
+      if (pair.second.fixedStep) {
+        m_sortedFixedTickCallbacks.push_back(pair.second);
+      } else {
+        m_sortedTickCallbacks.push_back(pair.second);
+      }
+    }
+    m_tickCallbacksDirty = false;
   }
 
- private:
   EventQueue m_eventQueue;
   te::core::Map<WindowId, WindowData> m_windows;
   WindowId m_nextWindowId;
@@ -481,6 +589,12 @@ class Application : public IApplication {
   uint64_t m_frameCount;
   TickCallbackId m_nextCallbackId;
   te::core::Map<TickCallbackId, TickCallbackData> m_tickCallbacks;
+  te::core::Array<TickCallbackData> m_sortedTickCallbacks;  // Execution order, see RebuildSortedTickCallbacks
+  te::core::Array<TickCallbackData> m_sortedFixedTickCallbacks;
+  bool m_tickCallbacksDirty = false;
+  FramePacer m_framePacer;
+  float m_fixedTimeStep = 1.0f / 60.0f;
+  FixedStepAccumulator m_fixedSteps;  // Unsimulated time (Fixed/Mixed)
   double m_lastFrameTime;
 };
 
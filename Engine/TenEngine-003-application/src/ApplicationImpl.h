@@ -32,6 +32,7 @@ struct WindowData {
 struct TickCallbackData {
   TickCallback callback = nullptr;
   int32_t priority = 0;
+  bool fixedStep = false;  // Registered via RegisterFixedTickCallback
 };
 
 }  // namespace application
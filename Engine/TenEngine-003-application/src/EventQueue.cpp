@@ -1,42 +1,105 @@
 /**
  * @file EventQueue.cpp
- * @brief Event queue implementation (thread-safe).
+ * @brief Event queue implementation (bounded lock-free MPSC ring).
+ *
+ * Each slot carries a sequence number: a producer may write slot (pos & mask)
+ * when its sequence equals pos, and publishes it by storing pos + 1; the consumer
+ * reads it when the sequence equals pos + 1 and frees it by storing pos + capacity.
  */
 #include "te/application/Event.h"
-#include "te/core/thread.h"
 #include <cstddef>
+#include <cstdint>
 
 namespace te {
 namespace application {
 
-bool EventQueue::Pop(Event& event) {
-  te::core::LockGuard lock(m_mutex);
-  if (m_queue.empty()) {
-    return false;
+namespace {
+
+std::size_t RoundUpToPowerOfTwo(std::size_t value) {
+  std::size_t result = 2;
+  while (result < value) {
+    result <<= 1;
+  }
+  return result;
+}
+
+}  // namespace
+
+EventQueue::EventQueue(std::size_t capacity) {
+  std::size_t const size = RoundUpToPowerOfTwo(capacity);
+  m_slots = new Slot[size];
+  m_mask = size - 1;
+  for (std::size_t i = 0; i < size; ++i) {
+    m_slots[i].sequence.store(i, std::memory_order_relaxed);
+  }
+}
+
+EventQueue::~EventQueue() {
+  delete[] m_slots;
+}
+
+bool EventQueue::Push(Event const& event) {
+  std::size_t pos = m_enqueuePos.load(std::memory_order_relaxed);
+  Slot* slot = nullptr;
+  for (;;) {
+    slot = &m_slots[pos & m_mask];
+    std::size_t const seq = slot->sequence.load(std::memory_order_acquire);
+    std::intptr_t const diff = static_cast<std::intptr_t>(seq) - static_cast<std::intptr_t>(pos);
+    if (diff == 0) {
+      if (m_enqueuePos.compare_exchange_weak(pos, pos + 1, std::memory_order_relaxed)) {
+        break;
+      }
+    } else if (diff < 0) {
+      // Slot still holds an event from the previous lap: queue is full
+      m_dropped.fetch_add(1, std::memory_order_relaxed);
+      return false;
+    } else {
+      pos = m_enqueuePos.load(std::memory_order_relaxed);
+    }
   }
-  event = m_queue.front();
-  m_queue.erase(m_queue.begin());
+  slot->event = event;
+  slot->sequence.store(pos + 1, std::memory_order_release);
   return true;
 }
 
-void EventQueue::Push(Event const& event) {
-  te::core::LockGuard lock(m_mutex);
-  m_queue.push_back(event);
+bool EventQueue::Pop(Event& event) {
+  return Drain(&event, 1) == 1;
+}
+
+std::size_t EventQueue::Drain(Event* out, std::size_t maxCount) {
+  std::size_t pos = m_dequeuePos.load(std::memory_order_relaxed);
+  std::size_t count = 0;
+  while (count < maxCount) {
+    Slot& slot = m_slots[pos & m_mask];
+    if (slot.sequence.load(std::memory_order_acquire) != pos + 1) {
+      break;  // Empty, or the producer that claimed this slot has not published yet
+    }
+    out[count++] = slot.event;
+    slot.sequence.store(pos + m_mask + 1, std::memory_order_release);
+    ++pos;
+  }
+  m_dequeuePos.store(pos, std::memory_order_relaxed);
+  return count;
 }
 
 bool EventQueue::Empty() const {
-  te::core::LockGuard lock(m_mutex);
-  return m_queue.empty();
+  return Size() == 0;
 }
 
 std::size_t EventQueue::Size() const {
-  te::core::LockGuard lock(m_mutex);
-  return m_queue.size();
+  std::size_t const dequeue = m_dequeuePos.load(std::memory_order_relaxed);
+  std::size_t const enqueue = m_enqueuePos.load(std::memory_order_relaxed);
+  return enqueue > dequeue ? enqueue - dequeue : 0;
+}
+
+std::uint64_t EventQueue::GetDroppedCount() const {
+  return m_dropped.load(std::memory_order_relaxed);
 }
 
 void EventQueue::Clear() {
-  te::core::LockGuard lock(m_mutex);
-  m_queue.clear();
+  Event discard[64];
+  while (Drain(discard, 64) == 64) {
+  }
 }
 
 }  // namespace application
@@ -0,0 +1,182 @@
+/**
+ * @file FramePacer.cpp
+ * @brief Frame pacer implementation (hybrid sleep-then-spin).
+ */
+#include "te/application/FramePacer.h"
+#include "te/core/platform.h"
+#include <algorithm>
+#include <chrono>
+#include <thread>
+
+namespace te {
+namespace application {
+
+namespace {
+
+// Spin margin bounds (seconds): lower keeps CPU use low on precise timers, upper
+// covers coarse schedulers (e.g. a 15.6 ms Windows tick)
+constexpr double kMinSpinMargin = 0.0002;
+constexpr double kMaxSpinMargin = 0.016;
+constexpr double kInitialSpinMargin = 0.002;
+
+class SystemFrameClock final : public IFrameClock {
+ public:
+  double Now() override { return te::core::HighResolutionTimer(); }
+
+  void Sleep(double seconds) override {
+    if (seconds > 0.0) {
+      std::this_thread::sleep_for(std::chrono::duration<double>(seconds));
+    } else {
+      std::this_thread::yield();
+    }
+  }
+};
+
+IFrameClock* GetSystemFrameClock() {
+  static SystemFrameClock clock;
+  return &clock;
+}
+
+}  // namespace
+
+FramePacer::FramePacer(IFrameClock* clock)
+    : m_clock(clock ? clock : GetSystemFrameClock()), m_spinMargin(kInitialSpinMargin) {}
+
+void FramePacer::SetTargetPeriod(double seconds) {
+  double const period = seconds > 0.0 ? seconds : 0.0;
+  if (period == m_period) {
+    return;
+  }
+  m_period = period;
+  m_deadline = m_clock->Now();
+}
+
+void FramePacer::Reset(double now) {
+  m_deadline = now;
+  m_lastFrameStart = -1.0;
+  m_lastLateness = 0.0;
+  m_sampleCount = 0;
+  m_sampleIndex = 0;
+  m_missedDeadlines = 0;
+  m_fixedSteps = 0;
+  m_droppedSteps = 0;
+}
+
+double FramePacer::WaitForNextFrame() {
+  double now = m_clock->Now();
+  if (m_period <= 0.0) {
+    m_lastLateness = 0.0;
+    return now;
+  }
+  if (now < m_deadline) {
+    SleepUntil(m_deadline);
+    now = m_clock->Now();
+  }
+  m_lastLateness = now - m_deadline;
+  if (m_lastLateness > m_period) {
+    // Too late to catch up without a burst of short frames: start a new schedule
+    ++m_missedDeadlines;
+    m_deadline = now + m_period;
+  } else {
+    m_deadline += m_period;
+  }
+  return now;
+}
+
+void FramePacer::SleepUntil(double deadline) {
+  // One sleep per wait: the margin it adapts applies from the next wait, so a sleep that
+  // returns on time cannot be followed by ever shorter sleeps toward the new margin
+  bool slept = false;
+  for (;;) {
+    double const now = m_clock->Now();
+    double const remaining = deadline - now;
+    if (remaining <= 0.0) {
+      return;
+    }
+    if (!slept && remaining > m_spinMargin) {
+      slept = true;
+      double const request = remaining - m_spinMargin;
+      m_clock->Sleep(request);
+      double const overshoot = m_clock->Now() - now - request;
+      // Grow the margin at once to cover the observed overshoot, shrink it slowly
+      double const wanted = std::clamp(overshoot * 1.25 + kMinSpinMargin, kMinSpinMargin, kMaxSpinMargin);
+      m_spinMargin = wanted > m_spinMargin ? wanted : m_spinMargin * 0.95 + wanted * 0.05;
+    } else {
+      m_clock->Sleep(0.0);
+    }
+  }
+}
+
+void FramePacer::RecordFrame(double frameStart) {
+  if (m_lastFrameStart >= 0.0) {
+    m_frameTimes[m_sampleIndex] = frameStart - m_lastFrameStart;
+    m_lateness[m_sampleIndex] = m_lastLateness;
+    m_sampleIndex = (m_sampleIndex + 1) % kStatsWindow;
+    m_sampleCount = std::min(m_sampleCount + 1, kStatsWindow);
+  }
+  m_lastFrameStart = frameStart;
+}
+
+void FramePacer::RecordFixedSteps(uint32_t executed, uint64_t dropped) {
+  m_fixedSteps += executed;
+  m_droppedSteps += dropped;
+}
+
+FrameTimeStats FramePacer::GetStats() const {
+  FrameTimeStats stats;
+  stats.sampleCount = static_cast<uint32_t>(m_sampleCount);
+  stats.missedDeadlines = m_missedDeadlines;
+  stats.fixedSteps = m_fixedSteps;
+  stats.droppedSteps = m_droppedSteps;
+  if (m_sampleCount == 0) {
+    return stats;
+  }
+  stats.lastFrameTime = m_frameTimes[(m_sampleIndex + kStatsWindow - 1) % kStatsWindow];
+  stats.minFrameTime = m_frameTimes[0];
+  stats.maxFrameTime = m_frameTimes[0];
+  double total = 0.0;
+  double totalLateness = 0.0;
+  for (std::size_t i = 0; i < m_sampleCount; ++i) {
+    total += m_frameTimes[i];
+    stats.minFrameTime = std::min(stats.minFrameTime, m_frameTimes[i]);
+    stats.maxFrameTime = std::max(stats.maxFrameTime, m_frameTimes[i]);
+    totalLateness += m_lateness[i];
+    stats.maxLateness = std::max(stats.maxLateness, m_lateness[i]);
+  }
+  stats.averageFrameTime = total / static_cast<double>(m_sampleCount);
+  stats.jitter = totalLateness / static_cast<double>(m_sampleCount);
+  return stats;
+}
+
+void FixedStepAccumulator::Configure(double stepSeconds, uint32_t maxStepsPerFrame) {
+  if (stepSeconds > 0.0) {
+    m_step = stepSeconds;
+  }
+  m_maxStepsPerFrame = maxStepsPerFrame > 0 ? maxStepsPerFrame : 1;
+}
+
+uint32_t FixedStepAccumulator::Advance(double deltaSeconds) {
+  if (deltaSeconds > 0.0) {
+    m_accumulator += deltaSeconds;
+  }
+  uint32_t steps = 0;
+  while (m_accumulator >= m_step && steps < m_maxStepsPerFrame) {
+    m_accumulator -= m_step;
+    ++steps;
+  }
+  // Past the catch-up limit, drop the backlog instead of spiralling
+  m_lastDropped = 0;
+  if (m_accumulator >= m_step) {
+    m_lastDropped = static_cast<uint64_t>(m_accumulator / m_step);
+    m_accumulator -= static_cast<double>(m_lastDropped) * m_step;
+  }
+  return steps;
+}
+
+void FixedStepAccumulator::Reset() {
+  m_accumulator = 0.0;
+  m_lastDropped = 0;
+}
+
+}  // namespace application
+}  // namespace te
@@ -0,0 +1,118 @@
+/**
+ * @file test_event_queue.cpp
+ * @brief EventQueue (bounded MPSC ring): capacity rounding, FIFO drain, the full/drop path,
+ *        and concurrent producers whose events arrive in order per producer.
+ */
+#include "te/application/Event.h"
+#include <atomic>
+#include <cassert>
+#include <cstdint>
+#include <cstdio>
+#include <thread>
+#include <vector>
+
+using namespace te::application;
+
+namespace {
+
+Event MakeEvent(WindowId producer, uint32_t sequence) {
+  Event event{};
+  event.type = EventType::KeyDown;
+  event.windowId = producer;
+  event.key.keyCode = sequence;
+  return event;
+}
+
+void TestCapacity() {
+  assert(EventQueue().Capacity() == EventQueue::kDefaultCapacity);
+  assert(EventQueue::kDefaultCapacity == 4096);
+  assert(EventQueue(5).Capacity() == 8);
+  assert(EventQueue(64).Capacity() == 64);
+}
+
+void TestFifoAndDrop() {
+  EventQueue queue(8);
+  Event event{};
+  assert(queue.Empty() && !queue.Pop(event));
+
+  for (uint32_t i = 0; i < 8; ++i) assert(queue.Push(MakeEvent(0, i)));
+  assert(queue.Size() == 8);
+
+  // Full: the new event is dropped and counted, queued events are kept
+  assert(!queue.Push(MakeEvent(0, 100)));
+  assert(!queue.Push(MakeEvent(0, 101)));
+  assert(queue.GetDroppedCount() == 2 && queue.Size() == 8);
+
+  Event out[8];
+  assert(queue.Drain(out, 3) == 3);
+  for (uint32_t i = 0; i < 3; ++i) assert(out[i].key.keyCode == i);
+
+  // Freed slots are reused across the wrap-around, order is kept
+  for (uint32_t i = 8; i < 11; ++i) assert(queue.Push(MakeEvent(0, i)));
+  assert(!queue.Push(MakeEvent(0, 102)));
+  assert(queue.Drain(out, 8) == 8);
+  for (uint32_t i = 0; i < 8; ++i) assert(out[i].key.keyCode == i + 3);
+  assert(queue.Empty() && queue.Drain(out, 8) == 0);
+
+  assert(queue.Push(MakeEvent(0, 11)) && queue.Pop(event) && event.key.keyCode == 11);
+  assert(queue.Push(MakeEvent(0, 12)));
+  queue.Clear();
+  assert(queue.Empty() && queue.GetDroppedCount() == 3);
+}
+
+// Producers retry dropped pushes, so every event arrives once and in order per producer
+void TestConcurrentProducers() {
+  constexpr WindowId kProducers = 4;
+  constexpr uint32_t kEventsPerProducer = 50000;
+  EventQueue queue(256);  // Small ring: producers hit the full path while the consumer drains
+  std::atomic<uint64_t> failedPushes{0};
+  std::atomic<bool> start{false};
+
+  std::vector<std::thread> producers;
+  for (WindowId p = 0; p < kProducers; ++p) {
+    producers.emplace_back([&, p]() {
+      while (!start.load()) std::this_thread::yield();
+      uint64_t failed = 0;
+      for (uint32_t i = 0; i < kEventsPerProducer; ++i) {
+        while (!queue.Push(MakeEvent(p, i))) {
+          ++failed;
+          std::this_thread::yield();
+        }
+      }
+      failedPushes += failed;
+    });
+  }
+
+  std::vector<uint32_t> next(kProducers, 0);
+  uint64_t received = 0;
+  Event batch[64];
+  start = true;
+  while (received < uint64_t(kProducers) * kEventsPerProducer) {
+    std::size_t const count = queue.Drain(batch, 64);
+    for (std::size_t i = 0; i < count; ++i) {
+      Event const& event = batch[i];
+      assert(event.type == EventType::KeyDown && event.windowId < kProducers);
+      assert(event.key.keyCode == next[event.windowId]);
+      ++next[event.windowId];
+    }
+    received += count;
+    if (count == 0) std::this_thread::yield();
+  }
+  for (std::thread& t : producers) t.join();
+
+  for (WindowId p = 0; p < kProducers; ++p) assert(next[p] == kEventsPerProducer);
+  assert(queue.Empty());
+  assert(queue.GetDroppedCount() == failedPushes.load());
+  std::printf("event queue: %llu pushes dropped while full\n",
+              static_cast<unsigned long long>(failedPushes.load()));
+}
+
+}  // namespace
+
+int main() {
+  TestCapacity();
+  TestFifoAndDrop();
+  TestConcurrentProducers();
+  std::printf("test_event_queue: pass\n");
+  return 0;
+}
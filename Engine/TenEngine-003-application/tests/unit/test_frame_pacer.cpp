@@ -0,0 +1,184 @@
+/**
+ * @file test_frame_pacer.cpp
+ * @brief FramePacer on an injected clock (frame start times, adaptive spin margin, missed
+ *        deadline resync) and FixedStepAccumulator (step counts, catch-up clamp, alpha).
+ */
+#include "te/application/FramePacer.h"
+#include <cassert>
+#include <cmath>
+#include <cstdio>
+
+using namespace te::application;
+
+namespace {
+
+constexpr double kYieldTime = 0.00005;  // Time a yield takes on the fake clock
+
+/// Deterministic clock: time only moves when the pacer sleeps or the test works
+struct FakeClock : IFrameClock {
+  double now = 0.0;
+  double overshoot = 0.0;  // Added to every sleep, like a coarse scheduler
+  int sleeps = 0;
+  int yields = 0;
+
+  double Now() override { return now; }
+  void Sleep(double seconds) override {
+    if (seconds > 0.0) {
+      now += seconds + overshoot;
+      ++sleeps;
+    } else {
+      now += kYieldTime;
+      ++yields;
+    }
+  }
+  void Work(double seconds) { now += seconds; }
+};
+
+bool Near(double a, double b, double tolerance) {
+  return std::fabs(a - b) <= tolerance;
+}
+
+// Frames start on their deadlines; the wait sleeps first and spins only the remainder
+void TestPacedFrames() {
+  FakeClock clock;
+  FramePacer pacer(&clock);
+  pacer.SetTargetPeriod(0.01);
+  pacer.Reset(clock.Now());
+
+  int yieldsBeforeLastFrames = 0;
+  for (int frame = 0; frame < 100; ++frame) {
+    if (frame == 80) yieldsBeforeLastFrames = clock.yields;
+    double const start = pacer.WaitForNextFrame();
+    assert(start >= frame * 0.01 - 1e-9 && start < frame * 0.01 + kYieldTime + 1e-9);
+    pacer.RecordFrame(start);
+    clock.Work(0.004);
+  }
+  FrameTimeStats const stats = pacer.GetStats();
+  assert(stats.sampleCount == 99 && stats.missedDeadlines == 0);
+  assert(Near(stats.averageFrameTime, 0.01, 1e-6));
+  assert(stats.maxLateness <= kYieldTime + 1e-9);
+  assert(clock.sleeps >= 99);
+  // Sleeps never overshoot here, so the spin margin shrinks toward its minimum
+  assert(clock.yields - yieldsBeforeLastFrames < 20 * 10);
+}
+
+// Sleep overshoot makes the first waits late; the margin then grows to cover it
+void TestSpinMarginAdapts() {
+  FakeClock clock;
+  clock.overshoot = 0.003;  // Larger than the initial spin margin
+  FramePacer pacer(&clock);
+  pacer.SetTargetPeriod(0.01);
+  pacer.Reset(clock.Now());
+
+  double firstLateness = 0.0;
+  for (int frame = 0; frame < 3; ++frame) {
+    double const start = pacer.WaitForNextFrame();
+    if (frame == 1) firstLateness = start - 0.01;
+    pacer.RecordFrame(start);
+    clock.Work(0.004);
+  }
+  assert(firstLateness > 0.0005);
+
+  pacer.Reset(pacer.WaitForNextFrame());
+  for (int frame = 0; frame < 50; ++frame) {
+    pacer.RecordFrame(pacer.WaitForNextFrame());
+    clock.Work(0.004);
+  }
+  FrameTimeStats const stats = pacer.GetStats();
+  assert(stats.missedDeadlines == 0 && stats.maxLateness <= kYieldTime + 1e-9);
+  assert(stats.maxFrameTime <= 0.01 + kYieldTime + 1e-9);
+  assert(Near(stats.averageFrameTime, 0.01, kYieldTime / stats.sampleCount + 1e-9));
+}
+
+// A frame more than a period late restarts the schedule; a shorter hitch is caught up
+void TestMissedDeadline() {
+  FakeClock clock;
+  FramePacer pacer(&clock);
+  pacer.SetTargetPeriod(0.01);
+  pacer.Reset(clock.Now());
+
+  pacer.RecordFrame(pacer.WaitForNextFrame());  // 0.00
+  clock.Work(0.025);
+  double const late = pacer.WaitForNextFrame();  // 0.015 past the 0.01 deadline
+  assert(Near(late, 0.025, 1e-9) && pacer.GetStats().missedDeadlines == 1);
+  pacer.RecordFrame(late);
+  double const next = pacer.WaitForNextFrame();  // Not 0.02: no burst to catch up
+  assert(next >= late + 0.01 - 1e-9 && next < late + 0.01 + kYieldTime + 1e-9);
+  pacer.RecordFrame(next);
+
+  // 0.005 late: within a period, so the following deadline stays on the old schedule
+  clock.Work(0.015);
+  double const hitch = pacer.WaitForNextFrame();
+  pacer.RecordFrame(hitch);
+  double const caughtUp = pacer.WaitForNextFrame();
+  assert(pacer.GetStats().missedDeadlines == 1);
+  assert(caughtUp >= next + 0.02 - 1e-9 && caughtUp < next + 0.02 + kYieldTime + 1e-9);
+  assert(pacer.GetStats().maxLateness >= 0.005 - 1e-9);
+}
+
+// Without a period the pacer never waits
+void TestUnpaced() {
+  FakeClock clock;
+  clock.now = 5.0;
+  FramePacer pacer(&clock);
+  pacer.SetTargetPeriod(0.0);
+  pacer.Reset(clock.Now());
+  for (int frame = 0; frame < 10; ++frame) {
+    assert(pacer.WaitForNextFrame() == clock.Now());
+    pacer.RecordFrame(clock.Now());
+    clock.Work(0.002);
+  }
+  assert(clock.sleeps == 0 && clock.yields == 0);
+  assert(Near(pacer.GetStats().averageFrameTime, 0.002, 1e-9) && pacer.GetStats().jitter == 0.0);
+
+  pacer.RecordFixedSteps(3, 2);
+  pacer.RecordFixedSteps(1, 0);
+  assert(pacer.GetStats().fixedSteps == 4 && pacer.GetStats().droppedSteps == 2);
+}
+
+void TestFixedStepAccumulator() {
+  FixedStepAccumulator steps;
+  steps.Configure(0.125, 4);
+  assert(steps.GetStep() == 0.125 && steps.GetMaxStepsPerFrame() == 4);
+
+  assert(steps.Advance(0.3) == 2 && steps.GetLastDroppedSteps() == 0);
+  assert(Near(steps.GetAlpha(), 0.4, 1e-6));
+  assert(steps.Advance(0.1) == 1 && Near(steps.GetAlpha(), 0.2, 1e-6));
+  assert(steps.Advance(0.0) == 0 && Near(steps.GetAlpha(), 0.2, 1e-6));
+
+  // A long frame runs the catch-up limit and drops the rest of the backlog
+  assert(steps.Advance(2.0) == 4 && steps.GetLastDroppedSteps() == 12);
+  assert(Near(steps.GetAlpha(), 0.2, 1e-6));
+  assert(steps.Advance(0.2) == 1 && steps.GetLastDroppedSteps() == 0);
+
+  steps.Reset();
+  assert(steps.GetAlpha() == 0.0f && steps.Advance(0.1) == 0);
+
+  // Variable frame times average out to the step rate
+  steps.Configure(1.0 / 60.0, 8);
+  steps.Reset();
+  uint32_t total = 0;
+  double const frames[] = {1.0 / 144.0, 1.0 / 30.0, 1.0 / 90.0, 1.0 / 45.0};
+  for (int i = 0; i < 100; ++i) {
+    total += steps.Advance(frames[i % 4]);
+    assert(steps.GetAlpha() >= 0.0f && steps.GetAlpha() < 1.0f);
+  }
+  double const elapsed = 25.0 * (frames[0] + frames[1] + frames[2] + frames[3]);
+  assert(total == static_cast<uint32_t>(elapsed * 60.0) || total + 1 == static_cast<uint32_t>(elapsed * 60.0));
+
+  // Invalid settings keep a usable configuration
+  steps.Configure(0.0, 0);
+  assert(steps.GetStep() == 1.0 / 60.0 && steps.GetMaxStepsPerFrame() == 1);
+}
+
+}  // namespace
+
+int main() {
+  TestPacedFrames();
+  TestSpinMarginAdapts();
+  TestMissedDeadline();
+  TestUnpaced();
+  TestFixedStepAccumulator();
+  std::printf("test_frame_pacer: pass\n");
+  return 0;
+}
@@ -9,6 +9,7 @@
 
 #include <te/scene/SceneTypes.h>
 #include <te/core/math.h>
+#include <cstddef>
 #include <vector>
 
 namespace te {
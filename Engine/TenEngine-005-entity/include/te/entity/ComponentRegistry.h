@@ -35,6 +35,8 @@ public:
      * 
      * Registers the component type with both Entity module
      * and 002-Object TypeRegistry for reflection support.
+     * Registering a name again has no effect. After TypeRegistry::Freeze
+     * only the Entity registration succeeds.
      */
     template<typename T>
     void RegisterComponentType(char const* name);
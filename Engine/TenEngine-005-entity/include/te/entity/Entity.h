@@ -15,6 +15,7 @@
 #include <te/object/TypeId.h>
 #include <te/object/TypeRegistry.h>
 #include <te/core/math.h>
+#include <atomic>
 #include <memory>
 #include <unordered_map>
 #include <vector>
@@ -72,6 +73,13 @@ public:
      */
     EntityId GetEntityId() const { return m_entityId; }
     
+    /**
+     * @brief Get creation serial
+     * @return Number unique to this Entity for the process lifetime; unlike EntityId
+     *         (the Entity's address) it is never handed to another Entity after Destroy
+     */
+    uint64_t GetSerial() const { return m_serial; }
+    
     /**
      * @brief Get Scene node (this Entity implements ISceneNode)
      * @return ISceneNode pointer (this)
@@ -156,6 +164,12 @@ public:
     Component* GetComponent(te::object::TypeId typeId) { return GetComponentInternal(typeId); }
     Component const* GetComponent(te::object::TypeId typeId) const { return GetComponentInternal(typeId); }
 
+    /**
+     * @brief Append the TypeIds of all attached components (for Editor/reflection).
+     * @param out Receives one TypeId per component, in no particular order
+     */
+    void GetComponentTypeIds(std::vector<te::object::TypeId>& out) const;
+
     // ========== ISceneNode Interface Implementation ==========
     
     // Hierarchy
@@ -209,6 +223,7 @@ private:
     
     // Entity identity
     EntityId m_entityId;
+    uint64_t m_serial;
     std::string m_name;
     
     // Scene node data
@@ -244,7 +259,7 @@ namespace detail {
     };
 
     template<typename T>
-    te::object::TypeId GetComponentTypeId() {
+    te::object::TypeId ResolveComponentTypeId() {
         // Try ComponentRegistry first with registered name
         IComponentRegistry* registry = GetComponentRegistry();
 
@@ -273,15 +288,26 @@ namespace detail {
             }
         }
 
-        // Fallback to TypeRegistry with typeid name
-        char const* typeName = typeid(T).name();
-        te::object::TypeDescriptor const* desc = te::object::TypeRegistry::GetTypeByName(typeName);
+        // Fallback to TypeRegistry with typeid name (TypeOf caches the descriptor)
+        te::object::TypeDescriptor const* desc = te::object::TypeOf<T>();
         if (desc) {
             return desc->id;
         }
 
         return 0;
     }
+
+    // Resolved once per component type; registrations are never removed, so the id stays valid
+    template<typename T>
+    te::object::TypeId GetComponentTypeId() {
+        static std::atomic<te::object::TypeId> s_typeId{0};
+        te::object::TypeId typeId = s_typeId.load(std::memory_order_relaxed);
+        if (typeId == 0) {
+            typeId = ResolveComponentTypeId<T>();
+            s_typeId.store(typeId, std::memory_order_relaxed);
+        }
+        return typeId;
+    }
 }
 
 // Macro to register component type name for template lookup
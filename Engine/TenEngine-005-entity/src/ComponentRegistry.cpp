@@ -39,6 +39,9 @@ namespace {
         }
 
         void RegisterComponentTypeByNameAndSize(char const* name, std::size_t size) override {
+            if (m_nameToTypeId.find(std::string(name)) != m_nameToTypeId.end()) {
+                return;
+            }
             te::object::TypeDescriptor desc;
             desc.name = name;
             desc.size = size;
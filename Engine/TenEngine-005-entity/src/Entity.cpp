@@ -18,8 +18,13 @@ namespace entity {
 // Forward declaration
 extern EntityManager* GetEntityManager();
 
+namespace {
+std::atomic<uint64_t> g_nextEntitySerial{0};
+}  // namespace
+
 Entity::Entity(te::scene::WorldRef world, char const* name)
     : m_entityId(EntityId(this))
+    , m_serial(++g_nextEntitySerial)
     , m_name(name ? name : "")
     , m_world(world)
     , m_parent(nullptr)
@@ -71,8 +76,14 @@ Entity::~Entity() {
 Entity* Entity::Create(te::scene::WorldRef world, char const* name) {
     Entity* entity = new Entity(world, name);
     
-    // Register with SceneManager
-    te::scene::SceneManager::GetInstance().RegisterNode(entity);
+    // Register with SceneManager in the entity's own world (not the active one, which
+    // differs while another level is open)
+    te::scene::SceneManager& sceneMgr = te::scene::SceneManager::GetInstance();
+    if (world.IsValid()) {
+        sceneMgr.RegisterNode(entity, world);
+    } else {
+        sceneMgr.RegisterNode(entity);
+    }
     
     return entity;
 }
@@ -355,5 +366,12 @@ bool Entity::HasComponentInternal(te::object::TypeId typeId) const {
     return m_components.find(typeId) != m_components.end();
 }
 
+void Entity::GetComponentTypeIds(std::vector<te::object::TypeId>& out) const {
+    out.reserve(out.size() + m_components.size());
+    for (auto const& kv : m_components) {
+        out.push_back(kv.first);
+    }
+}
+
 }  // namespace entity
 }  // namespace te
@@ -40,16 +40,25 @@ class Input : public IInput {
   // ========== Event Processing ==========
 
   void ProcessEvents(te::application::EventQueue& eventQueue) override {
-    te::application::Event event;
-    while (eventQueue.Pop(event)) {
-      // Update keyboard state
-      m_keyboardState.UpdateFromEvent(event);
-      
-      // Update mouse state
-      m_mouseState.UpdateFromEvent(event);
-      
-      // Update touch state
-      m_touchState.UpdateFromEvent(event);
+    // Drain in batches; events pushed while draining wait for the next frame
+    te::application::Event events[64];
+    std::size_t remaining = eventQueue.Size();
+    while (remaining > 0) {
+      std::size_t const count = eventQueue.Drain(events, remaining < 64 ? remaining : 64);
+      if (count == 0) {
+        break;
+      }
+      remaining -= count;
+      for (std::size_t i = 0; i < count; ++i) {
+        // Update keyboard state
+        m_keyboardState.UpdateFromEvent(events[i]);
+        
+        // Update mouse state
+        m_mouseState.UpdateFromEvent(events[i]);
+        
+        // Update touch state
+        m_touchState.UpdateFromEvent(events[i]);
+      }
     }
     
     // Update gamepad state (poll devices)
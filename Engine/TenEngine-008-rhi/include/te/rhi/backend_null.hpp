@@ -0,0 +1,112 @@
+/** @file backend_null.hpp
+ *  Null (recording) backend factory: CreateDeviceNull, DestroyDeviceNull, and inspection
+ *  of recorded command streams, device counters and CPU-side resource memory.
+ *
+ *  The null backend needs no GPU or window. Buffers and textures own real CPU memory,
+ *  command lists record into an inspectable stream, and queue submission "executes" the
+ *  stream on the CPU (copies move bytes, everything else is counted). Fences are signaled
+ *  when the submission completes, i.e. before Submit returns, unless the submission waits
+ *  on a timeline value not yet reached: it is then deferred (with later submissions on the
+ *  same queue) until a submit or ISemaphore::Signal reaches the value.
+ *
+ *  Inspection functions must only be given objects created by a null device.
+ */
+#pragma once
+
+#include <te/rhi/device.hpp>
+#include <cstddef>
+#include <cstdint>
+
+namespace te {
+namespace rhi {
+
+struct IDevice;
+IDevice* CreateDeviceNull();
+void DestroyDeviceNull(IDevice* device);
+
+/** Recorded command type; one entry per ICommandList call (Begin/End are not recorded). */
+enum class RecordedCommandType : uint32_t {
+  Draw = 0,
+  DrawIndexed,
+  SetViewport,
+  SetScissor,
+  SetUniformBuffer,
+  SetVertexBuffer,
+  SetIndexBuffer,
+  SetGraphicsPSO,
+  BindDescriptorSet,
+  BeginRenderPass,
+  NextSubpass,
+  EndRenderPass,
+  BeginOcclusionQuery,
+  EndOcclusionQuery,
+  CopyBuffer,
+  CopyBufferToTexture,
+  CopyTextureToBuffer,
+  BuildAccelerationStructure,
+  DispatchRays,
+  Dispatch,
+  Copy,
+  ResourceBarrier,
+};
+
+/** One recorded command. Fields not used by a command type are zero / null.
+ *  - Draw / DrawIndexed: args = {count, instanceCount, first, vertexOffset, firstInstance}
+ *  - Set* / BindDescriptorSet: object = bound PSO/buffer/set (may be null), args[0] = slot or set index,
+ *    offset = buffer offset, args[1] = stride / index format
+ *  - BindDescriptorSet: args[1] = dynamic offset count, offset = first dynamic offset (a rebind with a
+ *    different dynamic offset is not a redundant state change)
+ *  - BeginRenderPass: args[0] = color attachment count, args[1] = LoadOp of color attachment 0,
+ *    args[2] = depth LoadOp, object = color attachment 0 texture, object2 = IRenderPass
+ *  - Copy*: object = source, object2 = destination, srcOffset / offset = buffer offsets, size = bytes
+ *  - ResourceBarrier: args[0] = buffer barrier count, args[1] = texture barrier count
+ *  - Dispatch: args = {x, y, z}
+ */
+struct RecordedCommand {
+  RecordedCommandType type;
+  uint32_t            args[5];
+  void const*         object;
+  void const*         object2;
+  size_t              srcOffset;
+  size_t              offset;
+  size_t              size;
+};
+
+/** Device-wide counters. Command counters accumulate on queue submission; resource
+ *  and upload counters accumulate on the IDevice call. */
+struct NullDeviceCounters {
+  uint64_t submits;               // Queue submissions with a command list (a batched submit counts once)
+  uint64_t commandLists;          // Command lists executed
+  uint64_t commandsExecuted;      // Recorded commands in submitted lists
+  uint64_t drawCalls;             // Draw + DrawIndexed
+  uint64_t instances;             // Sum of instance counts of draws
+  uint64_t dispatches;            // Dispatch + DispatchRays
+  uint64_t renderPasses;          // BeginRenderPass
+  uint64_t stateChanges;          // PSO, vertex/index/uniform buffer and descriptor set binds
+  uint64_t psoChanges;            // SetGraphicsPSO
+  uint64_t redundantStateChanges; // Binds of the state already bound in the same list
+  uint64_t barriers;              // Buffer + texture barriers
+  uint64_t bytesUploaded;         // IDevice::UpdateBuffer + ICommandList::Copy
+  uint64_t bytesCopied;           // CopyBuffer / CopyBufferToTexture / CopyTextureToBuffer
+  uint64_t presents;              // ISwapChain::Present
+  uint64_t buffersCreated;
+  uint64_t texturesCreated;
+  uint64_t psosCreated;
+  uint64_t liveResourceBytes;     // CPU memory currently held by buffers and textures
+};
+
+/** Commands recorded since the last Begin() on cmd; *outCount receives the count. */
+RecordedCommand const* GetRecordedCommands(ICommandList const* cmd, size_t* outCount);
+
+/** Snapshot of the device counters. */
+NullDeviceCounters GetNullDeviceCounters(IDevice const* device);
+
+/** Zero the command/upload counters (resource and live-byte counters are kept). */
+void ResetNullDeviceCounters(IDevice* device);
+
+/** CPU memory backing a null buffer or texture (textures: tightly packed, 4 bytes per texel). */
+void* GetNullBufferData(IBuffer* buffer, size_t* outSize);
+void* GetNullTextureData(ITexture* texture, size_t* outSize);
+
+}  // namespace rhi
+}  // namespace te
@@ -84,6 +84,8 @@ struct TextureRegion {
 struct IRenderPass {
   /// For PSO creation: number of color attachments in this subpass. Return 1 if index out of range.
   virtual uint32_t GetSubpassColorAttachmentCount(uint32_t subpassIndex) const { (void)subpassIndex; return 1u; }
+  /// Description the pass was created with (formats and subpass layout identify compatible passes); nullptr if not kept.
+  virtual RenderPassDesc const* GetDesc() const { return nullptr; }
   virtual ~IRenderPass() = default;
 };
 
@@ -104,6 +106,10 @@ struct ICommandList {
   virtual void BindDescriptorSet(IDescriptorSet* set) = 0;
   /** Bind descriptor set at given set index (e.g. 0 = material, 1 = skin). When setIndex is 0, equivalent to BindDescriptorSet(set). */
   virtual void BindDescriptorSet(uint32_t setIndex, IDescriptorSet* set) = 0;
+  /** Bind with one offset per UniformBufferDynamic binding of the set, in increasing binding order;
+   *  each is added to the written bufferOffset and must be a multiple of minUniformBufferOffsetAlignment. */
+  virtual void BindDescriptorSet(uint32_t setIndex, IDescriptorSet* set,
+                                 uint32_t const* dynamicOffsets, uint32_t dynamicOffsetCount) = 0;
   virtual void BeginRenderPass(RenderPassDesc const& desc, IRenderPass* pass = nullptr) = 0;
   virtual void NextSubpass() = 0;
   virtual void EndRenderPass() = 0;
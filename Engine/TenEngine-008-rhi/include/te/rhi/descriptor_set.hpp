@@ -17,6 +17,9 @@ enum class DescriptorType : uint32_t {
   Sampler = 2,
   StorageBuffer = 3,
   StorageImage = 4,
+  /** Uniform buffer whose offset is supplied per bind (BindDescriptorSet dynamicOffsets), so one
+   *  written set serves every ring block of the buffer. */
+  UniformBufferDynamic = 5,
 };
 
 struct DescriptorSetLayoutBinding {
@@ -41,6 +44,8 @@ struct DescriptorWrite {
   size_t          bufferOffset;  /* for uniform buffer ring offset */
   ITexture*       texture;
   ISampler*       sampler;
+  size_t          bufferRange;   /* bytes visible from bufferOffset; 0 = rest of the buffer. Set it for
+                                    dynamic uniform buffers (the block size) */
 };
 
 struct IDescriptorSetLayout {
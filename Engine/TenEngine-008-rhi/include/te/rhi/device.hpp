@@ -33,6 +33,9 @@ struct IDevice {
   virtual void DestroyCommandList(ICommandList* cmd) = 0;
   virtual IBuffer* CreateBuffer(BufferDesc const& desc) = 0;
   virtual void UpdateBuffer(IBuffer* buf, size_t offset, void const* data, size_t size) = 0;
+  /** Persistent CPU mapping of a Uniform buffer, valid until DestroyBuffer; nullptr when the backend
+   *  cannot keep the buffer mapped (write through UpdateBuffer instead). Writes need no flush. */
+  virtual void* MapBuffer(IBuffer* buf) = 0;
   virtual ITexture* CreateTexture(TextureDesc const& desc) = 0;
   virtual ISampler* CreateSampler(SamplerDesc const& desc) = 0;
   virtual ViewHandle CreateView(ViewDesc const& desc) = 0;
@@ -54,6 +57,8 @@ struct IDevice {
   virtual void DestroyPSO(IPSO* pso) = 0;
   virtual IFence* CreateFence(bool initialSignaled = false) = 0;
   virtual ISemaphore* CreateSemaphore() = 0;
+  /** Timeline semaphore starting at initialValue; nullptr when the backend has none. */
+  virtual ISemaphore* CreateTimelineSemaphore(uint64_t initialValue = 0) = 0;
   virtual void DestroyFence(IFence* f) = 0;
   virtual void DestroySemaphore(ISemaphore* s) = 0;
   virtual ISwapChain* CreateSwapChain(SwapChainDesc const& desc) = 0;
@@ -1,5 +1,5 @@
 /** @file queue.hpp
- *  008-RHI ABI: IQueue (Submit, WaitIdle).
+ *  008-RHI ABI: IQueue (Submit, batched Submit with SubmitInfo, WaitIdle).
  */
 #pragma once
 
@@ -8,11 +8,30 @@
 namespace te {
 namespace rhi {
 
+/** One semaphore operation of a batched submit; value is used by timeline semaphores only. */
+struct SemaphoreSubmit {
+  ISemaphore* semaphore = nullptr;
+  uint64_t    value     = 0;
+};
+
+/** Batched submission: the command lists execute in order as one queue submission. Waits
+ *  complete before the first list starts; signals and signalFence fire after the last. */
+struct SubmitInfo {
+  ICommandList* const*   commandLists     = nullptr;
+  uint32_t               commandListCount = 0;
+  SemaphoreSubmit const* waits            = nullptr;
+  uint32_t               waitCount        = 0;
+  SemaphoreSubmit const* signals          = nullptr;
+  uint32_t               signalCount      = 0;
+  IFence*                signalFence      = nullptr;
+};
+
 struct IQueue {
   virtual void Submit(ICommandList* cmdList,
                       IFence*       signalFence       = nullptr,
                       ISemaphore*   waitSemaphore     = nullptr,
                       ISemaphore*   signalSemaphore   = nullptr) = 0;
+  virtual void Submit(SubmitInfo const& info) = 0;
   virtual void WaitIdle() = 0;
   virtual ~IQueue() = default;
 };
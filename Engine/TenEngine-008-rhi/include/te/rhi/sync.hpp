@@ -1,5 +1,5 @@
 /** @file sync.hpp
- *  008-RHI ABI: IFence, ISemaphore, Wait, Signal.
+ *  008-RHI ABI: IFence, ISemaphore (binary and timeline), Wait, Signal.
  */
 #pragma once
 
@@ -12,11 +12,23 @@ struct IFence {
   virtual void Wait() = 0;
   virtual void Signal() = 0;
   virtual void Reset() = 0;
+  /** Non-blocking completion check (for polling once per frame instead of Wait). */
+  virtual bool IsSignaled() = 0;
   virtual ~IFence() = default;
 };
 
+/** GPU-GPU synchronization. Binary semaphores (CreateSemaphore) carry no value; timeline
+ *  semaphores (CreateTimelineSemaphore) hold a monotonically increasing 64-bit counter that
+ *  submissions wait for and signal (SemaphoreSubmit::value) and the CPU can wait on. */
 struct ISemaphore {
   virtual ~ISemaphore() = default;
+  virtual bool IsTimeline() const { return false; }
+  /** Timeline only: last value reached. */
+  virtual uint64_t GetCompletedValue() { return 0; }
+  /** Timeline only: block the calling thread until the counter reaches value. */
+  virtual void Wait(uint64_t value) { (void)value; }
+  /** Timeline only: set the counter to value from the CPU. */
+  virtual void Signal(uint64_t value) { (void)value; }
 };
 
 inline void Wait(IFence* f) {
@@ -15,6 +15,7 @@ enum class Backend : unsigned {
   D3D12  = 1,
   Metal  = 2,
   D3D11  = 3,
+  Null   = 4,  // Headless recording backend (no GPU); see backend_null.hpp
 };
 
 struct DeviceLimits {
@@ -14,6 +14,7 @@
 #include <te/rhi/sync.hpp>
 #include <te/rhi/types.hpp>
 #include <d3d11.h>
+#include <d3d11_1.h>
 #include <cstddef>
 #include <cstring>
 #include <vector>
@@ -40,6 +41,9 @@ struct FenceD3D11 final : IFence {
     if (event)
       SetEvent(event);
   }
+  bool IsSignaled() override {
+    return event && WaitForSingleObject(event, 0) == WAIT_OBJECT_0;
+  }
   void Reset() override {
     if (event)
       ResetEvent(event);
@@ -120,8 +124,22 @@ struct CommandListD3D11 final : ICommandList {
     }
     BufferD3D11* b = static_cast<BufferD3D11*>(buffer);
     if (!b->buffer) return;
-    ID3D11Buffer* cb = b->buffer;
-    (void)offset;  /* D3D11 VSSetConstantBuffers has no per-call offset; bind from buffer start */
+    BindConstantBuffer(slot, b->buffer, offset);
+  }
+  void BindConstantBuffer(uint32_t slot, ID3D11Buffer* cb, size_t offset) {
+    ID3D11DeviceContext1* ctx1 = nullptr;
+    if (offset != 0 &&
+        SUCCEEDED(deferredCtx->QueryInterface(__uuidof(ID3D11DeviceContext1), reinterpret_cast<void**>(&ctx1)))) {
+      /* D3D11.1 offsets count 16-byte constants (ring offsets are 256-byte aligned) */
+      UINT first = static_cast<UINT>(offset / 16);
+      UINT count = D3D11_REQ_CONSTANT_BUFFER_ELEMENT_COUNT;
+      ctx1->VSSetConstantBuffers1(slot, 1, &cb, &first, &count);
+      ctx1->PSSetConstantBuffers1(slot, 1, &cb, &first, &count);
+      ctx1->CSSetConstantBuffers1(slot, 1, &cb, &first, &count);
+      ctx1->Release();
+      return;
+    }
+    /* D3D11.0 VSSetConstantBuffers has no per-call offset; bind from buffer start */
     deferredCtx->VSSetConstantBuffers(slot, 1, &cb);
     deferredCtx->PSSetConstantBuffers(slot, 1, &cb);
     deferredCtx->CSSetConstantBuffers(slot, 1, &cb);
@@ -166,15 +184,25 @@ struct CommandListD3D11 final : ICommandList {
     BindDescriptorSet(0u, set);
   }
   void BindDescriptorSet(uint32_t setIndex, IDescriptorSet* set) override {
+    BindDescriptorSet(setIndex, set, nullptr, 0u);
+  }
+  void BindDescriptorSet(uint32_t setIndex, IDescriptorSet* set,
+                         uint32_t const* dynamicOffsets, uint32_t dynamicOffsetCount) override {
     if (setIndex != 0u) return;  /* D3D11 path only binds set 0 for now */
     if (!deferredCtx || !recording) return;
     if (!set) return;
     DescriptorSetD3D11* ds = static_cast<DescriptorSetD3D11*>(set);
     if (!ds->layout) return;
+    uint32_t dynamicIndex = 0;
     for (uint32_t i = 0; i < ds->layout->desc.bindingCount && i < DescriptorSetD3D11::kMaxBindings; ++i) {
       uint32_t t = ds->layout->desc.bindings[i].descriptorType;
       uint32_t b = ds->layout->desc.bindings[i].binding;
-      if (t == static_cast<uint32_t>(DescriptorType::UniformBuffer) && ds->bindingBuffer[b]) {
+      if (t == static_cast<uint32_t>(DescriptorType::UniformBufferDynamic)) {
+        size_t offset = ds->bindingOffset[b];
+        if (dynamicOffsets && dynamicIndex < dynamicOffsetCount) offset += dynamicOffsets[dynamicIndex];
+        ++dynamicIndex;
+        if (ds->bindingBuffer[b]) BindConstantBuffer(b, ds->bindingBuffer[b], offset);
+      } else if (t == static_cast<uint32_t>(DescriptorType::UniformBuffer) && ds->bindingBuffer[b]) {
         deferredCtx->VSSetConstantBuffers(b, 1, &ds->bindingBuffer[b]);
         deferredCtx->PSSetConstantBuffers(b, 1, &ds->bindingBuffer[b]);
       } else if ((t == static_cast<uint32_t>(DescriptorType::CombinedImageSampler) || t == static_cast<uint32_t>(DescriptorType::Sampler)) && (ds->bindingSrv[b] || ds->bindingSampler[b])) {
@@ -292,6 +320,7 @@ struct DescriptorSetD3D11 final : IDescriptorSet {
   ID3D11Device* device = nullptr;
   DescriptorSetLayoutD3D11* layout = nullptr;
   ID3D11Buffer* bindingBuffer[kMaxBindings] = {};
+  size_t bindingOffset[kMaxBindings] = {};
   ID3D11ShaderResourceView* bindingSrv[kMaxBindings] = {};
   ID3D11SamplerState* bindingSampler[kMaxBindings] = {};
   ~DescriptorSetD3D11() override {
@@ -343,13 +372,24 @@ struct QueueD3D11 final : IQueue {
               ISemaphore* waitSemaphore, ISemaphore* signalSemaphore) override {
     (void)waitSemaphore;
     (void)signalSemaphore;
-    if (!immediateContext || !cmdList) return;
-    CommandListD3D11* d11 = static_cast<CommandListD3D11*>(cmdList);
-    if (!d11->recordedList) return;
-    immediateContext->ExecuteCommandList(d11->recordedList, FALSE);
-    if (signalFence) {
+    SubmitInfo info{};
+    info.commandLists = &cmdList;
+    info.commandListCount = cmdList ? 1u : 0u;
+    info.signalFence = signalFence;
+    Submit(info);
+  }
+  /* One immediate context serializes all work, so semaphores (never created by this
+     backend) need no GPU-side handling */
+  void Submit(SubmitInfo const& info) override {
+    if (!immediateContext) return;
+    for (uint32_t i = 0; i < info.commandListCount; ++i) {
+      auto* d11 = static_cast<CommandListD3D11*>(info.commandLists[i]);
+      if (d11 && d11->recordedList)
+        immediateContext->ExecuteCommandList(d11->recordedList, FALSE);
+    }
+    if (info.signalFence) {
       immediateContext->Flush();
-      signalFence->Signal();
+      info.signalFence->Signal();
     }
   }
   void WaitIdle() override {
@@ -397,6 +437,11 @@ struct DeviceD3D11 final : IDevice {
     std::memcpy(static_cast<char*>(mapped.pData) + offset, data, size);
     context->Unmap(b->buffer, 0);
   }
+  void* MapBuffer(IBuffer* buf) override {
+    /* Dynamic buffers are only writable through WRITE_DISCARD maps on the immediate context. */
+    (void)buf;
+    return nullptr;
+  }
   IBuffer* CreateBuffer(BufferDesc const& desc) override {
     if (!device || desc.size == 0) return nullptr;
     D3D11_BUFFER_DESC bd = {};
@@ -630,6 +675,10 @@ struct DeviceD3D11 final : IDevice {
     return f;
   }
   ISemaphore* CreateSemaphore() override { return nullptr; }
+  ISemaphore* CreateTimelineSemaphore(uint64_t initialValue) override {
+    (void)initialValue;
+    return nullptr;
+  }
   void DestroyFence(IFence* f) override { delete static_cast<FenceD3D11*>(f); }
   void DestroySemaphore(ISemaphore* s) override { (void)s; }
   ISwapChain* CreateSwapChain(SwapChainDesc const& desc) override {
@@ -684,6 +733,7 @@ struct DeviceD3D11 final : IDevice {
       if (b >= DescriptorSetD3D11::kMaxBindings) continue;
       if (writes[i].buffer) {
         ds->bindingBuffer[b] = static_cast<BufferD3D11*>(writes[i].buffer)->buffer;
+        ds->bindingOffset[b] = writes[i].bufferOffset;
         if (ds->bindingBuffer[b]) ds->bindingBuffer[b]->AddRef();
       }
       if (writes[i].texture) {
@@ -45,6 +45,9 @@ struct FenceD3D12 final : IFence {
     WaitForSingleObject(event, INFINITE);
   }
   void Signal() override { (void)0; }
+  bool IsSignaled() override {
+    return fence && fence->GetCompletedValue() >= lastSignaledValue;
+  }
   void Reset() override {
     if (event) ResetEvent(event);
   }
@@ -53,15 +56,33 @@ struct FenceD3D12 final : IFence {
   }
 };
 
+/* Binary semaphores emulate signal/wait with an incrementing fence value; timeline
+   semaphores map their counter directly onto the fence value */
 struct SemaphoreD3D12 final : ISemaphore {
   ComPtr<ID3D12Fence> fence;
-  UINT64 value = 0;
+  UINT64 value = 0;  /* Binary: last value signaled by a submit */
+  bool timeline = false;
+  bool IsTimeline() const override { return timeline; }
+  uint64_t GetCompletedValue() override {
+    return (timeline && fence) ? fence->GetCompletedValue() : 0;
+  }
+  void Wait(uint64_t target) override {
+    if (!timeline || !fence || fence->GetCompletedValue() >= target) return;
+    fence->SetEventOnCompletion(target, nullptr);  /* Null event: blocks until reached */
+  }
+  void Signal(uint64_t target) override {
+    if (timeline && fence) fence->Signal(target);
+  }
   ~SemaphoreD3D12() override = default;
 };
 
 struct BufferD3D12 final : IBuffer {
   ComPtr<ID3D12Resource> resource;
-  ~BufferD3D12() override = default;
+  bool upload = false;
+  void* mapped = nullptr;  /* persistent mapping (upload heap), created on first MapBuffer */
+  ~BufferD3D12() override {
+    if (mapped && resource) resource->Unmap(0, nullptr);
+  }
 };
 
 struct TextureD3D12 final : ITexture {
@@ -180,7 +201,10 @@ struct CommandListD3D12 final : ICommandList {
     if (d->rootSignature) list->SetGraphicsRootSignature(d->rootSignature.Get());
   }
   void BindDescriptorSet(IDescriptorSet* set) override { BindDescriptorSet(0u, set); }
-  void BindDescriptorSet(uint32_t setIndex, IDescriptorSet* set) override { (void)setIndex; (void)set; /* TODO: D3D12 descriptor set binding */ }
+  void BindDescriptorSet(uint32_t setIndex, IDescriptorSet* set) override { BindDescriptorSet(setIndex, set, nullptr, 0u); }
+  void BindDescriptorSet(uint32_t setIndex, IDescriptorSet* set, uint32_t const* dynamicOffsets, uint32_t dynamicOffsetCount) override {
+    (void)setIndex; (void)set; (void)dynamicOffsets; (void)dynamicOffsetCount; /* TODO: D3D12 descriptor set binding */
+  }
   void BeginRenderPass(RenderPassDesc const& desc, IRenderPass* pass) override { (void)desc; (void)pass; }
   void NextSubpass() override {}
   void EndRenderPass() override {}
@@ -311,17 +335,43 @@ struct SwapChainD3D12 final : ISwapChain {
 
 struct QueueD3D12 final : IQueue {
   ComPtr<ID3D12CommandQueue> queue;
+  std::vector<ID3D12CommandList*> lists;  /* Scratch for ExecuteCommandLists */
+
   void Submit(ICommandList* cmdList, IFence* signalFence,
               ISemaphore* waitSemaphore, ISemaphore* signalSemaphore) override {
-    (void)waitSemaphore;
-    (void)signalSemaphore;
-    if (!queue || !cmdList) return;
-    CommandListD3D12* d12 = static_cast<CommandListD3D12*>(cmdList);
-    if (!d12->list) return;
-    ID3D12CommandList* lists[] = { d12->list.Get() };
-    queue->ExecuteCommandLists(1, lists);
-    if (signalFence) {
-      FenceD3D12* f = static_cast<FenceD3D12*>(signalFence);
+    SemaphoreSubmit const wait{waitSemaphore, 0};
+    SemaphoreSubmit const signal{signalSemaphore, 0};
+    SubmitInfo info{};
+    info.commandLists = &cmdList;
+    info.commandListCount = cmdList ? 1u : 0u;
+    info.waits = &wait;
+    info.waitCount = waitSemaphore ? 1u : 0u;
+    info.signals = &signal;
+    info.signalCount = signalSemaphore ? 1u : 0u;
+    info.signalFence = signalFence;
+    Submit(info);
+  }
+  void Submit(SubmitInfo const& info) override {
+    if (!queue) return;
+    for (uint32_t i = 0; i < info.waitCount; ++i) {
+      auto* sem = static_cast<SemaphoreD3D12*>(info.waits[i].semaphore);
+      if (!sem || !sem->fence) continue;
+      queue->Wait(sem->fence.Get(), sem->timeline ? info.waits[i].value : sem->value);
+    }
+    lists.clear();
+    for (uint32_t i = 0; i < info.commandListCount; ++i) {
+      auto* d12 = static_cast<CommandListD3D12*>(info.commandLists[i]);
+      if (d12 && d12->list) lists.push_back(d12->list.Get());
+    }
+    if (!lists.empty())
+      queue->ExecuteCommandLists(static_cast<UINT>(lists.size()), lists.data());
+    for (uint32_t i = 0; i < info.signalCount; ++i) {
+      auto* sem = static_cast<SemaphoreD3D12*>(info.signals[i].semaphore);
+      if (!sem || !sem->fence) continue;
+      queue->Signal(sem->fence.Get(), sem->timeline ? info.signals[i].value : ++sem->value);
+    }
+    if (info.signalFence) {
+      FenceD3D12* f = static_cast<FenceD3D12*>(info.signalFence);
       UINT64 v = f->nextValue++;
       f->lastSignaledValue = v;
       queue->Signal(f->fence.Get(), v);
@@ -381,6 +431,10 @@ struct DeviceD3D12 final : IDevice {
     if (!device || !buf || !data || size == 0) return;
     BufferD3D12* b = static_cast<BufferD3D12*>(buf);
     if (!b->resource) return;
+    if (b->mapped) {
+      std::memcpy(static_cast<char*>(b->mapped) + offset, data, size);
+      return;
+    }
     void* ptr = nullptr;
     D3D12_RANGE readRange = { 0, 0 };
     if (FAILED(b->resource->Map(0, &readRange, &ptr))) return;
@@ -388,6 +442,15 @@ struct DeviceD3D12 final : IDevice {
     D3D12_RANGE writeRange = { offset, offset + size };
     b->resource->Unmap(0, &writeRange);
   }
+  void* MapBuffer(IBuffer* buf) override {
+    BufferD3D12* b = static_cast<BufferD3D12*>(buf);
+    if (!b || !b->resource || !b->upload) return nullptr;
+    if (!b->mapped) {
+      D3D12_RANGE readRange = { 0, 0 };
+      if (FAILED(b->resource->Map(0, &readRange, &b->mapped))) b->mapped = nullptr;
+    }
+    return b->mapped;
+  }
   IBuffer* CreateBuffer(BufferDesc const& desc) override {
     if (!device || desc.size == 0) return nullptr;
     bool isUniform = (desc.usage & static_cast<uint32_t>(BufferUsage::Uniform)) != 0;
@@ -413,6 +476,7 @@ struct DeviceD3D12 final : IDevice {
       return nullptr;
     auto* b = new BufferD3D12();
     b->resource = res;
+    b->upload = isUniform;
     return b;
   }
   ITexture* CreateTexture(TextureDesc const& desc) override {
@@ -511,6 +575,16 @@ struct DeviceD3D12 final : IDevice {
     sem->value = 0;
     return sem;
   }
+  ISemaphore* CreateTimelineSemaphore(uint64_t initialValue) override {
+    if (!device) return nullptr;
+    ComPtr<ID3D12Fence> fence;
+    if (FAILED(device->CreateFence(initialValue, D3D12_FENCE_FLAG_NONE, IID_PPV_ARGS(&fence))))
+      return nullptr;
+    auto* sem = new SemaphoreD3D12();
+    sem->fence = fence;
+    sem->timeline = true;
+    return sem;
+  }
   void DestroyFence(IFence* f) override { delete static_cast<FenceD3D12*>(f); }
   void DestroySemaphore(ISemaphore* s) override {
     if (s) delete static_cast<SemaphoreD3D12*>(s);
@@ -1,6 +1,6 @@
 /** @file device.cpp
  *  Device factory: SelectBackend, GetSelectedBackend, CreateDevice, DestroyDevice.
- *  Dispatches per TE_RHI_VULKAN / TE_RHI_D3D12 / TE_RHI_D3D11 / TE_RHI_METAL.
+ *  Dispatches per TE_RHI_VULKAN / TE_RHI_D3D12 / TE_RHI_D3D11 / TE_RHI_METAL / TE_RHI_NULL.
  */
 #include <te/rhi/device.hpp>
 #include <te/rhi/types.hpp>
@@ -17,6 +17,9 @@
 #if defined(TE_RHI_METAL) && (defined(__APPLE__) && defined(__MACH__))
 #include <te/rhi/backend_metal.hpp>
 #endif
+#if defined(TE_RHI_NULL)
+#include <te/rhi/backend_null.hpp>
+#endif
 
 namespace te {
 namespace rhi {
@@ -50,6 +53,10 @@ IDevice* CreateDevice(Backend backend) {
 #if defined(TE_RHI_METAL) && (defined(__APPLE__) && defined(__MACH__))
   case Backend::Metal:
     return CreateDeviceMetal();
+#endif
+#if defined(TE_RHI_NULL)
+  case Backend::Null:
+    return CreateDeviceNull();
 #endif
   default:
     return nullptr;
@@ -82,6 +89,11 @@ void DestroyDevice(IDevice* device) {
   case Backend::Metal:
     DestroyDeviceMetal(device);
     return;
+#endif
+#if defined(TE_RHI_NULL)
+  case Backend::Null:
+    DestroyDeviceNull(device);
+    return;
 #endif
   default:
     break;
@@ -33,6 +33,13 @@ struct FenceMetal final : IFence {
     if (semaphore)
       dispatch_semaphore_signal(semaphore);
   }
+  bool IsSignaled() override {
+    // Probe without blocking; give the count back so a later Wait still succeeds
+    if (!semaphore || dispatch_semaphore_wait(semaphore, DISPATCH_TIME_NOW) != 0)
+      return false;
+    dispatch_semaphore_signal(semaphore);
+    return true;
+  }
   void Reset() override { /* dispatch_semaphore has no reset; no-op */ }
   ~FenceMetal() override {
     if (semaphore) {
@@ -245,7 +252,10 @@ struct CommandListMetal final : ICommandList {
       [renderEncoder setRenderPipelineState:boundGraphicsPSO];
   }
   void BindDescriptorSet(IDescriptorSet* set) override { BindDescriptorSet(0u, set); }
-  void BindDescriptorSet(uint32_t setIndex, IDescriptorSet* set) override { (void)setIndex; (void)set; /* TODO: Metal descriptor set binding */ }
+  void BindDescriptorSet(uint32_t setIndex, IDescriptorSet* set) override { BindDescriptorSet(setIndex, set, nullptr, 0u); }
+  void BindDescriptorSet(uint32_t setIndex, IDescriptorSet* set, uint32_t const* dynamicOffsets, uint32_t dynamicOffsetCount) override {
+    (void)setIndex; (void)set; (void)dynamicOffsets; (void)dynamicOffsetCount; /* TODO: Metal descriptor set binding */
+  }
 
   void BeginRenderPass(RenderPassDesc const& desc, IRenderPass* pass) override { (void)desc; (void)pass; }
   void NextSubpass() override {}
@@ -344,16 +354,34 @@ struct QueueMetal final : IQueue {
               ISemaphore* waitSemaphore, ISemaphore* signalSemaphore) override {
     (void)waitSemaphore;
     (void)signalSemaphore;
-    if (!queue || !cmdList) return;
-    CommandListMetal* metal = static_cast<CommandListMetal*>(cmdList);
-    if (!metal->buffer) return;
-    __block IFence* fence = signalFence;
-    if (fence) {
-      [metal->buffer addCompletedHandler:^(id<MTLCommandBuffer>) {
+    SubmitInfo info{};
+    info.commandLists = &cmdList;
+    info.commandListCount = cmdList ? 1u : 0u;
+    info.signalFence = signalFence;
+    Submit(info);
+  }
+
+  /* Buffers commit in order on one queue; the fence rides on the last buffer's completion */
+  void Submit(SubmitInfo const& info) override {
+    if (!queue) return;
+    CommandListMetal* last = nullptr;
+    for (uint32_t i = 0; i < info.commandListCount; ++i) {
+      CommandListMetal* metal = static_cast<CommandListMetal*>(info.commandLists[i]);
+      if (metal && metal->buffer) last = metal;
+    }
+    __block IFence* fence = info.signalFence;
+    /* Without lists the fence still orders after earlier work: signal from an empty buffer */
+    id<MTLCommandBuffer> fenceBuffer = last ? last->buffer : (fence ? [queue commandBuffer] : nil);
+    if (fence && fenceBuffer) {
+      [fenceBuffer addCompletedHandler:^(id<MTLCommandBuffer>) {
         if (fence) fence->Signal();
       }];
     }
-    [metal->buffer commit];
+    for (uint32_t i = 0; i < info.commandListCount; ++i) {
+      CommandListMetal* metal = static_cast<CommandListMetal*>(info.commandLists[i]);
+      if (metal && metal->buffer) [metal->buffer commit];
+    }
+    if (fenceBuffer && !last) [fenceBuffer commit];
   }
 
   void WaitIdle() override {
@@ -404,6 +432,12 @@ struct DeviceMetal final : IDevice {
     std::memcpy(static_cast<char*>(ptr) + offset, data, size);
   }
 
+  void* MapBuffer(IBuffer* buf) override {
+    BufferMetal* b = static_cast<BufferMetal*>(buf);
+    if (!b || !b->buffer) return nullptr;
+    return [b->buffer contents];
+  }
+
   IBuffer* CreateBuffer(BufferDesc const& desc) override {
     if (!device || desc.size == 0) return nullptr;
     /* Uniform / CPU-writable: use Shared so UpdateBuffer can write via contents. */
@@ -497,6 +531,10 @@ struct DeviceMetal final : IDevice {
   }
 
   ISemaphore* CreateSemaphore() override { return nullptr; }
+  ISemaphore* CreateTimelineSemaphore(uint64_t initialValue) override {
+    (void)initialValue;
+    return nullptr;
+  }
   void DestroyFence(IFence* f) override { delete static_cast<FenceMetal*>(f); }
   void DestroySemaphore(ISemaphore* s) override { (void)s; }
   ISwapChain* CreateSwapChain(SwapChainDesc const& desc) override {
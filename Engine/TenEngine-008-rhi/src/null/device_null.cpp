@@ -0,0 +1,793 @@
+/** @file device_null.cpp
+ *  Null (recording) backend: CreateDeviceNull, DestroyDeviceNull, CommandList stream,
+ *  CPU-memory resources, synchronous Queue, Fence, timeline Semaphore, SwapChain and counters.
+ */
+#if defined(TE_RHI_NULL)
+
+#include <te/rhi/backend_null.hpp>
+#include <te/rhi/command_list.hpp>
+#include <te/rhi/descriptor_set.hpp>
+#include <te/rhi/device.hpp>
+#include <te/rhi/queue.hpp>
+#include <te/rhi/pso.hpp>
+#include <te/rhi/resources.hpp>
+#include <te/rhi/swapchain.hpp>
+#include <te/rhi/sync.hpp>
+#include <te/rhi/types.hpp>
+#include <algorithm>
+#include <condition_variable>
+#include <cstddef>
+#include <cstring>
+#include <mutex>
+#include <vector>
+
+namespace te {
+namespace rhi {
+
+namespace {
+
+constexpr size_t kNullBytesPerTexel = 4u;
+
+struct DeviceNull;
+
+struct FenceNull final : IFence {
+  std::mutex mutex;
+  std::condition_variable cv;
+  bool signaled = false;
+  void Wait() override {
+    std::unique_lock<std::mutex> lock(mutex);
+    cv.wait(lock, [this]() { return signaled; });
+  }
+  void Signal() override {
+    {
+      std::lock_guard<std::mutex> lock(mutex);
+      signaled = true;
+    }
+    cv.notify_all();
+  }
+  bool IsSignaled() override {
+    std::lock_guard<std::mutex> lock(mutex);
+    return signaled;
+  }
+  void Reset() override {
+    std::lock_guard<std::mutex> lock(mutex);
+    signaled = false;
+  }
+};
+
+struct SemaphoreNull final : ISemaphore {};
+
+struct TimelineSemaphoreNull final : ISemaphore {
+  DeviceNull* device = nullptr;
+  std::mutex mutex;
+  std::condition_variable cv;
+  uint64_t value = 0;
+  bool IsTimeline() const override { return true; }
+  uint64_t GetCompletedValue() override {
+    std::lock_guard<std::mutex> lock(mutex);
+    return value;
+  }
+  void Wait(uint64_t target) override {
+    std::unique_lock<std::mutex> lock(mutex);
+    cv.wait(lock, [&]() { return value >= target; });
+  }
+  void Signal(uint64_t target) override;
+  /** Raise the counter (never lowers it) and wake CPU waiters. */
+  void Advance(uint64_t target) {
+    {
+      std::lock_guard<std::mutex> lock(mutex);
+      value = std::max(value, target);
+    }
+    cv.notify_all();
+  }
+};
+
+struct BufferNull final : IBuffer {
+  std::vector<unsigned char> data;
+  uint32_t usage = 0;
+};
+
+struct TextureNull final : ITexture {
+  std::vector<unsigned char> data;
+  TextureDesc desc{};
+  size_t RowPitch() const { return static_cast<size_t>(desc.width) * kNullBytesPerTexel; }
+  size_t SlicePitch() const { return RowPitch() * desc.height; }
+};
+
+struct SamplerNull final : ISampler {
+  SamplerDesc desc{};
+};
+
+struct PSONull final : IPSO {
+  bool compute = false;
+  std::vector<unsigned char> shader;  /* SetShader payload */
+};
+
+struct RenderPassNull final : IRenderPass {
+  RenderPassDesc desc{};
+  uint32_t GetSubpassColorAttachmentCount(uint32_t subpassIndex) const override {
+    if (desc.subpassCount == 0 || subpassIndex >= desc.subpassCount)
+      return desc.colorAttachmentCount ? desc.colorAttachmentCount : 1u;
+    return desc.subpasses[subpassIndex].colorAttachmentCount;
+  }
+  RenderPassDesc const* GetDesc() const override { return &desc; }
+};
+
+struct DescriptorSetLayoutNull final : IDescriptorSetLayout {
+  DescriptorSetLayoutDesc desc{};
+};
+
+struct DescriptorSetNull final : IDescriptorSet {
+  static constexpr uint32_t kMaxBindings = DescriptorSetLayoutDesc::kMaxBindings;
+  DescriptorSetLayoutNull* layout = nullptr;
+  DescriptorWrite bindings[kMaxBindings] = {};
+};
+
+struct CommandListNull final : ICommandList {
+  std::vector<RecordedCommand> commands;
+  bool recording = false;
+
+  RecordedCommand& Push(RecordedCommandType type) {
+    RecordedCommand c{};
+    c.type = type;
+    commands.push_back(c);
+    return commands.back();
+  }
+
+  void Begin() override {
+    commands.clear();
+    regions.clear();
+    recording = true;
+  }
+  void End() override { recording = false; }
+  void Draw(uint32_t vertex_count, uint32_t instance_count, uint32_t first_vertex, uint32_t first_instance) override {
+    RecordedCommand& c = Push(RecordedCommandType::Draw);
+    c.args[0] = vertex_count;
+    c.args[1] = instance_count;
+    c.args[2] = first_vertex;
+    c.args[4] = first_instance;
+  }
+  void DrawIndexed(uint32_t index_count, uint32_t instance_count, uint32_t first_index, int32_t vertex_offset, uint32_t first_instance) override {
+    RecordedCommand& c = Push(RecordedCommandType::DrawIndexed);
+    c.args[0] = index_count;
+    c.args[1] = instance_count;
+    c.args[2] = first_index;
+    c.args[3] = static_cast<uint32_t>(vertex_offset);
+    c.args[4] = first_instance;
+  }
+  void SetViewport(uint32_t first, uint32_t count, Viewport const* viewports) override {
+    (void)viewports;
+    RecordedCommand& c = Push(RecordedCommandType::SetViewport);
+    c.args[0] = first;
+    c.args[1] = count;
+  }
+  void SetScissor(uint32_t first, uint32_t count, ScissorRect const* scissors) override {
+    (void)scissors;
+    RecordedCommand& c = Push(RecordedCommandType::SetScissor);
+    c.args[0] = first;
+    c.args[1] = count;
+  }
+  void SetUniformBuffer(uint32_t slot, IBuffer* buffer, size_t offset) override {
+    RecordedCommand& c = Push(RecordedCommandType::SetUniformBuffer);
+    c.object = buffer;
+    c.args[0] = slot;
+    c.offset = offset;
+  }
+  void SetVertexBuffer(uint32_t slot, IBuffer* buffer, size_t offset, uint32_t stride) override {
+    RecordedCommand& c = Push(RecordedCommandType::SetVertexBuffer);
+    c.object = buffer;
+    c.args[0] = slot;
+    c.args[1] = stride;
+    c.offset = offset;
+  }
+  void SetIndexBuffer(IBuffer* buffer, size_t offset, uint32_t indexFormat) override {
+    RecordedCommand& c = Push(RecordedCommandType::SetIndexBuffer);
+    c.object = buffer;
+    c.args[1] = indexFormat;
+    c.offset = offset;
+  }
+  void SetGraphicsPSO(IPSO* pso) override {
+    Push(RecordedCommandType::SetGraphicsPSO).object = pso;
+  }
+  void BindDescriptorSet(IDescriptorSet* set) override {
+    BindDescriptorSet(0u, set);
+  }
+  void BindDescriptorSet(uint32_t setIndex, IDescriptorSet* set) override {
+    BindDescriptorSet(setIndex, set, nullptr, 0u);
+  }
+  void BindDescriptorSet(uint32_t setIndex, IDescriptorSet* set,
+                         uint32_t const* dynamicOffsets, uint32_t dynamicOffsetCount) override {
+    RecordedCommand& c = Push(RecordedCommandType::BindDescriptorSet);
+    c.object = set;
+    c.args[0] = setIndex;
+    c.args[1] = dynamicOffsets ? dynamicOffsetCount : 0u;
+    c.offset = dynamicOffsets && dynamicOffsetCount > 0 ? dynamicOffsets[0] : 0u;
+  }
+  void BeginRenderPass(RenderPassDesc const& desc, IRenderPass* pass) override {
+    RecordedCommand& c = Push(RecordedCommandType::BeginRenderPass);
+    c.object = desc.colorAttachmentCount > 0 ? desc.colorAttachments[0].texture : nullptr;
+    c.object2 = pass;
+    c.args[0] = desc.colorAttachmentCount;
+    c.args[1] = desc.colorAttachmentCount > 0 ? static_cast<uint32_t>(desc.colorAttachments[0].loadOp) : 0u;
+    c.args[2] = static_cast<uint32_t>(desc.depthStencilAttachment.loadOp);
+  }
+  void NextSubpass() override { Push(RecordedCommandType::NextSubpass); }
+  void EndRenderPass() override { Push(RecordedCommandType::EndRenderPass); }
+  void BeginOcclusionQuery(uint32_t queryIndex) override {
+    Push(RecordedCommandType::BeginOcclusionQuery).args[0] = queryIndex;
+  }
+  void EndOcclusionQuery(uint32_t queryIndex) override {
+    Push(RecordedCommandType::EndOcclusionQuery).args[0] = queryIndex;
+  }
+  void CopyBuffer(IBuffer* src, size_t srcOffset, IBuffer* dst, size_t dstOffset, size_t size) override {
+    RecordedCommand& c = Push(RecordedCommandType::CopyBuffer);
+    c.object = src;
+    c.object2 = dst;
+    c.srcOffset = srcOffset;
+    c.offset = dstOffset;
+    c.size = size;
+  }
+  void CopyBufferToTexture(IBuffer* src, size_t srcOffset, ITexture* dst, TextureRegion const& dstRegion) override {
+    RecordedCommand& c = Push(RecordedCommandType::CopyBufferToTexture);
+    c.object = src;
+    c.object2 = dst;
+    c.srcOffset = srcOffset;
+    c.size = static_cast<size_t>(dstRegion.width) * dstRegion.height * std::max(1u, dstRegion.depth) * kNullBytesPerTexel;
+    regions.push_back(dstRegion);
+  }
+  void CopyTextureToBuffer(ITexture* src, TextureRegion const& srcRegion, IBuffer* dst, size_t dstOffset) override {
+    RecordedCommand& c = Push(RecordedCommandType::CopyTextureToBuffer);
+    c.object = src;
+    c.object2 = dst;
+    c.offset = dstOffset;
+    c.size = static_cast<size_t>(srcRegion.width) * srcRegion.height * std::max(1u, srcRegion.depth) * kNullBytesPerTexel;
+    regions.push_back(srcRegion);
+  }
+  void BuildAccelerationStructure(RaytracingAccelerationStructureDesc const& desc, IBuffer* scratch, IBuffer* result) override {
+    RecordedCommand& c = Push(RecordedCommandType::BuildAccelerationStructure);
+    c.object = scratch;
+    c.object2 = result;
+    c.args[0] = desc.type;
+  }
+  void DispatchRays(DispatchRaysDesc const& desc) override {
+    RecordedCommand& c = Push(RecordedCommandType::DispatchRays);
+    c.args[0] = desc.width;
+    c.args[1] = desc.height;
+    c.args[2] = desc.depth;
+  }
+  void Dispatch(uint32_t x, uint32_t y, uint32_t z) override {
+    RecordedCommand& c = Push(RecordedCommandType::Dispatch);
+    c.args[0] = x;
+    c.args[1] = y;
+    c.args[2] = z;
+  }
+  /** CPU copy: performed immediately (as on other backends) and recorded for counting. */
+  void Copy(void const* src, void* dst, size_t size) override {
+    if (src && dst && size) std::memcpy(dst, src, size);
+    RecordedCommand& c = Push(RecordedCommandType::Copy);
+    c.object = src;
+    c.object2 = dst;
+    c.size = size;
+  }
+  void ResourceBarrier(uint32_t bufferBarrierCount, BufferBarrier const* bufferBarriers,
+                       uint32_t textureBarrierCount, TextureBarrier const* textureBarriers) override {
+    RecordedCommand& c = Push(RecordedCommandType::ResourceBarrier);
+    c.args[0] = bufferBarriers ? bufferBarrierCount : 0u;
+    c.args[1] = textureBarriers ? textureBarrierCount : 0u;
+  }
+
+  /* Texture regions of CopyBufferToTexture / CopyTextureToBuffer, in record order */
+  std::vector<TextureRegion> regions;
+};
+
+/** Copy between a buffer and a texture region (toTexture selects the direction). */
+void CopyRegion(BufferNull* buf, size_t bufOffset, TextureNull* tex, TextureRegion const& r, bool toTexture) {
+  if (!buf || !tex) return;
+  size_t const rowBytes = static_cast<size_t>(r.width) * kNullBytesPerTexel;
+  uint32_t const depth = std::max(1u, r.depth);
+  for (uint32_t z = 0; z < depth; ++z) {
+    for (uint32_t y = 0; y < r.height; ++y) {
+      size_t const texOffset = (r.z + z) * tex->SlicePitch() + (r.y + y) * tex->RowPitch() + r.x * kNullBytesPerTexel;
+      size_t const bOffset = bufOffset + (static_cast<size_t>(z) * r.height + y) * rowBytes;
+      if (texOffset + rowBytes > tex->data.size() || bOffset + rowBytes > buf->data.size()) return;
+      if (toTexture)
+        std::memcpy(tex->data.data() + texOffset, buf->data.data() + bOffset, rowBytes);
+      else
+        std::memcpy(buf->data.data() + bOffset, tex->data.data() + texOffset, rowBytes);
+    }
+  }
+}
+
+struct QueueNull final : IQueue {
+  DeviceNull* device = nullptr;
+  void Submit(ICommandList* cmdList, IFence* signalFence,
+              ISemaphore* waitSemaphore, ISemaphore* signalSemaphore) override;
+  void Submit(SubmitInfo const& info) override;
+  /* Submissions complete before Submit returns unless they wait on a timeline value not yet
+     signaled; those run as soon as the value is signaled */
+  void WaitIdle() override {}
+};
+
+/** A submission deferred until its timeline waits are satisfied (wait-before-signal). */
+struct PendingSubmitNull {
+  QueueNull* queue = nullptr;
+  std::vector<CommandListNull*> lists;
+  std::vector<SemaphoreSubmit> waits;
+  std::vector<SemaphoreSubmit> signals;
+  IFence* signalFence = nullptr;
+};
+
+struct SwapChainNull final : ISwapChain {
+  DeviceNull* device = nullptr;
+  std::vector<TextureNull*> backBuffers;
+  uint32_t current = 0;
+  uint32_t width = 0;
+  uint32_t height = 0;
+  uint32_t format = 0;
+  VSyncMode vsyncMode = VSyncMode::On;
+
+  bool Present() override;
+  ITexture* GetCurrentBackBuffer() override {
+    return backBuffers.empty() ? nullptr : backBuffers[current];
+  }
+  uint32_t GetCurrentBackBufferIndex() const override { return current; }
+  void Resize(uint32_t w, uint32_t h) override;
+  uint32_t GetWidth() const override { return width; }
+  uint32_t GetHeight() const override { return height; }
+  bool SetVSyncMode(VSyncMode mode) override { vsyncMode = mode; return true; }
+  VSyncMode GetVSyncMode() const override { return vsyncMode; }
+  bool SupportsTearing() const override { return true; }
+  ~SwapChainNull() override;
+};
+
+struct DeviceNull final : IDevice {
+  DeviceFeatures features{};
+  DeviceLimits limits{};
+  QueueNull queues[3];
+  mutable std::mutex countersMutex;
+  NullDeviceCounters counters{};
+  std::mutex submitMutex;
+  std::vector<PendingSubmitNull> pendingSubmits;  /* In submission order; guarded by submitMutex */
+  std::vector<SwapChainNull*> swapChains;  /* ABI has no DestroySwapChain; owned by the device */
+
+  void AddResourceBytes(size_t created, size_t destroyed) {
+    std::lock_guard<std::mutex> lock(countersMutex);
+    counters.liveResourceBytes += created;
+    counters.liveResourceBytes -= std::min<uint64_t>(counters.liveResourceBytes, destroyed);
+  }
+
+  TextureNull* NewTexture(TextureDesc const& desc) {
+    auto* t = new TextureNull();
+    t->desc = desc;
+    t->desc.depth = std::max(1u, desc.depth);
+    t->data.resize(t->SlicePitch() * t->desc.depth);
+    {
+      std::lock_guard<std::mutex> lock(countersMutex);
+      ++counters.texturesCreated;
+    }
+    AddResourceBytes(t->data.size(), 0);
+    return t;
+  }
+  void DeleteTexture(TextureNull* t) {
+    if (!t) return;
+    AddResourceBytes(0, t->data.size());
+    delete t;
+  }
+
+  /** Execute a submitted stream: perform copies and fold the commands into the counters. */
+  void Execute(CommandListNull* cmd) {
+    NullDeviceCounters delta{};
+    delta.commandLists = 1;
+    delta.commandsExecuted = cmd->commands.size();
+
+    // Bound state tracked per command list for redundancy detection
+    void const* boundPso = nullptr;
+    void const* boundIndex = nullptr;
+    void const* boundVertex[16] = {};
+    void const* boundUniform[16] = {};
+    void const* boundSet[8] = {};
+    size_t boundSetOffset[8] = {};
+    auto track = [&delta](void const*& slot, void const* object) {
+      ++delta.stateChanges;
+      if (slot == object && object) ++delta.redundantStateChanges;
+      slot = object;
+    };
+    void const* ignored = nullptr;  /* Slots beyond the tracked range are never redundant */
+
+    size_t region = 0;
+    for (RecordedCommand const& c : cmd->commands) {
+      switch (c.type) {
+      case RecordedCommandType::Draw:
+      case RecordedCommandType::DrawIndexed:
+        ++delta.drawCalls;
+        delta.instances += c.args[1];
+        break;
+      case RecordedCommandType::Dispatch:
+      case RecordedCommandType::DispatchRays:
+        ++delta.dispatches;
+        break;
+      case RecordedCommandType::BeginRenderPass:
+        ++delta.renderPasses;
+        break;
+      case RecordedCommandType::SetGraphicsPSO:
+        ++delta.psoChanges;
+        track(boundPso, c.object);
+        break;
+      case RecordedCommandType::SetIndexBuffer:
+        track(boundIndex, c.object);
+        break;
+      case RecordedCommandType::SetVertexBuffer:
+        ignored = nullptr;
+        track(c.args[0] < 16 ? boundVertex[c.args[0]] : ignored, c.object);
+        break;
+      case RecordedCommandType::SetUniformBuffer:
+        ignored = nullptr;
+        track(c.args[0] < 16 ? boundUniform[c.args[0]] : ignored, c.object);
+        break;
+      case RecordedCommandType::BindDescriptorSet:
+        ignored = nullptr;
+        if (c.args[0] < 8) {
+          if (boundSetOffset[c.args[0]] != c.offset) boundSet[c.args[0]] = nullptr;  /* New dynamic offset */
+          boundSetOffset[c.args[0]] = c.offset;
+        }
+        track(c.args[0] < 8 ? boundSet[c.args[0]] : ignored, c.object);
+        break;
+      case RecordedCommandType::ResourceBarrier:
+        delta.barriers += static_cast<uint64_t>(c.args[0]) + c.args[1];
+        break;
+      case RecordedCommandType::Copy:
+        delta.bytesUploaded += c.size;
+        break;
+      case RecordedCommandType::CopyBuffer: {
+        auto* src = static_cast<BufferNull*>(const_cast<void*>(c.object));
+        auto* dst = static_cast<BufferNull*>(const_cast<void*>(c.object2));
+        if (src && dst && c.srcOffset + c.size <= src->data.size() && c.offset + c.size <= dst->data.size())
+          std::memmove(dst->data.data() + c.offset, src->data.data() + c.srcOffset, c.size);
+        delta.bytesCopied += c.size;
+        break;
+      }
+      case RecordedCommandType::CopyBufferToTexture:
+        CopyRegion(static_cast<BufferNull*>(const_cast<void*>(c.object)), c.srcOffset,
+                   static_cast<TextureNull*>(const_cast<void*>(c.object2)), cmd->regions[region++], true);
+        delta.bytesCopied += c.size;
+        break;
+      case RecordedCommandType::CopyTextureToBuffer:
+        CopyRegion(static_cast<BufferNull*>(const_cast<void*>(c.object2)), c.offset,
+                   static_cast<TextureNull*>(const_cast<void*>(c.object)), cmd->regions[region++], false);
+        delta.bytesCopied += c.size;
+        break;
+      default:
+        break;
+      }
+    }
+
+    std::lock_guard<std::mutex> lock(countersMutex);
+    counters.commandLists += delta.commandLists;
+    counters.commandsExecuted += delta.commandsExecuted;
+    counters.drawCalls += delta.drawCalls;
+    counters.instances += delta.instances;
+    counters.dispatches += delta.dispatches;
+    counters.renderPasses += delta.renderPasses;
+    counters.stateChanges += delta.stateChanges;
+    counters.psoChanges += delta.psoChanges;
+    counters.redundantStateChanges += delta.redundantStateChanges;
+    counters.barriers += delta.barriers;
+    counters.bytesUploaded += delta.bytesUploaded;
+    counters.bytesCopied += delta.bytesCopied;
+  }
+
+  void Enqueue(PendingSubmitNull submit) {
+    std::lock_guard<std::mutex> lock(submitMutex);
+    pendingSubmits.push_back(std::move(submit));
+    RunReadySubmits();
+  }
+
+  /** Run pending submissions whose waits are met, in order per queue; repeats while one
+   *  submission's signals unblock another. Caller holds submitMutex. */
+  void RunReadySubmits() {
+    bool progress = true;
+    while (progress && !pendingSubmits.empty()) {
+      progress = false;
+      QueueNull const* blocked[3] = {};
+      size_t blockedCount = 0;
+      for (size_t i = 0; i < pendingSubmits.size();) {
+        PendingSubmitNull& p = pendingSubmits[i];
+        bool const queueBlocked = std::find(blocked, blocked + blockedCount, p.queue) != blocked + blockedCount;
+        bool ready = !queueBlocked;
+        for (size_t w = 0; ready && w < p.waits.size(); ++w) {
+          ISemaphore* sem = p.waits[w].semaphore;
+          ready = !sem || !sem->IsTimeline() || sem->GetCompletedValue() >= p.waits[w].value;
+        }
+        if (!ready) {
+          if (!queueBlocked && blockedCount < 3) blocked[blockedCount++] = p.queue;
+          ++i;
+          continue;
+        }
+        PendingSubmitNull submit = std::move(p);
+        pendingSubmits.erase(pendingSubmits.begin() + static_cast<std::ptrdiff_t>(i));
+        for (CommandListNull* cmd : submit.lists) Execute(cmd);
+        if (!submit.lists.empty()) {
+          std::lock_guard<std::mutex> lock(countersMutex);
+          ++counters.submits;
+        }
+        for (SemaphoreSubmit const& sig : submit.signals) {
+          if (sig.semaphore && sig.semaphore->IsTimeline())
+            static_cast<TimelineSemaphoreNull*>(sig.semaphore)->Advance(sig.value);
+        }
+        if (submit.signalFence) submit.signalFence->Signal();
+        progress = true;
+      }
+    }
+  }
+
+  Backend GetBackend() const override { return Backend::Null; }
+  IQueue* GetQueue(QueueType type, uint32_t index) override {
+    (void)index;
+    uint32_t const i = static_cast<uint32_t>(type);
+    return i < 3 ? &queues[i] : nullptr;
+  }
+  DeviceFeatures const& GetFeatures() const override { return features; }
+  DeviceLimits const& GetLimits() const override { return limits; }
+  ICommandList* CreateCommandList() override { return new CommandListNull(); }
+  void DestroyCommandList(ICommandList* cmd) override { delete static_cast<CommandListNull*>(cmd); }
+  IBuffer* CreateBuffer(BufferDesc const& desc) override {
+    if (desc.size == 0 || desc.size > limits.maxBufferSize) return nullptr;
+    auto* b = new BufferNull();
+    b->data.resize(desc.size);
+    b->usage = desc.usage;
+    {
+      std::lock_guard<std::mutex> lock(countersMutex);
+      ++counters.buffersCreated;
+    }
+    AddResourceBytes(desc.size, 0);
+    return b;
+  }
+  void UpdateBuffer(IBuffer* buf, size_t offset, void const* data, size_t size) override {
+    auto* b = static_cast<BufferNull*>(buf);
+    if (!b || !data || offset + size > b->data.size()) return;
+    std::memcpy(b->data.data() + offset, data, size);
+    std::lock_guard<std::mutex> lock(countersMutex);
+    counters.bytesUploaded += size;
+  }
+  void* MapBuffer(IBuffer* buf) override {
+    auto* b = static_cast<BufferNull*>(buf);
+    if (!b || !(b->usage & static_cast<uint32_t>(BufferUsage::Uniform)) || b->data.empty()) return nullptr;
+    return b->data.data();
+  }
+  ITexture* CreateTexture(TextureDesc const& desc) override {
+    if (desc.width == 0 || desc.height == 0 ||
+        desc.width > limits.maxTextureDimension2D || desc.height > limits.maxTextureDimension2D)
+      return nullptr;
+    return NewTexture(desc);
+  }
+  ISampler* CreateSampler(SamplerDesc const& desc) override {
+    auto* s = new SamplerNull();
+    s->desc = desc;
+    return s;
+  }
+  ViewHandle CreateView(ViewDesc const& desc) override { return reinterpret_cast<ViewHandle>(desc.resource); }
+  void DestroyBuffer(IBuffer* b) override {
+    if (!b) return;
+    AddResourceBytes(0, static_cast<BufferNull*>(b)->data.size());
+    delete static_cast<BufferNull*>(b);
+  }
+  void DestroyTexture(ITexture* t) override { DeleteTexture(static_cast<TextureNull*>(t)); }
+  void DestroySampler(ISampler* s) override { delete static_cast<SamplerNull*>(s); }
+  IPSO* CreateGraphicsPSO(GraphicsPSODesc const& desc) override {
+    return CreateGraphicsPSO(desc, nullptr, nullptr, 0u, nullptr);
+  }
+  IPSO* CreateGraphicsPSO(GraphicsPSODesc const& desc, IDescriptorSetLayout* layout) override {
+    return CreateGraphicsPSO(desc, layout, nullptr, 0u, nullptr);
+  }
+  IPSO* CreateGraphicsPSO(GraphicsPSODesc const& desc, IDescriptorSetLayout* layout,
+                          IRenderPass* pass, uint32_t subpassIndex,
+                          IDescriptorSetLayout* layoutSet1) override {
+    (void)desc;(void)layout;(void)pass;(void)subpassIndex;(void)layoutSet1;
+    std::lock_guard<std::mutex> lock(countersMutex);
+    ++counters.psosCreated;
+    return new PSONull();
+  }
+  IRenderPass* CreateRenderPass(RenderPassDesc const& desc) override {
+    auto* p = new RenderPassNull();
+    p->desc = desc;
+    return p;
+  }
+  void DestroyRenderPass(IRenderPass* pass) override { delete static_cast<RenderPassNull*>(pass); }
+  IPSO* CreateComputePSO(ComputePSODesc const& desc) override {
+    (void)desc;
+    auto* p = new PSONull();
+    p->compute = true;
+    std::lock_guard<std::mutex> lock(countersMutex);
+    ++counters.psosCreated;
+    return p;
+  }
+  void SetShader(IPSO* pso, void const* data, size_t size) override {
+    if (!pso || !data) return;
+    auto const* bytes = static_cast<unsigned char const*>(data);
+    static_cast<PSONull*>(pso)->shader.assign(bytes, bytes + size);
+  }
+  void Cache(IPSO* pso) override { (void)pso; }
+  void DestroyPSO(IPSO* pso) override { delete static_cast<PSONull*>(pso); }
+  IFence* CreateFence(bool initialSignaled) override {
+    auto* f = new FenceNull();
+    f->signaled = initialSignaled;
+    return f;
+  }
+  ISemaphore* CreateSemaphore() override { return new SemaphoreNull(); }
+  ISemaphore* CreateTimelineSemaphore(uint64_t initialValue) override {
+    auto* t = new TimelineSemaphoreNull();
+    t->device = this;
+    t->value = initialValue;
+    return t;
+  }
+  void DestroyFence(IFence* f) override { delete static_cast<FenceNull*>(f); }
+  void DestroySemaphore(ISemaphore* s) override {
+    if (s && s->IsTimeline())
+      delete static_cast<TimelineSemaphoreNull*>(s);
+    else
+      delete static_cast<SemaphoreNull*>(s);
+  }
+  ISwapChain* CreateSwapChain(SwapChainDesc const& desc) override {
+    if (desc.width == 0 || desc.height == 0) return nullptr;
+    auto* sc = new SwapChainNull();
+    sc->device = this;
+    sc->format = desc.format;
+    sc->vsyncMode = desc.vsyncMode;
+    sc->backBuffers.resize(std::max(1u, desc.bufferCount), nullptr);
+    sc->Resize(desc.width, desc.height);
+    swapChains.push_back(sc);
+    return sc;
+  }
+  IDescriptorSetLayout* CreateDescriptorSetLayout(DescriptorSetLayoutDesc const& desc) override {
+    auto* l = new DescriptorSetLayoutNull();
+    l->desc = desc;
+    return l;
+  }
+  IDescriptorSet* AllocateDescriptorSet(IDescriptorSetLayout* layout) override {
+    auto* s = new DescriptorSetNull();
+    s->layout = static_cast<DescriptorSetLayoutNull*>(layout);
+    return s;
+  }
+  void UpdateDescriptorSet(IDescriptorSet* set, DescriptorWrite const* writes, uint32_t writeCount) override {
+    (void)set;
+    if (!writes) return;
+    for (uint32_t i = 0; i < writeCount; ++i) {
+      auto* ds = static_cast<DescriptorSetNull*>(writes[i].dstSet);
+      if (ds && writes[i].binding < DescriptorSetNull::kMaxBindings)
+        ds->bindings[writes[i].binding] = writes[i];
+    }
+  }
+  void DestroyDescriptorSetLayout(IDescriptorSetLayout* layout) override {
+    delete static_cast<DescriptorSetLayoutNull*>(layout);
+  }
+  void DestroyDescriptorSet(IDescriptorSet* set) override {
+    delete static_cast<DescriptorSetNull*>(set);
+  }
+  ~DeviceNull() override;
+};
+
+void QueueNull::Submit(ICommandList* cmdList, IFence* signalFence,
+                       ISemaphore* waitSemaphore, ISemaphore* signalSemaphore) {
+  SemaphoreSubmit const wait{waitSemaphore, 0};
+  SemaphoreSubmit const signal{signalSemaphore, 0};
+  SubmitInfo info{};
+  info.commandLists = &cmdList;
+  info.commandListCount = cmdList ? 1u : 0u;
+  info.waits = &wait;
+  info.waitCount = waitSemaphore ? 1u : 0u;
+  info.signals = &signal;
+  info.signalCount = signalSemaphore ? 1u : 0u;
+  info.signalFence = signalFence;
+  Submit(info);
+}
+
+void QueueNull::Submit(SubmitInfo const& info) {
+  if (!device) return;
+  PendingSubmitNull submit;
+  submit.queue = this;
+  for (uint32_t i = 0; i < info.commandListCount; ++i) {
+    if (info.commandLists[i]) submit.lists.push_back(static_cast<CommandListNull*>(info.commandLists[i]));
+  }
+  if (info.waits) submit.waits.assign(info.waits, info.waits + info.waitCount);
+  if (info.signals) submit.signals.assign(info.signals, info.signals + info.signalCount);
+  submit.signalFence = info.signalFence;
+  device->Enqueue(std::move(submit));
+}
+
+void TimelineSemaphoreNull::Signal(uint64_t target) {
+  Advance(target);
+  std::lock_guard<std::mutex> lock(device->submitMutex);
+  device->RunReadySubmits();
+}
+
+bool SwapChainNull::Present() {
+  if (backBuffers.empty()) return false;
+  current = (current + 1) % static_cast<uint32_t>(backBuffers.size());
+  std::lock_guard<std::mutex> lock(device->countersMutex);
+  ++device->counters.presents;
+  return true;
+}
+
+void SwapChainNull::Resize(uint32_t w, uint32_t h) {
+  if (w == 0 || h == 0) return;
+  width = w;
+  height = h;
+  TextureDesc desc{};
+  desc.width = w;
+  desc.height = h;
+  desc.depth = 1;
+  desc.format = format;
+  for (auto*& bb : backBuffers) {
+    device->DeleteTexture(bb);
+    bb = device->NewTexture(desc);
+  }
+  current = 0;
+}
+
+SwapChainNull::~SwapChainNull() {
+  for (auto* bb : backBuffers) device->DeleteTexture(bb);
+}
+
+DeviceNull::~DeviceNull() {
+  for (auto* sc : swapChains) delete sc;
+}
+
+}  // namespace
+
+IDevice* CreateDeviceNull() {
+  auto* d = new DeviceNull();
+  for (auto& q : d->queues) q.device = d;
+  d->limits.maxBufferSize = 1024 * 1024 * 1024ull;
+  d->limits.maxTextureDimension2D = 16384u;
+  d->limits.maxTextureDimension3D = 2048u;
+  d->limits.minUniformBufferOffsetAlignment = 256;
+  d->features.maxTextureDimension2D = 16384u;
+  d->features.maxTextureDimension3D = 2048u;
+  return d;
+}
+
+void DestroyDeviceNull(IDevice* device) {
+  delete static_cast<DeviceNull*>(device);
+}
+
+RecordedCommand const* GetRecordedCommands(ICommandList const* cmd, size_t* outCount) {
+  auto const* c = static_cast<CommandListNull const*>(cmd);
+  if (outCount) *outCount = c ? c->commands.size() : 0u;
+  return (c && !c->commands.empty()) ? c->commands.data() : nullptr;
+}
+
+NullDeviceCounters GetNullDeviceCounters(IDevice const* device) {
+  if (!device || device->GetBackend() != Backend::Null) return NullDeviceCounters{};
+  auto const* d = static_cast<DeviceNull const*>(device);
+  std::lock_guard<std::mutex> lock(d->countersMutex);
+  return d->counters;
+}
+
+void ResetNullDeviceCounters(IDevice* device) {
+  if (!device || device->GetBackend() != Backend::Null) return;
+  auto* d = static_cast<DeviceNull*>(device);
+  std::lock_guard<std::mutex> lock(d->countersMutex);
+  NullDeviceCounters kept{};
+  kept.buffersCreated = d->counters.buffersCreated;
+  kept.texturesCreated = d->counters.texturesCreated;
+  kept.psosCreated = d->counters.psosCreated;
+  kept.liveResourceBytes = d->counters.liveResourceBytes;
+  d->counters = kept;
+}
+
+void* GetNullBufferData(IBuffer* buffer, size_t* outSize) {
+  auto* b = static_cast<BufferNull*>(buffer);
+  if (outSize) *outSize = b ? b->data.size() : 0u;
+  return b ? b->data.data() : nullptr;
+}
+
+void* GetNullTextureData(ITexture* texture, size_t* outSize) {
+  auto* t = static_cast<TextureNull*>(texture);
+  if (outSize) *outSize = t ? t->data.size() : 0u;
+  return t ? t->data.data() : nullptr;
+}
+
+}  // namespace rhi
+}  // namespace te
+
+#endif  // TE_RHI_NULL
@@ -1,6 +1,6 @@
 /** @file device_vulkan.cpp
  *  Vulkan backend: CreateDeviceVulkan, DestroyDeviceVulkan, DeviceVulkan, QueueVulkan,
- *  CommandListVulkan, FenceVulkan (T027).
+ *  CommandListVulkan, FenceVulkan, SemaphoreVulkan (binary and timeline) (T027).
  */
 #if defined(TE_RHI_VULKAN)
 
@@ -16,6 +16,7 @@
 #include <volk.h>
 #include <cstddef>
 #include <cstring>
+#include <mutex>
 #include <vector>
 
 namespace te {
@@ -31,6 +32,10 @@ struct FenceVulkan final : IFence {
       vkWaitForFences(device, 1, &fence, VK_TRUE, UINT64_MAX);
   }
   void Signal() override { (void)0; }
+  bool IsSignaled() override {
+    return fence != VK_NULL_HANDLE && device != VK_NULL_HANDLE &&
+           vkGetFenceStatus(device, fence) == VK_SUCCESS;
+  }
   void Reset() override {
     if (fence != VK_NULL_HANDLE && device != VK_NULL_HANDLE)
       vkResetFences(device, 1, &fence);
@@ -44,6 +49,31 @@ struct FenceVulkan final : IFence {
 struct SemaphoreVulkan final : ISemaphore {
   VkDevice device = VK_NULL_HANDLE;
   VkSemaphore semaphore = VK_NULL_HANDLE;
+  bool timeline = false;
+  bool IsTimeline() const override { return timeline; }
+  uint64_t GetCompletedValue() override {
+    uint64_t value = 0;
+    if (timeline && semaphore != VK_NULL_HANDLE)
+      vkGetSemaphoreCounterValue(device, semaphore, &value);
+    return value;
+  }
+  void Wait(uint64_t value) override {
+    if (!timeline || semaphore == VK_NULL_HANDLE) return;
+    VkSemaphoreWaitInfo wi = {};
+    wi.sType = VK_STRUCTURE_TYPE_SEMAPHORE_WAIT_INFO;
+    wi.semaphoreCount = 1;
+    wi.pSemaphores = &semaphore;
+    wi.pValues = &value;
+    vkWaitSemaphores(device, &wi, UINT64_MAX);
+  }
+  void Signal(uint64_t value) override {
+    if (!timeline || semaphore == VK_NULL_HANDLE) return;
+    VkSemaphoreSignalInfo si = {};
+    si.sType = VK_STRUCTURE_TYPE_SEMAPHORE_SIGNAL_INFO;
+    si.semaphore = semaphore;
+    si.value = value;
+    vkSignalSemaphore(device, &si);
+  }
   ~SemaphoreVulkan() override {
     if (semaphore != VK_NULL_HANDLE && device != VK_NULL_HANDLE)
       vkDestroySemaphore(device, semaphore, nullptr);
@@ -54,7 +84,11 @@ struct BufferVulkan final : IBuffer {
   VkDevice device = VK_NULL_HANDLE;
   VkBuffer buffer = VK_NULL_HANDLE;
   VkDeviceMemory memory = VK_NULL_HANDLE;
+  bool hostVisible = false;
+  void* mapped = nullptr;  /* persistent mapping, created on first MapBuffer */
   ~BufferVulkan() override {
+    if (mapped && device != VK_NULL_HANDLE)
+      vkUnmapMemory(device, memory);
     if (buffer != VK_NULL_HANDLE && device != VK_NULL_HANDLE)
       vkDestroyBuffer(device, buffer, nullptr);
     if (memory != VK_NULL_HANDLE && device != VK_NULL_HANDLE)
@@ -67,11 +101,13 @@ struct RenderPassVulkan final : IRenderPass {
   VkRenderPass pass = VK_NULL_HANDLE;
   uint32_t subpassColorCounts[kMaxSubpasses] = {};
   uint32_t subpassCount = 0;
+  RenderPassDesc desc{};
   uint32_t GetSubpassColorAttachmentCount(uint32_t subpassIndex) const override {
     if (subpassIndex >= subpassCount) return 1u;
     uint32_t n = subpassColorCounts[subpassIndex];
     return n > 0u ? n : 1u;
   }
+  RenderPassDesc const* GetDesc() const override { return &desc; }
   ~RenderPassVulkan() override {
     if (pass != VK_NULL_HANDLE && device != VK_NULL_HANDLE)
       vkDestroyRenderPass(device, pass, nullptr);
@@ -128,7 +164,7 @@ struct PSOVulkan final : IPSO {
 
 struct CommandListVulkan final : ICommandList {
   VkDevice device = VK_NULL_HANDLE;
-  VkCommandPool pool = VK_NULL_HANDLE;
+  VkCommandPool pool = VK_NULL_HANDLE;  /* Owned: lists may be recorded on different threads at once */
   VkCommandBuffer cmd = VK_NULL_HANDLE;
   VkDescriptorSet descriptorSet = VK_NULL_HANDLE;
   VkPipelineLayout pipelineLayout = VK_NULL_HANDLE;
@@ -233,12 +269,19 @@ struct CommandListVulkan final : ICommandList {
     BindDescriptorSet(0u, set);
   }
   void BindDescriptorSet(uint32_t setIndex, IDescriptorSet* set) override {
+    BindDescriptorSet(setIndex, set, nullptr, 0u);
+  }
+  void BindDescriptorSet(uint32_t setIndex, IDescriptorSet* set,
+                         uint32_t const* dynamicOffsets, uint32_t dynamicOffsetCount) override {
     if (cmd == VK_NULL_HANDLE || !recording || pipelineLayout == VK_NULL_HANDLE) return;
     if (!set) return;
     DescriptorSetVulkan* ds = static_cast<DescriptorSetVulkan*>(set);
     if (ds->set == VK_NULL_HANDLE) return;
-    vkCmdBindDescriptorSets(cmd, VK_PIPELINE_BIND_POINT_GRAPHICS, pipelineLayout, setIndex, 1, &ds->set, 0, nullptr);
-    vkCmdBindDescriptorSets(cmd, VK_PIPELINE_BIND_POINT_COMPUTE, pipelineLayout, setIndex, 1, &ds->set, 0, nullptr);
+    if (!dynamicOffsets) dynamicOffsetCount = 0;
+    vkCmdBindDescriptorSets(cmd, VK_PIPELINE_BIND_POINT_GRAPHICS, pipelineLayout, setIndex, 1, &ds->set,
+                            dynamicOffsetCount, dynamicOffsets);
+    vkCmdBindDescriptorSets(cmd, VK_PIPELINE_BIND_POINT_COMPUTE, pipelineLayout, setIndex, 1, &ds->set,
+                            dynamicOffsetCount, dynamicOffsets);
   }
   void BeginRenderPass(RenderPassDesc const& desc, IRenderPass* pass) override {
     if (cmd == VK_NULL_HANDLE || !recording || desc.colorAttachmentCount == 0) return;
@@ -257,7 +300,8 @@ struct CommandListVulkan final : ICommandList {
     if (rp == VK_NULL_HANDLE) return;
     currentRenderPassSubpassCount = subpassCount;
     currentSubpassIndex = 0;
-    bool hasDepth = desc.depthStencilAttachment.texture != nullptr;
+    // A depth format without a texture describes a compatible pass (e.g. for pipeline warm-up)
+    bool hasDepth = desc.depthStencilAttachment.texture != nullptr || desc.depthStencilAttachment.format != 0;
     uint32_t attachmentCount = desc.colorAttachmentCount + (hasDepth ? 1u : 0u);
     std::vector<VkImageView> views(attachmentCount);
     for (uint32_t i = 0; i < desc.colorAttachmentCount; ++i) {
@@ -413,8 +457,9 @@ struct CommandListVulkan final : ICommandList {
                            (uint32_t)imgBarriers.size(), imgBarriers.data());
   }
   ~CommandListVulkan() override {
-    if (cmd != VK_NULL_HANDLE && device != VK_NULL_HANDLE && pool != VK_NULL_HANDLE)
-      vkFreeCommandBuffers(device, pool, 1, &cmd);
+    if (device == VK_NULL_HANDLE || pool == VK_NULL_HANDLE) return;
+    if (cmd != VK_NULL_HANDLE) vkFreeCommandBuffers(device, pool, 1, &cmd);
+    vkDestroyCommandPool(device, pool, nullptr);
   }
 };
 
@@ -443,6 +488,7 @@ static VkDescriptorType ToVkDescriptorType(uint32_t type) {
     case static_cast<uint32_t>(DescriptorType::Sampler): return VK_DESCRIPTOR_TYPE_SAMPLER;
     case static_cast<uint32_t>(DescriptorType::StorageBuffer): return VK_DESCRIPTOR_TYPE_STORAGE_BUFFER;
     case static_cast<uint32_t>(DescriptorType::StorageImage): return VK_DESCRIPTOR_TYPE_STORAGE_IMAGE;
+    case static_cast<uint32_t>(DescriptorType::UniformBufferDynamic): return VK_DESCRIPTOR_TYPE_UNIFORM_BUFFER_DYNAMIC;
     default: return VK_DESCRIPTOR_TYPE_UNIFORM_BUFFER;
   }
 }
@@ -465,20 +511,77 @@ struct SwapChainVulkan final : ISwapChain {
 
 struct QueueVulkan final : IQueue {
   VkQueue queue = VK_NULL_HANDLE;
+  /* Scratch for building VkSubmitInfo; reused across submits */
+  std::vector<VkCommandBuffer> cmdBuffers;
+  std::vector<VkSemaphore> waitSems;
+  std::vector<uint64_t> waitValues;
+  std::vector<VkPipelineStageFlags> waitStages;
+  std::vector<VkSemaphore> signalSems;
+  std::vector<uint64_t> signalValues;
+
   void Submit(ICommandList* cmdList, IFence* signalFence,
               ISemaphore* waitSemaphore, ISemaphore* signalSemaphore) override {
-    (void)waitSemaphore;
-    (void)signalSemaphore;
-    if (queue == VK_NULL_HANDLE || !cmdList) return;
-    CommandListVulkan* vkCmd = static_cast<CommandListVulkan*>(cmdList);
-    if (vkCmd->cmd == VK_NULL_HANDLE) return;
+    SemaphoreSubmit const wait{waitSemaphore, 0};
+    SemaphoreSubmit const signal{signalSemaphore, 0};
+    SubmitInfo info{};
+    info.commandLists = &cmdList;
+    info.commandListCount = cmdList ? 1u : 0u;
+    info.waits = &wait;
+    info.waitCount = waitSemaphore ? 1u : 0u;
+    info.signals = &signal;
+    info.signalCount = signalSemaphore ? 1u : 0u;
+    info.signalFence = signalFence;
+    Submit(info);
+  }
+  void Submit(SubmitInfo const& info) override {
+    if (queue == VK_NULL_HANDLE) return;
+    cmdBuffers.clear();
+    for (uint32_t i = 0; i < info.commandListCount; ++i) {
+      auto* vkCmd = static_cast<CommandListVulkan*>(info.commandLists[i]);
+      if (vkCmd && vkCmd->cmd != VK_NULL_HANDLE) cmdBuffers.push_back(vkCmd->cmd);
+    }
+    bool anyTimeline = false;
+    waitSems.clear();
+    waitValues.clear();
+    waitStages.clear();
+    for (uint32_t i = 0; i < info.waitCount; ++i) {
+      auto* sem = static_cast<SemaphoreVulkan*>(info.waits[i].semaphore);
+      if (!sem || sem->semaphore == VK_NULL_HANDLE) continue;
+      anyTimeline = anyTimeline || sem->timeline;
+      waitSems.push_back(sem->semaphore);
+      waitValues.push_back(info.waits[i].value);  /* Ignored for binary semaphores */
+      waitStages.push_back(VK_PIPELINE_STAGE_ALL_COMMANDS_BIT);
+    }
+    signalSems.clear();
+    signalValues.clear();
+    for (uint32_t i = 0; i < info.signalCount; ++i) {
+      auto* sem = static_cast<SemaphoreVulkan*>(info.signals[i].semaphore);
+      if (!sem || sem->semaphore == VK_NULL_HANDLE) continue;
+      anyTimeline = anyTimeline || sem->timeline;
+      signalSems.push_back(sem->semaphore);
+      signalValues.push_back(info.signals[i].value);
+    }
+    if (cmdBuffers.empty() && waitSems.empty() && signalSems.empty() && !info.signalFence) return;
+
+    VkTimelineSemaphoreSubmitInfo tsi = {};
+    tsi.sType = VK_STRUCTURE_TYPE_TIMELINE_SEMAPHORE_SUBMIT_INFO;
+    tsi.waitSemaphoreValueCount = static_cast<uint32_t>(waitValues.size());
+    tsi.pWaitSemaphoreValues = waitValues.data();
+    tsi.signalSemaphoreValueCount = static_cast<uint32_t>(signalValues.size());
+    tsi.pSignalSemaphoreValues = signalValues.data();
     VkSubmitInfo si = {};
     si.sType = VK_STRUCTURE_TYPE_SUBMIT_INFO;
-    si.commandBufferCount = 1;
-    si.pCommandBuffers = &vkCmd->cmd;
+    si.pNext = anyTimeline ? &tsi : nullptr;
+    si.waitSemaphoreCount = static_cast<uint32_t>(waitSems.size());
+    si.pWaitSemaphores = waitSems.data();
+    si.pWaitDstStageMask = waitStages.data();
+    si.commandBufferCount = static_cast<uint32_t>(cmdBuffers.size());
+    si.pCommandBuffers = cmdBuffers.data();
+    si.signalSemaphoreCount = static_cast<uint32_t>(signalSems.size());
+    si.pSignalSemaphores = signalSems.data();
     VkFence sigFence = VK_NULL_HANDLE;
-    if (signalFence) {
-      FenceVulkan* f = static_cast<FenceVulkan*>(signalFence);
+    if (info.signalFence) {
+      FenceVulkan* f = static_cast<FenceVulkan*>(info.signalFence);
       sigFence = f->fence;
     }
     vkQueueSubmit(queue, 1, &si, sigFence);
@@ -495,15 +598,17 @@ struct DeviceVulkan final : IDevice {
   VkPhysicalDevice physicalDevice = VK_NULL_HANDLE;
   VkDevice   device   = VK_NULL_HANDLE;
   VkQueue    queue    = VK_NULL_HANDLE;
-  VkCommandPool commandPool = VK_NULL_HANDLE;
+  VkCommandPool commandPool = VK_NULL_HANDLE;  /* Not used by command lists, which own their pools */
   VkDescriptorSetLayout descriptorSetLayout = VK_NULL_HANDLE;
   VkDescriptorPool descriptorPool = VK_NULL_HANDLE;
   VkDescriptorPool dynamicDescriptorPool = VK_NULL_HANDLE;  /* for AllocateDescriptorSet with custom layouts */
+  std::mutex descriptorPoolMutex;  /* Descriptor pools are externally synchronized */
   VkPipelineLayout pipelineLayout = VK_NULL_HANDLE;
   VkRenderPass defaultRenderPass = VK_NULL_HANDLE;
   QueueVulkan* queueWrapper = nullptr;
   DeviceFeatures features{};
   DeviceLimits    limits{};
+  bool timelineSemaphores = false;  /* VkPhysicalDeviceVulkan12Features::timelineSemaphore enabled */
 
   Backend GetBackend() const override { return Backend::Vulkan; }
   IQueue* GetQueue(QueueType type, uint32_t index) override {
@@ -514,29 +619,45 @@ struct DeviceVulkan final : IDevice {
   DeviceFeatures const& GetFeatures() const override { return features; }
   DeviceLimits const& GetLimits() const override { return limits; }
   ICommandList* CreateCommandList() override {
-    if (device == VK_NULL_HANDLE || commandPool == VK_NULL_HANDLE) return nullptr;
+    if (device == VK_NULL_HANDLE) return nullptr;
     if (descriptorPool == VK_NULL_HANDLE || descriptorSetLayout == VK_NULL_HANDLE || pipelineLayout == VK_NULL_HANDLE)
       return nullptr;
+    /* A command pool is externally synchronized: one pool per list lets lists be recorded on
+     * different threads at the same time (020 parallel pass recording). */
+    VkCommandPoolCreateInfo pci = {};
+    pci.sType = VK_STRUCTURE_TYPE_COMMAND_POOL_CREATE_INFO;
+    pci.queueFamilyIndex = 0;
+    pci.flags = VK_COMMAND_POOL_CREATE_RESET_COMMAND_BUFFER_BIT;
+    VkCommandPool pool = VK_NULL_HANDLE;
+    if (vkCreateCommandPool(device, &pci, nullptr, &pool) != VK_SUCCESS) return nullptr;
     VkCommandBufferAllocateInfo ai = {};
     ai.sType = VK_STRUCTURE_TYPE_COMMAND_BUFFER_ALLOCATE_INFO;
-    ai.commandPool = commandPool;
+    ai.commandPool = pool;
     ai.level = VK_COMMAND_BUFFER_LEVEL_PRIMARY;
     ai.commandBufferCount = 1;
     VkCommandBuffer cb = VK_NULL_HANDLE;
-    if (vkAllocateCommandBuffers(device, &ai, &cb) != VK_SUCCESS) return nullptr;
+    if (vkAllocateCommandBuffers(device, &ai, &cb) != VK_SUCCESS) {
+      vkDestroyCommandPool(device, pool, nullptr);
+      return nullptr;
+    }
     VkDescriptorSetAllocateInfo dsAi = {};
     dsAi.sType = VK_STRUCTURE_TYPE_DESCRIPTOR_SET_ALLOCATE_INFO;
     dsAi.descriptorPool = descriptorPool;
     dsAi.descriptorSetCount = 1;
     dsAi.pSetLayouts = &descriptorSetLayout;
     VkDescriptorSet ds = VK_NULL_HANDLE;
-    if (vkAllocateDescriptorSets(device, &dsAi, &ds) != VK_SUCCESS) {
-      vkFreeCommandBuffers(device, commandPool, 1, &cb);
+    {
+      std::lock_guard<std::mutex> lock(descriptorPoolMutex);  /* Shared pool */
+      if (vkAllocateDescriptorSets(device, &dsAi, &ds) != VK_SUCCESS) ds = VK_NULL_HANDLE;
+    }
+    if (ds == VK_NULL_HANDLE) {
+      vkFreeCommandBuffers(device, pool, 1, &cb);
+      vkDestroyCommandPool(device, pool, nullptr);
       return nullptr;
     }
     auto* cl = new CommandListVulkan();
     cl->device = device;
-    cl->pool = commandPool;
+    cl->pool = pool;
     cl->cmd = cb;
     cl->descriptorSet = ds;
     cl->pipelineLayout = pipelineLayout;
@@ -550,11 +671,23 @@ struct DeviceVulkan final : IDevice {
     if (device == VK_NULL_HANDLE || !buf || !data || size == 0) return;
     BufferVulkan* b = static_cast<BufferVulkan*>(buf);
     if (b->buffer == VK_NULL_HANDLE || b->memory == VK_NULL_HANDLE) return;
+    if (b->mapped) {
+      /* Memory is already mapped persistently; mapping it again is invalid. */
+      std::memcpy(static_cast<unsigned char*>(b->mapped) + offset, data, size);
+      return;
+    }
     void* ptr = nullptr;
     if (vkMapMemory(device, b->memory, offset, size, 0, &ptr) != VK_SUCCESS) return;
     std::memcpy(ptr, data, size);
     vkUnmapMemory(device, b->memory);
   }
+  void* MapBuffer(IBuffer* buf) override {
+    BufferVulkan* b = static_cast<BufferVulkan*>(buf);
+    if (device == VK_NULL_HANDLE || !b || !b->hostVisible || b->memory == VK_NULL_HANDLE) return nullptr;
+    if (!b->mapped && vkMapMemory(device, b->memory, 0, VK_WHOLE_SIZE, 0, &b->mapped) != VK_SUCCESS)
+      b->mapped = nullptr;
+    return b->mapped;
+  }
   IBuffer* CreateBuffer(BufferDesc const& desc) override {
     if (device == VK_NULL_HANDLE || physicalDevice == VK_NULL_HANDLE || desc.size == 0)
       return nullptr;
@@ -624,6 +757,7 @@ struct DeviceVulkan final : IDevice {
     b->device = device;
     b->buffer = buf;
     b->memory = mem;
+    b->hostVisible = wantHostVisible;
     return b;
   }
   ITexture* CreateTexture(TextureDesc const& desc) override {
@@ -968,7 +1102,8 @@ struct DeviceVulkan final : IDevice {
   IRenderPass* CreateRenderPass(RenderPassDesc const& desc) override {
     if (device == VK_NULL_HANDLE) return nullptr;
     if (desc.colorAttachmentCount == 0) return nullptr;
-    bool hasDepth = desc.depthStencilAttachment.texture != nullptr;
+    // A depth format without a texture describes a compatible pass (e.g. for pipeline warm-up)
+    bool hasDepth = desc.depthStencilAttachment.texture != nullptr || desc.depthStencilAttachment.format != 0;
     uint32_t attachmentCount = desc.colorAttachmentCount + (hasDepth ? 1u : 0u);
     std::vector<VkAttachmentDescription> atts(attachmentCount);
     for (uint32_t i = 0; i < desc.colorAttachmentCount; ++i) {
@@ -1047,6 +1182,7 @@ struct DeviceVulkan final : IDevice {
     rpv->device = device;
     rpv->pass = vkRp;
     rpv->subpassCount = numSubpasses;
+    rpv->desc = desc;
     for (uint32_t s = 0; s < numSubpasses; ++s) {
       rpv->subpassColorCounts[s] = static_cast<uint32_t>(colorRefs[s].size());
     }
@@ -1079,6 +1215,23 @@ struct DeviceVulkan final : IDevice {
     sv->semaphore = vkSem;
     return sv;
   }
+  ISemaphore* CreateTimelineSemaphore(uint64_t initialValue) override {
+    if (device == VK_NULL_HANDLE || !timelineSemaphores) return nullptr;
+    VkSemaphoreTypeCreateInfo tci = {};
+    tci.sType = VK_STRUCTURE_TYPE_SEMAPHORE_TYPE_CREATE_INFO;
+    tci.semaphoreType = VK_SEMAPHORE_TYPE_TIMELINE;
+    tci.initialValue = initialValue;
+    VkSemaphoreCreateInfo sci = {};
+    sci.sType = VK_STRUCTURE_TYPE_SEMAPHORE_CREATE_INFO;
+    sci.pNext = &tci;
+    VkSemaphore vkSem = VK_NULL_HANDLE;
+    if (vkCreateSemaphore(device, &sci, nullptr, &vkSem) != VK_SUCCESS) return nullptr;
+    auto* sv = new SemaphoreVulkan();
+    sv->device = device;
+    sv->semaphore = vkSem;
+    sv->timeline = true;
+    return sv;
+  }
   void DestroyFence(IFence* f) override { delete static_cast<FenceVulkan*>(f); }
   void DestroySemaphore(ISemaphore* s) override {
     if (!s) return;
@@ -1130,8 +1283,11 @@ struct DeviceVulkan final : IDevice {
     ai.descriptorSetCount = 1;
     ai.pSetLayouts = &dsl->layout;
     VkDescriptorSet set = VK_NULL_HANDLE;
-    if (vkAllocateDescriptorSets(device, &ai, &set) != VK_SUCCESS)
-      return nullptr;
+    {
+      std::lock_guard<std::mutex> lock(descriptorPoolMutex);
+      if (vkAllocateDescriptorSets(device, &ai, &set) != VK_SUCCESS)
+        return nullptr;
+    }
     auto* ds = new DescriptorSetVulkan();
     ds->device = device;
     ds->pool = dynamicDescriptorPool;
@@ -1155,7 +1311,7 @@ struct DeviceVulkan final : IDevice {
         BufferVulkan* b = static_cast<BufferVulkan*>(writes[i].buffer);
         bufInfos[i].buffer = b->buffer;
         bufInfos[i].offset = writes[i].bufferOffset;
-        bufInfos[i].range = VK_WHOLE_SIZE;
+        bufInfos[i].range = writes[i].bufferRange ? writes[i].bufferRange : VK_WHOLE_SIZE;
         vkWrites[i].pBufferInfo = &bufInfos[i];
       } else if (writes[i].texture || writes[i].sampler) {
         imgInfos[i].imageLayout = VK_IMAGE_LAYOUT_SHADER_READ_ONLY_OPTIMAL;
@@ -1178,6 +1334,7 @@ struct DeviceVulkan final : IDevice {
     delete static_cast<DescriptorSetLayoutVulkan*>(layout);
   }
   void DestroyDescriptorSet(IDescriptorSet* set) override {
+    std::lock_guard<std::mutex> lock(descriptorPoolMutex);
     delete static_cast<DescriptorSetVulkan*>(set);
   }
   ~DeviceVulkan() override {
@@ -1229,8 +1386,24 @@ IDevice* CreateDeviceVulkan() {
   qci.queueFamilyIndex = 0;
   qci.queueCount = 1;
   qci.pQueuePriorities = qPriorities;
+  /* Timeline semaphores (core in 1.2) back batched cross-queue submits when available */
+  VkPhysicalDeviceProperties physProps = {};
+  vkGetPhysicalDeviceProperties(physDev, &physProps);
+  VkPhysicalDeviceVulkan12Features features12 = {};
+  features12.sType = VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_VULKAN_1_2_FEATURES;
+  if (physProps.apiVersion >= VK_API_VERSION_1_2) {
+    VkPhysicalDeviceFeatures2 features2 = {};
+    features2.sType = VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_FEATURES_2;
+    features2.pNext = &features12;
+    vkGetPhysicalDeviceFeatures2(physDev, &features2);
+  }
+  bool const timelineSemaphores = features12.timelineSemaphore == VK_TRUE;
+  VkPhysicalDeviceVulkan12Features enabled12 = {};
+  enabled12.sType = VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_VULKAN_1_2_FEATURES;
+  enabled12.timelineSemaphore = timelineSemaphores ? VK_TRUE : VK_FALSE;
   VkDeviceCreateInfo dci = {};
   dci.sType = VK_STRUCTURE_TYPE_DEVICE_CREATE_INFO;
+  dci.pNext = timelineSemaphores ? &enabled12 : nullptr;
   dci.queueCreateInfoCount = 1;
   dci.pQueueCreateInfos = &qci;
   VkDevice device = VK_NULL_HANDLE;
@@ -1287,12 +1460,13 @@ IDevice* CreateDeviceVulkan() {
   }
   VkDescriptorPoolSize dynamicPoolSizes[] = {
     { VK_DESCRIPTOR_TYPE_UNIFORM_BUFFER, 64 * 16 },
+    { VK_DESCRIPTOR_TYPE_UNIFORM_BUFFER_DYNAMIC, 64 * 4 },
     { VK_DESCRIPTOR_TYPE_COMBINED_IMAGE_SAMPLER, 64 * 8 }
   };
   VkDescriptorPoolCreateInfo dynamicPoolCi = {};
   dynamicPoolCi.sType = VK_STRUCTURE_TYPE_DESCRIPTOR_POOL_CREATE_INFO;
   dynamicPoolCi.maxSets = 64;
-  dynamicPoolCi.poolSizeCount = 2;
+  dynamicPoolCi.poolSizeCount = 3;
   dynamicPoolCi.pPoolSizes = dynamicPoolSizes;
   VkDescriptorPool dynamicDescriptorPool = VK_NULL_HANDLE;
   if (vkCreateDescriptorPool(device, &dynamicPoolCi, nullptr, &dynamicDescriptorPool) != VK_SUCCESS) {
@@ -1361,6 +1535,7 @@ IDevice* CreateDeviceVulkan() {
   d->dynamicDescriptorPool = dynamicDescriptorPool;
   d->pipelineLayout = pipelineLayout;
   d->defaultRenderPass = defaultRenderPass;
+  d->timelineSemaphores = timelineSemaphores;
   VkPhysicalDeviceProperties props = {};
   vkGetPhysicalDeviceProperties(physDev, &props);
   d->limits.maxBufferSize = 256 * 1024 * 1024ull;
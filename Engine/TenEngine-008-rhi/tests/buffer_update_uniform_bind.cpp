@@ -1,5 +1,5 @@
 /** @file buffer_update_uniform_bind.cpp
- *  US7 test: CreateBuffer(BufferUsage::Uniform), UpdateBuffer, SetUniformBuffer, Submit.
+ *  US7 test: CreateBuffer(BufferUsage::Uniform), UpdateBuffer, MapBuffer, SetUniformBuffer, Submit.
  *  Verifies no crash and that upstream/backend APIs are invoked.
  */
 #include <te/rhi/device.hpp>
@@ -30,6 +30,14 @@ int main() {
   unsigned char data[256];
   std::memset(data, 0xAB, sizeof(data));
   dev->UpdateBuffer(buf, 0, data, sizeof(data));
+  /* Persistent mapping (optional per backend): stable pointer, UpdateBuffer writes through it. */
+  if (void* mapped = dev->MapBuffer(buf)) {
+    assert(dev->MapBuffer(buf) == mapped);
+    assert(static_cast<unsigned char*>(mapped)[0] == 0xAB);
+    std::memset(mapped, 0x5A, 16);
+    dev->UpdateBuffer(buf, 0, data, 8);
+    assert(static_cast<unsigned char*>(mapped)[0] == 0xAB && static_cast<unsigned char*>(mapped)[8] == 0x5A);
+  }
   ICommandList* cmd = dev->CreateCommandList();
   if (!cmd) {
     dev->DestroyBuffer(buf);
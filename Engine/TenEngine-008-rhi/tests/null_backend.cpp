@@ -0,0 +1,209 @@
+/** @file null_backend.cpp
+ *  Null backend test: CPU-memory resources, recorded command stream, synchronous submit,
+ *  fences, timeline semaphores, swapchain and counters.
+ */
+#include <te/rhi/backend_null.hpp>
+#include <te/rhi/device.hpp>
+#include <te/rhi/command_list.hpp>
+#include <te/rhi/types.hpp>
+#include <cassert>
+#include <cstdio>
+#include <cstring>
+
+int main() {
+  using namespace te::rhi;
+  IDevice* dev = CreateDevice(Backend::Null);
+  assert(dev);
+  assert(dev->GetBackend() == Backend::Null);
+  IQueue* queue = dev->GetQueue(QueueType::Graphics, 0);
+  assert(queue);
+
+  // Buffers own real memory; UpdateBuffer writes it and counts uploaded bytes
+  BufferDesc bd{};
+  bd.size = 64;
+  bd.usage = static_cast<uint32_t>(BufferUsage::Vertex) | static_cast<uint32_t>(BufferUsage::CopyDst);
+  IBuffer* src = dev->CreateBuffer(bd);
+  IBuffer* dst = dev->CreateBuffer(bd);
+  assert(src && dst);
+  unsigned char bytes[64];
+  for (int i = 0; i < 64; ++i) bytes[i] = static_cast<unsigned char>(i);
+  dev->UpdateBuffer(src, 0, bytes, sizeof(bytes));
+  size_t size = 0;
+  assert(std::memcmp(GetNullBufferData(src, &size), bytes, 64) == 0 && size == 64);
+
+  IPSO* psoA = dev->CreateGraphicsPSO(GraphicsPSODesc{});
+  IPSO* psoB = dev->CreateGraphicsPSO(GraphicsPSODesc{});
+  assert(psoA && psoB);
+
+  TextureDesc td{};
+  td.width = 4;
+  td.height = 4;
+  td.depth = 1;
+  ITexture* tex = dev->CreateTexture(td);
+  assert(tex);
+
+  // Record: copies, a barrier, and draws with one redundant PSO bind
+  ICommandList* cmd = dev->CreateCommandList();
+  Begin(cmd);
+  cmd->CopyBuffer(src, 16, dst, 0, 16);
+  TextureRegion region{};
+  region.texture = tex;
+  region.width = 4;
+  region.height = 4;
+  region.depth = 1;
+  cmd->CopyBufferToTexture(src, 0, tex, region);
+  BufferBarrier bb{dst, 0, 64, ResourceState::CopyDst, ResourceState::VertexBuffer};
+  cmd->ResourceBarrier(1, &bb, 0, nullptr);
+  RenderPassDesc rp{};
+  rp.colorAttachmentCount = 1;
+  rp.colorAttachments[0].texture = tex;
+  rp.colorAttachments[0].loadOp = LoadOp::Clear;
+  cmd->BeginRenderPass(rp, nullptr);
+  cmd->SetGraphicsPSO(psoA);
+  cmd->SetVertexBuffer(0, dst, 0, 16);
+  cmd->Draw(3, 2);
+  cmd->SetGraphicsPSO(psoA);
+  cmd->Draw(3);
+  cmd->SetGraphicsPSO(psoB);
+  cmd->DrawIndexed(6);
+  cmd->EndRenderPass();
+  End(cmd);
+
+  size_t count = 0;
+  RecordedCommand const* stream = GetRecordedCommands(cmd, &count);
+  assert(stream && count == 12);
+  assert(stream[3].type == RecordedCommandType::BeginRenderPass);
+  assert(stream[3].args[1] == static_cast<uint32_t>(LoadOp::Clear));
+  assert(stream[4].type == RecordedCommandType::SetGraphicsPSO && stream[4].object == psoA);
+
+  // Nothing is executed before submit
+  assert(GetNullDeviceCounters(dev).drawCalls == 0);
+  IFence* fence = dev->CreateFence(false);
+  assert(!fence->IsSignaled());
+  Submit(cmd, queue, fence, nullptr, nullptr);
+  assert(fence->IsSignaled());  // Signaled by the synchronous submit
+  fence->Wait();
+
+  NullDeviceCounters c = GetNullDeviceCounters(dev);
+  assert(c.submits == 1);
+  assert(c.commandsExecuted == 12);
+  assert(c.drawCalls == 3);
+  assert(c.instances == 4);
+  assert(c.renderPasses == 1);
+  assert(c.psoChanges == 3);
+  assert(c.stateChanges == 4);
+  assert(c.redundantStateChanges == 1);
+  assert(c.barriers == 1);
+  assert(c.bytesUploaded == 64);
+  assert(c.bytesCopied == 16 + 64);
+  assert(c.buffersCreated == 2 && c.texturesCreated == 1 && c.psosCreated == 2);
+  assert(c.liveResourceBytes == 64 + 64 + 4 * 4 * 4);
+
+  // Copies moved real bytes
+  assert(std::memcmp(GetNullBufferData(dst, nullptr), bytes + 16, 16) == 0);
+  assert(std::memcmp(GetNullTextureData(tex, &size), bytes, 64) == 0 && size == 64);
+
+  ResetNullDeviceCounters(dev);
+  c = GetNullDeviceCounters(dev);
+  assert(c.drawCalls == 0 && c.bytesUploaded == 0 && c.buffersCreated == 2);
+
+  // Uniform buffers map persistently onto their memory; other usages do not map
+  assert(dev->MapBuffer(src) == nullptr);
+  bd.usage = static_cast<uint32_t>(BufferUsage::Uniform);
+  IBuffer* ub = dev->CreateBuffer(bd);
+  void* mapped = dev->MapBuffer(ub);
+  assert(mapped && mapped == GetNullBufferData(ub, nullptr) && dev->MapBuffer(ub) == mapped);
+  dev->DestroyBuffer(ub);
+
+  // A dynamic uniform set is written once; rebinding it at another offset is not redundant
+  DescriptorSetLayoutDesc ld{};
+  ld.bindings[0] = {0u, static_cast<uint32_t>(DescriptorType::UniformBufferDynamic), 1u};
+  ld.bindingCount = 1;
+  IDescriptorSetLayout* layout = dev->CreateDescriptorSetLayout(ld);
+  IDescriptorSet* set = dev->AllocateDescriptorSet(layout);
+  assert(layout && set);
+  DescriptorWrite write{};
+  write.dstSet = set;
+  write.type = static_cast<uint32_t>(DescriptorType::UniformBufferDynamic);
+  write.buffer = src;
+  write.bufferRange = 16;
+  dev->UpdateDescriptorSet(set, &write, 1);
+  ICommandList* setCmd = dev->CreateCommandList();
+  Begin(setCmd);
+  uint32_t const offsets[2] = {0u, 256u};
+  setCmd->BindDescriptorSet(0u, set, &offsets[0], 1u);
+  setCmd->BindDescriptorSet(0u, set, &offsets[1], 1u);
+  setCmd->BindDescriptorSet(0u, set, &offsets[1], 1u);
+  End(setCmd);
+  RecordedCommand const* binds = GetRecordedCommands(setCmd, &count);
+  assert(count == 3 && binds[1].args[1] == 1u && binds[1].offset == 256u);
+  ResetNullDeviceCounters(dev);
+  Submit(setCmd, queue);
+  c = GetNullDeviceCounters(dev);
+  assert(c.stateChanges == 3 && c.redundantStateChanges == 1);
+  dev->DestroyCommandList(setCmd);
+  dev->DestroyDescriptorSet(set);
+  dev->DestroyDescriptorSetLayout(layout);
+
+  // Swapchain without a window: back buffers rotate on Present
+  SwapChainDesc sd{};
+  sd.width = 8;
+  sd.height = 8;
+  sd.bufferCount = 2;
+  ISwapChain* sc = dev->CreateSwapChain(sd);
+  assert(sc && sc->GetCurrentBackBuffer());
+  ITexture* first = sc->GetCurrentBackBuffer();
+  assert(sc->Present());
+  assert(sc->GetCurrentBackBufferIndex() == 1 && sc->GetCurrentBackBuffer() != first);
+  assert(GetNullDeviceCounters(dev).presents == 1);
+
+  // Batched submit waiting on a timeline value not yet reached runs once another queue signals it
+  ISemaphore* timeline = dev->CreateTimelineSemaphore(1);
+  assert(timeline && timeline->IsTimeline() && timeline->GetCompletedValue() == 1);
+  ResetNullDeviceCounters(dev);
+  ICommandList* lists[2] = {cmd, cmd};
+  SemaphoreSubmit const wait3{timeline, 3};
+  SemaphoreSubmit const signal4{timeline, 4};
+  SubmitInfo info{};
+  info.commandLists = lists;
+  info.commandListCount = 2;
+  info.waits = &wait3;
+  info.waitCount = 1;
+  info.signals = &signal4;
+  info.signalCount = 1;
+  info.signalFence = fence;
+  fence->Reset();
+  queue->Submit(info);
+  assert(!fence->IsSignaled() && GetNullDeviceCounters(dev).commandLists == 0);
+  SubmitInfo release{};
+  release.signals = &wait3;
+  release.signalCount = 1;
+  dev->GetQueue(QueueType::Copy, 0)->Submit(release);
+  assert(fence->IsSignaled() && timeline->GetCompletedValue() == 4);
+  c = GetNullDeviceCounters(dev);
+  assert(c.submits == 1 && c.commandLists == 2 && c.drawCalls == 6);
+
+  // A CPU signal releases a waiting submission too
+  SemaphoreSubmit const wait5{timeline, 5};
+  info.waits = &wait5;
+  info.signalCount = 0;
+  fence->Reset();
+  queue->Submit(info);
+  assert(!fence->IsSignaled());
+  timeline->Signal(5);
+  assert(fence->IsSignaled());
+  timeline->Wait(5);
+  dev->DestroySemaphore(timeline);
+
+  dev->DestroyFence(fence);
+  dev->DestroyCommandList(cmd);
+  dev->DestroyTexture(tex);
+  dev->DestroyPSO(psoA);
+  dev->DestroyPSO(psoB);
+  dev->DestroyBuffer(src);
+  dev->DestroyBuffer(dst);
+  assert(GetNullDeviceCounters(dev).liveResourceBytes == 2 * 8 * 8 * 4);  // Swapchain back buffers
+  DestroyDevice(dev);
+  std::printf("null_backend passed\n");
+  return 0;
+}
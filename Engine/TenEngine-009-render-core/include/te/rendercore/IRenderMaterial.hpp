@@ -27,6 +27,8 @@ struct IRenderMaterial : IShadingState {
   virtual IUniformBuffer const* GetUniformBuffer() const = 0;
   virtual rhi::IDescriptorSet* GetDescriptorSet() = 0;
   virtual rhi::IDescriptorSet const* GetDescriptorSet() const = 0;
+  /** Dynamic offset of this frame's uniform block; pass it to BindDescriptorSet with GetDescriptorSet(). */
+  virtual std::uint32_t GetUniformBufferOffset() const = 0;
   virtual rhi::IPSO* GetGraphicsPSO(std::uint32_t subpassIndex = 0) = 0;
   virtual rhi::IPSO const* GetGraphicsPSO(std::uint32_t subpassIndex = 0) const = 0;
 
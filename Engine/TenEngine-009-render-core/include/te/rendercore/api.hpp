@@ -9,6 +9,7 @@
 #include <te/rendercore/shader_reflection.hpp>
 #include <te/rendercore/pass_protocol.hpp>
 #include <te/rendercore/uniform_buffer.hpp>
+#include <te/rendercore/pipeline_cache.hpp>
 #include <te/rendercore/IRenderPipelineState.hpp>
 #include <te/rendercore/IShaderEntry.hpp>
 #include <te/rendercore/IShadingState.hpp>
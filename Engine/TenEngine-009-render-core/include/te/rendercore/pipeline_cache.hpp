@@ -0,0 +1,92 @@
+/** @file pipeline_cache.hpp
+ *  009-RenderCore ABI: IPipelineCache (content-keyed graphics PSO cache with background compilation
+ *  and an on-disk usage log), GraphicsPipelineDesc, HashGraphicsPipeline, CreatePipelineCache.
+ */
+#pragma once
+
+#include <te/rhi/command_list.hpp>
+#include <te/rhi/descriptor_set.hpp>
+#include <te/rhi/pso.hpp>
+#include <cstddef>
+#include <cstdint>
+
+namespace te {
+namespace rhi {
+struct IDevice;
+}  // namespace rhi
+}  // namespace te
+
+namespace te {
+namespace rendercore {
+
+/** Content hash of everything that determines a graphics PSO; 0 = none. */
+using PipelineHash = uint64_t;
+
+/** Graphics PSO request. RHI pipelines have no vertex input state (shaders fetch vertices),
+ *  so the vertex layout is part of the vertex bytecode.
+ */
+struct GraphicsPipelineDesc {
+  te::rhi::GraphicsPSODesc pso{};
+  /** Set 0 / set 1 layouts by value; null = device default / none. The cache owns the RHI layouts. */
+  te::rhi::DescriptorSetLayoutDesc const* layout = nullptr;
+  te::rhi::DescriptorSetLayoutDesc const* layoutSet1 = nullptr;
+  /** Null = default single-subpass pass. Keyed by the formats of IRenderPass::GetDesc(); a pass
+   *  without a desc is keyed by identity, must outlive its compile and is not saved. */
+  te::rhi::IRenderPass* renderPass = nullptr;
+  uint32_t subpassIndex = 0;
+};
+
+/** Hash of shader bytecode, pipeline state, layouts and pass formats (load/store ops and
+ *  attachment textures do not affect compatibility and are ignored). */
+PipelineHash HashGraphicsPipeline(GraphicsPipelineDesc const& desc);
+
+struct PipelineCacheStats {
+  uint32_t pipelines = 0;  /**< Distinct pipelines known (ready, compiling or failed) */
+  uint32_t ready = 0;
+  uint32_t pending = 0;    /**< Queued or compiling */
+  uint32_t failed = 0;
+  uint64_t hits = 0;       /**< Requests that found an existing pipeline */
+  uint64_t misses = 0;
+};
+
+/** Graphics PSOs shared by every material of a device. Identical requests map to one PSO;
+ *  missing PSOs compile on the cache's worker threads while Acquire returns the fallback.
+ *  Save writes the pipelines seen (bytecode, state, layouts, pass formats) so Load can
+ *  precompile them on the next run. All members are thread-safe.
+ */
+struct IPipelineCache {
+  /** Returns the pipeline's hash and queues a background compile the first time it is seen; never blocks. */
+  virtual PipelineHash Request(GraphicsPipelineDesc const& desc) = 0;
+  /** Like Request, but compiles on the calling thread (or waits for a queued compile); nullptr on failure. */
+  virtual te::rhi::IPSO* RequestSync(GraphicsPipelineDesc const& desc, PipelineHash* outHash = nullptr) = 0;
+  /** Ready PSO of hash, else the fallback pipeline if ready, else nullptr. Records the use for Save. */
+  virtual te::rhi::IPSO* Acquire(PipelineHash hash) = 0;
+  virtual bool IsReady(PipelineHash hash) const = 0;
+  /** Pipeline Acquire returns while the requested one is compiling or failed; 0 clears. */
+  virtual void SetFallback(PipelineHash hash) = 0;
+  virtual PipelineHash GetFallback() const = 0;
+  /** Blocks until no compile is queued or running. */
+  virtual void WaitIdle() = 0;
+  /** Reads a file written by Save and queues its pipelines in recorded first-use order.
+   *  A file of another format, backend or version is ignored. Returns the number queued. */
+  virtual uint32_t Load(char const* path, uint64_t version = 0) = 0;
+  /** Writes every compiled pipeline (used ones first, by first use); false on I/O failure. */
+  virtual bool Save(char const* path, uint64_t version = 0) const = 0;
+  virtual PipelineCacheStats GetStats() const = 0;
+  virtual ~IPipelineCache() = default;
+};
+
+/** workerCount 0 = half the hardware threads, clamped to [1, 4]. */
+IPipelineCache* CreatePipelineCache(te::rhi::IDevice* device, uint32_t workerCount = 0);
+
+/** Waits for running compiles, then destroys every PSO, layout and pass the cache created. */
+void ReleasePipelineCache(IPipelineCache* cache);
+
+/** Shared cache of device, created on first use; RenderMaterial takes its PSOs from it. */
+IPipelineCache* GetDevicePipelineCache(te::rhi::IDevice* device);
+
+/** Releases the shared cache of device; call before destroying the device. */
+void ReleaseDevicePipelineCache(te::rhi::IDevice* device);
+
+}  // namespace rendercore
+}  // namespace te
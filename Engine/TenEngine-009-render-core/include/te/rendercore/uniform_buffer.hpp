@@ -1,11 +1,13 @@
 /** @file uniform_buffer.hpp
- *  009-RenderCore ABI: IUniformBuffer, CreateUniformBuffer, ReleaseUniformBuffer.
+ *  009-RenderCore ABI: IUniformBuffer, CreateUniformBuffer, ReleaseUniformBuffer;
+ *  IUniformRing (per-frame linear suballocator over one persistently mapped uniform buffer).
  */
 #pragma once
 
 #include <te/rendercore/types.hpp>
 #include <te/rendercore/uniform_layout.hpp>
 #include <cstddef>
+#include <cstdint>
 
 namespace te {
 namespace rhi {
@@ -18,16 +20,74 @@ struct IBuffer;
 namespace te {
 namespace rendercore {
 
+/** Aligned suballocation from an IUniformRing; valid until the GPU completes its frame. */
+struct UniformAllocation {
+  te::rhi::IBuffer* buffer = nullptr;
+  size_t offset = 0;  /**< Dynamic offset for SetUniformBuffer / DescriptorWrite::bufferOffset */
+  size_t size = 0;
+  void* cpuAddress = nullptr;  /**< Write target; no flush needed on persistently mapped rings */
+  bool IsValid() const { return buffer != nullptr; }
+};
+
+/** Linear ring over one large uniform buffer shared by all frames in flight.
+ *  Each frame allocates past the previous one. EndFrame tags the frame with the queue value
+ *  its submission signals; BeginFrame retires every frame whose value the GPU has reached.
+ *  Values are those of SubmitContext::GetQueueTimelineValue / GetQueueCompletedValue.
+ */
+struct IUniformRing {
+  /** Recycles frames whose EndFrame value is <= completedValue, then starts a new frame.
+   *  Not concurrent with Allocate. */
+  virtual void BeginFrame(uint64_t completedValue) = 0;
+  /** Blocks of the current frame stay reserved until BeginFrame sees submittedValue completed. */
+  virtual void EndFrame(uint64_t submittedValue) = 0;
+  /** Lock-free; safe from any recording thread. Invalid allocation when the ring is full. */
+  virtual UniformAllocation Allocate(size_t size) = 0;
+  /** Allocate and copy size bytes of data. */
+  virtual UniformAllocation Write(void const* data, size_t size) = 0;
+  /** Uploads the current frame when the device cannot map persistently; call before submit. */
+  virtual void Flush() = 0;
+  /** Incremented by every BeginFrame; allocations from an older frame may have been recycled. */
+  virtual uint64_t GetFrameIndex() const = 0;
+  virtual size_t GetAlignment() const = 0;
+  virtual size_t GetCapacity() const = 0;
+  /** Bytes allocated and not yet retired. */
+  virtual size_t GetUsedBytes() const = 0;
+  virtual te::rhi::IBuffer* GetBuffer() = 0;
+  virtual ~IUniformRing() = default;
+};
+
+/** Default ring size used by GetDeviceUniformRing. */
+constexpr size_t kDefaultUniformRingCapacity = 8u << 20;
+
+/** Creates a ring of capacity bytes (rounded up to the device's uniform offset alignment). */
+IUniformRing* CreateUniformRing(te::rhi::IDevice* device, size_t capacity = kDefaultUniformRingCapacity);
+
+void ReleaseUniformRing(IUniformRing* ring);
+
+/** Shared ring of device, created on first use; IUniformBuffer suballocates from it. */
+IUniformRing* GetDeviceUniformRing(te::rhi::IDevice* device);
+
+/** Releases the shared ring of device; call before destroying the device. */
+void ReleaseDeviceUniformRing(te::rhi::IDevice* device);
+
 struct IUniformBuffer {
   virtual void Update(void const* data, size_t size) = 0;
+  /** Writes [offset, offset + size). The first write of a frame takes a new block and copies the
+   *  whole CPU block into it; later writes in the same frame patch that block in place. */
+  virtual void UpdateRange(size_t offset, void const* data, size_t size) = 0;
   virtual void Bind(te::rhi::ICommandList* cmd, uint32_t slot) = 0;
+  /** Offset of the block last written for slot inside GetBuffer(). */
   virtual size_t GetRingBufferOffset(FrameSlotId slot) const = 0;
   virtual void SetCurrentFrameSlot(FrameSlotId slot) = 0;
   /** Underlying RHI buffer for descriptor set updates. */
   virtual te::rhi::IBuffer* GetBuffer() = 0;
+  /** Block size in bytes; the range of a UniformBufferDynamic descriptor on GetBuffer(). */
+  virtual size_t GetSize() const = 0;
   virtual ~IUniformBuffer() = default;
 };
 
+/** Suballocates from GetDeviceUniformRing(device); each Update takes a new block of the current frame.
+ *  While the ring is full the block is skipped: GetBuffer returns nullptr and Bind binds nothing. */
 IUniformBuffer* CreateUniformBuffer(IUniformLayout const* layout, te::rhi::IDevice* device);
 
 void ReleaseUniformBuffer(IUniformBuffer* buffer);
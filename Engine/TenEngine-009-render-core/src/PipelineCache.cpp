@@ -0,0 +1,770 @@
+/**
+ * @file PipelineCache.cpp
+ * @brief Implementation of IPipelineCache.
+ */
+
+#include <te/rendercore/pipeline_cache.hpp>
+#include <te/core/platform.h>
+#include <te/rhi/device.hpp>
+
+#include <algorithm>
+#include <atomic>
+#include <condition_variable>
+#include <cstdio>
+#include <cstring>
+#include <deque>
+#include <memory>
+#include <mutex>
+#include <shared_mutex>
+#include <string>
+#include <thread>
+#include <unordered_map>
+#include <vector>
+
+namespace te::rendercore {
+
+namespace {
+
+constexpr uint32_t kCacheMagic = 0x43504554u;  // "TEPC"
+constexpr uint32_t kCacheFormatVersion = 1;
+constexpr uint32_t kMaxWorkers = 4;
+
+constexpr uint64_t kFnvOffsetBasis = 14695981039346656037ull;
+constexpr uint64_t kFnvPrime = 1099511628211ull;
+
+uint64_t HashBytes(void const* data, size_t size, uint64_t hash = kFnvOffsetBasis) {
+  auto const* bytes = static_cast<uint8_t const*>(data);
+  for (size_t i = 0; i < size; ++i) {
+    hash = (hash ^ bytes[i]) * kFnvPrime;
+  }
+  return hash;
+}
+
+class ByteWriter {
+public:
+  explicit ByteWriter(std::vector<uint8_t>& out) : out_(out) {}
+  template <typename T>
+  void Put(T value) {
+    PutBytes(&value, sizeof(T));
+  }
+  void PutBytes(void const* data, size_t size) {
+    auto const* bytes = static_cast<uint8_t const*>(data);
+    out_.insert(out_.end(), bytes, bytes + size);
+  }
+  void PutBlob(std::vector<uint8_t> const& blob) {
+    Put<uint64_t>(blob.size());
+    PutBytes(blob.data(), blob.size());
+  }
+
+private:
+  std::vector<uint8_t>& out_;
+};
+
+/** Bounds-checked reader; every getter fails once the input is exhausted. */
+class ByteReader {
+public:
+  ByteReader(uint8_t const* data, size_t size) : cur_(data), end_(data + size) {}
+  template <typename T>
+  bool Get(T& value) {
+    return GetBytes(&value, sizeof(T));
+  }
+  bool GetBytes(void* out, size_t size) {
+    if (static_cast<size_t>(end_ - cur_) < size) return false;
+    std::memcpy(out, cur_, size);
+    cur_ += size;
+    return true;
+  }
+  bool GetBlob(std::vector<uint8_t>& out) {
+    uint64_t size = 0;
+    if (!Get(size) || static_cast<uint64_t>(end_ - cur_) < size) return false;
+    out.assign(cur_, cur_ + size);
+    cur_ += size;
+    return true;
+  }
+  bool AtEnd() const { return cur_ == end_; }
+
+private:
+  uint8_t const* cur_;
+  uint8_t const* end_;
+};
+
+enum class PassKind : uint8_t {
+  Default = 0,   // Backend's default single-subpass pass
+  Formats = 1,   // Rebuilt by the cache from the recorded formats
+  Identity = 2,  // Caller's pass object; not saved
+};
+
+// Field by field so struct padding never reaches a hash
+void WriteState(ByteWriter& w, rhi::GraphicsPipelineStateDesc const* state) {
+  w.Put<uint8_t>(state ? 1 : 0);
+  if (!state) return;
+  uint32_t const count = std::min(state->blendAttachmentCount, rhi::GraphicsPipelineStateDesc::kMaxBlendAttachments);
+  w.Put<uint32_t>(count);
+  for (uint32_t i = 0; i < count; ++i) {
+    rhi::BlendAttachmentDesc const& b = state->blendAttachments[i];
+    w.Put<uint8_t>(b.blendEnable ? 1 : 0);
+    w.Put<uint8_t>(static_cast<uint8_t>(b.srcColorBlend));
+    w.Put<uint8_t>(static_cast<uint8_t>(b.dstColorBlend));
+    w.Put<uint8_t>(static_cast<uint8_t>(b.colorBlendOp));
+    w.Put<uint8_t>(static_cast<uint8_t>(b.srcAlphaBlend));
+    w.Put<uint8_t>(static_cast<uint8_t>(b.dstAlphaBlend));
+    w.Put<uint8_t>(static_cast<uint8_t>(b.alphaBlendOp));
+    w.Put<uint8_t>(b.colorWriteMask);
+  }
+  w.Put<uint8_t>(state->depthStencil.depthTestEnable ? 1 : 0);
+  w.Put<uint8_t>(state->depthStencil.depthWriteEnable ? 1 : 0);
+  w.Put<uint8_t>(static_cast<uint8_t>(state->depthStencil.depthCompareOp));
+  w.Put<uint8_t>(static_cast<uint8_t>(state->rasterization.cullMode));
+  w.Put<uint8_t>(static_cast<uint8_t>(state->rasterization.frontFace));
+}
+
+bool ReadState(ByteReader& r, bool& hasState, rhi::GraphicsPipelineStateDesc& state) {
+  uint8_t present = 0;
+  if (!r.Get(present)) return false;
+  hasState = present != 0;
+  if (!hasState) return true;
+  uint32_t count = 0;
+  if (!r.Get(count) || count > rhi::GraphicsPipelineStateDesc::kMaxBlendAttachments) return false;
+  state.blendAttachmentCount = count;
+  uint8_t v[8];
+  for (uint32_t i = 0; i < count; ++i) {
+    if (!r.GetBytes(v, 8)) return false;
+    rhi::BlendAttachmentDesc& b = state.blendAttachments[i];
+    b.blendEnable = v[0] != 0;
+    b.srcColorBlend = static_cast<rhi::BlendFactor>(v[1]);
+    b.dstColorBlend = static_cast<rhi::BlendFactor>(v[2]);
+    b.colorBlendOp = static_cast<rhi::BlendOp>(v[3]);
+    b.srcAlphaBlend = static_cast<rhi::BlendFactor>(v[4]);
+    b.dstAlphaBlend = static_cast<rhi::BlendFactor>(v[5]);
+    b.alphaBlendOp = static_cast<rhi::BlendOp>(v[6]);
+    b.colorWriteMask = v[7];
+  }
+  if (!r.GetBytes(v, 5)) return false;
+  state.depthStencil.depthTestEnable = v[0] != 0;
+  state.depthStencil.depthWriteEnable = v[1] != 0;
+  state.depthStencil.depthCompareOp = static_cast<rhi::CompareOp>(v[2]);
+  state.rasterization.cullMode = static_cast<rhi::CullMode>(v[3]);
+  state.rasterization.frontFace = static_cast<rhi::FrontFace>(v[4]);
+  return true;
+}
+
+void WriteLayout(ByteWriter& w, rhi::DescriptorSetLayoutDesc const* layout) {
+  w.Put<uint8_t>(layout ? 1 : 0);
+  if (!layout) return;
+  uint32_t const count = std::min(layout->bindingCount, rhi::DescriptorSetLayoutDesc::kMaxBindings);
+  w.Put<uint32_t>(count);
+  for (uint32_t i = 0; i < count; ++i) {
+    w.Put<uint32_t>(layout->bindings[i].binding);
+    w.Put<uint32_t>(layout->bindings[i].descriptorType);
+    w.Put<uint32_t>(layout->bindings[i].descriptorCount);
+  }
+}
+
+bool ReadLayout(ByteReader& r, bool& hasLayout, rhi::DescriptorSetLayoutDesc& layout) {
+  uint8_t present = 0;
+  if (!r.Get(present)) return false;
+  hasLayout = present != 0;
+  if (!hasLayout) return true;
+  if (!r.Get(layout.bindingCount) || layout.bindingCount > rhi::DescriptorSetLayoutDesc::kMaxBindings) return false;
+  for (uint32_t i = 0; i < layout.bindingCount; ++i) {
+    if (!r.Get(layout.bindings[i].binding) || !r.Get(layout.bindings[i].descriptorType) ||
+        !r.Get(layout.bindings[i].descriptorCount)) {
+      return false;
+    }
+  }
+  return true;
+}
+
+/** Formats and subpass layout of desc; false when the pass cannot be rebuilt from them. */
+bool WritePassFormats(ByteWriter& w, rhi::RenderPassDesc const& desc) {
+  bool const hasDepth = desc.depthStencilAttachment.texture != nullptr || desc.depthStencilAttachment.format != 0;
+  if (hasDepth && desc.depthStencilAttachment.format == 0) return false;  // Inferred from the texture
+  uint32_t const colors = std::min(desc.colorAttachmentCount, rhi::kMaxColorAttachments);
+  uint32_t const subpasses = std::min(desc.subpassCount, rhi::kMaxSubpasses);
+  w.Put<uint32_t>(colors);
+  for (uint32_t i = 0; i < colors; ++i) {
+    w.Put<uint32_t>(desc.colorAttachments[i].format);
+  }
+  w.Put<uint32_t>(hasDepth ? desc.depthStencilAttachment.format : 0u);
+  w.Put<uint32_t>(subpasses);
+  for (uint32_t s = 0; s < subpasses; ++s) {
+    rhi::SubpassDesc const& sp = desc.subpasses[s];
+    uint32_t const n = std::min(sp.colorAttachmentCount, rhi::kMaxColorAttachments);
+    w.Put<uint32_t>(n);
+    for (uint32_t c = 0; c < n; ++c) {
+      w.Put<uint32_t>(sp.colorAttachmentIndices[c]);
+    }
+    w.Put<uint32_t>(sp.depthStencilAttachmentIndex);
+  }
+  return true;
+}
+
+bool ReadPassFormats(ByteReader& r, rhi::RenderPassDesc& desc) {
+  desc = rhi::RenderPassDesc{};
+  if (!r.Get(desc.colorAttachmentCount) || desc.colorAttachmentCount > rhi::kMaxColorAttachments) return false;
+  for (uint32_t i = 0; i < desc.colorAttachmentCount; ++i) {
+    if (!r.Get(desc.colorAttachments[i].format)) return false;
+  }
+  if (!r.Get(desc.depthStencilAttachment.format)) return false;
+  if (!r.Get(desc.subpassCount) || desc.subpassCount > rhi::kMaxSubpasses) return false;
+  for (uint32_t s = 0; s < desc.subpassCount; ++s) {
+    rhi::SubpassDesc& sp = desc.subpasses[s];
+    if (!r.Get(sp.colorAttachmentCount) || sp.colorAttachmentCount > rhi::kMaxColorAttachments) return false;
+    for (uint32_t c = 0; c < sp.colorAttachmentCount; ++c) {
+      if (!r.Get(sp.colorAttachmentIndices[c])) return false;
+    }
+    if (!r.Get(sp.depthStencilAttachmentIndex)) return false;
+  }
+  return true;
+}
+
+using Blob = std::shared_ptr<std::vector<uint8_t> const>;
+
+/** Canonical key of a request: pipeline hash = HashBytes(key). */
+struct PipelineKey {
+  std::vector<uint8_t> bytes;
+  uint64_t vsHash{0};
+  uint64_t fsHash{0};
+  PassKind passKind{PassKind::Default};
+  uint64_t passHash{0};  // HashBytes(passFormats) or the pass address
+  std::vector<uint8_t> passFormats;
+};
+
+PipelineKey BuildKey(GraphicsPipelineDesc const& desc) {
+  PipelineKey key;
+  rhi::GraphicsPSODesc const& pso = desc.pso;
+  key.vsHash = pso.vertex_shader ? HashBytes(pso.vertex_shader, pso.vertex_shader_size) : 0;
+  key.fsHash = pso.fragment_shader ? HashBytes(pso.fragment_shader, pso.fragment_shader_size) : 0;
+
+  if (desc.renderPass) {
+    rhi::RenderPassDesc const* passDesc = desc.renderPass->GetDesc();
+    ByteWriter pw(key.passFormats);
+    if (passDesc && WritePassFormats(pw, *passDesc)) {
+      key.passKind = PassKind::Formats;
+      key.passHash = HashBytes(key.passFormats.data(), key.passFormats.size());
+    } else {
+      key.passKind = PassKind::Identity;
+      key.passHash = reinterpret_cast<uintptr_t>(desc.renderPass);
+      key.passFormats.clear();
+    }
+  }
+
+  ByteWriter w(key.bytes);
+  w.Put<uint64_t>(key.vsHash);
+  w.Put<uint64_t>(pso.vertex_shader ? pso.vertex_shader_size : 0);
+  w.Put<uint64_t>(key.fsHash);
+  w.Put<uint64_t>(pso.fragment_shader ? pso.fragment_shader_size : 0);
+  WriteState(w, pso.pipelineState);
+  WriteLayout(w, desc.layout);
+  WriteLayout(w, desc.layoutSet1);
+  w.Put<uint8_t>(static_cast<uint8_t>(key.passKind));
+  w.Put<uint64_t>(key.passHash);
+  w.Put<uint32_t>(desc.subpassIndex);
+  return key;
+}
+
+enum class EntryStatus : uint8_t { Queued, Compiling, Ready, Failed };
+
+struct PipelineEntry {
+  PipelineHash hash{0};
+  std::vector<uint8_t> key;
+  Blob vs;
+  Blob fs;
+  bool hasState{false};
+  rhi::GraphicsPipelineStateDesc state{};
+  rhi::IDescriptorSetLayout* layout{nullptr};  // Owned by the cache's layout table
+  rhi::IDescriptorSetLayout* layoutSet1{nullptr};
+  rhi::IRenderPass* pass{nullptr};
+  PassKind passKind{PassKind::Default};
+  uint64_t passHash{0};
+  uint32_t subpassIndex{0};
+  uint64_t sequence{0};                 // Insertion order
+  std::atomic<uint64_t> firstUse{0};    // 0 = never acquired
+  std::atomic<EntryStatus> status{EntryStatus::Queued};
+  rhi::IPSO* pso{nullptr};              // Published by status == Ready
+};
+
+}  // namespace
+
+class PipelineCacheImpl : public IPipelineCache {
+public:
+  ~PipelineCacheImpl() override {
+    {
+      std::lock_guard<std::mutex> lock(queueMutex_);
+      stop_ = true;
+      pending_ -= static_cast<uint32_t>(queue_.size());
+      queue_.clear();
+    }
+    queueCv_.notify_all();
+    for (auto& worker : workers_) {
+      worker.join();
+    }
+    if (!device_) return;
+    for (auto& [hash, entry] : entries_) {
+      if (entry->pso) device_->DestroyPSO(entry->pso);
+    }
+    for (auto& [hash, layout] : layouts_) {
+      device_->DestroyDescriptorSetLayout(layout);
+    }
+    for (auto& [hash, pass] : passes_) {
+      device_->DestroyRenderPass(pass.object);
+    }
+  }
+
+  bool Initialize(rhi::IDevice* device, uint32_t workerCount) {
+    if (!device) return false;
+    device_ = device;
+    if (workerCount == 0) {
+      workerCount = std::clamp(std::thread::hardware_concurrency() / 2, 1u, kMaxWorkers);
+    }
+    for (uint32_t i = 0; i < workerCount; ++i) {
+      workers_.emplace_back([this]() { WorkerLoop(); });
+    }
+    return true;
+  }
+
+  PipelineHash Request(GraphicsPipelineDesc const& desc) override {
+    PipelineEntry* entry = FindOrInsert(desc, true);
+    return entry ? entry->hash : 0;
+  }
+
+  rhi::IPSO* RequestSync(GraphicsPipelineDesc const& desc, PipelineHash* outHash) override {
+    PipelineEntry* entry = FindOrInsert(desc, false);
+    if (outHash) *outHash = entry ? entry->hash : 0;
+    if (!entry) return nullptr;
+
+    bool compileHere = false;
+    {
+      std::unique_lock<std::mutex> lock(queueMutex_);
+      if (entry->status.load(std::memory_order_acquire) == EntryStatus::Queued) {
+        // Not picked up by a worker yet: take it off the queue and compile here
+        auto it = std::find(queue_.begin(), queue_.end(), entry);
+        if (it != queue_.end()) queue_.erase(it);
+        entry->status.store(EntryStatus::Compiling, std::memory_order_relaxed);
+        compileHere = true;
+      } else {
+        idleCv_.wait(lock, [entry]() { return entry->status.load(std::memory_order_acquire) != EntryStatus::Compiling; });
+      }
+    }
+    if (compileHere) {
+      Compile(*entry);
+      FinishCompile();
+    }
+    return entry->status.load(std::memory_order_acquire) == EntryStatus::Ready ? entry->pso : nullptr;
+  }
+
+  rhi::IPSO* Acquire(PipelineHash hash) override {
+    std::shared_lock<std::shared_mutex> lock(mutex_);
+    if (PipelineEntry* entry = Find(hash)) {
+      uint64_t expected = 0;
+      if (entry->firstUse.load(std::memory_order_relaxed) == 0) {
+        entry->firstUse.compare_exchange_strong(expected, useClock_.fetch_add(1, std::memory_order_relaxed) + 1,
+                                                std::memory_order_relaxed);
+      }
+      if (entry->status.load(std::memory_order_acquire) == EntryStatus::Ready) return entry->pso;
+    }
+    PipelineEntry* fallback = Find(fallback_.load(std::memory_order_relaxed));
+    if (fallback && fallback->status.load(std::memory_order_acquire) == EntryStatus::Ready) return fallback->pso;
+    return nullptr;
+  }
+
+  bool IsReady(PipelineHash hash) const override {
+    std::shared_lock<std::shared_mutex> lock(mutex_);
+    PipelineEntry const* entry = Find(hash);
+    return entry && entry->status.load(std::memory_order_acquire) == EntryStatus::Ready;
+  }
+
+  void SetFallback(PipelineHash hash) override {
+    fallback_.store(hash, std::memory_order_relaxed);
+  }
+
+  PipelineHash GetFallback() const override {
+    return fallback_.load(std::memory_order_relaxed);
+  }
+
+  void WaitIdle() override {
+    std::unique_lock<std::mutex> lock(queueMutex_);
+    idleCv_.wait(lock, [this]() { return pending_ == 0; });
+  }
+
+  uint32_t Load(char const* path, uint64_t version) override {
+    if (!path) return 0;
+    auto file = te::core::FileRead(path);
+    if (!file) return 0;
+
+    ByteReader r(file->data(), file->size());
+    uint32_t magic = 0, format = 0, backend = 0;
+    uint64_t fileVersion = 0;
+    if (!r.Get(magic) || !r.Get(format) || !r.Get(backend) || !r.Get(fileVersion)) return 0;
+    // Bytecode is backend-specific and the caller's version covers shader and engine changes
+    if (magic != kCacheMagic || format != kCacheFormatVersion ||
+        backend != static_cast<uint32_t>(device_->GetBackend()) || fileVersion != version) {
+      return 0;
+    }
+
+    std::unordered_map<uint64_t, Blob> shaders;
+    uint32_t shaderCount = 0;
+    if (!r.Get(shaderCount)) return 0;
+    for (uint32_t i = 0; i < shaderCount; ++i) {
+      uint64_t hash = 0;
+      auto bytes = std::make_shared<std::vector<uint8_t>>();
+      if (!r.Get(hash) || !r.GetBlob(*bytes)) return 0;
+      if (HashBytes(bytes->data(), bytes->size()) != hash) return 0;
+      shaders.emplace(hash, std::move(bytes));
+    }
+
+    std::unordered_map<uint64_t, std::vector<uint8_t>> passFormats;
+    uint32_t passCount = 0;
+    if (!r.Get(passCount)) return 0;
+    for (uint32_t i = 0; i < passCount; ++i) {
+      uint64_t hash = 0;
+      std::vector<uint8_t> bytes;
+      if (!r.Get(hash) || !r.GetBlob(bytes)) return 0;
+      if (HashBytes(bytes.data(), bytes.size()) != hash) return 0;
+      passFormats.emplace(hash, std::move(bytes));
+    }
+
+    uint32_t pipelineCount = 0;
+    if (!r.Get(pipelineCount)) return 0;
+    uint32_t queued = 0;
+    for (uint32_t i = 0; i < pipelineCount; ++i) {
+      uint64_t hash = 0;
+      std::vector<uint8_t> key;
+      if (!r.Get(hash) || !r.GetBlob(key)) return queued;
+      if (HashBytes(key.data(), key.size()) != hash) continue;  // Corrupt record
+      if (LoadRecord(key, shaders, passFormats)) ++queued;
+    }
+    return queued;
+  }
+
+  bool Save(char const* path, uint64_t version) const override {
+    if (!path) return false;
+
+    std::vector<PipelineEntry const*> records;
+    {
+      std::shared_lock<std::shared_mutex> lock(mutex_);
+      for (auto const& [hash, entry] : entries_) {
+        if (entry->passKind == PassKind::Identity) continue;
+        if (entry->status.load(std::memory_order_acquire) == EntryStatus::Failed) continue;
+        records.push_back(entry.get());
+      }
+    }
+    // Pipelines drawn with come first, in the order they were first drawn: the next run warms them up first
+    std::sort(records.begin(), records.end(), [](PipelineEntry const* a, PipelineEntry const* b) {
+      uint64_t const ua = a->firstUse.load(std::memory_order_relaxed);
+      uint64_t const ub = b->firstUse.load(std::memory_order_relaxed);
+      if ((ua != 0) != (ub != 0)) return ua != 0;
+      if (ua != ub) return ua < ub;
+      return a->sequence < b->sequence;
+    });
+
+    std::vector<uint8_t> out;
+    ByteWriter w(out);
+    w.Put<uint32_t>(kCacheMagic);
+    w.Put<uint32_t>(kCacheFormatVersion);
+    w.Put<uint32_t>(static_cast<uint32_t>(device_->GetBackend()));
+    w.Put<uint64_t>(version);
+
+    std::unordered_map<uint64_t, Blob> shaders;
+    std::unordered_map<uint64_t, std::vector<uint8_t> const*> passes;
+    {
+      std::shared_lock<std::shared_mutex> lock(mutex_);
+      for (PipelineEntry const* entry : records) {
+        if (entry->vs) shaders.emplace(HashOf(entry->key, 0), entry->vs);
+        if (entry->fs) shaders.emplace(HashOf(entry->key, 16), entry->fs);
+        if (entry->passKind == PassKind::Formats) {
+          auto it = passes_.find(entry->passHash);
+          if (it != passes_.end()) passes.emplace(entry->passHash, &it->second.formats);
+        }
+      }
+    }
+    w.Put<uint32_t>(static_cast<uint32_t>(shaders.size()));
+    for (auto const& [hash, bytes] : shaders) {
+      w.Put<uint64_t>(hash);
+      w.PutBlob(*bytes);
+    }
+    w.Put<uint32_t>(static_cast<uint32_t>(passes.size()));
+    for (auto const& [hash, formats] : passes) {
+      w.Put<uint64_t>(hash);
+      w.PutBlob(*formats);
+    }
+    w.Put<uint32_t>(static_cast<uint32_t>(records.size()));
+    for (PipelineEntry const* entry : records) {
+      w.Put<uint64_t>(entry->hash);
+      w.PutBlob(entry->key);
+    }
+
+    // Replace the previous file only once the new one is complete
+    std::string const tmp = std::string(path) + ".tmp";
+    if (!te::core::FileWrite(tmp, out)) return false;
+    std::remove(path);
+    return std::rename(tmp.c_str(), path) == 0;
+  }
+
+  PipelineCacheStats GetStats() const override {
+    PipelineCacheStats stats;
+    {
+      std::shared_lock<std::shared_mutex> lock(mutex_);
+      stats.pipelines = static_cast<uint32_t>(entries_.size());
+      for (auto const& [hash, entry] : entries_) {
+        EntryStatus const status = entry->status.load(std::memory_order_acquire);
+        if (status == EntryStatus::Ready) ++stats.ready;
+        else if (status == EntryStatus::Failed) ++stats.failed;
+        else ++stats.pending;
+      }
+    }
+    stats.hits = hits_.load(std::memory_order_relaxed);
+    stats.misses = misses_.load(std::memory_order_relaxed);
+    return stats;
+  }
+
+private:
+  struct OwnedPass {
+    rhi::IRenderPass* object{nullptr};
+    std::vector<uint8_t> formats;
+  };
+
+  static uint64_t HashOf(std::vector<uint8_t> const& key, size_t offset) {
+    uint64_t hash = 0;
+    std::memcpy(&hash, key.data() + offset, sizeof(hash));
+    return hash;
+  }
+
+  PipelineEntry* Find(PipelineHash hash) const {
+    if (hash == 0) return nullptr;
+    auto it = entries_.find(hash);
+    return it != entries_.end() ? it->second.get() : nullptr;
+  }
+
+  /** Existing entry for desc, or a new one (queued for the workers when enqueue is set). */
+  PipelineEntry* FindOrInsert(GraphicsPipelineDesc const& desc, bool enqueue) {
+    PipelineKey key = BuildKey(desc);
+    PipelineHash hash = HashBytes(key.bytes.data(), key.bytes.size());
+
+    std::unique_lock<std::shared_mutex> lock(mutex_);
+    for (;;) {
+      if (hash == 0) hash = 1;  // 0 means "none"
+      PipelineEntry* existing = Find(hash);
+      if (!existing) break;
+      if (existing->key == key.bytes) {
+        hits_.fetch_add(1, std::memory_order_relaxed);
+        return existing;
+      }
+      hash = HashBytes(key.bytes.data(), key.bytes.size(), hash);  // Collision: probe the next hash
+    }
+    misses_.fetch_add(1, std::memory_order_relaxed);
+
+    auto entry = std::make_unique<PipelineEntry>();
+    entry->hash = hash;
+    entry->vs = InternShader(key.vsHash, desc.pso.vertex_shader, desc.pso.vertex_shader_size);
+    entry->fs = InternShader(key.fsHash, desc.pso.fragment_shader, desc.pso.fragment_shader_size);
+    entry->hasState = desc.pso.pipelineState != nullptr;
+    if (entry->hasState) entry->state = *desc.pso.pipelineState;
+    entry->layout = InternLayout(desc.layout);
+    entry->layoutSet1 = InternLayout(desc.layoutSet1);
+    entry->passKind = key.passKind;
+    entry->passHash = key.passHash;
+    entry->pass = key.passKind == PassKind::Formats ? InternPass(key.passHash, std::move(key.passFormats))
+                                                    : desc.renderPass;
+    entry->subpassIndex = desc.subpassIndex;
+    entry->key = std::move(key.bytes);
+    return Insert(std::move(entry), enqueue);
+  }
+
+  /** Rebuilds a saved record and queues it; false if invalid or already known. */
+  bool LoadRecord(std::vector<uint8_t> const& key,
+                  std::unordered_map<uint64_t, Blob> const& shaders,
+                  std::unordered_map<uint64_t, std::vector<uint8_t>> const& passFormats) {
+    ByteReader r(key.data(), key.size());
+    uint64_t vsHash = 0, vsSize = 0, fsHash = 0, fsSize = 0;
+    auto entry = std::make_unique<PipelineEntry>();
+    rhi::DescriptorSetLayoutDesc layout{}, layoutSet1{};
+    bool hasLayout = false, hasLayoutSet1 = false;
+    uint8_t passKind = 0;
+    if (!r.Get(vsHash) || !r.Get(vsSize) || !r.Get(fsHash) || !r.Get(fsSize) ||
+        !ReadState(r, entry->hasState, entry->state) ||
+        !ReadLayout(r, hasLayout, layout) || !ReadLayout(r, hasLayoutSet1, layoutSet1) ||
+        !r.Get(passKind) || !r.Get(entry->passHash) || !r.Get(entry->subpassIndex) || !r.AtEnd()) {
+      return false;
+    }
+    auto findShader = [&shaders](uint64_t hash, uint64_t size, Blob& out) {
+      if (size == 0) return true;
+      auto it = shaders.find(hash);
+      if (it == shaders.end() || it->second->size() != size) return false;
+      out = it->second;
+      return true;
+    };
+    if (!findShader(vsHash, vsSize, entry->vs) || !findShader(fsHash, fsSize, entry->fs)) return false;
+    entry->passKind = static_cast<PassKind>(passKind);
+    if (entry->passKind != PassKind::Default && entry->passKind != PassKind::Formats) return false;
+
+    std::unique_lock<std::shared_mutex> lock(mutex_);
+    PipelineHash const hash = HashBytes(key.data(), key.size());
+    if (Find(hash)) return false;
+    if (entry->passKind == PassKind::Formats) {
+      auto it = passFormats.find(entry->passHash);
+      if (it == passFormats.end()) return false;
+      entry->pass = InternPass(entry->passHash, it->second);
+      if (!entry->pass) return false;
+    }
+    if (entry->vs) entry->vs = InternShader(vsHash, entry->vs->data(), entry->vs->size());
+    if (entry->fs) entry->fs = InternShader(fsHash, entry->fs->data(), entry->fs->size());
+    entry->layout = InternLayout(hasLayout ? &layout : nullptr);
+    entry->layoutSet1 = InternLayout(hasLayoutSet1 ? &layoutSet1 : nullptr);
+    entry->hash = hash;
+    entry->key = key;
+    Insert(std::move(entry), true);
+    return true;
+  }
+
+  // Intern* are called with mutex_ held exclusively
+  PipelineEntry* Insert(std::unique_ptr<PipelineEntry> entry, bool enqueue) {
+    PipelineEntry* raw = entry.get();
+    raw->sequence = ++sequence_;
+    entries_.emplace(raw->hash, std::move(entry));
+    std::lock_guard<std::mutex> queueLock(queueMutex_);
+    ++pending_;
+    if (enqueue) {
+      queue_.push_back(raw);
+      queueCv_.notify_one();
+    }
+    return raw;
+  }
+
+  Blob InternShader(uint64_t hash, void const* data, size_t size) {
+    if (!data || size == 0) return nullptr;
+    Blob& blob = shaders_[hash];
+    if (!blob) {
+      auto const* bytes = static_cast<uint8_t const*>(data);
+      blob = std::make_shared<std::vector<uint8_t> const>(bytes, bytes + size);
+    }
+    return blob;
+  }
+
+  rhi::IDescriptorSetLayout* InternLayout(rhi::DescriptorSetLayoutDesc const* desc) {
+    if (!desc) return nullptr;
+    std::vector<uint8_t> bytes;
+    ByteWriter w(bytes);
+    WriteLayout(w, desc);
+    rhi::IDescriptorSetLayout*& layout = layouts_[HashBytes(bytes.data(), bytes.size())];
+    if (!layout) {
+      layout = device_->CreateDescriptorSetLayout(*desc);
+    }
+    return layout;
+  }
+
+  rhi::IRenderPass* InternPass(uint64_t hash, std::vector<uint8_t> formats) {
+    OwnedPass& pass = passes_[hash];
+    if (!pass.object) {
+      rhi::RenderPassDesc desc{};
+      ByteReader r(formats.data(), formats.size());
+      if (!ReadPassFormats(r, desc)) return nullptr;
+      pass.object = device_->CreateRenderPass(desc);
+      pass.formats = std::move(formats);
+    }
+    return pass.object;
+  }
+
+  void Compile(PipelineEntry& entry) {
+    rhi::GraphicsPSODesc desc{};
+    desc.vertex_shader = entry.vs ? entry.vs->data() : nullptr;
+    desc.vertex_shader_size = entry.vs ? entry.vs->size() : 0;
+    desc.fragment_shader = entry.fs ? entry.fs->data() : nullptr;
+    desc.fragment_shader_size = entry.fs ? entry.fs->size() : 0;
+    desc.pipelineState = entry.hasState ? &entry.state : nullptr;
+    entry.pso = device_->CreateGraphicsPSO(desc, entry.layout, entry.pass, entry.subpassIndex, entry.layoutSet1);
+    entry.status.store(entry.pso ? EntryStatus::Ready : EntryStatus::Failed, std::memory_order_release);
+  }
+
+  void FinishCompile() {
+    {
+      std::lock_guard<std::mutex> lock(queueMutex_);
+      --pending_;
+    }
+    idleCv_.notify_all();
+  }
+
+  void WorkerLoop() {
+    for (;;) {
+      PipelineEntry* entry = nullptr;
+      {
+        std::unique_lock<std::mutex> lock(queueMutex_);
+        queueCv_.wait(lock, [this]() { return stop_ || !queue_.empty(); });
+        if (stop_) return;
+        entry = queue_.front();
+        queue_.pop_front();
+        entry->status.store(EntryStatus::Compiling, std::memory_order_relaxed);
+      }
+      Compile(*entry);
+      FinishCompile();
+    }
+  }
+
+  rhi::IDevice* device_{nullptr};
+
+  mutable std::shared_mutex mutex_;  // Guards the tables below
+  std::unordered_map<PipelineHash, std::unique_ptr<PipelineEntry>> entries_;
+  std::unordered_map<uint64_t, Blob> shaders_;
+  std::unordered_map<uint64_t, rhi::IDescriptorSetLayout*> layouts_;
+  std::unordered_map<uint64_t, OwnedPass> passes_;
+  uint64_t sequence_{0};
+
+  std::mutex queueMutex_;  // Guards queue_, pending_ and stop_
+  std::condition_variable queueCv_;
+  std::condition_variable idleCv_;
+  std::deque<PipelineEntry*> queue_;
+  uint32_t pending_{0};  // Queued or compiling
+  bool stop_{false};
+  std::vector<std::thread> workers_;
+
+  std::atomic<PipelineHash> fallback_{0};
+  std::atomic<uint64_t> useClock_{0};
+  std::atomic<uint64_t> hits_{0};
+  std::atomic<uint64_t> misses_{0};
+};
+
+PipelineHash HashGraphicsPipeline(GraphicsPipelineDesc const& desc) {
+  PipelineKey const key = BuildKey(desc);
+  PipelineHash const hash = HashBytes(key.bytes.data(), key.bytes.size());
+  return hash != 0 ? hash : 1;
+}
+
+IPipelineCache* CreatePipelineCache(rhi::IDevice* device, uint32_t workerCount) {
+  auto* cache = new PipelineCacheImpl();
+  if (!cache->Initialize(device, workerCount)) {
+    delete cache;
+    return nullptr;
+  }
+  return cache;
+}
+
+void ReleasePipelineCache(IPipelineCache* cache) {
+  delete static_cast<PipelineCacheImpl*>(cache);
+}
+
+namespace {
+
+std::mutex g_deviceCachesMutex;
+std::unordered_map<rhi::IDevice*, IPipelineCache*> g_deviceCaches;
+
+}  // namespace
+
+IPipelineCache* GetDevicePipelineCache(rhi::IDevice* device) {
+  if (!device) return nullptr;
+  std::lock_guard<std::mutex> lock(g_deviceCachesMutex);
+  IPipelineCache*& cache = g_deviceCaches[device];
+  if (!cache) {
+    cache = CreatePipelineCache(device, 0);
+  }
+  return cache;
+}
+
+void ReleaseDevicePipelineCache(rhi::IDevice* device) {
+  std::lock_guard<std::mutex> lock(g_deviceCachesMutex);
+  auto it = g_deviceCaches.find(device);
+  if (it == g_deviceCaches.end()) return;
+  ReleasePipelineCache(it->second);
+  g_deviceCaches.erase(it);
+}
+
+}  // namespace te::rendercore
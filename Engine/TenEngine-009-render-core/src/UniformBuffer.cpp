@@ -1,15 +1,21 @@
 /**
  * @file UniformBuffer.cpp
- * @brief Implementation of IUniformBuffer and IUniformLayout.
+ * @brief Implementation of IUniformBuffer, IUniformRing and IUniformLayout.
  */
 
 #include <te/rendercore/uniform_buffer.hpp>
 #include <te/rendercore/uniform_layout.hpp>
+#include <te/core/log.h>
+#include <te/rhi/command_list.hpp>
 #include <te/rhi/device.hpp>
 #include <te/rhi/resources.hpp>
 
+#include <algorithm>
+#include <atomic>
 #include <cstring>
+#include <deque>
 #include <memory>
+#include <mutex>
 #include <string>
 #include <vector>
 #include <unordered_map>
@@ -108,51 +114,243 @@ void ReleaseUniformLayoutInternal(IUniformLayout* layout) {
   delete static_cast<UniformLayoutImpl*>(layout);
 }
 
-// === Uniform Buffer Implementation ===
+// === Uniform Ring Implementation ===
 
-class UniformBufferImpl : public IUniformBuffer {
+namespace {
+
+uint64_t AlignUp(uint64_t value, uint64_t alignment) {
+  return (value + alignment - 1) / alignment * alignment;
+}
+
+}  // namespace
+
+// Offsets are virtual (monotonic); the physical offset is virtual % capacity. Capacity is a
+// multiple of the alignment, so aligned virtual offsets stay aligned after the wrap.
+class UniformRingImpl : public IUniformRing {
 public:
-  rhi::IDevice* device{nullptr};
-  IUniformLayout* layout{nullptr};
-  std::vector<rhi::IBuffer*> buffers;  // One per frame slot
-  std::vector<uint8_t> cpuData;
-  size_t bufferSize{0};
-  FrameSlotId currentSlot{0};
-  uint32_t framesInFlight{2};
+  ~UniformRingImpl() override {
+    if (buffer_ && device_) {
+      device_->DestroyBuffer(buffer_);
+    }
+  }
+
+  bool Initialize(rhi::IDevice* device, size_t capacity) {
+    if (!device || capacity == 0) return false;
+    device_ = device;
+    size_t const limit = device->GetLimits().minUniformBufferOffsetAlignment;
+    alignment_ = limit > 0 ? limit : 256;
+    capacity_ = static_cast<size_t>(AlignUp(capacity, alignment_));
+
+    rhi::BufferDesc desc{};
+    desc.size = capacity_;
+    desc.usage = static_cast<uint32_t>(rhi::BufferUsage::Uniform) |
+                 static_cast<uint32_t>(rhi::BufferUsage::CopyDst);
+    buffer_ = device->CreateBuffer(desc);
+    if (!buffer_) return false;
+
+    mapped_ = static_cast<uint8_t*>(device->MapBuffer(buffer_));
+    if (!mapped_) {
+      shadow_.resize(capacity_);  // Written by Allocate, uploaded by Flush
+    }
+    return true;
+  }
+
+  void BeginFrame(uint64_t completedValue) override {
+    // Frames end in submission order, so retiring from the front keeps the tail contiguous
+    uint64_t tail = tail_.load(std::memory_order_relaxed);
+    while (!inFlight_.empty() && inFlight_.front().value <= completedValue) {
+      tail = inFlight_.front().end;
+      inFlight_.pop_front();
+    }
+    tail_.store(tail, std::memory_order_release);
+    frameStart_ = head_.load(std::memory_order_acquire);
+    frameIndex_.fetch_add(1, std::memory_order_release);
+  }
+
+  void EndFrame(uint64_t submittedValue) override {
+    uint64_t const head = head_.load(std::memory_order_acquire);
+    if (!inFlight_.empty() && inFlight_.back().value >= submittedValue) {
+      inFlight_.back().end = head;  // Nothing submitted since the last frame: retire together
+    } else {
+      inFlight_.push_back({submittedValue, head});
+    }
+  }
 
-  ~UniformBufferImpl() override {
-    for (auto* buf : buffers) {
-      if (buf && device) {
-        device->DestroyBuffer(buf);
+  UniformAllocation Allocate(size_t size) override {
+    UniformAllocation alloc;
+    if (size == 0 || size > capacity_) return alloc;
+
+    uint64_t head = head_.load(std::memory_order_relaxed);
+    uint64_t start = 0;
+    for (;;) {
+      start = AlignUp(head, alignment_);
+      size_t const physical = static_cast<size_t>(start % capacity_);
+      if (physical + size > capacity_) {
+        start += capacity_ - physical;  // Blocks never straddle the end of the buffer
       }
+      if (start + size - tail_.load(std::memory_order_acquire) > capacity_) {
+        return alloc;  // Full until an older frame retires
+      }
+      if (head_.compare_exchange_weak(head, start + size, std::memory_order_acq_rel, std::memory_order_relaxed)) {
+        break;
+      }
+    }
+
+    alloc.buffer = buffer_;
+    alloc.offset = static_cast<size_t>(start % capacity_);
+    alloc.size = size;
+    alloc.cpuAddress = (mapped_ ? mapped_ : shadow_.data()) + alloc.offset;
+    return alloc;
+  }
+
+  UniformAllocation Write(void const* data, size_t size) override {
+    UniformAllocation alloc = Allocate(size);
+    if (alloc.IsValid() && data) {
+      std::memcpy(alloc.cpuAddress, data, size);
     }
-    if (layout) {
-      ReleaseUniformLayoutInternal(layout);
+    return alloc;
+  }
+
+  void Flush() override {
+    if (mapped_) return;
+    uint64_t const head = head_.load(std::memory_order_acquire);
+    if (head == frameStart_) return;
+    size_t const begin = static_cast<size_t>(frameStart_ % capacity_);
+    size_t const length = static_cast<size_t>(head - frameStart_);
+    if (begin + length <= capacity_) {
+      device_->UpdateBuffer(buffer_, begin, shadow_.data() + begin, length);
+    } else {
+      // Wrapped frame: one write, since discard-on-map backends drop the rest of the buffer
+      device_->UpdateBuffer(buffer_, 0, shadow_.data(), capacity_);
     }
   }
 
+  uint64_t GetFrameIndex() const override {
+    return frameIndex_.load(std::memory_order_acquire);
+  }
+
+  size_t GetAlignment() const override {
+    return alignment_;
+  }
+
+  size_t GetCapacity() const override {
+    return capacity_;
+  }
+
+  size_t GetUsedBytes() const override {
+    return static_cast<size_t>(head_.load(std::memory_order_acquire) - tail_.load(std::memory_order_acquire));
+  }
+
+  rhi::IBuffer* GetBuffer() override {
+    return buffer_;
+  }
+
+private:
+  rhi::IDevice* device_{nullptr};
+  rhi::IBuffer* buffer_{nullptr};
+  uint8_t* mapped_{nullptr};
+  std::vector<uint8_t> shadow_;  // CPU copy when the device cannot map persistently
+  size_t capacity_{0};
+  size_t alignment_{256};
+
+  std::atomic<uint64_t> head_{0};
+  std::atomic<uint64_t> tail_{0};
+  std::atomic<uint64_t> frameIndex_{0};
+  struct InFlightFrame {
+    uint64_t value;  // Queue value signaled once the GPU is done with the frame
+    uint64_t end;    // Head at EndFrame
+  };
+  std::deque<InFlightFrame> inFlight_;
+  uint64_t frameStart_{0};
+};
+
+IUniformRing* CreateUniformRing(rhi::IDevice* device, size_t capacity) {
+  auto* ring = new UniformRingImpl();
+  if (!ring->Initialize(device, capacity)) {
+    delete ring;
+    return nullptr;
+  }
+  return ring;
+}
+
+void ReleaseUniformRing(IUniformRing* ring) {
+  delete static_cast<UniformRingImpl*>(ring);
+}
+
+namespace {
+
+std::mutex g_deviceRingsMutex;
+std::unordered_map<rhi::IDevice*, IUniformRing*> g_deviceRings;
+
+}  // namespace
+
+IUniformRing* GetDeviceUniformRing(rhi::IDevice* device) {
+  if (!device) return nullptr;
+  std::lock_guard<std::mutex> lock(g_deviceRingsMutex);
+  IUniformRing*& ring = g_deviceRings[device];
+  if (!ring) {
+    ring = CreateUniformRing(device, kDefaultUniformRingCapacity);
+  }
+  return ring;
+}
+
+void ReleaseDeviceUniformRing(rhi::IDevice* device) {
+  std::lock_guard<std::mutex> lock(g_deviceRingsMutex);
+  auto it = g_deviceRings.find(device);
+  if (it == g_deviceRings.end()) return;
+  ReleaseUniformRing(it->second);
+  g_deviceRings.erase(it);
+}
+
+// === Uniform Buffer Implementation ===
+
+namespace {
+
+// Ring frame index of the last "ring full" report; one error per frame, not per buffer
+std::atomic<uint64_t> g_lastFullFrame{~0ull};
+
+}  // namespace
+
+// Every Update writes a fresh block into the device ring, so frames in flight keep reading
+// their own copy. A block not rewritten this frame is re-uploaded from cpuData on use.
+class UniformBufferImpl : public IUniformBuffer {
+public:
+  IUniformRing* ring{nullptr};
+  std::vector<uint8_t> cpuData;
+  size_t bufferSize{0};
+  FrameSlotId currentSlot{0};
+  UniformAllocation current;
+  uint64_t currentFrame{~0ull};  // Ring frame index current was allocated in
+  std::vector<size_t> slotOffsets;
+
   void Update(void const* data, size_t size) override {
     if (!data || size == 0) return;
-    size_t copySize = std::min(size, bufferSize);
-    if (copySize > cpuData.size()) {
-      cpuData.resize(copySize);
-    }
-    std::memcpy(cpuData.data(), data, copySize);
+    std::memcpy(cpuData.data(), data, std::min(size, bufferSize));
+    Upload();
+  }
 
-    // Update GPU buffer for current slot
-    if (currentSlot < buffers.size() && buffers[currentSlot] && device) {
-      device->UpdateBuffer(buffers[currentSlot], 0, cpuData.data(), copySize);
+  void UpdateRange(size_t offset, void const* data, size_t size) override {
+    if (!data || offset >= bufferSize) return;
+    size = std::min(size, bufferSize - offset);
+    if (size == 0) return;
+    std::memcpy(cpuData.data() + offset, data, size);
+    if (currentFrame != ring->GetFrameIndex()) {
+      Upload();  // First write this frame: the previous block may still be in flight
+    } else if (current.cpuAddress) {
+      std::memcpy(static_cast<uint8_t*>(current.cpuAddress) + offset, data, size);
     }
   }
 
   void Bind(rhi::ICommandList* cmd, uint32_t slot) override {
-    if (!cmd || currentSlot >= buffers.size() || !buffers[currentSlot]) return;
-    cmd->SetUniformBuffer(slot, buffers[currentSlot], 0);
+    if (!cmd) return;
+    EnsureCurrent();
+    if (current.buffer) {
+      cmd->SetUniformBuffer(slot, current.buffer, current.offset);
+    }
   }
 
   size_t GetRingBufferOffset(FrameSlotId slot) const override {
-    (void)slot;
-    return 0; // Simple implementation: each slot has its own buffer
+    return slot < slotOffsets.size() ? slotOffsets[slot] : 0;
   }
 
   void SetCurrentFrameSlot(FrameSlotId slot) override {
@@ -160,35 +358,47 @@ public:
   }
 
   rhi::IBuffer* GetBuffer() override {
-    if (currentSlot < buffers.size()) {
-      return buffers[currentSlot];
-    }
-    return nullptr;
+    EnsureCurrent();
+    return current.buffer;
   }
 
-  bool Initialize(IUniformLayout const* layoutDesc, rhi::IDevice* dev, uint32_t frames) {
+  size_t GetSize() const override {
+    return bufferSize;
+  }
+
+  bool Initialize(IUniformLayout const* layoutDesc, rhi::IDevice* dev) {
     if (!layoutDesc || !dev) return false;
 
-    device = dev;
-    framesInFlight = frames;
     bufferSize = layoutDesc->GetTotalSize();
-
     if (bufferSize == 0) return false;
 
+    ring = GetDeviceUniformRing(dev);
+    if (!ring) return false;
+
     cpuData.resize(bufferSize, 0);
+    return true;
+  }
 
-    // Create one buffer per frame slot
-    buffers.resize(framesInFlight);
-    for (uint32_t i = 0; i < framesInFlight; ++i) {
-      rhi::BufferDesc desc{};
-      desc.size = bufferSize;
-      desc.usage = static_cast<uint32_t>(rhi::BufferUsage::Uniform) | 
-                   static_cast<uint32_t>(rhi::BufferUsage::CopyDst);
-      buffers[i] = device->CreateBuffer(desc);
-      if (!buffers[i]) return false;
+private:
+  void EnsureCurrent() {
+    if (currentFrame != ring->GetFrameIndex()) {
+      Upload();
     }
+  }
 
-    return true;
+  void Upload() {
+    currentFrame = ring->GetFrameIndex();
+    current = ring->Write(cpuData.data(), bufferSize);
+    if (!current.IsValid() && g_lastFullFrame.exchange(currentFrame) != currentFrame) {
+      // No fallback buffer: rewriting one shared block every frame would race frames in flight
+      te::core::Log(te::core::LogLevel::Error,
+                    "UniformBuffer: device uniform ring is full; blocks are not bound this frame "
+                    "(increase the ring capacity or frame pacing)");
+    }
+    if (currentSlot >= slotOffsets.size()) {
+      slotOffsets.resize(currentSlot + 1, 0);
+    }
+    slotOffsets[currentSlot] = current.offset;
   }
 };
 
@@ -196,7 +406,7 @@ IUniformBuffer* CreateUniformBuffer(IUniformLayout const* layout, rhi::IDevice*
   if (!layout || !device) return nullptr;
 
   auto* ub = new UniformBufferImpl();
-  if (!ub->Initialize(layout, device, 2)) { // Default 2 frames in flight
+  if (!ub->Initialize(layout, device)) {
     delete ub;
     return nullptr;
   }
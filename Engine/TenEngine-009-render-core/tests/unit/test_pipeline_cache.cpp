@@ -0,0 +1,147 @@
+/**
+ * @file test_pipeline_cache.cpp
+ * @brief IPipelineCache on the Null RHI backend: content hashing, deduplication of identical
+ *        requests, the fallback pipeline, and Save/Load round-trip with version invalidation.
+ */
+#include <te/rendercore/pipeline_cache.hpp>
+#include <te/rhi/backend_null.hpp>
+#include <te/rhi/device.hpp>
+#include <cassert>
+#include <cstdio>
+#include <vector>
+
+using namespace te::rendercore;
+
+namespace {
+
+char const* const kCachePath = "test_pipeline_cache.bin";
+
+// Owns its bytecode, state and layout so two descs can be equal in content but not in address
+struct TestPipeline {
+  std::vector<uint32_t> vs{0x07230203u, 1u, 2u, 3u};
+  std::vector<uint32_t> fs{0x07230203u, 4u, 5u, 6u};
+  te::rhi::GraphicsPipelineStateDesc state{};
+  te::rhi::DescriptorSetLayoutDesc layout{};
+
+  TestPipeline() {
+    layout.bindings[0] = {0u, static_cast<uint32_t>(te::rhi::DescriptorType::UniformBufferDynamic), 1u};
+    layout.bindingCount = 1;
+  }
+  GraphicsPipelineDesc Desc() const {
+    GraphicsPipelineDesc desc{};
+    desc.pso.vertex_shader = vs.data();
+    desc.pso.vertex_shader_size = vs.size() * sizeof(uint32_t);
+    desc.pso.fragment_shader = fs.data();
+    desc.pso.fragment_shader_size = fs.size() * sizeof(uint32_t);
+    desc.pso.pipelineState = &state;
+    desc.layout = &layout;
+    return desc;
+  }
+};
+
+void TestHash() {
+  TestPipeline a, b;
+  assert(HashGraphicsPipeline(a.Desc()) != 0);
+  assert(HashGraphicsPipeline(a.Desc()) == HashGraphicsPipeline(b.Desc()));
+
+  b.fs[3] = 7u;
+  assert(HashGraphicsPipeline(a.Desc()) != HashGraphicsPipeline(b.Desc()));
+  TestPipeline c;
+  c.state.rasterization.cullMode = te::rhi::CullMode::None;
+  assert(HashGraphicsPipeline(a.Desc()) != HashGraphicsPipeline(c.Desc()));
+  TestPipeline d;
+  d.layout.bindings[0].descriptorType = static_cast<uint32_t>(te::rhi::DescriptorType::UniformBuffer);
+  assert(HashGraphicsPipeline(a.Desc()) != HashGraphicsPipeline(d.Desc()));
+}
+
+// Identical requests share one PSO, whichever path asks first
+void TestDedup(te::rhi::IDevice* device) {
+  IPipelineCache* cache = CreatePipelineCache(device, 2);
+  assert(cache);
+  uint64_t const created = te::rhi::GetNullDeviceCounters(device).psosCreated;
+  TestPipeline a, sameAsA, other;
+  other.vs[1] = 9u;
+
+  PipelineHash const hashA = cache->Request(a.Desc());
+  assert(hashA == HashGraphicsPipeline(a.Desc()));
+  assert(cache->Request(sameAsA.Desc()) == hashA);
+  PipelineHash syncHash = 0;
+  te::rhi::IPSO* pso = cache->RequestSync(sameAsA.Desc(), &syncHash);
+  assert(pso && syncHash == hashA);
+  assert(cache->IsReady(hashA) && cache->Acquire(hashA) == pso);
+
+  PipelineHash const hashOther = cache->Request(other.Desc());
+  assert(hashOther != hashA);
+  cache->WaitIdle();
+  assert(cache->IsReady(hashOther) && cache->Acquire(hashOther) != pso);
+
+  PipelineCacheStats const stats = cache->GetStats();
+  assert(stats.pipelines == 2 && stats.ready == 2 && stats.pending == 0 && stats.failed == 0);
+  assert(stats.misses == 2 && stats.hits == 2);
+  assert(te::rhi::GetNullDeviceCounters(device).psosCreated == created + 2);
+  ReleasePipelineCache(cache);
+}
+
+// Acquire of a pipeline that is not ready returns the fallback
+void TestFallback(te::rhi::IDevice* device) {
+  IPipelineCache* cache = CreatePipelineCache(device, 1);
+  TestPipeline fallback;
+  PipelineHash fallbackHash = 0;
+  te::rhi::IPSO* fallbackPso = cache->RequestSync(fallback.Desc(), &fallbackHash);
+  assert(fallbackPso && cache->GetFallback() == 0);
+
+  PipelineHash const unknown = fallbackHash + 1;
+  assert(cache->Acquire(unknown) == nullptr);
+  cache->SetFallback(fallbackHash);
+  assert(cache->GetFallback() == fallbackHash && cache->Acquire(unknown) == fallbackPso);
+  cache->SetFallback(0);
+  assert(cache->Acquire(unknown) == nullptr);
+  ReleasePipelineCache(cache);
+}
+
+// A saved cache precompiles the same pipelines on the next run, unless the version changed
+void TestSaveLoad(te::rhi::IDevice* device) {
+  TestPipeline a, b;
+  b.fs[1] = 8u;
+  PipelineHash const hashA = HashGraphicsPipeline(a.Desc());
+  PipelineHash const hashB = HashGraphicsPipeline(b.Desc());
+
+  IPipelineCache* first = CreatePipelineCache(device, 1);
+  assert(first->RequestSync(a.Desc()) && first->RequestSync(b.Desc()));
+  first->Acquire(hashB);  // Drawn with: saved first
+  assert(first->Save(kCachePath, 7));
+  ReleasePipelineCache(first);
+
+  IPipelineCache* stale = CreatePipelineCache(device, 1);
+  assert(stale->Load(kCachePath, 8) == 0);  // Shaders or engine changed since the save
+  assert(stale->GetStats().pipelines == 0);
+  ReleasePipelineCache(stale);
+
+  IPipelineCache* second = CreatePipelineCache(device, 1);
+  assert(second->Load(kCachePath, 7) == 2);
+  second->WaitIdle();
+  assert(second->IsReady(hashA) && second->IsReady(hashB));
+  assert(second->GetStats().pipelines == 2 && second->GetStats().misses == 0);
+  // Loaded pipelines have the keys of the original requests
+  assert(second->Request(a.Desc()) == hashA && second->GetStats().hits == 1);
+  assert(second->Load(kCachePath, 7) == 0);  // Already known
+  ReleasePipelineCache(second);
+
+  assert(std::remove(kCachePath) == 0);
+}
+
+}  // namespace
+
+int main() {
+  te::rhi::IDevice* device = te::rhi::CreateDevice(te::rhi::Backend::Null);
+  assert(device);
+  TestHash();
+  TestDedup(device);
+  TestFallback(device);
+  TestSaveLoad(device);
+  assert(GetDevicePipelineCache(device) == GetDevicePipelineCache(device));
+  ReleaseDevicePipelineCache(device);
+  te::rhi::DestroyDevice(device);
+  std::printf("test_pipeline_cache: pass\n");
+  return 0;
+}
@@ -0,0 +1,221 @@
+/**
+ * @file test_uniform_ring.cpp
+ * @brief IUniformRing on the Null RHI backend: alignment, no-straddle wrap-around,
+ *        full/retire on queue timeline completion and concurrent lock-free allocation;
+ *        IUniformBuffer when the device ring is full.
+ */
+#include <te/rendercore/uniform_buffer.hpp>
+#include <te/rendercore/uniform_layout.hpp>
+#include <te/rhi/backend_null.hpp>
+#include <te/rhi/command_list.hpp>
+#include <te/rhi/device.hpp>
+#include <te/rhi/queue.hpp>
+#include <te/rhi/sync.hpp>
+#include <algorithm>
+#include <cassert>
+#include <cstdio>
+#include <cstring>
+#include <thread>
+#include <vector>
+
+using namespace te::rendercore;
+
+namespace {
+
+constexpr size_t kAlign = 256;  // Null device minUniformBufferOffsetAlignment
+
+void TestAlignmentAndWrite(te::rhi::IDevice* device) {
+  IUniformRing* ring = CreateUniformRing(device, 4 * kAlign);
+  assert(ring && ring->GetAlignment() == kAlign && ring->GetCapacity() == 4 * kAlign);
+  size_t bufferSize = 0;
+  auto* base = static_cast<uint8_t*>(te::rhi::GetNullBufferData(ring->GetBuffer(), &bufferSize));
+  assert(base && bufferSize == ring->GetCapacity());
+
+  ring->BeginFrame(0);
+  uint32_t const value = 0xC0FFEEu;
+  UniformAllocation a = ring->Write(&value, sizeof(value));
+  UniformAllocation b = ring->Allocate(10);
+  assert(a.IsValid() && b.IsValid());
+  assert(a.offset == 0 && b.offset == kAlign);
+  assert(a.buffer == ring->GetBuffer() && a.cpuAddress == base + a.offset);
+  assert(std::memcmp(base, &value, sizeof(value)) == 0);  // Persistently mapped: no Flush needed
+  assert(ring->GetUsedBytes() == kAlign + 10);
+
+  assert(!ring->Allocate(0).IsValid());
+  assert(!ring->Allocate(ring->GetCapacity() + 1).IsValid());
+  ReleaseUniformRing(ring);
+}
+
+// Blocks stay reserved until the queue timeline reaches the value their frame was submitted with
+void TestRetireOnTimeline(te::rhi::IDevice* device) {
+  IUniformRing* ring = CreateUniformRing(device, 4 * kAlign);
+  te::rhi::IQueue* queue = device->GetQueue(te::rhi::QueueType::Graphics, 0);
+  te::rhi::ISemaphore* timeline = device->CreateTimelineSemaphore(0);
+  te::rhi::ISemaphore* gate = device->CreateTimelineSemaphore(0);  // Holds the "GPU" back
+  te::rhi::ICommandList* cmd = device->CreateCommandList();
+  cmd->Begin();
+  cmd->End();
+  auto submitFrame = [&](uint64_t value) {
+    te::rhi::SemaphoreSubmit const wait{gate, value};
+    te::rhi::SemaphoreSubmit const signal{timeline, value};
+    te::rhi::SubmitInfo info{};
+    info.commandLists = &cmd;
+    info.commandListCount = 1;
+    info.waits = &wait;
+    info.waitCount = 1;
+    info.signals = &signal;
+    info.signalCount = 1;
+    queue->Submit(info);
+    ring->EndFrame(value);
+  };
+
+  // Frame 1: three blocks, submitted but not finished
+  ring->BeginFrame(timeline->GetCompletedValue());
+  uint64_t const frameIndex = ring->GetFrameIndex();
+  for (int i = 0; i < 3; ++i) assert(ring->Allocate(kAlign).IsValid());
+  submitFrame(1);
+
+  // Frame 2: frame 1 is still in flight, so only one block is left
+  ring->BeginFrame(timeline->GetCompletedValue());
+  assert(ring->GetFrameIndex() == frameIndex + 1);
+  assert(ring->GetUsedBytes() == 3 * kAlign);
+  assert(!ring->Allocate(2 * kAlign).IsValid());
+  UniformAllocation last = ring->Allocate(kAlign);
+  assert(last.IsValid() && last.offset == 3 * kAlign);
+  assert(!ring->Allocate(1).IsValid());  // Full
+  submitFrame(2);
+
+  // The GPU finishes frame 1 only: its blocks are recycled, frame 2's are not
+  gate->Signal(1);
+  assert(timeline->GetCompletedValue() == 1);
+  ring->BeginFrame(timeline->GetCompletedValue());
+  assert(ring->GetUsedBytes() == kAlign);
+  UniformAllocation wrapped = ring->Allocate(2 * kAlign);
+  assert(wrapped.IsValid() && wrapped.offset == 0);  // Wrapped to the start of the buffer
+  assert(ring->Allocate(kAlign).IsValid());
+  assert(!ring->Allocate(kAlign).IsValid());         // Frame 2's block at 3 * kAlign is still in use
+
+  // A frame with no new submission retires together with the previous one
+  ring->EndFrame(2);
+  gate->Signal(2);
+  ring->BeginFrame(timeline->GetCompletedValue());
+  assert(ring->GetUsedBytes() == 0);
+
+  device->DestroyCommandList(cmd);
+  device->DestroySemaphore(gate);
+  device->DestroySemaphore(timeline);
+  ReleaseUniformRing(ring);
+}
+
+// A block that would cross the end of the buffer starts at offset 0 instead
+void TestNoStraddle(te::rhi::IDevice* device) {
+  IUniformRing* ring = CreateUniformRing(device, 4 * kAlign);
+  ring->BeginFrame(0);
+  assert(ring->Allocate(kAlign).offset == 0);
+  assert(ring->Allocate(2 * kAlign).offset == kAlign);
+  ring->EndFrame(1);
+  ring->BeginFrame(1);
+  assert(ring->GetUsedBytes() == 0);
+
+  UniformAllocation a = ring->Allocate(2 * kAlign);  // [3 * kAlign, 5 * kAlign) would straddle
+  assert(a.IsValid() && a.offset == 0);
+  assert(ring->GetUsedBytes() == 3 * kAlign);        // The skipped tail counts until retired
+  assert(a.offset + a.size <= ring->GetCapacity());
+  ReleaseUniformRing(ring);
+}
+
+// Recording threads allocate concurrently; blocks never overlap and stay aligned
+void TestConcurrentAllocate(te::rhi::IDevice* device) {
+  constexpr int kThreads = 4;
+  constexpr int kPerThread = 1000;
+  IUniformRing* ring = CreateUniformRing(device, kThreads * kPerThread * kAlign);
+  ring->BeginFrame(0);
+
+  std::vector<std::vector<size_t>> offsets(kThreads);
+  std::vector<std::thread> threads;
+  for (int t = 0; t < kThreads; ++t) {
+    threads.emplace_back([&, t]() {
+      uint32_t const tag = static_cast<uint32_t>(t + 1);
+      for (int i = 0; i < kPerThread; ++i) {
+        UniformAllocation alloc = ring->Write(&tag, sizeof(tag));
+        assert(alloc.IsValid());
+        offsets[t].push_back(alloc.offset);
+      }
+    });
+  }
+  for (auto& thread : threads) thread.join();
+
+  auto* base = static_cast<uint8_t*>(te::rhi::GetNullBufferData(ring->GetBuffer(), nullptr));
+  std::vector<size_t> all;
+  for (int t = 0; t < kThreads; ++t) {
+    for (size_t offset : offsets[t]) {
+      assert(offset % kAlign == 0);
+      uint32_t tag = 0;
+      std::memcpy(&tag, base + offset, sizeof(tag));
+      assert(tag == static_cast<uint32_t>(t + 1));  // Nobody else wrote into this block
+      all.push_back(offset);
+    }
+  }
+  std::sort(all.begin(), all.end());
+  assert(std::adjacent_find(all.begin(), all.end()) == all.end());
+  assert(ring->GetUsedBytes() == ring->GetCapacity() - kAlign + sizeof(uint32_t));
+  assert(!ring->Allocate(kAlign).IsValid());
+  ReleaseUniformRing(ring);
+}
+
+// A full ring leaves the buffer unbound for the frame instead of rewriting a shared fallback
+void TestUniformBufferRingFull(te::rhi::IDevice* device) {
+  IUniformRing* ring = GetDeviceUniformRing(device);
+  UniformMember member{};
+  std::strcpy(member.name, "color");
+  member.type = UniformMemberType::Float4;
+  UniformLayoutDesc desc{};
+  desc.members = &member;
+  desc.memberCount = 1;
+  IUniformLayout* layout = CreateUniformLayout(desc);
+  IUniformBuffer* ub = CreateUniformBuffer(layout, device);
+  ReleaseUniformLayout(layout);
+  assert(ub);
+
+  float const color[4] = {1.0f, 0.0f, 0.0f, 1.0f};
+  ring->BeginFrame(0);
+  ub->Update(color, sizeof(color));
+  assert(ub->GetBuffer() == ring->GetBuffer());
+  assert(ring->Allocate(ring->GetCapacity() - kAlign).IsValid());  // Fill the rest of the ring
+  ring->EndFrame(1);
+
+  ring->BeginFrame(0);  // Frame 1 still in flight
+  ub->Update(color, sizeof(color));
+  assert(ub->GetBuffer() == nullptr);
+  te::rhi::ICommandList* cmd = device->CreateCommandList();
+  cmd->Begin();
+  ub->Bind(cmd, 0);
+  size_t count = 0;
+  te::rhi::GetRecordedCommands(cmd, &count);
+  assert(count == 0);
+  cmd->End();
+  ring->EndFrame(1);
+
+  ring->BeginFrame(1);
+  ub->Update(color, sizeof(color));
+  assert(ub->GetBuffer() == ring->GetBuffer());
+
+  device->DestroyCommandList(cmd);
+  ReleaseUniformBuffer(ub);
+  ReleaseDeviceUniformRing(device);
+}
+
+}  // namespace
+
+int main() {
+  te::rhi::IDevice* device = te::rhi::CreateDevice(te::rhi::Backend::Null);
+  assert(device);
+  TestAlignmentAndWrite(device);
+  TestRetireOnTimeline(device);
+  TestNoStraddle(device);
+  TestConcurrentAllocate(device);
+  TestUniformBufferRingFull(device);
+  te::rhi::DestroyDevice(device);
+  std::printf("test_uniform_ring: pass\n");
+  return 0;
+}
@@ -2,15 +2,44 @@
 #define TE_SHADER_CACHE_HPP
 
 #include <te/shader/handle.hpp>
+#include <cstdint>
 
 namespace te::shader {
 
+/** Default bound on the bytes of all cached variants (see IShaderCache::SetMaxSize). */
+constexpr uint64_t kDefaultShaderCacheMaxBytes = 256ull * 1024 * 1024;
+
+struct ShaderCacheStats {
+    uint32_t entries = 0;    // Variants known (in memory or on disk)
+    uint64_t bytes = 0;      // Serialized size of those variants
+    uint64_t hits = 0;
+    uint64_t misses = 0;
+    uint64_t evictions = 0;  // Removed by the size bound
+};
+
+/**
+ * Content-addressed variant cache. Each compiled variant is keyed by a 128-bit hash of its
+ * source, the sources of every file it #includes, its macros, the compile options and the
+ * compiler version, so editing a header or switching options never returns stale bytecode.
+ * With a directory attached every variant is one file written atomically; total size is
+ * bounded by least-recently-used eviction. All members are thread-safe.
+ */
 class IShaderCache {
 public:
     virtual ~IShaderCache() = default;
+    /** Attaches cache directory path (created if missing) and indexes the variants in it;
+     *  later compiles are written through. False if path is not a directory. */
     virtual bool LoadCache(char const* path) = 0;
+    /** Writes every variant not yet in directory path, attaches it and flushes the LRU index. */
     virtual bool SaveCache(char const* path) = 0;
+    /** Clears handle's bytecode and drops its variants from memory; entries on disk are kept. */
     virtual void Invalidate(IShaderHandle* handle) = 0;
+    /** Removes every variant whose source or include closure contains path (memory and disk);
+     *  returns the number removed. */
+    virtual uint32_t InvalidateFile(char const* path) { (void)path; return 0; }
+    /** Bound on total variant bytes; 0 = unbounded. Defaults to kDefaultShaderCacheMaxBytes. */
+    virtual void SetMaxSize(uint64_t bytes) { (void)bytes; }
+    virtual ShaderCacheStats GetStats() const { return {}; }
 };
 
 }  // namespace te::shader
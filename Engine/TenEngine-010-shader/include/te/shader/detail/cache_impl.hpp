@@ -4,24 +4,71 @@
 #include <te/shader/cache.hpp>
 #include <te/shader/detail/handle_impl.hpp>
 #include <te/shader/types.hpp>
+#include <cstddef>
 #include <cstdint>
+#include <mutex>
 #include <string>
 #include <unordered_map>
+#include <unordered_set>
+#include <vector>
 
 namespace te::shader {
 
+/** What one compile is keyed by: content hash plus the files it was built from. */
+struct ShaderCacheRequest {
+    ShaderCacheKey key{};
+    std::vector<std::string> dependencies;  // Absolute, normalized: source path, then includes
+};
+
 class ShaderCacheImpl : public IShaderCache {
 public:
+    ~ShaderCacheImpl() override;
+
     bool LoadCache(char const* path) override;
     bool SaveCache(char const* path) override;
     void Invalidate(IShaderHandle* handle) override;
+    uint32_t InvalidateFile(char const* path) override;
+    void SetMaxSize(uint64_t bytes) override;
+    ShaderCacheStats GetStats() const override;
 
-    void StoreFromHandle(ShaderHandleImpl* handle);
-    bool TryLoadToHandle(ShaderHandleImpl* handle);
+    /** Compiler name and version mixed into every key; set by ShaderCompilerImpl::SetCache. */
+    void SetCompilerIdentity(std::string identity);
+    /** Hashes source, include closure, macros and options of the handle's current variant. */
+    ShaderCacheRequest MakeRequest(ShaderHandleImpl const* handle, CompileOptions const& options) const;
+    /** Copies the cached variant into handle (current variant slot and legacy bytecode). */
+    bool TryLoadToHandle(ShaderHandleImpl* handle, ShaderCacheRequest const& request);
+    /** Stores the handle's current bytecode under request.key; writes through when a directory is attached. */
+    void StoreFromHandle(ShaderHandleImpl* handle, ShaderCacheRequest const& request);
 
 private:
-    using Key = std::string;
-    std::unordered_map<Key, std::unordered_map<uint64_t, VariantBytecode>> store_;
+    struct Entry {
+        VariantBytecode bytecode;
+        bool loaded = false;  // bytecode is in memory
+        bool onDisk = false;
+        uint64_t size = 0;    // Serialized bytes
+        uint64_t lastUse = 0;
+        std::vector<std::string> dependencies;
+    };
+
+    void linkDependencies(ShaderCacheKey const& key, std::vector<std::string> const& deps);
+    void removeEntry(ShaderCacheKey const& key, bool deleteFile);
+    bool loadEntry(ShaderCacheKey const& key, Entry& entry);
+    bool writeIndex();
+    void indexDirectory();
+    void enforceLimit(ShaderCacheKey const& keep);
+
+    mutable std::mutex mutex_;
+    std::string compilerIdentity_;
+    std::string dir_;  // Attached directory; empty = memory only
+    std::unordered_map<ShaderCacheKey, Entry, ShaderCacheKeyHash> entries_;
+    std::unordered_map<std::string, std::unordered_set<ShaderCacheKey, ShaderCacheKeyHash>> dependents_;
+    uint64_t maxBytes_ = kDefaultShaderCacheMaxBytes;
+    uint64_t totalBytes_ = 0;
+    uint64_t tick_ = 0;
+    uint64_t hits_ = 0;
+    uint64_t misses_ = 0;
+    uint64_t evictions_ = 0;
+    bool indexDirty_ = false;
 };
 
 }  // namespace te::shader
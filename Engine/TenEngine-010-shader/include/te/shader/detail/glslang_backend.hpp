@@ -9,6 +9,8 @@ class ShaderHandleImpl;
 
 bool CompileGlslToSpirv(ShaderHandleImpl* handle, CompileOptions const& options, std::string& outError);
 bool CompileHlslToSpirv(ShaderHandleImpl* handle, CompileOptions const& options, std::string& outError);
+/** "major.minor.patch[-flavor]" of the linked glslang. */
+std::string GetGlslangVersion();
 }  // namespace te::shader
 
 #endif
@@ -22,6 +22,17 @@ struct VariantBytecode {
     std::string crossCompiled;
 };
 
+/** 128-bit content key of a compiled variant (see ShaderCacheImpl::MakeRequest). */
+struct ShaderCacheKey {
+    uint64_t lo = 0;
+    uint64_t hi = 0;
+    bool operator==(ShaderCacheKey const& o) const { return lo == o.lo && hi == o.hi; }
+};
+
+struct ShaderCacheKeyHash {
+    size_t operator()(ShaderCacheKey const& k) const { return static_cast<size_t>(k.lo ^ (k.hi * 0x9E3779B97F4A7C15ull)); }
+};
+
 class ShaderHandleImpl : public IShaderHandle {
 public:
     MacroSet macros_{};
@@ -34,6 +45,7 @@ public:
     ShaderSourceFormat sourceFormat_ = ShaderSourceFormat::GLSL;
     std::unordered_map<uint64_t, MacroSet> variantMacros_;   // key.hash -> MacroSet for SelectVariant
     std::unordered_map<uint64_t, VariantBytecode> variantBytecode_;  // per-variant cache
+    std::vector<ShaderCacheKey> cacheKeys_;  // Cache entries this handle stored or loaded
 #if defined(TE_SHADER_USE_CORE) && TE_SHADER_USE_CORE
     std::vector<te::rendercore::UniformMember> reflectionMembers_;
     uint32_t reflectionTotalSize_ = 0;
@@ -3,8 +3,9 @@
 
 #include <te/shader/compiler.hpp>
 #include <te/shader/hot_reload.hpp>
+#include <te/resource/ResourceHotReload.h>
 #include <atomic>
-#include <filesystem>
+#include <memory>
 #include <mutex>
 #include <string>
 #include <thread>
@@ -14,9 +15,9 @@ namespace te::shader {
 
 struct WatchedPath {
     std::string path;
+    std::string watchPath;  // Absolute and normalized, as reported by IFileWatcher
     SourceChangedCallback callback;
     void* userData;
-    std::filesystem::file_time_type lastMtime;
 };
 
 class ShaderHotReloadImpl : public IShaderHotReload {
@@ -28,10 +29,12 @@ public:
     void NotifyShaderUpdated(IShaderHandle* handle) override;
 
 private:
+    static void onFileChanged(te::resource::FileChangeEvent const& event, void* userData);
     void watchThreadFunc();
 
     IShaderCompiler* compiler_;
     IShaderCache* cache_;
+    std::unique_ptr<te::resource::IFileWatcher> watcher_;
     std::vector<WatchedPath> watched_;
     std::mutex watchedMutex_;
     std::atomic<bool> stop_{false};
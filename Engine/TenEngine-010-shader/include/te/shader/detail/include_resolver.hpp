@@ -0,0 +1,18 @@
+#ifndef TE_SHADER_DETAIL_INCLUDE_RESOLVER_HPP
+#define TE_SHADER_DETAIL_INCLUDE_RESOLVER_HPP
+
+#include <filesystem>
+#include <string>
+
+namespace te::shader {
+
+/** Path of `#include "name"` or `#include <name>` in the file includer: both forms resolve
+ *  against the includer's directory (an empty includer, i.e. a source loaded from memory,
+ *  resolves against the working directory). The cache key and every backend use this rule. */
+std::filesystem::path ResolveIncludePath(std::filesystem::path const& includer, std::string const& name);
+/** Reads an include file; false if it cannot be opened. */
+bool ReadIncludeFile(std::filesystem::path const& path, std::string& out);
+
+}  // namespace te::shader
+
+#endif
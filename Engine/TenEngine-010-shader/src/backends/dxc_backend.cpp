@@ -3,8 +3,11 @@
 #include <te/shader/types.hpp>
 
 #if defined(TE_SHADER_HAVE_DXC) && TE_SHADER_HAVE_DXC
+#include <te/shader/detail/include_resolver.hpp>
 #include <dxcapi.h>
 #include <wrl/client.h>
+#include <atomic>
+#include <filesystem>
 #include <string>
 #include <vector>
 #endif
@@ -48,7 +51,45 @@ void utf8EntryPointToWide(char const* entry, std::wstring& out) {
     for (size_t i = 0; i < len; ++i) out[i] = static_cast<wchar_t>(static_cast<unsigned char>(entry[i]));
 }
 
-bool compileHlslToDxilImpl(char const* source, size_t sourceLen, wchar_t const* entryPoint,
+// Reads the files clang asks for with ReadIncludeFile. The source path is passed as the main
+// file name and its directory as -I, so "x" resolves next to the including file and <x> next
+// to the root shader, matching ResolveIncludePath except for <x> inside a nested include
+// from another directory. Lives on the stack for one Compile call.
+class ShaderIncludeHandler : public IDxcIncludeHandler {
+public:
+    explicit ShaderIncludeHandler(IDxcUtils* utils) : utils_(utils) {}
+
+    HRESULT STDMETHODCALLTYPE LoadSource(LPCWSTR pFilename, IDxcBlob** ppIncludeSource) override {
+        if (!pFilename || !ppIncludeSource) return E_INVALIDARG;
+        *ppIncludeSource = nullptr;
+        std::string content;
+        if (!ReadIncludeFile(std::filesystem::path(pFilename).lexically_normal(), content))
+            return HRESULT_FROM_WIN32(ERROR_FILE_NOT_FOUND);
+        Microsoft::WRL::ComPtr<IDxcBlobEncoding> blob;
+        HRESULT hr = utils_->CreateBlob(content.data(), static_cast<UINT32>(content.size()), CP_UTF8, &blob);
+        if (FAILED(hr)) return hr;
+        *ppIncludeSource = blob.Detach();
+        return S_OK;
+    }
+    HRESULT STDMETHODCALLTYPE QueryInterface(REFIID riid, void** ppvObject) override {
+        if (!ppvObject) return E_POINTER;
+        if (riid == __uuidof(IDxcIncludeHandler) || riid == __uuidof(IUnknown)) {
+            *ppvObject = static_cast<IDxcIncludeHandler*>(this);
+            AddRef();
+            return S_OK;
+        }
+        *ppvObject = nullptr;
+        return E_NOINTERFACE;
+    }
+    ULONG STDMETHODCALLTYPE AddRef() override { return ++refs_; }
+    ULONG STDMETHODCALLTYPE Release() override { return --refs_; }
+
+private:
+    IDxcUtils* utils_;
+    std::atomic<ULONG> refs_{1};
+};
+
+bool compileHlslToDxilImpl(char const* source, size_t sourceLen, std::string const& sourcePath, wchar_t const* entryPoint,
                            wchar_t const* targetProfile, uint32_t optimizationLevel,
                            bool generateDebugInfo, std::vector<uint8_t>& outDxil,
                            std::string& outError) {
@@ -56,7 +97,6 @@ bool compileHlslToDxilImpl(char const* source, size_t sourceLen, wchar_t const*
 
     ComPtr<IDxcUtils> utils;
     ComPtr<IDxcCompiler3> compiler;
-    ComPtr<IDxcIncludeHandler> includeHandler;
     if (FAILED(DxcCreateInstance(CLSID_DxcUtils, IID_PPV_ARGS(&utils)))) {
         outError = "DXC: Failed to create DxcUtils";
         return false;
@@ -65,10 +105,6 @@ bool compileHlslToDxilImpl(char const* source, size_t sourceLen, wchar_t const*
         outError = "DXC: Failed to create DxcCompiler";
         return false;
     }
-    if (FAILED(utils->CreateDefaultIncludeHandler(&includeHandler))) {
-        outError = "DXC: Failed to create include handler";
-        return false;
-    }
 
     ComPtr<IDxcBlobEncoding> sourceBlob;
     if (FAILED(utils->CreateBlob(source, static_cast<UINT32>(sourceLen), CP_UTF8, &sourceBlob))) {
@@ -86,10 +122,23 @@ bool compileHlslToDxilImpl(char const* source, size_t sourceLen, wchar_t const*
     uint32_t oIdx = (optimizationLevel <= 3u) ? optimizationLevel : 1u;
     optStrings.push_back(oLevels[oIdx]);
     if (generateDebugInfo) optStrings.push_back(L"-Zi");
+    std::wstring sourceName;
+    std::wstring sourceDir;
+    if (!sourcePath.empty()) {
+        std::filesystem::path const path(sourcePath);
+        sourceName = path.wstring();
+        sourceDir = path.parent_path().empty() ? std::wstring(L".") : path.parent_path().wstring();
+    }
     std::vector<LPCWSTR> args = {L"-E", entryPoint, L"-T", targetProfile};
     for (auto const& s : optStrings) args.push_back(s.c_str());
+    if (!sourceName.empty()) {
+        args.push_back(sourceName.c_str());
+        args.push_back(L"-I");
+        args.push_back(sourceDir.c_str());
+    }
+    ShaderIncludeHandler includeHandler(utils.Get());
     ComPtr<IDxcResult> result;
-    HRESULT hr = compiler->Compile(&sourceBuffer, args.data(), static_cast<UINT32>(args.size()), includeHandler.Get(),
+    HRESULT hr = compiler->Compile(&sourceBuffer, args.data(), static_cast<UINT32>(args.size()), &includeHandler,
                                    IID_PPV_ARGS(&result));
     if (FAILED(hr)) {
         outError = "DXC: Compile failed";
@@ -129,7 +178,7 @@ bool CompileHlslToDxbc(ShaderHandleImpl* handle, CompileOptions const& options,
     std::wstring entryWide;
     utf8EntryPointToWide(options.entryPoint[0] != '\0' ? options.entryPoint : "main", entryWide);
     return compileHlslToDxilImpl(
-        handle->sourceCode_.c_str(), handle->sourceCode_.size(),
+        handle->sourceCode_.c_str(), handle->sourceCode_.size(), handle->sourcePath_,
         entryWide.c_str(), profile,
         options.optimizationLevel, options.generateDebugInfo,
         handle->bytecodeBlob_, outError);
@@ -145,7 +194,7 @@ bool CompileHlslToDxil(ShaderHandleImpl* handle, CompileOptions const& options,
     std::wstring entryWide;
     utf8EntryPointToWide(options.entryPoint[0] != '\0' ? options.entryPoint : "main", entryWide);
     return compileHlslToDxilImpl(
-        handle->sourceCode_.c_str(), handle->sourceCode_.size(),
+        handle->sourceCode_.c_str(), handle->sourceCode_.size(), handle->sourcePath_,
         entryWide.c_str(), profile,
         options.optimizationLevel, options.generateDebugInfo,
         handle->bytecodeBlob_, outError);
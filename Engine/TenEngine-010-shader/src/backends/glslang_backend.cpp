@@ -1,9 +1,11 @@
 #include <te/shader/detail/glslang_backend.hpp>
 #include <te/shader/detail/handle_impl.hpp>
+#include <te/shader/detail/include_resolver.hpp>
 #include <te/shader/types.hpp>
 #include <glslang/Public/ShaderLang.h>
 #include <SPIRV/GlslangToSpv.h>
 #include <cstring>
+#include <filesystem>
 #include <string>
 #include <vector>
 
@@ -23,6 +25,36 @@ EShLanguage shaderStageToEShLanguage(ShaderStage stage) {
     }
 }
 
+// Serves #include "x" and <x> through ResolveIncludePath, the rule the cache key follows.
+// glslang passes back the headerName of the enclosing include as includerName, and the
+// source path for the top-level file.
+class ShaderIncluder : public glslang::TShader::Includer {
+public:
+    IncludeResult* includeLocal(char const* headerName, char const* includerName, size_t) override {
+        return include(headerName, includerName);
+    }
+    IncludeResult* includeSystem(char const* headerName, char const* includerName, size_t) override {
+        return include(headerName, includerName);
+    }
+    void releaseInclude(IncludeResult* result) override {
+        if (result) {
+            delete static_cast<std::string*>(result->userData);
+            delete result;
+        }
+    }
+
+private:
+    static IncludeResult* include(char const* headerName, char const* includerName) {
+        std::filesystem::path const path = ResolveIncludePath(includerName ? includerName : "", headerName);
+        auto* content = new std::string();
+        if (!ReadIncludeFile(path, *content)) {
+            delete content;
+            return nullptr;
+        }
+        return new IncludeResult(path.generic_string(), content->data(), content->size(), content);
+    }
+};
+
 EShLanguage inferStageFromPath(std::string const& path) {
     if (path.find(".frag") != std::string::npos) return EShLangFragment;
     if (path.find(".comp") != std::string::npos) return EShLangCompute;
@@ -32,12 +64,13 @@ EShLanguage inferStageFromPath(std::string const& path) {
     return EShLangVertex;
 }
 
-bool compileGlslToSpirv(char const* source, EShLanguage stage, CompileOptions const* options, std::vector<uint32_t>& outSpirv, std::string& outError) {
+bool compileGlslToSpirv(char const* source, char const* sourceName, EShLanguage stage, CompileOptions const* options, std::vector<uint32_t>& outSpirv, std::string& outError) {
     glslang::InitializeProcess();
 
     const char* const sources[] = { source };
+    const char* const names[] = { sourceName };
     glslang::TShader shader(stage);
-    shader.setStrings(sources, 1);
+    shader.setStringsWithLengthsAndNames(sources, nullptr, names, 1);
 
     TBuiltInResource resources = {};
     resources.maxLights = 32;
@@ -134,7 +167,8 @@ bool compileGlslToSpirv(char const* source, EShLanguage stage, CompileOptions co
     resources.limits.generalConstantMatrixVectorIndexing = true;
 
     EShMessages messages = static_cast<EShMessages>(EShMsgSpvRules | EShMsgVulkanRules);
-    if (!shader.parse(&resources, 100, false, messages)) {
+    ShaderIncluder includer;
+    if (!shader.parse(&resources, 100, false, messages, includer)) {
         outError = shader.getInfoLog();
         glslang::FinalizeProcess();
         return false;
@@ -163,15 +197,20 @@ bool compileGlslToSpirv(char const* source, EShLanguage stage, CompileOptions co
 
 bool CompileGlslToSpirv(ShaderHandleImpl* handle, CompileOptions const& options, std::string& outError) {
     std::string source = handle->sourceCode_;
-    if (handle->macros_.count > 0) {
-        std::string preamble;
-        for (uint32_t i = 0; i < handle->macros_.count && i < MacroSet::kMaxPairs; ++i) {
-            preamble += "#define ";
-            preamble += handle->macros_.names[i];
-            preamble += " ";
-            preamble += handle->macros_.values[i];
-            preamble += "\n";
-        }
+    std::string preamble;
+    // GLSL only accepts #include with the extension enabled
+    if (source.find("#include") != std::string::npos &&
+        source.find("GL_GOOGLE_include_directive") == std::string::npos) {
+        preamble += "#extension GL_GOOGLE_include_directive : require\n";
+    }
+    for (uint32_t i = 0; i < handle->macros_.count && i < MacroSet::kMaxPairs; ++i) {
+        preamble += "#define ";
+        preamble += handle->macros_.names[i];
+        preamble += " ";
+        preamble += handle->macros_.values[i];
+        preamble += "\n";
+    }
+    if (!preamble.empty()) {
         size_t insertPos = 0;
         size_t pos = source.find("#version");
         if (pos != std::string::npos) {
@@ -184,7 +223,7 @@ bool CompileGlslToSpirv(ShaderHandleImpl* handle, CompileOptions const& options,
     EShLanguage stage = (options.stage != ShaderStage::Unknown)
         ? shaderStageToEShLanguage(options.stage)
         : inferStageFromPath(handle->sourcePath_);
-    return compileGlslToSpirv(source.c_str(), stage, &options, handle->bytecode_, outError);
+    return compileGlslToSpirv(source.c_str(), handle->sourcePath_.c_str(), stage, &options, handle->bytecode_, outError);
 }
 
 bool CompileHlslToSpirv(ShaderHandleImpl* handle, CompileOptions const& options, std::string& outError) {
@@ -193,12 +232,13 @@ bool CompileHlslToSpirv(ShaderHandleImpl* handle, CompileOptions const& options,
         : EShLangVertex;
     glslang::InitializeProcess();
     char const* sources[] = { handle->sourceCode_.c_str() };
+    char const* names[] = { handle->sourcePath_.c_str() };
     glslang::TShader shader(stage);
     shader.setEnvInput(glslang::EShSourceHlsl, stage, glslang::EShClientVulkan, 100);
     shader.setEnvClient(glslang::EShClientVulkan, glslang::EShTargetVulkan_1_0);
     shader.setEnvTarget(glslang::EShTargetSpv, glslang::EShTargetSpv_1_0);
     shader.setEntryPoint(options.entryPoint[0] != '\0' ? options.entryPoint : "main");
-    shader.setStrings(sources, 1);
+    shader.setStringsWithLengthsAndNames(sources, nullptr, names, 1);
 
     TBuiltInResource resources = {};
     resources.maxLights = 32;
@@ -235,7 +275,8 @@ bool CompileHlslToSpirv(ShaderHandleImpl* handle, CompileOptions const& options,
     resources.limits.generalVariableIndexing = true;
 
     EShMessages messages = static_cast<EShMessages>(EShMsgSpvRules | EShMsgVulkanRules);
-    if (!shader.parse(&resources, 100, false, messages)) {
+    ShaderIncluder includer;
+    if (!shader.parse(&resources, 100, false, messages, includer)) {
         outError = shader.getInfoLog();
         glslang::FinalizeProcess();
         return false;
@@ -256,4 +297,14 @@ bool CompileHlslToSpirv(ShaderHandleImpl* handle, CompileOptions const& options,
     return true;
 }
 
+std::string GetGlslangVersion() {
+    glslang::Version v = glslang::GetVersion();
+    std::string s = std::to_string(v.major) + "." + std::to_string(v.minor) + "." + std::to_string(v.patch);
+    if (v.flavor && v.flavor[0] != '\0') {
+        s += "-";
+        s += v.flavor;
+    }
+    return s;
+}
+
 }  // namespace te::shader
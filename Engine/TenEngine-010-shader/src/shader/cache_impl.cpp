@@ -1,52 +1,380 @@
 #include <te/shader/detail/cache_impl.hpp>
+#include <te/shader/detail/include_resolver.hpp>
 #if defined(TE_SHADER_USE_CORE) && TE_SHADER_USE_CORE
-#include <te/core/platform.h>
 #include <te/core/log.h>
 #endif
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cstdio>
 #include <cstring>
+#include <filesystem>
 #include <fstream>
+#include <functional>
 #include <iterator>
-#include <sstream>
-#include <vector>
+#include <thread>
+#include <utility>
+
+namespace fs = std::filesystem;
 
 namespace te::shader {
 
 namespace {
-uint64_t hashSource(char const* path, char const* code, size_t codeLen) {
-    uint64_t h = 0;
-    if (path) for (; *path; ++path) h = h * 31u + static_cast<unsigned char>(*path);
-    h = h * 31u + ':';
-    for (size_t i = 0; i < codeLen; ++i) h = h * 31u + static_cast<unsigned char>(code[i]);
-    return h;
-}
-std::string makeKey(ShaderHandleImpl* h) {
-    std::ostringstream os;
-    os << (h->sourcePath_.empty() ? "(memory)" : h->sourcePath_)
-       << ":" << hashSource(h->sourcePath_.c_str(), h->sourceCode_.data(), h->sourceCode_.size());
-    return os.str();
-}
-static constexpr char const* kMagic = "TESC\x01\0\0\0";
-static constexpr uint32_t kVersion = 1;
+
+// Bump when the key material or the entry layout changes; old entries then simply miss
+constexpr uint32_t kKeyVersion = 1;
+constexpr uint32_t kEntryVersion = 1;
+constexpr uint32_t kIndexVersion = 1;
+constexpr char kEntryMagic[4] = {'T', 'E', 'S', 'V'};
+constexpr char kIndexMagic[4] = {'T', 'E', 'S', 'I'};
+constexpr char const* kEntryExtension = ".tesv";
+constexpr char const* kIndexFile = "index.bin";
+constexpr uint32_t kMaxIncludeDepth = 32;
+
+void logError(char const* msg) {
+#if defined(TE_SHADER_USE_CORE) && TE_SHADER_USE_CORE
+    te::core::Log(te::core::LogLevel::Error, msg);
+#else
+    (void)msg;
+#endif
+}
+
+// MurmurHash3 x64_128
+inline uint64_t rotl64(uint64_t x, int r) { return (x << r) | (x >> (64 - r)); }
+
+inline uint64_t fmix64(uint64_t k) {
+    k ^= k >> 33;
+    k *= 0xff51afd7ed558ccdull;
+    k ^= k >> 33;
+    k *= 0xc4ceb9fe1a85ec53ull;
+    k ^= k >> 33;
+    return k;
+}
+
+ShaderCacheKey hash128(void const* data, size_t len) {
+    constexpr uint64_t c1 = 0x87c37b91114253d5ull;
+    constexpr uint64_t c2 = 0x4cf5ad432745937full;
+    auto const* p = static_cast<uint8_t const*>(data);
+    uint64_t h1 = 0, h2 = 0;
+    size_t const blocks = len / 16;
+    for (size_t i = 0; i < blocks; ++i) {
+        uint64_t k1, k2;
+        std::memcpy(&k1, p + i * 16, 8);
+        std::memcpy(&k2, p + i * 16 + 8, 8);
+        k1 *= c1; k1 = rotl64(k1, 31); k1 *= c2; h1 ^= k1;
+        h1 = rotl64(h1, 27); h1 += h2; h1 = h1 * 5 + 0x52dce729;
+        k2 *= c2; k2 = rotl64(k2, 33); k2 *= c1; h2 ^= k2;
+        h2 = rotl64(h2, 31); h2 += h1; h2 = h2 * 5 + 0x38495ab5;
+    }
+    uint8_t const* tail = p + blocks * 16;
+    size_t const rem = len & 15;
+    uint64_t k1 = 0, k2 = 0;
+    for (size_t i = rem; i > 8; --i) k2 ^= static_cast<uint64_t>(tail[i - 1]) << ((i - 9) * 8);
+    if (rem > 8) { k2 *= c2; k2 = rotl64(k2, 33); k2 *= c1; h2 ^= k2; }
+    for (size_t i = std::min<size_t>(rem, 8); i > 0; --i) k1 ^= static_cast<uint64_t>(tail[i - 1]) << ((i - 1) * 8);
+    if (rem > 0) { k1 *= c1; k1 = rotl64(k1, 31); k1 *= c2; h1 ^= k1; }
+    h1 ^= len; h2 ^= len;
+    h1 += h2; h2 += h1;
+    h1 = fmix64(h1); h2 = fmix64(h2);
+    h1 += h2; h2 += h1;
+    return {h1, h2};
+}
+
+struct ByteWriter {
+    std::vector<uint8_t> buf;
+    void bytes(void const* p, size_t n) {
+        auto const* b = static_cast<uint8_t const*>(p);
+        buf.insert(buf.end(), b, b + n);
+    }
+    void u8(uint8_t v) { buf.push_back(v); }
+    void u32(uint32_t v) { bytes(&v, 4); }
+    void u64(uint64_t v) { bytes(&v, 8); }
+    void str(std::string const& s) { u32(static_cast<uint32_t>(s.size())); bytes(s.data(), s.size()); }
+    void key(ShaderCacheKey const& k) { u64(k.lo); u64(k.hi); }
+};
+
+struct ByteReader {
+    uint8_t const* p;
+    size_t size;
+    size_t pos = 0;
+    bool ok = true;
+    bool bytes(void* out, size_t n) {
+        if (!ok || n > size - pos) return ok = false;
+        if (n) std::memcpy(out, p + pos, n);
+        pos += n;
+        return true;
+    }
+    uint32_t u32() { uint32_t v = 0; bytes(&v, 4); return v; }
+    uint64_t u64() { uint64_t v = 0; bytes(&v, 8); return v; }
+    std::string str() {
+        uint32_t n = u32();
+        if (!ok || n > size - pos) { ok = false; return {}; }
+        std::string s(reinterpret_cast<char const*>(p + pos), n);
+        pos += n;
+        return s;
+    }
+    ShaderCacheKey key() { ShaderCacheKey k; k.lo = u64(); k.hi = u64(); return k; }
+};
+
+bool readFile(fs::path const& path, std::string& out) {
+    std::ifstream f(path, std::ios::binary);
+    if (!f) return false;
+    out.assign(std::istreambuf_iterator<char>(f), std::istreambuf_iterator<char>());
+    return !f.bad();
+}
+
+// Writes a uniquely named temporary next to path and renames it over path, so readers
+// (including other processes sharing the directory) see either the old or the new file
+bool writeFileAtomic(fs::path const& path, std::vector<uint8_t> const& data) {
+    static std::atomic<uint64_t> counter{0};
+    uint64_t unique = counter.fetch_add(1) ^ static_cast<uint64_t>(std::hash<std::thread::id>{}(std::this_thread::get_id()))
+        ^ static_cast<uint64_t>(std::chrono::steady_clock::now().time_since_epoch().count());
+    fs::path tmp = path;
+    tmp += "." + std::to_string(unique) + ".tmp";
+    {
+        std::ofstream f(tmp, std::ios::binary | std::ios::trunc);
+        if (!f) return false;
+        f.write(reinterpret_cast<char const*>(data.data()), static_cast<std::streamsize>(data.size()));
+        if (!f) {
+            f.close();
+            std::error_code ec;
+            fs::remove(tmp, ec);
+            return false;
+        }
+    }
+    std::error_code ec;
+    fs::rename(tmp, path, ec);
+    if (ec) {
+        fs::remove(tmp, ec);
+        return false;
+    }
+    return true;
+}
+
+std::string normalizePath(fs::path const& p) {
+    std::error_code ec;
+    fs::path abs = fs::absolute(p, ec);
+    return (ec ? p : abs).lexically_normal().generic_string();
+}
+
+std::string boundedString(char const* s, size_t maxLen) {
+    void const* nul = std::memchr(s, '\0', maxLen);
+    return std::string(s, nul ? static_cast<char const*>(nul) - s : maxLen);
+}
+
+std::string keyToHex(ShaderCacheKey const& k) {
+    char buf[33];
+    std::snprintf(buf, sizeof(buf), "%016llx%016llx", static_cast<unsigned long long>(k.hi),
+                  static_cast<unsigned long long>(k.lo));
+    return buf;
+}
+
+bool hexToKey(std::string const& s, ShaderCacheKey* out) {
+    if (s.size() != 32 || s.find_first_not_of("0123456789abcdef") != std::string::npos) return false;
+    out->hi = std::stoull(s.substr(0, 16), nullptr, 16);
+    out->lo = std::stoull(s.substr(16), nullptr, 16);
+    return true;
+}
+
+fs::path entryPath(std::string const& dir, ShaderCacheKey const& key) {
+    return fs::path(dir) / (keyToHex(key) + kEntryExtension);
+}
+
+/** Names of #include "x" / #include <x> directives, in order. */
+std::vector<std::string> parseIncludes(std::string const& source) {
+    std::vector<std::string> out;
+    size_t pos = 0;
+    while (pos < source.size()) {
+        size_t end = source.find('\n', pos);
+        if (end == std::string::npos) end = source.size();
+        size_t i = source.find_first_not_of(" \t", pos);
+        if (i < end && source[i] == '#') {
+            i = source.find_first_not_of(" \t", i + 1);
+            if (i < end && source.compare(i, 7, "include") == 0) {
+                i = source.find_first_not_of(" \t", i + 7);
+                if (i < end && (source[i] == '"' || source[i] == '<')) {
+                    char close = source[i] == '"' ? '"' : '>';
+                    size_t nameEnd = source.find(close, i + 1);
+                    if (nameEnd != std::string::npos && nameEnd < end)
+                        out.push_back(source.substr(i + 1, nameEnd - i - 1));
+                }
+            }
+        }
+        pos = end + 1;
+    }
+    return out;
+}
+
+// Mixes every include reachable from source (resolved with ResolveIncludePath, as the backends
+// do) into w: name, then content hash, or a marker for a file seen before or not found
+void hashIncludeClosure(std::string const& source, fs::path const& includer, uint32_t depth, ByteWriter& w,
+                        std::vector<std::string>& deps) {
+    for (std::string const& name : parseIncludes(source)) {
+        w.str(name);
+        fs::path resolved = ResolveIncludePath(includer, name);
+        std::string norm = normalizePath(resolved);
+        if (std::find(deps.begin(), deps.end(), norm) != deps.end()) {
+            w.u8(2);
+            continue;
+        }
+        std::string content;
+        if (depth >= kMaxIncludeDepth || !ReadIncludeFile(resolved, content)) {
+            w.u8(0);
+            continue;
+        }
+        w.u8(1);
+        w.key(hash128(content.data(), content.size()));
+        deps.push_back(norm);
+        hashIncludeClosure(content, resolved, depth + 1, w, deps);
+    }
+}
+
+void serializeBytecode(ByteWriter& w, VariantBytecode const& vb) {
+    w.u32(static_cast<uint32_t>(vb.spirv.size()));
+    w.bytes(vb.spirv.data(), vb.spirv.size() * sizeof(uint32_t));
+    w.u32(static_cast<uint32_t>(vb.dxil.size()));
+    w.bytes(vb.dxil.data(), vb.dxil.size());
+    w.u32(static_cast<uint32_t>(vb.crossCompiled.size()));
+    w.bytes(vb.crossCompiled.data(), vb.crossCompiled.size());
+}
+
+std::vector<uint8_t> serializeEntry(ShaderCacheKey const& key, std::vector<std::string> const& deps,
+                                    VariantBytecode const& vb) {
+    ByteWriter w;
+    w.bytes(kEntryMagic, 4);
+    w.u32(kEntryVersion);
+    w.key(key);
+    w.u32(static_cast<uint32_t>(deps.size()));
+    for (std::string const& d : deps) w.str(d);
+    serializeBytecode(w, vb);
+    w.u64(hash128(w.buf.data(), w.buf.size()).lo);
+    return std::move(w.buf);
+}
+
+/** Parses an entry file; false on a bad header, a key mismatch or a checksum mismatch. */
+bool parseEntry(std::string const& data, ShaderCacheKey const& key, std::vector<std::string>& deps,
+                VariantBytecode& vb) {
+    if (data.size() < 4 + 4 + 16 + 8) return false;
+    size_t const body = data.size() - 8;
+    uint64_t checksum;
+    std::memcpy(&checksum, data.data() + body, 8);
+    if (hash128(data.data(), body).lo != checksum) return false;
+    ByteReader r{reinterpret_cast<uint8_t const*>(data.data()), body};
+    char magic[4];
+    r.bytes(magic, 4);
+    if (!r.ok || std::memcmp(magic, kEntryMagic, 4) != 0 || r.u32() != kEntryVersion) return false;
+    if (!(r.key() == key)) return false;
+    uint32_t depCount = r.u32();
+    deps.clear();
+    for (uint32_t i = 0; i < depCount && r.ok; ++i) deps.push_back(r.str());
+    uint32_t n = r.u32();
+    if (!r.ok || n > (body - r.pos) / sizeof(uint32_t)) return false;
+    vb.spirv.resize(n);
+    r.bytes(vb.spirv.data(), n * sizeof(uint32_t));
+    n = r.u32();
+    if (!r.ok || n > body - r.pos) return false;
+    vb.dxil.resize(n);
+    r.bytes(vb.dxil.data(), n);
+    n = r.u32();
+    if (!r.ok || n > body - r.pos) return false;
+    vb.crossCompiled.resize(n);
+    r.bytes(vb.crossCompiled.data(), n);
+    return r.ok && r.pos == body;
+}
+
 }  // namespace
 
-void ShaderCacheImpl::StoreFromHandle(ShaderHandleImpl* handle) {
-    if (!handle || handle->variantBytecode_.empty()) return;
-    std::string key = makeKey(handle);
-    auto& map = store_[key];
-    for (auto const& p : handle->variantBytecode_) {
-        map[p.first] = p.second;
+ShaderCacheImpl::~ShaderCacheImpl() {
+    std::lock_guard<std::mutex> lock(mutex_);
+    if (indexDirty_) writeIndex();
+}
+
+void ShaderCacheImpl::SetCompilerIdentity(std::string identity) {
+    std::lock_guard<std::mutex> lock(mutex_);
+    compilerIdentity_ = std::move(identity);
+}
+
+ShaderCacheRequest ShaderCacheImpl::MakeRequest(ShaderHandleImpl const* handle, CompileOptions const& options) const {
+    ShaderCacheRequest req;
+    ByteWriter w;
+    w.bytes(kEntryMagic, 4);
+    w.u32(kKeyVersion);
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        w.str(compilerIdentity_);
+    }
+    w.u32(static_cast<uint32_t>(handle->sourceFormat_));
+    w.u32(static_cast<uint32_t>(options.targetBackend));
+    w.u32(static_cast<uint32_t>(options.stage));
+    // An unknown stage is inferred from the file extension
+    w.str(options.stage == ShaderStage::Unknown ? fs::path(handle->sourcePath_).extension().string() : std::string());
+    w.str(boundedString(options.entryPoint, CompileOptions::kMaxEntryPointLen));
+    w.u32(options.optimizationLevel);
+    w.u8(options.generateDebugInfo ? 1 : 0);
+    uint32_t macroCount = std::min<uint32_t>(handle->macros_.count, static_cast<uint32_t>(MacroSet::kMaxPairs));
+    w.u32(macroCount);
+    for (uint32_t i = 0; i < macroCount; ++i) {
+        w.str(boundedString(handle->macros_.names[i], sizeof(handle->macros_.names[i])));
+        w.str(boundedString(handle->macros_.values[i], sizeof(handle->macros_.values[i])));
     }
+    w.key(hash128(handle->sourceCode_.data(), handle->sourceCode_.size()));
+    if (!handle->sourcePath_.empty()) {
+        req.dependencies.push_back(normalizePath(handle->sourcePath_));
+    }
+    hashIncludeClosure(handle->sourceCode_, fs::path(handle->sourcePath_), 0, w, req.dependencies);
+    req.key = hash128(w.buf.data(), w.buf.size());
+    return req;
 }
 
-bool ShaderCacheImpl::TryLoadToHandle(ShaderHandleImpl* handle) {
+bool ShaderCacheImpl::TryLoadToHandle(ShaderHandleImpl* handle, ShaderCacheRequest const& request) {
     if (!handle) return false;
-    std::string key = makeKey(handle);
-    auto it = store_.find(key);
-    if (it == store_.end()) return false;
-    for (auto const& p : it->second) {
-        handle->variantBytecode_[p.first] = p.second;
+    std::lock_guard<std::mutex> lock(mutex_);
+    auto it = entries_.find(request.key);
+    if (it == entries_.end()) {
+        ++misses_;
+        return false;
     }
-    return !it->second.empty();
+    if (!it->second.loaded && !loadEntry(request.key, it->second)) {
+        removeEntry(request.key, true);
+        ++misses_;
+        return false;
+    }
+    ++hits_;
+    it->second.lastUse = ++tick_;
+    indexDirty_ = true;
+    VariantBytecode const& vb = it->second.bytecode;
+    handle->variantBytecode_[handle->currentKey_.hash] = vb;
+    handle->bytecode_ = vb.spirv;
+    handle->bytecodeBlob_ = vb.dxil;
+    handle->crossCompiledSource_ = vb.crossCompiled;
+    if (std::find(handle->cacheKeys_.begin(), handle->cacheKeys_.end(), request.key) == handle->cacheKeys_.end())
+        handle->cacheKeys_.push_back(request.key);
+    return true;
+}
+
+void ShaderCacheImpl::StoreFromHandle(ShaderHandleImpl* handle, ShaderCacheRequest const& request) {
+    if (!handle) return;
+    std::lock_guard<std::mutex> lock(mutex_);
+    if (entries_.count(request.key)) removeEntry(request.key, false);
+    Entry& e = entries_[request.key];
+    e.bytecode.spirv = handle->bytecode_;
+    e.bytecode.dxil = handle->bytecodeBlob_;
+    e.bytecode.crossCompiled = handle->crossCompiledSource_;
+    e.loaded = true;
+    e.lastUse = ++tick_;
+    e.dependencies = request.dependencies;
+    std::vector<uint8_t> bytes = serializeEntry(request.key, e.dependencies, e.bytecode);
+    e.size = bytes.size();
+    totalBytes_ += e.size;
+    if (!dir_.empty()) {
+        e.onDisk = writeFileAtomic(entryPath(dir_, request.key), bytes);
+        if (!e.onDisk) logError("ShaderCacheImpl::StoreFromHandle: entry write failed");
+    }
+    linkDependencies(request.key, e.dependencies);
+    if (std::find(handle->cacheKeys_.begin(), handle->cacheKeys_.end(), request.key) == handle->cacheKeys_.end())
+        handle->cacheKeys_.push_back(request.key);
+    indexDirty_ = true;
+    enforceLimit(request.key);
 }
 
 void ShaderCacheImpl::Invalidate(IShaderHandle* handle) {
@@ -56,139 +384,235 @@ void ShaderCacheImpl::Invalidate(IShaderHandle* handle) {
     h->bytecode_.clear();
     h->bytecodeBlob_.clear();
     h->crossCompiledSource_.clear();
-    std::string key = makeKey(h);
-    store_.erase(key);
+    std::lock_guard<std::mutex> lock(mutex_);
+    for (ShaderCacheKey const& key : h->cacheKeys_) {
+        auto it = entries_.find(key);
+        if (it == entries_.end()) continue;
+        if (it->second.onDisk) {
+            it->second.bytecode = VariantBytecode{};
+            it->second.loaded = false;
+        } else {
+            removeEntry(key, false);
+        }
+    }
+    h->cacheKeys_.clear();
+}
+
+uint32_t ShaderCacheImpl::InvalidateFile(char const* path) {
+    if (!path) return 0;
+    std::string norm = normalizePath(path);
+    std::lock_guard<std::mutex> lock(mutex_);
+    auto it = dependents_.find(norm);
+    if (it == dependents_.end()) return 0;
+    std::vector<ShaderCacheKey> keys(it->second.begin(), it->second.end());
+    for (ShaderCacheKey const& key : keys) removeEntry(key, true);
+    indexDirty_ = true;
+    return static_cast<uint32_t>(keys.size());
+}
+
+void ShaderCacheImpl::SetMaxSize(uint64_t bytes) {
+    std::lock_guard<std::mutex> lock(mutex_);
+    maxBytes_ = bytes;
+    enforceLimit(ShaderCacheKey{});
+}
+
+ShaderCacheStats ShaderCacheImpl::GetStats() const {
+    std::lock_guard<std::mutex> lock(mutex_);
+    ShaderCacheStats s;
+    s.entries = static_cast<uint32_t>(entries_.size());
+    s.bytes = totalBytes_;
+    s.hits = hits_;
+    s.misses = misses_;
+    s.evictions = evictions_;
+    return s;
 }
 
 bool ShaderCacheImpl::LoadCache(char const* path) {
-    if (!path) return false;
-#if defined(TE_SHADER_USE_CORE) && TE_SHADER_USE_CORE
-    std::string normPath = te::core::PathNormalize(path);
-    auto opt = te::core::FileRead(normPath);
-    if (!opt || opt->size() < 12) {
-        if (opt && opt->empty()) return true;
-        if (opt && opt->size() > 0 && opt->size() < 12) return false;
-        return true;
+    if (!path || !*path) return false;
+    std::error_code ec;
+    if (fs::exists(path, ec) && !fs::is_directory(path, ec)) {
+        logError("ShaderCacheImpl::LoadCache: path is not a cache directory");
+        return false;
     }
-    std::vector<std::uint8_t> const& data = *opt;
-#else
-    std::ifstream f(path, std::ios::binary);
-    if (!f) return true;
-    std::vector<std::uint8_t> data((std::istreambuf_iterator<char>(f)), std::istreambuf_iterator<char>());
-    f.close();
-    if (data.size() < 12) return true;
-#endif
-    if (std::memcmp(data.data(), kMagic, 8) != 0) return false;
-    uint32_t ver;
-    std::memcpy(&ver, data.data() + 8, 4);
-    if (ver != kVersion) return false;
-    size_t pos = 12;
-    uint32_t numEntries;
-    if (pos + 4 > data.size()) return false;
-    std::memcpy(&numEntries, data.data() + pos, 4);
-    pos += 4;
-    for (uint32_t e = 0; e < numEntries && pos < data.size(); ++e) {
-        if (pos + 4 > data.size()) break;
-        uint32_t keyLen;
-        std::memcpy(&keyLen, data.data() + pos, 4);
-        pos += 4;
-        if (pos + keyLen > data.size()) break;
-        std::string key(reinterpret_cast<char const*>(data.data() + pos), keyLen);
-        pos += keyLen;
-        uint32_t numVars;
-        if (pos + 4 > data.size()) break;
-        std::memcpy(&numVars, data.data() + pos, 4);
-        pos += 4;
-        auto& varMap = store_[key];
-        for (uint32_t v = 0; v < numVars && pos < data.size(); ++v) {
-            if (pos + 8 > data.size()) break;
-            uint64_t hash;
-            std::memcpy(&hash, data.data() + pos, 8);
-            pos += 8;
-            VariantBytecode vb;
-            if (pos + 4 > data.size()) break;
-            uint32_t spirvCount;
-            std::memcpy(&spirvCount, data.data() + pos, 4);
-            pos += 4;
-            if (spirvCount > 0 && pos + spirvCount * 4 <= data.size()) {
-                vb.spirv.resize(spirvCount);
-                std::memcpy(vb.spirv.data(), data.data() + pos, spirvCount * 4);
-                pos += spirvCount * 4;
-            }
-            if (pos + 4 > data.size()) break;
-            uint32_t dxilSize;
-            std::memcpy(&dxilSize, data.data() + pos, 4);
-            pos += 4;
-            if (dxilSize > 0 && pos + dxilSize <= data.size()) {
-                vb.dxil.resize(dxilSize);
-                std::memcpy(vb.dxil.data(), data.data() + pos, dxilSize);
-                pos += dxilSize;
-            }
-            if (pos + 4 > data.size()) break;
-            uint32_t crossSize;
-            std::memcpy(&crossSize, data.data() + pos, 4);
-            pos += 4;
-            if (crossSize > 0 && pos + crossSize <= data.size()) {
-                vb.crossCompiled.assign(reinterpret_cast<char const*>(data.data() + pos), crossSize);
-                pos += crossSize;
-            }
-            varMap[hash] = std::move(vb);
+    fs::create_directories(path, ec);
+    if (!fs::is_directory(path, ec)) {
+        logError("ShaderCacheImpl::LoadCache: cannot create cache directory");
+        return false;
+    }
+    std::string dir = normalizePath(path);
+    std::lock_guard<std::mutex> lock(mutex_);
+    if (dir != dir_) {
+        // Keep everything known: pull entries of the previous directory into memory first
+        for (auto& p : entries_) {
+            if (!p.second.loaded && p.second.onDisk && !loadEntry(p.first, p.second)) continue;
+            p.second.onDisk = false;
+        }
+        std::vector<ShaderCacheKey> lost;
+        for (auto const& p : entries_) {
+            if (!p.second.loaded) lost.push_back(p.first);
         }
+        for (ShaderCacheKey const& key : lost) removeEntry(key, false);
+        if (indexDirty_ && !dir_.empty()) writeIndex();
+        dir_ = dir;
     }
+    indexDirectory();
+    for (auto& p : entries_) {
+        if (p.second.onDisk) continue;
+        p.second.onDisk = writeFileAtomic(entryPath(dir_, p.first),
+                                          serializeEntry(p.first, p.second.dependencies, p.second.bytecode));
+        indexDirty_ = true;
+    }
+    enforceLimit(ShaderCacheKey{});
     return true;
 }
 
 bool ShaderCacheImpl::SaveCache(char const* path) {
-    if (!path) return false;
-#if defined(TE_SHADER_USE_CORE) && TE_SHADER_USE_CORE
-    std::string normPath = te::core::PathNormalize(path);
-#else
-    std::string normPath = path;
-#endif
-    std::vector<std::uint8_t> data;
-    data.insert(data.end(), kMagic, kMagic + 8);
-    uint32_t ver = kVersion;
-    data.insert(data.end(), reinterpret_cast<uint8_t*>(&ver), reinterpret_cast<uint8_t*>(&ver) + 4);
-    uint32_t numEntries = static_cast<uint32_t>(store_.size());
-    data.insert(data.end(), reinterpret_cast<uint8_t*>(&numEntries), reinterpret_cast<uint8_t*>(&numEntries) + 4);
-    for (auto const& entry : store_) {
-        uint32_t keyLen = static_cast<uint32_t>(entry.first.size());
-        data.insert(data.end(), reinterpret_cast<uint8_t*>(&keyLen), reinterpret_cast<uint8_t*>(&keyLen) + 4);
-        data.insert(data.end(), entry.first.begin(), entry.first.end());
-        uint32_t numVars = static_cast<uint32_t>(entry.second.size());
-        data.insert(data.end(), reinterpret_cast<uint8_t*>(&numVars), reinterpret_cast<uint8_t*>(&numVars) + 4);
-        for (auto const& v : entry.second) {
-            data.insert(data.end(), reinterpret_cast<uint8_t const*>(&v.first), reinterpret_cast<uint8_t const*>(&v.first) + 8);
-            uint32_t spirvCount = static_cast<uint32_t>(v.second.spirv.size());
-            data.insert(data.end(), reinterpret_cast<uint8_t*>(&spirvCount), reinterpret_cast<uint8_t*>(&spirvCount) + 4);
-            if (!v.second.spirv.empty()) {
-                data.insert(data.end(), reinterpret_cast<uint8_t const*>(v.second.spirv.data()),
-                            reinterpret_cast<uint8_t const*>(v.second.spirv.data()) + v.second.spirv.size() * 4);
-            }
-            uint32_t dxilSize = static_cast<uint32_t>(v.second.dxil.size());
-            data.insert(data.end(), reinterpret_cast<uint8_t*>(&dxilSize), reinterpret_cast<uint8_t*>(&dxilSize) + 4);
-            if (!v.second.dxil.empty()) {
-                data.insert(data.end(), v.second.dxil.begin(), v.second.dxil.end());
+    if (!LoadCache(path)) return false;
+    std::lock_guard<std::mutex> lock(mutex_);
+    for (auto const& p : entries_) {
+        if (!p.second.onDisk) return false;
+    }
+    return writeIndex();
+}
+
+void ShaderCacheImpl::linkDependencies(ShaderCacheKey const& key, std::vector<std::string> const& deps) {
+    for (std::string const& d : deps) dependents_[d].insert(key);
+}
+
+void ShaderCacheImpl::removeEntry(ShaderCacheKey const& key, bool deleteFile) {
+    auto it = entries_.find(key);
+    if (it == entries_.end()) return;
+    totalBytes_ -= std::min(totalBytes_, it->second.size);
+    for (std::string const& d : it->second.dependencies) {
+        auto dep = dependents_.find(d);
+        if (dep == dependents_.end()) continue;
+        dep->second.erase(key);
+        if (dep->second.empty()) dependents_.erase(dep);
+    }
+    if (deleteFile && it->second.onDisk && !dir_.empty()) {
+        std::error_code ec;
+        fs::remove(entryPath(dir_, key), ec);
+    }
+    entries_.erase(it);
+}
+
+bool ShaderCacheImpl::loadEntry(ShaderCacheKey const& key, Entry& entry) {
+    if (!entry.onDisk || dir_.empty()) return false;
+    std::string data;
+    if (!readFile(entryPath(dir_, key), data)) return false;
+    std::vector<std::string> deps;
+    VariantBytecode vb;
+    if (!parseEntry(data, key, deps, vb)) {
+        logError("ShaderCacheImpl: corrupt cache entry discarded");
+        return false;
+    }
+    entry.bytecode = std::move(vb);
+    entry.loaded = true;
+    return true;
+}
+
+bool ShaderCacheImpl::writeIndex() {
+    if (dir_.empty()) return false;
+    ByteWriter w;
+    w.bytes(kIndexMagic, 4);
+    w.u32(kIndexVersion);
+    w.u64(tick_);
+    uint32_t count = 0;
+    for (auto const& p : entries_) count += p.second.onDisk ? 1 : 0;
+    w.u32(count);
+    for (auto const& p : entries_) {
+        if (!p.second.onDisk) continue;
+        w.key(p.first);
+        w.u64(p.second.size);
+        w.u64(p.second.lastUse);
+        w.u32(static_cast<uint32_t>(p.second.dependencies.size()));
+        for (std::string const& d : p.second.dependencies) w.str(d);
+    }
+    if (!writeFileAtomic(fs::path(dir_) / kIndexFile, w.buf)) {
+        logError("ShaderCacheImpl: index write failed");
+        return false;
+    }
+    indexDirty_ = false;
+    return true;
+}
+
+void ShaderCacheImpl::indexDirectory() {
+    // The index only carries LRU ages and dependencies; entry files are the source of truth,
+    // so entries written by a process that never saved its index are still picked up
+    struct IndexRecord {
+        uint64_t size;
+        uint64_t lastUse;
+        std::vector<std::string> dependencies;
+    };
+    std::unordered_map<ShaderCacheKey, IndexRecord, ShaderCacheKeyHash> index;
+    std::string data;
+    if (readFile(fs::path(dir_) / kIndexFile, data)) {
+        ByteReader r{reinterpret_cast<uint8_t const*>(data.data()), data.size()};
+        char magic[4];
+        r.bytes(magic, 4);
+        if (r.ok && std::memcmp(magic, kIndexMagic, 4) == 0 && r.u32() == kIndexVersion) {
+            tick_ = std::max(tick_, r.u64());
+            uint32_t count = r.u32();
+            for (uint32_t i = 0; i < count && r.ok; ++i) {
+                ShaderCacheKey key = r.key();
+                IndexRecord rec;
+                rec.size = r.u64();
+                rec.lastUse = r.u64();
+                uint32_t depCount = r.u32();
+                for (uint32_t d = 0; d < depCount && r.ok; ++d) rec.dependencies.push_back(r.str());
+                if (r.ok) index[key] = std::move(rec);
             }
-            uint32_t crossSize = static_cast<uint32_t>(v.second.crossCompiled.size());
-            data.insert(data.end(), reinterpret_cast<uint8_t*>(&crossSize), reinterpret_cast<uint8_t*>(&crossSize) + 4);
-            if (!v.second.crossCompiled.empty()) {
-                data.insert(data.end(), v.second.crossCompiled.begin(), v.second.crossCompiled.end());
+        }
+    }
+    std::error_code ec;
+    for (fs::directory_iterator it(dir_, ec), end; !ec && it != end; it.increment(ec)) {
+        fs::path const& file = it->path();
+        ShaderCacheKey key;
+        if (file.extension() != kEntryExtension || !hexToKey(file.stem().string(), &key)) continue;
+        auto known = entries_.find(key);
+        if (known != entries_.end()) {
+            known->second.onDisk = true;
+            continue;
+        }
+        Entry e;
+        e.onDisk = true;
+        auto rec = index.find(key);
+        if (rec != index.end()) {
+            e.size = rec->second.size;
+            e.lastUse = rec->second.lastUse;
+            e.dependencies = std::move(rec->second.dependencies);
+        } else {
+            std::string bytes;
+            if (!readFile(file, bytes) || !parseEntry(bytes, key, e.dependencies, e.bytecode)) {
+                std::error_code rmEc;
+                fs::remove(file, rmEc);
+                continue;
             }
+            e.loaded = true;
+            e.size = bytes.size();
+            indexDirty_ = true;
         }
+        totalBytes_ += e.size;
+        linkDependencies(key, e.dependencies);
+        entries_.emplace(key, std::move(e));
     }
-#if defined(TE_SHADER_USE_CORE) && TE_SHADER_USE_CORE
-    if (!te::core::FileWrite(normPath, data)) {
-        te::core::Log(te::core::LogLevel::Error, "ShaderCacheImpl::SaveCache: FileWrite failed");
-        return false;
+}
+
+void ShaderCacheImpl::enforceLimit(ShaderCacheKey const& keep) {
+    if (maxBytes_ == 0 || totalBytes_ <= maxBytes_) return;
+    std::vector<std::pair<uint64_t, ShaderCacheKey>> order;
+    order.reserve(entries_.size());
+    for (auto const& p : entries_) {
+        if (!(p.first == keep)) order.emplace_back(p.second.lastUse, p.first);
     }
-#else
-    std::ofstream f(normPath, std::ios::binary);
-    if (!f) return false;
-    f.write(reinterpret_cast<char const*>(data.data()), data.size());
-    if (!f) return false;
-#endif
-    return true;
+    std::sort(order.begin(), order.end(),
+              [](auto const& a, auto const& b) { return a.first < b.first; });
+    for (auto const& o : order) {
+        if (totalBytes_ <= maxBytes_) break;
+        removeEntry(o.second, true);
+        ++evictions_;
+    }
+    indexDirty_ = true;
 }
 
 }  // namespace te::shader
@@ -19,6 +19,7 @@
 #include <fstream>
 #include <sstream>
 #include <string>
+#include <utility>
 
 namespace te::shader {
 
@@ -89,9 +90,16 @@ bool ShaderCompilerImpl::Compile(IShaderHandle* handle, CompileOptions const& op
     lastOptions_ = options;
     targetBackend_ = options.targetBackend;
 
-    if (cache_ && cache_->TryLoadToHandle(impl)) {
-        if (impl->variantBytecode_.find(impl->currentKey_.hash) != impl->variantBytecode_.end())
+    ShaderCacheRequest cacheRequest;
+    if (cache_) {
+        cacheRequest = cache_->MakeRequest(impl, options);
+        if (cache_->TryLoadToHandle(impl, cacheRequest)) {
+#if defined(TE_SHADER_USE_CORE) && TE_SHADER_USE_CORE && defined(TENENGINE_USE_SPIRV_CROSS) && TENENGINE_USE_SPIRV_CROSS
+            ExtractReflectionFromSpirv(impl);
+            ExtractVertexInputFromSpirv(impl);
+#endif
             return true;
+        }
     }
 
     bool ok = false;
@@ -131,7 +139,7 @@ bool ShaderCompilerImpl::Compile(IShaderHandle* handle, CompileOptions const& op
         vb.spirv = impl->bytecode_;
         vb.dxil = impl->bytecodeBlob_;
         vb.crossCompiled = impl->crossCompiledSource_;
-        if (cache_) cache_->StoreFromHandle(impl);
+        if (cache_) cache_->StoreFromHandle(impl, cacheRequest);
 #if defined(TE_SHADER_USE_CORE) && TE_SHADER_USE_CORE && defined(TENENGINE_USE_SPIRV_CROSS) && TENENGINE_USE_SPIRV_CROSS
         ExtractReflectionFromSpirv(impl);
         ExtractVertexInputFromSpirv(impl);
@@ -187,6 +195,17 @@ BackendType ShaderCompilerImpl::GetTargetBackend() const { return targetBackend_
 
 void ShaderCompilerImpl::SetCache(IShaderCache* cache) {
     cache_ = cache ? static_cast<ShaderCacheImpl*>(cache) : nullptr;
+    if (cache_) {
+        // Part of every cache key: a compiler upgrade must not reuse old bytecode
+        std::string identity = "glslang " + GetGlslangVersion();
+#if defined(TENENGINE_USE_SPIRV_CROSS) && TENENGINE_USE_SPIRV_CROSS
+        identity += "; spirv-cross";
+#endif
+#if defined(TE_SHADER_HAVE_DXC) && TE_SHADER_HAVE_DXC
+        identity += "; dxc";
+#endif
+        cache_->SetCompilerIdentity(std::move(identity));
+    }
 }
 
 void ShaderCompilerImpl::DefineKeyword(char const* name, char const* value) {
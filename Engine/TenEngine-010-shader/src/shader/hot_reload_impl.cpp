@@ -1,17 +1,31 @@
 #include <te/shader/detail/hot_reload_impl.hpp>
 #include <te/shader/detail/cache_impl.hpp>
 #include <chrono>
-#include <thread>
+#include <filesystem>
+#include <fstream>
+#include <iterator>
 
 namespace te::shader {
 
+namespace {
+
+// Editors write a shader in a few syscalls; wait this long for the file to settle
+constexpr std::chrono::milliseconds kSourceDebounce{100};
+constexpr std::chrono::milliseconds kWaitTimeout{250};
+
+}  // namespace
+
 ShaderHotReloadImpl::ShaderHotReloadImpl(IShaderCompiler* compiler, IShaderCache* cache)
-    : compiler_(compiler), cache_(cache) {
+    : compiler_(compiler), cache_(cache), watcher_(te::resource::CreateFileWatcher()) {
+    watcher_->SetDebounceTime(kSourceDebounce);
+    watcher_->SubscribeToFileChanges(&ShaderHotReloadImpl::onFileChanged, this);
+    watcher_->Start();
     watchThread_ = std::thread(&ShaderHotReloadImpl::watchThreadFunc, this);
 }
 
 ShaderHotReloadImpl::~ShaderHotReloadImpl() {
     stop_ = true;
+    watcher_->Stop();
     if (watchThread_.joinable()) watchThread_.join();
 }
 
@@ -20,39 +34,51 @@ bool ShaderHotReloadImpl::ReloadShader(IShaderHandle* handle) {
     if (cache_) {
         static_cast<ShaderCacheImpl*>(cache_)->Invalidate(handle);
     }
+    // Recompile the edited file, not the text read at LoadSource
+    auto* impl = static_cast<ShaderHandleImpl*>(handle);
+    if (!impl->sourcePath_.empty()) {
+        std::ifstream f(impl->sourcePath_, std::ios::binary);
+        if (f) impl->sourceCode_.assign(std::istreambuf_iterator<char>(f), std::istreambuf_iterator<char>());
+    }
     return compiler_->Compile(handle, CompileOptions{});
 }
 
 void ShaderHotReloadImpl::OnSourceChanged(char const* path, SourceChangedCallback callback, void* userData) {
     if (!path || !callback) return;
     std::error_code ec;
-    auto mtime = std::filesystem::last_write_time(path, ec);
-    if (ec) return;
+    std::filesystem::path abs = std::filesystem::absolute(path, ec);
+    if (ec || !std::filesystem::exists(abs, ec)) return;
+    if (!watcher_->AddWatchPath(abs.string(), false)) return;
     std::lock_guard<std::mutex> lock(watchedMutex_);
-    watched_.push_back({path, callback, userData, mtime});
+    watched_.push_back({path, abs.lexically_normal().generic_string(), callback, userData});
 }
 
 void ShaderHotReloadImpl::NotifyShaderUpdated(IShaderHandle* handle) {
     (void)handle;
 }
 
+void ShaderHotReloadImpl::onFileChanged(te::resource::FileChangeEvent const& event, void* userData) {
+    if (event.changeType == te::resource::FileChangeType::Deleted) return;
+    auto* self = static_cast<ShaderHotReloadImpl*>(userData);
+    // Drops the cached variants built from this file, including those that only #include it
+    if (self->cache_) self->cache_->InvalidateFile(event.path.c_str());
+    std::vector<WatchedPath> toInvoke;
+    {
+        std::lock_guard<std::mutex> lock(self->watchedMutex_);
+        for (auto const& w : self->watched_) {
+            if (w.watchPath == event.path) toInvoke.push_back(w);
+        }
+    }
+    for (auto const& w : toInvoke) {
+        w.callback(w.path.c_str(), w.userData);
+    }
+}
+
 void ShaderHotReloadImpl::watchThreadFunc() {
+    // Blocks until the watcher has a settled change; no per-file polling
     while (!stop_) {
-        std::this_thread::sleep_for(std::chrono::milliseconds(500));
-        std::vector<WatchedPath> toInvoke;
-        {
-            std::lock_guard<std::mutex> lock(watchedMutex_);
-            for (auto& w : watched_) {
-                std::error_code ec;
-                auto mtime = std::filesystem::last_write_time(w.path, ec);
-                if (!ec && mtime != w.lastMtime) {
-                    w.lastMtime = mtime;
-                    toInvoke.push_back(w);
-                }
-            }
-        }
-        for (auto const& w : toInvoke) {
-            if (w.callback) w.callback(w.path.c_str(), w.userData);
+        if (watcher_->WaitForEvents(kWaitTimeout)) {
+            watcher_->ProcessPendingEvents();
         }
     }
 }
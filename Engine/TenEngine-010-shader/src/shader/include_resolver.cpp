@@ -0,0 +1,18 @@
+#include <te/shader/detail/include_resolver.hpp>
+#include <fstream>
+#include <iterator>
+
+namespace te::shader {
+
+std::filesystem::path ResolveIncludePath(std::filesystem::path const& includer, std::string const& name) {
+    return (includer.parent_path() / name).lexically_normal();
+}
+
+bool ReadIncludeFile(std::filesystem::path const& path, std::string& out) {
+    std::ifstream f(path, std::ios::binary);
+    if (!f) return false;
+    out.assign(std::istreambuf_iterator<char>(f), std::istreambuf_iterator<char>());
+    return !f.bad();
+}
+
+}  // namespace te::shader
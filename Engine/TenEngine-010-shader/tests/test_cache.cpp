@@ -2,6 +2,8 @@
 #include <cassert>
 #include <cstdio>
 #include <cstring>
+#include <filesystem>
+#include <fstream>
 
 int main() {
     te::shader::IShaderCompiler* compiler = te::shader::CreateShaderCompiler();
@@ -26,7 +28,8 @@ int main() {
     void const* bytecode1 = compiler->GetBytecode(handle, &size1);
     assert(bytecode1 && size1 > 0 && "GetBytecode failed");
 
-    char const* cachePath = "test_shader_cache.bin";
+    char const* cachePath = "test_shader_cache";
+    std::filesystem::remove_all(cachePath);
     ok = cache->SaveCache(cachePath);
     assert(ok && "SaveCache failed");
 
@@ -38,18 +41,78 @@ int main() {
     ok = cache->LoadCache(cachePath);
     assert(ok && "LoadCache failed");
 
+    te::shader::ShaderCacheStats before = cache->GetStats();
     ok = compiler->Compile(handle, opts);
     assert(ok && "Re-Compile (from cache) failed");
+    assert(cache->GetStats().hits == before.hits + 1 && "Re-Compile should hit the cache");
 
     size_t size3 = 0;
     void const* bytecode3 = compiler->GetBytecode(handle, &size3);
     assert(bytecode3 && size3 > 0 && "GetBytecode after LoadCache failed");
     assert(size3 == size1 && "Bytecode size mismatch after restore");
 
+    // Other options are another entry
+    te::shader::CompileOptions debugOpts = opts;
+    debugOpts.generateDebugInfo = true;
+    before = cache->GetStats();
+    ok = compiler->Compile(handle, debugOpts);
+    assert(ok && cache->GetStats().misses == before.misses + 1 && "Changed options must miss");
+
+    // Editing an included file changes the key and InvalidateFile drops its dependents.
+    // Includes resolve against the including file's directory in the compiler as in the key:
+    // the source includes inner/scale.h, which includes offset.h next to itself.
+    char const* includeDir = "test_shader_cache_inc";
+    std::filesystem::path const sourcePath = std::filesystem::path(includeDir) / "shader.vert";
+    std::filesystem::path const headerPath = std::filesystem::path(includeDir) / "inner" / "offset.h";
+    std::filesystem::remove_all(includeDir);
+    std::filesystem::create_directories(headerPath.parent_path());
+    {
+        std::ofstream h(headerPath);
+        h << "#define OFFSET 1.0\n";
+        std::ofstream scale(std::filesystem::path(includeDir) / "inner" / "scale.h");
+        scale << "#include \"offset.h\"\n#define SCALE (2.0 * OFFSET)\n";
+        std::ofstream s(sourcePath);
+        s << "#version 450\n#include \"inner/scale.h\"\n"
+             "void main() { gl_Position = vec4(SCALE,0,0,1); }\n";
+    }
+    te::shader::IShaderHandle* incHandle = compiler->LoadSource(sourcePath.string().c_str(), te::shader::ShaderSourceFormat::GLSL);
+    assert(incHandle && "LoadSource failed");
+    ok = compiler->Compile(incHandle, opts);
+    assert(ok && "Compile with include failed");
+    before = cache->GetStats();
+    ok = compiler->Compile(incHandle, opts);
+    assert(ok && cache->GetStats().hits == before.hits + 1 && "Unchanged include should hit");
+
+    {
+        std::ofstream h(headerPath);
+        h << "#define OFFSET 2.0\n";
+    }
+    before = cache->GetStats();
+    ok = compiler->Compile(incHandle, opts);
+    assert(ok && cache->GetStats().misses == before.misses + 1 && "Edited include must miss");
+
+    uint32_t removed = cache->InvalidateFile(headerPath.string().c_str());
+    assert(removed == 2 && "Both variants built from the header should be removed");
+    assert(cache->GetStats().entries == before.entries + 1 - 2 && "Only dependents of the header are removed");
+
+    // A missing include fails the compile instead of resolving elsewhere
+    std::filesystem::remove(headerPath);
+    ok = compiler->Compile(incHandle, opts);
+    assert(!ok && "Compile with a missing include must fail");
+
+    // Size bound evicts least recently used entries
+    cache->SetMaxSize(1);
+    te::shader::ShaderCacheStats after = cache->GetStats();
+    assert(after.entries == 0 && after.evictions > 0 && "SetMaxSize should evict");
+    cache->SetMaxSize(te::shader::kDefaultShaderCacheMaxBytes);
+
+    compiler->ReleaseHandle(incHandle);
     compiler->ReleaseHandle(handle);
     te::shader::DestroyShaderCache(cache);
     te::shader::DestroyShaderCompiler(compiler);
 
+    std::filesystem::remove_all(cachePath);
+    std::filesystem::remove_all(includeDir);
     std::printf("te_shader test_cache: all OK\n");
     return 0;
 }
@@ -8,9 +8,11 @@
 #include <te/rendercore/IRenderMaterial.hpp>
 #include <te/rendercore/uniform_buffer.hpp>
 #include <te/rendercore/IRenderPipelineState.hpp>
+#include <te/rendercore/pipeline_cache.hpp>
 #include <te/rhi/resources.hpp>
 #include <te/rhi/pso.hpp>
 #include <te/material/MaterialParam.hpp>
+#include <te/material/parameters.hpp>
 
 #include <cstdint>
 #include <map>
@@ -37,11 +39,23 @@ namespace material {
  * 1. SetDataParameter() / SetDataTexture() to set CPU data
  * 2. CreateDeviceResource() to create GPU resources
  * 3. UpdateDeviceResource() per frame to upload data
- * 4. GetGraphicsPSO() / GetDescriptorSet() during draw
+ * 4. GetGraphicsPSO() / GetDescriptorSet() with GetUniformBufferOffset() as dynamic offset during draw
+ *
+ * PSOs come from the device's IPipelineCache; GetGraphicsPSO returns the cache's fallback
+ * (or nullptr) while a PSO is still compiling.
+ *
+ * Parameters live in a ParameterBlock resolved once from the fragment reflection. Each frame
+ * copies the whole block into a new ring block once (frames in flight keep theirs); dirty
+ * ranges only spare re-serializing the block and further ring blocks within the frame.
+ * An instance (RenderMaterial(parent))
+ * shares the parent's shader and PSOs and draws with the parent's bindings until it overrides
+ * a parameter or texture.
  */
 class RenderMaterial : public rendercore::IRenderMaterial {
 public:
     RenderMaterial();
+    /** Instance of parent; parent must have its shader set and outlive the instance. */
+    explicit RenderMaterial(RenderMaterial* parent);
     ~RenderMaterial() override;
 
     // === IRenderPipelineState ===
@@ -56,6 +70,7 @@ public:
     rendercore::IUniformBuffer const* GetUniformBuffer() const override;
     rhi::IDescriptorSet* GetDescriptorSet() override;
     rhi::IDescriptorSet const* GetDescriptorSet() const override;
+    uint32_t GetUniformBufferOffset() const override;
     rhi::IPSO* GetGraphicsPSO(uint32_t subpassIndex) override;
     rhi::IPSO const* GetGraphicsPSO(uint32_t subpassIndex) const override;
 
@@ -77,17 +92,30 @@ public:
     void SetDevice(rhi::IDevice* device);
     void SetName(char const* name);
 
+    // === Parameters ===
+    /** Index for the typed setters of GetParameters(); kInvalidParameterIndex if not in the block. */
+    ParameterIndex FindParameter(char const* name) const;
+    ParameterBlock& GetParameters() { return parameters_; }
+    ParameterBlock const& GetParameters() const { return parameters_; }
+    RenderMaterial* GetParent() const { return parent_; }
+
 private:
     // Create PSO if needed
     bool CreatePSO(rhi::IRenderPass* renderPass, uint32_t subpassCount);
     // Create uniform buffer
     bool CreateUniformBuffer();
+    // Set 0 layout: dynamic uniform block at binding 0, then the texture bindings
+    rhi::DescriptorSetLayoutDesc BuildDescriptorSetLayoutDesc() const;
     // Create descriptor set
     bool CreateDescriptorSet(rhi::IDescriptorSetLayout* skinLayout);
-    // Upload parameters to uniform buffer
+    // Upload dirty parameter ranges to uniform buffer
     void UploadParameters();
-    // Update descriptor set textures
-    void UpdateDescriptorTextures();
+    // Update descriptor set textures and uniform buffer binding
+    void UpdateDescriptors(uint32_t frameSlot);
+    // False while an instance can draw with its parent's bindings
+    bool UsesOwnBindings() const;
+    // Instance: create uniform buffer and descriptor set on first divergence
+    void EnsureOwnBindings();
 
 private:
     // Shader and pipeline state
@@ -98,15 +126,21 @@ private:
 
     // CPU data
     std::string name_;
-    std::map<std::string, std::vector<uint8_t>> cpuParameters_;
+    RenderMaterial* parent_{nullptr};
+    ParameterBlock parameters_;
     std::map<uint32_t, rhi::ITexture*> cpuTextures_;
-    std::map<std::string, uint32_t> textureBindingMap_;  // name -> binding
+    bool texturesDirty_{false};
+    uint64_t texturesVersion_{0};
+    uint64_t parentTexturesVersion_{0};
 
     // GPU resources
     rhi::IDevice* device_{nullptr};
     std::unique_ptr<rendercore::IUniformBuffer> uniformBuffer_;
     rhi::IDescriptorSet* descriptorSet_{nullptr};
-    std::vector<rhi::IPSO*> psos_;  // Per subpass
+    rendercore::IPipelineCache* pipelineCache_{nullptr};  // Owns the PSOs
+    std::vector<rendercore::PipelineHash> psoHashes_;     // Per subpass
+    rhi::IBuffer* boundUniformBuffer_{nullptr};  // Ring buffer written to descriptorSet_
+    uint32_t uniformOffset_{0};                  // Dynamic offset of this frame's block
 
     // Layout (created from shader reflection or external)
     rhi::IDescriptorSetLayout* descriptorSetLayout_{nullptr};
@@ -126,6 +160,12 @@ RenderMaterial* CreateRenderMaterial(
     rendercore::IShaderEntry* shaderEntry,
     PipelineStateDesc const& pipelineState);
 
+/**
+ * @brief Create an instance sharing parent's shader, pipeline state and PSOs.
+ * Destroy with DestroyRenderMaterial before the parent.
+ */
+RenderMaterial* CreateRenderMaterialInstance(RenderMaterial* parent);
+
 /**
  * @brief Destroy a RenderMaterial.
  */
@@ -1,7 +1,152 @@
-// 011-Material SetScalar, SetTexture, SetBuffer, GetSlotMapping (IMaterialSystem members in material_def.hpp)
+// 011-Material SetScalar, SetTexture, SetBuffer, GetSlotMapping (IMaterialSystem members in material_def.hpp);
+// ParameterLayout / ParameterBlock: reflection resolved once into indexed slots, typed setters, dirty ranges.
 #ifndef TE_MATERIAL_PARAMETERS_HPP
 #define TE_MATERIAL_PARAMETERS_HPP
 
 #include "te/material/material_def.hpp"
+#include <te/rendercore/uniform_layout.hpp>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+namespace te {
+namespace rendercore {
+struct ShaderReflectionDesc;
+struct ShaderResourceBinding;
+}
+namespace material {
+
+/** Index of a uniform member inside a ParameterLayout; stable for the layout's lifetime. */
+using ParameterIndex = uint32_t;
+constexpr ParameterIndex kInvalidParameterIndex = ~0u;
+
+struct ParameterInfo {
+  std::string name;
+  te::rendercore::UniformMemberType type{te::rendercore::UniformMemberType::Unknown};
+  uint32_t count{1};   // 0 or 1 = scalar; N = std140 array (16-byte element stride)
+  uint32_t offset{0};  // Byte offset inside the block
+  uint32_t size{0};    // Bytes covered by the member
+};
+
+struct TextureSlotInfo {
+  std::string name;
+  uint32_t set{0};
+  uint32_t binding{0};
+};
+
+/** Half-open byte span [begin, end) of a parameter block. */
+struct ByteRange {
+  uint32_t begin{0};
+  uint32_t end{0};
+};
+
+/**
+ * Uniform block layout resolved once from shader reflection: name lookups happen when a
+ * caller resolves a ParameterIndex, never on the per-frame path. Immutable and shared by a
+ * material, its ParameterBlocks and all instances.
+ */
+class ParameterLayout {
+public:
+  /** Members with size 0 are packed std140 after the previous member; others keep their offset. */
+  static std::shared_ptr<ParameterLayout const> Create(te::rendercore::UniformLayoutDesc const& uniforms,
+                                                       te::rendercore::ShaderResourceBinding const* resources = nullptr,
+                                                       uint32_t resourceCount = 0);
+  static std::shared_ptr<ParameterLayout const> FromReflection(te::rendercore::ShaderReflectionDesc const& reflection);
+
+  ParameterIndex Find(char const* name) const;
+  uint32_t GetParameterCount() const { return static_cast<uint32_t>(params_.size()); }
+  ParameterInfo const& GetParameter(ParameterIndex index) const { return params_[index]; }
+  /** Block size in bytes (16-byte multiple). */
+  size_t GetSize() const { return size_; }
+
+  /** Sampled / storage image bindings from reflection; false when name is not bound. */
+  bool FindTextureBinding(char const* name, uint32_t* outBinding) const;
+  uint32_t GetTextureSlotCount() const { return static_cast<uint32_t>(textures_.size()); }
+  TextureSlotInfo const& GetTextureSlot(uint32_t i) const { return textures_[i]; }
+
+private:
+  std::vector<ParameterInfo> params_;
+  std::unordered_map<std::string, ParameterIndex> byName_;
+  std::vector<TextureSlotInfo> textures_;
+  size_t size_{0};
+};
+
+/**
+ * CPU copy of a uniform block in final std140 layout. Setters write in place, skip unchanged
+ * values and record the touched byte ranges so uploads cover only changed spans.
+ *
+ * A child block (material instance) reads its parent's bytes until its first override; it then
+ * copies the parent once and keeps following the parent for every parameter it does not
+ * override (see Resolve). The parent must outlive its children. Not thread-safe.
+ */
+class ParameterBlock {
+public:
+  ParameterBlock() = default;
+  explicit ParameterBlock(std::shared_ptr<ParameterLayout const> layout);
+  /** Child of parent sharing its layout. */
+  explicit ParameterBlock(ParameterBlock const* parent);
+
+  ParameterLayout const* GetLayout() const { return layout_.get(); }
+  std::shared_ptr<ParameterLayout const> const& GetSharedLayout() const { return layout_; }
+  ParameterIndex Find(char const* name) const { return layout_ ? layout_->Find(name) : kInvalidParameterIndex; }
+  ParameterBlock const* GetParent() const { return parent_; }
+
+  // Typed setters; false on an invalid index, a type mismatch or an element outside the array.
+  bool SetFloat(ParameterIndex index, float value, uint32_t element = 0);
+  /** Float2 / Float3 / Float4 member; reads 2, 3 or 4 floats. */
+  bool SetVector(ParameterIndex index, float const* value, uint32_t element = 0);
+  bool SetInt(ParameterIndex index, int32_t value, uint32_t element = 0);
+  /** Int2 / Int3 / Int4 member. */
+  bool SetIntVector(ParameterIndex index, int32_t const* value, uint32_t element = 0);
+  /** Column-major Mat3 (9 floats, padded to std140 columns) or Mat4 (16 floats). */
+  bool SetMatrix(ParameterIndex index, float const* value, uint32_t element = 0);
+  /** Raw std140 bytes at the member's offset; size must not exceed the member. */
+  bool SetRaw(ParameterIndex index, void const* data, size_t size);
+
+  /** Drops a child's override; the parameter follows the parent again. */
+  void ResetToParent(ParameterIndex index);
+  bool IsOverridden(ParameterIndex index) const;
+  bool HasOverrides() const { return overrideCount_ > 0; }
+
+  /** Copies every differing parameter of other (same layout) into this block. */
+  bool CopyValues(ParameterBlock const& other);
+
+  /** Child: pulls parent values changed since the last call into non-overridden parameters. */
+  void Resolve();
+
+  /** Block bytes; a child without overrides returns its parent's bytes. */
+  uint8_t const* GetData() const;
+  size_t GetSize() const { return layout_ ? layout_->GetSize() : 0; }
+  /** Incremented whenever a value changes. */
+  uint64_t GetVersion() const { return version_; }
+
+  /** Sorted, non-overlapping spans changed since ClearDirty. */
+  std::vector<ByteRange> const& GetDirtyRanges() const { return dirty_; }
+  bool IsDirty() const { return !dirty_.empty(); }
+  void MarkAllDirty();
+  void ClearDirty() { dirty_.clear(); }
+
+private:
+  bool Locate(ParameterIndex index, uint32_t element, uint32_t* outOffset, size_t* outSize) const;
+  te::rendercore::UniformMemberType TypeOf(ParameterIndex index) const;
+  bool Write(ParameterIndex index, uint32_t offset, void const* data, size_t size);
+  void EnsureOwnStorage();
+  void AddDirty(uint32_t begin, uint32_t end);
+
+  std::shared_ptr<ParameterLayout const> layout_;
+  ParameterBlock const* parent_{nullptr};
+  std::vector<uint8_t> data_;           // Empty for a child that has not overridden anything yet
+  std::vector<uint64_t> overridden_;    // Child only: one bit per parameter
+  uint32_t overrideCount_{0};
+  uint64_t parentVersion_{0};
+  uint64_t version_{0};
+  std::vector<ByteRange> dirty_;
+};
+
+}  // namespace material
+}  // namespace te
 
 #endif
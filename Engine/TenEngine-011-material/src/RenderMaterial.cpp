@@ -5,6 +5,7 @@
 
 #include <te/material/RenderMaterial.hpp>
 #include <te/rendercore/uniform_layout.hpp>
+#include <te/rendercore/pipeline_cache.hpp>
 #include <te/rendercore/IShaderEntry.hpp>
 #include <te/rhi/device.hpp>
 #include <te/rhi/pso.hpp>
@@ -18,17 +19,30 @@ namespace te::material {
 
 RenderMaterial::RenderMaterial() = default;
 
+RenderMaterial::RenderMaterial(RenderMaterial* parent)
+    : shaderEntry_(parent ? parent->shaderEntry_ : nullptr),
+      pipelineStateDesc_(parent ? parent->pipelineStateDesc_ : PipelineStateDesc{}),
+      rhiPipelineStateDesc_(parent ? parent->rhiPipelineStateDesc_ : rhi::GraphicsPipelineStateDesc{}),
+      pipelineState_(parent ? parent->pipelineState_ : nullptr),
+      parent_(parent),
+      parameters_(parent ? &parent->parameters_ : nullptr),
+      device_(parent ? parent->device_ : nullptr) {
+    if (parent_) {
+        name_ = parent_->name_;
+        parentTexturesVersion_ = parent_->texturesVersion_;
+    }
+}
+
 RenderMaterial::~RenderMaterial() {
-    // Cleanup GPU resources
+    // Cleanup GPU resources; PSOs belong to the device pipeline cache and an instance borrows
+    // its parent's descriptor set layout
     if (device_) {
-        for (auto* pso : psos_) {
-            if (pso) {
-                device_->DestroyPSO(pso);
-            }
-        }
         if (descriptorSet_) {
             device_->DestroyDescriptorSet(descriptorSet_);
         }
+        if (!parent_ && descriptorSetLayout_) {
+            device_->DestroyDescriptorSetLayout(descriptorSetLayout_);
+        }
     }
     uniformBuffer_.reset();
 }
@@ -52,31 +66,42 @@ rendercore::IShaderEntry const* RenderMaterial::GetShaderEntry() const {
 // === IRenderMaterial ===
 
 rendercore::IUniformBuffer* RenderMaterial::GetUniformBuffer() {
+    if (!UsesOwnBindings()) return parent_->GetUniformBuffer();
     return uniformBuffer_.get();
 }
 
 rendercore::IUniformBuffer const* RenderMaterial::GetUniformBuffer() const {
+    if (!UsesOwnBindings()) return parent_->GetUniformBuffer();
     return uniformBuffer_.get();
 }
 
 rhi::IDescriptorSet* RenderMaterial::GetDescriptorSet() {
+    if (!UsesOwnBindings()) return parent_->GetDescriptorSet();
     return descriptorSet_;
 }
 
 rhi::IDescriptorSet const* RenderMaterial::GetDescriptorSet() const {
+    if (!UsesOwnBindings()) return parent_->GetDescriptorSet();
     return descriptorSet_;
 }
 
+uint32_t RenderMaterial::GetUniformBufferOffset() const {
+    if (!UsesOwnBindings()) return parent_->GetUniformBufferOffset();
+    return uniformOffset_;
+}
+
 rhi::IPSO* RenderMaterial::GetGraphicsPSO(uint32_t subpassIndex) {
-    if (subpassIndex < psos_.size()) {
-        return psos_[subpassIndex];
+    if (parent_) return parent_->GetGraphicsPSO(subpassIndex);
+    if (pipelineCache_ && subpassIndex < psoHashes_.size()) {
+        return pipelineCache_->Acquire(psoHashes_[subpassIndex]);  // Fallback while compiling
     }
     return nullptr;
 }
 
 rhi::IPSO const* RenderMaterial::GetGraphicsPSO(uint32_t subpassIndex) const {
-    if (subpassIndex < psos_.size()) {
-        return psos_[subpassIndex];
+    if (parent_) return parent_->GetGraphicsPSO(subpassIndex);
+    if (pipelineCache_ && subpassIndex < psoHashes_.size()) {
+        return pipelineCache_->Acquire(psoHashes_[subpassIndex]);
     }
     return nullptr;
 }
@@ -90,6 +115,17 @@ void RenderMaterial::CreateDeviceResource(rhi::IRenderPass* renderPass,
                                           rhi::IDescriptorSetLayout* skinLayout) {
     if (!device_) return;
 
+    if (parent_) {
+        // Instances share the parent's PSOs and only create bindings once they diverge from it
+        parent_->CreateDeviceResource(renderPass, subpassCount, skinLayout);
+        psoCreated_ = parent_->psoCreated_;
+        if (UsesOwnBindings()) {
+            EnsureOwnBindings();
+        }
+        deviceReady_ = psoCreated_ && (UsesOwnBindings() ? descriptorSetCreated_ : parent_->descriptorSetCreated_);
+        return;
+    }
+
     // Create PSO
     if (!psoCreated_) {
         if (CreatePSO(renderPass, subpassCount)) {
@@ -116,43 +152,51 @@ void RenderMaterial::UpdateDeviceResource(rhi::IDevice* device, uint32_t frameSl
     if (!device) return;
     device_ = device;
 
+    if (parent_) {
+        if (!UsesOwnBindings()) {
+            // Still identical to the parent: draw with its uniform buffer and descriptor set
+            parent_->UpdateDeviceResource(device, frameSlot);
+            return;
+        }
+        parameters_.Resolve();
+        EnsureOwnBindings();
+    }
+
     // Set current frame slot for uniform buffer
     if (uniformBuffer_) {
         uniformBuffer_->SetCurrentFrameSlot(frameSlot);
     }
 
-    // Upload parameters to GPU
+    // Write changed parameter spans into this frame's uniform block
     UploadParameters();
 
-    // Update descriptor set with textures
-    UpdateDescriptorTextures();
+    // Update descriptor set bindings
+    UpdateDescriptors(frameSlot);
 }
 
 void RenderMaterial::SetDataParameter(char const* name, void const* data, size_t size) {
     if (!name || !data || size == 0) return;
-
-    std::string key(name);
-    auto& param = cpuParameters_[key];
-    param.resize(size);
-    std::memcpy(param.data(), data, size);
-
-    // Mark device as needing update
-    deviceReady_ = false;
+    parameters_.SetRaw(parameters_.Find(name), data, size);
 }
 
 void RenderMaterial::SetDataTexture(uint32_t binding, rhi::ITexture* texture) {
-    cpuTextures_[binding] = texture;
-
-    // Mark device as needing update
-    deviceReady_ = false;
+    auto [it, inserted] = cpuTextures_.emplace(binding, texture);
+    if (!inserted && it->second == texture) return;
+    it->second = texture;
+    texturesDirty_ = true;
+    ++texturesVersion_;
+
+    // A new binding may need a new descriptor set layout
+    if (inserted) {
+        deviceReady_ = false;
+    }
 }
 
 void RenderMaterial::SetDataTextureByName(char const* name, rhi::ITexture* texture) {
-    if (!name) return;
-
-    auto it = textureBindingMap_.find(name);
-    if (it != textureBindingMap_.end()) {
-        SetDataTexture(it->second, texture);
+    ParameterLayout const* layout = parameters_.GetLayout();
+    uint32_t binding = 0;
+    if (layout && layout->FindTextureBinding(name, &binding)) {
+        SetDataTexture(binding, texture);
     }
 }
 
@@ -163,7 +207,16 @@ bool RenderMaterial::IsDeviceReady() const {
 // === Configuration ===
 
 void RenderMaterial::SetShaderEntry(rendercore::IShaderEntry* entry) {
+    if (parent_) return;  // Instances always use the parent's shader
     shaderEntry_ = entry;
+
+    // Resolve the uniform layout once; setters then address parameters by index
+    auto const* refl = entry ? entry->GetFragmentReflection() : nullptr;
+    parameters_ = refl ? ParameterBlock(ParameterLayout::FromReflection(*refl)) : ParameterBlock();
+}
+
+ParameterIndex RenderMaterial::FindParameter(char const* name) const {
+    return parameters_.Find(name);
 }
 
 void RenderMaterial::SetPipelineStateDesc(PipelineStateDesc const& desc) {
@@ -201,26 +254,33 @@ void RenderMaterial::SetName(char const* name) {
 bool RenderMaterial::CreatePSO(rhi::IRenderPass* renderPass, uint32_t subpassCount) {
     if (!device_ || !shaderEntry_) return false;
 
-    // Ensure we have space for all subpasses
-    psos_.resize(subpassCount > 0 ? subpassCount : 1);
-
-    // Build GraphicsPSODesc using the pre-populated RHI pipeline state
-    rhi::GraphicsPSODesc psoDesc{};
-    psoDesc.vertex_shader = shaderEntry_->GetVertexBytecode();
-    psoDesc.vertex_shader_size = shaderEntry_->GetVertexBytecodeSize();
-    psoDesc.fragment_shader = shaderEntry_->GetFragmentBytecode();
-    psoDesc.fragment_shader_size = shaderEntry_->GetFragmentBytecodeSize();
-    psoDesc.pipelineState = &rhiPipelineStateDesc_;
-
-    // Create PSO with render pass and subpass info
-    rhi::IPSO* pso = device_->CreateGraphicsPSO(psoDesc, nullptr, renderPass, subpassCount > 0 ? 0 : 0);
-    if (!pso) return false;
-
-    // Use same PSO for all subpasses
-    for (auto& p : psos_) {
-        p = pso;
+    pipelineCache_ = rendercore::GetDevicePipelineCache(device_);
+    if (!pipelineCache_) return false;
+
+    // Build the request using the pre-populated RHI pipeline state
+    rendercore::GraphicsPipelineDesc pipelineDesc{};
+    pipelineDesc.pso.vertex_shader = shaderEntry_->GetVertexBytecode();
+    pipelineDesc.pso.vertex_shader_size = shaderEntry_->GetVertexBytecodeSize();
+    pipelineDesc.pso.fragment_shader = shaderEntry_->GetFragmentBytecode();
+    pipelineDesc.pso.fragment_shader_size = shaderEntry_->GetFragmentBytecodeSize();
+    pipelineDesc.pso.pipelineState = &rhiPipelineStateDesc_;
+    rhi::DescriptorSetLayoutDesc const layoutDesc = BuildDescriptorSetLayoutDesc();
+    pipelineDesc.layout = &layoutDesc;  // Must match the set: binding 0 takes a dynamic offset
+    pipelineDesc.renderPass = renderPass;
+    pipelineDesc.subpassIndex = 0;
+
+    // Materials with identical shaders and state share one PSO. With a fallback pipeline
+    // configured the PSO compiles in the background; otherwise it is compiled here.
+    rendercore::PipelineHash hash = 0;
+    if (pipelineCache_->GetFallback() != 0) {
+        hash = pipelineCache_->Request(pipelineDesc);
+    } else if (!pipelineCache_->RequestSync(pipelineDesc, &hash)) {
+        return false;
     }
+    if (hash == 0) return false;
 
+    // Use same PSO for all subpasses
+    psoHashes_.assign(subpassCount > 0 ? subpassCount : 1, hash);
     return true;
 }
 
@@ -237,6 +297,7 @@ bool RenderMaterial::CreateUniformBuffer() {
         if (!layout) return false;
 
         uniformBuffer_.reset(rendercore::CreateUniformBuffer(layout, device_));
+        rendercore::ReleaseUniformLayout(layout);
         return uniformBuffer_ != nullptr;
     }
 
@@ -250,35 +311,47 @@ bool RenderMaterial::CreateUniformBuffer() {
     if (!layout) return false;
 
     uniformBuffer_.reset(rendercore::CreateUniformBuffer(layout, device_));
-    return uniformBuffer_ != nullptr;
+    rendercore::ReleaseUniformLayout(layout);
+    if (!uniformBuffer_) return false;
+
+    // A new buffer holds zeros: upload the whole block once
+    parameters_.MarkAllDirty();
+    return true;
+}
+
+rhi::DescriptorSetLayoutDesc RenderMaterial::BuildDescriptorSetLayoutDesc() const {
+    rhi::DescriptorSetLayoutDesc layoutDesc{};
+    layoutDesc.bindingCount = 0;
+
+    // Uniform block (slot 0): written once with the ring buffer, the block is picked per draw
+    layoutDesc.bindings[layoutDesc.bindingCount].binding = 0;
+    layoutDesc.bindings[layoutDesc.bindingCount].descriptorType = static_cast<uint32_t>(rhi::DescriptorType::UniformBufferDynamic);
+    layoutDesc.bindings[layoutDesc.bindingCount].descriptorCount = 1;
+    layoutDesc.bindingCount++;
+
+    // Add texture bindings
+    for (auto const& [binding, tex] : cpuTextures_) {
+        if (layoutDesc.bindingCount >= rhi::DescriptorSetLayoutDesc::kMaxBindings) break;
+        layoutDesc.bindings[layoutDesc.bindingCount].binding = binding;
+        layoutDesc.bindings[layoutDesc.bindingCount].descriptorType = static_cast<uint32_t>(rhi::DescriptorType::CombinedImageSampler);
+        layoutDesc.bindings[layoutDesc.bindingCount].descriptorCount = 1;
+        layoutDesc.bindingCount++;
+    }
+    return layoutDesc;
 }
 
 bool RenderMaterial::CreateDescriptorSet(rhi::IDescriptorSetLayout* skinLayout) {
     if (!device_) return false;
     (void)skinLayout;  // Not used in this simplified implementation
 
+    // Instances allocate from the parent's layout
+    if (parent_ && !descriptorSetLayout_) {
+        descriptorSetLayout_ = parent_->descriptorSetLayout_;
+    }
+
     // Create descriptor set layout if not provided
     if (!descriptorSetLayout_) {
-        // Build from shader reflection
-        rhi::DescriptorSetLayoutDesc layoutDesc{};
-        layoutDesc.bindingCount = 0;
-
-        // Add uniform buffer binding (usually slot 0)
-        layoutDesc.bindings[layoutDesc.bindingCount].binding = 0;
-        layoutDesc.bindings[layoutDesc.bindingCount].descriptorType = static_cast<uint32_t>(rhi::DescriptorType::UniformBuffer);
-        layoutDesc.bindings[layoutDesc.bindingCount].descriptorCount = 1;
-        layoutDesc.bindingCount++;
-
-        // Add texture bindings
-        for (auto const& [binding, tex] : cpuTextures_) {
-            if (layoutDesc.bindingCount >= rhi::DescriptorSetLayoutDesc::kMaxBindings) break;
-            layoutDesc.bindings[layoutDesc.bindingCount].binding = binding;
-            layoutDesc.bindings[layoutDesc.bindingCount].descriptorType = static_cast<uint32_t>(rhi::DescriptorType::CombinedImageSampler);
-            layoutDesc.bindings[layoutDesc.bindingCount].descriptorCount = 1;
-            layoutDesc.bindingCount++;
-        }
-
-        descriptorSetLayout_ = device_->CreateDescriptorSetLayout(layoutDesc);
+        descriptorSetLayout_ = device_->CreateDescriptorSetLayout(BuildDescriptorSetLayoutDesc());
     }
 
     if (!descriptorSetLayout_) return false;
@@ -289,38 +362,28 @@ bool RenderMaterial::CreateDescriptorSet(rhi::IDescriptorSetLayout* skinLayout)
 }
 
 void RenderMaterial::UploadParameters() {
-    if (!uniformBuffer_ || cpuParameters_.empty()) return;
-
-    // Get layout for offset lookup
-    auto* layout = uniformBuffer_.get();
-    if (!layout) return;
-
-    // Build contiguous CPU buffer from parameters
-    auto const* refl = shaderEntry_ ? shaderEntry_->GetFragmentReflection() : nullptr;
-    if (!refl || !refl->uniformBlock.members) return;
-
-    size_t totalSize = refl->uniformBlock.totalSize;
-    std::vector<uint8_t> bufferData(totalSize, 0);
+    if (!uniformBuffer_ || !parameters_.IsDirty()) return;
 
-    // Copy each parameter to its offset
-    for (uint32_t i = 0; i < refl->uniformBlock.memberCount; ++i) {
-        auto const& member = refl->uniformBlock.members[i];
-        auto it = cpuParameters_.find(member.name);
-        if (it != cpuParameters_.end() && it->second.size() <= member.size) {
-            std::memcpy(bufferData.data() + member.offset, it->second.data(), it->second.size());
-        }
+    // The first span of a frame copies the whole block into a new ring block; the rest patch it
+    uint8_t const* data = parameters_.GetData();
+    for (ByteRange const& range : parameters_.GetDirtyRanges()) {
+        uniformBuffer_->UpdateRange(range.begin, data + range.begin, range.end - range.begin);
     }
-
-    // Upload to GPU
-    uniformBuffer_->Update(bufferData.data(), totalSize);
+    parameters_.ClearDirty();
 }
 
-void RenderMaterial::UpdateDescriptorTextures() {
-    if (!descriptorSet_ || cpuTextures_.empty()) return;
+void RenderMaterial::UpdateDescriptors(uint32_t frameSlot) {
+    if (!descriptorSet_ || !device_) return;
+
+    if (parent_ && parentTexturesVersion_ != parent_->texturesVersion_) {
+        parentTexturesVersion_ = parent_->texturesVersion_;
+        texturesDirty_ = true;
+    }
 
-    // Update texture bindings
-    for (auto const& [binding, texture] : cpuTextures_) {
-        if (texture) {
+    // Update texture bindings; an instance inherits every binding it does not set itself
+    if (texturesDirty_) {
+        auto writeTexture = [this](uint32_t binding, rhi::ITexture* texture) {
+            if (!texture) return;
             rhi::DescriptorWrite write{};
             write.dstSet = descriptorSet_;
             write.binding = binding;
@@ -331,27 +394,59 @@ void RenderMaterial::UpdateDescriptorTextures() {
             write.bufferOffset = 0;
 
             device_->UpdateDescriptorSet(descriptorSet_, &write, 1);
+        };
+        if (parent_) {
+            for (auto const& [binding, texture] : parent_->cpuTextures_) {
+                if (cpuTextures_.find(binding) == cpuTextures_.end()) {
+                    writeTexture(binding, texture);
+                }
+            }
+        }
+        for (auto const& [binding, texture] : cpuTextures_) {
+            writeTexture(binding, texture);
         }
+        texturesDirty_ = false;
     }
 
-    // Also bind uniform buffer to descriptor set
+    // The set is written once with the ring buffer; frames in flight keep their own dynamic
+    // offset, so moving to this frame's block never touches a set the GPU may be reading
     if (uniformBuffer_) {
-        auto* buffer = uniformBuffer_->GetBuffer();
-        if (buffer) {
+        auto* buffer = uniformBuffer_->GetBuffer();  // Takes this frame's block if not written yet
+        if (buffer && buffer != boundUniformBuffer_) {
             rhi::DescriptorWrite write{};
             write.dstSet = descriptorSet_;
             write.binding = 0;
-            write.type = static_cast<uint32_t>(rhi::DescriptorType::UniformBuffer);
+            write.type = static_cast<uint32_t>(rhi::DescriptorType::UniformBufferDynamic);
             write.buffer = buffer;
             write.bufferOffset = 0;
+            write.bufferRange = uniformBuffer_->GetSize();
             write.texture = nullptr;
             write.sampler = nullptr;
 
             device_->UpdateDescriptorSet(descriptorSet_, &write, 1);
+            boundUniformBuffer_ = buffer;
+        }
+        if (buffer) {
+            uniformOffset_ = static_cast<uint32_t>(uniformBuffer_->GetRingBufferOffset(frameSlot));
         }
     }
 }
 
+bool RenderMaterial::UsesOwnBindings() const {
+    return !parent_ || parameters_.HasOverrides() || !cpuTextures_.empty();
+}
+
+void RenderMaterial::EnsureOwnBindings() {
+    if (!device_) return;
+    if (!uniformBuffer_) {
+        CreateUniformBuffer();
+    }
+    if (!descriptorSetCreated_ && CreateDescriptorSet(nullptr)) {
+        descriptorSetCreated_ = true;
+        texturesDirty_ = true;
+    }
+}
+
 // === Factory functions ===
 
 RenderMaterial* CreateRenderMaterial(
@@ -363,6 +458,11 @@ RenderMaterial* CreateRenderMaterial(
     return mat;
 }
 
+RenderMaterial* CreateRenderMaterialInstance(RenderMaterial* parent) {
+    if (!parent) return nullptr;
+    return new RenderMaterial(parent);
+}
+
 void DestroyRenderMaterial(RenderMaterial* material) {
     delete material;
 }
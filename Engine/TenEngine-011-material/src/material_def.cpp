@@ -6,6 +6,7 @@
 #include "material_system_impl.hpp"
 #include <te/material/MaterialResource.h>
 #include <te/material/RenderMaterial.hpp>
+#include <te/material/parameters.hpp>
 #include <te/shader/ShaderCollection.h>
 #include <te/shader/types.hpp>
 #include <te/resource/ResourceManager.h>
@@ -33,15 +34,43 @@ struct MaterialData {
 
     std::vector<SlotInfo> slotMapping;
     std::map<std::string, SlotInfo> nameToSlot;
+
+    // Resource defaults in the shader's uniform layout; parent of every instance block
+    ParameterBlock defaults;
 };
 
 struct MaterialInstanceData {
     MaterialInstanceHandle handle;
     MaterialHandle parentHandle;
-    std::map<std::string, std::vector<uint8_t>> parameterOverrides;
+    ParameterBlock parameters;  // Child of MaterialData::defaults
     std::map<uint32_t, rhi::ITexture*> textureOverrides;
 };
 
+namespace {
+
+/** Layout from the fragment reflection when the shader is loaded, else the resource params packed std140. */
+std::shared_ptr<ParameterLayout const> BuildParameterLayout(MaterialResource const& resource,
+                                                            shader::ShaderCollectionEntry const* shaderEntry) {
+    if (shaderEntry && shaderEntry->fragmentReflection.uniformBlock.members) {
+        return ParameterLayout::FromReflection(shaderEntry->fragmentReflection);
+    }
+
+    std::vector<te::rendercore::UniformMember> members;
+    for (auto const& [name, param] : resource.GetParams()) {
+        te::rendercore::UniformMember member{};
+        std::strncpy(member.name, name.c_str(), sizeof(member.name) - 1);
+        member.type = param.type;
+        member.count = param.count;
+        members.push_back(member);
+    }
+    te::rendercore::UniformLayoutDesc desc{};
+    desc.members = members.data();
+    desc.memberCount = static_cast<uint32_t>(members.size());
+    return ParameterLayout::Create(desc);
+}
+
+}  // namespace
+
 class MaterialSystemImpl::Impl {
 public:
     std::map<uint64_t, std::unique_ptr<MaterialData>> materials;
@@ -104,6 +133,15 @@ MaterialHandle MaterialSystemImpl::Load(char const* path) {
     }
 
     MaterialHandle h = data->handle;
+    data->defaults = ParameterBlock(BuildParameterLayout(*matRes, nullptr));
+    if (auto* shaderHandle = GetShaderRef(h)) {
+        data->defaults = ParameterBlock(BuildParameterLayout(
+            *matRes, reinterpret_cast<shader::ShaderCollectionEntry const*>(shaderHandle)));
+    }
+    for (auto const& [name, param] : matRes->GetParams()) {
+        data->defaults.SetRaw(data->defaults.Find(name.c_str()), param.data.data(), param.data.size());
+    }
+
     impl_->materials[impl_->nextMaterialId] = std::move(data);
     impl_->nextMaterialId++;
 
@@ -220,12 +258,7 @@ void MaterialSystemImpl::SetScalar(MaterialInstanceHandle h,
     auto* instance = impl_->GetInstance(h);
     if (!instance || !data || size == 0) return;
 
-    std::string name(slot.name ? slot.name : "");
-    if (name.empty()) return;
-
-    auto& param = instance->parameterOverrides[name];
-    param.resize(size);
-    std::memcpy(param.data(), data, size);
+    instance->parameters.SetRaw(instance->parameters.Find(slot.name), data, size);
 }
 
 void MaterialSystemImpl::SetTexture(MaterialInstanceHandle h, 
@@ -276,6 +309,7 @@ MaterialInstanceHandle MaterialSystemImpl::CreateInstance(MaterialHandle h) {
     auto instance = std::make_unique<MaterialInstanceData>();
     instance->handle.id = impl_->nextInstanceId;
     instance->parentHandle = h;
+    instance->parameters = ParameterBlock(&data->defaults);
 
     MaterialInstanceHandle result = instance->handle;
     impl_->instances[impl_->nextInstanceId] = std::move(instance);
@@ -304,9 +338,17 @@ void MaterialSystemImpl::SubmitToPipeline(MaterialInstanceHandle h, void* pipeli
     auto* renderMaterial = reinterpret_cast<RenderMaterial*>(pipeline);
     if (!renderMaterial) return;
 
-    // Apply instance parameter overrides to render material
-    for (auto const& [name, data] : instance->parameterOverrides) {
-        renderMaterial->SetDataParameter(name.c_str(), data.data(), data.size());
+    // Apply instance parameters; only values that differ reach the render material's dirty ranges
+    instance->parameters.Resolve();
+    if (!renderMaterial->GetParameters().CopyValues(instance->parameters)) {
+        // Layouts differ (shader not loaded at Load time): fall back to name lookups for overrides
+        ParameterLayout const* layout = instance->parameters.GetLayout();
+        uint8_t const* values = instance->parameters.GetData();
+        for (ParameterIndex i = 0; layout && i < layout->GetParameterCount(); ++i) {
+            if (!instance->parameters.IsOverridden(i)) continue;
+            ParameterInfo const& info = layout->GetParameter(i);
+            renderMaterial->SetDataParameter(info.name.c_str(), values + info.offset, info.size);
+        }
     }
 
     // Apply texture overrides
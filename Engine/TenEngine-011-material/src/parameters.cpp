@@ -1,2 +1,318 @@
-// 011-Material SetScalar, SetTexture, SetBuffer, GetSlotMapping — implemented in MaterialSystemImpl (material_def.cpp)
-// This file exists for build layout; logic is in material_def.cpp.
+/**
+ * @file parameters.cpp
+ * @brief ParameterLayout and ParameterBlock. IMaterialSystem SetScalar/SetTexture/SetBuffer/GetSlotMapping
+ *        are implemented in MaterialSystemImpl (material_def.cpp).
+ */
+
+#include <te/material/parameters.hpp>
+#include <te/material/MaterialParam.hpp>
+#include <te/rendercore/shader_reflection.hpp>
+
+#include <algorithm>
+#include <cstring>
+
+namespace te {
+namespace material {
+
+namespace {
+
+using te::rendercore::UniformMemberType;
+
+constexpr size_t kMaxDirtyRanges = 8;
+
+uint32_t AlignUp(uint32_t value, uint32_t alignment) {
+  return (value + alignment - 1) / alignment * alignment;
+}
+
+uint32_t Std140Alignment(UniformMemberType type) {
+  switch (type) {
+    case UniformMemberType::Float2:
+    case UniformMemberType::Int2:
+      return 8;
+    case UniformMemberType::Float3:
+    case UniformMemberType::Float4:
+    case UniformMemberType::Int3:
+    case UniformMemberType::Int4:
+    case UniformMemberType::Mat3:
+    case UniformMemberType::Mat4:
+      return 16;
+    default:
+      return 4;
+  }
+}
+
+/** Array elements are padded to 16 bytes in std140. */
+uint32_t ElementStride(ParameterInfo const& info) {
+  uint32_t const elem = static_cast<uint32_t>(MaterialParam::GetElementSize(info.type));
+  return info.count > 1 ? AlignUp(elem, 16) : elem;
+}
+
+bool IsFloatVector(UniformMemberType type) {
+  return type == UniformMemberType::Float2 || type == UniformMemberType::Float3 || type == UniformMemberType::Float4;
+}
+
+bool IsIntVector(UniformMemberType type) {
+  return type == UniformMemberType::Int2 || type == UniformMemberType::Int3 || type == UniformMemberType::Int4;
+}
+
+}  // namespace
+
+// === ParameterLayout ===
+
+std::shared_ptr<ParameterLayout const> ParameterLayout::Create(te::rendercore::UniformLayoutDesc const& uniforms,
+                                                               te::rendercore::ShaderResourceBinding const* resources,
+                                                               uint32_t resourceCount) {
+  auto layout = std::make_shared<ParameterLayout>();
+  uint32_t end = 0;
+  for (uint32_t i = 0; uniforms.members && i < uniforms.memberCount; ++i) {
+    te::rendercore::UniformMember const& member = uniforms.members[i];
+    ParameterInfo info;
+    info.name = member.name;
+    info.type = member.type;
+    info.count = member.count;
+    if (member.size > 0) {
+      info.offset = member.offset;
+      info.size = member.size;
+    } else {
+      uint32_t const elem = static_cast<uint32_t>(MaterialParam::GetElementSize(member.type));
+      if (elem == 0) continue;
+      uint32_t const alignment = info.count > 1 ? 16u : Std140Alignment(member.type);
+      info.offset = AlignUp(end, alignment);
+      info.size = info.count > 1 ? ElementStride(info) * info.count : elem;
+    }
+    end = std::max(end, info.offset + info.size);
+    layout->byName_.emplace(info.name, static_cast<ParameterIndex>(layout->params_.size()));
+    layout->params_.push_back(std::move(info));
+  }
+  layout->size_ = std::max<size_t>(AlignUp(end, 16), uniforms.totalSize);
+
+  for (uint32_t i = 0; resources && i < resourceCount; ++i) {
+    if (resources[i].kind != te::rendercore::ShaderResourceKind::SampledImage &&
+        resources[i].kind != te::rendercore::ShaderResourceKind::StorageImage) {
+      continue;
+    }
+    TextureSlotInfo slot;
+    slot.name = resources[i].name;
+    slot.set = resources[i].set;
+    slot.binding = resources[i].binding;
+    layout->textures_.push_back(std::move(slot));
+  }
+  return layout;
+}
+
+std::shared_ptr<ParameterLayout const> ParameterLayout::FromReflection(te::rendercore::ShaderReflectionDesc const& reflection) {
+  return Create(reflection.uniformBlock, reflection.resourceBindings, reflection.resourceBindingCount);
+}
+
+ParameterIndex ParameterLayout::Find(char const* name) const {
+  if (!name) return kInvalidParameterIndex;
+  auto it = byName_.find(name);
+  return it != byName_.end() ? it->second : kInvalidParameterIndex;
+}
+
+bool ParameterLayout::FindTextureBinding(char const* name, uint32_t* outBinding) const {
+  if (!name) return false;
+  for (TextureSlotInfo const& slot : textures_) {
+    if (slot.name == name) {
+      if (outBinding) *outBinding = slot.binding;
+      return true;
+    }
+  }
+  return false;
+}
+
+// === ParameterBlock ===
+
+ParameterBlock::ParameterBlock(std::shared_ptr<ParameterLayout const> layout)
+    : layout_(std::move(layout)) {
+  if (layout_) {
+    data_.assign(layout_->GetSize(), 0);
+    MarkAllDirty();
+  }
+}
+
+ParameterBlock::ParameterBlock(ParameterBlock const* parent)
+    : layout_(parent ? parent->layout_ : nullptr), parent_(parent) {
+  if (parent_) {
+    parentVersion_ = parent_->version_;
+    if (layout_) overridden_.assign((layout_->GetParameterCount() + 63) / 64, 0);
+  }
+}
+
+bool ParameterBlock::Locate(ParameterIndex index, uint32_t element, uint32_t* outOffset, size_t* outSize) const {
+  if (!layout_ || index >= layout_->GetParameterCount()) return false;
+  ParameterInfo const& info = layout_->GetParameter(index);
+  uint32_t const count = info.count > 1 ? info.count : 1;
+  if (element >= count) return false;
+  *outOffset = info.offset + element * ElementStride(info);
+  *outSize = MaterialParam::GetElementSize(info.type);
+  return *outSize > 0 && *outOffset + *outSize <= info.offset + info.size;
+}
+
+UniformMemberType ParameterBlock::TypeOf(ParameterIndex index) const {
+  if (!layout_ || index >= layout_->GetParameterCount()) return UniformMemberType::Unknown;
+  return layout_->GetParameter(index).type;
+}
+
+bool ParameterBlock::Write(ParameterIndex index, uint32_t offset, void const* data, size_t size) {
+  if (!layout_ || static_cast<size_t>(offset) + size > layout_->GetSize()) return false;
+  if (parent_ && !IsOverridden(index)) {
+    EnsureOwnStorage();
+    overridden_[index / 64] |= 1ull << (index % 64);
+    ++overrideCount_;
+  }
+  if (std::memcmp(data_.data() + offset, data, size) != 0) {
+    std::memcpy(data_.data() + offset, data, size);
+    AddDirty(offset, static_cast<uint32_t>(offset + size));
+    ++version_;
+  }
+  return true;
+}
+
+bool ParameterBlock::SetFloat(ParameterIndex index, float value, uint32_t element) {
+  uint32_t offset = 0;
+  size_t size = 0;
+  if (TypeOf(index) != UniformMemberType::Float || !Locate(index, element, &offset, &size)) return false;
+  return Write(index, offset, &value, sizeof(value));
+}
+
+bool ParameterBlock::SetVector(ParameterIndex index, float const* value, uint32_t element) {
+  uint32_t offset = 0;
+  size_t size = 0;
+  if (!value || !IsFloatVector(TypeOf(index)) || !Locate(index, element, &offset, &size)) return false;
+  return Write(index, offset, value, size);
+}
+
+bool ParameterBlock::SetInt(ParameterIndex index, int32_t value, uint32_t element) {
+  uint32_t offset = 0;
+  size_t size = 0;
+  if (TypeOf(index) != UniformMemberType::Int || !Locate(index, element, &offset, &size)) return false;
+  return Write(index, offset, &value, sizeof(value));
+}
+
+bool ParameterBlock::SetIntVector(ParameterIndex index, int32_t const* value, uint32_t element) {
+  uint32_t offset = 0;
+  size_t size = 0;
+  if (!value || !IsIntVector(TypeOf(index)) || !Locate(index, element, &offset, &size)) return false;
+  return Write(index, offset, value, size);
+}
+
+bool ParameterBlock::SetMatrix(ParameterIndex index, float const* value, uint32_t element) {
+  UniformMemberType const type = TypeOf(index);
+  uint32_t offset = 0;
+  size_t size = 0;
+  if (!value || (type != UniformMemberType::Mat3 && type != UniformMemberType::Mat4) ||
+      !Locate(index, element, &offset, &size)) {
+    return false;
+  }
+  if (type == UniformMemberType::Mat4) {
+    return Write(index, offset, value, size);
+  }
+  float columns[12] = {};  // std140 pads each mat3 column to a vec4
+  for (int c = 0; c < 3; ++c) {
+    std::memcpy(columns + c * 4, value + c * 3, 3 * sizeof(float));
+  }
+  return Write(index, offset, columns, sizeof(columns));
+}
+
+bool ParameterBlock::SetRaw(ParameterIndex index, void const* data, size_t size) {
+  if (!data || size == 0 || !layout_ || index >= layout_->GetParameterCount()) return false;
+  ParameterInfo const& info = layout_->GetParameter(index);
+  if (size > info.size) return false;
+  return Write(index, info.offset, data, size);
+}
+
+void ParameterBlock::ResetToParent(ParameterIndex index) {
+  if (!parent_ || !IsOverridden(index)) return;
+  overridden_[index / 64] &= ~(1ull << (index % 64));
+  --overrideCount_;
+  ParameterInfo const& info = layout_->GetParameter(index);
+  uint8_t const* src = parent_->GetData() + info.offset;
+  if (std::memcmp(data_.data() + info.offset, src, info.size) != 0) {
+    std::memcpy(data_.data() + info.offset, src, info.size);
+    AddDirty(info.offset, info.offset + info.size);
+    ++version_;
+  }
+}
+
+bool ParameterBlock::IsOverridden(ParameterIndex index) const {
+  if (!parent_ || index / 64 >= overridden_.size()) return false;
+  return (overridden_[index / 64] >> (index % 64)) & 1u;
+}
+
+bool ParameterBlock::CopyValues(ParameterBlock const& other) {
+  if (!layout_ || other.GetSize() != GetSize()) return false;
+  uint8_t const* src = other.GetData();
+  for (ParameterIndex i = 0; i < layout_->GetParameterCount(); ++i) {
+    ParameterInfo const& info = layout_->GetParameter(i);
+    if (std::memcmp(GetData() + info.offset, src + info.offset, info.size) != 0) {
+      Write(i, info.offset, src + info.offset, info.size);
+    }
+  }
+  return true;
+}
+
+void ParameterBlock::Resolve() {
+  if (!parent_ || parentVersion_ == parent_->version_) return;
+  parentVersion_ = parent_->version_;
+  if (data_.empty()) {
+    MarkAllDirty();  // Mirrors the parent byte for byte
+    return;
+  }
+  uint8_t const* src = parent_->GetData();
+  for (ParameterIndex i = 0; i < layout_->GetParameterCount(); ++i) {
+    if (IsOverridden(i)) continue;
+    ParameterInfo const& info = layout_->GetParameter(i);
+    if (std::memcmp(data_.data() + info.offset, src + info.offset, info.size) != 0) {
+      std::memcpy(data_.data() + info.offset, src + info.offset, info.size);
+      AddDirty(info.offset, info.offset + info.size);
+      ++version_;
+    }
+  }
+}
+
+uint8_t const* ParameterBlock::GetData() const {
+  if (data_.empty() && parent_) return parent_->GetData();
+  return data_.data();
+}
+
+void ParameterBlock::MarkAllDirty() {
+  dirty_.clear();
+  if (GetSize() > 0) dirty_.push_back({0, static_cast<uint32_t>(GetSize())});
+}
+
+void ParameterBlock::EnsureOwnStorage() {
+  if (!data_.empty() || !layout_) return;
+  uint8_t const* src = parent_ ? parent_->GetData() : nullptr;
+  if (src) {
+    data_.assign(src, src + layout_->GetSize());
+  } else {
+    data_.assign(layout_->GetSize(), 0);
+  }
+  if (parent_) parentVersion_ = parent_->version_;
+  MarkAllDirty();
+}
+
+void ParameterBlock::AddDirty(uint32_t begin, uint32_t end) {
+  // Keep ranges sorted; merge overlapping or touching spans
+  auto it = std::lower_bound(dirty_.begin(), dirty_.end(), begin,
+                             [](ByteRange const& r, uint32_t value) { return r.end < value; });
+  if (it != dirty_.end() && it->begin <= end) {
+    it->begin = std::min(it->begin, begin);
+    it->end = std::max(it->end, end);
+    auto next = it + 1;
+    while (next != dirty_.end() && next->begin <= it->end) {
+      it->end = std::max(it->end, next->end);
+      next = dirty_.erase(next);
+    }
+  } else {
+    dirty_.insert(it, ByteRange{begin, end});
+  }
+  if (dirty_.size() > kMaxDirtyRanges) {
+    dirty_.front().end = dirty_.back().end;
+    dirty_.resize(1);
+  }
+}
+
+}  // namespace material
+}  // namespace te
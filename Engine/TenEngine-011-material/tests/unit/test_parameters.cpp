@@ -0,0 +1,218 @@
+/**
+ * @file test_parameters.cpp
+ * @brief Unit tests for ParameterLayout std140 offsets and ParameterBlock dirty ranges,
+ *        copy-on-write child overrides, ResetToParent and Resolve.
+ */
+
+#include <te/material/parameters.hpp>
+#include <te/rendercore/uniform_layout.hpp>
+#include <cassert>
+#include <cstring>
+#include <vector>
+
+using namespace te::material;
+using te::rendercore::UniformLayoutDesc;
+using te::rendercore::UniformMember;
+using te::rendercore::UniformMemberType;
+
+namespace {
+
+UniformMember Member(char const* name, UniformMemberType type, uint32_t count = 1) {
+  UniformMember m{};
+  std::strncpy(m.name, name, sizeof(m.name) - 1);
+  m.type = type;
+  m.count = count;
+  return m;
+}
+
+std::shared_ptr<ParameterLayout const> MakeLayout() {
+  // Sizes of 0 ask ParameterLayout to pack std140
+  static UniformMember members[] = {
+      Member("roughness", UniformMemberType::Float),
+      Member("tint", UniformMemberType::Float3),
+      Member("metallic", UniformMemberType::Float),
+      Member("world", UniformMemberType::Mat4),
+      Member("lights", UniformMemberType::Float4, 2),
+      Member("flags", UniformMemberType::Int),
+  };
+  UniformLayoutDesc desc{};
+  desc.members = members;
+  desc.memberCount = sizeof(members) / sizeof(members[0]);
+  return ParameterLayout::Create(desc);
+}
+
+float ReadFloat(ParameterBlock const& block, uint32_t offset) {
+  float v = 0.0f;
+  std::memcpy(&v, block.GetData() + offset, sizeof(v));
+  return v;
+}
+
+void TestLayoutOffsets() {
+  auto layout = MakeLayout();
+  assert(layout->GetParameterCount() == 6);
+  ParameterInfo const& roughness = layout->GetParameter(layout->Find("roughness"));
+  ParameterInfo const& tint = layout->GetParameter(layout->Find("tint"));
+  ParameterInfo const& metallic = layout->GetParameter(layout->Find("metallic"));
+  ParameterInfo const& world = layout->GetParameter(layout->Find("world"));
+  ParameterInfo const& lights = layout->GetParameter(layout->Find("lights"));
+  ParameterInfo const& flags = layout->GetParameter(layout->Find("flags"));
+  assert(roughness.offset == 0 && roughness.size == 4);
+  assert(tint.offset == 16 && tint.size == 12);    // vec3 aligns to 16
+  assert(metallic.offset == 28);                   // float packs into the vec3's tail
+  assert(world.offset == 32 && world.size == 64);
+  assert(lights.offset == 96 && lights.size == 32);  // Array elements stride 16
+  assert(flags.offset == 128);
+  assert(layout->GetSize() == 144);                // Rounded up to 16
+  assert(layout->Find("missing") == kInvalidParameterIndex);
+
+  // Explicit offsets from reflection are kept as is
+  UniformMember explicitMember = Member("scale", UniformMemberType::Float);
+  explicitMember.offset = 48;
+  explicitMember.size = 4;
+  UniformLayoutDesc desc{};
+  desc.members = &explicitMember;
+  desc.memberCount = 1;
+  desc.totalSize = 64;
+  auto reflected = ParameterLayout::Create(desc);
+  assert(reflected->GetParameter(0).offset == 48);
+  assert(reflected->GetSize() == 64);
+}
+
+void TestSettersAndDirtyRanges() {
+  auto layout = MakeLayout();
+  ParameterBlock block(layout);
+  assert(block.IsDirty() && block.GetDirtyRanges().size() == 1);  // New block uploads everything
+  block.ClearDirty();
+
+  ParameterIndex const roughness = block.Find("roughness");
+  ParameterIndex const tint = block.Find("tint");
+  ParameterIndex const metallic = block.Find("metallic");
+  ParameterIndex const lights = block.Find("lights");
+
+  uint64_t version = block.GetVersion();
+  assert(block.SetFloat(roughness, 0.5f));
+  assert(block.GetVersion() == version + 1);
+  assert(ReadFloat(block, 0) == 0.5f);
+  assert(block.SetFloat(roughness, 0.5f));  // Unchanged value: no new dirty span or version
+  assert(block.GetVersion() == version + 1);
+
+  assert(block.SetFloat(metallic, 1.0f));
+  std::vector<ByteRange> const& ranges = block.GetDirtyRanges();
+  assert(ranges.size() == 2);
+  assert(ranges[0].begin == 0 && ranges[0].end == 4);
+  assert(ranges[1].begin == 28 && ranges[1].end == 32);
+
+  float const color[3] = {1.0f, 0.5f, 0.25f};
+  assert(block.SetVector(tint, color));  // [16, 28) touches [28, 32) and merges
+  assert(block.GetDirtyRanges().size() == 2);
+  assert(block.GetDirtyRanges()[1].begin == 16 && block.GetDirtyRanges()[1].end == 32);
+
+  float const light[4] = {1.0f, 2.0f, 3.0f, 4.0f};
+  assert(block.SetVector(lights, light, 1));
+  assert(block.GetDirtyRanges().back().begin == 112 && block.GetDirtyRanges().back().end == 128);
+
+  // Invalid index, wrong type, element past the array and oversize raw writes are rejected
+  assert(!block.SetFloat(kInvalidParameterIndex, 1.0f));
+  assert(!block.SetInt(roughness, 3));
+  assert(!block.SetVector(lights, light, 2));
+  uint8_t big[8] = {};
+  assert(!block.SetRaw(roughness, big, sizeof(big)));
+
+  block.ClearDirty();
+  assert(!block.IsDirty());
+
+  // Many scattered writes collapse into one covering span
+  ParameterBlock scattered(layout);
+  scattered.ClearDirty();
+  float const m[16] = {1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15, 16};
+  for (ParameterIndex i = 0; i < layout->GetParameterCount(); ++i) {
+    ParameterInfo const& info = layout->GetParameter(i);
+    scattered.SetRaw(i, m, info.size < sizeof(float) ? info.size : sizeof(float));
+  }
+  assert(scattered.GetDirtyRanges().size() <= 8);
+  assert(scattered.GetDirtyRanges().front().begin == 0);
+}
+
+void TestChildCopyOnWrite() {
+  auto layout = MakeLayout();
+  ParameterBlock parent(layout);
+  ParameterIndex const roughness = parent.Find("roughness");
+  ParameterIndex const metallic = parent.Find("metallic");
+  assert(parent.SetFloat(roughness, 0.25f));
+  assert(parent.SetFloat(metallic, 0.75f));
+
+  ParameterBlock child(&parent);
+  assert(child.GetParent() == &parent);
+  assert(!child.HasOverrides());
+  assert(child.GetData() == parent.GetData());  // Shares the parent's bytes until first override
+
+  // A rejected write does not create an override or storage
+  assert(!child.SetInt(roughness, 1));
+  assert(!child.HasOverrides() && child.GetData() == parent.GetData());
+
+  child.ClearDirty();
+  assert(child.SetFloat(roughness, 0.9f));
+  assert(child.HasOverrides() && child.IsOverridden(roughness) && !child.IsOverridden(metallic));
+  assert(child.GetData() != parent.GetData());
+  assert(ReadFloat(child, 0) == 0.9f && ReadFloat(child, 28) == 0.75f);
+  assert(ReadFloat(parent, 0) == 0.25f);
+  assert(child.IsDirty());  // Own storage: full upload once
+
+  // Parent edits flow into non-overridden parameters only
+  child.ClearDirty();
+  assert(parent.SetFloat(metallic, 0.5f));
+  assert(parent.SetFloat(roughness, 0.1f));
+  child.Resolve();
+  assert(ReadFloat(child, 28) == 0.5f);
+  assert(ReadFloat(child, 0) == 0.9f);
+  assert(child.GetDirtyRanges().size() == 1);
+  assert(child.GetDirtyRanges()[0].begin == 28 && child.GetDirtyRanges()[0].end == 32);
+
+  // Nothing changed since the last Resolve
+  child.ClearDirty();
+  child.Resolve();
+  assert(!child.IsDirty());
+
+  // ResetToParent restores the parent value and follows it again
+  child.ResetToParent(roughness);
+  assert(!child.IsOverridden(roughness) && !child.HasOverrides());
+  assert(ReadFloat(child, 0) == 0.1f);
+  assert(child.IsDirty());
+  assert(parent.SetFloat(roughness, 0.3f));
+  child.Resolve();
+  assert(ReadFloat(child, 0) == 0.3f);
+}
+
+void TestChildWithoutOverridesFollowsParent() {
+  auto layout = MakeLayout();
+  ParameterBlock parent(layout);
+  ParameterBlock child(&parent);
+  child.ClearDirty();
+  assert(parent.SetFloat(parent.Find("roughness"), 0.6f));
+  child.Resolve();
+  assert(child.IsDirty());  // Mirrors the parent: everything is re-read
+  assert(ReadFloat(child, 0) == 0.6f);
+  assert(child.GetData() == parent.GetData());
+}
+
+void TestCopyValues() {
+  auto layout = MakeLayout();
+  ParameterBlock a(layout);
+  ParameterBlock b(layout);
+  assert(a.SetFloat(a.Find("metallic"), 0.4f));
+  b.ClearDirty();
+  assert(b.CopyValues(a));
+  assert(ReadFloat(b, 28) == 0.4f);
+  assert(b.GetDirtyRanges().size() == 1 && b.GetDirtyRanges()[0].begin == 28);
+}
+
+}  // namespace
+
+int main() {
+  TestLayoutOffsets();
+  TestSettersAndDirtyRanges();
+  TestChildCopyOnWrite();
+  TestChildWithoutOverridesFollowsParent();
+  TestCopyValues();
+  return 0;
+}
@@ -0,0 +1,109 @@
+/**
+ * @file test_render_material.cpp
+ * @brief RenderMaterial on the Null RHI backend: the uniform block binds through a dynamic offset,
+ *        so each frame in flight keeps its own ring block while the descriptor set is written once.
+ */
+
+#include <te/material/RenderMaterial.hpp>
+#include <te/rendercore/IShaderEntry.hpp>
+#include <te/rendercore/pipeline_cache.hpp>
+#include <te/rendercore/uniform_buffer.hpp>
+#include <te/rhi/backend_null.hpp>
+#include <te/rhi/command_list.hpp>
+#include <te/rhi/device.hpp>
+#include <cassert>
+#include <cstdio>
+#include <cstring>
+
+using namespace te::material;
+namespace rc = te::rendercore;
+
+namespace {
+
+struct TestShaderEntry : rc::IShaderEntry {
+  uint32_t bytecode[4] = {0x07230203u, 0u, 0u, 0u};
+  rc::UniformMember member{};
+  rc::ShaderReflectionDesc reflection{};
+
+  TestShaderEntry() {
+    std::strcpy(member.name, "color");
+    member.type = rc::UniformMemberType::Float4;
+    member.count = 1;
+    reflection.uniformBlock.members = &member;
+    reflection.uniformBlock.memberCount = 1;
+  }
+  void const* GetVertexBytecode() const override { return bytecode; }
+  std::size_t GetVertexBytecodeSize() const override { return sizeof(bytecode); }
+  void const* GetFragmentBytecode() const override { return bytecode; }
+  std::size_t GetFragmentBytecodeSize() const override { return sizeof(bytecode); }
+  rc::VertexFormatDesc const* GetVertexInput() const override { return nullptr; }
+  rc::ShaderReflectionDesc const* GetVertexReflection() const override { return nullptr; }
+  rc::ShaderReflectionDesc const* GetFragmentReflection() const override { return &reflection; }
+};
+
+float ReadRed(te::rhi::IBuffer* buffer, uint32_t offset) {
+  float red = 0.0f;
+  std::memcpy(&red, static_cast<uint8_t*>(te::rhi::GetNullBufferData(buffer, nullptr)) + offset, sizeof(red));
+  return red;
+}
+
+void TestDynamicUniformOffset(te::rhi::IDevice* device) {
+  TestShaderEntry shader;
+  RenderMaterial* material = CreateRenderMaterial(&shader, PipelineStateDesc{});
+  material->SetDevice(device);
+  material->CreateDeviceResource();
+  assert(material->IsDeviceReady());
+  te::rhi::IDescriptorSet* set = material->GetDescriptorSet();
+  rc::IUniformRing* ring = rc::GetDeviceUniformRing(device);
+
+  // Frame 1 is submitted and still in flight when frame 2 writes a new value
+  ring->BeginFrame(0);
+  float const red[4] = {1.0f, 0.0f, 0.0f, 1.0f};
+  material->SetDataParameter("color", red, sizeof(red));
+  material->UpdateDeviceResource(device, 0);
+  uint32_t const frame1 = material->GetUniformBufferOffset();
+  ring->EndFrame(1);
+
+  ring->BeginFrame(0);
+  float const half[4] = {0.5f, 0.0f, 0.0f, 1.0f};
+  material->SetDataParameter("color", half, sizeof(half));
+  material->UpdateDeviceResource(device, 1);
+  uint32_t const frame2 = material->GetUniformBufferOffset();
+  ring->EndFrame(2);
+
+  assert(frame1 != frame2);
+  assert(frame1 % ring->GetAlignment() == 0 && frame2 % ring->GetAlignment() == 0);
+  assert(material->GetDescriptorSet() == set);  // Same set, never rewritten for the new block
+  assert(ReadRed(ring->GetBuffer(), frame1) == 1.0f);  // Frame 1's block is left untouched
+  assert(ReadRed(ring->GetBuffer(), frame2) == 0.5f);
+
+  // Draws pass the frame's offset with the set
+  te::rhi::ICommandList* cmd = device->CreateCommandList();
+  cmd->Begin();
+  cmd->BindDescriptorSet(0u, set, &frame2, 1u);
+  cmd->End();
+  size_t count = 0;
+  te::rhi::RecordedCommand const* commands = te::rhi::GetRecordedCommands(cmd, &count);
+  assert(count == 1 && commands[0].object == set && commands[0].offset == frame2);
+  device->DestroyCommandList(cmd);
+
+  // An instance without overrides draws with the parent's block
+  RenderMaterial* instance = CreateRenderMaterialInstance(material);
+  instance->UpdateDeviceResource(device, 1);
+  assert(instance->GetDescriptorSet() == set && instance->GetUniformBufferOffset() == frame2);
+  DestroyRenderMaterial(instance);
+  DestroyRenderMaterial(material);
+}
+
+}  // namespace
+
+int main() {
+  te::rhi::IDevice* device = te::rhi::CreateDevice(te::rhi::Backend::Null);
+  assert(device);
+  TestDynamicUniformOffset(device);
+  rc::ReleaseDevicePipelineCache(device);
+  rc::ReleaseDeviceUniformRing(device);
+  te::rhi::DestroyDevice(device);
+  std::printf("test_render_material: pass\n");
+  return 0;
+}
@@ -6,7 +6,7 @@
  * - Remote resource providers (CDN, servers)
  * - Download management
  * - Chunk/Patch system
- * - Offline caching
+ * - Offline caching (content-addressed local cache with LRU quota)
  */
 #ifndef TE_RESOURCE_REMOTE_RESOURCE_H
 #define TE_RESOURCE_REMOTE_RESOURCE_H
@@ -19,6 +19,7 @@
 #include <functional>
 #include <unordered_map>
 #include <chrono>
+#include <cstdint>
 
 namespace te {
 namespace resource {
@@ -64,7 +65,7 @@ struct DownloadProgress {
   std::size_t downloadedBytes = 0;  // Bytes downloaded
   float progress = 0.0f;        // 0.0 to 1.0
   std::size_t bytesPerSecond = 0;  // Download speed
-  std::chrono::seconds estimatedTimeRemaining;
+  std::chrono::seconds estimatedTimeRemaining{0};
   std::string errorMessage;
 };
 
@@ -135,6 +136,53 @@ class IRemoteResourceProvider {
    * Get list of available resources.
    */
   virtual void GetAvailableResources(std::vector<std::string>& outResources) = 0;
+  
+  /**
+   * Read part of a resource (transport). Called from download worker threads.
+   * @param resourceId Resource ID
+   * @param offset Byte offset to start at
+   * @param maxBytes Maximum number of bytes to read
+   * @param outData Output bytes; empty at end of resource
+   * @return false on transport error
+   */
+  virtual bool ReadRange(std::string const& resourceId,
+                         std::size_t offset,
+                         std::size_t maxBytes,
+                         std::vector<std::uint8_t>& outData) = 0;
+};
+
+/**
+ * Create a provider serving files under a local directory ("remote" for tests and
+ * offline builds). Resource IDs are paths relative to rootDir; hash and version are
+ * the content hash.
+ */
+std::unique_ptr<IRemoteResourceProvider> CreateFileSystemProvider(std::string const& name,
+                                                                  std::string const& rootDir);
+
+/**
+ * Content hash used by the remote cache (SHA-256, lowercase hex).
+ */
+std::string ComputeContentHash(void const* data, std::size_t size);
+
+/**
+ * Content hash of a file; false if it cannot be read.
+ */
+bool ComputeFileContentHash(std::string const& path, std::string& outHash);
+
+/**
+ * Local cache configuration for IDownloadManager.
+ *
+ * Layout under cacheRoot:
+ * - objects/<h0h1>/<hash>: verified content, one file per distinct hash
+ * - partial/<hash>.part: interrupted downloads, resumed from their size
+ * - refs.json: resource ID -> hash
+ */
+struct RemoteCacheConfig {
+  std::string cacheRoot;                          // Required before downloading
+  std::size_t quotaBytes = 1024ull * 1024 * 1024; // LRU eviction above this
+  std::size_t maxConcurrentDownloads = 4;         // Fetches running at once
+  std::size_t chunkSize = 256 * 1024;             // Bytes per ReadRange
+  bool verifyOnRead = true;                       // Re-hash objects changed on disk since last check
 };
 
 /**
@@ -192,14 +240,45 @@ class IDownloadManager {
    */
   virtual IRemoteResourceProvider* GetProvider(std::string const& name) = 0;
   
+  //==========================================================================
+  // Local Cache
+  //==========================================================================
+  
+  /**
+   * Set the local cache configuration; scans cacheRoot for existing objects
+   * (last-write time gives their LRU order) and applies the quota.
+   */
+  virtual bool SetCacheConfig(RemoteCacheConfig const& config) = 0;
+  
+  /**
+   * Get the local cache configuration.
+   */
+  virtual RemoteCacheConfig GetCacheConfig() const = 0;
+  
+  /**
+   * Get the bytes held by cached objects.
+   */
+  virtual std::size_t GetCacheUsage() const = 0;
+  
+  /**
+   * Evict least recently used objects until usage fits the quota.
+   * @return Number of objects evicted
+   */
+  virtual std::size_t TrimCache() = 0;
+  
   //==========================================================================
   // Download Operations
   //==========================================================================
   
   /**
    * Queue a resource for download.
+   * Content already cached under the same hash (e.g. unchanged across versions)
+   * completes at once with DownloadResult::AlreadyExists; concurrent requests for the
+   * same content share one fetch. Completion and progress callbacks are routed through
+   * the thread pool (main thread by default).
    * @param resourceId Resource ID to download
-   * @param localPath Local path to save to
+   * @param localPath Optional extra copy (hard link where possible); empty keeps the
+   *                  content only in the cache
    * @param priority Download priority
    * @param onComplete Completion callback
    * @param onProgress Progress callback (optional)
@@ -219,7 +298,7 @@ class IDownloadManager {
   virtual void CancelDownload(void* downloadHandle) = 0;
   
   /**
-   * Pause a download.
+   * Pause a download. Bytes fetched so far stay in the partial file.
    */
   virtual void PauseDownload(void* downloadHandle) = 0;
   
@@ -245,9 +324,10 @@ class IDownloadManager {
   /**
    * Queue multiple resources for download.
    * @param resourceIds Resource IDs to download
-   * @param localDir Local directory to save to
+   * @param localDir Local directory to save to (file name from the resource ID)
    * @param priority Download priority
-   * @param onComplete Completion callback (called when all complete)
+   * @param onComplete Completion callback (called once when all complete, with an empty
+   *                   resource ID and the first non-success result, if any)
    * @param onProgress Progress callback (optional)
    * @param userData User data
    * @return Download handle for batch
@@ -274,17 +354,18 @@ class IDownloadManager {
   virtual bool IsDownloaded(std::string const& resourceId) = 0;
   
   /**
-   * Get local path for a downloaded resource.
+   * Get local path (cache object) for a downloaded resource.
+   * Verifies the content if it changed on disk since last checked; marks it recently used.
    */
   virtual bool GetLocalPath(std::string const& resourceId, std::string& outPath) = 0;
   
   /**
-   * Verify a downloaded resource.
+   * Verify a downloaded resource against its hash; corrupt content is removed.
    */
   virtual bool VerifyResource(std::string const& resourceId) = 0;
   
   /**
-   * Delete a downloaded resource.
+   * Delete a downloaded resource. The object stays while other resources reference it.
    */
   virtual bool DeleteDownloadedResource(std::string const& resourceId) = 0;
 };
@@ -130,6 +130,8 @@ bool IResource::LoadDependencies(T const* desc, GetDepsFn getDeps, IResourceMana
 
     // Extract dependency list using function object
     std::vector<ResourceId> deps = getDeps(desc);
+    // Record edges for GetDependencyTree and hot reload fan-out (also clears stale edges)
+    manager->SetDependencies(GetResourceId(), deps);
     if (deps.empty()) {
         return true;  // No dependencies
     }
@@ -189,6 +189,9 @@ class IResourceProfiler {
   /**
    * End profiling a resource load.
    * Called by ResourceManager at the end of a load operation.
+   * Pairs with the most recent BeginLoad on the calling thread; id may differ from the one
+   * passed to BeginLoad (the ID is often only known once the resource has loaded).
+   * Loads nested inside another load count as that load's dependency time.
    */
   virtual void EndLoad(ResourceId id, bool success) = 0;
   
@@ -212,6 +215,11 @@ class IResourceProfiler {
    */
   virtual void RecordCacheMiss(ResourceId id) = 0;
   
+  /**
+   * Record that a resource left the cache (drops it from resident memory statistics).
+   */
+  virtual void RecordUnload(ResourceId id) = 0;
+  
   //==========================================================================
   // Data Retrieval
   //==========================================================================
@@ -242,6 +250,11 @@ class IResourceProfiler {
    */
   virtual void GetLargestResources(std::size_t count,
                                     std::vector<ResourceProfileData>& outData) const = 0;
+  
+  /**
+   * Get resident memory recorded for a loaded resource (0 when not resident).
+   */
+  virtual std::size_t GetResidentMemory(ResourceId id) const = 0;
 };
 
 /**
@@ -271,13 +284,30 @@ class IResourceLeakDetector {
    */
   virtual void SetCaptureStackTrace(bool capture) = 0;
   
+  //==========================================================================
+  // Tracking
+  //==========================================================================
+  
+  /**
+   * Record a handle handed out for a resource (fresh load or cache hit).
+   * Called by ResourceManager.
+   */
+  virtual void RecordAcquire(ResourceId id, std::string const& path, ResourceType type) = 0;
+  
+  /**
+   * Record a handle returned through Unload.
+   * Called by ResourceManager.
+   */
+  virtual void RecordRelease(ResourceId id) = 0;
+  
   //==========================================================================
   // Detection Operations
   //==========================================================================
   
   /**
    * Detect potential resource leaks.
-   * A leak is a resource that has been loaded but not properly released.
+   * A leak is a resource that has been loaded but not properly released: it is still cached
+   * and holds more handles than it did at MarkBaseline.
    * @param manager Resource manager
    * @param outLeaks Output vector of leak info
    * @return Number of potential leaks found
@@ -303,6 +333,7 @@ class IResourceLeakDetector {
   
   /**
    * Mark current state as baseline (resources loaded now won't be reported as leaks).
+   * Handles acquired later on top of a baseline resource are still reported.
    */
   virtual void MarkBaseline() = 0;
   
@@ -473,6 +504,18 @@ class IResourceDebugManager {
  */
 IResourceDebugManager* GetResourceDebugManager();
 
+/**
+ * Headless report for build machines: point manager at assetRoot, load every manifest
+ * resource once with the profiler enabled (profiling data is reset first), and write a JSON
+ * report with load times, slowest and largest resources, memory by type and repository, and
+ * the dependency graph. Resource factories must already be registered. Everything loaded
+ * here is unloaded before returning.
+ * @param topCount Number of entries in the slowest/largest lists
+ * @return false if assetRoot is null or no manifest resource could be loaded
+ */
+bool GenerateOfflineResourceReport(IResourceManager* manager, char const* assetRoot,
+                                   std::string& outJson, std::size_t topCount = 10);
+
 /**
  * Scoped profiler helper.
  * Automatically records load time.
@@ -499,6 +542,12 @@ class ScopedResourceProfiler {
   
   void SetSuccess(bool success) { success_ = success; }
   
+  /** Report the loaded resource's ID (often unknown at construction). */
+  void SetResult(ResourceId id, bool success) {
+    id_ = id;
+    success_ = success;
+  }
+  
  private:
   IResourceProfiler* profiler_;
   ResourceId id_;
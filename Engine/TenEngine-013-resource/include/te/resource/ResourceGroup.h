@@ -7,6 +7,10 @@
  * - Batch load/unload operations
  * - Dependency-aware group management
  * - Scene/level resource organization
+ *
+ * Resources held by groups are reference counted per group: a resource shared by
+ * several groups stays resident until the last of them unloads it, and a load
+ * already in flight for one group is joined, not repeated, by another.
  */
 #ifndef TE_RESOURCE_RESOURCE_GROUP_H
 #define TE_RESOURCE_RESOURCE_GROUP_H
@@ -46,7 +50,10 @@ struct ResourceGroupInfo {
   std::string description;              // Optional description
   std::size_t resourceCount = 0;        // Number of resources in group
   std::size_t loadedCount = 0;          // Number of currently loaded resources
-  std::size_t totalSize = 0;            // Total estimated memory size
+  std::size_t failedCount = 0;          // Resources of the last load that failed or were cancelled
+  std::size_t totalSize = 0;            // Total estimated memory size (bytes on disk of the last load)
+  std::size_t loadedSize = 0;           // Part of totalSize already resident
+  float progress = 0.0f;                // Finished / requested resources of the last load, 0.0 to 1.0
   bool isLoaded = false;                // Are all resources loaded
   bool isLoading = false;               // Is currently loading
 };
@@ -135,20 +142,37 @@ class ResourceGroup {
   //==========================================================================
   
   /**
-   * Load all resources in the group asynchronously.
+   * Load all resources in the group asynchronously as one batch.
+   * Members and their known dependencies are deduplicated and requested at
+   * priority, dependencies first. Resources already held by another group or
+   * cached by the manager complete at once; loads in flight for another group
+   * are shared. Callbacks run on the manager's callback thread.
    * @param manager Resource manager
    * @param priority Load priority
-   * @param callback Completion callback
+   * @param callback Completion callback (cancelled resources count as failed)
    * @param user_data User data for callback
-   * @return true if load started
+   * @return true if load started (false while a load of this group is running)
    */
   bool LoadAllAsync(IResourceManager* manager,
                     LoadPriority priority,
                     GroupLoadCompleteCallback callback,
                     void* user_data);
   
+  /**
+   * Cancel the running load. Requests no other group waits on are cancelled;
+   * the completion callback runs with the resources finished so far.
+   */
+  void CancelLoad();
+
+  /**
+   * Check if a load started by LoadAllAsync is still running.
+   */
+  bool IsLoading() const;
+
   /**
    * Unload all resources in the group.
+   * Releases this group's reference to each resource it holds; a resource is
+   * unloaded when no other group holds it. Cancels a running load first.
    * @param manager Resource manager
    * @param force If true, unload even if referenced elsewhere
    * @return Number of resources unloaded
@@ -188,21 +212,19 @@ class ResourceGroup {
   /**
    * Get estimated total memory usage.
    * @param manager Resource manager
-   * @return Total memory usage in bytes
+   * @return Total memory usage in bytes (manager-reported, else estimated from file size)
    */
   std::size_t GetTotalMemoryUsage(IResourceManager* manager) const;
   
+  struct LoadState;  // Defined in ResourceGroup.cpp
+
  private:
   std::string name_;
   std::string description_;
   std::unordered_set<ResourceId> resources_;
   
-  // Async load tracking
-  std::size_t pendingLoads_ = 0;
-  std::size_t loadSuccessCount_ = 0;
-  std::size_t loadFailedCount_ = 0;
-  GroupLoadCompleteCallback loadCallback_ = nullptr;
-  void* loadUserData_ = nullptr;
+  // Last batch load and the resources this group holds; shared with in-flight load callbacks
+  std::shared_ptr<LoadState> load_;
 };
 
 /**
@@ -261,6 +283,21 @@ class IResourceGroupManager {
    * @return Number of resources unloaded
    */
   virtual std::size_t UnloadGroup(std::string const& groupName, bool force = false) = 0;
+
+  /**
+   * Cancel the running load of a group.
+   * @param groupName Group name
+   * @return true if the group was loading
+   */
+  virtual bool CancelGroupLoad(std::string const& groupName) = 0;
+
+  /**
+   * Get aggregate state of a group (progress, bytes, counts).
+   * @param groupName Group name
+   * @param outInfo Output info
+   * @return true if group exists
+   */
+  virtual bool GetGroupInfo(std::string const& groupName, ResourceGroupInfo& outInfo) const = 0;
 };
 
 /**
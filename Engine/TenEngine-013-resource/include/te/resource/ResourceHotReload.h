@@ -87,6 +87,11 @@ using HotReloadSubscriptionHandle = void*;
 /**
  * File watcher interface.
  * Monitors file system for changes.
+ *
+ * Changes are collected by a background thread (inotify on Linux,
+ * ReadDirectoryChangesW on Windows, timestamp polling elsewhere), coalesced per path and held until the path has been quiet
+ * for the debounce time, so an editor save arrives as one event. Event paths are
+ * absolute and lexically normalized with '/' separators.
  */
 class IFileWatcher {
  public:
@@ -146,8 +151,25 @@ class IFileWatcher {
    * Get number of pending file change events.
    */
   virtual std::size_t GetPendingEventCount() const = 0;
+
+  /**
+   * Set how long a path must be quiet before its event is dispatched (default 500 ms).
+   */
+  virtual void SetDebounceTime(std::chrono::milliseconds debounceTime) = 0;
+
+  /**
+   * Block until a pending event is ready for ProcessPendingEvents, the timeout
+   * expires or the watcher stops.
+   * @return true if an event is ready
+   */
+  virtual bool WaitForEvents(std::chrono::milliseconds timeout) = 0;
 };
 
+/**
+ * Create a standalone file watcher (caller owns; delete when done).
+ */
+IFileWatcher* CreateFileWatcher();
+
 /**
  * Hot reload manager interface.
  * Manages hot reload functionality.
@@ -193,6 +193,15 @@ class IResourceManager {
    */
   virtual IResource* GetCached(ResourceId id) const = 0;
 
+  /**
+   * Like GetCached but takes no reference; the pointer is valid until the resource is unloaded.
+   * Thread-safe.
+   * 
+   * @param id Resource ID
+   * @return Cached IResource* or nullptr
+   */
+  virtual IResource* PeekCached(ResourceId id) const = 0;
+
   /**
    * Synchronous load.
    * Creates resource instance (by ResourceType) and calls IResource::Load.
@@ -321,6 +330,25 @@ class IResourceManager {
                                   std::vector<ResourceId>& out_dependencies,
                                   std::size_t max_depth = 0) const = 0;
 
+  /**
+   * Record the direct dependencies of a resource (replaces any previous list).
+   * Called by IResource::LoadDependencies; feeds GetDependencyTree and GetDependents.
+   * Thread-safe.
+   * 
+   * @param id Resource ID
+   * @param dependencies Direct dependency IDs
+   */
+  virtual void SetDependencies(ResourceId id, std::vector<ResourceId> const& dependencies) = 0;
+
+  /**
+   * Get resources that directly depend on a resource (reverse of SetDependencies).
+   * Thread-safe.
+   * 
+   * @param id Resource ID
+   * @param out_dependents Output vector to receive dependent IDs
+   */
+  virtual void GetDependents(ResourceId id, std::vector<ResourceId>& out_dependents) const = 0;
+
   /**
    * Request streaming load.
    * 
@@ -382,6 +410,11 @@ class IResourceManager {
    */
   virtual void SetAssetRoot(char const* path) = 0;
 
+  /**
+   * Get asset root directory set by SetAssetRoot (empty if unset).
+   */
+  virtual char const* GetAssetRoot() const = 0;
+
   /**
    * Load repository config and all repo manifests. Call after SetAssetRoot.
    */
@@ -429,6 +462,12 @@ class IResourceManager {
    */
   virtual void GetResourceInfos(std::vector<ResourceInfo>& out) const = 0;
 
+  /**
+   * Enumerate cached (loaded) resources; assetPath is the path the resource was loaded from.
+   * Thread-safe.
+   */
+  virtual void GetLoadedResourceInfos(std::vector<ResourceInfo>& out) const = 0;
+
   /**
    * Get all asset folder paths (empty folders) from all manifests.
    */
@@ -7,12 +7,14 @@
  * - Querying resources by tags
  * - Tag hierarchies and categories
  * - Tag-based filtering and search
+ * - Bulk load/unload/priority changes over query results
  */
 #ifndef TE_RESOURCE_RESOURCE_TAG_H
 #define TE_RESOURCE_RESOURCE_TAG_H
 
 #include <te/resource/ResourceId.h>
 #include <te/resource/ResourceTypes.h>
+#include <te/resource/ResourceGroup.h>
 #include <string>
 #include <vector>
 #include <unordered_set>
@@ -61,6 +63,17 @@ struct TagInfo {
               resourceCount(0), isSystemTag(false) {}
 };
 
+/**
+ * Boolean tag query: (all of required) AND (any of any, if non-empty) AND NOT (any of excluded).
+ * A tag matches resources carrying it or any of its descendant tags.
+ * With no required and no any tags the query starts from every tagged resource.
+ */
+struct ResourceTagQuery {
+  std::vector<TagId> required;
+  std::vector<TagId> any;
+  std::vector<TagId> excluded;
+};
+
 /**
  * Resource tag manager interface.
  * Manages tags and their associations with resources.
@@ -292,6 +305,35 @@ class IResourceTagManager {
                               ResourceFilterFunc filter,
                               std::vector<ResourceId>& outResources) const = 0;
   
+  /**
+   * Evaluate a query as bitset intersections over the tag index.
+   * @param query Tag query
+   * @param outResources Output vector of resource IDs
+   */
+  virtual void Query(ResourceTagQuery const& query,
+                     std::vector<ResourceId>& outResources) const = 0;
+  
+  /**
+   * Count the resources matching a query without listing them.
+   */
+  virtual std::size_t CountQuery(ResourceTagQuery const& query) const = 0;
+  
+  //==========================================================================
+  // Type Tags
+  //==========================================================================
+  
+  /**
+   * Get the system tag for a resource type (category "Type", named like ResourceTypeToString).
+   * @return Tag ID, or InvalidTagId for ResourceType::_Count
+   */
+  virtual TagId GetTypeTag(ResourceType type) const = 0;
+  
+  /**
+   * Tag every manifest resource known to the manager with its type tag.
+   * @return Number of resources newly tagged
+   */
+  virtual std::size_t TagResourcesByType(IResourceManager* manager) = 0;
+  
   //==========================================================================
   // Batch Operations
   //==========================================================================
@@ -314,6 +356,41 @@ class IResourceTagManager {
   virtual std::size_t RemoveTagFromResources(std::vector<ResourceId> const& resourceIds,
                                               TagId tagId) = 0;
   
+  /**
+   * Add every resource matching a query to a group.
+   * Load and unload through the group to share residency with other groups.
+   * @return Number of resources added
+   */
+  virtual std::size_t AddQueryToGroup(ResourceTagQuery const& query,
+                                      ResourceGroup& group) const = 0;
+  
+  /**
+   * Load the resources matching a query as the named group of IResourceGroupManager.
+   * The group is created if needed; matches are added to its members.
+   * @return true if the group load started
+   */
+  virtual bool LoadTagged(std::string const& groupName,
+                          ResourceTagQuery const& query,
+                          LoadPriority priority,
+                          GroupLoadCompleteCallback callback,
+                          void* user_data) = 0;
+  
+  /**
+   * Unload and destroy a group created by LoadTagged.
+   * Resources also held by other groups stay loaded.
+   * @return Number of resources unloaded
+   */
+  virtual std::size_t UnloadTagged(std::string const& groupName) = 0;
+  
+  /**
+   * Set the streaming priority of every resource matching a query
+   * (IResourceManager::RequestStreaming on first use, SetStreamingPriority after).
+   * @return Number of resources updated
+   */
+  virtual std::size_t SetTaggedPriority(IResourceManager* manager,
+                                        ResourceTagQuery const& query,
+                                        int priority) = 0;
+  
   //==========================================================================
   // Serialization
   //==========================================================================
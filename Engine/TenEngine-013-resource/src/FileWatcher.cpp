@@ -0,0 +1,976 @@
+/**
+ * @file FileWatcher.cpp
+ * @brief IFileWatcher implementation (contract: specs/_contracts/013-resource-ABI.md).
+ *
+ * Linux uses inotify with one watch per directory; recursive roots gain watches for
+ * subdirectories as they appear. Windows uses ReadDirectoryChangesW with one handle per
+ * root directory (subtree watches for recursive roots) completed on an I/O completion
+ * port. Other platforms poll timestamps. All backends feed the same queue, which
+ * coalesces changes per path and releases a path once it has been quiet for the
+ * debounce time.
+ */
+
+#include <te/resource/ResourceHotReload.h>
+#include <te/core/log.h>
+#include <algorithm>
+#include <atomic>
+#include <condition_variable>
+#include <cstdint>
+#include <cstring>
+#include <filesystem>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <unordered_map>
+#include <vector>
+
+#if defined(__linux__)
+#include <cerrno>
+#include <poll.h>
+#include <sys/eventfd.h>
+#include <sys/inotify.h>
+#include <unistd.h>
+#elif defined(_WIN32)
+#ifndef WIN32_LEAN_AND_MEAN
+#define WIN32_LEAN_AND_MEAN
+#endif
+#ifndef NOMINMAX
+#define NOMINMAX
+#endif
+#include <windows.h>
+#endif
+
+namespace te {
+namespace resource {
+
+namespace {
+
+namespace fs = std::filesystem;
+using SteadyClock = std::chrono::steady_clock;
+
+// A path that keeps changing is still dispatched after this many debounce periods
+constexpr int kMaxDebounceFactor = 8;
+
+#if defined(__linux__)
+constexpr uint32_t kWatchMask = IN_CREATE | IN_MODIFY | IN_CLOSE_WRITE | IN_ATTRIB | IN_DELETE |
+                                IN_MOVED_FROM | IN_MOVED_TO | IN_ONLYDIR;
+// IN_MOVED_FROM without a matching IN_MOVED_TO after this long is a move out of the tree
+constexpr std::chrono::milliseconds kMovePairWindow{50};
+#elif defined(_WIN32)
+constexpr DWORD kNotifyFilter = FILE_NOTIFY_CHANGE_FILE_NAME | FILE_NOTIFY_CHANGE_DIR_NAME |
+                                FILE_NOTIFY_CHANGE_SIZE | FILE_NOTIFY_CHANGE_LAST_WRITE;
+#else
+constexpr std::chrono::milliseconds kPollInterval{250};
+#endif
+
+std::string NormalizePath(std::string const& path) {
+    std::error_code ec;
+    fs::path abs = fs::absolute(fs::path(path), ec);
+    if (ec) {
+        abs = fs::path(path);
+    }
+    std::string out = abs.lexically_normal().generic_string();
+    while (out.size() > 1 && out.back() == '/') {
+        out.pop_back();
+    }
+    return out;
+}
+
+std::string ParentOf(std::string const& path) {
+    std::size_t const slash = path.rfind('/');
+    if (slash == std::string::npos) {
+        return std::string();
+    }
+    return slash == 0 ? std::string("/") : path.substr(0, slash);
+}
+
+bool IsUnder(std::string const& path, std::string const& dir) {
+    if (dir == "/") {
+        return path.size() > 1 && path[0] == '/';
+    }
+    return path.size() > dir.size() && path[dir.size()] == '/' &&
+           path.compare(0, dir.size(), dir) == 0;
+}
+
+std::string JoinPath(std::string const& dir, char const* name) {
+    return dir == "/" ? dir + name : dir + "/" + name;
+}
+
+struct WatchRoot {
+    std::string path;
+    bool recursive = true;
+    bool isFile = false;
+};
+
+struct PendingChange {
+    FileChangeEvent event;
+    SteadyClock::time_point firstSeen;
+    SteadyClock::time_point lastSeen;
+};
+
+struct FileSubscription {
+    FileChangeCallback callback = nullptr;
+    void* userData = nullptr;
+};
+
+}  // namespace
+
+class FileWatcherImpl : public IFileWatcher {
+public:
+    FileWatcherImpl() {
+#if defined(__linux__)
+        inotifyFd_ = inotify_init1(IN_NONBLOCK | IN_CLOEXEC);
+        wakeFd_ = eventfd(0, EFD_NONBLOCK | EFD_CLOEXEC);
+        if (inotifyFd_ < 0 || wakeFd_ < 0) {
+            te::core::Log(te::core::LogLevel::Error, "FileWatcher: inotify unavailable");
+        }
+#elif defined(_WIN32)
+        port_ = CreateIoCompletionPort(INVALID_HANDLE_VALUE, nullptr, 0, 1);
+        if (!port_) {
+            te::core::Log(te::core::LogLevel::Error, "FileWatcher: I/O completion port unavailable");
+        }
+#endif
+    }
+
+    ~FileWatcherImpl() override {
+        Stop();
+#if defined(__linux__)
+        if (inotifyFd_ >= 0) {
+            close(inotifyFd_);
+        }
+        if (wakeFd_ >= 0) {
+            close(wakeFd_);
+        }
+#elif defined(_WIN32)
+        {
+            std::lock_guard<std::mutex> lock(watchMutex_);
+            for (auto& kv : watches_) {
+                RetireWatch(std::move(kv.second));
+            }
+            watches_.clear();
+        }
+        DrainRetiredWatches();
+        if (port_) {
+            CloseHandle(port_);
+        }
+#endif
+        for (FileSubscription* sub : subscriptions_) {
+            delete sub;
+        }
+    }
+
+    bool AddWatchPath(std::string const& path, bool recursive) override {
+        if (path.empty()) {
+            return false;
+        }
+        std::string const root = NormalizePath(path);
+        std::error_code ec;
+        fs::file_status const status = fs::status(root, ec);
+        if (ec || !fs::exists(status)) {
+            return false;
+        }
+        std::lock_guard<std::mutex> lock(watchMutex_);
+        for (WatchRoot const& existing : roots_) {
+            if (existing.path == root && existing.recursive == recursive) {
+                return true;
+            }
+        }
+        WatchRoot watchRoot;
+        watchRoot.path = root;
+        watchRoot.recursive = recursive;
+        watchRoot.isFile = !fs::is_directory(status);
+        roots_.push_back(watchRoot);
+        // Files are watched through their directory so replace-by-rename saves are seen
+        if (watchRoot.isFile) {
+            return AddDirectoryTree(ParentOf(root), false, false);
+        }
+        return AddDirectoryTree(root, recursive, false);
+    }
+
+    void RemoveWatchPath(std::string const& path) override {
+        std::string const root = NormalizePath(path);
+        std::lock_guard<std::mutex> lock(watchMutex_);
+        auto const before = roots_.size();
+        roots_.erase(std::remove_if(roots_.begin(), roots_.end(),
+                                    [&root](WatchRoot const& r) { return r.path == root; }),
+                     roots_.end());
+        if (roots_.size() != before) {
+            PruneDirectoryWatches();
+        }
+    }
+
+    HotReloadSubscriptionHandle SubscribeToFileChanges(FileChangeCallback callback, void* userData) override {
+        if (!callback) {
+            return nullptr;
+        }
+        auto* sub = new FileSubscription{callback, userData};
+        std::lock_guard<std::mutex> lock(subscriptionMutex_);
+        subscriptions_.push_back(sub);
+        return sub;
+    }
+
+    void UnsubscribeFromFileChanges(HotReloadSubscriptionHandle handle) override {
+        std::lock_guard<std::mutex> lock(subscriptionMutex_);
+        auto it = std::find(subscriptions_.begin(), subscriptions_.end(), static_cast<FileSubscription*>(handle));
+        if (it != subscriptions_.end()) {
+            delete *it;
+            subscriptions_.erase(it);
+        }
+    }
+
+    void Start() override {
+        {
+            std::lock_guard<std::mutex> lock(pendingMutex_);
+            if (running_.load()) {
+                return;
+            }
+            running_.store(true);
+        }
+        thread_ = std::thread(&FileWatcherImpl::ThreadMain, this);
+    }
+
+    void Stop() override {
+        {
+            std::lock_guard<std::mutex> lock(pendingMutex_);
+            if (!running_.load()) {
+                return;
+            }
+            running_.store(false);
+        }
+#if defined(__linux__)
+        if (wakeFd_ >= 0) {
+            uint64_t const one = 1;
+            ssize_t const written = write(wakeFd_, &one, sizeof(one));
+            (void)written;
+        }
+#elif defined(_WIN32)
+        if (port_) {
+            PostQueuedCompletionStatus(port_, 0, 0, nullptr);
+        }
+#else
+        {
+            std::lock_guard<std::mutex> lock(watchMutex_);
+            pollCv_.notify_all();
+        }
+#endif
+        if (thread_.joinable()) {
+            thread_.join();
+        }
+        pendingCv_.notify_all();
+    }
+
+    bool IsWatching() const override {
+        return running_.load();
+    }
+
+    void ProcessPendingEvents() override {
+        std::vector<PendingChange> ready;
+        {
+            std::lock_guard<std::mutex> lock(pendingMutex_);
+            SteadyClock::time_point const now = SteadyClock::now();
+            for (auto it = pending_.begin(); it != pending_.end();) {
+                if (ReadyAt(it->second) <= now) {
+                    ready.push_back(std::move(it->second));
+                    it = pending_.erase(it);
+                } else {
+                    ++it;
+                }
+            }
+        }
+        if (ready.empty()) {
+            return;
+        }
+        std::sort(ready.begin(), ready.end(), [](PendingChange const& a, PendingChange const& b) {
+            return a.firstSeen < b.firstSeen;
+        });
+        std::vector<FileSubscription> subs;
+        {
+            std::lock_guard<std::mutex> lock(subscriptionMutex_);
+            for (FileSubscription const* sub : subscriptions_) {
+                subs.push_back(*sub);
+            }
+        }
+        for (PendingChange const& change : ready) {
+            for (FileSubscription const& sub : subs) {
+                sub.callback(change.event, sub.userData);
+            }
+        }
+    }
+
+    std::size_t GetPendingEventCount() const override {
+        std::lock_guard<std::mutex> lock(pendingMutex_);
+        return pending_.size();
+    }
+
+    void SetDebounceTime(std::chrono::milliseconds debounceTime) override {
+        std::lock_guard<std::mutex> lock(pendingMutex_);
+        debounce_ = debounceTime.count() > 0 ? debounceTime : std::chrono::milliseconds(0);
+        pendingCv_.notify_all();
+    }
+
+    bool WaitForEvents(std::chrono::milliseconds timeout) override {
+        SteadyClock::time_point const deadline = SteadyClock::now() + timeout;
+        std::unique_lock<std::mutex> lock(pendingMutex_);
+        for (;;) {
+            SteadyClock::time_point const now = SteadyClock::now();
+            SteadyClock::time_point wake = deadline;
+            for (auto const& kv : pending_) {
+                SteadyClock::time_point const readyAt = ReadyAt(kv.second);
+                if (readyAt <= now) {
+                    return true;
+                }
+                wake = std::min(wake, readyAt);
+            }
+            if (now >= deadline || (pending_.empty() && !running_.load())) {
+                return false;
+            }
+            pendingCv_.wait_until(lock, wake);
+        }
+    }
+
+private:
+    // pendingMutex_ held
+    SteadyClock::time_point ReadyAt(PendingChange const& change) const {
+        return std::min(change.lastSeen + debounce_, change.firstSeen + debounce_ * kMaxDebounceFactor);
+    }
+
+    // watchMutex_ held: whether events for path are reported
+    bool Covers(std::string const& path) const {
+        for (WatchRoot const& root : roots_) {
+            if (root.isFile ? path == root.path
+                            : (root.recursive ? IsUnder(path, root.path) : ParentOf(path) == root.path)) {
+                return true;
+            }
+        }
+        return false;
+    }
+
+    // watchMutex_ held: whether some root needs a watch on directory dir
+    bool NeedsDirectory(std::string const& dir) const {
+        for (WatchRoot const& root : roots_) {
+            if (root.isFile ? ParentOf(root.path) == dir
+                            : (dir == root.path || (root.recursive && IsUnder(dir, root.path)))) {
+                return true;
+            }
+        }
+        return false;
+    }
+
+    void Record(FileChangeType type, std::string const& path, std::string const& oldPath = std::string()) {
+        std::lock_guard<std::mutex> lock(pendingMutex_);
+        if (type == FileChangeType::Renamed) {
+            std::string origin = oldPath;
+            auto oldIt = pending_.find(oldPath);
+            if (oldIt != pending_.end()) {
+                FileChangeType const oldType = oldIt->second.event.changeType;
+                if (oldType == FileChangeType::Renamed) {
+                    origin = oldIt->second.event.oldPath;
+                }
+                pending_.erase(oldIt);
+                if (oldType == FileChangeType::Created) {
+                    // A file written under a temporary name and moved into place
+                    Merge(FileChangeType::Created, path, std::string());
+                    return;
+                }
+            }
+            Merge(FileChangeType::Renamed, path, origin);
+            return;
+        }
+        Merge(type, path, oldPath);
+    }
+
+    // pendingMutex_ held
+    void Merge(FileChangeType type, std::string const& path, std::string const& oldPath) {
+        SteadyClock::time_point const now = SteadyClock::now();
+        auto it = pending_.find(path);
+        if (it == pending_.end()) {
+            PendingChange& change = pending_[path];
+            change.event.path = path;
+            change.event.oldPath = oldPath;
+            change.event.changeType = type;
+            change.event.timestamp = std::chrono::system_clock::now();
+            change.firstSeen = now;
+            change.lastSeen = now;
+            pendingCv_.notify_all();
+            return;
+        }
+        PendingChange& change = it->second;
+        FileChangeType const prev = change.event.changeType;
+        FileChangeType next = type;
+        if (type == FileChangeType::Deleted) {
+            if (prev == FileChangeType::Created) {
+                pending_.erase(it);  // Never seen by subscribers
+                return;
+            }
+            next = FileChangeType::Deleted;
+            change.event.oldPath.clear();
+        } else if (prev == FileChangeType::Created || prev == FileChangeType::Renamed) {
+            next = prev;  // Later writes are part of the creation or move
+        } else {
+            next = FileChangeType::Modified;  // Modified again, or deleted and replaced
+            change.event.oldPath.clear();
+        }
+        change.event.changeType = next;
+        change.event.timestamp = std::chrono::system_clock::now();
+        change.lastSeen = now;
+        pendingCv_.notify_all();
+    }
+
+#if defined(__linux__)
+    // watchMutex_ held
+    bool AddDirectoryWatch(std::string const& dir) {
+        if (inotifyFd_ < 0) {
+            return false;
+        }
+        if (dirToWd_.find(dir) != dirToWd_.end()) {
+            return true;
+        }
+        int const wd = inotify_add_watch(inotifyFd_, dir.c_str(), kWatchMask);
+        if (wd < 0) {
+            te::core::Log(te::core::LogLevel::Warn,
+                          errno == ENOSPC ? "FileWatcher: inotify watch limit reached (fs.inotify.max_user_watches)"
+                                          : "FileWatcher: failed to watch directory");
+            return false;
+        }
+        wdToDir_[wd] = dir;
+        dirToWd_[dir] = wd;
+        return true;
+    }
+
+    // watchMutex_ held; reportContents records existing files as Created (new subtree)
+    bool AddDirectoryTree(std::string const& dir, bool recursive, bool reportContents) {
+        if (!AddDirectoryWatch(dir)) {
+            return false;
+        }
+        std::error_code ec;
+        if (recursive) {
+            for (fs::recursive_directory_iterator it(dir, fs::directory_options::skip_permission_denied, ec), end;
+                 !ec && it != end; it.increment(ec)) {
+                std::string const entry = it->path().generic_string();
+                if (it->is_directory(ec)) {
+                    AddDirectoryWatch(entry);
+                } else if (reportContents && Covers(entry)) {
+                    Record(FileChangeType::Created, entry);
+                }
+            }
+        } else if (reportContents) {
+            for (fs::directory_iterator it(dir, ec), end; !ec && it != end; it.increment(ec)) {
+                std::string const entry = it->path().generic_string();
+                if (!it->is_directory(ec) && Covers(entry)) {
+                    Record(FileChangeType::Created, entry);
+                }
+            }
+        }
+        return true;
+    }
+
+    // watchMutex_ held
+    void RemoveDirectoryWatch(std::unordered_map<std::string, int>::iterator it) {
+        inotify_rm_watch(inotifyFd_, it->second);
+        wdToDir_.erase(it->second);
+        dirToWd_.erase(it);
+    }
+
+    // watchMutex_ held
+    void PruneDirectoryWatches() {
+        for (auto it = dirToWd_.begin(); it != dirToWd_.end();) {
+            auto const current = it++;
+            if (!NeedsDirectory(current->first)) {
+                RemoveDirectoryWatch(current);
+            }
+        }
+    }
+
+    // watchMutex_ held: a directory moved away keeps its watches on the inode, so drop them
+    void RemoveDirectoryWatchesUnder(std::string const& dir) {
+        for (auto it = dirToWd_.begin(); it != dirToWd_.end();) {
+            auto const current = it++;
+            if (current->first == dir || IsUnder(current->first, dir)) {
+                RemoveDirectoryWatch(current);
+            }
+        }
+    }
+
+    struct MovedFrom {
+        std::string path;
+        bool covered = false;
+        SteadyClock::time_point time;
+    };
+
+    void HandleEvent(inotify_event const& ev, std::unordered_map<uint32_t, MovedFrom>& movedFrom) {
+        if (ev.mask & IN_Q_OVERFLOW) {
+            te::core::Log(te::core::LogLevel::Warn, "FileWatcher: inotify queue overflow, changes were lost");
+            return;
+        }
+        std::lock_guard<std::mutex> lock(watchMutex_);
+        auto dirIt = wdToDir_.find(ev.wd);
+        if (dirIt == wdToDir_.end()) {
+            return;
+        }
+        if (ev.mask & IN_IGNORED) {
+            // Watch removed by the kernel (directory deleted or unmounted)
+            dirToWd_.erase(dirIt->second);
+            wdToDir_.erase(dirIt);
+            return;
+        }
+        if (ev.len == 0) {
+            return;  // Event on the watched directory itself
+        }
+        std::string const path = JoinPath(dirIt->second, ev.name);
+        if (ev.mask & IN_ISDIR) {
+            if (ev.mask & IN_MOVED_FROM) {
+                RemoveDirectoryWatchesUnder(path);
+            } else if ((ev.mask & (IN_CREATE | IN_MOVED_TO)) && NeedsDirectory(path)) {
+                // Files may land in the new directory before its watch exists
+                AddDirectoryTree(path, true, true);
+            }
+            return;
+        }
+        bool const covered = Covers(path);
+        if (ev.mask & IN_MOVED_FROM) {
+            movedFrom[ev.cookie] = MovedFrom{path, covered, SteadyClock::now()};
+            return;
+        }
+        if (ev.mask & IN_MOVED_TO) {
+            auto fromIt = movedFrom.find(ev.cookie);
+            if (fromIt != movedFrom.end()) {
+                MovedFrom const from = fromIt->second;
+                movedFrom.erase(fromIt);
+                if (covered && from.covered) {
+                    Record(FileChangeType::Renamed, path, from.path);
+                } else if (covered) {
+                    Record(FileChangeType::Created, path);
+                } else if (from.covered) {
+                    Record(FileChangeType::Deleted, from.path);
+                }
+            } else if (covered) {
+                Record(FileChangeType::Created, path);
+            }
+            return;
+        }
+        if (!covered) {
+            return;
+        }
+        if (ev.mask & IN_CREATE) {
+            Record(FileChangeType::Created, path);
+        } else if (ev.mask & IN_DELETE) {
+            Record(FileChangeType::Deleted, path);
+        } else if (ev.mask & (IN_MODIFY | IN_CLOSE_WRITE | IN_ATTRIB)) {
+            Record(FileChangeType::Modified, path);
+        }
+    }
+
+    void FlushUnpairedMoves(std::unordered_map<uint32_t, MovedFrom>& movedFrom, bool all) {
+        SteadyClock::time_point const now = SteadyClock::now();
+        for (auto it = movedFrom.begin(); it != movedFrom.end();) {
+            if (all || now - it->second.time >= kMovePairWindow) {
+                if (it->second.covered) {
+                    Record(FileChangeType::Deleted, it->second.path);
+                }
+                it = movedFrom.erase(it);
+            } else {
+                ++it;
+            }
+        }
+    }
+
+    void ThreadMain() {
+        if (inotifyFd_ < 0 || wakeFd_ < 0) {
+            return;
+        }
+        alignas(inotify_event) char buffer[64 * 1024];
+        std::unordered_map<uint32_t, MovedFrom> movedFrom;
+        while (running_.load()) {
+            pollfd fds[2] = {{inotifyFd_, POLLIN, 0}, {wakeFd_, POLLIN, 0}};
+            int const timeoutMs = movedFrom.empty() ? -1 : static_cast<int>(kMovePairWindow.count());
+            int const n = poll(fds, 2, timeoutMs);
+            if (n < 0) {
+                if (errno == EINTR) {
+                    continue;
+                }
+                te::core::Log(te::core::LogLevel::Error, "FileWatcher: poll failed");
+                break;
+            }
+            if (fds[1].revents & POLLIN) {
+                uint64_t value = 0;
+                ssize_t const drained = read(wakeFd_, &value, sizeof(value));
+                (void)drained;
+            }
+            if (fds[0].revents & POLLIN) {
+                for (;;) {
+                    ssize_t const len = read(inotifyFd_, buffer, sizeof(buffer));
+                    if (len <= 0) {
+                        break;
+                    }
+                    for (char const* p = buffer; p < buffer + len;) {
+                        auto const* ev = reinterpret_cast<inotify_event const*>(p);
+                        HandleEvent(*ev, movedFrom);
+                        p += sizeof(inotify_event) + ev->len;
+                    }
+                }
+            }
+            FlushUnpairedMoves(movedFrom, false);
+        }
+        FlushUnpairedMoves(movedFrom, true);
+    }
+
+    int inotifyFd_ = -1;
+    int wakeFd_ = -1;
+    std::unordered_map<int, std::string> wdToDir_;
+    std::unordered_map<std::string, int> dirToWd_;
+#elif defined(_WIN32)
+    struct DirectoryWatch {
+        std::string dir;
+        bool subtree = false;
+        HANDLE handle = INVALID_HANDLE_VALUE;
+        OVERLAPPED overlapped{};
+        bool reading = false;     // A ReadDirectoryChangesW call is outstanding
+        std::string renamedFrom;  // RENAMED_OLD_NAME waiting for its RENAMED_NEW_NAME
+        alignas(DWORD) unsigned char buffer[64 * 1024];
+    };
+
+    // watchMutex_ held
+    bool IssueRead(DirectoryWatch& watch) {
+        std::memset(&watch.overlapped, 0, sizeof(watch.overlapped));
+        watch.reading = ReadDirectoryChangesW(watch.handle, watch.buffer, sizeof(watch.buffer),
+                                              watch.subtree ? TRUE : FALSE, kNotifyFilter, nullptr,
+                                              &watch.overlapped, nullptr) != FALSE;
+        if (!watch.reading) {
+            te::core::Log(te::core::LogLevel::Warn, "FileWatcher: ReadDirectoryChangesW failed");
+        }
+        return watch.reading;
+    }
+
+    // watchMutex_ held
+    bool AddDirectoryWatch(std::string const& dir, bool subtree) {
+        if (!port_) {
+            return false;
+        }
+        auto watch = std::make_unique<DirectoryWatch>();
+        watch->dir = dir;
+        watch->subtree = subtree;
+        watch->handle = CreateFileW(fs::path(dir).c_str(), FILE_LIST_DIRECTORY,
+                                    FILE_SHARE_READ | FILE_SHARE_WRITE | FILE_SHARE_DELETE, nullptr, OPEN_EXISTING,
+                                    FILE_FLAG_BACKUP_SEMANTICS | FILE_FLAG_OVERLAPPED, nullptr);
+        if (watch->handle == INVALID_HANDLE_VALUE) {
+            te::core::Log(te::core::LogLevel::Warn, "FileWatcher: failed to watch directory");
+            return false;
+        }
+        if (!CreateIoCompletionPort(watch->handle, port_, reinterpret_cast<ULONG_PTR>(watch.get()), 0) ||
+            !IssueRead(*watch)) {
+            CloseHandle(watch->handle);
+            return false;
+        }
+        watches_[dir] = std::move(watch);
+        return true;
+    }
+
+    // watchMutex_ held: a watch with a read in flight lives until the aborted read completes
+    void RetireWatch(std::unique_ptr<DirectoryWatch> watch) {
+        CancelIoEx(watch->handle, nullptr);
+        CloseHandle(watch->handle);
+        watch->handle = INVALID_HANDLE_VALUE;
+        if (watch->reading) {
+            retired_.push_back(std::move(watch));
+        }
+    }
+
+    // watchMutex_ held: one handle per directory some root needs; a subtree watch also
+    // covers every directory below it
+    bool SyncDirectoryWatches() {
+        std::unordered_map<std::string, bool> wanted;  // Directory -> subtree
+        for (WatchRoot const& root : roots_) {
+            bool& subtree = wanted[root.isFile ? ParentOf(root.path) : root.path];
+            subtree = subtree || (!root.isFile && root.recursive);
+        }
+        for (auto it = wanted.begin(); it != wanted.end();) {
+            bool nested = false;
+            for (auto const& other : wanted) {
+                if (other.second && IsUnder(it->first, other.first)) {
+                    nested = true;
+                    break;
+                }
+            }
+            it = nested ? wanted.erase(it) : std::next(it);
+        }
+        for (auto it = watches_.begin(); it != watches_.end();) {
+            auto const wantedIt = wanted.find(it->first);
+            if (wantedIt == wanted.end() || wantedIt->second != it->second->subtree) {
+                RetireWatch(std::move(it->second));
+                it = watches_.erase(it);
+            } else {
+                ++it;
+            }
+        }
+        bool ok = true;
+        for (auto const& kv : wanted) {
+            if (watches_.find(kv.first) == watches_.end() && !AddDirectoryWatch(kv.first, kv.second)) {
+                ok = false;
+            }
+        }
+        return ok;
+    }
+
+    // watchMutex_ held
+    bool AddDirectoryTree(std::string const& dir, bool recursive, bool reportContents) {
+        (void)dir;
+        (void)recursive;
+        (void)reportContents;
+        return SyncDirectoryWatches();
+    }
+
+    // watchMutex_ held
+    void PruneDirectoryWatches() {
+        SyncDirectoryWatches();
+    }
+
+    // watchMutex_ held: a directory moved into a subtree brings files that are not reported
+    void ReportDirectoryContents(std::string const& dir) {
+        std::error_code ec;
+        for (fs::recursive_directory_iterator it(dir, fs::directory_options::skip_permission_denied, ec), end;
+             !ec && it != end; it.increment(ec)) {
+            std::string const entry = it->path().generic_string();
+            if (!it->is_directory(ec) && Covers(entry)) {
+                Record(FileChangeType::Created, entry);
+            }
+        }
+    }
+
+    // watchMutex_ held
+    void HandleNotification(DirectoryWatch& watch, DWORD action, std::string const& path) {
+        if (action != FILE_ACTION_RENAMED_NEW_NAME && !watch.renamedFrom.empty()) {
+            // Old name without a new one: moved out of the watched directory
+            if (Covers(watch.renamedFrom)) {
+                Record(FileChangeType::Deleted, watch.renamedFrom);
+            }
+            watch.renamedFrom.clear();
+        }
+        std::error_code ec;
+        switch (action) {
+            case FILE_ACTION_RENAMED_OLD_NAME:
+                watch.renamedFrom = path;
+                break;
+            case FILE_ACTION_RENAMED_NEW_NAME: {
+                std::string const from = std::move(watch.renamedFrom);
+                watch.renamedFrom.clear();
+                if (fs::is_directory(path, ec)) {
+                    ReportDirectoryContents(path);
+                    break;
+                }
+                bool const covered = Covers(path);
+                bool const fromCovered = !from.empty() && Covers(from);
+                if (covered && fromCovered) {
+                    Record(FileChangeType::Renamed, path, from);
+                } else if (covered) {
+                    Record(FileChangeType::Created, path);
+                } else if (fromCovered) {
+                    Record(FileChangeType::Deleted, from);
+                }
+                break;
+            }
+            case FILE_ACTION_ADDED:
+                if (fs::is_directory(path, ec)) {
+                    ReportDirectoryContents(path);
+                } else if (Covers(path)) {
+                    Record(FileChangeType::Created, path);
+                }
+                break;
+            case FILE_ACTION_REMOVED:
+                // The entry is gone, so a removed directory is reported like a file
+                if (Covers(path)) {
+                    Record(FileChangeType::Deleted, path);
+                }
+                break;
+            case FILE_ACTION_MODIFIED:
+                // Directories report MODIFIED whenever their entries change
+                if (!fs::is_directory(path, ec) && Covers(path)) {
+                    Record(FileChangeType::Modified, path);
+                }
+                break;
+            default:
+                break;
+        }
+    }
+
+    // watchMutex_ held
+    void CompleteRead(DirectoryWatch* watch, bool ok, DWORD bytes) {
+        watch->reading = false;
+        auto retiredIt = std::find_if(retired_.begin(), retired_.end(),
+                                      [watch](std::unique_ptr<DirectoryWatch> const& w) { return w.get() == watch; });
+        if (retiredIt != retired_.end()) {
+            retired_.erase(retiredIt);
+            return;
+        }
+        if (!ok) {
+            // Directory deleted or no longer reachable; drop the handle
+            te::core::Log(te::core::LogLevel::Warn, "FileWatcher: directory watch stopped");
+            auto it = watches_.find(watch->dir);
+            if (it != watches_.end() && it->second.get() == watch) {
+                RetireWatch(std::move(it->second));
+                watches_.erase(it);
+            }
+            return;
+        }
+        if (bytes == 0) {
+            te::core::Log(te::core::LogLevel::Warn, "FileWatcher: change buffer overflow, changes were lost");
+        }
+        for (DWORD offset = 0; offset < bytes;) {
+            auto const* info = reinterpret_cast<FILE_NOTIFY_INFORMATION const*>(watch->buffer + offset);
+            std::wstring const name(info->FileName, info->FileNameLength / sizeof(WCHAR));
+            HandleNotification(*watch, info->Action, JoinPath(watch->dir, fs::path(name).generic_string().c_str()));
+            if (info->NextEntryOffset == 0) {
+                break;
+            }
+            offset += info->NextEntryOffset;
+        }
+        IssueRead(*watch);
+    }
+
+    // After Stop: wait for the aborted reads so their buffers can be freed
+    void DrainRetiredWatches() {
+        while (port_ && !retired_.empty()) {
+            DWORD bytes = 0;
+            ULONG_PTR key = 0;
+            OVERLAPPED* overlapped = nullptr;
+            BOOL const ok = GetQueuedCompletionStatus(port_, &bytes, &key, &overlapped, 1000);
+            if (!overlapped) {
+                if (!ok) {
+                    break;  // Timed out; leak rather than free a buffer the kernel may still write
+                }
+                continue;
+            }
+            std::lock_guard<std::mutex> lock(watchMutex_);
+            CompleteRead(reinterpret_cast<DirectoryWatch*>(key), ok != FALSE, bytes);
+        }
+        for (auto& watch : retired_) {
+            (void)watch.release();
+        }
+        retired_.clear();
+    }
+
+    void ThreadMain() {
+        if (!port_) {
+            return;
+        }
+        while (running_.load()) {
+            DWORD bytes = 0;
+            ULONG_PTR key = 0;
+            OVERLAPPED* overlapped = nullptr;
+            BOOL const ok = GetQueuedCompletionStatus(port_, &bytes, &key, &overlapped, INFINITE);
+            if (!overlapped) {
+                if (!ok) {
+                    te::core::Log(te::core::LogLevel::Error, "FileWatcher: GetQueuedCompletionStatus failed");
+                    break;
+                }
+                continue;  // Wake-up posted by Stop
+            }
+            std::lock_guard<std::mutex> lock(watchMutex_);
+            CompleteRead(reinterpret_cast<DirectoryWatch*>(key), ok != FALSE, bytes);
+        }
+    }
+
+    HANDLE port_ = nullptr;
+    std::unordered_map<std::string, std::unique_ptr<DirectoryWatch>> watches_;
+    std::vector<std::unique_ptr<DirectoryWatch>> retired_;
+#else
+    // watchMutex_ held: scan files under a root into out
+    void ScanRoot(WatchRoot const& root, std::unordered_map<std::string, fs::file_time_type>& out) const {
+        std::error_code ec;
+        if (root.isFile) {
+            fs::file_time_type const mtime = fs::last_write_time(root.path, ec);
+            if (!ec) {
+                out[root.path] = mtime;
+            }
+            return;
+        }
+        auto visit = [&out](fs::directory_entry const& entry) {
+            std::error_code entryEc;
+            if (!entry.is_directory(entryEc)) {
+                fs::file_time_type const mtime = entry.last_write_time(entryEc);
+                if (!entryEc) {
+                    out[NormalizePath(entry.path().string())] = mtime;
+                }
+            }
+        };
+        if (root.recursive) {
+            for (fs::recursive_directory_iterator it(root.path, fs::directory_options::skip_permission_denied, ec), end;
+                 !ec && it != end; it.increment(ec)) {
+                visit(*it);
+            }
+        } else {
+            for (fs::directory_iterator it(root.path, ec), end; !ec && it != end; it.increment(ec)) {
+                visit(*it);
+            }
+        }
+    }
+
+    // watchMutex_ held
+    bool AddDirectoryTree(std::string const& dir, bool recursive, bool reportContents) {
+        (void)dir;
+        (void)recursive;
+        (void)reportContents;
+        ScanRoot(roots_.back(), snapshot_);
+        return true;
+    }
+
+    // watchMutex_ held
+    void PruneDirectoryWatches() {
+        for (auto it = snapshot_.begin(); it != snapshot_.end();) {
+            it = Covers(it->first) ? std::next(it) : snapshot_.erase(it);
+        }
+    }
+
+    void ThreadMain() {
+        std::unique_lock<std::mutex> lock(watchMutex_);
+        while (running_.load()) {
+            pollCv_.wait_for(lock, kPollInterval, [this] { return !running_.load(); });
+            if (!running_.load()) {
+                break;
+            }
+            std::unordered_map<std::string, fs::file_time_type> current;
+            for (WatchRoot const& root : roots_) {
+                ScanRoot(root, current);
+            }
+            for (auto const& kv : current) {
+                auto it = snapshot_.find(kv.first);
+                if (it == snapshot_.end()) {
+                    Record(FileChangeType::Created, kv.first);
+                } else if (it->second != kv.second) {
+                    Record(FileChangeType::Modified, kv.first);
+                }
+            }
+            for (auto const& kv : snapshot_) {
+                if (current.find(kv.first) == current.end()) {
+                    Record(FileChangeType::Deleted, kv.first);
+                }
+            }
+            snapshot_.swap(current);
+        }
+    }
+
+    std::condition_variable pollCv_;
+    std::unordered_map<std::string, fs::file_time_type> snapshot_;
+#endif
+
+    mutable std::mutex watchMutex_;  // roots_ and backend watch state
+    std::vector<WatchRoot> roots_;
+
+    mutable std::mutex pendingMutex_;  // Lock order: watchMutex_ before pendingMutex_
+    std::condition_variable pendingCv_;
+    std::unordered_map<std::string, PendingChange> pending_;
+    std::chrono::milliseconds debounce_{500};
+
+    std::mutex subscriptionMutex_;
+    std::vector<FileSubscription*> subscriptions_;
+
+    std::atomic<bool> running_{false};
+    std::thread thread_;
+};
+
+IFileWatcher* CreateFileWatcher() {
+    return new FileWatcherImpl();
+}
+
+}  // namespace resource
+}  // namespace te
@@ -0,0 +1,1120 @@
+/**
+ * @file RemoteResource.cpp
+ * @brief IDownloadManager and file-system provider implementation (contract: specs/_contracts/013-resource-ABI.md).
+ *
+ * Downloads land in a content-addressed local cache: bytes are appended to
+ * partial/<hash>.part (an interrupted download resumes from the partial file's
+ * size), hashed while they stream in, and renamed to objects/<h0h1>/<hash> only
+ * once the hash matches. Resource IDs map to hashes in refs.json, so content that
+ * is unchanged across versions is fetched and stored once. Objects are evicted
+ * least recently used first when the cache exceeds its quota.
+ */
+
+#include <te/resource/RemoteResource.h>
+#include <te/core/platform.h>
+#include <te/core/thread.h>
+#include <algorithm>
+#include <condition_variable>
+#include <cstdint>
+#include <cstring>
+#include <filesystem>
+#include <functional>
+#include <list>
+#include <mutex>
+#include <sstream>
+#include <string>
+#include <thread>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+namespace te {
+namespace resource {
+
+namespace {
+
+namespace fs = std::filesystem;
+using SteadyClock = std::chrono::steady_clock;
+
+constexpr std::size_t kHashChunkSize = 256 * 1024;
+
+// SHA-256 (FIPS 180-4), fed incrementally so resumed downloads hash their prefix once
+class Sha256 {
+public:
+    void Update(void const* data, std::size_t size) {
+        auto const* bytes = static_cast<std::uint8_t const*>(data);
+        length_ += size;
+        while (size > 0) {
+            std::size_t const n = std::min(size, sizeof(buffer_) - used_);
+            std::memcpy(buffer_ + used_, bytes, n);
+            used_ += n;
+            bytes += n;
+            size -= n;
+            if (used_ == sizeof(buffer_)) {
+                Transform(buffer_);
+                used_ = 0;
+            }
+        }
+    }
+
+    std::string HexDigest() {
+        std::uint64_t const bits = length_ * 8;
+        std::uint8_t pad = 0x80;
+        Update(&pad, 1);
+        pad = 0;
+        while (used_ != 56) Update(&pad, 1);
+        std::uint8_t lengthBytes[8];
+        for (int i = 0; i < 8; ++i) lengthBytes[i] = static_cast<std::uint8_t>(bits >> (56 - 8 * i));
+        Update(lengthBytes, 8);
+        static char const kHex[] = "0123456789abcdef";
+        std::string out;
+        out.reserve(64);
+        for (std::uint32_t word : state_) {
+            for (int shift = 28; shift >= 0; shift -= 4) out += kHex[(word >> shift) & 0xf];
+        }
+        return out;
+    }
+
+private:
+    static std::uint32_t Rotr(std::uint32_t x, int n) { return (x >> n) | (x << (32 - n)); }
+
+    void Transform(std::uint8_t const* block) {
+        static constexpr std::uint32_t kK[64] = {
+            0x428a2f98, 0x71374491, 0xb5c0fbcf, 0xe9b5dba5, 0x3956c25b, 0x59f111f1, 0x923f82a4, 0xab1c5ed5,
+            0xd807aa98, 0x12835b01, 0x243185be, 0x550c7dc3, 0x72be5d74, 0x80deb1fe, 0x9bdc06a7, 0xc19bf174,
+            0xe49b69c1, 0xefbe4786, 0x0fc19dc6, 0x240ca1cc, 0x2de92c6f, 0x4a7484aa, 0x5cb0a9dc, 0x76f988da,
+            0x983e5152, 0xa831c66d, 0xb00327c8, 0xbf597fc7, 0xc6e00bf3, 0xd5a79147, 0x06ca6351, 0x14292967,
+            0x27b70a85, 0x2e1b2138, 0x4d2c6dfc, 0x53380d13, 0x650a7354, 0x766a0abb, 0x81c2c92e, 0x92722c85,
+            0xa2bfe8a1, 0xa81a664b, 0xc24b8b70, 0xc76c51a3, 0xd192e819, 0xd6990624, 0xf40e3585, 0x106aa070,
+            0x19a4c116, 0x1e376c08, 0x2748774c, 0x34b0bcb5, 0x391c0cb3, 0x4ed8aa4a, 0x5b9cca4f, 0x682e6ff3,
+            0x748f82ee, 0x78a5636f, 0x84c87814, 0x8cc70208, 0x90befffa, 0xa4506ceb, 0xbef9a3f7, 0xc67178f2};
+        std::uint32_t w[64];
+        for (int i = 0; i < 16; ++i) {
+            w[i] = (std::uint32_t(block[i * 4]) << 24) | (std::uint32_t(block[i * 4 + 1]) << 16) |
+                   (std::uint32_t(block[i * 4 + 2]) << 8) | std::uint32_t(block[i * 4 + 3]);
+        }
+        for (int i = 16; i < 64; ++i) {
+            std::uint32_t const s0 = Rotr(w[i - 15], 7) ^ Rotr(w[i - 15], 18) ^ (w[i - 15] >> 3);
+            std::uint32_t const s1 = Rotr(w[i - 2], 17) ^ Rotr(w[i - 2], 19) ^ (w[i - 2] >> 10);
+            w[i] = w[i - 16] + s0 + w[i - 7] + s1;
+        }
+        std::uint32_t a = state_[0], b = state_[1], c = state_[2], d = state_[3];
+        std::uint32_t e = state_[4], f = state_[5], g = state_[6], h = state_[7];
+        for (int i = 0; i < 64; ++i) {
+            std::uint32_t const t1 = h + (Rotr(e, 6) ^ Rotr(e, 11) ^ Rotr(e, 25)) + ((e & f) ^ (~e & g)) + kK[i] + w[i];
+            std::uint32_t const t2 = (Rotr(a, 2) ^ Rotr(a, 13) ^ Rotr(a, 22)) + ((a & b) ^ (a & c) ^ (b & c));
+            h = g;
+            g = f;
+            f = e;
+            e = d + t1;
+            d = c;
+            c = b;
+            b = a;
+            a = t1 + t2;
+        }
+        state_[0] += a;
+        state_[1] += b;
+        state_[2] += c;
+        state_[3] += d;
+        state_[4] += e;
+        state_[5] += f;
+        state_[6] += g;
+        state_[7] += h;
+    }
+
+    std::uint32_t state_[8] = {0x6a09e667, 0xbb67ae85, 0x3c6ef372, 0xa54ff53a,
+                               0x510e527f, 0x9b05688c, 0x1f83d9ab, 0x5be0cd19};
+    std::uint64_t length_ = 0;
+    std::uint8_t buffer_[64];
+    std::size_t used_ = 0;
+};
+
+/** Feed bytes [0, size) of a file into sha; false on read error. */
+bool HashFilePrefix(std::string const& path, std::size_t size, Sha256& sha) {
+    std::vector<std::uint8_t> chunk(std::min(size, kHashChunkSize));
+    for (std::size_t offset = 0; offset < size;) {
+        std::size_t const want = std::min(size - offset, kHashChunkSize);
+        std::size_t got = 0;
+        if (!te::core::FileReadBinary(path, chunk.data(), &got, offset, want) || got != want) return false;
+        sha.Update(chunk.data(), got);
+        offset += got;
+    }
+    return true;
+}
+
+/** Run fn through the thread pool's callback routing (main thread by default). */
+void PostCallback(std::function<void()> fn) {
+    struct Holder {
+        std::function<void()> fn;
+        static void Run(void* user_data) {
+            std::unique_ptr<Holder> holder(static_cast<Holder*>(user_data));
+            holder->fn();
+        }
+    };
+    te::core::IThreadPool* pool = te::core::GetThreadPool();
+    if (pool) {
+        pool->SubmitTask(Holder::Run, new Holder{std::move(fn)});
+    } else {
+        fn();
+    }
+}
+
+std::string EscapeJsonString(std::string const& s) {
+    std::string out;
+    out.reserve(s.size() + 8);
+    for (char c : s) {
+        if (c == '"') out += "\\\"";
+        else if (c == '\\') out += "\\\\";
+        else if (c == '\n') out += "\\n";
+        else if (c == '\t') out += "\\t";
+        else out += c;
+    }
+    return out;
+}
+
+/** Read the JSON string starting at content[i] == '"'; i ends past the closing quote. */
+std::string ReadJsonString(std::string const& content, std::size_t& i) {
+    std::string out;
+    for (++i; i < content.size() && content[i] != '"'; ++i) {
+        if (content[i] == '\\' && i + 1 < content.size()) {
+            char const c = content[++i];
+            out += c == 'n' ? '\n' : c == 't' ? '\t' : c;
+        } else {
+            out += content[i];
+        }
+    }
+    if (i < content.size()) ++i;
+    return out;
+}
+
+void* ToHandle(std::uint64_t id) { return reinterpret_cast<void*>(static_cast<std::uintptr_t>(id)); }
+std::uint64_t FromHandle(void* handle) { return static_cast<std::uint64_t>(reinterpret_cast<std::uintptr_t>(handle)); }
+
+class FileSystemProvider : public IRemoteResourceProvider {
+public:
+    FileSystemProvider(std::string name, std::string const& rootDir)
+        : name_(std::move(name)), root_(fs::absolute(fs::path(rootDir)).lexically_normal()) {}
+
+    std::string GetName() const override { return name_; }
+    std::string GetBaseUrl() const override { return "file://" + root_.generic_string(); }
+    bool IsAvailable() const override {
+        std::error_code ec;
+        return fs::is_directory(root_, ec);
+    }
+
+    bool GetResourceUrl(std::string const& resourceId, std::string& outUrl) override {
+        std::string path;
+        if (!Resolve(resourceId, path)) return false;
+        outUrl = "file://" + path;
+        return true;
+    }
+
+    bool GetResourceInfo(std::string const& resourceId, std::size_t& outSize, std::string& outHash,
+                         std::string& outVersion) override {
+        std::string path;
+        if (!Resolve(resourceId, path)) return false;
+        std::error_code ec;
+        std::size_t const size = static_cast<std::size_t>(fs::file_size(path, ec));
+        fs::file_time_type const time = fs::last_write_time(path, ec);
+        if (ec) return false;
+        {
+            // Hash once per file revision
+            std::lock_guard<std::mutex> lock(mutex_);
+            auto it = hashes_.find(path);
+            if (it != hashes_.end() && it->second.size == size && it->second.time == time) {
+                outSize = size;
+                outHash = outVersion = it->second.hash;
+                return true;
+            }
+        }
+        std::string hash;
+        if (!ComputeFileContentHash(path, hash)) return false;
+        std::lock_guard<std::mutex> lock(mutex_);
+        hashes_[path] = HashEntry{size, time, hash};
+        outSize = size;
+        outHash = outVersion = hash;
+        return true;
+    }
+
+    bool ResourceExists(std::string const& resourceId) override {
+        std::string path;
+        return Resolve(resourceId, path);
+    }
+
+    void GetAvailableResources(std::vector<std::string>& outResources) override {
+        outResources.clear();
+        std::error_code ec;
+        for (fs::recursive_directory_iterator it(root_, ec), end; !ec && it != end; it.increment(ec)) {
+            if (it->is_regular_file(ec)) outResources.push_back(it->path().lexically_relative(root_).generic_string());
+        }
+    }
+
+    bool ReadRange(std::string const& resourceId, std::size_t offset, std::size_t maxBytes,
+                   std::vector<std::uint8_t>& outData) override {
+        outData.clear();
+        std::string path;
+        if (!Resolve(resourceId, path)) return false;
+        std::size_t const size = te::core::FileGetSize(path);
+        if (offset >= size) return true;
+        outData.resize(std::min(maxBytes, size - offset));
+        std::size_t got = 0;
+        bool const ok = te::core::FileReadBinary(path, outData.data(), &got, offset, outData.size());
+        outData.resize(got);
+        return ok;
+    }
+
+private:
+    /** Map an ID to a regular file under the root; IDs may not escape it. */
+    bool Resolve(std::string const& resourceId, std::string& outPath) const {
+        if (resourceId.empty()) return false;
+        fs::path const p = (root_ / fs::path(resourceId)).lexically_normal();
+        fs::path const rel = p.lexically_relative(root_);
+        if (rel.empty() || *rel.begin() == "..") return false;
+        std::error_code ec;
+        if (!fs::is_regular_file(p, ec)) return false;
+        outPath = p.generic_string();
+        return true;
+    }
+
+    struct HashEntry {
+        std::size_t size;
+        fs::file_time_type time;
+        std::string hash;
+    };
+
+    std::string name_;
+    fs::path root_;
+    std::mutex mutex_;
+    std::unordered_map<std::string, HashEntry> hashes_;
+};
+
+struct DownloadTask {
+    std::uint64_t id = 0;
+    std::uint64_t batchId = 0;
+    std::string resourceId;
+    std::string localPath;
+    LoadPriority priority = LoadPriority::Normal;
+    DownloadCompleteCallback onComplete = nullptr;
+    DownloadProgressCallback onProgress = nullptr;
+    void* userData = nullptr;
+    IRemoteResourceProvider* provider = nullptr;
+    std::string hash;  // Expected content hash; empty if the provider has none
+    std::string key;   // In-flight / partial file key
+    DownloadProgress progress;
+    SteadyClock::time_point started;
+    std::size_t startBytes = 0;
+    bool running = false;  // Owned by a fetch worker
+    bool cancelRequested = false;
+    bool pauseRequested = false;
+    std::shared_ptr<DownloadTask> leader;  // Set while sharing another task's fetch
+    std::vector<std::shared_ptr<DownloadTask>> followers;
+};
+
+struct BatchDownload {
+    std::vector<std::uint64_t> members;
+    std::size_t remaining = 0;
+    DownloadResult result = DownloadResult::Success;
+    std::string localDir;
+    DownloadCompleteCallback onComplete = nullptr;
+    void* userData = nullptr;
+};
+
+struct CacheObject {
+    std::size_t size = 0;
+    fs::file_time_type stamp;  // Last-write time when last verified or touched
+    bool verified = false;
+    std::list<std::string>::iterator lru;
+};
+
+}  // namespace
+
+std::string ComputeContentHash(void const* data, std::size_t size) {
+    Sha256 sha;
+    sha.Update(data, size);
+    return sha.HexDigest();
+}
+
+bool ComputeFileContentHash(std::string const& path, std::string& outHash) {
+    if (!te::core::FileExists(path)) return false;
+    Sha256 sha;
+    if (!HashFilePrefix(path, te::core::FileGetSize(path), sha)) return false;
+    outHash = sha.HexDigest();
+    return true;
+}
+
+std::unique_ptr<IRemoteResourceProvider> CreateFileSystemProvider(std::string const& name,
+                                                                  std::string const& rootDir) {
+    return std::unique_ptr<IRemoteResourceProvider>(new FileSystemProvider(name, rootDir));
+}
+
+class DownloadManagerImpl : public IDownloadManager {
+public:
+    ~DownloadManagerImpl() override {
+        {
+            std::lock_guard<std::mutex> lock(mutex_);
+            stopping_ = true;
+        }
+        cv_.notify_all();
+        for (std::thread& worker : workers_) worker.join();
+    }
+
+    // === Providers ===
+
+    void RegisterProvider(std::unique_ptr<IRemoteResourceProvider> provider) override {
+        if (!provider) return;
+        std::lock_guard<std::mutex> lock(providers_mutex_);
+        providers_.push_back(std::move(provider));
+    }
+
+    IRemoteResourceProvider* GetProvider(std::string const& name) override {
+        std::lock_guard<std::mutex> lock(providers_mutex_);
+        for (auto const& provider : providers_) {
+            if (provider->GetName() == name) return provider.get();
+        }
+        return nullptr;
+    }
+
+    // === Local cache ===
+
+    bool SetCacheConfig(RemoteCacheConfig const& config) override {
+        if (config.cacheRoot.empty() || config.maxConcurrentDownloads == 0 || config.chunkSize == 0) return false;
+        fs::path const root(config.cacheRoot);
+        std::error_code ec;
+        fs::create_directories(root / "objects", ec);
+        fs::create_directories(root / "partial", ec);
+        if (ec) return false;
+
+        // Existing objects, oldest first
+        std::vector<std::pair<fs::file_time_type, std::string>> found;
+        std::unordered_map<std::string, std::size_t> sizes;
+        for (fs::recursive_directory_iterator it(root / "objects", ec), end; !ec && it != end; it.increment(ec)) {
+            if (!it->is_regular_file(ec)) continue;
+            std::string const hash = it->path().filename().string();
+            found.emplace_back(it->last_write_time(ec), hash);
+            sizes[hash] = static_cast<std::size_t>(it->file_size(ec));
+        }
+        std::sort(found.begin(), found.end());
+
+        std::lock_guard<std::mutex> lock(mutex_);
+        config_ = config;
+        objects_.clear();
+        lru_.clear();
+        usage_ = 0;
+        for (auto const& entry : found) {
+            CacheObject& object = objects_[entry.second];
+            object.size = sizes[entry.second];
+            object.stamp = entry.first;
+            object.lru = lru_.insert(lru_.end(), entry.second);
+            usage_ += object.size;
+        }
+        LoadRefsLocked();
+        TrimLocked(std::string());
+        while (workers_.size() < config_.maxConcurrentDownloads) {
+            workers_.emplace_back(&DownloadManagerImpl::WorkerMain, this);
+        }
+        cv_.notify_all();
+        return true;
+    }
+
+    RemoteCacheConfig GetCacheConfig() const override {
+        std::lock_guard<std::mutex> lock(mutex_);
+        return config_;
+    }
+
+    std::size_t GetCacheUsage() const override {
+        std::lock_guard<std::mutex> lock(mutex_);
+        return usage_;
+    }
+
+    std::size_t TrimCache() override {
+        std::lock_guard<std::mutex> lock(mutex_);
+        return TrimLocked(std::string());
+    }
+
+    // === Downloads ===
+
+    void* QueueDownload(std::string const& resourceId, std::string const& localPath, LoadPriority priority,
+                        DownloadCompleteCallback onComplete, DownloadProgressCallback onProgress,
+                        void* userData) override {
+        auto task = MakeTask(resourceId, localPath, priority, onComplete, onProgress, userData);
+        if (!task) return nullptr;
+        std::vector<std::shared_ptr<DownloadTask>> done;
+        {
+            std::lock_guard<std::mutex> lock(mutex_);
+            task->id = next_id_++;
+            ScheduleLocked(task, done);
+        }
+        Complete(done, DownloadResult::AlreadyExists);
+        return ToHandle(task->id);
+    }
+
+    void CancelDownload(void* downloadHandle) override {
+        std::vector<std::shared_ptr<DownloadTask>> cancelled;
+        {
+            std::lock_guard<std::mutex> lock(mutex_);
+            for (auto const& task : Resolve(FromHandle(downloadHandle))) {
+                if (task->running) {
+                    task->cancelRequested = true;  // The worker completes it
+                } else {
+                    DetachLocked(task);
+                    cancelled.push_back(task);
+                }
+            }
+        }
+        Complete(cancelled, DownloadResult::Cancelled);
+    }
+
+    void PauseDownload(void* downloadHandle) override {
+        std::lock_guard<std::mutex> lock(mutex_);
+        for (auto const& task : Resolve(FromHandle(downloadHandle))) {
+            if (task->running) {
+                task->pauseRequested = true;
+            } else if (task->progress.state == DownloadState::Queued) {
+                DetachLocked(task);
+                task->progress.state = DownloadState::Paused;
+            }
+        }
+    }
+
+    void ResumeDownload(void* downloadHandle) override {
+        std::vector<std::shared_ptr<DownloadTask>> done;
+        {
+            std::lock_guard<std::mutex> lock(mutex_);
+            for (auto const& task : Resolve(FromHandle(downloadHandle))) {
+                task->pauseRequested = false;
+                if (task->progress.state == DownloadState::Paused) ScheduleLocked(task, done);
+            }
+        }
+        Complete(done, DownloadResult::AlreadyExists);
+    }
+
+    bool GetDownloadProgress(void* downloadHandle, DownloadProgress& outProgress) override {
+        std::lock_guard<std::mutex> lock(mutex_);
+        std::uint64_t const id = FromHandle(downloadHandle);
+        auto it = tasks_.find(id);
+        if (it != tasks_.end()) {
+            outProgress = it->second->progress;
+            return true;
+        }
+        auto batch = batches_.find(id);
+        if (batch == batches_.end()) return false;
+        // Sum of the members still in flight plus those already finished
+        outProgress = DownloadProgress();
+        outProgress.resourceId = batch->second.localDir;
+        outProgress.state = DownloadState::Downloading;
+        std::size_t finished = 0;
+        for (std::uint64_t member : batch->second.members) {
+            auto m = tasks_.find(member);
+            if (m == tasks_.end()) {
+                ++finished;
+                continue;
+            }
+            outProgress.totalBytes += m->second->progress.totalBytes;
+            outProgress.downloadedBytes += m->second->progress.downloadedBytes;
+            outProgress.bytesPerSecond += m->second->progress.bytesPerSecond;
+        }
+        std::size_t const count = batch->second.members.size();
+        outProgress.progress = count ? static_cast<float>(finished) / static_cast<float>(count) : 1.0f;
+        return true;
+    }
+
+    void GetActiveDownloads(std::vector<DownloadProgress>& outDownloads) override {
+        outDownloads.clear();
+        std::lock_guard<std::mutex> lock(mutex_);
+        for (auto const& kv : tasks_) outDownloads.push_back(kv.second->progress);
+    }
+
+    void* QueueBatchDownload(std::vector<std::string> const& resourceIds, std::string const& localDir,
+                             LoadPriority priority, DownloadCompleteCallback onComplete,
+                             DownloadProgressCallback onProgress, void* userData) override {
+        std::vector<std::shared_ptr<DownloadTask>> tasks;
+        std::size_t missing = 0;
+        for (std::string const& resourceId : resourceIds) {
+            std::string localPath;
+            if (!localDir.empty()) localPath = (fs::path(localDir) / fs::path(resourceId).filename()).string();
+            auto task = MakeTask(resourceId, localPath, priority, nullptr, onProgress, userData);
+            if (task) tasks.push_back(std::move(task));
+            else ++missing;
+        }
+        std::uint64_t batchId;
+        std::vector<std::shared_ptr<DownloadTask>> done;
+        bool finishedEmpty = false;
+        {
+            std::lock_guard<std::mutex> lock(mutex_);
+            batchId = next_id_++;
+            BatchDownload& batch = batches_[batchId];
+            batch.remaining = tasks.size();
+            batch.result = missing ? DownloadResult::Failed : DownloadResult::Success;
+            batch.localDir = localDir;
+            batch.onComplete = onComplete;
+            batch.userData = userData;
+            for (auto const& task : tasks) {
+                task->id = next_id_++;
+                task->batchId = batchId;
+                batch.members.push_back(task->id);
+            }
+            for (auto const& task : tasks) ScheduleLocked(task, done);
+            if (tasks.empty()) {
+                batches_.erase(batchId);
+                finishedEmpty = true;
+            }
+        }
+        if (finishedEmpty) {
+            DownloadResult const result = missing ? DownloadResult::Failed : DownloadResult::Success;
+            if (onComplete) PostCallback([=] { onComplete(std::string(), result, localDir, userData); });
+        }
+        Complete(done, DownloadResult::AlreadyExists);
+        return ToHandle(batchId);
+    }
+
+    // === Utility ===
+
+    std::size_t GetDownloadSize(std::string const& resourceId) override {
+        IRemoteResourceProvider* provider = FindProvider(resourceId);
+        std::size_t size = 0;
+        std::string hash, version;
+        return provider && provider->GetResourceInfo(resourceId, size, hash, version) ? size : 0;
+    }
+
+    bool IsDownloaded(std::string const& resourceId) override {
+        std::lock_guard<std::mutex> lock(mutex_);
+        auto ref = refs_.find(resourceId);
+        return ref != refs_.end() && objects_.count(ref->second) && te::core::FileExists(ObjectPath(ref->second));
+    }
+
+    bool GetLocalPath(std::string const& resourceId, std::string& outPath) override {
+        std::string hash;
+        std::string path;
+        bool check = false;
+        {
+            std::lock_guard<std::mutex> lock(mutex_);
+            auto ref = refs_.find(resourceId);
+            if (ref == refs_.end()) return false;
+            auto object = objects_.find(ref->second);
+            if (object == objects_.end()) return false;
+            hash = ref->second;
+            path = ObjectPath(hash);
+            std::error_code ec;
+            fs::file_time_type const stamp = fs::last_write_time(path, ec);
+            if (ec) {
+                EvictLocked(hash);
+                SaveRefsLocked();
+                return false;
+            }
+            check = config_.verifyOnRead && (!object->second.verified || stamp != object->second.stamp);
+        }
+        if (check && !VerifyObject(hash)) return false;
+        std::lock_guard<std::mutex> lock(mutex_);
+        auto object = objects_.find(hash);
+        if (object == objects_.end()) return false;
+        TouchLocked(hash, object->second);
+        outPath = path;
+        return true;
+    }
+
+    bool VerifyResource(std::string const& resourceId) override {
+        std::string hash;
+        {
+            std::lock_guard<std::mutex> lock(mutex_);
+            auto ref = refs_.find(resourceId);
+            if (ref == refs_.end()) return false;
+            hash = ref->second;
+        }
+        return VerifyObject(hash);
+    }
+
+    bool DeleteDownloadedResource(std::string const& resourceId) override {
+        std::lock_guard<std::mutex> lock(mutex_);
+        auto ref = refs_.find(resourceId);
+        if (ref == refs_.end()) return false;
+        std::string const hash = ref->second;
+        refs_.erase(ref);
+        bool const shared = std::any_of(refs_.begin(), refs_.end(),
+                                        [&hash](auto const& kv) { return kv.second == hash; });
+        if (!shared) EvictLocked(hash);
+        SaveRefsLocked();
+        return true;
+    }
+
+private:
+    std::string ObjectPath(std::string const& hash) const {
+        return (fs::path(config_.cacheRoot) / "objects" / hash.substr(0, 2) / hash).string();
+    }
+
+    std::string PartialPath(std::string const& key) const {
+        return (fs::path(config_.cacheRoot) / "partial" / (key + ".part")).string();
+    }
+
+    IRemoteResourceProvider* FindProvider(std::string const& resourceId) {
+        std::lock_guard<std::mutex> lock(providers_mutex_);
+        for (auto const& provider : providers_) {
+            if (provider->IsAvailable() && provider->ResourceExists(resourceId)) return provider.get();
+        }
+        return nullptr;
+    }
+
+    std::shared_ptr<DownloadTask> MakeTask(std::string const& resourceId, std::string const& localPath,
+                                           LoadPriority priority, DownloadCompleteCallback onComplete,
+                                           DownloadProgressCallback onProgress, void* userData) {
+        {
+            std::lock_guard<std::mutex> lock(mutex_);
+            if (config_.cacheRoot.empty()) return nullptr;
+        }
+        IRemoteResourceProvider* provider = FindProvider(resourceId);
+        if (!provider) return nullptr;
+        auto task = std::make_shared<DownloadTask>();
+        task->resourceId = resourceId;
+        task->localPath = localPath;
+        task->priority = priority;
+        task->onComplete = onComplete;
+        task->onProgress = onProgress;
+        task->userData = userData;
+        task->provider = provider;
+        std::size_t size = 0;
+        std::string version;
+        provider->GetResourceInfo(resourceId, size, task->hash, version);
+        // Without an expected hash the partial file is keyed by the resource ID
+        task->key = task->hash.empty() ? "id-" + ComputeContentHash(resourceId.data(), resourceId.size()) : task->hash;
+        task->progress.resourceId = resourceId;
+        provider->GetResourceUrl(resourceId, task->progress.url);
+        task->progress.totalBytes = size;
+        return task;
+    }
+
+    /** The task behind a handle, or a batch's members that are still tracked. */
+    std::vector<std::shared_ptr<DownloadTask>> Resolve(std::uint64_t id) {
+        std::vector<std::shared_ptr<DownloadTask>> out;
+        auto it = tasks_.find(id);
+        if (it != tasks_.end()) {
+            out.push_back(it->second);
+            return out;
+        }
+        auto batch = batches_.find(id);
+        if (batch == batches_.end()) return out;
+        for (std::uint64_t member : batch->second.members) {
+            auto m = tasks_.find(member);
+            if (m != tasks_.end()) out.push_back(m->second);
+        }
+        return out;
+    }
+
+    /** Queue a task, or attach it to an in-flight fetch of the same content; cached content goes to done. */
+    void ScheduleLocked(std::shared_ptr<DownloadTask> const& task, std::vector<std::shared_ptr<DownloadTask>>& done) {
+        tasks_[task->id] = task;
+        if (!task->hash.empty()) {
+            auto object = objects_.find(task->hash);
+            if (object != objects_.end() && te::core::FileExists(ObjectPath(task->hash))) {
+                refs_[task->resourceId] = task->hash;
+                SaveRefsLocked();
+                TouchLocked(task->hash, object->second);
+                done.push_back(task);
+                return;
+            }
+        }
+        task->progress.state = DownloadState::Queued;
+        auto inflight = inflight_.find(task->key);
+        if (inflight != inflight_.end()) {
+            std::shared_ptr<DownloadTask> const& leader = inflight->second;
+            task->leader = leader;
+            leader->followers.push_back(task);
+            leader->priority = std::max(leader->priority, task->priority);
+            return;
+        }
+        inflight_[task->key] = task;
+        queue_.push_back(task);
+        cv_.notify_one();
+    }
+
+    /** Take a queued or following task out of scheduling; its followers move to the next task. */
+    void DetachLocked(std::shared_ptr<DownloadTask> const& task) {
+        if (task->leader) {
+            auto& followers = task->leader->followers;
+            followers.erase(std::remove(followers.begin(), followers.end(), task), followers.end());
+            task->leader.reset();
+            return;
+        }
+        queue_.erase(std::remove(queue_.begin(), queue_.end(), task), queue_.end());
+        HandOverLocked(task);
+    }
+
+    /** Pass a task's pending followers to the first of them, which takes over the fetch. */
+    void HandOverLocked(std::shared_ptr<DownloadTask> const& task) {
+        auto inflight = inflight_.find(task->key);
+        if (inflight != inflight_.end() && inflight->second == task) inflight_.erase(inflight);
+        if (task->followers.empty()) return;
+        std::shared_ptr<DownloadTask> next = task->followers.front();
+        next->leader.reset();
+        next->followers.assign(task->followers.begin() + 1, task->followers.end());
+        for (auto const& follower : next->followers) {
+            follower->leader = next;
+            next->priority = std::max(next->priority, follower->priority);
+        }
+        task->followers.clear();
+        inflight_[next->key] = next;
+        queue_.push_back(next);
+        cv_.notify_one();
+    }
+
+    void WorkerMain() {
+        for (;;) {
+            std::shared_ptr<DownloadTask> task;
+            {
+                std::unique_lock<std::mutex> lock(mutex_);
+                cv_.wait(lock, [this] {
+                    return stopping_ || (!queue_.empty() && active_ < config_.maxConcurrentDownloads);
+                });
+                if (stopping_) return;
+                // Highest priority first, first queued within a priority
+                auto best = std::max_element(queue_.begin(), queue_.end(), [](auto const& a, auto const& b) {
+                    return a->priority < b->priority || (a->priority == b->priority && a->id > b->id);
+                });
+                task = *best;
+                queue_.erase(best);
+                ++active_;
+                task->running = true;
+                task->progress.state = DownloadState::Downloading;
+                task->started = SteadyClock::now();
+            }
+            DownloadResult const result = Fetch(task);
+            std::vector<std::shared_ptr<DownloadTask>> finished;
+            {
+                std::lock_guard<std::mutex> lock(mutex_);
+                --active_;
+                task->running = false;
+                if (task->pauseRequested && !task->cancelRequested && result == DownloadResult::Cancelled) {
+                    task->pauseRequested = false;
+                    task->progress.state = DownloadState::Paused;
+                    HandOverLocked(task);
+                } else if (result == DownloadResult::Cancelled) {
+                    HandOverLocked(task);
+                    finished.push_back(task);
+                } else {
+                    auto inflight = inflight_.find(task->key);
+                    if (inflight != inflight_.end() && inflight->second == task) inflight_.erase(inflight);
+                    finished.push_back(task);
+                    for (auto const& follower : task->followers) {
+                        follower->leader.reset();
+                        follower->progress.downloadedBytes = task->progress.downloadedBytes;
+                        finished.push_back(follower);
+                    }
+                    task->followers.clear();
+                }
+            }
+            cv_.notify_all();
+            Complete(finished, result);
+        }
+    }
+
+    /** Fetch into the partial file and publish the object; Cancelled also covers pause. */
+    DownloadResult Fetch(std::shared_ptr<DownloadTask> const& task) {
+        std::string partial;
+        std::size_t chunkSize;
+        {
+            std::lock_guard<std::mutex> lock(mutex_);
+            partial = PartialPath(task->key);
+            chunkSize = config_.chunkSize;
+        }
+        std::size_t const total = task->progress.totalBytes;
+        std::size_t offset = te::core::FileExists(partial) ? te::core::FileGetSize(partial) : 0;
+        std::error_code ec;
+        if (total && offset > total) {
+            fs::remove(partial, ec);
+            offset = 0;
+        }
+        // Resume: the bytes already on disk count towards the hash
+        Sha256 sha;
+        if (offset && !HashFilePrefix(partial, offset, sha)) {
+            fs::remove(partial, ec);
+            sha = Sha256();
+            offset = 0;
+        }
+        {
+            std::lock_guard<std::mutex> lock(mutex_);
+            task->startBytes = offset;
+            task->progress.downloadedBytes = offset;
+        }
+        std::vector<std::uint8_t> data;
+        for (;;) {
+            {
+                std::lock_guard<std::mutex> lock(mutex_);
+                if (task->cancelRequested || task->pauseRequested) return DownloadResult::Cancelled;
+            }
+            if (total && offset >= total) break;
+            std::size_t const want = total ? std::min(chunkSize, total - offset) : chunkSize;
+            if (!task->provider->ReadRange(task->resourceId, offset, want, data)) return DownloadResult::NetworkError;
+            if (data.empty()) break;
+            if (!te::core::FileWriteBinary(partial, data.data(), data.size(), SIZE_MAX)) return DownloadResult::DiskError;
+            sha.Update(data.data(), data.size());
+            offset += data.size();
+            ReportProgress(task, offset);
+        }
+        if (total && offset < total) return DownloadResult::NetworkError;  // Remote ended early; keep the partial
+
+        {
+            std::lock_guard<std::mutex> lock(mutex_);
+            task->progress.state = DownloadState::Verifying;
+        }
+        std::string const hash = sha.HexDigest();
+        if (!task->hash.empty() && hash != task->hash) {
+            fs::remove(partial, ec);
+            return DownloadResult::VerificationFailed;
+        }
+        std::string const object = ObjectPathUnlocked(hash);
+        fs::create_directories(fs::path(object).parent_path(), ec);
+        fs::rename(partial, object, ec);
+        if (ec) {
+            fs::remove(partial, ec);
+            return DownloadResult::DiskError;
+        }
+        std::lock_guard<std::mutex> lock(mutex_);
+        auto found = objects_.find(hash);
+        if (found == objects_.end()) {
+            found = objects_.emplace(hash, CacheObject()).first;
+            found->second.lru = lru_.insert(lru_.end(), hash);
+        } else {
+            usage_ -= found->second.size;
+        }
+        CacheObject& entry = found->second;
+        usage_ += offset;
+        entry.size = offset;
+        entry.verified = true;
+        TouchLocked(hash, entry);
+        refs_[task->resourceId] = hash;
+        for (auto const& follower : task->followers) refs_[follower->resourceId] = hash;
+        TrimLocked(hash);
+        SaveRefsLocked();
+        return DownloadResult::Success;
+    }
+
+    std::string ObjectPathUnlocked(std::string const& hash) {
+        std::lock_guard<std::mutex> lock(mutex_);
+        return ObjectPath(hash);
+    }
+
+    void ReportProgress(std::shared_ptr<DownloadTask> const& task, std::size_t downloaded) {
+        DownloadProgress snapshot;
+        std::vector<std::shared_ptr<DownloadTask>> listeners;
+        {
+            std::lock_guard<std::mutex> lock(mutex_);
+            DownloadProgress& p = task->progress;
+            p.downloadedBytes = downloaded;
+            p.progress = p.totalBytes ? static_cast<float>(downloaded) / static_cast<float>(p.totalBytes) : 0.0f;
+            double const seconds = std::chrono::duration<double>(SteadyClock::now() - task->started).count();
+            p.bytesPerSecond = seconds > 0.0 ? static_cast<std::size_t>((downloaded - task->startBytes) / seconds) : 0;
+            p.estimatedTimeRemaining = std::chrono::seconds(
+                p.bytesPerSecond && p.totalBytes > downloaded ? (p.totalBytes - downloaded) / p.bytesPerSecond : 0);
+            snapshot = p;
+            listeners.push_back(task);
+            for (auto const& follower : task->followers) {
+                follower->progress.downloadedBytes = p.downloadedBytes;
+                follower->progress.progress = p.progress;
+                follower->progress.bytesPerSecond = p.bytesPerSecond;
+                follower->progress.estimatedTimeRemaining = p.estimatedTimeRemaining;
+                listeners.push_back(follower);
+            }
+        }
+        for (auto const& listener : listeners) {
+            if (!listener->onProgress) continue;
+            DownloadProgressCallback const cb = listener->onProgress;
+            void* const ud = listener->userData;
+            DownloadProgress progress = snapshot;
+            progress.resourceId = listener->resourceId;
+            PostCallback([cb, ud, progress] { cb(progress.resourceId, progress, ud); });
+        }
+    }
+
+    /** Materialize local copies, retire the tasks and post their callbacks. */
+    void Complete(std::vector<std::shared_ptr<DownloadTask>> const& tasks, DownloadResult result) {
+        for (auto const& task : tasks) {
+            DownloadResult taskResult = result;
+            std::string path;
+            if (result == DownloadResult::Success || result == DownloadResult::AlreadyExists) {
+                std::lock_guard<std::mutex> lock(mutex_);
+                auto ref = refs_.find(task->resourceId);
+                if (ref != refs_.end()) path = ObjectPath(ref->second);
+            }
+            if (!path.empty() && !task->localPath.empty()) {
+                if (Materialize(path, task->localPath)) path = task->localPath;
+                else taskResult = DownloadResult::DiskError;
+            } else if (path.empty() && (result == DownloadResult::Success || result == DownloadResult::AlreadyExists)) {
+                taskResult = DownloadResult::DiskError;  // Evicted before it could be handed out
+            }
+
+            BatchDownload batchDone;
+            bool batchFinished = false;
+            {
+                std::lock_guard<std::mutex> lock(mutex_);
+                bool const ok = taskResult == DownloadResult::Success || taskResult == DownloadResult::AlreadyExists;
+                task->progress.state = ok ? DownloadState::Completed : DownloadState::Failed;
+                if (ok) task->progress.progress = 1.0f;
+                tasks_.erase(task->id);
+                auto batch = task->batchId ? batches_.find(task->batchId) : batches_.end();
+                if (batch != batches_.end()) {
+                    if (!ok && batch->second.result == DownloadResult::Success) batch->second.result = taskResult;
+                    if (--batch->second.remaining == 0) {
+                        batchDone = std::move(batch->second);
+                        batches_.erase(batch);
+                        batchFinished = true;
+                    }
+                }
+            }
+            if (task->onComplete) {
+                DownloadCompleteCallback const cb = task->onComplete;
+                void* const ud = task->userData;
+                std::string const id = task->resourceId;
+                PostCallback([cb, ud, id, taskResult, path] { cb(id, taskResult, path, ud); });
+            }
+            if (batchFinished && batchDone.onComplete) {
+                DownloadCompleteCallback const cb = batchDone.onComplete;
+                void* const ud = batchDone.userData;
+                DownloadResult const batchResult = batchDone.result;
+                std::string const dir = batchDone.localDir;
+                PostCallback([cb, ud, batchResult, dir] { cb(std::string(), batchResult, dir, ud); });
+            }
+        }
+    }
+
+    static bool Materialize(std::string const& object, std::string const& localPath) {
+        std::error_code ec;
+        fs::path const target(localPath);
+        if (target.has_parent_path()) fs::create_directories(target.parent_path(), ec);
+        fs::remove(target, ec);
+        fs::create_hard_link(object, target, ec);
+        if (!ec) return true;
+        ec.clear();
+        return fs::copy_file(object, target, fs::copy_options::overwrite_existing, ec) && !ec;
+    }
+
+    bool VerifyObject(std::string const& hash) {
+        std::string path;
+        {
+            std::lock_guard<std::mutex> lock(mutex_);
+            if (!objects_.count(hash)) return false;
+            path = ObjectPath(hash);
+        }
+        std::string actual;
+        bool const ok = ComputeFileContentHash(path, actual) && actual == hash;
+        std::lock_guard<std::mutex> lock(mutex_);
+        auto object = objects_.find(hash);
+        if (object == objects_.end()) return false;
+        if (!ok) {
+            EvictLocked(hash);
+            SaveRefsLocked();
+            return false;
+        }
+        object->second.verified = true;
+        std::error_code ec;
+        object->second.stamp = fs::last_write_time(path, ec);
+        return true;
+    }
+
+    /** Mark an object most recently used (in memory and as its last-write time). */
+    void TouchLocked(std::string const& hash, CacheObject& object) {
+        lru_.splice(lru_.end(), lru_, object.lru);
+        std::error_code ec;
+        std::string const path = ObjectPath(hash);
+        fs::last_write_time(path, fs::file_time_type::clock::now(), ec);
+        object.stamp = fs::last_write_time(path, ec);
+    }
+
+    void EvictLocked(std::string const& hash) {
+        auto object = objects_.find(hash);
+        if (object == objects_.end()) return;
+        std::error_code ec;
+        fs::remove(ObjectPath(hash), ec);
+        usage_ -= object->second.size;
+        lru_.erase(object->second.lru);
+        objects_.erase(object);
+        for (auto it = refs_.begin(); it != refs_.end();) {
+            it = it->second == hash ? refs_.erase(it) : std::next(it);
+        }
+    }
+
+    /** Evict least recently used objects (never keep) until usage fits the quota. */
+    std::size_t TrimLocked(std::string const& keep) {
+        std::size_t evicted = 0;
+        for (auto it = lru_.begin(); usage_ > config_.quotaBytes && it != lru_.end();) {
+            std::string const hash = *it++;
+            if (hash == keep) continue;
+            EvictLocked(hash);
+            ++evicted;
+        }
+        if (evicted) SaveRefsLocked();
+        return evicted;
+    }
+
+    void LoadRefsLocked() {
+        refs_.clear();
+        auto data = te::core::FileRead((fs::path(config_.cacheRoot) / "refs.json").string());
+        if (!data) return;
+        std::string const content(data->begin(), data->end());
+        // {"refs":[{"id":"...","hash":"..."},...]}
+        std::size_t i = content.find('[');
+        while (i != std::string::npos && i < content.size()) {
+            std::size_t const idKey = content.find("\"id\"", i);
+            if (idKey == std::string::npos) break;
+            std::size_t pos = content.find('"', content.find(':', idKey));
+            std::string const id = ReadJsonString(content, pos);
+            std::size_t const hashKey = content.find("\"hash\"", pos);
+            if (hashKey == std::string::npos) break;
+            pos = content.find('"', content.find(':', hashKey));
+            std::string const hash = ReadJsonString(content, pos);
+            if (objects_.count(hash)) refs_[id] = hash;
+            i = pos;
+        }
+    }
+
+    /** Write refs.json through a temporary file so a crash never leaves it torn. */
+    void SaveRefsLocked() {
+        std::ostringstream out;
+        out << "{\"refs\":[";
+        bool first = true;
+        for (auto const& kv : refs_) {
+            out << (first ? "" : ",") << "{\"id\":\"" << EscapeJsonString(kv.first) << "\",\"hash\":\"" << kv.second
+                << "\"}";
+            first = false;
+        }
+        out << "]}";
+        fs::path const path = fs::path(config_.cacheRoot) / "refs.json";
+        fs::path const temp = fs::path(config_.cacheRoot) / "refs.json.tmp";
+        if (!te::core::FileWrite(temp.string(), out.str())) return;
+        std::error_code ec;
+        fs::rename(temp, path, ec);
+    }
+
+    mutable std::mutex mutex_;
+    std::condition_variable cv_;
+    RemoteCacheConfig config_;
+    bool stopping_ = false;
+    std::size_t active_ = 0;
+    std::uint64_t next_id_ = 1;
+    std::vector<std::thread> workers_;
+
+    std::unordered_map<std::uint64_t, std::shared_ptr<DownloadTask>> tasks_;
+    std::unordered_map<std::uint64_t, BatchDownload> batches_;
+    std::vector<std::shared_ptr<DownloadTask>> queue_;
+    std::unordered_map<std::string, std::shared_ptr<DownloadTask>> inflight_;  // Key -> fetching task
+
+    std::unordered_map<std::string, std::string> refs_;  // Resource ID -> hash
+    std::unordered_map<std::string, CacheObject> objects_;
+    std::list<std::string> lru_;  // Front is least recently used
+    std::size_t usage_ = 0;
+
+    std::mutex providers_mutex_;
+    std::vector<std::unique_ptr<IRemoteResourceProvider>> providers_;
+};
+
+// Global download manager instance (singleton pattern)
+static DownloadManagerImpl* g_downloadManager = nullptr;
+static std::mutex g_downloadManagerMutex;
+
+IDownloadManager* GetDownloadManager() {
+    std::lock_guard<std::mutex> lock(g_downloadManagerMutex);
+    if (!g_downloadManager) {
+        g_downloadManager = new DownloadManagerImpl();
+    }
+    return g_downloadManager;
+}
+
+}  // namespace resource
+}  // namespace te
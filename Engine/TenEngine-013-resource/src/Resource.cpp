@@ -14,6 +14,7 @@
 #include <te/core/platform.h>
 #include <te/core/alloc.h>
 #include <te/core/thread.h>
+#include <te/core/profiling.h>
 #include <memory>
 #include <string>
 #include <vector>
@@ -85,7 +86,11 @@ bool IResource::LoadAsync(char const* path, IResourceManager* manager,
                 return;
             }
             LoadAsyncContext* ctx = h->ctx.get();
-            bool success = ctx->self->Load(ctx->path.c_str(), ctx->manager);
+            bool success = false;
+            {
+                TE_PROFILE_ZONE("Resource::LoadAsync");
+                success = ctx->self->Load(ctx->path.c_str(), ctx->manager);
+            }
 
             if (ctx->on_done) {
                 te::core::IThreadPool* p = te::core::GetThreadPool();
@@ -0,0 +1,976 @@
+/**
+ * @file ResourceDebug.cpp
+ * @brief Resource profiler, leak detector, visualizer and debug manager (contract: specs/_contracts/013-resource-ABI.md).
+ *
+ * Profiler counters live in per-thread slots: each thread bumps its own cache
+ * line and readers sum over all slots, so the load and cache paths never
+ * contend. Per-resource records sit next to the counters in the same slot
+ * behind a mutex that only the owner thread and occasional readers take.
+ * Resident memory (load/unload rate) and leak tracking use plain locks.
+ */
+
+#include <te/resource/ResourceDebug.h>
+#include <te/resource/ResourceManager.h>
+#include <te/resource/ResourceManifest.h>
+#include <te/resource/Resource.h>
+#include <algorithm>
+#include <atomic>
+#include <cstdint>
+#include <deque>
+#include <filesystem>
+#include <fstream>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <set>
+#include <sstream>
+#include <unordered_map>
+#include <unordered_set>
+#include <vector>
+
+#if defined(_WIN32)
+#include <windows.h>
+#elif __has_include(<execinfo.h>)
+#include <execinfo.h>
+#include <cstdlib>
+#define TE_RESOURCE_HAS_EXECINFO 1
+#endif
+
+namespace te {
+namespace resource {
+
+namespace {
+
+using SteadyClock = std::chrono::steady_clock;
+using SystemClock = std::chrono::system_clock;
+
+enum Counter : std::size_t {
+    kLoadsBegun,
+    kLoadsSucceeded,
+    kLoadsFailed,
+    kCacheHits,
+    kCacheMisses,
+    kLoadNs,
+    kCounterCount
+};
+
+struct InFlightLoad {
+    ResourceId id;
+    std::string path;
+    ResourceType type;
+    SteadyClock::time_point start;
+    SystemClock::time_point wallStart;
+    std::uint64_t dependencyNs = 0;
+    std::size_t dependencyCount = 0;
+};
+
+/** One thread's counters and records; reused by a later thread once its owner exits. */
+struct alignas(64) ProfilerSlot {
+    std::atomic<std::uint64_t> counters[kCounterCount] = {};
+    std::atomic<bool> inUse{true};
+    std::vector<InFlightLoad> inFlight;  // Owner thread only
+    mutable std::mutex recordsMutex;     // Owner writes, readers merge
+    std::unordered_map<ResourceId, ResourceProfileData> records;
+    std::uint64_t maxLoadNs = 0;
+
+    void Bump(Counter c, std::uint64_t n = 1) { counters[c].fetch_add(n, std::memory_order_relaxed); }
+};
+
+struct SlotRegistry {
+    std::mutex mutex;
+    std::deque<std::unique_ptr<ProfilerSlot>> slots;
+};
+
+// Never destroyed: worker threads may return their slot during static destruction
+SlotRegistry& Registry() {
+    static SlotRegistry* registry = new SlotRegistry();
+    return *registry;
+}
+
+struct SlotLease {
+    ProfilerSlot* slot = nullptr;
+    ~SlotLease() {
+        if (slot) {
+            slot->inFlight.clear();
+            slot->inUse.store(false, std::memory_order_release);
+        }
+    }
+};
+
+ProfilerSlot* LocalSlot() {
+    thread_local SlotLease lease;
+    if (!lease.slot) {
+        SlotRegistry& registry = Registry();
+        std::lock_guard<std::mutex> lock(registry.mutex);
+        for (auto& slot : registry.slots) {
+            bool expected = false;
+            if (slot->inUse.compare_exchange_strong(expected, true, std::memory_order_acquire)) {
+                lease.slot = slot.get();
+                break;
+            }
+        }
+        if (!lease.slot) {
+            registry.slots.push_back(std::make_unique<ProfilerSlot>());
+            lease.slot = registry.slots.back().get();
+        }
+    }
+    return lease.slot;
+}
+
+template <typename Fn>
+void ForEachSlot(Fn&& fn) {
+    SlotRegistry& registry = Registry();
+    std::lock_guard<std::mutex> lock(registry.mutex);
+    for (auto& slot : registry.slots) {
+        fn(*slot);
+    }
+}
+
+double ToMs(std::uint64_t ns) {
+    return static_cast<double>(ns) / 1.0e6;
+}
+
+std::size_t FileBytes(std::string const& path) {
+    if (path.empty()) return 0;
+    std::error_code ec;
+    auto size = std::filesystem::file_size(std::filesystem::u8path(path), ec);
+    return ec ? 0 : static_cast<std::size_t>(size);
+}
+
+/** Combine one resource's records from several threads; timings come from the latest load. */
+void MergeRecord(ResourceProfileData& into, ResourceProfileData const& from) {
+    if (from.loadEndTime > into.loadEndTime) {
+        into.path = from.path;
+        into.type = from.type;
+        into.loadTimeMs = from.loadTimeMs;
+        into.fileSize = from.fileSize;
+        into.memorySize = from.memorySize;
+        into.dependencyCount = from.dependencyCount;
+        into.loadStartTime = from.loadStartTime;
+        into.loadEndTime = from.loadEndTime;
+    }
+    into.dependencyLoadTimeMs += from.dependencyLoadTimeMs;
+    into.gpuUploadTimeMs += from.gpuUploadTimeMs;
+    into.loadCount += from.loadCount;
+}
+
+std::string EscapeJson(std::string const& s) {
+    std::string out;
+    out.reserve(s.size() + 8);
+    for (char c : s) {
+        if (c == '"') out += "\\\"";
+        else if (c == '\\') out += "\\\\";
+        else if (c == '\n') out += "\\n";
+        else if (c == '\r') out += "\\r";
+        else if (c == '\t') out += "\\t";
+        else out += c;
+    }
+    return out;
+}
+
+std::string CaptureStackTrace() {
+    std::ostringstream out;
+#if defined(_WIN32)
+    void* frames[32];
+    USHORT const count = CaptureStackBackTrace(2, 32, frames, nullptr);
+    for (USHORT i = 0; i < count; ++i) {
+        out << frames[i] << '\n';
+    }
+#elif defined(TE_RESOURCE_HAS_EXECINFO)
+    void* frames[32];
+    int const count = backtrace(frames, 32);
+    char** symbols = backtrace_symbols(frames, count);
+    for (int i = 2; i < count; ++i) {
+        if (symbols) out << symbols[i] << '\n';
+        else out << frames[i] << '\n';
+    }
+    std::free(symbols);
+#endif
+    return out.str();
+}
+
+// === Profiler ===
+
+class ResourceProfilerImpl : public IResourceProfiler {
+public:
+    void SetEnabled(bool enabled) override { enabled_.store(enabled, std::memory_order_relaxed); }
+    bool IsEnabled() const override { return enabled_.load(std::memory_order_relaxed); }
+
+    void Reset() override {
+        ForEachSlot([](ProfilerSlot& slot) {
+            for (auto& counter : slot.counters) {
+                counter.store(0, std::memory_order_relaxed);
+            }
+            std::lock_guard<std::mutex> lock(slot.recordsMutex);
+            slot.records.clear();
+            slot.maxLoadNs = 0;
+        });
+        std::lock_guard<std::mutex> lock(residentMutex_);
+        peakBytes_ = residentBytes_;
+        statsStart_ = SystemClock::now();
+    }
+
+    void BeginLoad(ResourceId id, std::string const& path, ResourceType type) override {
+        if (!IsEnabled()) return;
+        ProfilerSlot* slot = LocalSlot();
+        slot->Bump(kLoadsBegun);
+        InFlightLoad load;
+        load.id = id;
+        load.path = path;
+        load.type = type;
+        load.start = SteadyClock::now();
+        load.wallStart = SystemClock::now();
+        slot->inFlight.push_back(std::move(load));
+    }
+
+    void EndLoad(ResourceId id, bool success) override {
+        ProfilerSlot* slot = LocalSlot();
+        // Profiling may have been switched on between Begin and End
+        if (slot->inFlight.empty()) return;
+        InFlightLoad load = std::move(slot->inFlight.back());
+        slot->inFlight.pop_back();
+        std::uint64_t const ns = static_cast<std::uint64_t>(
+            std::chrono::duration_cast<std::chrono::nanoseconds>(SteadyClock::now() - load.start).count());
+        if (!slot->inFlight.empty()) {
+            slot->inFlight.back().dependencyNs += ns;
+            ++slot->inFlight.back().dependencyCount;
+        }
+        slot->Bump(success ? kLoadsSucceeded : kLoadsFailed);
+        slot->Bump(kLoadNs, ns);
+        if (!id.IsNull()) load.id = id;
+
+        std::size_t const bytes = success ? FileBytes(load.path) : 0;
+        {
+            std::lock_guard<std::mutex> lock(slot->recordsMutex);
+            slot->maxLoadNs = std::max(slot->maxLoadNs, ns);
+            if (load.id.IsNull()) return;
+            ResourceProfileData& record = slot->records[load.id];
+            record.resourceId = load.id;
+            record.path = load.path;
+            record.type = load.type;
+            record.loadTimeMs = ToMs(ns);
+            record.dependencyLoadTimeMs = ToMs(load.dependencyNs);
+            record.fileSize = bytes;
+            record.memorySize = bytes;
+            record.dependencyCount = load.dependencyCount;
+            ++record.loadCount;
+            record.loadStartTime = load.wallStart;
+            record.loadEndTime = SystemClock::now();
+        }
+        if (success) {
+            std::lock_guard<std::mutex> lock(residentMutex_);
+            auto inserted = resident_.emplace(load.id, bytes);
+            if (!inserted.second) {
+                residentBytes_ -= inserted.first->second;
+                inserted.first->second = bytes;
+            }
+            residentBytes_ += bytes;
+            peakBytes_ = std::max(peakBytes_, residentBytes_);
+        }
+    }
+
+    void RecordDependencyLoadTime(ResourceId id, double timeMs) override {
+        if (!IsEnabled() || id.IsNull()) return;
+        ProfilerSlot* slot = LocalSlot();
+        std::lock_guard<std::mutex> lock(slot->recordsMutex);
+        ResourceProfileData& record = slot->records[id];
+        record.resourceId = id;
+        record.dependencyLoadTimeMs += timeMs;
+    }
+
+    void RecordGpuUploadTime(ResourceId id, double timeMs) override {
+        if (!IsEnabled() || id.IsNull()) return;
+        ProfilerSlot* slot = LocalSlot();
+        std::lock_guard<std::mutex> lock(slot->recordsMutex);
+        ResourceProfileData& record = slot->records[id];
+        record.resourceId = id;
+        record.gpuUploadTimeMs += timeMs;
+    }
+
+    void RecordCacheHit(ResourceId) override {
+        if (IsEnabled()) LocalSlot()->Bump(kCacheHits);
+    }
+
+    void RecordCacheMiss(ResourceId) override {
+        if (IsEnabled()) LocalSlot()->Bump(kCacheMisses);
+    }
+
+    void RecordUnload(ResourceId id) override {
+        // Not gated on IsEnabled so resident memory stays balanced across toggles
+        std::lock_guard<std::mutex> lock(residentMutex_);
+        auto it = resident_.find(id);
+        if (it == resident_.end()) return;
+        residentBytes_ -= it->second;
+        resident_.erase(it);
+    }
+
+    bool GetProfileData(ResourceId id, ResourceProfileData& outData) const override {
+        bool found = false;
+        ForEachSlot([&](ProfilerSlot& slot) {
+            std::lock_guard<std::mutex> lock(slot.recordsMutex);
+            auto it = slot.records.find(id);
+            if (it == slot.records.end()) return;
+            if (!found) {
+                outData = it->second;
+                found = true;
+            } else {
+                MergeRecord(outData, it->second);
+            }
+        });
+        return found;
+    }
+
+    void GetAllProfileData(std::vector<ResourceProfileData>& outData) const override {
+        std::unordered_map<ResourceId, ResourceProfileData> merged;
+        ForEachSlot([&](ProfilerSlot& slot) {
+            std::lock_guard<std::mutex> lock(slot.recordsMutex);
+            for (auto const& kv : slot.records) {
+                auto inserted = merged.emplace(kv.first, kv.second);
+                if (!inserted.second) MergeRecord(inserted.first->second, kv.second);
+            }
+        });
+        outData.clear();
+        outData.reserve(merged.size());
+        for (auto& kv : merged) {
+            // Records created only by RecordGpuUploadTime/RecordDependencyLoadTime have no load
+            if (kv.second.loadCount > 0) outData.push_back(std::move(kv.second));
+        }
+    }
+
+    ResourceSystemStats GetSystemStats() const override {
+        std::uint64_t totals[kCounterCount] = {};
+        std::uint64_t maxNs = 0;
+        ForEachSlot([&](ProfilerSlot& slot) {
+            for (std::size_t i = 0; i < kCounterCount; ++i) {
+                totals[i] += slot.counters[i].load(std::memory_order_relaxed);
+            }
+            std::lock_guard<std::mutex> lock(slot.recordsMutex);
+            maxNs = std::max(maxNs, slot.maxLoadNs);
+        });
+        ResourceSystemStats stats;
+        std::uint64_t const finished = totals[kLoadsSucceeded] + totals[kLoadsFailed];
+        stats.totalLoads = static_cast<std::size_t>(finished);
+        stats.successfulLoads = static_cast<std::size_t>(totals[kLoadsSucceeded]);
+        stats.failedLoads = static_cast<std::size_t>(totals[kLoadsFailed]);
+        stats.cacheHits = static_cast<std::size_t>(totals[kCacheHits]);
+        stats.cacheMisses = static_cast<std::size_t>(totals[kCacheMisses]);
+        stats.activeAsyncLoads = totals[kLoadsBegun] > finished
+            ? static_cast<std::size_t>(totals[kLoadsBegun] - finished) : 0;
+        stats.totalLoadTimeMs = ToMs(totals[kLoadNs]);
+        stats.maxLoadTimeMs = ToMs(maxNs);
+        stats.averageLoadTimeMs = finished ? stats.totalLoadTimeMs / static_cast<double>(finished) : 0.0;
+        std::lock_guard<std::mutex> lock(residentMutex_);
+        stats.totalCachedResources = resident_.size();
+        stats.totalMemoryUsage = residentBytes_;
+        stats.peakMemoryUsage = peakBytes_;
+        stats.statsStartTime = statsStart_;
+        return stats;
+    }
+
+    void GetSlowestLoads(std::size_t count, std::vector<ResourceProfileData>& outData) const override {
+        GetAllProfileData(outData);
+        TopN(outData, count, [](ResourceProfileData const& a, ResourceProfileData const& b) {
+            return a.loadTimeMs > b.loadTimeMs;
+        });
+    }
+
+    void GetLargestResources(std::size_t count, std::vector<ResourceProfileData>& outData) const override {
+        GetAllProfileData(outData);
+        TopN(outData, count, [](ResourceProfileData const& a, ResourceProfileData const& b) {
+            return a.memorySize > b.memorySize;
+        });
+    }
+
+    std::size_t GetResidentMemory(ResourceId id) const override {
+        std::lock_guard<std::mutex> lock(residentMutex_);
+        auto it = resident_.find(id);
+        return it != resident_.end() ? it->second : 0;
+    }
+
+private:
+    template <typename Less>
+    static void TopN(std::vector<ResourceProfileData>& data, std::size_t count, Less less) {
+        count = std::min(count, data.size());
+        std::partial_sort(data.begin(), data.begin() + static_cast<std::ptrdiff_t>(count), data.end(), less);
+        data.resize(count);
+    }
+
+    std::atomic<bool> enabled_{false};
+    mutable std::mutex residentMutex_;
+    std::unordered_map<ResourceId, std::size_t> resident_;
+    std::size_t residentBytes_ = 0;
+    std::size_t peakBytes_ = 0;
+    SystemClock::time_point statsStart_ = SystemClock::now();
+};
+
+// === Leak detector ===
+
+class ResourceLeakDetectorImpl : public IResourceLeakDetector {
+public:
+    void SetEnabled(bool enabled) override {
+        std::lock_guard<std::mutex> lock(mutex_);
+        enabled_.store(enabled, std::memory_order_relaxed);
+        if (!enabled) {
+            // Counts taken while off would be wrong; start over when re-enabled
+            tracked_.clear();
+            baseline_.clear();
+        }
+    }
+
+    bool IsEnabled() const override { return enabled_.load(std::memory_order_relaxed); }
+
+    void SetCaptureStackTrace(bool capture) override { captureStack_.store(capture, std::memory_order_relaxed); }
+
+    void RecordAcquire(ResourceId id, std::string const& path, ResourceType type) override {
+        if (!IsEnabled() || id.IsNull()) return;
+        bool const capture = captureStack_.load(std::memory_order_relaxed);
+        std::lock_guard<std::mutex> lock(mutex_);
+        Tracked& entry = tracked_[id];
+        if (entry.refs++ == 0) {
+            entry.path = path;
+            entry.type = type;
+            entry.loadTime = SystemClock::now();
+            if (capture) entry.stackTrace = CaptureStackTrace();
+        }
+    }
+
+    void RecordRelease(ResourceId id) override {
+        if (!IsEnabled()) return;
+        std::lock_guard<std::mutex> lock(mutex_);
+        auto it = tracked_.find(id);
+        if (it == tracked_.end()) return;
+        if (--it->second.refs == 0) tracked_.erase(it);
+    }
+
+    std::size_t DetectLeaks(IResourceManager* manager, std::vector<ResourceLeakInfo>& outLeaks) override {
+        return Detect(manager, nullptr, outLeaks);
+    }
+
+    std::size_t DetectLeaksByType(IResourceManager* manager, ResourceType type,
+                                  std::vector<ResourceLeakInfo>& outLeaks) override {
+        return Detect(manager, &type, outLeaks);
+    }
+
+    void GetTrackedResources(std::vector<ResourceLeakInfo>& outInfo) const override {
+        outInfo.clear();
+        std::lock_guard<std::mutex> lock(mutex_);
+        outInfo.reserve(tracked_.size());
+        for (auto const& kv : tracked_) {
+            outInfo.push_back(ToInfo(kv.first, kv.second));
+        }
+    }
+
+    void MarkBaseline() override {
+        std::lock_guard<std::mutex> lock(mutex_);
+        baseline_.clear();
+        for (auto const& kv : tracked_) {
+            baseline_[kv.first] = kv.second.refs;
+        }
+    }
+
+    void ClearBaseline() override {
+        std::lock_guard<std::mutex> lock(mutex_);
+        baseline_.clear();
+    }
+
+private:
+    struct Tracked {
+        std::string path;
+        ResourceType type = ResourceType::Custom;
+        std::size_t refs = 0;
+        SystemClock::time_point loadTime;
+        std::string stackTrace;
+    };
+
+    static ResourceLeakInfo ToInfo(ResourceId id, Tracked const& t) {
+        ResourceLeakInfo info;
+        info.resourceId = id;
+        info.path = t.path;
+        info.type = t.type;
+        info.refCount = t.refs;
+        info.loadTime = t.loadTime;
+        info.stackTrace = t.stackTrace;
+        return info;
+    }
+
+    std::size_t Detect(IResourceManager* manager, ResourceType const* type, std::vector<ResourceLeakInfo>& outLeaks) {
+        outLeaks.clear();
+        {
+            std::lock_guard<std::mutex> lock(mutex_);
+            for (auto const& kv : tracked_) {
+                if (type && kv.second.type != *type) continue;
+                auto base = baseline_.find(kv.first);
+                std::size_t const allowed = base != baseline_.end() ? base->second : 0;
+                if (kv.second.refs > allowed) outLeaks.push_back(ToInfo(kv.first, kv.second));
+            }
+        }
+        // Checked outside the lock: the manager calls back into RecordAcquire/RecordRelease
+        if (manager) {
+            outLeaks.erase(std::remove_if(outLeaks.begin(), outLeaks.end(),
+                                          [manager](ResourceLeakInfo const& leak) {
+                                              return manager->PeekCached(leak.resourceId) == nullptr;
+                                          }),
+                           outLeaks.end());
+        }
+        return outLeaks.size();
+    }
+
+    std::atomic<bool> enabled_{false};
+    std::atomic<bool> captureStack_{false};
+    mutable std::mutex mutex_;
+    std::unordered_map<ResourceId, Tracked> tracked_;
+    std::unordered_map<ResourceId, std::size_t> baseline_;
+};
+
+// === Visualizer ===
+
+class ResourceDebugVisualizerImpl : public IResourceDebugVisualizer {
+public:
+    explicit ResourceDebugVisualizerImpl(IResourceProfiler* profiler) : profiler_(profiler) {}
+
+    DependencyGraphData GetDependencyGraph(IResourceManager* manager) override {
+        DependencyGraphData graph{};
+        if (!manager) return graph;
+        std::vector<IResourceManager::ResourceInfo> infos;
+        manager->GetResourceInfos(infos);
+        std::vector<IResourceManager::ResourceInfo> loaded;
+        manager->GetLoadedResourceInfos(loaded);
+        infos.insert(infos.end(), loaded.begin(), loaded.end());
+
+        std::vector<ResourceId> roots;
+        std::unordered_map<ResourceId, IResourceManager::ResourceInfo const*> known;
+        for (auto const& info : infos) {
+            if (known.emplace(info.guid, &info).second) roots.push_back(info.guid);
+        }
+        Build(manager, roots, 0, known, graph);
+        return graph;
+    }
+
+    DependencyGraphData GetResourceDependencyGraph(IResourceManager* manager, ResourceId rootId,
+                                                   std::size_t maxDepth) override {
+        DependencyGraphData graph{};
+        if (!manager || rootId.IsNull()) return graph;
+        std::vector<IResourceManager::ResourceInfo> infos;
+        manager->GetResourceInfos(infos);
+        std::unordered_map<ResourceId, IResourceManager::ResourceInfo const*> known;
+        for (auto const& info : infos) known.emplace(info.guid, &info);
+        Build(manager, {rootId}, maxDepth, known, graph);
+        return graph;
+    }
+
+    std::string ExportDependencyGraphDot(IResourceManager* manager) override {
+        DependencyGraphData const graph = GetDependencyGraph(manager);
+        std::ostringstream out;
+        out << "digraph resources {\n  node [shape=box];\n";
+        for (DependencyGraphNode const& node : graph.nodes) {
+            std::string label = std::filesystem::u8path(node.path).filename().u8string();
+            if (label.empty()) label = node.resourceId.ToString();
+            out << "  \"" << node.resourceId.ToString() << "\" [label=\"" << EscapeJson(label) << "\\n"
+                << ResourceTypeToString(node.type) << "\\n" << node.memoryUsage << " B\"";
+            if (node.isLoaded) out << ", style=filled, fillcolor=\"#c6e5b1\"";
+            out << "];\n";
+        }
+        for (auto const& edge : graph.edges) {
+            out << "  \"" << edge.first.ToString() << "\" -> \"" << edge.second.ToString() << "\";\n";
+        }
+        out << "}\n";
+        return out.str();
+    }
+
+    std::string ExportDependencyGraphJson(IResourceManager* manager) override {
+        return ToJson(GetDependencyGraph(manager));
+    }
+
+    void GetMemoryByType(IResourceManager* manager, std::unordered_map<ResourceType, std::size_t>& outData) override {
+        outData.clear();
+        if (!manager) return;
+        std::vector<IResourceManager::ResourceInfo> loaded;
+        manager->GetLoadedResourceInfos(loaded);
+        for (auto const& info : loaded) {
+            outData[info.type] += Bytes(manager, info.guid);
+        }
+    }
+
+    /** Resources loaded by path outside any manifest are reported under "". */
+    void GetMemoryByRepository(IResourceManager* manager,
+                               std::unordered_map<std::string, std::size_t>& outData) override {
+        outData.clear();
+        if (!manager) return;
+        std::vector<IResourceManager::ResourceInfo> infos;
+        manager->GetResourceInfos(infos);
+        std::unordered_map<ResourceId, std::string> repoOf;
+        for (auto const& info : infos) repoOf.emplace(info.guid, info.repository);
+        std::vector<IResourceManager::ResourceInfo> loaded;
+        manager->GetLoadedResourceInfos(loaded);
+        for (auto const& info : loaded) {
+            auto it = repoOf.find(info.guid);
+            outData[it != repoOf.end() ? it->second : std::string()] += Bytes(manager, info.guid);
+        }
+    }
+
+    static std::string ToJson(DependencyGraphData const& graph) {
+        std::ostringstream out;
+        out << "{\"nodes\":[";
+        for (std::size_t i = 0; i < graph.nodes.size(); ++i) {
+            DependencyGraphNode const& node = graph.nodes[i];
+            out << (i ? "," : "") << "{\"id\":\"" << node.resourceId.ToString() << "\",\"path\":\""
+                << EscapeJson(node.path) << "\",\"type\":\"" << ResourceTypeToString(node.type)
+                << "\",\"memory\":" << node.memoryUsage << ",\"loaded\":" << (node.isLoaded ? "true" : "false")
+                << ",\"dependencies\":[";
+            for (std::size_t d = 0; d < node.dependencies.size(); ++d) {
+                out << (d ? "," : "") << '"' << node.dependencies[d].ToString() << '"';
+            }
+            out << "]}";
+        }
+        out << "],\"edges\":[";
+        for (std::size_t i = 0; i < graph.edges.size(); ++i) {
+            out << (i ? "," : "") << "{\"from\":\"" << graph.edges[i].first.ToString() << "\",\"to\":\""
+                << graph.edges[i].second.ToString() << "\"}";
+        }
+        out << "],\"maxDepth\":" << graph.maxDepth << ",\"totalNodes\":" << graph.totalNodes
+            << ",\"totalEdges\":" << graph.totalEdges << "}";
+        return out.str();
+    }
+
+    std::size_t Bytes(IResourceManager* manager, ResourceId id) const {
+        std::size_t bytes = manager->GetResourceMemoryUsage(id);
+        if (bytes == 0 && profiler_) bytes = profiler_->GetResidentMemory(id);
+        if (bytes == 0) {
+            char const* path = manager->ResolvePath(id);
+            bytes = path ? FileBytes(path) : 0;
+        }
+        return bytes;
+    }
+
+private:
+    /** Breadth-first from roots along dependencies; maxDepth 0 means unlimited. */
+    void Build(IResourceManager* manager, std::vector<ResourceId> const& roots, std::size_t maxDepth,
+               std::unordered_map<ResourceId, IResourceManager::ResourceInfo const*> const& known,
+               DependencyGraphData& graph) {
+        std::unordered_map<ResourceId, std::size_t> index;
+        std::vector<ResourceId> frontier;
+        for (ResourceId const& id : roots) {
+            if (index.emplace(id, index.size()).second) frontier.push_back(id);
+        }
+        std::vector<ResourceId> order(frontier);
+        for (std::size_t depth = 0; !frontier.empty(); ++depth) {
+            std::vector<ResourceId> next;
+            for (ResourceId const& id : frontier) {
+                std::vector<ResourceId> deps;
+                manager->GetDependencyTree(id, deps, 1);
+                for (ResourceId const& dep : deps) {
+                    if ((maxDepth == 0 || depth < maxDepth) && index.emplace(dep, index.size()).second) {
+                        next.push_back(dep);
+                        order.push_back(dep);
+                    }
+                }
+            }
+            frontier.swap(next);
+        }
+
+        graph.nodes.reserve(order.size());
+        for (ResourceId const& id : order) {
+            DependencyGraphNode node;
+            node.resourceId = id;
+            auto it = known.find(id);
+            char const* path = manager->ResolvePath(id);
+            node.path = path ? path : (it != known.end() ? it->second->assetPath : std::string());
+            node.type = manager->ResolveType(id);
+            if (node.type == ResourceType::_Count) {
+                IResource* resource = manager->PeekCached(id);
+                node.type = it != known.end() ? it->second->type
+                                              : (resource ? resource->GetResourceType() : ResourceType::Custom);
+            }
+            node.isLoaded = manager->PeekCached(id) != nullptr;
+            node.memoryUsage = node.isLoaded ? Bytes(manager, id) : 0;
+            std::vector<ResourceId> deps;
+            manager->GetDependencyTree(id, deps, 1);
+            for (ResourceId const& dep : deps) {
+                // Edges leaving the depth limit are dropped with their target
+                if (index.count(dep)) {
+                    node.dependencies.push_back(dep);
+                    graph.edges.emplace_back(id, dep);
+                }
+            }
+            manager->GetDependents(id, node.dependents);
+            graph.nodes.push_back(std::move(node));
+        }
+        graph.totalNodes = graph.nodes.size();
+        graph.totalEdges = graph.edges.size();
+        graph.maxDepth = LongestChain(graph, index);
+    }
+
+    /** Longest dependency chain in edges; back edges of cycles are skipped. */
+    static std::size_t LongestChain(DependencyGraphData const& graph,
+                                    std::unordered_map<ResourceId, std::size_t> const& index) {
+        enum : char { kNew, kActive, kDone };
+        std::vector<char> state(graph.nodes.size(), kNew);
+        std::vector<std::size_t> depth(graph.nodes.size(), 0);
+        std::size_t longest = 0;
+        for (std::size_t root = 0; root < graph.nodes.size(); ++root) {
+            if (state[root] != kNew) continue;
+            // Iterative DFS: (node, next dependency to visit)
+            std::vector<std::pair<std::size_t, std::size_t>> stack{{root, 0}};
+            state[root] = kActive;
+            while (!stack.empty()) {
+                auto& top = stack.back();
+                std::vector<ResourceId> const& deps = graph.nodes[top.first].dependencies;
+                if (top.second < deps.size()) {
+                    std::size_t const child = index.at(deps[top.second++]);
+                    if (state[child] == kNew) {
+                        state[child] = kActive;
+                        stack.emplace_back(child, 0);
+                    } else if (state[child] == kDone) {
+                        depth[top.first] = std::max(depth[top.first], depth[child] + 1);
+                    }
+                    continue;
+                }
+                state[top.first] = kDone;
+                std::size_t const finished = top.first;
+                stack.pop_back();
+                if (!stack.empty()) {
+                    depth[stack.back().first] = std::max(depth[stack.back().first], depth[finished] + 1);
+                }
+                longest = std::max(longest, depth[finished]);
+            }
+        }
+        return longest;
+    }
+
+    IResourceProfiler* profiler_;
+};
+
+// === Debug manager ===
+
+struct LogSubscription {
+    ResourceDebugLogCallback callback;
+    void* user_data;
+};
+
+class ResourceDebugManagerImpl : public IResourceDebugManager {
+public:
+    ResourceDebugManagerImpl() : visualizer_(&profiler_) {}
+
+    IResourceProfiler* GetProfiler() override { return &profiler_; }
+    IResourceLeakDetector* GetLeakDetector() override { return &leakDetector_; }
+    IResourceDebugVisualizer* GetVisualizer() override { return &visualizer_; }
+
+    void SetLogLevel(ResourceDebugLogLevel level) override { logLevel_.store(level, std::memory_order_relaxed); }
+    ResourceDebugLogLevel GetLogLevel() const override { return logLevel_.load(std::memory_order_relaxed); }
+
+    void* SubscribeToLog(ResourceDebugLogCallback callback, void* user_data) override {
+        if (!callback) return nullptr;
+        std::lock_guard<std::mutex> lock(logMutex_);
+        subscriptions_.push_back(std::make_unique<LogSubscription>(LogSubscription{callback, user_data}));
+        return subscriptions_.back().get();
+    }
+
+    void UnsubscribeFromLog(void* subscription) override {
+        std::lock_guard<std::mutex> lock(logMutex_);
+        subscriptions_.erase(std::remove_if(subscriptions_.begin(), subscriptions_.end(),
+                                            [subscription](std::unique_ptr<LogSubscription> const& s) {
+                                                return s.get() == subscription;
+                                            }),
+                             subscriptions_.end());
+    }
+
+    void Log(ResourceDebugLogLevel level, std::string const& message) override {
+        if (level == ResourceDebugLogLevel::None || level > GetLogLevel()) return;
+        std::vector<LogSubscription> targets;
+        {
+            std::lock_guard<std::mutex> lock(logMutex_);
+            for (auto const& s : subscriptions_) targets.push_back(*s);
+        }
+        for (LogSubscription const& s : targets) {
+            s.callback(level, message, s.user_data);
+        }
+    }
+
+    bool DumpDebugInfo(IResourceManager* manager, std::string const& filePath) override {
+        std::ofstream file(std::filesystem::u8path(filePath), std::ios::binary | std::ios::trunc);
+        if (!file) return false;
+        file << GenerateReport(manager) << "\nDependency graph (DOT):\n" << visualizer_.ExportDependencyGraphDot(manager);
+        return static_cast<bool>(file);
+    }
+
+    std::string GenerateReport(IResourceManager* manager) override {
+        ResourceSystemStats const stats = profiler_.GetSystemStats();
+        std::ostringstream out;
+        out << "=== Resource system report ===\n"
+            << "Resident: " << stats.totalCachedResources << " resources, " << stats.totalMemoryUsage
+            << " B (peak " << stats.peakMemoryUsage << " B)\n"
+            << "Loads: " << stats.totalLoads << " (" << stats.successfulLoads << " ok, " << stats.failedLoads
+            << " failed), in flight " << stats.activeAsyncLoads << "\n"
+            << "Cache: " << stats.cacheHits << " hits, " << stats.cacheMisses << " misses\n"
+            << "Load time: total " << stats.totalLoadTimeMs << " ms, avg " << stats.averageLoadTimeMs
+            << " ms, max " << stats.maxLoadTimeMs << " ms\n";
+
+        std::vector<ResourceProfileData> top;
+        profiler_.GetSlowestLoads(kReportTopCount, top);
+        out << "\nSlowest loads:\n";
+        for (ResourceProfileData const& d : top) {
+            out << "  " << d.loadTimeMs << " ms  " << d.path << "\n";
+        }
+        profiler_.GetLargestResources(kReportTopCount, top);
+        out << "\nLargest resources:\n";
+        for (ResourceProfileData const& d : top) {
+            out << "  " << d.memorySize << " B  " << d.path << "\n";
+        }
+
+        if (manager) {
+            std::unordered_map<ResourceType, std::size_t> byType;
+            visualizer_.GetMemoryByType(manager, byType);
+            out << "\nMemory by type:\n";
+            for (auto const& kv : std::map<int, std::size_t>(ToOrdered(byType))) {
+                out << "  " << ResourceTypeToString(static_cast<ResourceType>(kv.first)) << ": " << kv.second << " B\n";
+            }
+            std::unordered_map<std::string, std::size_t> byRepo;
+            visualizer_.GetMemoryByRepository(manager, byRepo);
+            out << "\nMemory by repository:\n";
+            for (auto const& kv : std::map<std::string, std::size_t>(byRepo.begin(), byRepo.end())) {
+                out << "  " << (kv.first.empty() ? "(none)" : kv.first) << ": " << kv.second << " B\n";
+            }
+        }
+
+        if (leakDetector_.IsEnabled()) {
+            std::vector<ResourceLeakInfo> leaks;
+            leakDetector_.DetectLeaks(manager, leaks);
+            out << "\nLeaks since baseline: " << leaks.size() << "\n";
+            for (ResourceLeakInfo const& leak : leaks) {
+                out << "  " << leak.refCount << " refs  " << leak.path << "\n";
+            }
+        }
+        return out.str();
+    }
+
+    void SetLoadBreakpoint(ResourceId id, bool enabled) override {
+        std::lock_guard<std::mutex> lock(breakpointMutex_);
+        if (enabled) idBreakpoints_.insert(id);
+        else idBreakpoints_.erase(id);
+    }
+
+    void ClearLoadBreakpoint(ResourceId id) override { SetLoadBreakpoint(id, false); }
+
+    void SetTypeBreakpoint(ResourceType type, bool enabled) override {
+        std::lock_guard<std::mutex> lock(breakpointMutex_);
+        if (enabled) typeBreakpoints_.insert(static_cast<int>(type));
+        else typeBreakpoints_.erase(static_cast<int>(type));
+    }
+
+    void ClearTypeBreakpoint(ResourceType type) override { SetTypeBreakpoint(type, false); }
+
+    bool ShouldBreakOnLoad(ResourceId id, ResourceType type) override {
+        std::lock_guard<std::mutex> lock(breakpointMutex_);
+        return idBreakpoints_.count(id) != 0 || typeBreakpoints_.count(static_cast<int>(type)) != 0;
+    }
+
+private:
+    static constexpr std::size_t kReportTopCount = 10;
+
+    static std::map<int, std::size_t> ToOrdered(std::unordered_map<ResourceType, std::size_t> const& in) {
+        std::map<int, std::size_t> out;
+        for (auto const& kv : in) out[static_cast<int>(kv.first)] = kv.second;
+        return out;
+    }
+
+    ResourceProfilerImpl profiler_;
+    ResourceLeakDetectorImpl leakDetector_;
+    ResourceDebugVisualizerImpl visualizer_;
+    std::atomic<ResourceDebugLogLevel> logLevel_{ResourceDebugLogLevel::Warning};
+    std::mutex logMutex_;
+    std::vector<std::unique_ptr<LogSubscription>> subscriptions_;
+    std::mutex breakpointMutex_;
+    std::unordered_set<ResourceId> idBreakpoints_;
+    std::set<int> typeBreakpoints_;
+};
+
+void AppendProfileArray(std::ostringstream& out, char const* name, std::vector<ResourceProfileData> const& data) {
+    out << ",\"" << name << "\":[";
+    for (std::size_t i = 0; i < data.size(); ++i) {
+        ResourceProfileData const& d = data[i];
+        out << (i ? "," : "") << "{\"id\":\"" << d.resourceId.ToString() << "\",\"path\":\"" << EscapeJson(d.path)
+            << "\",\"type\":\"" << ResourceTypeToString(d.type) << "\",\"loadTimeMs\":" << d.loadTimeMs
+            << ",\"dependencyLoadTimeMs\":" << d.dependencyLoadTimeMs << ",\"bytes\":" << d.memorySize << "}";
+    }
+    out << "]";
+}
+
+}  // namespace
+
+// Global debug manager instance (singleton pattern)
+static ResourceDebugManagerImpl* g_resourceDebugManager = nullptr;
+static std::mutex g_resourceDebugManagerMutex;
+
+IResourceDebugManager* GetResourceDebugManager() {
+    std::lock_guard<std::mutex> lock(g_resourceDebugManagerMutex);
+    if (!g_resourceDebugManager) {
+        g_resourceDebugManager = new ResourceDebugManagerImpl();
+    }
+    return g_resourceDebugManager;
+}
+
+bool GenerateOfflineResourceReport(IResourceManager* manager, char const* assetRoot,
+                                   std::string& outJson, std::size_t topCount) {
+    outJson.clear();
+    if (!manager || !assetRoot) return false;
+    IResourceDebugManager* debug = GetResourceDebugManager();
+    IResourceProfiler* profiler = debug->GetProfiler();
+    bool const wasEnabled = profiler->IsEnabled();
+    profiler->Reset();
+    profiler->SetEnabled(true);
+
+    manager->SetAssetRoot(assetRoot);
+    manager->LoadAllManifests();
+    std::vector<IResourceManager::ResourceInfo> infos;
+    manager->GetResourceInfos(infos);
+    std::vector<IResource*> held;
+    std::size_t failed = 0;
+    for (auto const& info : infos) {
+        IResource* resource = manager->LoadSyncByGuid(info.guid);
+        if (resource) held.push_back(resource);
+        else ++failed;
+    }
+
+    std::ostringstream out;
+    ResourceSystemStats const stats = profiler->GetSystemStats();
+    out << "{\"assetRoot\":\"" << EscapeJson(assetRoot) << "\",\"resources\":" << infos.size()
+        << ",\"loaded\":" << held.size() << ",\"failed\":" << failed
+        << ",\"totalLoadTimeMs\":" << stats.totalLoadTimeMs << ",\"maxLoadTimeMs\":" << stats.maxLoadTimeMs
+        << ",\"residentBytes\":" << stats.totalMemoryUsage;
+    std::vector<ResourceProfileData> top;
+    profiler->GetSlowestLoads(topCount, top);
+    AppendProfileArray(out, "slowest", top);
+    profiler->GetLargestResources(topCount, top);
+    AppendProfileArray(out, "largest", top);
+
+    IResourceDebugVisualizer* visualizer = debug->GetVisualizer();
+    std::unordered_map<ResourceType, std::size_t> byType;
+    visualizer->GetMemoryByType(manager, byType);
+    std::map<std::string, std::size_t> orderedTypes;
+    for (auto const& kv : byType) orderedTypes[ResourceTypeToString(kv.first)] += kv.second;
+    out << ",\"memoryByType\":{";
+    bool first = true;
+    for (auto const& kv : orderedTypes) {
+        out << (first ? "" : ",") << '"' << kv.first << "\":" << kv.second;
+        first = false;
+    }
+    std::unordered_map<std::string, std::size_t> byRepo;
+    visualizer->GetMemoryByRepository(manager, byRepo);
+    out << "},\"memoryByRepository\":{";
+    first = true;
+    for (auto const& kv : std::map<std::string, std::size_t>(byRepo.begin(), byRepo.end())) {
+        out << (first ? "" : ",") << '"' << EscapeJson(kv.first) << "\":" << kv.second;
+        first = false;
+    }
+    out << "},\"dependencyGraph\":" << visualizer->ExportDependencyGraphJson(manager) << "}";
+    outJson = out.str();
+
+    for (IResource* resource : held) {
+        manager->Unload(resource);
+    }
+    profiler->SetEnabled(wasEnabled);
+    return !held.empty();
+}
+
+}  // namespace resource
+}  // namespace te
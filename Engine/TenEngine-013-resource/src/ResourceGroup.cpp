@@ -0,0 +1,602 @@
+/**
+ * @file ResourceGroup.cpp
+ * @brief ResourceGroup and IResourceGroupManager implementation (contract: specs/_contracts/013-resource-ABI.md).
+ *
+ * A group load resolves its members and their dependencies once, deduplicated,
+ * and issues every missing resource at the group's priority, dependencies first.
+ * Resources held by groups live in a process-wide residency table: one manager
+ * reference per resource plus the number of groups holding it, and for loads
+ * in flight the groups waiting on them. Overlapping groups therefore share both
+ * the loads and the residency of common resources.
+ */
+
+#include <te/resource/ResourceGroup.h>
+#include <te/resource/ResourceManager.h>
+#include <te/resource/Resource.h>
+#include <algorithm>
+#include <filesystem>
+#include <map>
+#include <mutex>
+#include <unordered_map>
+#include <utility>
+
+namespace te {
+namespace resource {
+
+struct ResourceGroup::LoadState {
+    std::mutex mutex;
+    IResourceManager* manager = nullptr;
+    ResourceGroupId group = nullptr;
+    GroupLoadCompleteCallback callback = nullptr;
+    void* userData = nullptr;
+    bool loading = false;
+    std::size_t requested = 0;    // Resources in the last load (members + dependencies)
+    std::size_t pending = 0;      // Not finished yet; +1 while requests are being issued
+    std::size_t succeeded = 0;
+    std::size_t failed = 0;
+    std::size_t totalBytes = 0;
+    std::size_t loadedBytes = 0;
+    std::unordered_map<ResourceId, std::size_t> held;  // Resources this group holds -> estimated bytes
+};
+
+namespace {
+
+using LoadStatePtr = std::shared_ptr<ResourceGroup::LoadState>;
+
+struct ResidentEntry {
+    IResource* resource = nullptr;      // Null while the load is in flight
+    std::size_t groupRefs = 0;          // Groups holding the resource
+    std::size_t bytes = 0;              // Estimated size (file size on disk)
+    LoadRequestId request = nullptr;    // Load in flight
+    std::vector<LoadStatePtr> waiters;  // Groups waiting on the load in flight
+};
+
+struct Residency {
+    std::mutex mutex;
+    std::unordered_map<ResourceId, ResidentEntry> entries;
+};
+
+Residency& GetResidency() {
+    static Residency residency;
+    return residency;
+}
+
+struct ItemLoadContext {
+    ResourceId id;
+    IResourceManager* manager;
+};
+
+enum class ItemOutcome { Recorded, Completed, Ignored };
+
+std::size_t FileBytes(std::string const& path) {
+    std::error_code ec;
+    auto size = std::filesystem::file_size(std::filesystem::u8path(path), ec);
+    return ec ? 0 : static_cast<std::size_t>(size);
+}
+
+/** Record a finished resource. Ignored when the group's load was cancelled meanwhile. */
+ItemOutcome FinishItem(ResourceGroup::LoadState& state, ResourceId id, bool ok, std::size_t bytes) {
+    std::lock_guard<std::mutex> lock(state.mutex);
+    if (!state.loading) {
+        return ItemOutcome::Ignored;
+    }
+    if (ok) {
+        ++state.succeeded;
+        state.loadedBytes += bytes;
+        state.held.emplace(id, bytes);
+    } else {
+        ++state.failed;
+    }
+    if (--state.pending == 0) {
+        state.loading = false;
+        return ItemOutcome::Completed;
+    }
+    return ItemOutcome::Recorded;
+}
+
+void NotifyComplete(ResourceGroup::LoadState& state) {
+    GroupLoadCompleteCallback callback;
+    ResourceGroupId group;
+    void* userData;
+    std::size_t succeeded;
+    std::size_t failed;
+    {
+        std::lock_guard<std::mutex> lock(state.mutex);
+        callback = state.callback;
+        group = state.group;
+        userData = state.userData;
+        succeeded = state.succeeded;
+        failed = state.failed;
+    }
+    if (callback) {
+        callback(group, succeeded, failed, userData);
+    }
+}
+
+/**
+ * Drop one group reference (all of them when force). The manager reference is
+ * released once no group holds the resource, or kept in the cache when !unload.
+ * @return true if the resource left the residency table
+ */
+bool ReleaseGroupRef(IResourceManager* manager, ResourceId id, bool force, bool unload) {
+    IResource* released = nullptr;
+    {
+        Residency& residency = GetResidency();
+        std::lock_guard<std::mutex> lock(residency.mutex);
+        auto it = residency.entries.find(id);
+        if (it == residency.entries.end() || !it->second.resource) {
+            return false;
+        }
+        if (force || --it->second.groupRefs == 0) {
+            released = it->second.resource;
+            residency.entries.erase(it);
+        }
+    }
+    if (released && unload && manager) {
+        manager->Unload(released);
+    }
+    return released != nullptr;
+}
+
+void OnItemLoaded(IResource* resource, LoadResult result, void* user_data) {
+    std::unique_ptr<ItemLoadContext> ctx(static_cast<ItemLoadContext*>(user_data));
+    bool const ok = result == LoadResult::Ok && resource;
+    std::vector<LoadStatePtr> waiters;
+    std::size_t bytes = 0;
+    {
+        Residency& residency = GetResidency();
+        std::lock_guard<std::mutex> lock(residency.mutex);
+        auto it = residency.entries.find(ctx->id);
+        if (it != residency.entries.end() && !it->second.resource) {
+            waiters.swap(it->second.waiters);
+            bytes = it->second.bytes;
+            if (ok && !waiters.empty()) {
+                it->second.resource = resource;
+                it->second.request = nullptr;
+                it->second.groupRefs = waiters.size();
+            } else {
+                residency.entries.erase(it);
+            }
+        }
+    }
+    if (ok && waiters.empty()) {
+        // Every group waiting on it was cancelled
+        ctx->manager->Unload(resource);
+        return;
+    }
+    for (LoadStatePtr const& state : waiters) {
+        ItemOutcome outcome = FinishItem(*state, ctx->id, ok, bytes);
+        if (outcome == ItemOutcome::Completed) {
+            NotifyComplete(*state);
+        } else if (outcome == ItemOutcome::Ignored && ok) {
+            ReleaseGroupRef(ctx->manager, ctx->id, false, true);
+        }
+    }
+}
+
+}  // namespace
+
+// === ResourceGroup ===
+
+ResourceGroup::ResourceGroup(std::string name) : name_(std::move(name)) {}
+
+ResourceGroup::~ResourceGroup() {
+    if (!load_) {
+        return;
+    }
+    {
+        std::lock_guard<std::mutex> lock(load_->mutex);
+        load_->callback = nullptr;
+    }
+    CancelLoad();
+    // Without an UnloadAll the resources stay cached; only the group's references go away
+    for (auto const& held : load_->held) {
+        ReleaseGroupRef(load_->manager, held.first, false, false);
+    }
+}
+
+ResourceGroupInfo ResourceGroup::GetInfo() const {
+    ResourceGroupInfo info;
+    info.name = name_;
+    info.description = description_;
+    info.resourceCount = resources_.size();
+    if (load_) {
+        std::lock_guard<std::mutex> lock(load_->mutex);
+        for (ResourceId const& id : resources_) {
+            info.loadedCount += load_->held.count(id);
+        }
+        info.failedCount = load_->failed;
+        info.totalSize = load_->totalBytes;
+        info.loadedSize = load_->loadedBytes;
+        info.isLoading = load_->loading;
+        if (load_->requested > 0) {
+            info.progress = static_cast<float>(load_->succeeded + load_->failed) /
+                            static_cast<float>(load_->requested);
+        }
+    }
+    info.isLoaded = info.resourceCount > 0 && info.loadedCount == info.resourceCount;
+    if (info.isLoaded) {
+        info.progress = 1.0f;
+    }
+    return info;
+}
+
+bool ResourceGroup::AddResource(ResourceId id) {
+    if (id.IsNull()) {
+        return false;
+    }
+    return resources_.insert(id).second;
+}
+
+bool ResourceGroup::RemoveResource(ResourceId id) {
+    return resources_.erase(id) > 0;
+}
+
+bool ResourceGroup::ContainsResource(ResourceId id) const {
+    return resources_.count(id) > 0;
+}
+
+void ResourceGroup::GetResources(std::vector<ResourceId>& outResources) const {
+    outResources.assign(resources_.begin(), resources_.end());
+}
+
+void ResourceGroup::Clear() {
+    resources_.clear();
+}
+
+bool ResourceGroup::LoadAllAsync(IResourceManager* manager,
+                                 LoadPriority priority,
+                                 GroupLoadCompleteCallback callback,
+                                 void* user_data) {
+    if (!manager) {
+        return false;
+    }
+    if (!load_) {
+        load_ = std::make_shared<LoadState>();
+    }
+    LoadStatePtr state = load_;
+    {
+        std::lock_guard<std::mutex> lock(state->mutex);
+        if (state->loading) {
+            return false;
+        }
+        state->manager = manager;
+        state->group = this;
+        state->callback = callback;
+        state->userData = user_data;
+        state->loading = true;
+        state->pending = 1;  // Issue guard: completion cannot fire before all requests are out
+        state->succeeded = 0;
+        state->failed = 0;
+        state->totalBytes = 0;
+        state->loadedBytes = 0;
+    }
+
+    // Members and their dependency closure, each once, dependencies before their users
+    std::vector<ResourceId> members(resources_.begin(), resources_.end());
+    std::sort(members.begin(), members.end());
+    std::vector<ResourceId> order;
+    std::unordered_set<ResourceId> seen;
+    std::vector<ResourceId> deps;
+    for (ResourceId const& member : members) {
+        if (manager->GetDependencyTree(member, deps)) {
+            // Breadth-first from the member: the farthest dependencies go first
+            for (auto it = deps.rbegin(); it != deps.rend(); ++it) {
+                if (seen.insert(*it).second) {
+                    order.push_back(*it);
+                }
+            }
+        }
+        if (seen.insert(member).second) {
+            order.push_back(member);
+        }
+    }
+
+    struct PendingIssue {
+        ResourceId id;
+        std::string path;
+        ResourceType type;
+    };
+    std::vector<PendingIssue> issues;
+    Residency& residency = GetResidency();
+    for (ResourceId const& id : order) {
+        {
+            std::lock_guard<std::mutex> lock(state->mutex);
+            auto heldIt = state->held.find(id);
+            if (heldIt != state->held.end()) {
+                // Still held from an earlier load of this group
+                ++state->succeeded;
+                state->totalBytes += heldIt->second;
+                state->loadedBytes += heldIt->second;
+                continue;
+            }
+        }
+        char const* resolved = manager->ResolvePath(id);
+        std::string path = resolved ? resolved : "";
+        std::lock_guard<std::mutex> lock(residency.mutex);
+        auto it = residency.entries.find(id);
+        if (it == residency.entries.end()) {
+            ResidentEntry entry;
+            entry.bytes = path.empty() ? 0 : FileBytes(path);
+            if (manager->PeekCached(id)) {
+                // Resident outside any group: take a manager reference for the groups
+                entry.resource = manager->GetCached(id);
+            } else {
+                ResourceType type = manager->ResolveType(id);
+                if (!path.empty() && type != ResourceType::_Count) {
+                    issues.push_back({id, path, type});
+                } else {
+                    std::lock_guard<std::mutex> stateLock(state->mutex);
+                    ++state->failed;
+                    continue;
+                }
+            }
+            it = residency.entries.emplace(id, std::move(entry)).first;
+        }
+        ResidentEntry& entry = it->second;
+        std::lock_guard<std::mutex> stateLock(state->mutex);
+        state->totalBytes += entry.bytes;
+        if (entry.resource) {
+            ++entry.groupRefs;
+            ++state->succeeded;
+            state->loadedBytes += entry.bytes;
+            state->held.emplace(id, entry.bytes);
+        } else {
+            entry.waiters.push_back(state);
+            ++state->pending;
+        }
+    }
+    {
+        std::lock_guard<std::mutex> lock(state->mutex);
+        state->requested = order.size();
+    }
+
+    LoadOptions options;
+    options.priority = priority;
+    for (PendingIssue const& issue : issues) {
+        options.user_data = new ItemLoadContext{issue.id, manager};
+        LoadRequestId request = manager->RequestLoadAsyncEx(issue.path.c_str(), issue.type, OnItemLoaded, options);
+        std::lock_guard<std::mutex> lock(residency.mutex);
+        auto it = residency.entries.find(issue.id);
+        if (it != residency.entries.end() && !it->second.resource) {
+            it->second.request = request;
+        }
+    }
+
+    bool completed = false;
+    {
+        std::lock_guard<std::mutex> lock(state->mutex);
+        if (state->loading && --state->pending == 0) {
+            state->loading = false;
+            completed = true;
+        }
+    }
+    if (completed) {
+        NotifyComplete(*state);
+    }
+    return true;
+}
+
+void ResourceGroup::CancelLoad() {
+    if (!load_) {
+        return;
+    }
+    LoadStatePtr state = load_;
+    std::vector<LoadRequestId> orphaned;
+    {
+        Residency& residency = GetResidency();
+        std::lock_guard<std::mutex> lock(residency.mutex);
+        for (auto it = residency.entries.begin(); it != residency.entries.end();) {
+            std::vector<LoadStatePtr>& waiters = it->second.waiters;
+            auto pos = std::find(waiters.begin(), waiters.end(), state);
+            if (pos != waiters.end()) {
+                waiters.erase(pos);
+                if (waiters.empty()) {
+                    // No other group needs it: cancel the request
+                    if (it->second.request) {
+                        orphaned.push_back(it->second.request);
+                    }
+                    it = residency.entries.erase(it);
+                    continue;
+                }
+            }
+            ++it;
+        }
+        std::lock_guard<std::mutex> stateLock(state->mutex);
+        if (!state->loading) {
+            return;
+        }
+        state->loading = false;
+        state->failed += state->pending;
+        state->pending = 0;
+    }
+    for (LoadRequestId request : orphaned) {
+        state->manager->CancelLoad(request);
+    }
+    NotifyComplete(*state);
+}
+
+bool ResourceGroup::IsLoading() const {
+    if (!load_) {
+        return false;
+    }
+    std::lock_guard<std::mutex> lock(load_->mutex);
+    return load_->loading;
+}
+
+std::size_t ResourceGroup::UnloadAll(IResourceManager* manager, bool force) {
+    if (!load_) {
+        return 0;
+    }
+    CancelLoad();
+    std::unordered_map<ResourceId, std::size_t> held;
+    {
+        std::lock_guard<std::mutex> lock(load_->mutex);
+        held.swap(load_->held);
+        load_->loadedBytes = 0;
+    }
+    std::size_t unloaded = 0;
+    for (auto const& entry : held) {
+        if (ReleaseGroupRef(manager, entry.first, force, true)) {
+            ++unloaded;
+        }
+    }
+    return unloaded;
+}
+
+bool ResourceGroup::IsFullyLoaded(IResourceManager* manager) const {
+    if (resources_.empty()) {
+        return false;
+    }
+    for (ResourceId const& id : resources_) {
+        bool held = false;
+        if (load_) {
+            std::lock_guard<std::mutex> lock(load_->mutex);
+            held = load_->held.count(id) > 0;
+        }
+        if (!held && (!manager || !manager->PeekCached(id))) {
+            return false;
+        }
+    }
+    return true;
+}
+
+float ResourceGroup::GetLoadProgress(IResourceManager* manager) const {
+    if (load_) {
+        std::lock_guard<std::mutex> lock(load_->mutex);
+        if (load_->loading && load_->requested > 0) {
+            return static_cast<float>(load_->succeeded + load_->failed) / static_cast<float>(load_->requested);
+        }
+    }
+    return IsFullyLoaded(manager) ? 1.0f : 0.0f;
+}
+
+std::size_t ResourceGroup::AddAllDependencies(IResourceManager* manager, bool recursive) {
+    if (!manager) {
+        return 0;
+    }
+    std::vector<ResourceId> members(resources_.begin(), resources_.end());
+    std::vector<ResourceId> deps;
+    std::size_t added = 0;
+    for (ResourceId const& member : members) {
+        if (!manager->GetDependencyTree(member, deps, recursive ? 0 : 1)) {
+            continue;
+        }
+        for (ResourceId const& dep : deps) {
+            if (resources_.insert(dep).second) {
+                ++added;
+            }
+        }
+    }
+    return added;
+}
+
+std::size_t ResourceGroup::GetTotalMemoryUsage(IResourceManager* manager) const {
+    if (!load_) {
+        return 0;
+    }
+    std::lock_guard<std::mutex> lock(load_->mutex);
+    std::size_t total = 0;
+    for (auto const& held : load_->held) {
+        std::size_t reported = manager ? manager->GetResourceMemoryUsage(held.first) : 0;
+        total += reported ? reported : held.second;
+    }
+    return total;
+}
+
+// === ResourceGroupManagerImpl ===
+
+class ResourceGroupManagerImpl : public IResourceGroupManager {
+public:
+    ResourceGroup* CreateGroup(std::string const& name) override {
+        std::lock_guard<std::mutex> lock(mutex_);
+        auto& slot = groups_[name];
+        if (slot) {
+            return nullptr;
+        }
+        slot = std::make_unique<ResourceGroup>(name);
+        return slot.get();
+    }
+
+    ResourceGroup* GetGroup(std::string const& name) override {
+        std::lock_guard<std::mutex> lock(mutex_);
+        auto it = groups_.find(name);
+        return it != groups_.end() ? it->second.get() : nullptr;
+    }
+
+    bool DestroyGroup(std::string const& name, bool unloadResources) override {
+        std::unique_ptr<ResourceGroup> group;
+        {
+            std::lock_guard<std::mutex> lock(mutex_);
+            auto it = groups_.find(name);
+            if (it == groups_.end()) {
+                return false;
+            }
+            group = std::move(it->second);
+            groups_.erase(it);
+        }
+        if (unloadResources) {
+            group->UnloadAll(GetResourceManager());
+        }
+        return true;
+    }
+
+    void GetAllGroupNames(std::vector<std::string>& outNames) const override {
+        outNames.clear();
+        std::lock_guard<std::mutex> lock(mutex_);
+        outNames.reserve(groups_.size());
+        for (auto const& entry : groups_) {
+            outNames.push_back(entry.first);
+        }
+    }
+
+    bool LoadGroupAsync(std::string const& groupName,
+                        LoadPriority priority,
+                        GroupLoadCompleteCallback callback,
+                        void* user_data) override {
+        ResourceGroup* group = GetGroup(groupName);
+        return group && group->LoadAllAsync(GetResourceManager(), priority, callback, user_data);
+    }
+
+    std::size_t UnloadGroup(std::string const& groupName, bool force) override {
+        ResourceGroup* group = GetGroup(groupName);
+        return group ? group->UnloadAll(GetResourceManager(), force) : 0;
+    }
+
+    bool CancelGroupLoad(std::string const& groupName) override {
+        ResourceGroup* group = GetGroup(groupName);
+        if (!group || !group->IsLoading()) {
+            return false;
+        }
+        group->CancelLoad();
+        return true;
+    }
+
+    bool GetGroupInfo(std::string const& groupName, ResourceGroupInfo& outInfo) const override {
+        std::lock_guard<std::mutex> lock(mutex_);
+        auto it = groups_.find(groupName);
+        if (it == groups_.end()) {
+            return false;
+        }
+        outInfo = it->second->GetInfo();
+        return true;
+    }
+
+private:
+    mutable std::mutex mutex_;
+    std::map<std::string, std::unique_ptr<ResourceGroup>> groups_;
+};
+
+static ResourceGroupManagerImpl* g_resourceGroupManager = nullptr;
+static std::mutex g_resourceGroupManagerMutex;
+
+IResourceGroupManager* GetResourceGroupManager() {
+    std::lock_guard<std::mutex> lock(g_resourceGroupManagerMutex);
+    if (!g_resourceGroupManager) {
+        g_resourceGroupManager = new ResourceGroupManagerImpl();
+    }
+    return g_resourceGroupManager;
+}
+
+}  // namespace resource
+}  // namespace te
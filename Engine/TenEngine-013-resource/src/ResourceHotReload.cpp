@@ -0,0 +1,492 @@
+/**
+ * @file ResourceHotReload.cpp
+ * @brief IHotReloadManager implementation (contract: specs/_contracts/013-resource-ABI.md).
+ *
+ * File changes from the watcher are queued and applied once per frame in
+ * ProcessPendingReloads: each changed path is mapped to the loaded resource it
+ * belongs to, dependents are added through the manager's dependency graph, and
+ * every affected resource is reloaded once, dependencies before dependents.
+ * Reload is in place: IResource::Load runs again on the cached object, so
+ * existing pointers stay valid.
+ */
+
+#include <te/resource/ResourceHotReload.h>
+#include <te/resource/ResourceManager.h>
+#include <te/resource/Resource.h>
+#include <algorithm>
+#include <cctype>
+#include <cstring>
+#include <filesystem>
+#include <memory>
+#include <mutex>
+#include <set>
+#include <string>
+#include <unordered_map>
+#include <unordered_set>
+#include <vector>
+
+namespace te {
+namespace resource {
+
+namespace {
+
+char const* const kShaderExtensions[] = {
+    ".shader", ".hlsl", ".glsl", ".vert", ".frag", ".comp", ".geom", ".tesc", ".tese", ".fx", ".wgsl", ".metal"};
+char const* const kSourceExtensions[] = {
+    ".png", ".jpg", ".jpeg", ".tga", ".bmp", ".hdr", ".exr", ".dds", ".ktx",
+    ".obj", ".fbx", ".gltf", ".glb", ".wav", ".ogg", ".mp3", ".ttf", ".otf"};
+
+std::string NormalizePath(std::string const& path) {
+    std::error_code ec;
+    std::filesystem::path abs = std::filesystem::absolute(std::filesystem::path(path), ec);
+    if (ec) {
+        abs = std::filesystem::path(path);
+    }
+    return abs.lexically_normal().generic_string();
+}
+
+std::string ExtensionOf(std::string const& path) {
+    std::size_t const slash = path.rfind('/');
+    std::size_t const dot = path.rfind('.');
+    if (dot == std::string::npos || (slash != std::string::npos && dot < slash)) {
+        return std::string();
+    }
+    std::string ext = path.substr(dot);
+    std::transform(ext.begin(), ext.end(), ext.begin(),
+                   [](unsigned char c) { return static_cast<char>(std::tolower(c)); });
+    return ext;
+}
+
+template <std::size_t N>
+bool HasExtension(std::string const& ext, char const* const (&list)[N]) {
+    for (char const* candidate : list) {
+        if (ext == candidate) {
+            return true;
+        }
+    }
+    return false;
+}
+
+// Glob match with '*' (any run, including '/') and '?' (one character)
+bool GlobMatch(char const* pattern, char const* text) {
+    char const* star = nullptr;
+    char const* resume = nullptr;
+    while (*text) {
+        if (*pattern == '?' || (*pattern != '*' && *pattern == *text)) {
+            ++pattern;
+            ++text;
+        } else if (*pattern == '*') {
+            star = pattern++;
+            resume = text;
+        } else if (star) {
+            pattern = star + 1;
+            text = ++resume;
+        } else {
+            return false;
+        }
+    }
+    while (*pattern == '*') {
+        ++pattern;
+    }
+    return *pattern == '\0';
+}
+
+struct HotReloadSubscription {
+    HotReloadCallback callback = nullptr;
+    void* userData = nullptr;
+};
+
+}  // namespace
+
+class HotReloadManagerImpl : public IHotReloadManager {
+public:
+    HotReloadManagerImpl() : watcher_(CreateFileWatcher()) {
+        watcher_->SetDebounceTime(config_.debounceTime);
+        watcherSubscription_ = watcher_->SubscribeToFileChanges(&HotReloadManagerImpl::OnFileChanged, this);
+    }
+
+    ~HotReloadManagerImpl() override {
+        watcher_->Stop();
+        watcher_->UnsubscribeFromFileChanges(watcherSubscription_);
+        for (HotReloadSubscription* sub : subscriptions_) {
+            delete sub;
+        }
+    }
+
+    void SetConfig(HotReloadConfig const& config) override {
+        {
+            std::lock_guard<std::mutex> lock(mutex_);
+            config_ = config;
+        }
+        watcher_->SetDebounceTime(config.debounceTime);
+        for (std::string const& path : config.watchPaths) {
+            watcher_->AddWatchPath(path, true);
+        }
+        UpdateWatcherState();
+    }
+
+    HotReloadConfig GetConfig() const override {
+        std::lock_guard<std::mutex> lock(mutex_);
+        return config_;
+    }
+
+    void SetEnabled(bool enabled) override {
+        {
+            std::lock_guard<std::mutex> lock(mutex_);
+            config_.enabled = enabled;
+        }
+        UpdateWatcherState();
+    }
+
+    bool IsEnabled() const override {
+        std::lock_guard<std::mutex> lock(mutex_);
+        return config_.enabled;
+    }
+
+    IFileWatcher* GetFileWatcher() override {
+        return watcher_.get();
+    }
+
+    void AddWatchPath(std::string const& path, bool recursive) override {
+        if (watcher_->AddWatchPath(path, recursive)) {
+            std::lock_guard<std::mutex> lock(mutex_);
+            hasWatchPaths_ = true;
+        }
+        UpdateWatcherState();
+    }
+
+    void RemoveWatchPath(std::string const& path) override {
+        watcher_->RemoveWatchPath(path);
+    }
+
+    void WatchAssetRoot() override {
+        IResourceManager* manager = GetResourceManager();
+        char const* root = manager ? manager->GetAssetRoot() : nullptr;
+        if (root && *root) {
+            AddWatchPath(root, true);
+        }
+    }
+
+    bool ReloadResource(IResourceManager* manager, ResourceId resourceId, bool force) override {
+        return manager && Reload(manager, resourceId, force);
+    }
+
+    bool ReloadResourceByPath(IResourceManager* manager, std::string const& path, bool force) override {
+        if (!manager) {
+            return false;
+        }
+        std::unordered_map<std::string, ResourceId> loaded;
+        BuildPathIndex(manager, loaded);
+        ResourceId const id = FindResource(loaded, NormalizePath(path));
+        return !id.IsNull() && Reload(manager, id, force);
+    }
+
+    std::size_t ReloadAllResources(IResourceManager* manager) override {
+        return ReloadMatching(manager, false, ResourceType::Custom);
+    }
+
+    std::size_t ReloadResourcesByType(IResourceManager* manager, ResourceType type) override {
+        return ReloadMatching(manager, true, type);
+    }
+
+    std::size_t ReloadDependentResources(IResourceManager* manager, ResourceId resourceId) override {
+        if (!manager) {
+            return 0;
+        }
+        std::vector<ResourceId> order;
+        CollectReloadOrder(manager, {resourceId}, order);
+        std::size_t count = 0;
+        for (ResourceId const& id : order) {
+            if (id != resourceId && Reload(manager, id, false)) {
+                ++count;
+            }
+        }
+        return count;
+    }
+
+    HotReloadSubscriptionHandle SubscribeToHotReload(HotReloadCallback callback, void* userData) override {
+        if (!callback) {
+            return nullptr;
+        }
+        auto* sub = new HotReloadSubscription{callback, userData};
+        std::lock_guard<std::mutex> lock(mutex_);
+        subscriptions_.push_back(sub);
+        return sub;
+    }
+
+    void UnsubscribeFromHotReload(HotReloadSubscriptionHandle handle) override {
+        std::lock_guard<std::mutex> lock(mutex_);
+        auto it = std::find(subscriptions_.begin(), subscriptions_.end(), static_cast<HotReloadSubscription*>(handle));
+        if (it != subscriptions_.end()) {
+            delete *it;
+            subscriptions_.erase(it);
+        }
+    }
+
+    void ProcessPendingReloads(IResourceManager* manager) override {
+        watcher_->ProcessPendingEvents();
+        std::vector<FileChangeEvent> changes;
+        HotReloadConfig config;
+        {
+            std::lock_guard<std::mutex> lock(mutex_);
+            changes.swap(changes_);
+            config = config_;
+        }
+        // Changes seen while disabled are dropped, not deferred
+        if (changes.empty() || !manager || !config.enabled || !config.autoReload) {
+            return;
+        }
+
+        std::unordered_map<std::string, ResourceId> loaded;
+        BuildPathIndex(manager, loaded);
+        std::vector<ResourceId> changed;
+        std::unordered_set<ResourceId> seen;
+        for (FileChangeEvent const& change : changes) {
+            if (change.changeType == FileChangeType::Deleted) {
+                continue;  // Nothing to reload from
+            }
+            ResourceId const id = FindResource(loaded, change.path);
+            if (!id.IsNull() && seen.insert(id).second) {
+                changed.push_back(id);
+            }
+        }
+        if (changed.empty()) {
+            return;
+        }
+
+        std::vector<ResourceId> order;
+        if (config.reloadDependencies) {
+            CollectReloadOrder(manager, changed, order);
+        } else {
+            order = changed;
+        }
+        for (ResourceId const& id : order) {
+            Reload(manager, id, false);
+        }
+    }
+
+    std::size_t GetPendingReloadCount() const override {
+        std::lock_guard<std::mutex> lock(mutex_);
+        return changes_.size() + watcher_->GetPendingEventCount();
+    }
+
+    bool IsHotReloadable(ResourceType type) const override {
+        std::lock_guard<std::mutex> lock(mutex_);
+        return notReloadable_.find(type) == notReloadable_.end();
+    }
+
+    void SetHotReloadable(ResourceType type, bool supported) override {
+        std::lock_guard<std::mutex> lock(mutex_);
+        if (supported) {
+            notReloadable_.erase(type);
+        } else {
+            notReloadable_.insert(type);
+        }
+    }
+
+    std::size_t GetTotalReloadCount() const override {
+        std::lock_guard<std::mutex> lock(mutex_);
+        return totalReloads_;
+    }
+
+    std::size_t GetFailedReloadCount() const override {
+        std::lock_guard<std::mutex> lock(mutex_);
+        return failedReloads_;
+    }
+
+    std::chrono::system_clock::time_point GetLastReloadTime() const override {
+        std::lock_guard<std::mutex> lock(mutex_);
+        return lastReloadTime_;
+    }
+
+private:
+    static void OnFileChanged(FileChangeEvent const& event, void* userData) {
+        auto* self = static_cast<HotReloadManagerImpl*>(userData);
+        std::lock_guard<std::mutex> lock(self->mutex_);
+        if (self->Accepts(self->config_, event.path)) {
+            self->changes_.push_back(event);
+        }
+    }
+
+    static bool Accepts(HotReloadConfig const& config, std::string const& path) {
+        for (std::string const& pattern : config.excludePatterns) {
+            if (GlobMatch(pattern.c_str(), path.c_str())) {
+                return false;
+            }
+        }
+        std::string const ext = ExtensionOf(path);
+        if (HasExtension(ext, kShaderExtensions)) {
+            return config.watchShaderFiles;
+        }
+        if (HasExtension(ext, kSourceExtensions)) {
+            return config.watchSourceFiles;
+        }
+        return config.watchAssetFiles;
+    }
+
+    void UpdateWatcherState() {
+        bool enabled = false;
+        {
+            std::lock_guard<std::mutex> lock(mutex_);
+            enabled = config_.enabled && hasWatchPaths_;
+        }
+        // Disabling keeps the watcher running so changes are consumed rather than replayed later
+        if (enabled) {
+            watcher_->Start();
+        }
+    }
+
+    static void BuildPathIndex(IResourceManager* manager, std::unordered_map<std::string, ResourceId>& out) {
+        std::vector<IResourceManager::ResourceInfo> infos;
+        manager->GetLoadedResourceInfos(infos);
+        out.reserve(infos.size());
+        for (IResourceManager::ResourceInfo const& info : infos) {
+            if (!info.assetPath.empty()) {
+                out[NormalizePath(info.assetPath)] = info.guid;
+            }
+        }
+    }
+
+    // A resource loaded from "a/foo" owns "a/foo", "a/foo.mesh" and "a/foo.mesh.data"
+    static ResourceId FindResource(std::unordered_map<std::string, ResourceId> const& loaded,
+                                   std::string const& path) {
+        std::string candidate = path;
+        std::size_t const nameStart = path.rfind('/') == std::string::npos ? 0 : path.rfind('/') + 1;
+        for (;;) {
+            auto it = loaded.find(candidate);
+            if (it != loaded.end()) {
+                return it->second;
+            }
+            std::size_t const dot = candidate.rfind('.');
+            if (dot == std::string::npos || dot <= nameStart) {
+                return ResourceId();
+            }
+            candidate.resize(dot);
+        }
+    }
+
+    // Roots plus all transitive dependents, ordered so each resource follows its dependencies
+    static void CollectReloadOrder(IResourceManager* manager, std::vector<ResourceId> const& roots,
+                                   std::vector<ResourceId>& order) {
+        std::unordered_set<ResourceId> visited;
+        std::vector<ResourceId> postOrder;
+        std::vector<std::pair<ResourceId, std::size_t>> stack;
+        std::unordered_map<ResourceId, std::vector<ResourceId>> dependents;
+        for (ResourceId const& root : roots) {
+            if (!visited.insert(root).second) {
+                continue;
+            }
+            stack.emplace_back(root, 0);
+            manager->GetDependents(root, dependents[root]);
+            while (!stack.empty()) {
+                ResourceId const current = stack.back().first;
+                std::vector<ResourceId> const& users = dependents[current];
+                std::size_t& next = stack.back().second;
+                if (next < users.size()) {
+                    ResourceId const user = users[next++];
+                    if (visited.insert(user).second) {
+                        manager->GetDependents(user, dependents[user]);
+                        stack.emplace_back(user, 0);
+                    }
+                } else {
+                    postOrder.push_back(current);
+                    stack.pop_back();
+                }
+            }
+        }
+        order.assign(postOrder.rbegin(), postOrder.rend());
+    }
+
+    std::size_t ReloadMatching(IResourceManager* manager, bool filterType, ResourceType type) {
+        if (!manager) {
+            return 0;
+        }
+        std::vector<IResourceManager::ResourceInfo> infos;
+        manager->GetLoadedResourceInfos(infos);
+        std::size_t count = 0;
+        for (IResourceManager::ResourceInfo const& info : infos) {
+            if ((!filterType || info.type == type) && Reload(manager, info.guid, false)) {
+                ++count;
+            }
+        }
+        return count;
+    }
+
+    bool Reload(IResourceManager* manager, ResourceId id, bool force) {
+        IResource* resource = manager->PeekCached(id);
+        if (!resource) {
+            return false;
+        }
+        char const* resolved = manager->ResolvePath(id);
+        std::string const path = resolved ? resolved : "";
+        auto* hotReloadable = dynamic_cast<IHotReloadableResource*>(resource);
+        bool allowed = !path.empty() && (force || IsHotReloadable(resource->GetResourceType()));
+        if (allowed && hotReloadable && !force) {
+            allowed = hotReloadable->CanHotReload();
+        }
+        if (allowed && hotReloadable) {
+            allowed = hotReloadable->OnPreReload();
+        }
+        if (!allowed) {
+            return false;
+        }
+
+        bool const success = resource->Load(path.c_str(), manager);
+        if (hotReloadable) {
+            hotReloadable->OnPostReload(success);
+        }
+        std::vector<HotReloadSubscription> subs;
+        {
+            std::lock_guard<std::mutex> lock(mutex_);
+            ++totalReloads_;
+            if (!success) {
+                ++failedReloads_;
+            }
+            lastReloadTime_ = std::chrono::system_clock::now();
+            for (HotReloadSubscription const* sub : subscriptions_) {
+                subs.push_back(*sub);
+            }
+        }
+        // In-place reload: newResource is the same object, or nullptr if the reload failed
+        for (HotReloadSubscription const& sub : subs) {
+            sub.callback(id, resource, success ? resource : nullptr, sub.userData);
+        }
+        return success;
+    }
+
+    std::unique_ptr<IFileWatcher> watcher_;
+    HotReloadSubscriptionHandle watcherSubscription_ = nullptr;
+
+    mutable std::mutex mutex_;
+    HotReloadConfig config_;
+    bool hasWatchPaths_ = false;
+    std::vector<FileChangeEvent> changes_;  // Dispatched by the watcher, applied next ProcessPendingReloads
+    std::vector<HotReloadSubscription*> subscriptions_;
+    std::set<ResourceType> notReloadable_;
+    std::size_t totalReloads_ = 0;
+    std::size_t failedReloads_ = 0;
+    std::chrono::system_clock::time_point lastReloadTime_{};
+};
+
+// Global HotReloadManager instance (singleton pattern)
+static HotReloadManagerImpl* g_hotReloadManager = nullptr;
+static std::mutex g_hotReloadManagerMutex;
+
+IHotReloadManager* GetHotReloadManager() {
+    std::lock_guard<std::mutex> lock(g_hotReloadManagerMutex);
+    if (!g_hotReloadManager) {
+        g_hotReloadManager = new HotReloadManagerImpl();
+    }
+    return g_hotReloadManager;
+}
+
+ScopedHotReloadDisable::ScopedHotReloadDisable() : wasEnabled_(GetHotReloadManager()->IsEnabled()) {
+    GetHotReloadManager()->SetEnabled(false);
+}
+
+ScopedHotReloadDisable::~ScopedHotReloadDisable() {
+    GetHotReloadManager()->SetEnabled(wasEnabled_);
+}
+
+}  // namespace resource
+}  // namespace te
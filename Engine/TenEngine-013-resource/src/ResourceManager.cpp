@@ -8,6 +8,7 @@
  * - Hybrid resource factory (prioritize 002-Object TypeRegistry, fallback to ResourceFactory)
  * - Dependency graph management and cycle detection
  * - Integration with 001-Core thread pool
+ * - Profiler and leak detector hooks on the load, cache and unload paths (ResourceDebug.h)
  */
 
 #include <te/resource/ResourceManager.h>
@@ -16,8 +17,10 @@
 #include <te/resource/ResourceId.h>
 #include <te/resource/ResourceRepositoryConfig.h>
 #include <te/resource/ResourceManifest.h>
+#include <te/resource/ResourceDebug.h>
 #include <te/object/TypeRegistry.h>
 #include <te/core/thread.h>
+#include <te/core/profiling.h>
 #include <te/core/alloc.h>
 #include <unordered_map>
 #include <string>
@@ -31,6 +34,7 @@
 #include <chrono>
 #include <sstream>
 #include <map>
+#include <algorithm>
 
 namespace te {
 namespace resource {
@@ -115,7 +119,9 @@ struct AsyncLoadRequest {
 // ResourceManagerImpl: implementation of IResourceManager
 class ResourceManagerImpl : public IResourceManager {
 public:
-    ResourceManagerImpl() {
+    ResourceManagerImpl()
+        : profiler_(GetResourceDebugManager()->GetProfiler())
+        , leak_detector_(GetResourceDebugManager()->GetLeakDetector()) {
         // Initialize thread pool callback thread (default: main thread)
         te::core::IThreadPool* threadPool = te::core::GetThreadPool();
         if (threadPool) {
@@ -157,6 +163,10 @@ public:
         asset_root_ = path ? path : "";
     }
 
+    char const* GetAssetRoot() const override {
+        return asset_root_.c_str();
+    }
+
     void LoadAllManifests() override {
         if (asset_root_.empty()) return;
         {
@@ -326,6 +336,24 @@ public:
         }
     }
 
+    void GetLoadedResourceInfos(std::vector<ResourceInfo>& out) const override {
+        out.clear();
+        std::lock_guard<std::mutex> lock(cache_mutex_);
+        out.reserve(cache_.size());
+        for (auto const& kv : cache_) {
+            ResourceInfo info;
+            info.guid = kv.first;
+            info.assetPath = kv.second.path;
+            auto typeIt = id_to_type_.find(kv.first);
+            if (typeIt != id_to_type_.end()) {
+                info.type = typeIt->second;
+            } else if (kv.second.resource) {
+                info.type = kv.second.resource->GetResourceType();
+            }
+            out.push_back(std::move(info));
+        }
+    }
+
     void GetAssetFolders(std::vector<std::string>& out) const override {
         out.clear();
         std::lock_guard<std::mutex> lock(manifest_mutex_);
@@ -529,6 +557,15 @@ public:
 
     LoadRequestId RequestLoadAsync(char const* path, ResourceType type,
                                   LoadCompleteCallback on_done, void* user_data) override {
+        return SubmitLoad(path, type, on_done, user_data, LoadPriority::Normal);
+    }
+
+    /**
+     * Queue a load on the IO executor; higher priority requests are picked first, equal
+     * priorities in submission order.
+     */
+    LoadRequestId SubmitLoad(char const* path, ResourceType type, LoadCompleteCallback on_done,
+                             void* user_data, LoadPriority priority) {
         if (!path) {
             if (on_done) {
                 on_done(nullptr, LoadResult::Error, user_data);
@@ -539,17 +576,23 @@ public:
         // Check cache first
         ResourceId cachedId = ResolvePathToId(path);
         if (!cachedId.IsNull()) {
-            std::lock_guard<std::mutex> lock(cache_mutex_);
+            std::unique_lock<std::mutex> lock(cache_mutex_);
             auto it = cache_.find(cachedId);
             if (it != cache_.end()) {
                 // Cache hit: increment refcount and call callback immediately
                 it->second.refcount.fetch_add(1);
+                IResource* cached = it->second.resource;
+                std::string cachedPath = it->second.path;
+                lock.unlock();
+                profiler_->RecordCacheHit(cachedId);
+                leak_detector_->RecordAcquire(cachedId, cachedPath, cached->GetResourceType());
                 if (on_done) {
-                    on_done(it->second.resource, LoadResult::Ok, user_data);
+                    on_done(cached, LoadResult::Ok, user_data);
                 }
                 return ToLoadRequestId(reinterpret_cast<void*>(0xFFFFFFFF));  // Special ID for cached
             }
         }
+        profiler_->RecordCacheMiss(cachedId);
         
         // Create async load request
         auto request = std::make_shared<AsyncLoadRequest>();
@@ -597,6 +640,7 @@ public:
                 static_cast<std::shared_ptr<LoadTaskContext>*>(user_data));
             std::shared_ptr<LoadTaskContext> ctx = owned ? *owned : nullptr;
             if (!ctx) return;
+            TE_PROFILE_ZONE("Resource::LoadAsync");
 
             LoadResult result = LoadResult::Error;
             IResource* resource = nullptr;
@@ -604,12 +648,14 @@ public:
             if (ctx->request->cancelled.load()) {
                 result = LoadResult::Cancelled;
             } else {
+                ScopedResourceProfiler scope(ctx->manager->profiler_, ResourceId(), ctx->path, ctx->type);
                 resource = ctx->manager->CreateResourceInstance(ctx->type);
                 if (resource) {
                     bool success = resource->Load(ctx->path.c_str(), ctx->manager);
                     if (success) {
                         result = LoadResult::Ok;
                         ResourceId id = resource->GetResourceId();
+                        scope.SetResult(id, true);
                         ctx->manager->CacheResource(id, resource, ctx->path.c_str());
                     } else {
                         result = LoadResult::Error;
@@ -661,7 +707,7 @@ public:
         te::core::TaskId taskId = ioExecutor->SubmitTaskWithPriority(
             LoadTaskCallback,
             contextPtr,
-            0
+            static_cast<int>(priority)
         );
         
         request->task_id = taskId;
@@ -755,7 +801,7 @@ public:
             return nullptr;
         }
         
-        std::lock_guard<std::mutex> lock(cache_mutex_);
+        std::unique_lock<std::mutex> lock(cache_mutex_);
         auto it = cache_.find(id);
         if (it == cache_.end()) {
             return nullptr;
@@ -763,22 +809,36 @@ public:
         
         // Increment refcount (need mutable to modify atomic in const method)
         const_cast<CacheEntry&>(it->second).refcount.fetch_add(1);
-        return it->second.resource;
+        IResource* resource = it->second.resource;
+        std::string path = it->second.path;
+        lock.unlock();
+        leak_detector_->RecordAcquire(id, path, resource->GetResourceType());
+        return resource;
     }
     
+    IResource* PeekCached(ResourceId id) const override {
+        std::lock_guard<std::mutex> lock(cache_mutex_);
+        auto it = cache_.find(id);
+        return it != cache_.end() ? it->second.resource : nullptr;
+    }
+
     IResource* LoadSync(char const* path, ResourceType type) override {
         if (!path) {
             return nullptr;
         }
+        TE_PROFILE_ZONE("Resource::LoadSync");
         
         // Check cache first
         ResourceId cachedId = ResolvePathToId(path);
         if (!cachedId.IsNull()) {
             IResource* cached = GetCached(cachedId);
             if (cached) {
+                profiler_->RecordCacheHit(cachedId);
                 return cached;
             }
         }
+        profiler_->RecordCacheMiss(cachedId);
+        ScopedResourceProfiler scope(profiler_, cachedId, path, type);
         
         // Create resource instance
         IResource* resource = CreateResourceInstance(type);
@@ -795,6 +855,7 @@ public:
         
         // Cache resource
         ResourceId id = resource->GetResourceId();
+        scope.SetResult(id, true);
         CacheResource(id, resource, path);
         
         return resource;
@@ -805,25 +866,37 @@ public:
             return;
         }
         
-        std::lock_guard<std::mutex> lock(cache_mutex_);
-        auto it = resource_to_id_.find(resource);
-        if (it == resource_to_id_.end()) {
-            return;
-        }
-        
-        ResourceId id = it->second;
-        auto cacheIt = cache_.find(id);
-        if (cacheIt == cache_.end()) {
-            return;
+        ResourceId id;
+        bool evicted = false;
+        {
+            std::lock_guard<std::mutex> lock(cache_mutex_);
+            auto it = resource_to_id_.find(resource);
+            if (it == resource_to_id_.end()) {
+                return;
+            }
+            
+            id = it->second;
+            auto cacheIt = cache_.find(id);
+            if (cacheIt == cache_.end()) {
+                return;
+            }
+            
+            // Decrement refcount
+            int refcount = cacheIt->second.refcount.fetch_sub(1) - 1;
+            if (refcount <= 0) {
+                // Remove from cache (but don't delete resource, let Release handle it)
+                cache_.erase(cacheIt);
+                resource_to_id_.erase(it);
+                evicted = true;
+                // Manifest entries keep their path so the resource can be loaded by ID again
+                if (id_to_type_.find(id) == id_to_type_.end()) {
+                    id_to_path_.erase(id);
+                }
+            }
         }
-        
-        // Decrement refcount
-        int refcount = cacheIt->second.refcount.fetch_sub(1) - 1;
-        if (refcount <= 0) {
-            // Remove from cache (but don't delete resource, let Release handle it)
-            cache_.erase(cacheIt);
-            resource_to_id_.erase(it);
-            id_to_path_.erase(id);
+        leak_detector_->RecordRelease(id);
+        if (evicted) {
+            profiler_->RecordUnload(id);
         }
         
         // Call Release
@@ -936,13 +1009,16 @@ public:
      * Cache resource (public helper for static lambda callbacks).
      */
     void CacheResource(ResourceId id, IResource* resource, char const* path) {
-        std::lock_guard<std::mutex> lock(cache_mutex_);
-        CacheEntry& entry = cache_[id];
-        entry.resource = resource;
-        entry.refcount.store(1);
-        entry.path = path;
-        resource_to_id_[resource] = id;
-        id_to_path_[id] = path;
+        {
+            std::lock_guard<std::mutex> lock(cache_mutex_);
+            CacheEntry& entry = cache_[id];
+            entry.resource = resource;
+            entry.refcount.store(1);
+            entry.path = path;
+            resource_to_id_[resource] = id;
+            id_to_path_[id] = path;
+        }
+        leak_detector_->RecordAcquire(id, path, resource->GetResourceType());
     }
     
     /**
@@ -984,10 +1060,8 @@ public:
     LoadRequestId RequestLoadAsyncEx(char const* path, ResourceType type,
                                      LoadCompleteCallback on_done,
                                      LoadOptions const& options) override {
-        // For now, delegate to basic RequestLoadAsync
-        // TODO: Honor LoadOptions (priority, callback thread, etc.)
-        (void)options;
-        return RequestLoadAsync(path, type, on_done, options.user_data);
+        // TODO: Honor LoadOptions::callbackThread and preloadDependencies
+        return SubmitLoad(path, type, on_done, options.user_data, options.priority);
     }
 
     BatchLoadRequestId RequestLoadBatchAsync(
@@ -1042,12 +1116,72 @@ public:
 
     bool GetDependencyTree(ResourceId id, std::vector<ResourceId>& out_deps,
                            std::size_t max_depth) const override {
-        (void)id;
-        (void)max_depth;
         out_deps.clear();
+        std::lock_guard<std::mutex> lock(dep_graph_mutex_);
+        if (dep_graph_.find(id) == dep_graph_.end()) {
+            return false;
+        }
+        // Breadth-first so nearer dependencies come first; each ID is reported once
+        std::set<ResourceId> visited{id};
+        std::vector<ResourceId> frontier{id};
+        for (std::size_t depth = 0; !frontier.empty() && (max_depth == 0 || depth < max_depth); ++depth) {
+            std::vector<ResourceId> next;
+            for (ResourceId const& current : frontier) {
+                auto it = dep_graph_.find(current);
+                if (it == dep_graph_.end()) {
+                    continue;
+                }
+                for (ResourceId const& dep : it->second) {
+                    if (visited.insert(dep).second) {
+                        out_deps.push_back(dep);
+                        next.push_back(dep);
+                    }
+                }
+            }
+            frontier.swap(next);
+        }
         return true;
     }
 
+    void SetDependencies(ResourceId id, std::vector<ResourceId> const& dependencies) override {
+        if (id.IsNull()) {
+            return;
+        }
+        std::lock_guard<std::mutex> lock(dep_graph_mutex_);
+        auto it = dep_graph_.find(id);
+        if (it != dep_graph_.end()) {
+            for (ResourceId const& old : it->second) {
+                auto revIt = dependents_.find(old);
+                if (revIt == dependents_.end()) {
+                    continue;
+                }
+                std::vector<ResourceId>& users = revIt->second;
+                users.erase(std::remove(users.begin(), users.end(), id), users.end());
+                if (users.empty()) {
+                    dependents_.erase(revIt);
+                }
+            }
+        }
+        std::vector<ResourceId>& deps = dep_graph_[id];
+        deps.clear();
+        for (ResourceId const& dep : dependencies) {
+            if (dep.IsNull() || dep == id || std::find(deps.begin(), deps.end(), dep) != deps.end()) {
+                continue;
+            }
+            deps.push_back(dep);
+            dependents_[dep].push_back(id);
+        }
+    }
+
+    void GetDependents(ResourceId id, std::vector<ResourceId>& out_dependents) const override {
+        out_dependents.clear();
+        std::lock_guard<std::mutex> lock(dep_graph_mutex_);
+        auto it = dependents_.find(id);
+        if (it != dependents_.end()) {
+            out_dependents = it->second;
+        }
+    }
+
     std::size_t GetTotalMemoryUsage() const override {
         return 0;
     }
@@ -1133,12 +1267,17 @@ private:
     // Dependency graph (for cycle detection)
     mutable std::mutex dep_graph_mutex_;
     std::unordered_map<ResourceId, std::vector<ResourceId>> dep_graph_;
+    std::unordered_map<ResourceId, std::vector<ResourceId>> dependents_;  // Reverse of dep_graph_
 
     // Streaming requests (id + priority; actual load-by-priority can be wired later)
     struct StreamingEntry { ResourceId id; int priority; };
     mutable std::mutex streaming_mutex_;
     std::unordered_map<uintptr_t, StreamingEntry> streaming_requests_;
     uintptr_t next_streaming_handle_ = 1;
+
+    // Telemetry (owned by the global resource debug manager)
+    IResourceProfiler* const profiler_;
+    IResourceLeakDetector* const leak_detector_;
     
     /** Get repository root directory (disk path) for a repository name. Uses repo_config_; falls back to name if not found. */
     std::string GetRepoRoot(char const* repositoryName) const {
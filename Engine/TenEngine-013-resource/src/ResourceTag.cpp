@@ -0,0 +1,827 @@
+/**
+ * @file ResourceTag.cpp
+ * @brief IResourceTagManager implementation (contract: specs/_contracts/013-resource-ABI.md).
+ *
+ * Every tagged resource gets a dense slot. The index keeps two bitset views:
+ * - a row per slot: the resource's tags, one bit per tag (fixed stride);
+ * - a column per tag: the slots carrying the tag, one bit per slot.
+ * Queries combine columns word by word (AND / OR / AND NOT over 64-bit words,
+ * which the compiler vectorizes), then walk the set bits of the result; rows
+ * answer per-resource lookups and clear a resource's columns on removal.
+ */
+
+#include <te/resource/ResourceTag.h>
+#include <te/resource/ResourceGroup.h>
+#include <te/resource/ResourceManager.h>
+#include <te/resource/ResourceManifest.h>
+#include <te/core/platform.h>
+#include <algorithm>
+#include <cstdint>
+#include <map>
+#include <mutex>
+#include <sstream>
+#include <unordered_map>
+#include <utility>
+
+#if defined(_MSC_VER)
+#include <intrin.h>
+#endif
+
+namespace te {
+namespace resource {
+
+namespace {
+
+using Bits = std::vector<std::uint64_t>;
+
+constexpr std::size_t kWordBits = 64;
+constexpr char const* kDefaultCategory = "Default";
+constexpr char const* kTypeCategory = "Type";
+
+unsigned CountTrailingZeros(std::uint64_t word) {
+#if defined(_MSC_VER)
+    unsigned long index;
+    _BitScanForward64(&index, word);
+    return static_cast<unsigned>(index);
+#else
+    return static_cast<unsigned>(__builtin_ctzll(word));
+#endif
+}
+
+std::size_t PopCount(std::uint64_t word) {
+#if defined(_MSC_VER)
+    return static_cast<std::size_t>(__popcnt64(word));
+#else
+    return static_cast<std::size_t>(__builtin_popcountll(word));
+#endif
+}
+
+// Word-wise set operations; src may be shorter than dst (missing words are zero)
+void AndWords(Bits& dst, Bits const& src) {
+    std::size_t const n = std::min(dst.size(), src.size());
+    for (std::size_t i = 0; i < n; ++i) dst[i] &= src[i];
+    std::fill(dst.begin() + static_cast<std::ptrdiff_t>(n), dst.end(), 0);
+}
+
+void OrWords(Bits& dst, Bits const& src) {
+    std::size_t const n = std::min(dst.size(), src.size());
+    for (std::size_t i = 0; i < n; ++i) dst[i] |= src[i];
+}
+
+void AndNotWords(Bits& dst, Bits const& src) {
+    std::size_t const n = std::min(dst.size(), src.size());
+    for (std::size_t i = 0; i < n; ++i) dst[i] &= ~src[i];
+}
+
+void SetBit(Bits& bits, std::size_t bit) {
+    std::size_t const word = bit / kWordBits;
+    if (word >= bits.size()) bits.resize(word + 1, 0);
+    bits[word] |= std::uint64_t(1) << (bit % kWordBits);
+}
+
+void ClearBit(Bits& bits, std::size_t bit) {
+    std::size_t const word = bit / kWordBits;
+    if (word < bits.size()) bits[word] &= ~(std::uint64_t(1) << (bit % kWordBits));
+}
+
+std::string EscapeJsonString(std::string const& s) {
+    std::string out;
+    out.reserve(s.size() + 8);
+    for (char c : s) {
+        if (c == '"') out += "\\\"";
+        else if (c == '\\') out += "\\\\";
+        else if (c == '\n') out += "\\n";
+        else if (c == '\r') out += "\\r";
+        else if (c == '\t') out += "\\t";
+        else out += c;
+    }
+    return out;
+}
+
+/** Read the JSON string starting at content[i] == '"'; i ends past the closing quote. */
+std::string ReadJsonString(std::string const& content, std::size_t& i) {
+    std::string out;
+    for (++i; i < content.size() && content[i] != '"'; ++i) {
+        if (content[i] == '\\' && i + 1 < content.size()) {
+            char const c = content[++i];
+            out += c == 'n' ? '\n' : c == 'r' ? '\r' : c == 't' ? '\t' : c;
+        } else {
+            out += content[i];
+        }
+    }
+    if (i < content.size()) ++i;
+    return out;
+}
+
+/** Call fn for each top-level object in the array under key (flat or nested objects). */
+template <typename Fn>
+void ForEachJsonObject(std::string const& content, char const* key, Fn&& fn) {
+    std::size_t pos = content.find(std::string("\"") + key + "\"");
+    if (pos == std::string::npos) return;
+    pos = content.find('[', pos);
+    if (pos == std::string::npos) return;
+    std::size_t i = pos + 1;
+    while (i < content.size() && content[i] != ']') {
+        if (content[i] != '{') {
+            ++i;
+            continue;
+        }
+        std::size_t const start = i;
+        int depth = 0;
+        while (i < content.size()) {
+            if (content[i] == '"') {
+                ReadJsonString(content, i);
+                continue;
+            }
+            if (content[i] == '{') ++depth;
+            else if (content[i] == '}' && --depth == 0) break;
+            ++i;
+        }
+        fn(content.substr(start, i - start + 1));
+        ++i;
+    }
+}
+
+std::string JsonField(std::string const& obj, char const* key) {
+    std::size_t pos = obj.find(std::string("\"") + key + "\"");
+    if (pos == std::string::npos) return std::string();
+    pos = obj.find(':', pos);
+    if (pos == std::string::npos) return std::string();
+    pos = obj.find('"', pos);
+    return pos == std::string::npos ? std::string() : ReadJsonString(obj, pos);
+}
+
+std::vector<std::string> JsonStringArray(std::string const& obj, char const* key) {
+    std::vector<std::string> out;
+    std::size_t pos = obj.find(std::string("\"") + key + "\"");
+    if (pos == std::string::npos) return out;
+    pos = obj.find('[', pos);
+    if (pos == std::string::npos) return out;
+    std::size_t i = pos + 1;
+    while (i < obj.size() && obj[i] != ']') {
+        if (obj[i] == '"') out.push_back(ReadJsonString(obj, i));
+        else ++i;
+    }
+    return out;
+}
+
+struct TagRecord {
+    TagInfo info;
+    bool alive = false;
+    std::vector<TagId> children;
+    Bits column;  // Slots carrying this tag
+};
+
+}  // namespace
+
+class ResourceTagManagerImpl : public IResourceTagManager {
+public:
+    ResourceTagManagerImpl() { InitSystemTags(); }
+
+    // === Tag management ===
+
+    TagId CreateTag(std::string const& name, std::string const& category) override {
+        std::lock_guard<std::mutex> lock(mutex_);
+        return CreateTagLocked(name, category, false);
+    }
+
+    TagId GetTagId(std::string const& name) const override {
+        std::lock_guard<std::mutex> lock(mutex_);
+        auto it = tag_by_name_.find(name);
+        return it != tag_by_name_.end() ? it->second : InvalidTagId;
+    }
+
+    bool GetTagInfo(TagId id, TagInfo& outInfo) const override {
+        std::lock_guard<std::mutex> lock(mutex_);
+        TagRecord const* tag = Find(id);
+        if (!tag) return false;
+        outInfo = tag->info;
+        return true;
+    }
+
+    bool GetTagInfoByName(std::string const& name, TagInfo& outInfo) const override {
+        std::lock_guard<std::mutex> lock(mutex_);
+        auto it = tag_by_name_.find(name);
+        if (it == tag_by_name_.end()) return false;
+        outInfo = tags_[it->second - 1].info;
+        return true;
+    }
+
+    bool DeleteTag(TagId id) override {
+        std::lock_guard<std::mutex> lock(mutex_);
+        TagRecord* tag = Find(id);
+        if (!tag || tag->info.isSystemTag) return false;
+        DeleteTagLocked(*tag);
+        return true;
+    }
+
+    bool RenameTag(TagId id, std::string const& newName) override {
+        std::lock_guard<std::mutex> lock(mutex_);
+        TagRecord* tag = Find(id);
+        if (!tag || tag->info.isSystemTag || newName.empty() || tag_by_name_.count(newName)) return false;
+        tag_by_name_.erase(tag->info.name);
+        if (tag->info.displayName == tag->info.name) tag->info.displayName = newName;
+        tag->info.name = newName;
+        tag_by_name_[newName] = id;
+        return true;
+    }
+
+    void GetAllTags(std::vector<TagInfo>& outTags) const override {
+        outTags.clear();
+        std::lock_guard<std::mutex> lock(mutex_);
+        for (TagRecord const& tag : tags_) {
+            if (tag.alive) outTags.push_back(tag.info);
+        }
+    }
+
+    void GetTagsByCategory(std::string const& category, std::vector<TagInfo>& outTags) const override {
+        outTags.clear();
+        std::lock_guard<std::mutex> lock(mutex_);
+        auto it = categories_.find(category.empty() ? kDefaultCategory : category);
+        if (it == categories_.end()) return;
+        for (TagId id : it->second.tags) outTags.push_back(tags_[id - 1].info);
+    }
+
+    // === Categories ===
+
+    bool CreateCategory(std::string const& name, std::string const& description) override {
+        std::lock_guard<std::mutex> lock(mutex_);
+        if (name.empty() || categories_.count(name)) return false;
+        TagCategory& category = categories_[name];
+        category.name = name;
+        category.description = description;
+        return true;
+    }
+
+    void GetCategories(std::vector<TagCategory>& outCategories) const override {
+        outCategories.clear();
+        std::lock_guard<std::mutex> lock(mutex_);
+        for (auto const& kv : categories_) outCategories.push_back(kv.second);
+    }
+
+    bool DeleteCategory(std::string const& name) override {
+        std::lock_guard<std::mutex> lock(mutex_);
+        auto it = categories_.find(name);
+        if (it == categories_.end() || it->second.isSystemCategory) return false;
+        TagCategory& fallback = categories_[kDefaultCategory];
+        for (TagId id : it->second.tags) {
+            tags_[id - 1].info.category = kDefaultCategory;
+            fallback.tags.push_back(id);
+        }
+        categories_.erase(it);
+        return true;
+    }
+
+    // === Hierarchy ===
+
+    bool SetTagParent(TagId tagId, TagId parentId) override {
+        std::lock_guard<std::mutex> lock(mutex_);
+        TagRecord* tag = Find(tagId);
+        if (!tag || (parentId != InvalidTagId && !Find(parentId))) return false;
+        // Reject cycles: the new parent may not be the tag or one of its descendants
+        for (TagId p = parentId; p != InvalidTagId; p = tags_[p - 1].info.parentTag) {
+            if (p == tagId) return false;
+        }
+        Unparent(*tag);
+        tag->info.parentTag = parentId;
+        if (parentId != InvalidTagId) tags_[parentId - 1].children.push_back(tagId);
+        return true;
+    }
+
+    void GetChildTags(TagId parentId, std::vector<TagId>& outChildren, bool recursive) const override {
+        outChildren.clear();
+        std::lock_guard<std::mutex> lock(mutex_);
+        TagRecord const* parent = Find(parentId);
+        if (!parent) return;
+        outChildren = parent->children;
+        for (std::size_t i = 0; recursive && i < outChildren.size(); ++i) {
+            std::vector<TagId> const& grandChildren = tags_[outChildren[i] - 1].children;
+            outChildren.insert(outChildren.end(), grandChildren.begin(), grandChildren.end());
+        }
+    }
+
+    // === Resource tagging ===
+
+    bool AddTagToResource(ResourceId resourceId, TagId tagId) override {
+        std::lock_guard<std::mutex> lock(mutex_);
+        return AddLocked(resourceId, tagId);
+    }
+
+    bool AddTagToResourceByName(ResourceId resourceId, std::string const& tagName) override {
+        std::lock_guard<std::mutex> lock(mutex_);
+        auto it = tag_by_name_.find(tagName);
+        return it != tag_by_name_.end() && AddLocked(resourceId, it->second);
+    }
+
+    bool RemoveTagFromResource(ResourceId resourceId, TagId tagId) override {
+        std::lock_guard<std::mutex> lock(mutex_);
+        return RemoveLocked(resourceId, tagId);
+    }
+
+    std::size_t RemoveAllTagsFromResource(ResourceId resourceId) override {
+        std::lock_guard<std::mutex> lock(mutex_);
+        auto it = slot_of_.find(resourceId);
+        if (it == slot_of_.end()) return 0;
+        std::vector<TagId> tagIds;
+        RowTags(it->second, tagIds);
+        for (TagId id : tagIds) RemoveLocked(resourceId, id);
+        return tagIds.size();
+    }
+
+    void GetResourceTags(ResourceId resourceId, std::vector<TagInfo>& outTags) const override {
+        outTags.clear();
+        std::lock_guard<std::mutex> lock(mutex_);
+        auto it = slot_of_.find(resourceId);
+        if (it == slot_of_.end()) return;
+        std::vector<TagId> tagIds;
+        RowTags(it->second, tagIds);
+        for (TagId id : tagIds) outTags.push_back(tags_[id - 1].info);
+    }
+
+    bool ResourceHasTag(ResourceId resourceId, TagId tagId) const override {
+        std::lock_guard<std::mutex> lock(mutex_);
+        auto it = slot_of_.find(resourceId);
+        return it != slot_of_.end() && Find(tagId) && RowHas(it->second, tagId);
+    }
+
+    bool ResourceHasTagByName(ResourceId resourceId, std::string const& tagName) const override {
+        TagId const id = GetTagId(tagName);
+        return id != InvalidTagId && ResourceHasTag(resourceId, id);
+    }
+
+    // === Queries ===
+
+    void GetResourcesWithTag(TagId tagId, std::vector<ResourceId>& outResources) const override {
+        ResourceTagQuery query;
+        query.required.push_back(tagId);
+        Query(query, outResources);
+    }
+
+    void GetResourcesWithAllTags(std::vector<TagId> const& tagIds, std::vector<ResourceId>& outResources) const override {
+        ResourceTagQuery query;
+        query.required = tagIds;
+        Query(query, outResources);
+    }
+
+    void GetResourcesWithAnyTag(std::vector<TagId> const& tagIds, std::vector<ResourceId>& outResources) const override {
+        outResources.clear();
+        if (tagIds.empty()) return;
+        ResourceTagQuery query;
+        query.any = tagIds;
+        Query(query, outResources);
+    }
+
+    void QueryResources(std::vector<TagId> const& requiredTags, std::vector<TagId> const& anyTags,
+                        std::vector<TagId> const& excludedTags, ResourceFilterFunc filter,
+                        std::vector<ResourceId>& outResources) const override {
+        ResourceTagQuery query;
+        query.required = requiredTags;
+        query.any = anyTags;
+        query.excluded = excludedTags;
+        Query(query, outResources);
+        if (filter) {
+            outResources.erase(std::remove_if(outResources.begin(), outResources.end(),
+                                              [&filter](ResourceId const& id) { return !filter(id); }),
+                               outResources.end());
+        }
+    }
+
+    void Query(ResourceTagQuery const& query, std::vector<ResourceId>& outResources) const override {
+        outResources.clear();
+        std::lock_guard<std::mutex> lock(mutex_);
+        Bits const result = Evaluate(query);
+        for (std::size_t w = 0; w < result.size(); ++w) {
+            for (std::uint64_t word = result[w]; word; word &= word - 1) {
+                outResources.push_back(slot_ids_[w * kWordBits + CountTrailingZeros(word)]);
+            }
+        }
+    }
+
+    std::size_t CountQuery(ResourceTagQuery const& query) const override {
+        std::lock_guard<std::mutex> lock(mutex_);
+        std::size_t count = 0;
+        for (std::uint64_t word : Evaluate(query)) count += PopCount(word);
+        return count;
+    }
+
+    // === Type tags ===
+
+    TagId GetTypeTag(ResourceType type) const override {
+        std::size_t const index = static_cast<std::size_t>(type);
+        return index < type_tags_.size() ? type_tags_[index] : InvalidTagId;
+    }
+
+    std::size_t TagResourcesByType(IResourceManager* manager) override {
+        if (!manager) return 0;
+        std::vector<IResourceManager::ResourceInfo> infos;
+        manager->GetResourceInfos(infos);
+        std::lock_guard<std::mutex> lock(mutex_);
+        std::size_t added = 0;
+        for (auto const& info : infos) {
+            TagId const tag = GetTypeTag(info.type);
+            if (tag != InvalidTagId && AddLocked(info.guid, tag)) ++added;
+        }
+        return added;
+    }
+
+    // === Batch operations ===
+
+    std::size_t AddTagToResources(std::vector<ResourceId> const& resourceIds, TagId tagId) override {
+        std::lock_guard<std::mutex> lock(mutex_);
+        std::size_t added = 0;
+        for (ResourceId const& id : resourceIds) added += AddLocked(id, tagId) ? 1 : 0;
+        return added;
+    }
+
+    std::size_t RemoveTagFromResources(std::vector<ResourceId> const& resourceIds, TagId tagId) override {
+        std::lock_guard<std::mutex> lock(mutex_);
+        std::size_t removed = 0;
+        for (ResourceId const& id : resourceIds) removed += RemoveLocked(id, tagId) ? 1 : 0;
+        return removed;
+    }
+
+    std::size_t AddQueryToGroup(ResourceTagQuery const& query, ResourceGroup& group) const override {
+        std::vector<ResourceId> matches;
+        Query(query, matches);
+        std::size_t added = 0;
+        for (ResourceId const& id : matches) added += group.AddResource(id) ? 1 : 0;
+        return added;
+    }
+
+    bool LoadTagged(std::string const& groupName, ResourceTagQuery const& query, LoadPriority priority,
+                    GroupLoadCompleteCallback callback, void* user_data) override {
+        IResourceGroupManager* groups = GetResourceGroupManager();
+        ResourceGroup* group = groups->GetGroup(groupName);
+        if (!group) group = groups->CreateGroup(groupName);
+        if (!group) return false;
+        AddQueryToGroup(query, *group);
+        return groups->LoadGroupAsync(groupName, priority, callback, user_data);
+    }
+
+    std::size_t UnloadTagged(std::string const& groupName) override {
+        IResourceGroupManager* groups = GetResourceGroupManager();
+        std::size_t const unloaded = groups->UnloadGroup(groupName);
+        groups->DestroyGroup(groupName);
+        return unloaded;
+    }
+
+    std::size_t SetTaggedPriority(IResourceManager* manager, ResourceTagQuery const& query, int priority) override {
+        if (!manager) return 0;
+        std::vector<ResourceId> matches;
+        Query(query, matches);
+        std::lock_guard<std::mutex> lock(streaming_mutex_);
+        if (streaming_manager_ != manager) {
+            streaming_handles_.clear();
+            streaming_manager_ = manager;
+        }
+        for (ResourceId const& id : matches) {
+            auto it = streaming_handles_.find(id);
+            if (it == streaming_handles_.end()) {
+                streaming_handles_.emplace(id, manager->RequestStreaming(id, priority));
+            } else {
+                manager->SetStreamingPriority(it->second, priority);
+            }
+        }
+        return matches.size();
+    }
+
+    // === Serialization ===
+
+    bool SaveToFile(char const* filePath) override {
+        if (!filePath) return false;
+        std::ostringstream out;
+        std::lock_guard<std::mutex> lock(mutex_);
+        out << "{\"categories\":[";
+        bool first = true;
+        for (auto const& kv : categories_) {
+            if (kv.second.isSystemCategory) continue;
+            out << (first ? "" : ",") << "{\"name\":\"" << EscapeJsonString(kv.first) << "\",\"description\":\""
+                << EscapeJsonString(kv.second.description) << "\"}";
+            first = false;
+        }
+        out << "],\"tags\":[";
+        first = true;
+        for (TagRecord const& tag : tags_) {
+            if (!tag.alive || tag.info.isSystemTag) continue;
+            TagInfo const& info = tag.info;
+            out << (first ? "" : ",") << "{\"name\":\"" << EscapeJsonString(info.name) << "\",\"displayName\":\""
+                << EscapeJsonString(info.displayName) << "\",\"description\":\"" << EscapeJsonString(info.description)
+                << "\",\"category\":\"" << EscapeJsonString(info.category) << "\",\"parent\":\""
+                << (info.parentTag != InvalidTagId ? EscapeJsonString(tags_[info.parentTag - 1].info.name) : "")
+                << "\"}";
+            first = false;
+        }
+        out << "],\"resources\":[";
+        first = true;
+        std::vector<TagId> tagIds;
+        for (auto const& kv : slot_of_) {
+            RowTags(kv.second, tagIds);
+            out << (first ? "" : ",") << "{\"id\":\"" << kv.first.ToString() << "\",\"tags\":[";
+            for (std::size_t i = 0; i < tagIds.size(); ++i) {
+                out << (i ? "," : "") << '"' << EscapeJsonString(tags_[tagIds[i] - 1].info.name) << '"';
+            }
+            out << "]}";
+            first = false;
+        }
+        out << "]}";
+        return te::core::FileWrite(filePath, out.str());
+    }
+
+    bool LoadFromFile(char const* filePath, bool merge) override {
+        if (!filePath) return false;
+        auto data = te::core::FileRead(filePath);
+        if (!data) return false;
+        std::string const content(data->begin(), data->end());
+        std::lock_guard<std::mutex> lock(mutex_);
+        if (!merge) ResetLocked();
+        ForEachJsonObject(content, "categories", [this](std::string const& obj) {
+            std::string const name = JsonField(obj, "name");
+            if (name.empty()) return;
+            TagCategory& category = categories_[name];
+            category.name = name;
+            category.description = JsonField(obj, "description");
+        });
+        std::vector<std::pair<TagId, std::string>> parents;
+        ForEachJsonObject(content, "tags", [this, &parents](std::string const& obj) {
+            std::string const name = JsonField(obj, "name");
+            auto existing = tag_by_name_.find(name);
+            TagId const id = existing != tag_by_name_.end() ? existing->second
+                                                            : CreateTagLocked(name, JsonField(obj, "category"), false);
+            if (id == InvalidTagId || tags_[id - 1].info.isSystemTag) return;
+            TagInfo& info = tags_[id - 1].info;
+            std::string const displayName = JsonField(obj, "displayName");
+            if (!displayName.empty()) info.displayName = displayName;
+            info.description = JsonField(obj, "description");
+            std::string parent = JsonField(obj, "parent");
+            if (!parent.empty()) parents.emplace_back(id, std::move(parent));
+        });
+        for (auto const& link : parents) {
+            auto it = tag_by_name_.find(link.second);
+            if (it == tag_by_name_.end() || it->second == link.first) continue;
+            TagRecord& tag = tags_[link.first - 1];
+            Unparent(tag);
+            tag.info.parentTag = it->second;
+            tags_[it->second - 1].children.push_back(link.first);
+        }
+        ForEachJsonObject(content, "resources", [this](std::string const& obj) {
+            ResourceId const id = ResourceId::FromString(JsonField(obj, "id").c_str());
+            if (id.IsNull()) return;
+            for (std::string const& name : JsonStringArray(obj, "tags")) {
+                auto it = tag_by_name_.find(name);
+                if (it != tag_by_name_.end()) AddLocked(id, it->second);
+            }
+        });
+        return true;
+    }
+
+private:
+    void InitSystemTags() {
+        TagCategory& fallback = categories_[kDefaultCategory];
+        fallback.name = kDefaultCategory;
+        fallback.isSystemCategory = true;
+        TagCategory& types = categories_[kTypeCategory];
+        types.name = kTypeCategory;
+        types.description = "Resource type";
+        types.isSystemCategory = true;
+        type_tags_.clear();
+        for (std::size_t t = 0; t < static_cast<std::size_t>(ResourceType::_Count); ++t) {
+            type_tags_.push_back(CreateTagLocked(ResourceTypeToString(static_cast<ResourceType>(t)), kTypeCategory, true));
+        }
+    }
+
+    void ResetLocked() {
+        tags_.clear();
+        tag_by_name_.clear();
+        categories_.clear();
+        slot_of_.clear();
+        slot_ids_.clear();
+        free_slots_.clear();
+        live_.clear();
+        rows_.clear();
+        row_words_ = 1;
+        InitSystemTags();
+    }
+
+    TagRecord* Find(TagId id) {
+        return id != InvalidTagId && id <= tags_.size() && tags_[id - 1].alive ? &tags_[id - 1] : nullptr;
+    }
+
+    TagRecord const* Find(TagId id) const {
+        return id != InvalidTagId && id <= tags_.size() && tags_[id - 1].alive ? &tags_[id - 1] : nullptr;
+    }
+
+    TagId CreateTagLocked(std::string const& name, std::string const& category, bool system) {
+        if (name.empty() || tag_by_name_.count(name)) return InvalidTagId;
+        std::string const categoryName = category.empty() ? kDefaultCategory : category;
+        TagCategory& owner = categories_[categoryName];
+        owner.name = categoryName;
+        // IDs are never reused, so stale IDs of deleted tags stay invalid
+        TagRecord record;
+        record.alive = true;
+        record.info.id = tags_.size() + 1;
+        record.info.name = name;
+        record.info.displayName = name;
+        record.info.category = categoryName;
+        record.info.isSystemTag = system;
+        tags_.push_back(std::move(record));
+        TagId const id = tags_.size();
+        tag_by_name_[name] = id;
+        owner.tags.push_back(id);
+        // Keep every row wide enough for the new tag's bit
+        std::size_t const words = (id - 1) / kWordBits + 1;
+        if (words > row_words_) {
+            Bits widened(slot_ids_.size() * words, 0);
+            for (std::size_t slot = 0; slot < slot_ids_.size(); ++slot) {
+                std::copy_n(rows_.begin() + static_cast<std::ptrdiff_t>(slot * row_words_), row_words_,
+                            widened.begin() + static_cast<std::ptrdiff_t>(slot * words));
+            }
+            rows_.swap(widened);
+            row_words_ = words;
+        }
+        return id;
+    }
+
+    void DeleteTagLocked(TagRecord& tag) {
+        TagId const id = tag.info.id;
+        std::vector<std::uint32_t> slots;
+        for (std::size_t w = 0; w < tag.column.size(); ++w) {
+            for (std::uint64_t word = tag.column[w]; word; word &= word - 1) {
+                slots.push_back(static_cast<std::uint32_t>(w * kWordBits + CountTrailingZeros(word)));
+            }
+        }
+        for (std::uint32_t slot : slots) RemoveLocked(slot_ids_[slot], id);
+        // Children move up to the deleted tag's parent
+        for (TagId child : tag.children) {
+            tags_[child - 1].info.parentTag = tag.info.parentTag;
+            if (tag.info.parentTag != InvalidTagId) tags_[tag.info.parentTag - 1].children.push_back(child);
+        }
+        Unparent(tag);
+        auto category = categories_.find(tag.info.category);
+        if (category != categories_.end()) {
+            std::vector<TagId>& ids = category->second.tags;
+            ids.erase(std::remove(ids.begin(), ids.end(), id), ids.end());
+        }
+        tag_by_name_.erase(tag.info.name);
+        tag.alive = false;
+        tag.children.clear();
+        Bits().swap(tag.column);
+    }
+
+    void Unparent(TagRecord& tag) {
+        if (tag.info.parentTag == InvalidTagId) return;
+        std::vector<TagId>& siblings = tags_[tag.info.parentTag - 1].children;
+        siblings.erase(std::remove(siblings.begin(), siblings.end(), tag.info.id), siblings.end());
+        tag.info.parentTag = InvalidTagId;
+    }
+
+    std::uint64_t* Row(std::uint32_t slot) { return rows_.data() + slot * row_words_; }
+    std::uint64_t const* Row(std::uint32_t slot) const { return rows_.data() + slot * row_words_; }
+
+    bool RowHas(std::uint32_t slot, TagId id) const {
+        std::size_t const bit = id - 1;
+        return (Row(slot)[bit / kWordBits] >> (bit % kWordBits)) & 1u;
+    }
+
+    void RowTags(std::uint32_t slot, std::vector<TagId>& out) const {
+        out.clear();
+        std::uint64_t const* row = Row(slot);
+        for (std::size_t w = 0; w < row_words_; ++w) {
+            for (std::uint64_t word = row[w]; word; word &= word - 1) {
+                out.push_back(w * kWordBits + CountTrailingZeros(word) + 1);
+            }
+        }
+    }
+
+    bool AddLocked(ResourceId resourceId, TagId tagId) {
+        TagRecord* tag = Find(tagId);
+        if (!tag || resourceId.IsNull()) return false;
+        std::uint32_t slot;
+        auto it = slot_of_.find(resourceId);
+        if (it != slot_of_.end()) {
+            slot = it->second;
+            if (RowHas(slot, tagId)) return false;
+        } else {
+            if (!free_slots_.empty()) {
+                slot = free_slots_.back();
+                free_slots_.pop_back();
+                slot_ids_[slot] = resourceId;
+            } else {
+                slot = static_cast<std::uint32_t>(slot_ids_.size());
+                slot_ids_.push_back(resourceId);
+                rows_.resize(rows_.size() + row_words_, 0);
+            }
+            slot_of_.emplace(resourceId, slot);
+            SetBit(live_, slot);
+        }
+        std::size_t const bit = tagId - 1;
+        Row(slot)[bit / kWordBits] |= std::uint64_t(1) << (bit % kWordBits);
+        SetBit(tag->column, slot);
+        ++tag->info.resourceCount;
+        return true;
+    }
+
+    bool RemoveLocked(ResourceId resourceId, TagId tagId) {
+        TagRecord* tag = Find(tagId);
+        auto it = slot_of_.find(resourceId);
+        if (!tag || it == slot_of_.end() || !RowHas(it->second, tagId)) return false;
+        std::uint32_t const slot = it->second;
+        std::size_t const bit = tagId - 1;
+        Row(slot)[bit / kWordBits] &= ~(std::uint64_t(1) << (bit % kWordBits));
+        ClearBit(tag->column, slot);
+        --tag->info.resourceCount;
+        std::uint64_t const* row = Row(slot);
+        if (std::all_of(row, row + row_words_, [](std::uint64_t w) { return w == 0; })) {
+            // Untagged resources leave the index; the slot is reused
+            ClearBit(live_, slot);
+            slot_ids_[slot] = ResourceId();
+            free_slots_.push_back(slot);
+            slot_of_.erase(it);
+        }
+        return true;
+    }
+
+    /** OR the columns of a tag and all its descendants into acc. */
+    void OrSubtree(Bits& acc, TagRecord const& tag) const {
+        OrWords(acc, tag.column);
+        for (TagId child : tag.children) OrSubtree(acc, tags_[child - 1]);
+    }
+
+    void AndNotSubtree(Bits& acc, TagRecord const& tag) const {
+        AndNotWords(acc, tag.column);
+        for (TagId child : tag.children) AndNotSubtree(acc, tags_[child - 1]);
+    }
+
+    Bits Evaluate(ResourceTagQuery const& query) const {
+        std::size_t const words = live_.size();
+        Bits result;
+        bool seeded = false;
+        Bits scratch;
+        for (TagId id : query.required) {
+            TagRecord const* tag = Find(id);
+            if (!tag) return Bits();
+            Bits const* column = &tag->column;
+            if (!tag->children.empty()) {
+                scratch.assign(words, 0);
+                OrSubtree(scratch, *tag);
+                column = &scratch;
+            }
+            if (!seeded) {
+                result = *column;
+                result.resize(words, 0);
+                seeded = true;
+            } else {
+                AndWords(result, *column);
+            }
+        }
+        if (!query.any.empty()) {
+            Bits any(words, 0);
+            for (TagId id : query.any) {
+                if (TagRecord const* tag = Find(id)) OrSubtree(any, *tag);
+            }
+            if (seeded) {
+                AndWords(result, any);
+            } else {
+                result.swap(any);
+                seeded = true;
+            }
+        }
+        if (!seeded) result = live_;
+        for (TagId id : query.excluded) {
+            if (TagRecord const* tag = Find(id)) AndNotSubtree(result, *tag);
+        }
+        return result;
+    }
+
+    mutable std::mutex mutex_;
+    std::vector<TagRecord> tags_;  // Index is TagId - 1
+    std::unordered_map<std::string, TagId> tag_by_name_;
+    std::map<std::string, TagCategory> categories_;
+    std::vector<TagId> type_tags_;  // Indexed by ResourceType
+
+    // Resource slots and per-resource tag rows (row_words_ words per slot)
+    std::unordered_map<ResourceId, std::uint32_t> slot_of_;
+    std::vector<ResourceId> slot_ids_;
+    std::vector<std::uint32_t> free_slots_;
+    Bits live_;
+    Bits rows_;
+    std::size_t row_words_ = 1;
+
+    std::mutex streaming_mutex_;
+    IResourceManager* streaming_manager_ = nullptr;
+    std::unordered_map<ResourceId, StreamingHandle> streaming_handles_;
+};
+
+// Global tag manager instance (singleton pattern)
+static ResourceTagManagerImpl* g_resourceTagManager = nullptr;
+static std::mutex g_resourceTagManagerMutex;
+
+IResourceTagManager* GetResourceTagManager() {
+    std::lock_guard<std::mutex> lock(g_resourceTagManagerMutex);
+    if (!g_resourceTagManager) {
+        g_resourceTagManager = new ResourceTagManagerImpl();
+    }
+    return g_resourceTagManager;
+}
+
+}  // namespace resource
+}  // namespace te
@@ -0,0 +1,96 @@
+/**
+ * @file resource_test_fixture.h
+ * @brief Shared fixture for 013 unit tests that load manifest assets: a Mesh test resource,
+ *        asset/manifest setup and group completion pumping.
+ */
+#ifndef TE_RESOURCE_TESTS_RESOURCE_TEST_FIXTURE_H
+#define TE_RESOURCE_TESTS_RESOURCE_TEST_FIXTURE_H
+
+#include <te/resource/Resource.h>
+#include <te/resource/ResourceGroup.h>
+#include <te/resource/ResourceManager.h>
+#include <te/resource/ResourceManifest.h>
+#include <te/resource/ResourceTypes.h>
+#include <te/core/thread.h>
+#include <cassert>
+#include <chrono>
+#include <cstddef>
+#include <filesystem>
+#include <fstream>
+#include <string>
+#include <thread>
+
+namespace te {
+namespace resource {
+namespace test {
+
+namespace fs = std::filesystem;
+
+// Takes its ResourceId from the manifest storage path (<guid>/<name>.mesh); OnLoad adds
+// per-test behaviour before the file check
+class MeshTestResource : public IResource {
+public:
+    ResourceType GetResourceType() const override { return ResourceType::Mesh; }
+    ResourceId GetResourceId() const override { return id_; }
+    void Release() override { delete this; }
+    bool Load(char const* path, IResourceManager* manager) override {
+        fs::path const p(path);
+        id_ = ResourceId::FromString(p.parent_path().filename().string().c_str());
+        bool const loaded = OnLoad(p, manager);
+        return loaded && fs::exists(p);
+    }
+    bool OnConvertSourceFile(char const*, void** outData, std::size_t* outSize) override {
+        *outData = nullptr;
+        *outSize = 0;
+        return false;
+    }
+    void* OnCreateAssetDesc() override { return nullptr; }
+
+protected:
+    virtual bool OnLoad(fs::path const&, IResourceManager*) { return true; }
+
+    ResourceId id_;
+};
+
+// Adds a Mesh entry to the "main" repository and writes its <guid>/<name>.mesh file
+inline ResourceId AddAsset(fs::path const& root, ResourceManifest& manifest, char const* name,
+                           std::size_t bytes) {
+    ManifestEntry entry;
+    entry.guid = ResourceId::Generate();
+    entry.type = ResourceType::Mesh;
+    entry.repository = "main";
+    entry.displayName = name;
+    manifest.resources.push_back(entry);
+    fs::path const dir = root / "main" / "mesh" / entry.guid.ToString();
+    fs::create_directories(dir);
+    std::ofstream(dir / (std::string(name) + ".mesh"), std::ios::binary) << std::string(bytes, 'x');
+    return entry.guid;
+}
+
+struct GroupResult {
+    bool done = false;
+    std::size_t succeeded = 0;
+    std::size_t failed = 0;
+};
+
+inline void OnGroupLoaded(ResourceGroupId, std::size_t succeeded, std::size_t failed, void* user_data) {
+    auto* result = static_cast<GroupResult*>(user_data);
+    result->done = true;
+    result->succeeded = succeeded;
+    result->failed = failed;
+}
+
+// Completion callbacks run on the main thread
+inline void PumpUntil(GroupResult const& result) {
+    for (int i = 0; i < 5000 && !result.done; ++i) {
+        te::core::GetThreadPool()->ProcessMainThreadCallbacks();
+        std::this_thread::sleep_for(std::chrono::milliseconds(1));
+    }
+    assert(result.done);
+}
+
+}  // namespace test
+}  // namespace resource
+}  // namespace te
+
+#endif  // TE_RESOURCE_TESTS_RESOURCE_TEST_FIXTURE_H
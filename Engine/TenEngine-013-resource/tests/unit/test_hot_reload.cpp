@@ -0,0 +1,192 @@
+/**
+ * @file test_hot_reload.cpp
+ * @brief Unit tests for IFileWatcher and IHotReloadManager (contract: specs/_contracts/013-resource-ABI.md).
+ */
+
+#include <te/resource/ResourceHotReload.h>
+#include <te/resource/Resource.h>
+#include <te/resource/ResourceManager.h>
+#include <te/resource/ResourceTypes.h>
+#include <te/core/engine.h>
+#include <cassert>
+#include <chrono>
+#include <filesystem>
+#include <fstream>
+#include <string>
+#include <vector>
+
+using namespace te::resource;
+using namespace te::core;
+
+namespace fs = std::filesystem;
+
+namespace {
+
+// Counts loads so in-place reloads can be observed
+class CountingResource : public IResource {
+public:
+    ResourceType GetResourceType() const override { return ResourceType::Custom; }
+    ResourceId GetResourceId() const override { return id_; }
+    void Release() override {}
+    bool Load(char const* path, IResourceManager* manager) override {
+        (void)manager;
+        ++loadCount;
+        return fs::exists(path);
+    }
+    bool OnConvertSourceFile(char const*, void** outData, std::size_t* outSize) override {
+        *outData = nullptr;
+        *outSize = 0;
+        return false;
+    }
+    void* OnCreateAssetDesc() override { return nullptr; }
+
+    int loadCount = 0;
+
+private:
+    ResourceId id_ = ResourceId::Generate();
+};
+
+void WriteFile(fs::path const& path, char const* text) {
+    std::ofstream f(path, std::ios::binary | std::ios::trunc);
+    f << text;
+}
+
+std::vector<FileChangeEvent> WaitAndCollect(IFileWatcher* watcher) {
+    std::vector<FileChangeEvent> events;
+    HotReloadSubscriptionHandle sub = watcher->SubscribeToFileChanges(
+        [](FileChangeEvent const& e, void* user) { static_cast<std::vector<FileChangeEvent>*>(user)->push_back(e); },
+        &events);
+    if (watcher->WaitForEvents(std::chrono::milliseconds(2000))) {
+        watcher->ProcessPendingEvents();
+    }
+    watcher->UnsubscribeFromFileChanges(sub);
+    return events;
+}
+
+std::string Normalized(fs::path const& path) {
+    return fs::absolute(path).lexically_normal().generic_string();
+}
+
+}  // namespace
+
+int main() {
+    assert(Init(nullptr) == true);
+
+    fs::path const root = fs::temp_directory_path() / "te_resource_hot_reload_test";
+    fs::remove_all(root);
+    fs::create_directories(root / "sub");
+
+    // --- File watcher: coalescing, recursion, rename-into-place ---
+    IFileWatcher* watcher = CreateFileWatcher();
+    watcher->SetDebounceTime(std::chrono::milliseconds(50));
+    assert(watcher->AddWatchPath(root.string(), true));
+    assert(!watcher->AddWatchPath((root / "missing").string(), true));
+    watcher->Start();
+    assert(watcher->IsWatching());
+
+    // Create and several writes arrive as one Created event
+    WriteFile(root / "a.txt", "1");
+    WriteFile(root / "a.txt", "2");
+    WriteFile(root / "a.txt", "3");
+    std::vector<FileChangeEvent> events = WaitAndCollect(watcher);
+    assert(events.size() == 1);
+    assert(events[0].path == Normalized(root / "a.txt"));
+    assert(events[0].changeType == FileChangeType::Created);
+
+    // Existing subdirectory is watched
+    WriteFile(root / "sub" / "b.txt", "b");
+    events = WaitAndCollect(watcher);
+    assert(events.size() == 1 && events[0].path == Normalized(root / "sub" / "b.txt"));
+
+    // New subdirectory gets a watch; files inside are reported
+    fs::create_directories(root / "new" / "deep");
+    WriteFile(root / "new" / "deep" / "c.txt", "c");
+    events = WaitAndCollect(watcher);
+    bool sawDeep = false;
+    for (FileChangeEvent const& e : events) {
+        sawDeep = sawDeep || e.path == Normalized(root / "new" / "deep" / "c.txt");
+    }
+    assert(sawDeep);
+    WriteFile(root / "new" / "deep" / "c.txt", "c2");
+    events = WaitAndCollect(watcher);
+    assert(events.size() == 1 && events[0].changeType == FileChangeType::Modified);
+
+    // Safe-save: temp file renamed over the target reads as a change to the target
+    WriteFile(root / "a.txt.tmp", "4");
+    fs::rename(root / "a.txt.tmp", root / "a.txt");
+    events = WaitAndCollect(watcher);
+    assert(events.size() == 1 && events[0].path == Normalized(root / "a.txt"));
+    assert(events[0].changeType != FileChangeType::Deleted);
+
+    // Rename of an existing file
+    fs::rename(root / "sub" / "b.txt", root / "sub" / "b2.txt");
+    events = WaitAndCollect(watcher);
+    assert(events.size() == 1 && events[0].changeType == FileChangeType::Renamed);
+    assert(events[0].oldPath == Normalized(root / "sub" / "b.txt"));
+
+    fs::remove(root / "sub" / "b2.txt");
+    events = WaitAndCollect(watcher);
+    assert(events.size() == 1 && events[0].changeType == FileChangeType::Deleted);
+
+    watcher->Stop();
+    assert(!watcher->IsWatching());
+    delete watcher;
+
+    // --- Hot reload manager: per-frame batch with dependent fan-out ---
+    IResourceManager* manager = GetResourceManager();
+    manager->RegisterResourceFactory(ResourceType::Custom,
+                                     [](ResourceType) -> IResource* { return new CountingResource(); });
+    WriteFile(root / "base.asset", "base");
+    WriteFile(root / "user.asset", "user");
+    auto* base = static_cast<CountingResource*>(manager->LoadSync((root / "base.asset").string().c_str(), ResourceType::Custom));
+    auto* user = static_cast<CountingResource*>(manager->LoadSync((root / "user.asset").string().c_str(), ResourceType::Custom));
+    assert(base && user);
+    manager->SetDependencies(user->GetResourceId(), {base->GetResourceId()});
+    std::vector<ResourceId> deps;
+    assert(manager->GetDependencyTree(user->GetResourceId(), deps));
+    assert(deps.size() == 1 && deps[0] == base->GetResourceId());
+
+    IHotReloadManager* hotReload = GetHotReloadManager();
+    HotReloadConfig config = hotReload->GetConfig();
+    config.debounceTime = std::chrono::milliseconds(50);
+    hotReload->SetConfig(config);
+    hotReload->AddWatchPath(root.string(), true);
+
+    std::vector<ResourceId> reloaded;
+    HotReloadSubscriptionHandle sub = hotReload->SubscribeToHotReload(
+        [](ResourceId id, IResource*, IResource* newResource, void* user) {
+            assert(newResource != nullptr);
+            static_cast<std::vector<ResourceId>*>(user)->push_back(id);
+        },
+        &reloaded);
+
+    WriteFile(root / "base.asset", "base2");
+    assert(hotReload->GetFileWatcher()->WaitForEvents(std::chrono::milliseconds(2000)));
+    hotReload->ProcessPendingReloads(manager);
+    assert(reloaded.size() == 2);
+    assert(reloaded[0] == base->GetResourceId() && reloaded[1] == user->GetResourceId());
+    assert(base->loadCount == 2 && user->loadCount == 2);
+    assert(hotReload->GetTotalReloadCount() == 2 && hotReload->GetFailedReloadCount() == 0);
+
+    // Changes made while disabled are dropped
+    {
+        ScopedHotReloadDisable disable;
+        assert(!hotReload->IsEnabled());
+        WriteFile(root / "user.asset", "user2");
+        assert(hotReload->GetFileWatcher()->WaitForEvents(std::chrono::milliseconds(2000)));
+        hotReload->ProcessPendingReloads(manager);
+    }
+    assert(hotReload->IsEnabled());
+    assert(reloaded.size() == 2);
+
+    assert(hotReload->ReloadDependentResources(manager, base->GetResourceId()) == 1);
+    assert(reloaded.size() == 3 && reloaded[2] == user->GetResourceId());
+    hotReload->UnsubscribeFromHotReload(sub);
+    hotReload->GetFileWatcher()->Stop();
+
+    manager->Unload(user);
+    manager->Unload(base);
+    fs::remove_all(root);
+    Shutdown();
+    return 0;
+}
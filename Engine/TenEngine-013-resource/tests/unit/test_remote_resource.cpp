@@ -0,0 +1,296 @@
+/**
+ * @file test_remote_resource.cpp
+ * @brief Unit tests for IDownloadManager's content-addressed cache over a file-system provider
+ *        (contract: specs/_contracts/013-resource-ABI.md).
+ */
+
+#include <te/resource/RemoteResource.h>
+#include <te/core/engine.h>
+#include <te/core/thread.h>
+#include <algorithm>
+#include <atomic>
+#include <cassert>
+#include <chrono>
+#include <filesystem>
+#include <fstream>
+#include <map>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+
+using namespace te::resource;
+using namespace te::core;
+
+namespace fs = std::filesystem;
+
+namespace {
+
+// Wraps the file-system provider: counts reads, records offsets, can hold reads at a gate
+class GatedProvider : public IRemoteResourceProvider {
+public:
+    explicit GatedProvider(std::string const& root) : inner_(CreateFileSystemProvider("inner", root)) {}
+
+    std::string GetName() const override { return "gated"; }
+    std::string GetBaseUrl() const override { return inner_->GetBaseUrl(); }
+    bool IsAvailable() const override { return inner_->IsAvailable(); }
+    bool GetResourceUrl(std::string const& id, std::string& outUrl) override { return inner_->GetResourceUrl(id, outUrl); }
+    bool GetResourceInfo(std::string const& id, std::size_t& outSize, std::string& outHash,
+                         std::string& outVersion) override {
+        return inner_->GetResourceInfo(id, outSize, outHash, outVersion);
+    }
+    bool ResourceExists(std::string const& id) override { return inner_->ResourceExists(id); }
+    void GetAvailableResources(std::vector<std::string>& out) override { inner_->GetAvailableResources(out); }
+    bool ReadRange(std::string const& id, std::size_t offset, std::size_t maxBytes,
+                   std::vector<std::uint8_t>& outData) override {
+        int const now = ++current;
+        for (int peakSeen = peak.load(); now > peakSeen && !peak.compare_exchange_weak(peakSeen, now);) {
+        }
+        while (!gateOpen.load()) std::this_thread::sleep_for(std::chrono::milliseconds(1));
+        {
+            std::lock_guard<std::mutex> lock(mutex);
+            firstOffsets.emplace(id, offset);
+            ++reads[id];
+        }
+        bool const ok = inner_->ReadRange(id, offset, maxBytes, outData);
+        --current;
+        return ok;
+    }
+
+    int Reads(std::string const& id) {
+        std::lock_guard<std::mutex> lock(mutex);
+        return reads[id];
+    }
+    std::size_t FirstOffset(std::string const& id) {
+        std::lock_guard<std::mutex> lock(mutex);
+        return firstOffsets.count(id) ? firstOffsets[id] : ~std::size_t(0);
+    }
+
+    std::atomic<bool> gateOpen{true};
+    std::atomic<int> current{0};
+    std::atomic<int> peak{0};
+    std::mutex mutex;
+    std::map<std::string, int> reads;
+    std::map<std::string, std::size_t> firstOffsets;
+
+private:
+    std::unique_ptr<IRemoteResourceProvider> inner_;
+};
+
+struct Completion {
+    DownloadResult result;
+    std::string localPath;
+};
+
+std::mutex g_doneMutex;
+std::map<std::string, Completion> g_done;  // By resource ID ("" for batches)
+std::atomic<int> g_progressCalls{0};
+
+void OnDone(std::string const& resourceId, DownloadResult result, std::string const& localPath, void*) {
+    std::lock_guard<std::mutex> lock(g_doneMutex);
+    g_done[resourceId] = Completion{result, localPath};
+}
+
+void OnProgress(std::string const&, DownloadProgress const&, void*) { ++g_progressCalls; }
+
+Completion WaitFor(std::string const& resourceId) {
+    for (int i = 0; i < 5000; ++i) {
+        GetThreadPool()->ProcessMainThreadCallbacks();
+        {
+            std::lock_guard<std::mutex> lock(g_doneMutex);
+            auto it = g_done.find(resourceId);
+            if (it != g_done.end()) {
+                Completion const c = it->second;
+                g_done.erase(it);
+                return c;
+            }
+        }
+        std::this_thread::sleep_for(std::chrono::milliseconds(1));
+    }
+    assert(false && "download did not complete");
+    return Completion{};
+}
+
+void WriteFile(fs::path const& path, std::string const& content) {
+    fs::create_directories(path.parent_path());
+    std::ofstream(path, std::ios::binary) << content;
+}
+
+std::string ReadFile(std::string const& path) {
+    std::ifstream in(path, std::ios::binary);
+    return std::string(std::istreambuf_iterator<char>(in), std::istreambuf_iterator<char>());
+}
+
+std::string Pattern(char seed, std::size_t size) {
+    std::string s(size, '\0');
+    for (std::size_t i = 0; i < size; ++i) s[i] = static_cast<char>(seed + i % 23);
+    return s;
+}
+
+}  // namespace
+
+int main() {
+    assert(Init(nullptr) == true);
+
+    // --- Content hash ---
+    assert(ComputeContentHash("abc", 3) == "ba7816bf8f01cfea414140de5dae2223b00361a396177a9cb410ff61f20015ad");
+    assert(ComputeContentHash("", 0) == "e3b0c44298fc1c149afbf4c8996fb92427ae41e4649b934ca495991b7852b855");
+    std::string const longText(1000, 'a');
+    std::string const longHash = ComputeContentHash(longText.data(), longText.size());
+    assert(longHash == "41edece42d63e8d9bf515a9ba6932e1c20cbc9f5a5d134645adb5db1b9737ea3");
+
+    fs::path const base = fs::temp_directory_path() / "te_remote_resource_test";
+    fs::remove_all(base);
+    fs::path const remote = base / "remote";
+    fs::path const cache = base / "cache";
+    std::string const textureV1 = Pattern('a', 100000);
+    std::string const textureV2 = Pattern('b', 100000);
+    WriteFile(remote / "v1/texture.bin", textureV1);
+    WriteFile(remote / "v1/mesh.bin", Pattern('m', 70000));
+    WriteFile(remote / "v2/texture.bin", textureV2);
+    WriteFile(remote / "v2/mesh.bin", Pattern('m', 70000));  // Unchanged across versions
+    WriteFile(remote / "v1/sound.bin", Pattern('s', 30000));
+    WriteFile(remote / "v2/sound.bin", Pattern('s', 30000));
+    for (int i = 0; i < 5; ++i) WriteFile(remote / ("pack/item" + std::to_string(i) + ".bin"), Pattern('p' + i, 20000));
+    WriteFile(base / "secret.bin", "outside");
+
+    // --- File-system provider ---
+    auto fsProvider = CreateFileSystemProvider("disk", remote.string());
+    std::size_t size = 0;
+    std::string hash, version;
+    assert(fsProvider->IsAvailable() && fsProvider->ResourceExists("v1/texture.bin"));
+    assert(!fsProvider->ResourceExists("../secret.bin") && !fsProvider->ResourceExists("v1"));
+    assert(fsProvider->GetResourceInfo("v1/texture.bin", size, hash, version));
+    assert(size == textureV1.size() && hash == ComputeContentHash(textureV1.data(), textureV1.size()));
+    std::vector<std::uint8_t> range;
+    assert(fsProvider->ReadRange("v1/texture.bin", 99990, 64, range) && range.size() == 10);
+    assert(fsProvider->ReadRange("v1/texture.bin", 100000, 64, range) && range.empty());
+    std::vector<std::string> listed;
+    fsProvider->GetAvailableResources(listed);
+    assert(listed.size() == 11);
+
+    IDownloadManager* downloads = GetDownloadManager();
+    auto gatedOwned = std::make_unique<GatedProvider>(remote.string());
+    GatedProvider* gated = gatedOwned.get();
+    downloads->RegisterProvider(std::move(gatedOwned));
+    assert(downloads->GetProvider("gated") == gated);
+    assert(downloads->QueueDownload("v1/texture.bin", "", LoadPriority::Normal, OnDone) == nullptr);  // No cache yet
+
+    RemoteCacheConfig config;
+    config.cacheRoot = cache.string();
+    config.chunkSize = 16 * 1024;
+    config.maxConcurrentDownloads = 2;
+    assert(downloads->SetCacheConfig(config));
+
+    // --- Download, then dedup of unchanged content across versions ---
+    assert(downloads->QueueDownload("v1/mesh.bin", "", LoadPriority::Normal, OnDone, OnProgress));
+    Completion c = WaitFor("v1/mesh.bin");
+    assert(c.result == DownloadResult::Success && ReadFile(c.localPath) == Pattern('m', 70000));
+    assert(g_progressCalls.load() >= 5);
+    int const meshReads = gated->Reads("v2/mesh.bin");
+    fs::path const copy = base / "install" / "mesh.bin";
+    assert(downloads->QueueDownload("v2/mesh.bin", copy.string(), LoadPriority::Normal, OnDone));
+    c = WaitFor("v2/mesh.bin");
+    assert(c.result == DownloadResult::AlreadyExists && c.localPath == copy.string());
+    assert(gated->Reads("v2/mesh.bin") == meshReads && ReadFile(copy.string()) == Pattern('m', 70000));
+    assert(downloads->GetCacheUsage() == 70000);
+    assert(downloads->IsDownloaded("v1/mesh.bin") && downloads->IsDownloaded("v2/mesh.bin"));
+
+    // --- Resume a torn download from its partial file ---
+    std::string const textureHash = ComputeContentHash(textureV1.data(), textureV1.size());
+    WriteFile(cache / "partial" / (textureHash + ".part"), textureV1.substr(0, 40000));
+    assert(downloads->QueueDownload("v1/texture.bin", "", LoadPriority::Normal, OnDone));
+    c = WaitFor("v1/texture.bin");
+    assert(c.result == DownloadResult::Success && ReadFile(c.localPath) == textureV1);
+    assert(gated->FirstOffset("v1/texture.bin") == 40000);
+    assert(!fs::exists(cache / "partial" / (textureHash + ".part")));
+
+    // --- A corrupt partial fails verification and is discarded ---
+    std::string const textureV2Hash = ComputeContentHash(textureV2.data(), textureV2.size());
+    WriteFile(cache / "partial" / (textureV2Hash + ".part"), std::string(30000, 'x'));
+    assert(downloads->QueueDownload("v2/texture.bin", "", LoadPriority::Normal, OnDone));
+    assert(WaitFor("v2/texture.bin").result == DownloadResult::VerificationFailed);
+    assert(!downloads->IsDownloaded("v2/texture.bin"));
+    assert(downloads->QueueDownload("v2/texture.bin", "", LoadPriority::Normal, OnDone));
+    assert(WaitFor("v2/texture.bin").result == DownloadResult::Success);
+
+    // --- Integrity check on read; corrupt objects are removed ---
+    std::string path;
+    assert(downloads->GetLocalPath("v2/texture.bin", path) && downloads->VerifyResource("v2/texture.bin"));
+    std::ofstream(path, std::ios::binary | std::ios::app) << "tamper";
+    assert(!downloads->GetLocalPath("v2/texture.bin", path));
+    assert(!downloads->IsDownloaded("v2/texture.bin") && !fs::exists(path));
+
+    // --- Concurrency limit and shared in-flight fetches ---
+    gated->gateOpen.store(false);
+    gated->peak.store(0);
+    std::vector<std::string> items;
+    for (int i = 0; i < 5; ++i) {
+        items.push_back("pack/item" + std::to_string(i) + ".bin");
+        assert(downloads->QueueDownload(items.back(), "", LoadPriority::Normal, OnDone));
+    }
+    assert(downloads->QueueDownload("v2/texture.bin", "", LoadPriority::Low, OnDone));
+    assert(downloads->QueueDownload("v1/sound.bin", "", LoadPriority::Low, OnDone));
+    void* twin = downloads->QueueDownload("v2/sound.bin", "", LoadPriority::Low, OnDone);
+    std::this_thread::sleep_for(std::chrono::milliseconds(50));
+    std::vector<DownloadProgress> active;
+    downloads->GetActiveDownloads(active);
+    assert(active.size() == 8);
+    gated->gateOpen.store(true);
+    for (std::string const& item : items) assert(WaitFor(item).result == DownloadResult::Success);
+    assert(WaitFor("v2/texture.bin").result == DownloadResult::Success);
+    assert(WaitFor("v1/sound.bin").result == DownloadResult::Success);
+    assert(WaitFor("v2/sound.bin").result == DownloadResult::Success);
+    assert(gated->Reads("v2/sound.bin") == 0);  // Shared the v1 fetch
+    assert(gated->peak.load() <= 2);
+    DownloadProgress progress;
+    assert(!downloads->GetDownloadProgress(twin, progress));  // Finished downloads are no longer tracked
+
+    // --- Pause keeps the partial; resume continues; cancel ---
+    assert(downloads->DeleteDownloadedResource("v1/texture.bin"));
+    assert(!downloads->IsDownloaded("v1/texture.bin"));
+    gated->gateOpen.store(false);
+    void* paused = downloads->QueueDownload("v1/texture.bin", "", LoadPriority::High, OnDone);
+    std::this_thread::sleep_for(std::chrono::milliseconds(20));
+    downloads->PauseDownload(paused);
+    gated->gateOpen.store(true);
+    for (int i = 0; i < 5000; ++i) {
+        assert(downloads->GetDownloadProgress(paused, progress));
+        if (progress.state == DownloadState::Paused) break;
+        std::this_thread::sleep_for(std::chrono::milliseconds(1));
+    }
+    assert(progress.state == DownloadState::Paused && progress.downloadedBytes > 0);
+    assert(fs::exists(cache / "partial" / (textureHash + ".part")));
+    downloads->ResumeDownload(paused);
+    assert(WaitFor("v1/texture.bin").result == DownloadResult::Success);
+
+    assert(downloads->DeleteDownloadedResource("v1/texture.bin"));
+    gated->gateOpen.store(false);
+    void* cancelled = downloads->QueueDownload("v1/texture.bin", "", LoadPriority::High, OnDone);
+    downloads->CancelDownload(cancelled);
+    gated->gateOpen.store(true);
+    assert(WaitFor("v1/texture.bin").result == DownloadResult::Cancelled);
+
+    // --- Batch download into a directory ---
+    fs::path const batchDir = base / "batch";
+    assert(downloads->QueueBatchDownload({"v1/mesh.bin", "pack/item0.bin", "missing.bin"}, batchDir.string(),
+                                         LoadPriority::Normal, OnDone));
+    c = WaitFor("");
+    assert(c.result == DownloadResult::Failed && c.localPath == batchDir.string());
+    assert(ReadFile((batchDir / "mesh.bin").string()) == Pattern('m', 70000));
+    assert(ReadFile((batchDir / "item0.bin").string()) == Pattern('p', 20000));
+
+    // --- LRU eviction under the quota ---
+    std::size_t const usage = downloads->GetCacheUsage();
+    assert(usage == 70000 + 100000 + 30000 + 5 * 20000);
+    assert(downloads->GetLocalPath("pack/item0.bin", path));  // Most recently used
+    config.quotaBytes = 60000;
+    assert(downloads->SetCacheConfig(config));  // Rescan, as after a restart, then trim
+    assert(downloads->GetCacheUsage() == 20000 && downloads->TrimCache() == 0);
+    assert(downloads->IsDownloaded("pack/item0.bin") && downloads->GetLocalPath("pack/item0.bin", path));
+    assert(!downloads->IsDownloaded("v1/mesh.bin") && !downloads->IsDownloaded("v2/sound.bin"));
+
+    fs::remove_all(base);
+    Shutdown();
+    return 0;
+}
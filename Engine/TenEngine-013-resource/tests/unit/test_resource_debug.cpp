@@ -0,0 +1,193 @@
+/**
+ * @file test_resource_debug.cpp
+ * @brief Unit tests for the resource profiler, leak detector and visualizer (contract: specs/_contracts/013-resource-ABI.md).
+ */
+
+#include "resource_test_fixture.h"
+#include <te/resource/ResourceDebug.h>
+#include <te/core/engine.h>
+#include <cassert>
+#include <chrono>
+#include <string>
+#include <thread>
+#include <vector>
+
+using namespace te::resource;
+using namespace te::resource::test;
+using namespace te::core;
+
+namespace {
+
+ResourceId g_dependency;  // Loaded from inside "user"
+
+// Freed by the Release that follows its eviction from the cache
+class DebugTestResource : public MeshTestResource {
+public:
+    void Release() override {
+        if (manager_ && manager_->PeekCached(id_) == this) return;
+        if (dependency_) manager_->Unload(dependency_);
+        delete this;
+    }
+
+protected:
+    bool OnLoad(fs::path const& path, IResourceManager* manager) override {
+        manager_ = manager;
+        if (path.stem() == "user") {
+            dependency_ = manager->LoadSyncByGuid(g_dependency);
+            std::this_thread::sleep_for(std::chrono::milliseconds(5));
+        }
+        return true;
+    }
+
+private:
+    IResourceManager* manager_ = nullptr;
+    IResource* dependency_ = nullptr;
+};
+
+bool Contains(std::string const& text, std::string const& part) {
+    return text.find(part) != std::string::npos;
+}
+
+}  // namespace
+
+int main() {
+    assert(Init(nullptr) == true);
+
+    fs::path const root = fs::temp_directory_path() / "te_resource_debug_test";
+    fs::remove_all(root);
+    fs::create_directories(root / "main");
+    ResourceManifest manifest;
+    ResourceId const base = AddAsset(root, manifest, "base", 100);
+    ResourceId const user = AddAsset(root, manifest, "user", 20);
+    ResourceId const big = AddAsset(root, manifest, "big", 5000);
+    g_dependency = base;
+    assert(SaveManifest((root / "main" / "manifest.json").string().c_str(), manifest));
+
+    IResourceManager* manager = GetResourceManager();
+    manager->RegisterResourceFactory(ResourceType::Mesh,
+                                     [](ResourceType) -> IResource* { return new DebugTestResource(); });
+    manager->SetAssetRoot(root.string().c_str());
+    manager->LoadAllManifests();
+
+    IResourceDebugManager* debug = GetResourceDebugManager();
+    IResourceProfiler* profiler = debug->GetProfiler();
+    IResourceLeakDetector* leaks = debug->GetLeakDetector();
+    profiler->SetEnabled(true);
+    profiler->Reset();
+    leaks->SetEnabled(true);
+
+    // --- Profiler: timings, nested dependency time, cache hit/miss, resident memory ---
+    IResource* userRes = manager->LoadSyncByGuid(user);
+    IResource* bigRes = manager->LoadSyncByGuid(big);
+    IResource* userAgain = manager->LoadSyncByGuid(user);
+    assert(userRes && bigRes && userAgain == userRes);
+
+    ResourceSystemStats stats = profiler->GetSystemStats();
+    assert(stats.successfulLoads == 3 && stats.failedLoads == 0 && stats.activeAsyncLoads == 0);
+    assert(stats.cacheHits == 1 && stats.cacheMisses == 3);
+    assert(stats.totalCachedResources == 3 && stats.totalMemoryUsage == 5120 && stats.peakMemoryUsage == 5120);
+    assert(stats.maxLoadTimeMs >= 5.0);
+
+    ResourceProfileData data;
+    assert(profiler->GetProfileData(user, data));
+    assert(data.loadCount == 1 && data.dependencyCount == 1 && data.memorySize == 20);
+    assert(data.loadTimeMs >= 5.0 && data.dependencyLoadTimeMs > 0.0 && data.dependencyLoadTimeMs < data.loadTimeMs);
+    std::vector<ResourceProfileData> top;
+    profiler->GetSlowestLoads(1, top);
+    assert(top.size() == 1 && top[0].resourceId == user);
+    profiler->GetLargestResources(2, top);
+    assert(top.size() == 2 && top[0].resourceId == big && top[1].resourceId == base);
+    assert(profiler->GetResidentMemory(big) == 5000);
+
+    // Counters from several threads are all accounted for
+    std::vector<std::thread> workers;
+    for (int t = 0; t < 4; ++t) {
+        workers.emplace_back([profiler] {
+            for (int i = 0; i < 1000; ++i) profiler->RecordCacheHit(ResourceId());
+        });
+    }
+    for (std::thread& w : workers) w.join();
+    assert(profiler->GetSystemStats().cacheHits == 4001);
+
+    // --- Leak detector: handles acquired after the baseline ---
+    leaks->MarkBaseline();
+    manager->Unload(userAgain);
+    IResource* bigAgain = manager->LoadSyncByGuid(big);
+    std::vector<ResourceLeakInfo> found;
+    assert(leaks->DetectLeaks(manager, found) == 1);
+    assert(found[0].resourceId == big && found[0].refCount == 2 && Contains(found[0].path, "big.mesh"));
+    assert(leaks->DetectLeaksByType(manager, ResourceType::Texture, found) == 0);
+    manager->Unload(bigAgain);
+    manager->Unload(bigRes);
+    assert(manager->PeekCached(big) == nullptr && profiler->GetResidentMemory(big) == 0);
+    assert(leaks->DetectLeaks(manager, found) == 0);
+    std::vector<ResourceLeakInfo> tracked;
+    leaks->GetTrackedResources(tracked);
+    assert(tracked.size() == 2);  // user and its nested base
+
+    // --- Visualizer: dependency graph and memory breakdown ---
+    manager->SetDependencies(user, {base});
+    IResourceDebugVisualizer* visualizer = debug->GetVisualizer();
+    DependencyGraphData graph = visualizer->GetDependencyGraph(manager);
+    assert(graph.totalNodes == 3 && graph.totalEdges == 1 && graph.maxDepth == 1);
+    graph = visualizer->GetResourceDependencyGraph(manager, user, 10);
+    assert(graph.totalNodes == 2 && graph.nodes[0].resourceId == user && graph.nodes[1].dependents[0] == user);
+    std::string const dot = visualizer->ExportDependencyGraphDot(manager);
+    assert(Contains(dot, "\"" + user.ToString() + "\" -> \"" + base.ToString() + "\""));
+    std::string const json = visualizer->ExportDependencyGraphJson(manager);
+    assert(Contains(json, "{\"from\":\"" + user.ToString() + "\",\"to\":\"" + base.ToString() + "\"}"));
+    std::unordered_map<ResourceType, std::size_t> byType;
+    visualizer->GetMemoryByType(manager, byType);
+    assert(byType.size() == 1 && byType[ResourceType::Mesh] == 120);
+    std::unordered_map<std::string, std::size_t> byRepo;
+    visualizer->GetMemoryByRepository(manager, byRepo);
+    assert(byRepo.size() == 1 && byRepo["main"] == 120);
+
+    // --- Debug manager: report, log filtering, breakpoints ---
+    std::string const report = debug->GenerateReport(manager);
+    assert(Contains(report, "Slowest loads") && Contains(report, "Mesh: 120 B") && Contains(report, "main: 120 B"));
+    std::vector<std::string> logged;
+    debug->SetLogLevel(ResourceDebugLogLevel::Info);
+    void* sub = debug->SubscribeToLog(
+        [](ResourceDebugLogLevel, std::string const& message, void* user_data) {
+            static_cast<std::vector<std::string>*>(user_data)->push_back(message);
+        },
+        &logged);
+    debug->Log(ResourceDebugLogLevel::Info, "shown");
+    debug->Log(ResourceDebugLogLevel::Trace, "filtered");
+    debug->UnsubscribeFromLog(sub);
+    debug->Log(ResourceDebugLogLevel::Error, "unsubscribed");
+    assert(logged.size() == 1 && logged[0] == "shown");
+    debug->SetLoadBreakpoint(user);
+    assert(debug->ShouldBreakOnLoad(user, ResourceType::Mesh));
+    debug->ClearLoadBreakpoint(user);
+    assert(!debug->ShouldBreakOnLoad(user, ResourceType::Mesh));
+    debug->SetTypeBreakpoint(ResourceType::Texture);
+    assert(debug->ShouldBreakOnLoad(base, ResourceType::Texture));
+    debug->ClearTypeBreakpoint(ResourceType::Texture);
+
+    manager->Unload(userRes);  // Releases the nested base handle too
+    assert(manager->PeekCached(user) == nullptr && manager->PeekCached(base) == nullptr);
+    assert(profiler->GetSystemStats().totalMemoryUsage == 0);
+
+    // --- Offline report against the manifest ---
+    profiler->SetEnabled(false);
+    std::string offline;
+    assert(GenerateOfflineResourceReport(manager, root.string().c_str(), offline, 2));
+    assert(!profiler->IsEnabled());
+    assert(Contains(offline, "\"resources\":3,\"loaded\":3,\"failed\":0"));
+    assert(Contains(offline, "\"residentBytes\":5120"));
+    assert(Contains(offline, "\"memoryByType\":{\"Mesh\":5120}"));
+    assert(Contains(offline, "\"memoryByRepository\":{\"main\":5120}"));
+    assert(Contains(offline, "\"largest\":[{\"id\":\"" + big.ToString() + "\""));
+    assert(Contains(offline, "\"dependencyGraph\":{\"nodes\":["));
+    assert(manager->PeekCached(base) == nullptr && manager->PeekCached(user) == nullptr &&
+           manager->PeekCached(big) == nullptr);
+    std::string none;
+    assert(!GenerateOfflineResourceReport(manager, nullptr, none));
+
+    leaks->SetEnabled(false);
+    fs::remove_all(root);
+    Shutdown();
+    return 0;
+}
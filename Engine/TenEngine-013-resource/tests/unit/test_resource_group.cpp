@@ -0,0 +1,143 @@
+/**
+ * @file test_resource_group.cpp
+ * @brief Unit tests for ResourceGroup / IResourceGroupManager (contract: specs/_contracts/013-resource-ABI.md).
+ */
+
+#include "resource_test_fixture.h"
+#include <te/resource/ResourceGroup.h>
+#include <te/core/engine.h>
+#include <te/core/thread.h>
+#include <atomic>
+#include <cassert>
+#include <chrono>
+#include <map>
+#include <mutex>
+#include <string>
+#include <thread>
+
+using namespace te::resource;
+using namespace te::resource::test;
+using namespace te::core;
+
+namespace {
+
+std::mutex g_loadsMutex;
+std::map<std::string, int> g_loads;      // Load calls per display name
+std::atomic<bool> g_gateOpen{true};      // "slow" blocks in Load until opened
+
+class GroupTestResource : public MeshTestResource {
+protected:
+    bool OnLoad(fs::path const& path, IResourceManager*) override {
+        std::string const name = path.stem().string();
+        if (name == "slow") {
+            while (!g_gateOpen.load()) {
+                std::this_thread::sleep_for(std::chrono::milliseconds(1));
+            }
+        }
+        std::lock_guard<std::mutex> lock(g_loadsMutex);
+        ++g_loads[name];
+        return true;
+    }
+};
+
+int LoadCount(char const* name) {
+    std::lock_guard<std::mutex> lock(g_loadsMutex);
+    return g_loads[name];
+}
+
+}  // namespace
+
+int main() {
+    assert(Init(nullptr) == true);
+
+    fs::path const root = fs::temp_directory_path() / "te_resource_group_test";
+    fs::remove_all(root);
+    fs::create_directories(root / "main");
+    ResourceManifest manifest;
+    ResourceId const base = AddAsset(root, manifest, "base", 100);
+    ResourceId const a = AddAsset(root, manifest, "a", 10);
+    ResourceId const b = AddAsset(root, manifest, "b", 20);
+    ResourceId const d = AddAsset(root, manifest, "d", 40);
+    ResourceId const slow = AddAsset(root, manifest, "slow", 1);
+    assert(SaveManifest((root / "main" / "manifest.json").string().c_str(), manifest));
+
+    IResourceManager* manager = GetResourceManager();
+    manager->RegisterResourceFactory(ResourceType::Mesh,
+                                     [](ResourceType) -> IResource* { return new GroupTestResource(); });
+    manager->SetAssetRoot(root.string().c_str());
+    manager->LoadAllManifests();
+    manager->SetDependencies(a, {base});
+    manager->SetDependencies(b, {base});
+
+    IResourceGroupManager* groups = GetResourceGroupManager();
+    ResourceGroup* levelA = groups->CreateGroup("levelA");
+    assert(levelA && groups->CreateGroup("levelA") == nullptr);
+    levelA->AddResource(a);
+    levelA->AddResource(b);
+    ResourceGroup* levelB = groups->CreateGroup("levelB");
+    levelB->AddResource(b);
+    levelB->AddResource(d);
+
+    // --- Shared dependency of two members is loaded once ---
+    GroupResult resultA;
+    assert(groups->LoadGroupAsync("levelA", LoadPriority::High, OnGroupLoaded, &resultA));
+    assert(!groups->LoadGroupAsync("missing", LoadPriority::High, OnGroupLoaded, &resultA));
+    PumpUntil(resultA);
+    assert(resultA.succeeded == 3 && resultA.failed == 0);
+    assert(LoadCount("base") == 1 && LoadCount("a") == 1 && LoadCount("b") == 1);
+    ResourceGroupInfo info;
+    assert(groups->GetGroupInfo("levelA", info));
+    assert(info.isLoaded && !info.isLoading && info.loadedCount == 2 && info.progress == 1.0f);
+    assert(info.totalSize == 130 && info.loadedSize == 130);
+    assert(levelA->IsFullyLoaded(manager) && levelA->GetTotalMemoryUsage(manager) == 130);
+
+    // --- Overlapping group reuses resident resources ---
+    GroupResult resultB;
+    assert(levelB->LoadAllAsync(manager, LoadPriority::Normal, OnGroupLoaded, &resultB));
+    PumpUntil(resultB);
+    assert(resultB.succeeded == 3 && resultB.failed == 0);
+    assert(LoadCount("base") == 1 && LoadCount("b") == 1 && LoadCount("d") == 1);
+
+    // --- Unloading one group keeps what the other still holds ---
+    assert(groups->UnloadGroup("levelA") == 1);  // Only "a"
+    assert(manager->PeekCached(a) == nullptr);
+    assert(manager->PeekCached(base) != nullptr && manager->PeekCached(b) != nullptr);
+    assert(!levelA->IsFullyLoaded(manager));
+    assert(groups->UnloadGroup("levelB") == 3);
+    assert(manager->PeekCached(base) == nullptr && manager->PeekCached(d) == nullptr);
+
+    // --- An unloaded group loads again ---
+    GroupResult reload;
+    assert(levelA->LoadAllAsync(manager, LoadPriority::Normal, OnGroupLoaded, &reload));
+    PumpUntil(reload);
+    assert(reload.succeeded == 3 && LoadCount("base") == 2);
+    assert(levelA->UnloadAll(manager) == 3);
+
+    // --- Cancel: the completion callback reports the unfinished resource as failed ---
+    ResourceGroup* streaming = groups->CreateGroup("streaming");
+    streaming->AddResource(slow);
+    g_gateOpen.store(false);
+    GroupResult resultC;
+    assert(streaming->LoadAllAsync(manager, LoadPriority::Background, OnGroupLoaded, &resultC));
+    assert(streaming->IsLoading());
+    assert(groups->CancelGroupLoad("streaming"));
+    assert(resultC.done && resultC.succeeded == 0 && resultC.failed == 1);
+    assert(!streaming->IsLoading() && !groups->CancelGroupLoad("streaming"));
+    g_gateOpen.store(true);
+    assert(groups->GetGroupInfo("streaming", info) && info.failedCount == 1 && !info.isLoaded);
+
+    std::vector<std::string> names;
+    groups->GetAllGroupNames(names);
+    assert(names.size() == 3);
+    assert(groups->DestroyGroup("levelA") && groups->DestroyGroup("levelB") && groups->DestroyGroup("streaming", true));
+    assert(!groups->DestroyGroup("levelA"));
+
+    // Let the cancelled load finish before tearing down
+    for (int i = 0; i < 5000 && LoadCount("slow") == 0; ++i) {
+        std::this_thread::sleep_for(std::chrono::milliseconds(1));
+    }
+    GetThreadPool()->ProcessMainThreadCallbacks();
+    fs::remove_all(root);
+    Shutdown();
+    return 0;
+}
@@ -0,0 +1,168 @@
+/**
+ * @file test_resource_tag.cpp
+ * @brief Unit tests for IResourceTagManager queries and bulk operations (contract: specs/_contracts/013-resource-ABI.md).
+ */
+
+#include "resource_test_fixture.h"
+#include <te/resource/ResourceTag.h>
+#include <te/core/engine.h>
+#include <algorithm>
+#include <cassert>
+#include <string>
+#include <vector>
+
+using namespace te::resource;
+using namespace te::resource::test;
+using namespace te::core;
+
+namespace {
+
+bool SameSet(std::vector<ResourceId> a, std::vector<ResourceId> b) {
+    auto less = [](ResourceId const& x, ResourceId const& y) { return x.ToString() < y.ToString(); };
+    std::sort(a.begin(), a.end(), less);
+    std::sort(b.begin(), b.end(), less);
+    return a == b;
+}
+
+}  // namespace
+
+int main() {
+    assert(Init(nullptr) == true);
+
+    IResourceTagManager* tags = GetResourceTagManager();
+    assert(tags == GetResourceTagManager());
+
+    // --- Tags, categories and hierarchy ---
+    TagId const weapon = tags->CreateTag("Weapon", "Gameplay");
+    TagId const sword = tags->CreateTag("Sword", "Gameplay");
+    TagId const rare = tags->CreateTag("Rare", "");
+    TagId const interior = tags->CreateTag("Interior", "Environment");
+    assert(weapon != InvalidTagId && tags->CreateTag("Weapon", "") == InvalidTagId);
+    assert(tags->GetTagId("Sword") == sword);
+    TagInfo info;
+    assert(tags->GetTagInfo(rare, info) && info.category == "Default");
+    assert(tags->SetTagParent(sword, weapon) && !tags->SetTagParent(weapon, sword));
+    std::vector<TagInfo> infos;
+    tags->GetTagsByCategory("Gameplay", infos);
+    assert(infos.size() == 2);
+
+    // --- Bitset queries over more than one word of resources and tags ---
+    std::vector<ResourceId> ids;
+    for (int i = 0; i < 150; ++i) ids.push_back(ResourceId::Generate());
+    std::vector<TagId> filler;
+    for (int i = 0; i < 70; ++i) filler.push_back(tags->CreateTag("Filler" + std::to_string(i), "Filler"));
+    for (int i = 0; i < 150; ++i) {
+        if (i % 2 == 0) assert(tags->AddTagToResource(ids[i], weapon));
+        if (i % 3 == 0) assert(tags->AddTagToResource(ids[i], sword));
+        if (i % 5 == 0) assert(tags->AddTagToResourceByName(ids[i], "Rare"));
+        if (i % 7 == 0) assert(tags->AddTagToResource(ids[i], filler.back()));
+    }
+    assert(!tags->AddTagToResource(ids[0], weapon));
+    assert(tags->AddTagToResource(ids[149], interior));  // Added after the rows grew past 64 tags
+    assert(tags->GetTagInfo(weapon, info) && info.resourceCount == 75);
+
+    auto expect = [&ids](auto pred) {
+        std::vector<ResourceId> out;
+        for (int i = 0; i < 150; ++i) {
+            if (pred(i)) out.push_back(ids[i]);
+        }
+        return out;
+    };
+    std::vector<ResourceId> found;
+    tags->GetResourcesWithTag(sword, found);
+    assert(SameSet(found, expect([](int i) { return i % 3 == 0; })));
+    // Weapon includes its child Sword
+    tags->GetResourcesWithTag(weapon, found);
+    assert(SameSet(found, expect([](int i) { return i % 2 == 0 || i % 3 == 0; })));
+
+    ResourceTagQuery query;
+    query.required = {weapon, rare};
+    query.excluded = {sword};
+    tags->Query(query, found);
+    assert(SameSet(found, expect([](int i) { return (i % 2 == 0 || i % 3 == 0) && i % 5 == 0 && i % 3 != 0; })));
+    assert(tags->CountQuery(query) == found.size());
+    query = ResourceTagQuery();
+    query.any = {rare, filler.back()};
+    query.excluded = {weapon};
+    assert(tags->CountQuery(query) == expect([](int i) {
+        return (i % 5 == 0 || i % 7 == 0) && i % 2 != 0 && i % 3 != 0;
+    }).size());
+    query = ResourceTagQuery();
+    query.excluded = {weapon};
+    assert(tags->CountQuery(query) == expect([](int i) {
+        return i % 2 != 0 && i % 3 != 0 && (i % 5 == 0 || i % 7 == 0 || i == 149);
+    }).size());
+    query.required = {9999};
+    assert(tags->CountQuery(query) == 0);
+    tags->QueryResources({sword}, {}, {}, [&ids](ResourceId id) { return id == ids[0]; }, found);
+    assert(found.size() == 1 && found[0] == ids[0]);
+    assert(tags->ResourceHasTag(ids[6], sword) && tags->ResourceHasTagByName(ids[149], "Interior"));
+    tags->GetResourceTags(ids[0], infos);
+    assert(infos.size() == 4);
+
+    // --- Removal, deletion and rename ---
+    assert(tags->RemoveTagFromResource(ids[0], rare) && !tags->ResourceHasTag(ids[0], rare));
+    assert(tags->RemoveAllTagsFromResource(ids[0]) == 3);
+    tags->GetResourceTags(ids[0], infos);
+    assert(infos.empty());
+    assert(tags->RemoveTagFromResources(ids, filler.back()) == 21);
+    for (TagId id : filler) assert(tags->DeleteTag(id));
+    assert(!tags->GetTagInfo(filler[0], info) && tags->GetTagId("Filler0") == InvalidTagId);
+    assert(tags->RenameTag(rare, "Epic") && tags->GetTagId("Epic") == rare && tags->GetTagId("Rare") == InvalidTagId);
+
+    // --- Type tags are system tags ---
+    TagId const meshTag = tags->GetTypeTag(ResourceType::Mesh);
+    assert(meshTag != InvalidTagId && tags->GetTypeTag(ResourceType::_Count) == InvalidTagId);
+    assert(tags->GetTagInfo(meshTag, info) && info.isSystemTag && info.category == "Type" && info.name == "Mesh");
+    assert(!tags->DeleteTag(meshTag) && !tags->RenameTag(meshTag, "Meshes"));
+
+    // --- Save / load round trip ---
+    fs::path const root = fs::temp_directory_path() / "te_resource_tag_test";
+    fs::remove_all(root);
+    fs::create_directories(root / "main");
+    std::string const tagFile = (root / "tags.json").string();
+    query = ResourceTagQuery();
+    query.required = {weapon};
+    std::size_t const weaponCount = tags->CountQuery(query);
+    assert(tags->SaveToFile(tagFile.c_str()));
+    assert(tags->DeleteTag(weapon));
+    assert(tags->GetTagInfo(sword, info) && info.parentTag == InvalidTagId);
+    assert(tags->LoadFromFile(tagFile.c_str(), false));
+    TagId const loadedWeapon = tags->GetTagId("Weapon");
+    assert(tags->GetTagInfoByName("Sword", info) && info.parentTag == loadedWeapon && info.category == "Gameplay");
+    query.required = {loadedWeapon};
+    assert(tags->CountQuery(query) == weaponCount);
+    assert(tags->GetTypeTag(ResourceType::Mesh) != InvalidTagId);
+
+    // --- Bulk operations over query results ---
+    ResourceManifest manifest;
+    ResourceId const crate = AddAsset(root, manifest, "crate", 5);
+    ResourceId const barrel = AddAsset(root, manifest, "barrel", 6);
+    ResourceId const lamp = AddAsset(root, manifest, "lamp", 4);
+    assert(SaveManifest((root / "main" / "manifest.json").string().c_str(), manifest));
+    IResourceManager* manager = GetResourceManager();
+    manager->RegisterResourceFactory(ResourceType::Mesh,
+                                     [](ResourceType) -> IResource* { return new MeshTestResource(); });
+    manager->SetAssetRoot(root.string().c_str());
+    manager->LoadAllManifests();
+
+    assert(tags->TagResourcesByType(manager) == 3);
+    TagId const props = tags->CreateTag("Props", "Gameplay");
+    tags->AddTagToResources({crate, barrel}, props);
+    query = ResourceTagQuery();
+    query.required = {props, tags->GetTypeTag(ResourceType::Mesh)};
+    GroupResult result;
+    assert(tags->LoadTagged("props", query, LoadPriority::High, OnGroupLoaded, &result));
+    PumpUntil(result);
+    assert(result.succeeded == 2);
+    assert(manager->PeekCached(crate) && manager->PeekCached(barrel) && !manager->PeekCached(lamp));
+    assert(tags->SetTaggedPriority(manager, query, 10) == 2);
+    assert(tags->SetTaggedPriority(manager, query, 1) == 2);
+    assert(tags->UnloadTagged("props") == 2);
+    assert(!manager->PeekCached(crate) && !manager->PeekCached(barrel));
+    assert(GetResourceGroupManager()->GetGroup("props") == nullptr);
+
+    fs::remove_all(root);
+    Shutdown();
+    return 0;
+}
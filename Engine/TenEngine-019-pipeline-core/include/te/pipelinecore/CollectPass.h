@@ -12,21 +12,39 @@
 #include <te/pipelinecore/LogicalPipeline.h>
 #include <te/pipelinecore/RenderItem.h>
 
+#include <cstdint>
+
 namespace te::pipelinecore {
 
+/// Depth ordering for SortRenderItemsByDistance.
+enum class DepthSortOrder : uint32_t {
+  FrontToBack = 0,  ///< Nearest first; opaque objects (early depth rejection)
+  BackToFront,      ///< Farthest first; transparent objects (correct blending)
+};
+
 /// Multi-threaded collection of RenderItems from pipeline and scene.
-/// Results are written to out (should be pre-cleared).
+/// The chunks reported by ctx.scene (ISceneWorld::GetCollectChunkCount) are gathered on
+/// the collect workers into worker-local lists, then appended to out in chunk order, so
+/// the result does not depend on scheduling. Items of pipeline->GetSourceItemList()
+/// follow; pipeline may be null to collect the scene only. out is cleared first.
 void CollectRenderItemsParallel(ILogicalPipeline const* pipeline, FrameContext const& ctx,
                                 IRenderItemList* out);
 
+/// Number of worker threads CollectRenderItemsParallel uses besides the calling thread.
+/// Defaults to hardware concurrency - 1 (at most 7); 0 collects on the calling thread.
+void SetCollectWorkerCount(uint32_t count);
+uint32_t GetCollectWorkerCount();
+
 /// Merge multiple partial collection results into merged list.
 void MergeRenderItems(IRenderItemList const* const* partialLists, size_t count,
                      IRenderItemList* merged);
 
-/// Sort render items by distance from camera (for transparent object rendering).
+/// Sort render items by distance from camera (stable radix sort on the squared distance).
 /// @param list List to sort in-place
 /// @param cameraPosition Camera position as 3 floats (x, y, z)
-void SortRenderItemsByDistance(IRenderItemList* list, float const* cameraPosition);
+/// @param order FrontToBack for opaque, BackToFront (default) for transparent items
+void SortRenderItemsByDistance(IRenderItemList* list, float const* cameraPosition,
+                               DepthSortOrder order = DepthSortOrder::BackToFront);
 
 /// Frustum cull render items.
 /// @param input Input list of items
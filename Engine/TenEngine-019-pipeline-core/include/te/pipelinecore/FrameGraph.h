@@ -12,9 +12,19 @@ struct ICommandList;
 
 namespace te::pipelinecore {
 
-/// 场景世界最小接口；020/004 实现
+struct IRenderItemList;
+
+/// 场景世界最小接口；020 WorldSceneAdapter 实现（029 关卡）
 struct ISceneWorld {
   virtual ~ISceneWorld() = default;
+  /// 可并行收集的分块数（如空间单元或节点区间）；0 表示场景不提供渲染项
+  virtual size_t GetCollectChunkCount() const { return 0; }
+  /// 将第 chunkIndex 块的渲染项追加到 out；不同块可在不同工作线程上同时调用
+  virtual void CollectChunk(size_t chunkIndex, FrameContext const& ctx, IRenderItemList* out) const {
+    (void)chunkIndex;
+    (void)ctx;
+    (void)out;
+  }
 };
 
 /// 收集/剔除方式
@@ -88,7 +98,6 @@ struct IRenderObjectList {
   virtual size_t Size() const = 0;
 };
 
-struct IRenderItemList;
 struct ILightItemList;
 
 constexpr size_t kMaxPassContextRenderItemSlots = 4u;
@@ -114,6 +123,9 @@ struct PassContext {
 };
 
 /// Pass 执行回调：void (*)(PassContext& ctx, ICommandList* cmd)
+/// 并行录制时（020 RenderingConfig::enableMultithreadedRendering）在录制工作线程上与其他 Pass 并发调用：
+/// 只向 cmd 录制，可调用 IRenderMaterial::GetGraphicsPSO / GetDescriptorSet / GetUniformBufferOffset；
+/// 不可调用 IRenderMaterial::UpdateDeviceResource（须在 ExecutePasses 之前于渲染线程完成）
 using PassExecuteCallback = void (*)(PassContext& ctx, te::rhi::ICommandList* cmd);
 
 /// Pass 配置 Builder
@@ -201,7 +213,7 @@ struct IFrameGraph {
   /// 编译后可用；executionOrder 0 为第一个执行的 Pass
   virtual size_t GetPassCount() const = 0;
   virtual void GetPassCollectConfig(size_t executionOrder, PassCollectConfig* out) const = 0;
-  /// 按执行顺序调用指定 Pass 的 ExecuteCallback；020 在 Device 任务内按 GetPassCount 循环调用
+  /// 按执行顺序调用指定 Pass 的 ExecuteCallback；020 在 Device 任务内按 GetPassCount 循环调用，并行录制时在工作线程上调用
   virtual void ExecutePass(size_t executionOrder, PassContext& ctx, te::rhi::ICommandList* cmd) = 0;
 };
 
@@ -0,0 +1,113 @@
+/**
+ * @file ParallelRecord.h
+ * @brief 019-PipelineCore: Parallel command recording across frame-graph passes.
+ *
+ * Splits the compiled pass list (and large passes by draw range) into record chunks,
+ * records each chunk on a worker thread into its own command list, and returns the
+ * lists in compiled order so they can be submitted in sequence.
+ *
+ * Command lists are obtained through acquire/release callbacks so that 020 can plug in
+ * SubmitContext's per-frame pool (or any other pool) without 019 owning the device.
+ */
+
+#pragma once
+
+#include <te/pipelinecore/Config.h>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <memory>
+#include <vector>
+
+namespace te::rhi {
+struct ICommandList;
+}
+
+namespace te::pipelinecore {
+
+/// One unit of recording work: a whole pass or a draw range of a pass
+struct RecordChunk {
+  size_t executionOrder{0};   // Pass index in compiled (execution) order
+  size_t drawBegin{0};        // First draw of this chunk
+  size_t drawEnd{0};          // One past the last draw (drawBegin == drawEnd: no draws)
+  uint32_t chunkIndex{0};     // Index within the pass; 0 begins the pass
+  uint32_t chunkCount{1};     // Number of chunks the pass was split into
+
+  bool IsFirstInPass() const { return chunkIndex == 0; }
+  bool IsLastInPass() const { return chunkIndex + 1 == chunkCount; }
+};
+
+/// Split settings for BuildRecordChunks
+struct RecordSplitConfig {
+  size_t minDrawsPerChunk{256};   // Passes with fewer draws are never split
+  uint32_t maxChunksPerPass{8};   // Upper bound on chunks per pass
+};
+
+/**
+ * @brief Build record chunks in compiled order.
+ * @param passCount Number of passes (IFrameGraph::GetPassCount()).
+ * @param drawCounts Draw count per pass in execution order; may be null (no splitting).
+ * @param config Split settings.
+ * @param out Receives chunks ordered by (executionOrder, chunkIndex).
+ */
+void BuildRecordChunks(size_t passCount, size_t const* drawCounts,
+                       RecordSplitConfig const& config, std::vector<RecordChunk>& out);
+
+/// Acquire a command list for recording (called on the thread that calls Record)
+using AcquireCommandListCallback = std::function<rhi::ICommandList*()>;
+/// Return a command list that will not be submitted
+using ReleaseCommandListCallback = std::function<void(rhi::ICommandList*)>;
+/// Record one chunk into cmd; called on a worker thread, cmd is already begun
+using RecordChunkCallback = std::function<void(RecordChunk const& chunk, rhi::ICommandList* cmd)>;
+
+/**
+ * @brief ParallelCommandRecorder records chunks on persistent worker threads.
+ *
+ * Usage:
+ * 1. SetWorkerCount() / SetCommandListCallbacks()
+ * 2. BuildRecordChunks() from the compiled frame graph
+ * 3. Record() - one command list per chunk, returned in chunk (compiled) order
+ * 4. Submit the lists in order (e.g. SubmitContext::EnqueueCommandList)
+ *
+ * The calling thread participates in recording; with zero workers everything is
+ * recorded inline. Chunk callbacks must only touch per-chunk state. Command lists are
+ * recorded concurrently, so the backend must not share a command pool between them
+ * (the Vulkan backend gives every list its own VkCommandPool).
+ */
+class ParallelCommandRecorder {
+public:
+  ParallelCommandRecorder();
+  ~ParallelCommandRecorder();
+
+  ParallelCommandRecorder(ParallelCommandRecorder const&) = delete;
+  ParallelCommandRecorder& operator=(ParallelCommandRecorder const&) = delete;
+
+  /// Set number of worker threads in addition to the caller (0 = record inline)
+  void SetWorkerCount(uint32_t count);
+
+  /// Get number of worker threads
+  uint32_t GetWorkerCount() const;
+
+  /// Set command list acquire/release callbacks
+  void SetCommandListCallbacks(AcquireCommandListCallback acquire,
+                               ReleaseCommandListCallback release);
+
+  /**
+   * @brief Record all chunks in parallel.
+   * @param chunks Chunks from BuildRecordChunks.
+   * @param record Callback recording one chunk.
+   * @param outLists Receives one ended command list per chunk, in chunk order.
+   * @return false if a command list could not be acquired (nothing is recorded).
+   */
+  bool Record(std::vector<RecordChunk> const& chunks, RecordChunkCallback const& record,
+              std::vector<rhi::ICommandList*>& outLists);
+
+  /// Number of distinct threads that recorded at least one chunk in the last Record()
+  uint32_t GetLastThreadsUsed() const;
+
+private:
+  struct Impl;
+  std::unique_ptr<Impl> impl_;
+};
+
+}  // namespace te::pipelinecore
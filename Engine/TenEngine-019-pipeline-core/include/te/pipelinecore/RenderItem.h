@@ -46,6 +46,11 @@ struct IRenderItemList {
   virtual void Clear() = 0;
   virtual void Push(RenderItem const& item) = 0;
   virtual void Set(size_t i, RenderItem const& item) = 0;
+  /// 连续存储的首元素（空列表可为 nullptr）；用于批量读取与排序
+  virtual RenderItem const* Data() const = 0;
+  virtual void Reserve(size_t capacity) = 0;
+  /// 批量追加 count 个连续元素（合并分块结果时一次拷贝）
+  virtual void Append(RenderItem const* items, size_t count) = 0;
 };
 
 /// 灯光类型
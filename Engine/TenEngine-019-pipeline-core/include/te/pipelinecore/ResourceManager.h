@@ -6,7 +6,9 @@
  * - Transient resource allocation (frame-local textures/buffers)
  * - Automatic lifetime tracking based on pass dependencies
  * - Resource barrier building for state transitions
- * - Frame-pooled memory management (simplified, no aliasing for now)
+ * - Frame-pooled memory management with lifetime-based aliasing: transients whose
+ *   descriptors match and whose pass intervals do not overlap share one physical
+ *   RHI resource; physical resources are cached across frames by descriptor hash.
  */
 
 #pragma once
@@ -87,6 +89,18 @@ struct ResourceBarrier {
   uint32_t beforePass{0};                // Insert before this pass
 };
 
+/// Aliasing / pooling statistics for the current frame
+struct TransientPoolStats {
+  size_t requestedBytes{0};          // Sum of all realized transients (as if each had its own resource)
+  size_t allocatedBytes{0};          // Physical memory backing them this frame after aliasing
+  size_t savedBytes{0};              // requestedBytes - allocatedBytes
+  size_t cachedBytes{0};             // Physical memory retained by the pool across frames
+  uint32_t physicalTextureCount{0};  // Physical textures used this frame
+  uint32_t physicalBufferCount{0};   // Physical buffers used this frame
+  uint32_t aliasedResourceCount{0};  // Transients that reuse a physical resource of an earlier transient
+  uint32_t reusedFromCacheCount{0};  // Physical resources carried over from a previous frame
+};
+
 /// Callback for resource creation
 using CreateTextureCallback = std::function<rhi::ITexture*(TransientTextureDesc const&)>;
 using CreateBufferCallback = std::function<rhi::IBuffer*(TransientBufferDesc const&)>;
@@ -104,7 +118,14 @@ using CreateBufferCallback = std::function<rhi::IBuffer*(TransientBufferDesc con
  * 4. Compile() - Calculate lifetimes and barriers
  * 5. GetOrCreateResource() - Get actual RHI resource
  * 6. InsertBarriersForPass() - Insert barriers before pass execution
- * 7. EndFrame() - Release all resources
+ * 7. EndFrame() - Return physical resources to the cross-frame pool
+ *
+ * Aliasing: Compile() walks used transients in first-use order and assigns each to
+ * the first cached physical resource with an identical descriptor hash whose current
+ * frame interval has ended (first-fit over the lifetime interval graph). Barriers follow
+ * each transient's per-pass states, starting from the state the previous user of its
+ * physical resource ended in. Physical resources idle for more than SetMaxIdleFrames()
+ * frames are destroyed at EndFrame().
  */
 class TransientResourcePool {
 public:
@@ -127,9 +148,23 @@ public:
   /// Begin a new frame: reset pool state, prepare for new allocations
   void BeginFrame();
 
-  /// End frame: release all transient resources
+  /// End frame: drop transient handles, keep physical resources cached for reuse
   void EndFrame();
 
+  // === Aliasing / Pooling ===
+
+  /// Enable or disable lifetime-based aliasing (default: enabled)
+  void SetAliasingEnabled(bool enabled);
+
+  /// Frames a cached physical resource may stay unused before it is destroyed (default: 3)
+  void SetMaxIdleFrames(uint32_t frames);
+
+  /// Destroy all cached physical resources (e.g. on resize or device loss)
+  void ReleaseCachedResources();
+
+  /// Get aliasing statistics for the current frame
+  TransientPoolStats GetPoolStats() const;
+
   // === Resource Declaration ===
 
   /// Declare a transient texture; returns handle for reference
@@ -146,10 +181,10 @@ public:
 
   // === Usage Tracking ===
 
-  /// Mark resource as read by a pass (updates lifetime)
+  /// Mark resource as read by a pass (updates lifetime; ShaderResource in that pass)
   void MarkResourceRead(TransientResourceHandle handle, uint32_t passIndex);
 
-  /// Mark resource as written by a pass (updates lifetime)
+  /// Mark resource as written by a pass (updates lifetime; textures are RenderTarget in that pass)
   void MarkResourceWrite(TransientResourceHandle handle, uint32_t passIndex);
 
   /// Set explicit release point (resource can be freed after this pass)
@@ -197,7 +232,7 @@ public:
   /// Get total allocated buffer count this frame
   size_t GetAllocatedBufferSize() const;
 
-  /// Get total memory used (approximate, for profiling)
+  /// Get total physical memory used this frame after aliasing (approximate, for profiling)
   size_t GetTotalMemoryUsed() const;
 
   /// Set default dimensions (used when attachment width/height is 0)
@@ -38,14 +38,15 @@ enum class QueueId : uint8_t {
 /// Synchronization primitive type
 enum class SyncPrimitiveType : uint8_t {
   Fence,      // CPU-GPU sync
-  Semaphore   // GPU-GPU sync
+  Semaphore,  // GPU-GPU sync
+  Timeline    // GPU-GPU and CPU-GPU sync on a 64-bit counter; one object serves many submits
 };
 
 /**
  * @brief SyncPoint represents a synchronization point on the GPU timeline.
  *
- * Can be either a Fence (CPU waitable) or Semaphore (GPU waitable).
- * Used for frame synchronization and queue synchronization.
+ * Can be a Fence (CPU waitable), a binary Semaphore (GPU waitable) or a Timeline
+ * semaphore (both, waited per value). Used for frame synchronization and queue synchronization.
  */
 class SyncPoint {
 public:
@@ -63,13 +64,16 @@ public:
   /// Initialize as a semaphore (GPU-GPU sync)
   bool InitializeAsSemaphore(rhi::IDevice* device);
 
+  /// Initialize as a timeline semaphore; fails when the device has no timeline semaphores
+  bool InitializeAsTimeline(rhi::IDevice* device, uint64_t initialValue = 0);
+
   /// Check if initialized
   bool IsValid() const;
 
   /// Get the underlying fence (if fence type)
   rhi::IFence* GetFence() const;
 
-  /// Get the underlying semaphore (if semaphore type)
+  /// Get the underlying semaphore (if semaphore or timeline type)
   rhi::ISemaphore* GetSemaphore() const;
 
   /// Wait on CPU (fence only)
@@ -81,6 +85,15 @@ public:
   /// Reset fence for reuse
   void Reset();
 
+  /// Last value reached (timeline only)
+  uint64_t GetCompletedValue() const;
+
+  /// Wait on CPU until the counter reaches value (timeline only)
+  void Wait(uint64_t value);
+
+  /// Signal value from CPU (timeline only)
+  void Signal(uint64_t value);
+
   /// Get primitive type
   SyncPrimitiveType GetType() const;
 
@@ -92,7 +105,9 @@ private:
 /**
  * @brief QueueSyncPoint tracks synchronization between queues.
  *
- * Records which semaphore to wait on and signal for cross-queue dependencies.
+ * Records which semaphore to wait on and signal for cross-queue dependencies. With a
+ * timeline semaphore the producer signals signalValue and the consumer waits for waitValue,
+ * so the same semaphore orders any number of submissions without resets.
  */
 struct QueueSyncPoint {
   QueueId queue{QueueId::Graphics};
@@ -104,6 +119,9 @@ struct QueueSyncPoint {
 
 /**
  * @brief SubmitBatch represents a batch of command lists to submit together.
+ *
+ * Submitted as one queue submission: waits apply before the first list, signals and
+ * signalFence after the last.
  */
 struct SubmitBatch {
   QueueId queue{QueueId::Graphics};
@@ -154,17 +172,40 @@ public:
   /// End recording and add to pending batch
   void EndCommandList(rhi::ICommandList* cmd);
 
+  /// Acquire a pooled command list (not begun). Submitted lists return to the pool
+  /// once their frame slot fence has been waited in AdvanceFrame().
+  rhi::ICommandList* AcquireCommandList(QueueId queue);
+
+  /// Return an acquired command list that will not be submitted
+  void ReleaseCommandList(rhi::ICommandList* cmd);
+
+  /// Add an already ended command list to the pending batch of a queue (submitted in enqueue order)
+  void EnqueueCommandList(QueueId queue, rhi::ICommandList* cmd);
+
   // === Submission ===
 
-  /// Submit all pending command lists for a queue
+  /// Submit all pending command lists for a queue as one queue submission
   void SubmitQueue(QueueId queue);
 
   /// Submit all pending command lists for all queues
   void SubmitAll();
 
-  /// Submit a specific batch
+  /// Submit a specific batch as one queue submission
   void Submit(SubmitBatch const& batch);
 
+  /// Timeline semaphore signaled by every submission on queue; nullptr when the device
+  /// has no timeline semaphores (frame slots then fall back to fences)
+  rhi::ISemaphore* GetQueueTimeline(QueueId queue) const;
+
+  /// Value signaled by the latest submission on queue; waiting for it orders work after
+  /// everything submitted to that queue so far. Without a timeline the value counts
+  /// frame-fenced submissions instead
+  uint64_t GetQueueTimelineValue(QueueId queue) const;
+
+  /// Highest GetQueueTimelineValue the GPU has finished: read from the timeline, or from
+  /// the frame fences waited by AdvanceFrame / WaitForCurrentFrame / WaitQueueIdle
+  uint64_t GetQueueCompletedValue(QueueId queue) const;
+
   // === Synchronization ===
 
   /// Create a semaphore for queue synchronization
@@ -187,7 +228,7 @@ public:
 
   // === Frame Synchronization ===
 
-  /// Get current frame fence for a queue
+  /// Get current frame fence for a queue; AdvanceFrame waits on it, so the caller must signal it
   rhi::IFence* GetCurrentFrameFence(QueueId queue);
 
   /// Wait for current frame to complete on a queue
@@ -274,7 +315,9 @@ public:
 
   // === Execution ===
 
-  /// Execute all scheduled work
+  /// Execute all scheduled work. Queues that signal a sync point are submitted before the
+  /// queues waiting on it, then by priority; consecutive batches of a queue are coalesced
+  /// into one submission unless a later batch waits while an earlier one signals.
   void Execute();
 
   /// Wait for all work to complete
@@ -288,6 +331,9 @@ public:
   /// Get pending work count for a queue
   uint32_t GetPendingWorkCount(QueueId queue) const;
 
+  /// Queue submissions made by the last Execute()
+  uint32_t GetLastSubmissionCount() const;
+
 private:
   struct Impl;
   std::unique_ptr<Impl> impl_;
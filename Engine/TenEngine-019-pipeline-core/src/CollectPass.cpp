@@ -4,70 +4,159 @@
  */
 
 #include <te/pipelinecore/CollectPass.h>
+#include <te/pipelinecore/FrameGraph.h>
 #include <te/pipelinecore/RenderItem.h>
 #include <te/pipelinecore/LogicalPipeline.h>
 
+#include "ForkJoinPool.h"
+
+#include <algorithm>
 #include <cstring>
+#include <mutex>
 #include <thread>
 #include <vector>
 
 namespace te::pipelinecore {
 
-// Forward declaration - would be implemented in 029-world
-// This provides a loose coupling between 019-pipeline-core and 029-world
 namespace {
-  // Callback type for scene collection
-  using SceneCollectCallback = void(*)(void* userData, RenderItem const& item);
-  
-  // External function pointer that can be set by 020-pipeline
-  // This allows 019 to call into 029 without direct dependency
-  static void (*g_collectFromScene)(void* sceneData, SceneCollectCallback cb, void* userData) = nullptr;
-  
-  void SetSceneCollectFunction(void (*fn)(void*, SceneCollectCallback, void*)) {
-    g_collectFromScene = fn;
+
+// Scene chunks are grouped into at most this many batches per thread; each batch
+// has its own list, so lists stay bounded while work still balances dynamically
+constexpr size_t kBatchesPerThread = 4;
+
+/// Persistent collect workers with one render item list per batch
+class CollectWorkers {
+ public:
+  CollectWorkers() {
+    uint32_t const hardware = std::max(1u, std::thread::hardware_concurrency());
+    pool_.SetWorkerCount(std::min(hardware - 1, 7u));
+  }
+
+  ~CollectWorkers() {
+    for (IRenderItemList* list : batchLists_) DestroyRenderItemList(list);
+  }
+
+  CollectWorkers(CollectWorkers const&) = delete;
+  CollectWorkers& operator=(CollectWorkers const&) = delete;
+
+  void SetCount(uint32_t count) {
+    std::lock_guard<std::mutex> runLock(runMutex_);
+    pool_.SetWorkerCount(count);
+  }
+
+  uint32_t GetCount() {
+    std::lock_guard<std::mutex> runLock(runMutex_);
+    return pool_.GetWorkerCount();
+  }
+
+  /// Collect every chunk of scene and append the results to out in chunk order
+  void CollectScene(ISceneWorld const& scene, FrameContext const& ctx, size_t chunkCount,
+                    IRenderItemList* out) {
+    std::lock_guard<std::mutex> runLock(runMutex_);
+
+    size_t const maxBatches = (pool_.GetWorkerCount() + 1) * kBatchesPerThread;
+    size_t const batchCount = std::min(chunkCount, maxBatches);
+    while (batchLists_.size() < batchCount) batchLists_.push_back(CreateRenderItemList());
+
+    // Contiguous chunk ranges keep the merged order independent of scheduling
+    size_t const base = chunkCount / batchCount;
+    size_t const extra = chunkCount % batchCount;
+    pool_.Run(batchCount, [&](size_t batch) {
+      size_t const begin = batch * base + std::min(batch, extra);
+      size_t const end = begin + base + (batch < extra ? 1 : 0);
+      IRenderItemList* list = batchLists_[batch];
+      list->Clear();
+      for (size_t chunk = begin; chunk < end; ++chunk) {
+        scene.CollectChunk(chunk, ctx, list);
+      }
+    });
+
+    size_t total = out->Size();
+    for (size_t i = 0; i < batchCount; ++i) total += batchLists_[i]->Size();
+    out->Reserve(total);
+    for (size_t i = 0; i < batchCount; ++i) {
+      out->Append(batchLists_[i]->Data(), batchLists_[i]->Size());
+    }
   }
+
+ private:
+  std::mutex runMutex_;  // One collect at a time; guards batchLists_ and the pool
+  std::vector<IRenderItemList*> batchLists_;
+  detail::ForkJoinPool pool_;
+};
+
+CollectWorkers& GetCollectWorkers() {
+  static CollectWorkers workers;
+  return workers;
 }
 
-// Helper to collect items into a list
-struct CollectContext {
-  IRenderItemList* list;
-  size_t count{0};
+// === Depth sort ===
+
+constexpr uint32_t kRadixBits = 11;
+constexpr uint32_t kRadixSize = 1u << kRadixBits;
+constexpr uint32_t kRadixMask = kRadixSize - 1u;
+constexpr uint32_t kRadixPasses = 3;  // 11 + 11 + 10 bits cover a 32-bit key
+
+struct DepthSortScratch {
+  std::vector<uint32_t> keys;
+  std::vector<uint32_t> keysTmp;
+  std::vector<uint32_t> order;
+  std::vector<uint32_t> orderTmp;
+  std::vector<RenderItem> items;
+  uint32_t counts[kRadixPasses][kRadixSize];
 };
 
-static void CollectItemCallback(void* userData, RenderItem const& item) {
-  auto* ctx = static_cast<CollectContext*>(userData);
-  if (ctx && ctx->list) {
-    ctx->list->Push(item);
-    ctx->count++;
+/// Stable LSD radix sort of (keys, order) by key
+void RadixSortByKey(DepthSortScratch& s, size_t n) {
+  std::memset(s.counts, 0, sizeof(s.counts));
+  for (size_t i = 0; i < n; ++i) {
+    uint32_t const key = s.keys[i];
+    for (uint32_t p = 0; p < kRadixPasses; ++p) {
+      ++s.counts[p][(key >> (p * kRadixBits)) & kRadixMask];
+    }
+  }
+  for (uint32_t p = 0; p < kRadixPasses; ++p) {
+    uint32_t const shift = p * kRadixBits;
+    uint32_t* counts = s.counts[p];
+    // Every key shares this digit (e.g. distances within one exponent range): skip the pass
+    if (counts[(s.keys[0] >> shift) & kRadixMask] == n) continue;
+    uint32_t offset = 0;
+    for (uint32_t b = 0; b < kRadixSize; ++b) {
+      uint32_t const c = counts[b];
+      counts[b] = offset;
+      offset += c;
+    }
+    for (size_t i = 0; i < n; ++i) {
+      uint32_t const key = s.keys[i];
+      uint32_t const dst = counts[(key >> shift) & kRadixMask]++;
+      s.keysTmp[dst] = key;
+      s.orderTmp[dst] = s.order[i];
+    }
+    s.keys.swap(s.keysTmp);
+    s.order.swap(s.orderTmp);
   }
 }
 
+}  // namespace
+
+void SetCollectWorkerCount(uint32_t count) { GetCollectWorkers().SetCount(count); }
+
+uint32_t GetCollectWorkerCount() { return GetCollectWorkers().GetCount(); }
+
 void CollectRenderItemsParallel(ILogicalPipeline const* pipeline, FrameContext const& ctx,
                                 IRenderItemList* out) {
-  if (!pipeline || !out) return;
+  if (!out) return;
   out->Clear();
 
-  // Get scene data from pipeline if available
-  // The pipeline would have set up scene references during BuildLogicalPipeline
-  void* sceneData = nullptr;  // Would come from pipeline or frame context
-  
-  // If we have a scene collection function registered, use it
-  if (g_collectFromScene && sceneData) {
-    CollectContext collectCtx{out, 0};
-    g_collectFromScene(sceneData, CollectItemCallback, &collectCtx);
+  size_t const chunkCount = ctx.scene ? ctx.scene->GetCollectChunkCount() : 0;
+  if (chunkCount > 0) {
+    GetCollectWorkers().CollectScene(*ctx.scene, ctx, chunkCount, out);
   }
-  
-  // Alternative: iterate through pipeline's built-in render item sources
-  // This is a fallback for when scene integration is not set up
-  auto* sourceList = pipeline->GetSourceItemList();
-  if (sourceList) {
-    size_t n = sourceList->Size();
-    for (size_t i = 0; i < n; ++i) {
-      RenderItem const* r = sourceList->At(i);
-      if (r) {
-        out->Push(*r);
-      }
-    }
+
+  // Items supplied by the pipeline itself are appended with one bulk copy
+  IRenderItemList const* sourceList = pipeline ? pipeline->GetSourceItemList() : nullptr;
+  if (sourceList && sourceList->Size() > 0) {
+    out->Append(sourceList->Data(), sourceList->Size());
   }
 }
 
@@ -83,51 +172,51 @@ void MergeRenderItems(IRenderItemList const* const* partialLists, size_t count,
       total += partialLists[i]->Size();
     }
   }
+  merged->Reserve(total);
   
   // Merge all lists
   for (size_t i = 0; i < count; ++i) {
     if (!partialLists[i]) continue;
-    size_t n = partialLists[i]->Size();
-    for (size_t j = 0; j < n; ++j) {
-      RenderItem const* r = partialLists[i]->At(j);
-      if (r) merged->Push(*r);
-    }
+    merged->Append(partialLists[i]->Data(), partialLists[i]->Size());
   }
 }
 
-void SortRenderItemsByDistance(IRenderItemList* list, float const* cameraPosition) {
+void SortRenderItemsByDistance(IRenderItemList* list, float const* cameraPosition,
+                               DepthSortOrder order) {
   if (!list || !cameraPosition) return;
   
-  size_t n = list->Size();
-  if (n <= 1) return;
-  
-  // Simple bubble sort for now (could use std::sort with iterator support)
-  // Sort back-to-front for transparent objects, front-to-back for opaque
-  for (size_t i = 0; i < n - 1; ++i) {
-    for (size_t j = 0; j < n - i - 1; ++j) {
-      RenderItem const* a = list->At(j);
-      RenderItem const* b = list->At(j + 1);
-      if (!a || !b) continue;
-      
-      // Calculate distances from camera
-      float ax = a->worldMatrix[12] - cameraPosition[0];
-      float ay = a->worldMatrix[13] - cameraPosition[1];
-      float az = a->worldMatrix[14] - cameraPosition[2];
-      float distA = ax * ax + ay * ay + az * az;
-      
-      float bx = b->worldMatrix[12] - cameraPosition[0];
-      float by = b->worldMatrix[13] - cameraPosition[1];
-      float bz = b->worldMatrix[14] - cameraPosition[2];
-      float distB = bx * bx + by * by + bz * bz;
-      
-      // Swap if out of order (back to front for transparency)
-      if (distA < distB) {
-        RenderItem temp = *a;
-        list->Set(j, *b);
-        list->Set(j + 1, temp);
-      }
-    }
+  size_t const n = list->Size();
+  RenderItem const* items = list->Data();
+  if (n <= 1 || !items) return;
+
+  thread_local DepthSortScratch scratch;
+  scratch.keys.resize(n);
+  scratch.keysTmp.resize(n);
+  scratch.order.resize(n);
+  scratch.orderTmp.resize(n);
+
+  // Squared distances are non-negative, so their IEEE bit patterns order like the
+  // floats; inverting the key turns the ascending sort into back-to-front
+  uint32_t const flip = order == DepthSortOrder::BackToFront ? ~0u : 0u;
+  for (size_t i = 0; i < n; ++i) {
+    float const dx = items[i].worldMatrix[12] - cameraPosition[0];
+    float const dy = items[i].worldMatrix[13] - cameraPosition[1];
+    float const dz = items[i].worldMatrix[14] - cameraPosition[2];
+    float const dist = dx * dx + dy * dy + dz * dz;
+    uint32_t bits;
+    std::memcpy(&bits, &dist, sizeof(bits));
+    scratch.keys[i] = bits ^ flip;
+    scratch.order[i] = static_cast<uint32_t>(i);
   }
+
+  RadixSortByKey(scratch, n);
+
+  scratch.items.resize(n);
+  for (size_t i = 0; i < n; ++i) {
+    scratch.items[i] = items[scratch.order[i]];
+  }
+  list->Clear();
+  list->Append(scratch.items.data(), n);
 }
 
 void CullRenderItems(IRenderItemList const* input, 
@@ -138,11 +227,7 @@ void CullRenderItems(IRenderItemList const* input,
   
   if (!frustumPlanes) {
     // No frustum, copy all
-    size_t n = input->Size();
-    for (size_t i = 0; i < n; ++i) {
-      RenderItem const* r = input->At(i);
-      if (r) output->Push(*r);
-    }
+    output->Append(input->Data(), input->Size());
     return;
   }
   
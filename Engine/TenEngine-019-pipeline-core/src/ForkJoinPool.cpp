@@ -0,0 +1,88 @@
+/**
+ * @file ForkJoinPool.cpp
+ * @brief Implementation of the internal fork-join worker pool.
+ */
+
+#include "ForkJoinPool.h"
+
+namespace te::pipelinecore::detail {
+
+ForkJoinPool::~ForkJoinPool() {
+  Stop();
+}
+
+void ForkJoinPool::SetWorkerCount(uint32_t count) {
+  if (count == workers_.size()) return;
+  Stop();
+  stop_ = false;
+  workers_.reserve(count);
+  uint64_t const startGeneration = generation_;  // Do not pick up a past job
+  for (uint32_t i = 0; i < count; ++i) {
+    workers_.emplace_back([this, startGeneration]() { WorkerLoop(startGeneration); });
+  }
+}
+
+uint32_t ForkJoinPool::Run(size_t count, Job const& job) {
+  job_ = &job;
+  jobCount_ = count;
+  nextIndex_.store(0);
+  threadsUsed_.store(0);
+
+  bool const useWorkers = !workers_.empty() && count > 1;
+  if (useWorkers) {
+    {
+      std::lock_guard<std::mutex> lock(mutex_);
+      activeWorkers_ = static_cast<uint32_t>(workers_.size());
+      ++generation_;
+    }
+    wakeCv_.notify_all();
+  }
+
+  RunIndices();
+
+  if (useWorkers) {
+    std::unique_lock<std::mutex> lock(mutex_);
+    doneCv_.wait(lock, [&]() { return activeWorkers_ == 0; });
+  }
+  job_ = nullptr;
+  return threadsUsed_.load();
+}
+
+void ForkJoinPool::RunIndices() {
+  bool ran = false;
+  for (size_t i = nextIndex_.fetch_add(1); i < jobCount_; i = nextIndex_.fetch_add(1)) {
+    (*job_)(i);
+    ran = true;
+  }
+  if (ran) threadsUsed_.fetch_add(1);
+}
+
+void ForkJoinPool::WorkerLoop(uint64_t seen) {
+  for (;;) {
+    {
+      std::unique_lock<std::mutex> lock(mutex_);
+      wakeCv_.wait(lock, [&]() { return stop_ || generation_ != seen; });
+      if (stop_) return;
+      seen = generation_;
+    }
+    RunIndices();
+    {
+      std::lock_guard<std::mutex> lock(mutex_);
+      if (--activeWorkers_ == 0) doneCv_.notify_all();
+    }
+  }
+}
+
+void ForkJoinPool::Stop() {
+  {
+    std::lock_guard<std::mutex> lock(mutex_);
+    stop_ = true;
+  }
+  wakeCv_.notify_all();
+  for (auto& t : workers_) {
+    if (t.joinable()) t.join();
+  }
+  workers_.clear();
+}
+
+}  // namespace te::pipelinecore::detail
@@ -0,0 +1,65 @@
+/**
+ * @file ForkJoinPool.h
+ * @brief 019-PipelineCore internal: persistent fork-join workers shared by parallel
+ *        command recording and parallel render item collection.
+ */
+
+#pragma once
+
+#include <atomic>
+#include <condition_variable>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+namespace te::pipelinecore::detail {
+
+/**
+ * Persistent worker threads that run one index-range job at a time. The calling thread
+ * and the workers pull indices from a shared counter, so uneven items still balance;
+ * Run returns once every index has been processed. A job of one index runs inline
+ * without waking the workers.
+ *
+ * Not thread-safe: callers serialize Run and SetWorkerCount.
+ */
+class ForkJoinPool {
+ public:
+  using Job = std::function<void(size_t)>;
+
+  ForkJoinPool() = default;
+  ~ForkJoinPool();
+
+  ForkJoinPool(ForkJoinPool const&) = delete;
+  ForkJoinPool& operator=(ForkJoinPool const&) = delete;
+
+  /// Restart with count workers (0 = everything runs on the calling thread)
+  void SetWorkerCount(uint32_t count);
+  uint32_t GetWorkerCount() const { return static_cast<uint32_t>(workers_.size()); }
+
+  /// Run job(i) for every i in [0, count); returns the number of threads that ran an index
+  uint32_t Run(size_t count, Job const& job);
+
+ private:
+  void RunIndices();
+  void WorkerLoop(uint64_t seen);
+  void Stop();
+
+  std::vector<std::thread> workers_;
+  std::mutex mutex_;
+  std::condition_variable wakeCv_;
+  std::condition_variable doneCv_;
+  uint64_t generation_{0};
+  uint32_t activeWorkers_{0};
+  bool stop_{false};
+
+  // Current job (valid while a Run() call is in flight)
+  Job const* job_{nullptr};
+  size_t jobCount_{0};
+  std::atomic<size_t> nextIndex_{0};
+  std::atomic<uint32_t> threadsUsed_{0};
+};
+
+}  // namespace te::pipelinecore::detail
@@ -0,0 +1,120 @@
+/**
+ * @file ParallelRecord.cpp
+ * @brief Implementation of BuildRecordChunks and ParallelCommandRecorder.
+ */
+
+#include <te/pipelinecore/ParallelRecord.h>
+
+#include <te/rhi/command_list.hpp>
+
+#include "ForkJoinPool.h"
+
+#include <algorithm>
+
+namespace te::pipelinecore {
+
+// === Chunk building ===
+
+void BuildRecordChunks(size_t passCount, size_t const* drawCounts,
+                       RecordSplitConfig const& config, std::vector<RecordChunk>& out) {
+  out.clear();
+  out.reserve(passCount);
+
+  size_t const minDraws = std::max<size_t>(1, config.minDrawsPerChunk);
+  uint32_t const maxChunks = std::max(1u, config.maxChunksPerPass);
+
+  for (size_t pass = 0; pass < passCount; ++pass) {
+    size_t const draws = drawCounts ? drawCounts[pass] : 0;
+
+    uint32_t chunkCount = 1;
+    if (draws >= 2 * minDraws) {
+      chunkCount = static_cast<uint32_t>(std::min<size_t>(maxChunks, draws / minDraws));
+    }
+
+    // Distribute draws evenly; the first (draws % chunkCount) chunks take one extra
+    size_t const base = draws / chunkCount;
+    size_t const extra = draws % chunkCount;
+    size_t begin = 0;
+    for (uint32_t c = 0; c < chunkCount; ++c) {
+      RecordChunk chunk{};
+      chunk.executionOrder = pass;
+      chunk.drawBegin = begin;
+      chunk.drawEnd = begin + base + (c < extra ? 1 : 0);
+      chunk.chunkIndex = c;
+      chunk.chunkCount = chunkCount;
+      out.push_back(chunk);
+      begin = chunk.drawEnd;
+    }
+  }
+}
+
+// === ParallelCommandRecorder::Impl ===
+
+struct ParallelCommandRecorder::Impl {
+  AcquireCommandListCallback acquire;
+  ReleaseCommandListCallback release;
+
+  detail::ForkJoinPool pool;
+  uint32_t lastThreadsUsed{0};
+};
+
+// === ParallelCommandRecorder ===
+
+ParallelCommandRecorder::ParallelCommandRecorder()
+  : impl_(std::make_unique<Impl>()) {
+}
+
+ParallelCommandRecorder::~ParallelCommandRecorder() = default;
+
+void ParallelCommandRecorder::SetWorkerCount(uint32_t count) {
+  impl_->pool.SetWorkerCount(count);
+}
+
+uint32_t ParallelCommandRecorder::GetWorkerCount() const {
+  return impl_->pool.GetWorkerCount();
+}
+
+void ParallelCommandRecorder::SetCommandListCallbacks(AcquireCommandListCallback acquire,
+                                                      ReleaseCommandListCallback release) {
+  impl_->acquire = std::move(acquire);
+  impl_->release = std::move(release);
+}
+
+bool ParallelCommandRecorder::Record(std::vector<RecordChunk> const& chunks,
+                                     RecordChunkCallback const& record,
+                                     std::vector<rhi::ICommandList*>& outLists) {
+  outLists.clear();
+  impl_->lastThreadsUsed = 0;
+  if (chunks.empty() || !record) return true;
+  if (!impl_->acquire) return false;
+
+  // Acquire on the calling thread: pools and devices need not be thread-safe
+  outLists.reserve(chunks.size());
+  for (size_t i = 0; i < chunks.size(); ++i) {
+    rhi::ICommandList* cmd = impl_->acquire();
+    if (!cmd) {
+      if (impl_->release) {
+        for (rhi::ICommandList* acquired : outLists) impl_->release(acquired);
+      }
+      outLists.clear();
+      return false;
+    }
+    outLists.push_back(cmd);
+  }
+
+  // A single chunk is recorded inline without waking the workers
+  rhi::ICommandList* const* lists = outLists.data();
+  impl_->lastThreadsUsed = impl_->pool.Run(chunks.size(), [&](size_t i) {
+    rhi::ICommandList* cmd = lists[i];
+    cmd->Begin();
+    record(chunks[i], cmd);
+    cmd->End();
+  });
+  return true;
+}
+
+uint32_t ParallelCommandRecorder::GetLastThreadsUsed() const {
+  return impl_->lastThreadsUsed;
+}
+
+}  // namespace te::pipelinecore
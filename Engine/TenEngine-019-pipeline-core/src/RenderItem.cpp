@@ -24,6 +24,13 @@ class RenderItemListImpl : public IRenderItemList {
       items_[i] = item;
     }
   }
+  RenderItem const* Data() const override { return items_.data(); }
+  void Reserve(size_t capacity) override { items_.reserve(capacity); }
+  void Append(RenderItem const* items, size_t count) override {
+    if (items && count > 0) {
+      items_.insert(items_.end(), items, items + count);
+    }
+  }
 
  private:
   std::vector<RenderItem> items_;
@@ -18,11 +18,80 @@ namespace te::pipelinecore {
 
 // === TransientResourcePool::Impl ===
 
+namespace {
+
+constexpr uint32_t kNoSlot = 0xFFFFFFFF;
+constexpr uint32_t kWholeFrame = 0xFFFFFFFF;
+
+inline void HashCombine(uint64_t& h, uint64_t v) {
+  // FNV-1a style mix over 64-bit words
+  h ^= v;
+  h *= 1099511628211ull;
+}
+
+uint64_t HashTextureDesc(TransientTextureDesc const& d) {
+  uint64_t h = 14695981039346656037ull;
+  HashCombine(h, d.width);
+  HashCombine(h, d.height);
+  HashCombine(h, d.depth);
+  HashCombine(h, d.format);
+  HashCombine(h, d.mipLevels);
+  HashCombine(h, d.arrayLayers);
+  HashCombine(h, d.sampleCount);
+  return h;
+}
+
+uint64_t HashBufferDesc(TransientBufferDesc const& d) {
+  uint64_t h = 14695981039346656037ull;
+  HashCombine(h, static_cast<uint64_t>(d.size));
+  HashCombine(h, d.usage);
+  return h;
+}
+
+bool SameLayout(TransientTextureDesc const& a, TransientTextureDesc const& b) {
+  return a.width == b.width && a.height == b.height && a.depth == b.depth &&
+         a.format == b.format && a.mipLevels == b.mipLevels &&
+         a.arrayLayers == b.arrayLayers && a.sampleCount == b.sampleCount;
+}
+
+bool SameLayout(TransientBufferDesc const& a, TransientBufferDesc const& b) {
+  return a.size == b.size && a.usage == b.usage;
+}
+
+size_t EstimateTextureBytes(TransientTextureDesc const& d) {
+  size_t const pixelSize = 4; // Assume 4 bytes per pixel
+  size_t bytes = static_cast<size_t>(d.width) * d.height * d.depth * pixelSize;
+  bytes *= std::max(1u, d.arrayLayers) * std::max(1u, d.sampleCount);
+  if (d.mipLevels > 1) bytes += bytes / 3; // Full mip chain adds ~1/3
+  return bytes;
+}
+
+/// State a transient is in during one pass; a write in the same pass overrides a read
+struct PassUse {
+  uint32_t pass{0};
+  rhi::ResourceState state{rhi::ResourceState::Common};
+};
+
+void RecordUse(std::vector<PassUse>& uses, uint32_t pass, rhi::ResourceState state, bool write) {
+  for (PassUse& use : uses) {
+    if (use.pass != pass) continue;
+    if (write) use.state = state;
+    return;
+  }
+  uses.push_back({pass, state});
+}
+
+}  // namespace
+
 struct TextureEntry {
   TransientTextureDesc desc;
   rhi::ITexture* texture{nullptr};
   ResourceLifetimeInfo lifetime;
   bool created{false};
+  uint64_t descHash{0};
+  uint32_t slot{kNoSlot};            // Index into the physical slots for descHash
+  rhi::ResourceState srcState{rhi::ResourceState::Common};  // State before first use
+  std::vector<PassUse> uses;         // One per pass, sorted by Compile()
 };
 
 struct BufferEntry {
@@ -30,8 +99,27 @@ struct BufferEntry {
   rhi::IBuffer* buffer{nullptr};
   ResourceLifetimeInfo lifetime;
   bool created{false};
+  uint64_t descHash{0};
+  uint32_t slot{kNoSlot};
+  rhi::ResourceState srcState{rhi::ResourceState::Common};
+  std::vector<PassUse> uses;
 };
 
+/// Physical resource owned by the pool; shared by transients with disjoint lifetimes.
+template <typename DescT, typename ResourceT>
+struct PhysicalSlot {
+  DescT desc{};
+  ResourceT* resource{nullptr};
+  size_t sizeBytes{0};
+  uint64_t lastUsedFrame{0};         // Frame in which the slot was last assigned
+  uint64_t residentFrame{0};         // Frame in which the slot was last counted as allocated
+  uint32_t busyUntilPass{0};         // Last pass of the latest assignment in lastUsedFrame
+  rhi::ResourceState state{rhi::ResourceState::Common};  // State left by the previous user
+};
+
+using TextureSlot = PhysicalSlot<TransientTextureDesc, rhi::ITexture>;
+using BufferSlot = PhysicalSlot<TransientBufferDesc, rhi::IBuffer>;
+
 struct PassBarriers {
   std::vector<ResourceBarrier> barriers;
 };
@@ -53,23 +141,20 @@ struct TransientResourcePool::Impl {
 
   size_t totalMemoryUsed{0};
 
+  // Physical resources cached across frames, keyed by descriptor hash
+  std::unordered_map<uint64_t, std::vector<TextureSlot>> textureSlots;
+  std::unordered_map<uint64_t, std::vector<BufferSlot>> bufferSlots;
+  uint64_t frameIndex{1};
+  uint32_t maxIdleFrames{3};
+  bool aliasingEnabled{true};
+  TransientPoolStats stats;
+
   // Default dimensions for transient textures
   uint32_t defaultWidth_{800};
   uint32_t defaultHeight_{600};
 
+  /// Drop per-frame transient state; physical resources stay cached.
   void Reset() {
-    // Destroy all RHI resources
-    for (auto& pair : textures) {
-      if (pair.second.texture && device) {
-        device->DestroyTexture(pair.second.texture);
-      }
-    }
-    for (auto& pair : buffers) {
-      if (pair.second.buffer && device) {
-        device->DestroyBuffer(pair.second.buffer);
-      }
-    }
-
     textures.clear();
     buffers.clear();
     passBarriers.clear();
@@ -80,6 +165,96 @@ struct TransientResourcePool::Impl {
     isCompiled = false;
   }
 
+  size_t CachedBytes() const {
+    size_t bytes = 0;
+    for (auto const& pair : textureSlots)
+      for (auto const& slot : pair.second)
+        if (slot.resource) bytes += slot.sizeBytes;
+    for (auto const& pair : bufferSlots)
+      for (auto const& slot : pair.second)
+        if (slot.resource) bytes += slot.sizeBytes;
+    return bytes;
+  }
+
+  /// Destroy physical resources idle for more than maxIdleFrames (all when force is set).
+  void EvictSlots(bool force) {
+    auto idle = [&](uint64_t lastUsed) {
+      return force || frameIndex - lastUsed > maxIdleFrames;
+    };
+    for (auto it = textureSlots.begin(); it != textureSlots.end();) {
+      auto& slots = it->second;
+      slots.erase(std::remove_if(slots.begin(), slots.end(), [&](TextureSlot& slot) {
+        if (!idle(slot.lastUsedFrame)) return false;
+        if (slot.resource && device) device->DestroyTexture(slot.resource);
+        return true;
+      }), slots.end());
+      it = slots.empty() ? textureSlots.erase(it) : std::next(it);
+    }
+    for (auto it = bufferSlots.begin(); it != bufferSlots.end();) {
+      auto& slots = it->second;
+      slots.erase(std::remove_if(slots.begin(), slots.end(), [&](BufferSlot& slot) {
+        if (!idle(slot.lastUsedFrame)) return false;
+        if (slot.resource && device) device->DestroyBuffer(slot.resource);
+        return true;
+      }), slots.end());
+      it = slots.empty() ? bufferSlots.erase(it) : std::next(it);
+    }
+  }
+
+  /// First-fit: take the first compatible slot that is free for [firstPass, lastPass].
+  template <typename SlotT, typename DescT>
+  uint32_t AcquireSlot(std::vector<SlotT>& slots, DescT const& desc,
+                       uint32_t firstPass, uint32_t lastPass, bool& aliased) {
+    aliased = false;
+    for (uint32_t i = 0; i < slots.size(); ++i) {
+      SlotT& slot = slots[i];
+      if (!SameLayout(slot.desc, desc)) continue;  // Hash collision
+      bool const usedThisFrame = slot.lastUsedFrame == frameIndex;
+      if (usedThisFrame && (!aliasingEnabled || slot.busyUntilPass == kWholeFrame ||
+                            slot.busyUntilPass >= firstPass)) {
+        continue;
+      }
+      if (usedThisFrame) {
+        aliased = true;
+      } else if (slot.resource) {
+        ++stats.reusedFromCacheCount;
+      }
+      slot.lastUsedFrame = frameIndex;
+      slot.busyUntilPass = lastPass;
+      return i;
+    }
+    SlotT slot{};
+    slot.desc = desc;
+    slot.lastUsedFrame = frameIndex;
+    slot.busyUntilPass = lastPass;
+    slot.state = desc.initialState;
+    slots.push_back(slot);
+    return static_cast<uint32_t>(slots.size() - 1);
+  }
+
+  template <typename EntryT, typename SlotT>
+  void AssignSlot(EntryT& entry, std::vector<SlotT>& slots, uint32_t firstPass,
+                  uint32_t lastPass, rhi::ResourceState finalState) {
+    bool aliased = false;
+    entry.slot = AcquireSlot(slots, entry.desc, firstPass, lastPass, aliased);
+    SlotT& slot = slots[entry.slot];
+    // A reused physical resource is still in the state its previous user left it in,
+    // and the next user finds it in the state of this entry's last pass
+    entry.srcState = slot.state;
+    slot.state = finalState;
+    if (aliased) ++stats.aliasedResourceCount;
+  }
+
+  template <typename SlotT>
+  void MarkResident(SlotT& slot, size_t requestedBytes, uint32_t& physicalCount) {
+    stats.requestedBytes += requestedBytes;
+    if (slot.residentFrame == frameIndex) return;
+    slot.residentFrame = frameIndex;
+    totalMemoryUsed += slot.sizeBytes;
+    stats.allocatedBytes += slot.sizeBytes;
+    ++physicalCount;
+  }
+
   TextureEntry* FindTexture(uint64_t id) {
     auto it = textures.find(id);
     return it != textures.end() ? &it->second : nullptr;
@@ -93,22 +268,31 @@ struct TransientResourcePool::Impl {
   rhi::ITexture* CreateTexture(TextureEntry& entry) {
     if (entry.texture) return entry.texture;
 
-    if (createTextureCb) {
-      entry.texture = createTextureCb(entry.desc);
-    } else if (device) {
-      rhi::TextureDesc rhiDesc{};
-      rhiDesc.width = entry.desc.width;
-      rhiDesc.height = entry.desc.height;
-      rhiDesc.depth = entry.desc.depth;
-      rhiDesc.format = entry.desc.format;
-      entry.texture = device->CreateTexture(rhiDesc);
+    auto& slots = textureSlots[entry.descHash];
+    // Not scheduled by Compile(): hold an exclusive slot for the rest of the frame
+    if (entry.slot == kNoSlot) {
+      AssignSlot(entry, slots, 0, kWholeFrame, entry.desc.initialState);
+    }
+    TextureSlot& slot = slots[entry.slot];
+
+    if (!slot.resource) {
+      if (createTextureCb) {
+        slot.resource = createTextureCb(entry.desc);
+      } else if (device) {
+        rhi::TextureDesc rhiDesc{};
+        rhiDesc.width = entry.desc.width;
+        rhiDesc.height = entry.desc.height;
+        rhiDesc.depth = entry.desc.depth;
+        rhiDesc.format = entry.desc.format;
+        slot.resource = device->CreateTexture(rhiDesc);
+      }
+      slot.sizeBytes = slot.resource ? EstimateTextureBytes(entry.desc) : 0;
     }
 
+    entry.texture = slot.resource;
     if (entry.texture) {
       entry.created = true;
-      // Approximate memory usage
-      size_t pixelSize = 4; // Assume 4 bytes per pixel
-      totalMemoryUsed += entry.desc.width * entry.desc.height * entry.desc.depth * pixelSize;
+      MarkResident(slot, EstimateTextureBytes(entry.desc), stats.physicalTextureCount);
     }
 
     return entry.texture;
@@ -117,18 +301,28 @@ struct TransientResourcePool::Impl {
   rhi::IBuffer* CreateBuffer(BufferEntry& entry) {
     if (entry.buffer) return entry.buffer;
 
-    if (createBufferCb) {
-      entry.buffer = createBufferCb(entry.desc);
-    } else if (device) {
-      rhi::BufferDesc rhiDesc{};
-      rhiDesc.size = entry.desc.size;
-      rhiDesc.usage = entry.desc.usage;
-      entry.buffer = device->CreateBuffer(rhiDesc);
+    auto& slots = bufferSlots[entry.descHash];
+    if (entry.slot == kNoSlot) {
+      AssignSlot(entry, slots, 0, kWholeFrame, entry.desc.initialState);
+    }
+    BufferSlot& slot = slots[entry.slot];
+
+    if (!slot.resource) {
+      if (createBufferCb) {
+        slot.resource = createBufferCb(entry.desc);
+      } else if (device) {
+        rhi::BufferDesc rhiDesc{};
+        rhiDesc.size = entry.desc.size;
+        rhiDesc.usage = entry.desc.usage;
+        slot.resource = device->CreateBuffer(rhiDesc);
+      }
+      slot.sizeBytes = slot.resource ? entry.desc.size : 0;
     }
 
+    entry.buffer = slot.resource;
     if (entry.buffer) {
       entry.created = true;
-      totalMemoryUsed += entry.desc.size;
+      MarkResident(slot, entry.desc.size, stats.physicalBufferCount);
     }
 
     return entry.buffer;
@@ -144,6 +338,7 @@ TransientResourcePool::TransientResourcePool()
 TransientResourcePool::~TransientResourcePool() {
   if (impl_) {
     impl_->Reset();
+    impl_->EvictSlots(true);
   }
 }
 
@@ -171,10 +366,36 @@ void TransientResourcePool::SetCreateCallbacks(
 
 void TransientResourcePool::BeginFrame() {
   impl_->Reset();
+  ++impl_->frameIndex;
+  impl_->stats = TransientPoolStats{};
+  impl_->stats.cachedBytes = impl_->CachedBytes();
 }
 
 void TransientResourcePool::EndFrame() {
   impl_->Reset();
+  impl_->EvictSlots(false);
+  impl_->stats.cachedBytes = impl_->CachedBytes();
+}
+
+void TransientResourcePool::SetAliasingEnabled(bool enabled) {
+  impl_->aliasingEnabled = enabled;
+}
+
+void TransientResourcePool::SetMaxIdleFrames(uint32_t frames) {
+  impl_->maxIdleFrames = frames;
+}
+
+void TransientResourcePool::ReleaseCachedResources() {
+  impl_->Reset();
+  impl_->EvictSlots(true);
+  impl_->stats.cachedBytes = 0;
+}
+
+TransientPoolStats TransientResourcePool::GetPoolStats() const {
+  TransientPoolStats stats = impl_->stats;
+  stats.savedBytes = stats.requestedBytes > stats.allocatedBytes
+    ? stats.requestedBytes - stats.allocatedBytes : 0;
+  return stats;
 }
 
 TransientResourceHandle TransientResourcePool::DeclareTransientTexture(
@@ -191,6 +412,7 @@ TransientResourceHandle TransientResourcePool::DeclareTransientTexture(
   entry.lifetime.isUsed = false;
   entry.texture = nullptr;
   entry.created = false;
+  entry.descHash = HashTextureDesc(desc);
 
   impl_->textures[id] = std::move(entry);
 
@@ -211,6 +433,7 @@ TransientResourceHandle TransientResourcePool::DeclareTransientBuffer(
   entry.lifetime.isUsed = false;
   entry.buffer = nullptr;
   entry.created = false;
+  entry.descHash = HashBufferDesc(desc);
 
   impl_->buffers[id] = std::move(entry);
 
@@ -229,27 +452,34 @@ TransientBufferDesc const* TransientResourcePool::GetBufferDesc(
   return entry ? &entry->desc : nullptr;
 }
 
+namespace {
+
+template <typename EntryT>
+void MarkUse(EntryT* entry, uint32_t passIndex, rhi::ResourceState state, bool write) {
+  if (!entry) return;
+  entry->lifetime.firstUsePass = std::min(entry->lifetime.firstUsePass, passIndex);
+  entry->lifetime.lastUsePass = std::max(entry->lifetime.lastUsePass, passIndex);
+  entry->lifetime.isUsed = true;
+  RecordUse(entry->uses, passIndex, state, write);
+}
+
+}  // namespace
+
 void TransientResourcePool::MarkResourceRead(TransientResourceHandle handle, uint32_t passIndex) {
   if (handle.IsTexture()) {
-    auto* entry = impl_->FindTexture(handle.id);
-    if (entry) {
-      entry->lifetime.firstUsePass = std::min(entry->lifetime.firstUsePass, passIndex);
-      entry->lifetime.lastUsePass = std::max(entry->lifetime.lastUsePass, passIndex);
-      entry->lifetime.isUsed = true;
-    }
+    MarkUse(impl_->FindTexture(handle.id), passIndex, rhi::ResourceState::ShaderResource, false);
   } else {
-    auto* entry = impl_->FindBuffer(handle.id);
-    if (entry) {
-      entry->lifetime.firstUsePass = std::min(entry->lifetime.firstUsePass, passIndex);
-      entry->lifetime.lastUsePass = std::max(entry->lifetime.lastUsePass, passIndex);
-      entry->lifetime.isUsed = true;
-    }
+    MarkUse(impl_->FindBuffer(handle.id), passIndex, rhi::ResourceState::ShaderResource, false);
   }
 }
 
 void TransientResourcePool::MarkResourceWrite(TransientResourceHandle handle, uint32_t passIndex) {
-  // Write implies read for lifetime tracking
-  MarkResourceRead(handle, passIndex);
+  // Textures are written as render targets; buffers have no separate writable state
+  if (handle.IsTexture()) {
+    MarkUse(impl_->FindTexture(handle.id), passIndex, rhi::ResourceState::RenderTarget, true);
+  } else {
+    MarkUse(impl_->FindBuffer(handle.id), passIndex, rhi::ResourceState::ShaderResource, true);
+  }
 }
 
 void TransientResourcePool::ReleaseAfterPass(TransientResourceHandle handle, uint32_t passIndex) {
@@ -282,53 +512,72 @@ void TransientResourcePool::Compile() {
   // Initialize pass barriers
   impl_->passBarriers.resize(maxPass + 1);
 
-  // Generate barriers based on state transitions
-  // For each resource, insert barriers when state changes between passes
-  // This is a simplified version - full version would track actual state per pass
+  // Alias: assign used transients to physical slots in first-use order so that
+  // each slot is handed to the next compatible transient once its interval ends.
+  auto lifetimeEnd = [](ResourceLifetimeInfo const& lt) {
+    return lt.releasePass != 0xFFFFFFFF ? std::max(lt.lastUsePass, lt.releasePass) : lt.lastUsePass;
+  };
+  auto byFirstUse = [](auto const* a, auto const* b) {
+    if (a->lifetime.firstUsePass != b->lifetime.firstUsePass)
+      return a->lifetime.firstUsePass < b->lifetime.firstUsePass;
+    return a->lifetime.handle.id < b->lifetime.handle.id;
+  };
+
+  auto byPass = [](PassUse const& a, PassUse const& b) { return a.pass < b.pass; };
+  for (auto& pair : impl_->textures)
+    std::sort(pair.second.uses.begin(), pair.second.uses.end(), byPass);
+  for (auto& pair : impl_->buffers)
+    std::sort(pair.second.uses.begin(), pair.second.uses.end(), byPass);
+
+  std::vector<TextureEntry*> pendingTextures;
+  for (auto& pair : impl_->textures) {
+    if (pair.second.lifetime.isUsed && pair.second.slot == kNoSlot)
+      pendingTextures.push_back(&pair.second);
+  }
+  std::sort(pendingTextures.begin(), pendingTextures.end(), byFirstUse);
+  for (TextureEntry* entry : pendingTextures) {
+    impl_->AssignSlot(*entry, impl_->textureSlots[entry->descHash],
+                      entry->lifetime.firstUsePass, lifetimeEnd(entry->lifetime),
+                      entry->uses.back().state);
+  }
 
-  // Group barriers by pass
-  for (auto const& pair : impl_->textures) {
-    auto const& lifetime = pair.second.lifetime;
-    if (!lifetime.isUsed) continue;
+  std::vector<BufferEntry*> pendingBuffers;
+  for (auto& pair : impl_->buffers) {
+    if (pair.second.lifetime.isUsed && pair.second.slot == kNoSlot)
+      pendingBuffers.push_back(&pair.second);
+  }
+  std::sort(pendingBuffers.begin(), pendingBuffers.end(), byFirstUse);
+  for (BufferEntry* entry : pendingBuffers) {
+    impl_->AssignSlot(*entry, impl_->bufferSlots[entry->descHash],
+                      entry->lifetime.firstUsePass, lifetimeEnd(entry->lifetime),
+                      entry->uses.back().state);
+  }
 
-    // Initial transition to first use state
-    if (lifetime.firstUsePass <= maxPass) {
+  // Walk each transient's passes from the state its physical resource was left in and
+  // insert a barrier wherever the state changes
+  auto addBarriers = [&](auto const& entry) {
+    rhi::ResourceState state = entry.srcState;
+    for (PassUse const& use : entry.uses) {
+      if (use.state == state) continue;
       ResourceBarrier barrier{};
-      barrier.resource = lifetime.handle;
-      barrier.srcState = pair.second.desc.initialState;
-      // Assume first use is render target for textures
-      barrier.dstState = rhi::ResourceState::RenderTarget;
-      barrier.beforePass = lifetime.firstUsePass;
-
-      if (barrier.beforePass < impl_->passBarriers.size()) {
-        impl_->passBarriers[barrier.beforePass].barriers.push_back(barrier);
-        impl_->allBarriers.push_back(barrier);
-      }
+      barrier.resource = entry.lifetime.handle;
+      barrier.srcState = state;
+      barrier.dstState = use.state;
+      barrier.beforePass = use.pass;
+      impl_->passBarriers[use.pass].barriers.push_back(barrier);
+      impl_->allBarriers.push_back(barrier);
+      state = use.state;
     }
+  };
+  for (auto const& pair : impl_->textures) {
+    if (pair.second.lifetime.isUsed) addBarriers(pair.second);
   }
-
   for (auto const& pair : impl_->buffers) {
-    auto const& lifetime = pair.second.lifetime;
-    if (!lifetime.isUsed) continue;
-
-    // Initial transition
-    if (lifetime.firstUsePass <= maxPass) {
-      ResourceBarrier barrier{};
-      barrier.resource = lifetime.handle;
-      barrier.srcState = pair.second.desc.initialState;
-      // Assume first use is uniform buffer
-      barrier.dstState = rhi::ResourceState::ShaderResource;
-      barrier.beforePass = lifetime.firstUsePass;
-
-      if (barrier.beforePass < impl_->passBarriers.size()) {
-        impl_->passBarriers[barrier.beforePass].barriers.push_back(barrier);
-        impl_->allBarriers.push_back(barrier);
-      }
-    }
+    if (pair.second.lifetime.isUsed) addBarriers(pair.second);
   }
 
   // Sort barriers by pass
-  std::sort(impl_->allBarriers.begin(), impl_->allBarriers.end(),
+  std::stable_sort(impl_->allBarriers.begin(), impl_->allBarriers.end(),
     [](ResourceBarrier const& a, ResourceBarrier const& b) {
       return a.beforePass < b.beforePass;
     });
@@ -76,10 +76,21 @@ bool SyncPoint::InitializeAsSemaphore(rhi::IDevice* device) {
   return false;
 }
 
+bool SyncPoint::InitializeAsTimeline(rhi::IDevice* device, uint64_t initialValue) {
+  impl_->device = device;
+  impl_->type = SyncPrimitiveType::Timeline;
+
+  if (device) {
+    impl_->semaphore = device->CreateTimelineSemaphore(initialValue);
+    return impl_->semaphore != nullptr;
+  }
+  return false;
+}
+
 bool SyncPoint::IsValid() const {
   return impl_ && impl_->device &&
          ((impl_->type == SyncPrimitiveType::Fence && impl_->fence) ||
-          (impl_->type == SyncPrimitiveType::Semaphore && impl_->semaphore));
+          (impl_->type != SyncPrimitiveType::Fence && impl_->semaphore));
 }
 
 rhi::IFence* SyncPoint::GetFence() const {
@@ -108,6 +119,22 @@ void SyncPoint::Reset() {
   }
 }
 
+uint64_t SyncPoint::GetCompletedValue() const {
+  return impl_->semaphore ? impl_->semaphore->GetCompletedValue() : 0;
+}
+
+void SyncPoint::Wait(uint64_t value) {
+  if (impl_->semaphore && impl_->semaphore->IsTimeline()) {
+    impl_->semaphore->Wait(value);
+  }
+}
+
+void SyncPoint::Signal(uint64_t value) {
+  if (impl_->semaphore && impl_->semaphore->IsTimeline()) {
+    impl_->semaphore->Signal(value);
+  }
+}
+
 SyncPrimitiveType SyncPoint::GetType() const {
   return impl_->type;
 }
@@ -118,7 +145,13 @@ struct QueueData {
   rhi::IQueue* queue{nullptr};
   std::vector<rhi::ICommandList*> pendingCommands;
   std::vector<rhi::IFence*> frameFences;
+  std::vector<bool> frameFenceArmed;  // Per frame slot: fence signaled or handed to a submit since its last Reset
+  std::vector<std::vector<rhi::ICommandList*>> inFlightCommands;  // Per frame slot
   uint32_t currentFrameFence{0};
+  rhi::ISemaphore* timeline{nullptr};         // Signaled with ++timelineValue by every submission
+  uint64_t timelineValue{0};
+  std::vector<uint64_t> frameTimelineValues;  // Per frame slot: last value submitted in it
+  uint64_t completedValue{0};                 // Without a timeline: value of the last fence waited
 };
 
 struct SubmitContext::Impl {
@@ -126,6 +159,9 @@ struct SubmitContext::Impl {
   std::array<QueueData, static_cast<size_t>(QueueId::Count)> queues;
   uint32_t currentFrame{0};
   uint32_t framesInFlight{kMaxFramesInFlight};
+  std::vector<rhi::ICommandList*> freeCommands;  // Command lists ready for reuse
+  std::vector<rhi::SemaphoreSubmit> waits;       // Scratch for Submit()
+  std::vector<rhi::SemaphoreSubmit> signals;
 
   void InitQueues() {
     if (!device) return;
@@ -142,12 +178,44 @@ struct SubmitContext::Impl {
     // Create frame fences for each queue
     for (auto& qd : queues) {
       qd.frameFences.resize(framesInFlight);
+      qd.frameFenceArmed.assign(framesInFlight, true);
+      qd.inFlightCommands.resize(framesInFlight);
       for (uint32_t i = 0; i < framesInFlight; ++i) {
         qd.frameFences[i] = device->CreateFence(true);
       }
+      // Frame slots wait on timeline values when available; the fences stay for callers
+      // of GetCurrentFrameFence()
+      qd.timeline = device->CreateTimelineSemaphore(0);
+      qd.timelineValue = 0;
+      qd.frameTimelineValues.assign(framesInFlight, 0);
     }
   }
 
+  /// Issue one queue submission; adds the queue timeline signal and records the value for
+  /// the current frame slot (the frame fence is armed instead when there is no timeline)
+  void SubmitToQueue(QueueData& qd, rhi::ICommandList* const* lists, size_t count, rhi::IFence* fence,
+                     bool signalFrameFence) {
+    if (qd.timeline) {
+      signals.push_back({qd.timeline, ++qd.timelineValue});
+      qd.frameTimelineValues[qd.currentFrameFence] = qd.timelineValue;
+    } else if (signalFrameFence) {
+      fence = qd.frameFences[qd.currentFrameFence];
+      qd.frameFenceArmed[qd.currentFrameFence] = true;
+      qd.frameTimelineValues[qd.currentFrameFence] = ++qd.timelineValue;  // Reached when the fence is
+    }
+    rhi::SubmitInfo info{};
+    info.commandLists = lists;
+    info.commandListCount = static_cast<uint32_t>(count);
+    info.waits = waits.data();
+    info.waitCount = static_cast<uint32_t>(waits.size());
+    info.signals = signals.data();
+    info.signalCount = static_cast<uint32_t>(signals.size());
+    info.signalFence = fence;
+    qd.queue->Submit(info);
+    waits.clear();
+    signals.clear();
+  }
+
   void Cleanup() {
     if (!device) return;
 
@@ -157,11 +225,30 @@ struct SubmitContext::Impl {
       }
       qd.pendingCommands.clear();
 
+      for (auto& cmds : qd.inFlightCommands) {
+        for (auto* cmd : cmds) {
+          device->DestroyCommandList(cmd);
+        }
+        cmds.clear();
+      }
+
       for (auto* fence : qd.frameFences) {
         device->DestroyFence(fence);
       }
       qd.frameFences.clear();
+      qd.frameFenceArmed.clear();
+
+      if (qd.timeline) {
+        device->DestroySemaphore(qd.timeline);
+        qd.timeline = nullptr;
+      }
+      qd.frameTimelineValues.clear();
+    }
+
+    for (auto* cmd : freeCommands) {
+      device->DestroyCommandList(cmd);
     }
+    freeCommands.clear();
   }
 };
 
@@ -214,9 +301,7 @@ rhi::IQueue* SubmitContext::GetCopyQueue() {
 }
 
 rhi::ICommandList* SubmitContext::BeginCommandList(QueueId queue) {
-  if (!impl_->device) return nullptr;
-
-  auto* cmd = impl_->device->CreateCommandList();
+  auto* cmd = AcquireCommandList(queue);
   if (cmd) {
     cmd->Begin();
   }
@@ -231,6 +316,30 @@ void SubmitContext::EndCommandList(rhi::ICommandList* cmd) {
   }
 }
 
+rhi::ICommandList* SubmitContext::AcquireCommandList(QueueId /*queue*/) {
+  if (!impl_->device) return nullptr;
+
+  if (!impl_->freeCommands.empty()) {
+    auto* cmd = impl_->freeCommands.back();
+    impl_->freeCommands.pop_back();
+    return cmd;
+  }
+  return impl_->device->CreateCommandList();
+}
+
+void SubmitContext::ReleaseCommandList(rhi::ICommandList* cmd) {
+  if (cmd) {
+    impl_->freeCommands.push_back(cmd);
+  }
+}
+
+void SubmitContext::EnqueueCommandList(QueueId queue, rhi::ICommandList* cmd) {
+  size_t idx = static_cast<size_t>(queue);
+  if (cmd && idx < impl_->queues.size()) {
+    impl_->queues[idx].pendingCommands.push_back(cmd);
+  }
+}
+
 void SubmitContext::SubmitQueue(QueueId queue) {
   size_t idx = static_cast<size_t>(queue);
   if (idx >= impl_->queues.size() || !impl_->device) return;
@@ -238,15 +347,12 @@ void SubmitContext::SubmitQueue(QueueId queue) {
   auto& qd = impl_->queues[idx];
   if (!qd.queue || qd.pendingCommands.empty()) return;
 
-  // Submit each command list individually (API only takes single cmd)
-  auto* fence = qd.frameFences[qd.currentFrameFence];
-  for (size_t i = 0; i < qd.pendingCommands.size(); ++i) {
-    // Only signal fence on the last command
-    rhi::IFence* cmdFence = (i == qd.pendingCommands.size() - 1) ? fence : nullptr;
-    qd.queue->Submit(qd.pendingCommands[i], cmdFence, nullptr, nullptr);
-  }
+  // One submission for all pending lists: per-submit driver cost is paid once
+  impl_->SubmitToQueue(qd, qd.pendingCommands.data(), qd.pendingCommands.size(), nullptr, true);
 
-  // Clear pending (don't destroy - let frame tracking handle it)
+  // Keep submitted lists until this frame slot's fence is waited in AdvanceFrame()
+  auto& inFlight = qd.inFlightCommands[qd.currentFrameFence];
+  inFlight.insert(inFlight.end(), qd.pendingCommands.begin(), qd.pendingCommands.end());
   qd.pendingCommands.clear();
 }
 
@@ -261,34 +367,37 @@ void SubmitContext::Submit(SubmitBatch const& batch) {
   if (idx >= impl_->queues.size()) return;
 
   auto& qd = impl_->queues[idx];
-  if (!qd.queue || batch.commandLists.empty()) return;
+  // A batch without lists still submits its signals (e.g. to release a waiting queue)
+  if (!qd.queue || (batch.commandLists.empty() && batch.signalSyncs.empty() && !batch.signalFence)) return;
 
-  // Extract wait semaphores
-  rhi::ISemaphore* waitSem = nullptr;
   for (auto const& sync : batch.waitSyncs) {
     if (sync.waitSemaphore) {
-      waitSem = sync.waitSemaphore;
-      break;  // API only supports single wait semaphore
+      impl_->waits.push_back({sync.waitSemaphore, sync.waitValue});
     }
   }
-
-  // Extract signal semaphores
-  rhi::ISemaphore* signalSem = nullptr;
   for (auto const& sync : batch.signalSyncs) {
     if (sync.signalSemaphore) {
-      signalSem = sync.signalSemaphore;
-      break;  // API only supports single signal semaphore
+      impl_->signals.push_back({sync.signalSemaphore, sync.signalValue});
     }
   }
+  impl_->SubmitToQueue(qd, batch.commandLists.data(), batch.commandLists.size(), batch.signalFence, false);
+}
 
-  // Submit each command list individually (API only takes single cmd)
-  for (size_t i = 0; i < batch.commandLists.size(); ++i) {
-    // Only signal fence/semaphore on the last command
-    rhi::IFence* cmdFence = (i == batch.commandLists.size() - 1) ? batch.signalFence : nullptr;
-    rhi::ISemaphore* cmdWaitSem = (i == 0) ? waitSem : nullptr;
-    rhi::ISemaphore* cmdSignalSem = (i == batch.commandLists.size() - 1) ? signalSem : nullptr;
-    qd.queue->Submit(batch.commandLists[i], cmdFence, cmdWaitSem, cmdSignalSem);
-  }
+rhi::ISemaphore* SubmitContext::GetQueueTimeline(QueueId queue) const {
+  size_t idx = static_cast<size_t>(queue);
+  return idx < impl_->queues.size() ? impl_->queues[idx].timeline : nullptr;
+}
+
+uint64_t SubmitContext::GetQueueTimelineValue(QueueId queue) const {
+  size_t idx = static_cast<size_t>(queue);
+  return idx < impl_->queues.size() ? impl_->queues[idx].timelineValue : 0;
+}
+
+uint64_t SubmitContext::GetQueueCompletedValue(QueueId queue) const {
+  size_t idx = static_cast<size_t>(queue);
+  if (idx >= impl_->queues.size()) return 0;
+  auto const& qd = impl_->queues[idx];
+  return qd.timeline ? qd.timeline->GetCompletedValue() : qd.completedValue;
 }
 
 rhi::ISemaphore* SubmitContext::CreateSemaphore() {
@@ -315,6 +424,8 @@ void SubmitContext::WaitQueueIdle(QueueId queue) {
   auto* q = GetQueue(queue);
   if (q) {
     q->WaitIdle();
+    auto& qd = impl_->queues[static_cast<size_t>(queue)];
+    qd.completedValue = qd.timelineValue;
   }
 }
 
@@ -327,15 +438,26 @@ void SubmitContext::WaitAllIdle() {
 rhi::IFence* SubmitContext::GetCurrentFrameFence(QueueId queue) {
   size_t idx = static_cast<size_t>(queue);
   if (idx < impl_->queues.size()) {
-    return impl_->queues[idx].frameFences[impl_->queues[idx].currentFrameFence];
+    // The caller signals it through its own submit, so AdvanceFrame must wait on it
+    auto& qd = impl_->queues[idx];
+    qd.frameFenceArmed[qd.currentFrameFence] = true;
+    return qd.frameFences[qd.currentFrameFence];
   }
   return nullptr;
 }
 
 void SubmitContext::WaitForCurrentFrame(QueueId queue) {
+  size_t idx = static_cast<size_t>(queue);
+  if (idx < impl_->queues.size() && impl_->queues[idx].timeline) {
+    auto& qd = impl_->queues[idx];
+    qd.timeline->Wait(qd.frameTimelineValues[qd.currentFrameFence]);
+    return;
+  }
   auto* fence = GetCurrentFrameFence(queue);
   if (fence) {
     fence->Wait();
+    auto& qd = impl_->queues[idx];
+    qd.completedValue = std::max(qd.completedValue, qd.frameTimelineValues[qd.currentFrameFence]);
   }
 }
 
@@ -343,9 +465,22 @@ void SubmitContext::AdvanceFrame() {
   // Wait for oldest frame to complete
   uint32_t oldestFrame = (impl_->currentFrame + 1) % impl_->framesInFlight;
   for (auto& qd : impl_->queues) {
-    if (qd.frameFences[oldestFrame]) {
+    if (qd.timeline && qd.frameTimelineValues[oldestFrame] > 0) {
+      qd.timeline->Wait(qd.frameTimelineValues[oldestFrame]);
+    }
+    // A slot with no submission on this queue was never re-signaled after its Reset; waiting
+    // on it would block forever
+    if (qd.frameFences[oldestFrame] && qd.frameFenceArmed[oldestFrame]) {
       qd.frameFences[oldestFrame]->Wait();
       qd.frameFences[oldestFrame]->Reset();
+      qd.frameFenceArmed[oldestFrame] = false;
+      qd.completedValue = std::max(qd.completedValue, qd.frameTimelineValues[oldestFrame]);
+    }
+    // GPU is done with the lists submitted in that slot: recycle them
+    if (oldestFrame < qd.inFlightCommands.size()) {
+      auto& done = qd.inFlightCommands[oldestFrame];
+      impl_->freeCommands.insert(impl_->freeCommands.end(), done.begin(), done.end());
+      done.clear();
     }
   }
 
@@ -381,10 +516,92 @@ struct MultiQueueScheduler::Impl {
   std::array<QueueWork, static_cast<size_t>(QueueId::Count)> queueWork;
   SubmitContext submitCtx;
 
-  // Semaphores for cross-queue sync
+  // Semaphores for cross-queue sync: timelines when supported, each with its last reserved value
   rhi::ISemaphore* computeToGraphicsSem{nullptr};
   rhi::ISemaphore* copyToGraphicsSem{nullptr};
   rhi::ISemaphore* copyToComputeSem{nullptr};
+  uint64_t computeToGraphicsValue{0};
+  uint64_t copyToGraphicsValue{0};
+  uint64_t copyToComputeValue{0};
+
+  SubmitBatch merged;  // Scratch for coalescing in Execute()
+  uint32_t lastSubmissionCount{0};
+
+  rhi::ISemaphore* CreateCrossQueueSemaphore() {
+    rhi::ISemaphore* sem = device->CreateTimelineSemaphore(0);
+    return sem ? sem : device->CreateSemaphore();
+  }
+
+  static QueueSyncPoint MakeSync(QueueId producer, rhi::ISemaphore* sem, uint64_t& counter) {
+    QueueSyncPoint sync{};
+    sync.queue = producer;
+    sync.signalSemaphore = sem;
+    sync.waitSemaphore = sem;
+    // The same point goes into the producer's signals and the consumer's waits
+    sync.signalValue = ++counter;
+    sync.waitValue = sync.signalValue;
+    return sync;
+  }
+
+  /// True when queue a signals a semaphore that queue b waits on
+  bool Feeds(size_t a, size_t b) const {
+    for (auto const& wb : queueWork[b].batches) {
+      for (auto const& wait : wb.waitSyncs) {
+        for (auto const& sb : queueWork[a].batches) {
+          for (auto const& signal : sb.signalSyncs) {
+            if (wait.waitSemaphore && signal.signalSemaphore == wait.waitSemaphore) {
+              return true;
+            }
+          }
+        }
+      }
+    }
+    return false;
+  }
+
+  /// Producers before their consumers, otherwise by priority (higher first). Submitting a
+  /// wait before its signal stalls queues that resolve waits at submit time.
+  std::array<size_t, 3> SubmissionOrder() const {
+    std::array<size_t, 3> byPriority = {0, 1, 2};
+    std::stable_sort(byPriority.begin(), byPriority.end(), [this](size_t a, size_t b) {
+      return queueWork[a].priority > queueWork[b].priority;
+    });
+    std::array<size_t, 3> order{};
+    std::array<bool, 3> placed{};
+    for (size_t n = 0; n < order.size(); ++n) {
+      size_t pick = order.size();
+      for (size_t candidate : byPriority) {
+        if (placed[candidate]) continue;
+        bool ready = true;
+        for (size_t other = 0; other < order.size() && ready; ++other) {
+          ready = placed[other] || other == candidate || !Feeds(other, candidate);
+        }
+        if (ready) {
+          pick = candidate;
+          break;
+        }
+      }
+      if (pick == order.size()) {
+        // Cyclic dependency between queues: fall back to priority
+        for (size_t candidate : byPriority) {
+          if (!placed[candidate]) {
+            pick = candidate;
+            break;
+          }
+        }
+      }
+      placed[pick] = true;
+      order[n] = pick;
+    }
+    return order;
+  }
+
+  /// Whether next can join the accumulated submission: a wait must not move ahead of an
+  /// earlier signal on the same queue (the waited work may depend on it), and a submission
+  /// signals at most one fence
+  static bool CanCoalesce(SubmitBatch const& acc, SubmitBatch const& next) {
+    return (next.waitSyncs.empty() || acc.signalSyncs.empty()) && !(acc.signalFence && next.signalFence);
+  }
 };
 
 // === MultiQueueScheduler ===
@@ -413,9 +630,9 @@ void MultiQueueScheduler::Initialize(rhi::IDevice* device) {
 
   // Create cross-queue semaphores
   if (device) {
-    impl_->computeToGraphicsSem = device->CreateSemaphore();
-    impl_->copyToGraphicsSem = device->CreateSemaphore();
-    impl_->copyToComputeSem = device->CreateSemaphore();
+    impl_->computeToGraphicsSem = impl_->CreateCrossQueueSemaphore();
+    impl_->copyToGraphicsSem = impl_->CreateCrossQueueSemaphore();
+    impl_->copyToComputeSem = impl_->CreateCrossQueueSemaphore();
   }
 
   // Set default priorities
@@ -476,37 +693,39 @@ void MultiQueueScheduler::SubmitCopy(
 }
 
 QueueSyncPoint MultiQueueScheduler::CreateComputeToGraphicsSync() {
-  QueueSyncPoint sync{};
-  sync.signalSemaphore = impl_->computeToGraphicsSem;
-  return sync;
+  return Impl::MakeSync(QueueId::Compute, impl_->computeToGraphicsSem, impl_->computeToGraphicsValue);
 }
 
 QueueSyncPoint MultiQueueScheduler::CreateCopyToGraphicsSync() {
-  QueueSyncPoint sync{};
-  sync.signalSemaphore = impl_->copyToGraphicsSem;
-  return sync;
+  return Impl::MakeSync(QueueId::Copy, impl_->copyToGraphicsSem, impl_->copyToGraphicsValue);
 }
 
 QueueSyncPoint MultiQueueScheduler::CreateCopyToComputeSync() {
-  QueueSyncPoint sync{};
-  sync.signalSemaphore = impl_->copyToComputeSem;
-  return sync;
+  return Impl::MakeSync(QueueId::Copy, impl_->copyToComputeSem, impl_->copyToComputeValue);
 }
 
 void MultiQueueScheduler::Execute() {
-  // Sort queues by priority (higher first)
-  std::array<size_t, 3> order = {0, 1, 2};
-  std::sort(order.begin(), order.end(), [this](size_t a, size_t b) {
-    return impl_->queueWork[a].priority > impl_->queueWork[b].priority;
-  });
-
-  // Execute in priority order
-  for (size_t idx : order) {
-    auto& work = impl_->queueWork[idx];
-    for (auto& batch : work.batches) {
-      impl_->submitCtx.Submit(batch);
+  impl_->lastSubmissionCount = 0;
+  for (size_t idx : impl_->SubmissionOrder()) {
+    auto& batches = impl_->queueWork[idx].batches;
+    auto& merged = impl_->merged;
+    for (size_t begin = 0; begin < batches.size();) {
+      merged = batches[begin];
+      size_t end = begin + 1;
+      for (; end < batches.size() && Impl::CanCoalesce(merged, batches[end]); ++end) {
+        auto const& next = batches[end];
+        merged.commandLists.insert(merged.commandLists.end(), next.commandLists.begin(), next.commandLists.end());
+        merged.waitSyncs.insert(merged.waitSyncs.end(), next.waitSyncs.begin(), next.waitSyncs.end());
+        merged.signalSyncs.insert(merged.signalSyncs.end(), next.signalSyncs.begin(), next.signalSyncs.end());
+        if (!merged.signalFence) {
+          merged.signalFence = next.signalFence;
+        }
+      }
+      impl_->submitCtx.Submit(merged);
+      ++impl_->lastSubmissionCount;
+      begin = end;
     }
-    work.batches.clear();
+    batches.clear();
   }
 }
 
@@ -526,6 +745,10 @@ uint32_t MultiQueueScheduler::GetPendingWorkCount(QueueId queue) const {
   return 0;
 }
 
+uint32_t MultiQueueScheduler::GetLastSubmissionCount() const {
+  return impl_->lastSubmissionCount;
+}
+
 // === Free Functions ===
 
 SubmitContext* CreateSubmitContext() {
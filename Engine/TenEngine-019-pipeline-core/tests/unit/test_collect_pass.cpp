@@ -0,0 +1,151 @@
+#include <te/pipelinecore/CollectPass.h>
+#include <te/pipelinecore/FrameGraph.h>
+#include <te/pipelinecore/LogicalPipeline.h>
+#include <te/pipelinecore/RenderItem.h>
+#include <cassert>
+#include <cstdio>
+#include <mutex>
+#include <set>
+#include <thread>
+#include <vector>
+
+namespace {
+
+/// Scene of chunkCount chunks holding itemsPerChunk items each; sortKey numbers items in order
+struct ChunkedScene : te::pipelinecore::ISceneWorld {
+  size_t chunkCount{0};
+  size_t itemsPerChunk{0};
+  mutable std::mutex mutex;
+  mutable std::set<std::thread::id> threads;
+
+  size_t GetCollectChunkCount() const override { return chunkCount; }
+  void CollectChunk(size_t chunkIndex, te::pipelinecore::FrameContext const&,
+                    te::pipelinecore::IRenderItemList* out) const override {
+    {
+      std::lock_guard<std::mutex> lock(mutex);
+      threads.insert(std::this_thread::get_id());
+    }
+    for (size_t i = 0; i < itemsPerChunk; ++i) {
+      te::pipelinecore::RenderItem item{};
+      item.sortKey = chunkIndex * itemsPerChunk + i;
+      out->Push(item);
+    }
+  }
+};
+
+/// Pipeline whose source list is supplied by the test
+struct SourcePipeline : te::pipelinecore::ILogicalPipeline {
+  te::pipelinecore::IRenderItemList const* source{nullptr};
+  size_t GetPassCount() const override { return 0; }
+  void GetPassConfig(size_t, te::pipelinecore::PassCollectConfig*) const override {}
+  te::pipelinecore::IRenderItemList const* GetSourceItemList() const override { return source; }
+};
+
+te::pipelinecore::RenderItem ItemAt(float x, float y, float z, uint64_t id) {
+  te::pipelinecore::RenderItem item{};
+  item.worldMatrix[12] = x;
+  item.worldMatrix[13] = y;
+  item.worldMatrix[14] = z;
+  item.sortKey = id;
+  return item;
+}
+
+}  // namespace
+
+int main() {
+  using namespace te::pipelinecore;
+
+  IRenderItemList* source = CreateRenderItemList();
+  source->Push(ItemAt(0.f, 0.f, 0.f, 100000));
+  SourcePipeline pipeline;
+  pipeline.source = source;
+
+  // Scene chunks are collected on several threads but merged in chunk order
+  SetCollectWorkerCount(3);
+  assert(GetCollectWorkerCount() == 3);
+  ChunkedScene scene;
+  scene.chunkCount = 64;
+  scene.itemsPerChunk = 100;
+  FrameContext ctx{};
+  ctx.scene = &scene;
+  IRenderItemList* out = CreateRenderItemList();
+  out->Push(ItemAt(0.f, 0.f, 0.f, 7));  // Cleared by the collect
+  for (int frame = 0; frame < 3; ++frame) {
+    CollectRenderItemsParallel(&pipeline, ctx, out);
+    assert(out->Size() == 6401);
+    for (size_t i = 0; i < 6400; ++i) {
+      assert(out->At(i)->sortKey == i);
+    }
+    assert(out->At(6400)->sortKey == 100000);
+  }
+  std::printf("collect threads used: %zu\n", scene.threads.size());
+
+  // Inline collection gives the same result
+  SetCollectWorkerCount(0);
+  scene.chunkCount = 3;
+  CollectRenderItemsParallel(&pipeline, ctx, out);
+  assert(out->Size() == 301 && out->At(299)->sortKey == 299);
+
+  // No pipeline: only the scene's items
+  CollectRenderItemsParallel(nullptr, ctx, out);
+  assert(out->Size() == 300 && out->At(299)->sortKey == 299);
+
+  // No scene: only the pipeline's source items
+  ctx.scene = nullptr;
+  CollectRenderItemsParallel(&pipeline, ctx, out);
+  assert(out->Size() == 1 && out->At(0)->sortKey == 100000);
+
+  // Merge appends partial lists in order
+  IRenderItemList* a = CreateRenderItemList();
+  IRenderItemList* b = CreateRenderItemList();
+  a->Push(ItemAt(0.f, 0.f, 0.f, 1));
+  b->Push(ItemAt(0.f, 0.f, 0.f, 2));
+  b->Push(ItemAt(0.f, 0.f, 0.f, 3));
+  IRenderItemList const* partials[] = {a, nullptr, b};
+  MergeRenderItems(partials, 3, out);
+  assert(out->Size() == 3);
+  assert(out->At(0)->sortKey == 1 && out->At(1)->sortKey == 2 && out->At(2)->sortKey == 3);
+
+  // Depth sort: back-to-front by default, front-to-back on request; ties keep their order
+  float const camera[3] = {0.f, 0.f, 0.f};
+  IRenderItemList* items = CreateRenderItemList();
+  items->Push(ItemAt(0.f, 0.f, 5.f, 0));
+  items->Push(ItemAt(100.f, 0.f, 0.f, 1));
+  items->Push(ItemAt(0.f, -5.f, 0.f, 2));
+  items->Push(ItemAt(0.5f, 0.f, 0.f, 3));
+  items->Push(ItemAt(0.f, 0.f, 0.f, 4));
+  items->Push(ItemAt(0.f, 1e6f, 0.f, 5));
+  SortRenderItemsByDistance(items, camera);
+  uint64_t const backToFront[] = {5, 1, 0, 2, 3, 4};
+  for (size_t i = 0; i < 6; ++i) assert(items->At(i)->sortKey == backToFront[i]);
+  SortRenderItemsByDistance(items, camera, DepthSortOrder::FrontToBack);
+  uint64_t const frontToBack[] = {4, 3, 0, 2, 1, 5};
+  for (size_t i = 0; i < 6; ++i) assert(items->At(i)->sortKey == frontToBack[i]);
+
+  // Larger list against a reference ordering
+  items->Clear();
+  uint32_t seed = 12345u;
+  for (uint64_t i = 0; i < 50000; ++i) {
+    seed = seed * 1664525u + 1013904223u;
+    float const x = static_cast<float>(seed % 20000u) * 0.05f - 500.f;
+    items->Push(ItemAt(x, 0.f, 0.f, i));
+  }
+  SortRenderItemsByDistance(items, camera, DepthSortOrder::FrontToBack);
+  assert(items->Size() == 50000);
+  for (size_t i = 1; i < items->Size(); ++i) {
+    float const prev = items->At(i - 1)->worldMatrix[12];
+    float const cur = items->At(i)->worldMatrix[12];
+    assert(prev * prev <= cur * cur);
+    if (prev * prev == cur * cur && prev == cur) {
+      assert(items->At(i - 1)->sortKey < items->At(i)->sortKey);
+    }
+  }
+
+  DestroyRenderItemList(items);
+  DestroyRenderItemList(a);
+  DestroyRenderItemList(b);
+  DestroyRenderItemList(out);
+  DestroyRenderItemList(source);
+  std::printf("test_collect_pass passed\n");
+  return 0;
+}
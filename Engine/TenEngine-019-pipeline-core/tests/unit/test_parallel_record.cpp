@@ -0,0 +1,123 @@
+/**
+ * @file test_parallel_record.cpp
+ * @brief BuildRecordChunks / ParallelCommandRecorder on the Null RHI backend: pooled command
+ *        lists from SubmitContext recorded concurrently, submitted in compiled order.
+ */
+#include <te/pipelinecore/ParallelRecord.h>
+#include <te/pipelinecore/SubmitContext.h>
+#include <te/rhi/backend_null.hpp>
+#include <te/rhi/command_list.hpp>
+#include <te/rhi/device.hpp>
+#include <atomic>
+#include <cassert>
+#include <chrono>
+#include <cstdio>
+#include <thread>
+#include <vector>
+
+using namespace te::pipelinecore;
+
+namespace {
+
+std::vector<RecordChunk> BuildTestChunks() {
+  // Pass 0 has 1000 draws and is split; passes 1 and 2 stay whole
+  size_t const drawCounts[] = {1000, 10, 0};
+  RecordSplitConfig split{};
+  split.minDrawsPerChunk = 256;
+  split.maxChunksPerPass = 4;
+  std::vector<RecordChunk> chunks;
+  BuildRecordChunks(3, drawCounts, split, chunks);
+  return chunks;
+}
+
+void TestBuildChunks() {
+  std::vector<RecordChunk> const chunks = BuildTestChunks();
+  assert(chunks.size() == 3 + 2);
+  assert(chunks[0].executionOrder == 0 && chunks[0].IsFirstInPass() && !chunks[0].IsLastInPass());
+  assert(chunks[2].executionOrder == 0 && chunks[2].IsLastInPass());
+  assert(chunks[0].drawBegin == 0 && chunks[2].drawEnd == 1000);
+  assert(chunks[1].drawBegin == chunks[0].drawEnd);
+  assert(chunks[3].executionOrder == 1 && chunks[3].chunkCount == 1 && chunks[3].drawEnd == 10);
+  assert(chunks[4].executionOrder == 2 && chunks[4].drawBegin == chunks[4].drawEnd);
+}
+
+// Lists from the SubmitContext pool are recorded on several threads and submitted in order
+void TestParallelRecord(te::rhi::IDevice* device) {
+  std::vector<RecordChunk> const chunks = BuildTestChunks();
+  SubmitContext ctx;
+  ctx.SetDevice(device);
+  std::atomic<int> released{0};
+  ParallelCommandRecorder recorder;
+  recorder.SetWorkerCount(3);
+  assert(recorder.GetWorkerCount() == 3);
+  recorder.SetCommandListCallbacks(
+    [&]() { return ctx.AcquireCommandList(QueueId::Graphics); },
+    [&](te::rhi::ICommandList* cmd) { ++released; ctx.ReleaseCommandList(cmd); });
+
+  std::vector<te::rhi::ICommandList*> lists;
+  bool ok = recorder.Record(chunks,
+    [](RecordChunk const& chunk, te::rhi::ICommandList* cmd) {
+      // First command tags the list with its pass, so submission order is visible
+      cmd->Dispatch(static_cast<uint32_t>(chunk.executionOrder), chunk.chunkIndex, 0);
+      for (size_t d = chunk.drawBegin; d < chunk.drawEnd; ++d) cmd->Draw(3);
+      // Keep every chunk busy long enough for the workers to pick some up
+      std::this_thread::sleep_for(std::chrono::milliseconds(20));
+    },
+    lists);
+  assert(ok);
+  assert(lists.size() == chunks.size());
+  assert(released == 0);
+  assert(recorder.GetLastThreadsUsed() > 1);
+
+  // One ended list per chunk, in compiled order
+  for (size_t i = 0; i < lists.size(); ++i) {
+    size_t count = 0;
+    te::rhi::RecordedCommand const* commands = te::rhi::GetRecordedCommands(lists[i], &count);
+    assert(count == 1 + (chunks[i].drawEnd - chunks[i].drawBegin));
+    assert(commands[0].type == te::rhi::RecordedCommandType::Dispatch);
+    assert(commands[0].args[0] == chunks[i].executionOrder && commands[0].args[1] == chunks[i].chunkIndex);
+    ctx.EnqueueCommandList(QueueId::Graphics, lists[i]);
+  }
+  te::rhi::ResetNullDeviceCounters(device);
+  ctx.SubmitQueue(QueueId::Graphics);
+  te::rhi::NullDeviceCounters const c = te::rhi::GetNullDeviceCounters(device);
+  assert(c.submits == 1 && c.commandLists == chunks.size());
+  assert(c.drawCalls == 1010 && c.dispatches == chunks.size());
+  ctx.WaitQueueIdle(QueueId::Graphics);
+
+  // Failed acquire returns everything already acquired
+  int acquired = 0;
+  recorder.SetCommandListCallbacks(
+    [&]() -> te::rhi::ICommandList* {
+      if (++acquired > 2) return nullptr;
+      return ctx.AcquireCommandList(QueueId::Graphics);
+    },
+    [&](te::rhi::ICommandList* cmd) { ++released; ctx.ReleaseCommandList(cmd); });
+  ok = recorder.Record(chunks, [](RecordChunk const&, te::rhi::ICommandList*) {}, lists);
+  assert(!ok && lists.empty() && released == 2);
+
+  // Zero workers records inline on the calling thread
+  recorder.SetWorkerCount(0);
+  recorder.SetCommandListCallbacks(
+    [&]() { return ctx.AcquireCommandList(QueueId::Graphics); },
+    [&](te::rhi::ICommandList* cmd) { ctx.ReleaseCommandList(cmd); });
+  std::thread::id const caller = std::this_thread::get_id();
+  ok = recorder.Record(chunks,
+    [caller](RecordChunk const&, te::rhi::ICommandList*) { assert(std::this_thread::get_id() == caller); },
+    lists);
+  assert(ok && lists.size() == chunks.size());
+  assert(recorder.GetLastThreadsUsed() == 1);
+  for (te::rhi::ICommandList* cmd : lists) ctx.ReleaseCommandList(cmd);
+}
+
+}  // namespace
+
+int main() {
+  te::rhi::IDevice* device = te::rhi::CreateDevice(te::rhi::Backend::Null);
+  assert(device);
+  TestBuildChunks();
+  TestParallelRecord(device);
+  te::rhi::DestroyDevice(device);
+  std::printf("test_parallel_record: pass\n");
+  return 0;
+}
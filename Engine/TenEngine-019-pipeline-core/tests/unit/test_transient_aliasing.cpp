@@ -0,0 +1,94 @@
+#include <te/pipelinecore/ResourceManager.h>
+#include <te/rhi/resources.hpp>
+#include <cassert>
+#include <cstdio>
+#include <vector>
+
+namespace {
+
+struct FakeTexture : te::rhi::ITexture {};
+std::vector<FakeTexture*> g_created;
+
+}  // namespace
+
+int main() {
+  using namespace te::pipelinecore;
+  TransientResourcePool pool;
+  pool.SetCreateCallbacks(
+    [](TransientTextureDesc const&) -> te::rhi::ITexture* {
+      g_created.push_back(new FakeTexture());
+      return g_created.back();
+    },
+    nullptr);
+
+  TransientTextureDesc desc{};
+  desc.width = 3840;
+  desc.height = 2160;
+  desc.format = 1;
+
+  // Post-process chain: A(0..1) -> B(1..2) -> C(2..3); A and C may alias
+  pool.BeginFrame();
+  TransientResourceHandle a = pool.DeclareTransientTexture(desc);
+  TransientResourceHandle b = pool.DeclareTransientTexture(desc);
+  TransientResourceHandle c = pool.DeclareTransientTexture(desc);
+  pool.MarkResourceWrite(a, 0);
+  pool.MarkResourceRead(a, 1);
+  pool.MarkResourceWrite(b, 1);
+  pool.MarkResourceRead(b, 2);
+  pool.MarkResourceWrite(c, 2);
+  pool.MarkResourceRead(c, 3);
+  pool.Compile();
+
+  te::rhi::ITexture* ta = pool.GetOrCreateTexture(a);
+  te::rhi::ITexture* tb = pool.GetOrCreateTexture(b);
+  te::rhi::ITexture* tc = pool.GetOrCreateTexture(c);
+  assert(ta && tb && tc);
+  assert(ta != tb);
+  assert(ta == tc);
+  assert(g_created.size() == 2);
+
+  TransientPoolStats stats = pool.GetPoolStats();
+  assert(stats.physicalTextureCount == 2);
+  assert(stats.aliasedResourceCount == 1);
+  assert(stats.savedBytes == stats.requestedBytes / 3);
+
+  // Each transient moves RenderTarget -> ShaderResource; C inherits A's final state
+  auto barriersOf = [&](TransientResourceHandle h) {
+    std::vector<ResourceBarrier> out;
+    for (ResourceBarrier const& barrier : pool.GetAllBarriers())
+      if (barrier.resource.id == h.id) out.push_back(barrier);
+    return out;
+  };
+  using te::rhi::ResourceState;
+  std::vector<ResourceBarrier> const ba = barriersOf(a);
+  assert(ba.size() == 2);
+  assert(ba[0].beforePass == 0 && ba[0].srcState == ResourceState::Common &&
+         ba[0].dstState == ResourceState::RenderTarget);
+  assert(ba[1].beforePass == 1 && ba[1].srcState == ResourceState::RenderTarget &&
+         ba[1].dstState == ResourceState::ShaderResource);
+  std::vector<ResourceBarrier> const bc = barriersOf(c);
+  assert(bc.size() == 2);
+  assert(bc[0].beforePass == 2 && bc[0].srcState == ResourceState::ShaderResource &&
+         bc[0].dstState == ResourceState::RenderTarget);
+  assert(bc[1].beforePass == 3 && bc[1].dstState == ResourceState::ShaderResource);
+  for (size_t i = 1; i < pool.GetAllBarriers().size(); ++i)
+    assert(pool.GetAllBarriers()[i - 1].beforePass <= pool.GetAllBarriers()[i].beforePass);
+  pool.EndFrame();
+
+  // Next frame reuses the cached physical textures
+  pool.BeginFrame();
+  TransientResourceHandle d = pool.DeclareTransientTexture(desc);
+  pool.MarkResourceWrite(d, 0);
+  pool.Compile();
+  assert(pool.GetOrCreateTexture(d) == ta);
+  assert(g_created.size() == 2);
+  assert(pool.GetPoolStats().reusedFromCacheCount == 1);
+  // Carried over from the last frame in C's final state
+  assert(pool.GetAllBarriers().size() == 1 &&
+         pool.GetAllBarriers()[0].srcState == te::rhi::ResourceState::ShaderResource);
+  pool.EndFrame();
+
+  for (FakeTexture* t : g_created) delete t;
+  std::printf("test_transient_aliasing: pass\n");
+  return 0;
+}
@@ -68,4 +68,27 @@ void ExecuteLogicalCommandBufferOnDeviceThreadWithStats(
     uint32_t frameSlot,
     ExecutionStats* outStats);
 
+/**
+ * @brief Execute a draw range [drawBegin, drawEnd) of a logical command buffer with statistics.
+ *
+ * Used by parallel recording: each worker records a disjoint draw range into its own
+ * command list. The range is clamped to the buffer's draw count. Runs on worker threads and
+ * only reads materials (GetGraphicsPSO, GetDescriptorSet, GetUniformBufferOffset); update
+ * them with UpdateDeviceResource before recording starts.
+ *
+ * @param cmd The RHI command list to record draw calls into.
+ * @param logicalCB The logical command buffer containing draw commands.
+ * @param frameSlot The current frame slot for resource updates.
+ * @param drawBegin First draw to execute.
+ * @param drawEnd One past the last draw to execute.
+ * @param outStats Output statistics structure (optional).
+ */
+void ExecuteLogicalCommandBufferRangeWithStats(
+    rhi::ICommandList* cmd,
+    pipelinecore::ILogicalCommandBuffer const* logicalCB,
+    uint32_t frameSlot,
+    size_t drawBegin,
+    size_t drawEnd,
+    ExecutionStats* outStats);
+
 }  // namespace te::pipeline
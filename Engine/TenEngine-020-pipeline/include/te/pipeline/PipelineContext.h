@@ -70,6 +70,7 @@ struct FrameStats {
   uint32_t passCount{0};
   uint32_t resourceCount{0};
   size_t memoryUsed{0};            // bytes
+  size_t memorySavedByAliasing{0}; // bytes, transient aliasing savings
 };
 
 /**
@@ -149,10 +149,13 @@ struct IRenderPipeline {
 
   // === Lifecycle ===
 
-  /// Initialize the pipeline
+  /// Initialize the pipeline. Once a device is set, registers the pipeline cache's fallback PSO
+  /// (materials then compile their PSOs in the background) and loads pipelineCachePath
   virtual bool Initialize() = 0;
 
-  /// Shutdown the pipeline
+  /// Shutdown the pipeline. After the GPU is idle, saves the pipeline cache and releases the
+  /// device's shared pipeline cache and uniform ring; call before destroying the device, and
+  /// do not draw or update materials of the device afterwards
   virtual void Shutdown() = 0;
 
   /// Check if initialized
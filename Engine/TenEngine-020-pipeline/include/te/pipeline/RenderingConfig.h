@@ -108,7 +108,10 @@ struct RenderingConfig {
   bool enableInstancing{true};
   uint32_t maxInstancesPerDraw{1024};
 
-  // Multithreading
+  // Multithreading. Passes are recorded in parallel into one command list each; on worker
+  // threads run FrameGraph pass callbacks and IRenderMaterial::GetGraphicsPSO /
+  // GetDescriptorSet / GetUniformBufferOffset. IRenderMaterial::UpdateDeviceResource is not
+  // thread-safe: call it on the render thread before ExecutePasses, never from a pass callback.
   bool enableMultithreadedRendering{true};
   uint32_t workerThreadCount{0};       // 0 = auto-detect
 
@@ -116,6 +119,10 @@ struct RenderingConfig {
   uint32_t maxFramesInFlight{2};
   uint32_t transientResourcePoolSizeMB{256};
 
+  // Pipeline state cache
+  char const* pipelineCachePath{nullptr};  // Loaded on Initialize, saved on Shutdown; null = not persisted
+  uint64_t pipelineCacheVersion{0};        // Bump when shaders or the engine change to discard the file
+
   // Effects
   bool enableParticles{true};
   bool enableDecals{true};
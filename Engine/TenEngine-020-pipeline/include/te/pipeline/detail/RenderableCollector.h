@@ -10,9 +10,14 @@
 
 #include <te/pipelinecore/RenderItem.h>
 #include <te/pipelinecore/FrameContext.h>
+#include <te/pipelinecore/FrameGraph.h>
 #include <te/rendercore/types.hpp>
+#include <te/scene/SceneTypes.h>
+#include <te/world/WorldTypes.h>
+#include <atomic>
 #include <cstdint>
 #include <cstddef>
+#include <vector>
 
 namespace te::resource {
 class IResourceManager;
@@ -47,6 +52,41 @@ struct CollectStats {
   uint32_t activeCamera{0};
 };
 
+// === Scene World Adapter ===
+
+/// pipelinecore::ISceneWorld over a 029 level scene, so CollectRenderItemsParallel can
+/// gather it in chunks. Update() snapshots the renderables on the calling thread (scene
+/// traversal is not thread-safe); CollectChunk then turns a fixed-size range of the
+/// snapshot into RenderItems and may run on any collect worker.
+class WorldSceneAdapter final : public pipelinecore::ISceneWorld {
+ public:
+  static constexpr size_t kDefaultChunkSize = 256;
+
+  /// Snapshot the renderables of sceneRef; an invalid sceneRef leaves the adapter empty
+  void Update(te::scene::SceneRef sceneRef, te::resource::IResourceManager* resourceManager);
+
+  /// Culling and sort-key parameters used by CollectChunk; params.frustum must outlive the collect
+  void SetCollectParams(CollectParams const& params);
+
+  /// Renderables per chunk (at least 1)
+  void SetChunkSize(size_t renderablesPerChunk);
+
+  size_t GetRenderableCount() const { return renderables_.size(); }
+
+  /// Renderables culled by CollectChunk since the last Update
+  uint32_t GetCulledCount() const { return culled_.load(); }
+
+  size_t GetCollectChunkCount() const override;
+  void CollectChunk(size_t chunkIndex, pipelinecore::FrameContext const& ctx,
+                    pipelinecore::IRenderItemList* out) const override;
+
+ private:
+  std::vector<te::world::RenderableItem> renderables_;
+  CollectParams params_{};
+  size_t chunkSize_{kDefaultChunkSize};
+  mutable std::atomic<uint32_t> culled_{0};
+};
+
 // === Renderable Collection ===
 
 /// Collect renderables from scene to render item list
@@ -106,7 +146,8 @@ void CollectDecalsToItemList(
 // === Parallel Collection ===
 
 /// Collect renderables in parallel (for Thread C)
-/// Uses internal partitioning and merges results
+/// Chunks of a WorldSceneAdapter are gathered by CollectRenderItemsParallel on
+/// threadCount - 1 collect workers plus the caller; output order matches the serial path
 void CollectRenderablesParallel(
   CollectParams const& params,
   te::resource::IResourceManager* resourceManager,
@@ -57,7 +57,8 @@ void ExecuteLogicalCommandBufferOnDeviceThread(
       // Bind descriptor set (contains textures, uniform buffers, samplers)
       rhi::IDescriptorSet* descSet = material->GetDescriptorSet();
       if (descSet) {
-        cmd->BindDescriptorSet(descSet);
+        uint32_t const uniformOffset = material->GetUniformBufferOffset();
+        cmd->BindDescriptorSet(0u, descSet, &uniformOffset, 1u);
       }
     }
 
@@ -105,6 +106,18 @@ void ExecuteLogicalCommandBufferOnDeviceThreadWithStats(
     pipelinecore::ILogicalCommandBuffer const* logicalCB,
     uint32_t frameSlot,
     ExecutionStats* outStats) {
+  size_t drawCount = logicalCB ? logicalCB->GetDrawCount() : 0;
+  ExecuteLogicalCommandBufferRangeWithStats(cmd, logicalCB, frameSlot, 0, drawCount, outStats);
+}
+
+void ExecuteLogicalCommandBufferRangeWithStats(
+    rhi::ICommandList* cmd,
+    pipelinecore::ILogicalCommandBuffer const* logicalCB,
+    uint32_t frameSlot,
+    size_t drawBegin,
+    size_t drawEnd,
+    ExecutionStats* outStats) {
+  (void)frameSlot;
 
   if (outStats) {
     *outStats = ExecutionStats{};
@@ -112,15 +125,15 @@ void ExecuteLogicalCommandBufferOnDeviceThreadWithStats(
 
   if (!cmd || !logicalCB) return;
 
-  size_t drawCount = logicalCB->GetDrawCount();
-  if (drawCount == 0) return;
+  size_t drawCount = std::min(drawEnd, logicalCB->GetDrawCount());
+  if (drawBegin >= drawCount) return;
 
   uint32_t totalDrawCalls = 0;
   uint32_t totalInstances = 0;
   uint32_t totalTriangles = 0;
   uint32_t totalVertices = 0;
 
-  for (size_t i = 0; i < drawCount; ++i) {
+  for (size_t i = drawBegin; i < drawCount; ++i) {
     pipelinecore::LogicalDraw draw;
     logicalCB->GetDraw(i, &draw);
 
@@ -140,7 +153,8 @@ void ExecuteLogicalCommandBufferOnDeviceThreadWithStats(
 
       rhi::IDescriptorSet* descSet = material->GetDescriptorSet();
       if (descSet) {
-        cmd->BindDescriptorSet(descSet);
+        uint32_t const uniformOffset = material->GetUniformBufferOffset();
+        cmd->BindDescriptorSet(0u, descSet, &uniformOffset, 1u);
       }
     }
 
@@ -11,17 +11,22 @@
 #include <te/pipelinecore/LogicalPipeline.h>
 #include <te/pipelinecore/RenderItem.h>
 #include <te/pipelinecore/LogicalCommandBuffer.h>
+#include <te/pipelinecore/ParallelRecord.h>
 #include <te/pipelinecore/ResourceManager.h>
 #include <te/pipelinecore/SubmitContext.h>
 #include <te/rhi/device.hpp>
 #include <te/rhi/command_list.hpp>
 #include <te/rhi/swapchain.hpp>
 #include <te/rendercore/IRenderMaterial.hpp>
+#include <te/rendercore/uniform_buffer.hpp>
+#include <te/core/profiling.h>
+#include <te/deviceresource/DeviceResourceManager.h>
 
 #include <algorithm>
 #include <cassert>
 #include <chrono>
 #include <cstring>
+#include <thread>
 
 namespace te::pipeline {
 
@@ -36,6 +41,15 @@ struct RenderBatchData {
   uint32_t instanceCount{1};
 };
 
+/// Frame-level render targets shared by every record chunk
+struct PassTargets {
+  uint32_t width{0};
+  uint32_t height{0};
+  rhi::ITexture* backBuffer{nullptr};
+  rhi::ITexture* depthBuffer{nullptr};
+  uint32_t frameSlot{0};
+};
+
 struct PipelineContext::Impl {
   rhi::IDevice* device{nullptr};
   RenderingConfig const* config{nullptr};
@@ -61,14 +75,28 @@ struct PipelineContext::Impl {
   uint32_t depthWidth{0};
   uint32_t depthHeight{0};
 
+  // Parallel command recording
+  pipelinecore::ParallelCommandRecorder recorder;
+  std::vector<pipelinecore::RecordChunk> recordChunks;
+
   FrameStats stats;
   uint64_t frameIndex{0};
 
   bool resourcesReady{false};
 
+  void ReleaseFrameObjects() {
+    if (logicalCB) {
+      pipelinecore::DestroyLogicalCommandBuffer(logicalCB);
+      logicalCB = nullptr;
+    }
+    if (logicalPipeline) {
+      pipelinecore::DestroyLogicalPipeline(logicalPipeline);
+      logicalPipeline = nullptr;
+    }
+  }
+
   void Reset() {
-    logicalPipeline = nullptr;
-    logicalCB = nullptr;
+    ReleaseFrameObjects();
     resourcesReady = false;
 
     for (auto* list : renderItemsPerPass) {
@@ -112,6 +140,103 @@ struct PipelineContext::Impl {
     return depthBuffer;
   }
 
+  /// Worker threads for pass recording (0 = record on the calling thread)
+  uint32_t GetRecordWorkerCount() const {
+    if (!config || !config->enableMultithreadedRendering) return 0;
+    if (config->workerThreadCount > 0) return config->workerThreadCount;
+    unsigned hw = std::thread::hardware_concurrency();
+    return hw > 1 ? std::min(hw - 1, 7u) : 0u;
+  }
+
+  void AccumulateStats(ExecutionStats const& execStats) {
+    stats.drawCallCount += execStats.drawCalls;
+    stats.instanceCount += execStats.instanceCount;
+    stats.triangleCount += execStats.triangleCount;
+    stats.vertexCount += execStats.vertexCount;
+  }
+
+  static rhi::RenderPassDesc MakeRenderPassDesc(PassTargets const& targets, rhi::LoadOp loadOp) {
+    rhi::RenderPassDesc rpDesc{};
+    rpDesc.colorAttachmentCount = 1;
+    rpDesc.colorAttachments[0].texture = targets.backBuffer;
+    rpDesc.colorAttachments[0].loadOp = loadOp;
+    rpDesc.colorAttachments[0].storeOp = rhi::StoreOp::Store;
+    rpDesc.colorAttachments[0].clearColor[0] = 0.1f;
+    rpDesc.colorAttachments[0].clearColor[1] = 0.1f;
+    rpDesc.colorAttachments[0].clearColor[2] = 0.2f;
+    rpDesc.colorAttachments[0].clearColor[3] = 1.0f;
+    rpDesc.colorAttachments[0].format = 0;  // Auto-infer from texture
+    rpDesc.subpassCount = 0;  // Single subpass mode
+
+    // Configure depth-stencil attachment
+    if (targets.depthBuffer) {
+      rpDesc.depthStencilAttachment.texture = targets.depthBuffer;
+      rpDesc.depthStencilAttachment.loadOp = loadOp;
+      rpDesc.depthStencilAttachment.storeOp = rhi::StoreOp::Store;
+      rpDesc.depthStencilAttachment.clearDepth = 1.0f;
+      rpDesc.depthStencilAttachment.clearStencil = 0;
+    }
+    return rpDesc;
+  }
+
+  void SetViewportAndScissor(rhi::ICommandList* cmd, PassTargets const& targets) const {
+    rhi::Viewport viewport{};
+    viewport.x = 0.0f;
+    viewport.y = 0.0f;
+    viewport.width = static_cast<float>(targets.width);
+    viewport.height = static_cast<float>(targets.height);
+    viewport.minDepth = 0.0f;
+    viewport.maxDepth = 1.0f;
+    cmd->SetViewport(0, 1, &viewport);
+
+    rhi::ScissorRect scissor{};
+    scissor.x = 0;
+    scissor.y = 0;
+    scissor.width = targets.width;
+    scissor.height = targets.height;
+    cmd->SetScissor(0, 1, &scissor);
+  }
+
+  /// Record one chunk of a pass. May run on a recorder worker thread: touches only
+  /// cmd, execStats and read-only frame state.
+  void RecordPassChunk(pipelinecore::RecordChunk const& chunk, rhi::ICommandList* cmd,
+                       PassTargets const& targets, ExecutionStats* execStats) {
+    TE_PROFILE_ZONE("RecordPassChunk");
+    size_t const i = chunk.executionOrder;
+
+    // Each command list starts with fresh dynamic state
+    SetViewportAndScissor(cmd, targets);
+
+    // Barriers and clears belong to the first chunk of a pass; later chunks load
+    if (chunk.IsFirstInPass() && resourcePool) {
+      resourcePool->InsertBarriersForPass(static_cast<uint32_t>(i), cmd);
+    }
+    rhi::LoadOp const loadOp = chunk.IsFirstInPass() ? rhi::LoadOp::Clear : rhi::LoadOp::Load;
+    rhi::RenderPassDesc rpDesc = MakeRenderPassDesc(targets, loadOp);
+
+    // Begin render pass
+    cmd->BeginRenderPass(rpDesc, nullptr);
+
+    // For the first pass (main geometry pass), execute the chunk's logical draw range
+    if (i == 0 && logicalCB) {
+      ExecuteLogicalCommandBufferRangeWithStats(cmd, logicalCB, targets.frameSlot,
+                                                chunk.drawBegin, chunk.drawEnd, execStats);
+    }
+
+    // Execute pass callback from FrameGraph once, after the pass's last draw range
+    if (chunk.IsLastInPass()) {
+      pipelinecore::PassContext passCtx;
+      if (i < renderItemsPerPass.size()) {
+        passCtx.SetRenderItemList(0, renderItemsPerPass[i]);
+      }
+      passCtx.SetLightItemList(lights);
+      frameGraph->ExecutePass(i, passCtx, cmd);
+    }
+
+    // End render pass
+    cmd->EndRenderPass();
+  }
+
   void DestroyDepthBuffer(rhi::IDevice* dev) {
     if (depthBuffer && dev) {
       dev->DestroyTexture(depthBuffer);
@@ -130,6 +255,9 @@ PipelineContext::PipelineContext()
     pipelinecore::CreateTransientResourcePool());
   impl_->submitCtx = std::unique_ptr<pipelinecore::SubmitContext>(
     pipelinecore::CreateSubmitContext());
+  impl_->recorder.SetCommandListCallbacks(
+    [this]() { return impl_->submitCtx->AcquireCommandList(pipelinecore::QueueId::Graphics); },
+    [this](rhi::ICommandList* cmd) { impl_->submitCtx->ReleaseCommandList(cmd); });
 
   impl_->renderItemsPerPass.resize(8); // Reserve for 8 passes
   for (auto& list : impl_->renderItemsPerPass) {
@@ -140,6 +268,7 @@ PipelineContext::PipelineContext()
 }
 
 PipelineContext::~PipelineContext() {
+  impl_->ReleaseFrameObjects();
   for (auto* list : impl_->renderItemsPerPass) {
     if (list) {
       pipelinecore::DestroyRenderItemList(list);
@@ -213,6 +342,15 @@ void PipelineContext::BeginFrame(pipelinecore::FrameContext const& frameCtx) {
     impl_->resourcePool->BeginFrame();
   }
 
+  // Submit async buffer/texture uploads queued since the last frame and run the callbacks of
+  // finished ones, so resources created this frame are ready before PrepareResources
+  deviceresource::DeviceResourceManager::ProcessUploads(impl_->device);
+
+  // Uniform blocks of frames the GPU has finished are free again
+  if (auto* ring = rendercore::GetDeviceUniformRing(impl_->device)) {
+    ring->BeginFrame(impl_->submitCtx ? impl_->submitCtx->GetQueueCompletedValue(pipelinecore::QueueId::Graphics) : 0);
+  }
+
   impl_->stats.frameIndex = impl_->frameIndex;
 }
 
@@ -240,6 +378,7 @@ uint64_t PipelineContext::GetFrameIndex() const {
 
 void PipelineContext::BuildLogicalPipeline() {
   if (impl_->frameGraph) {
+    impl_->ReleaseFrameObjects();
     impl_->frameGraph->Compile();
     impl_->logicalPipeline = pipelinecore::BuildLogicalPipeline(
       impl_->frameGraph, impl_->frameCtx);
@@ -253,6 +392,7 @@ pipelinecore::ILogicalPipeline* PipelineContext::GetLogicalPipeline() const {
 }
 
 void PipelineContext::CollectVisibleObjects() {
+  TE_PROFILE_ZONE("CollectVisibleObjects");
   // This would normally query the scene/world for visible objects
   // For now, this is a placeholder - actual collection happens via
   // SetRenderItems() from the RenderableCollector
@@ -312,6 +452,7 @@ void PipelineContext::PrepareResources() {
       impl_->resourcePool->GetAllocatedTextureCount() +
       impl_->resourcePool->GetAllocatedBufferSize());
     impl_->stats.memoryUsed = impl_->resourcePool->GetTotalMemoryUsed();
+    impl_->stats.memorySavedByAliasing = impl_->resourcePool->GetPoolStats().savedBytes;
   }
 }
 
@@ -343,156 +484,120 @@ void PipelineContext::ConvertToLogicalCommandBuffer() {
   // Get render items from first pass (simplified)
   auto* items = impl_->renderItemsPerPass[0];
   if (items && items->Size() > 0) {
+    if (impl_->logicalCB) {
+      pipelinecore::DestroyLogicalCommandBuffer(impl_->logicalCB);
+      impl_->logicalCB = nullptr;
+    }
     pipelinecore::ConvertToLogicalCommandBuffer(
       items, impl_->logicalPipeline, &impl_->logicalCB);
   }
 }
 
 void PipelineContext::ExecutePasses() {
+  TE_PROFILE_ZONE("ExecutePasses");
   if (!impl_->frameGraph || !impl_->device) return;
 
-  auto* cmd = BeginCommandList();
-  if (!cmd) return;
-
   // Get viewport dimensions
-  uint32_t width = GetWidth();
-  uint32_t height = GetHeight();
-  if (width == 0 || height == 0) {
-    width = 800;
-    height = 600;
-  }
-
-  // Setup viewport and scissor
-  rhi::Viewport viewport{};
-  viewport.x = 0.0f;
-  viewport.y = 0.0f;
-  viewport.width = static_cast<float>(width);
-  viewport.height = static_cast<float>(height);
-  viewport.minDepth = 0.0f;
-  viewport.maxDepth = 1.0f;
-  cmd->SetViewport(0, 1, &viewport);
-
-  rhi::ScissorRect scissor{};
-  scissor.x = 0;
-  scissor.y = 0;
-  scissor.width = width;
-  scissor.height = height;
-  cmd->SetScissor(0, 1, &scissor);
+  PassTargets targets{};
+  targets.width = GetWidth();
+  targets.height = GetHeight();
+  if (targets.width == 0 || targets.height == 0) {
+    targets.width = 800;
+    targets.height = 600;
+  }
 
   // Get back buffer for render target
-  rhi::ITexture* backBuffer = GetBackBuffer();
+  targets.backBuffer = GetBackBuffer();
 
   // Create/ensure depth buffer
-  rhi::ITexture* depthBuffer = impl_->EnsureDepthBuffer(impl_->device, width, height);
-
-  // Insert barriers for each pass
-  if (impl_->resourcePool) {
-    for (size_t i = 0; i < impl_->stats.passCount; ++i) {
-      impl_->resourcePool->InsertBarriersForPass(static_cast<uint32_t>(i), cmd);
-    }
-  }
+  targets.depthBuffer = impl_->EnsureDepthBuffer(impl_->device, targets.width, targets.height);
 
   // Get frame slot for resource updates
-  uint32_t frameSlot = impl_->frameCtx.frameSlotId;
-
-  // Execute each pass
-  pipelinecore::PassContext passCtx;
-  for (size_t i = 0; i < impl_->stats.passCount; ++i) {
-    // Set render items for this pass
-    if (i < impl_->renderItemsPerPass.size()) {
-      passCtx.SetRenderItemList(0, impl_->renderItemsPerPass[i]);
-    }
-    passCtx.SetLightItemList(impl_->lights);
+  targets.frameSlot = impl_->frameCtx.frameSlotId;
 
-    // Build RenderPass description with depth buffer
-    rhi::RenderPassDesc rpDesc{};
-    rpDesc.colorAttachmentCount = 1;
-    rpDesc.colorAttachments[0].texture = backBuffer;
-    rpDesc.colorAttachments[0].loadOp = rhi::LoadOp::Clear;
-    rpDesc.colorAttachments[0].storeOp = rhi::StoreOp::Store;
-    rpDesc.colorAttachments[0].clearColor[0] = 0.1f;
-    rpDesc.colorAttachments[0].clearColor[1] = 0.1f;
-    rpDesc.colorAttachments[0].clearColor[2] = 0.2f;
-    rpDesc.colorAttachments[0].clearColor[3] = 1.0f;
-    rpDesc.colorAttachments[0].format = 0;  // Auto-infer from texture
-    rpDesc.subpassCount = 0;  // Single subpass mode
-
-    // Configure depth-stencil attachment
-    if (depthBuffer) {
-      rpDesc.depthStencilAttachment.texture = depthBuffer;
-      rpDesc.depthStencilAttachment.loadOp = rhi::LoadOp::Clear;
-      rpDesc.depthStencilAttachment.storeOp = rhi::StoreOp::Store;
-      rpDesc.depthStencilAttachment.clearDepth = 1.0f;
-      rpDesc.depthStencilAttachment.clearStencil = 0;
-    }
-
-    // Begin render pass
-    cmd->BeginRenderPass(rpDesc, nullptr);
-
-    // For the first pass (main geometry pass), execute logical command buffer
-    if (i == 0 && impl_->logicalCB) {
-      ExecutionStats execStats{};
-      ExecuteLogicalCommandBufferOnDeviceThreadWithStats(cmd, impl_->logicalCB, frameSlot, &execStats);
-
-      // Update stats
-      impl_->stats.drawCallCount += execStats.drawCalls;
-      impl_->stats.instanceCount += execStats.instanceCount;
-      impl_->stats.triangleCount += execStats.triangleCount;
-      impl_->stats.vertexCount += execStats.vertexCount;
-    }
-
-    // Execute pass callback from FrameGraph
-    impl_->frameGraph->ExecutePass(i, passCtx, cmd);
-
-    // End render pass
-    cmd->EndRenderPass();
-  }
+  size_t const passCount = impl_->stats.passCount;
 
   // If no passes defined, do a simple clear pass
-  if (impl_->stats.passCount == 0 && backBuffer) {
-    rhi::RenderPassDesc rpDesc{};
-    rpDesc.colorAttachmentCount = 1;
-    rpDesc.colorAttachments[0].texture = backBuffer;
-    rpDesc.colorAttachments[0].loadOp = rhi::LoadOp::Clear;
-    rpDesc.colorAttachments[0].storeOp = rhi::StoreOp::Store;
-    rpDesc.colorAttachments[0].clearColor[0] = 0.1f;
-    rpDesc.colorAttachments[0].clearColor[1] = 0.1f;
-    rpDesc.colorAttachments[0].clearColor[2] = 0.2f;
-    rpDesc.colorAttachments[0].clearColor[3] = 1.0f;
-    rpDesc.subpassCount = 0;
+  if (passCount == 0) {
+    auto* cmd = BeginCommandList();
+    if (!cmd) return;
+    impl_->SetViewportAndScissor(cmd, targets);
+    if (targets.backBuffer) {
+      rhi::RenderPassDesc rpDesc = Impl::MakeRenderPassDesc(targets, rhi::LoadOp::Clear);
+      cmd->BeginRenderPass(rpDesc, nullptr);
+
+      // Execute logical command buffer if we have one
+      if (impl_->logicalCB) {
+        ExecutionStats execStats{};
+        ExecuteLogicalCommandBufferOnDeviceThreadWithStats(cmd, impl_->logicalCB, targets.frameSlot, &execStats);
+        impl_->AccumulateStats(execStats);
+      }
 
-    // Add depth buffer to clear pass
-    if (depthBuffer) {
-      rpDesc.depthStencilAttachment.texture = depthBuffer;
-      rpDesc.depthStencilAttachment.loadOp = rhi::LoadOp::Clear;
-      rpDesc.depthStencilAttachment.storeOp = rhi::StoreOp::Store;
-      rpDesc.depthStencilAttachment.clearDepth = 1.0f;
-      rpDesc.depthStencilAttachment.clearStencil = 0;
+      cmd->EndRenderPass();
     }
+    EndCommandList(cmd);
+    return;
+  }
 
-    cmd->BeginRenderPass(rpDesc, nullptr);
+  // Split passes into record chunks; only the main geometry pass (0) carries the
+  // logical command buffer, so it is the one split by draw range.
+  std::vector<size_t> drawCounts(passCount, 0);
+  if (impl_->logicalCB) {
+    drawCounts[0] = impl_->logicalCB->GetDrawCount();
+  }
+  uint32_t const workers = impl_->GetRecordWorkerCount();
+  pipelinecore::RecordSplitConfig split{};
+  if (workers == 0) {
+    split.maxChunksPerPass = 1;
+  }
+  auto& chunks = impl_->recordChunks;
+  pipelinecore::BuildRecordChunks(passCount, drawCounts.data(), split, chunks);
 
-    // Execute logical command buffer if we have one
-    if (impl_->logicalCB) {
+  if (workers == 0) {
+    // Single-threaded: record every pass into one command list
+    auto* cmd = BeginCommandList();
+    if (!cmd) return;
+    for (auto const& chunk : chunks) {
       ExecutionStats execStats{};
-      ExecuteLogicalCommandBufferOnDeviceThreadWithStats(cmd, impl_->logicalCB, frameSlot, &execStats);
-
-      impl_->stats.drawCallCount += execStats.drawCalls;
-      impl_->stats.instanceCount += execStats.instanceCount;
-      impl_->stats.triangleCount += execStats.triangleCount;
-      impl_->stats.vertexCount += execStats.vertexCount;
+      impl_->RecordPassChunk(chunk, cmd, targets, &execStats);
+      impl_->AccumulateStats(execStats);
     }
-
-    cmd->EndRenderPass();
+    EndCommandList(cmd);
+    return;
   }
 
-  EndCommandList(cmd);
+  // Multi-threaded: one pooled command list per chunk, submitted in compiled order
+  impl_->recorder.SetWorkerCount(workers);
+  std::vector<ExecutionStats> chunkStats(chunks.size());
+  std::vector<rhi::ICommandList*> lists;
+  bool recorded = impl_->recorder.Record(chunks,
+    [&](pipelinecore::RecordChunk const& chunk, rhi::ICommandList* cmd) {
+      size_t const chunkIndex = static_cast<size_t>(&chunk - chunks.data());
+      impl_->RecordPassChunk(chunk, cmd, targets, &chunkStats[chunkIndex]);
+    },
+    lists);
+  if (!recorded) return;
+
+  for (auto* cmd : lists) {
+    impl_->submitCtx->EnqueueCommandList(pipelinecore::QueueId::Graphics, cmd);
+  }
+  for (auto const& execStats : chunkStats) {
+    impl_->AccumulateStats(execStats);
+  }
 }
 
 void PipelineContext::Submit() {
+  TE_PROFILE_ZONE("SubmitPasses");
+  auto* ring = rendercore::GetDeviceUniformRing(impl_->device);
+  if (ring) {
+    ring->Flush();
+  }
   if (impl_->submitCtx) {
     impl_->submitCtx->SubmitQueue(pipelinecore::QueueId::Graphics);
   }
+  if (ring) {
+    ring->EndFrame(impl_->submitCtx ? impl_->submitCtx->GetQueueTimelineValue(pipelinecore::QueueId::Graphics) : 0);
+  }
 }
 
 void PipelineContext::Present() {
@@ -639,7 +744,8 @@ void PipelineContext::ExecutePostProcessPass(size_t passIndex, rhi::ICommandList
   // Bind descriptor set
   rhi::IDescriptorSet* ds = material->GetDescriptorSet();
   if (ds) {
-    cmd->BindDescriptorSet(ds);
+    uint32_t const uniformOffset = material->GetUniformBufferOffset();
+    cmd->BindDescriptorSet(0u, ds, &uniformOffset, 1u);
   }
 
   // Draw fullscreen quad
@@ -12,14 +12,20 @@
 #include <te/pipelinecore/LogicalCommandBuffer.h>
 #include <te/pipelinecore/ResourceManager.h>
 #include <te/pipelinecore/SubmitContext.h>
+#include <te/rendercore/pipeline_cache.hpp>
+#include <te/rendercore/uniform_buffer.hpp>
+#include <te/rhi/descriptor_set.hpp>
 #include <te/rhi/device.hpp>
 #include <te/rhi/swapchain.hpp>
 #include <te/rhi/sync.hpp>
+#include <te/shader/compiler.hpp>
+#include <te/shader/factory.hpp>
 
 #include <algorithm>
 #include <atomic>
 #include <chrono>
 #include <cmath>
+#include <cstring>
 #include <deque>
 #include <memory>
 #include <mutex>
@@ -48,6 +54,77 @@ bool IsGPUPound(RenderPhase phase) {
   return phase >= RenderPhase::Prepare && phase <= RenderPhase::Present;
 }
 
+// === Fallback Pipeline ===
+
+namespace {
+
+// Drawn while a material's PSO compiles: every vertex lands on one point, so the draw
+// rasterizes nothing instead of stalling the render thread on the compile
+char const kFallbackShaderSource[] =
+  "float4 VSMain(uint id : SV_VertexID) : SV_Position { return float4(0.0, 0.0, 0.0, 1.0); }\n"
+  "float4 PSMain() : SV_Target { return float4(0.0, 0.0, 0.0, 0.0); }\n";
+
+bool GetShaderTarget(rhi::Backend backend, shader::BackendType& outTarget) {
+  switch (backend) {
+    case rhi::Backend::Vulkan:
+    case rhi::Backend::Null: outTarget = shader::BackendType::SPIRV; return true;
+    case rhi::Backend::D3D12: outTarget = shader::BackendType::DXIL; return true;
+    case rhi::Backend::D3D11: outTarget = shader::BackendType::DXBC; return true;
+    case rhi::Backend::Metal: outTarget = shader::BackendType::MSL; return true;
+  }
+  return false;
+}
+
+/// Compiles the fallback shaders for the device and makes their PSO the cache's fallback, so
+/// materials request their PSOs without blocking. False when no compiler backend targets the
+/// device; materials then compile their PSOs synchronously.
+bool RegisterFallbackPipeline(rhi::IDevice* device, rendercore::IPipelineCache* cache) {
+  shader::BackendType target{};
+  if (!GetShaderTarget(device->GetBackend(), target)) return false;
+  shader::IShaderCompiler* compiler = shader::CreateShaderCompiler();
+  if (!compiler) return false;
+
+  shader::ShaderStage const stages[2] = {shader::ShaderStage::Vertex, shader::ShaderStage::Fragment};
+  char const* const entryPoints[2] = {"VSMain", "PSMain"};
+  std::vector<uint8_t> bytecode[2];
+  bool ok = true;
+  for (int i = 0; i < 2 && ok; ++i) {
+    shader::IShaderHandle* handle = compiler->LoadSourceFromMemory(
+      kFallbackShaderSource, sizeof(kFallbackShaderSource) - 1, shader::ShaderSourceFormat::HLSL);
+    shader::CompileOptions options;
+    options.targetBackend = target;
+    options.stage = stages[i];
+    std::strncpy(options.entryPoint, entryPoints[i], shader::CompileOptions::kMaxEntryPointLen - 1);
+    size_t size = 0;
+    void const* data = (handle && compiler->Compile(handle, options))
+      ? compiler->GetBytecode(handle, &size) : nullptr;
+    ok = data && size > 0;
+    if (ok) {
+      bytecode[i].assign(static_cast<uint8_t const*>(data), static_cast<uint8_t const*>(data) + size);
+    }
+    compiler->ReleaseHandle(handle);
+  }
+  shader::DestroyShaderCompiler(compiler);
+  if (!ok) return false;
+
+  // Set 0 starts like every material's: the uniform block at binding 0 with a dynamic offset
+  rhi::DescriptorSetLayoutDesc layout{};
+  layout.bindings[0] = {0u, static_cast<uint32_t>(rhi::DescriptorType::UniformBufferDynamic), 1u};
+  layout.bindingCount = 1;
+  rendercore::GraphicsPipelineDesc desc{};
+  desc.pso.vertex_shader = bytecode[0].data();
+  desc.pso.vertex_shader_size = bytecode[0].size();
+  desc.pso.fragment_shader = bytecode[1].data();
+  desc.pso.fragment_shader_size = bytecode[1].size();
+  desc.layout = &layout;
+  rendercore::PipelineHash hash = 0;
+  if (!cache->RequestSync(desc, &hash)) return false;
+  cache->SetFallback(hash);
+  return true;
+}
+
+}  // namespace
+
 // === RenderPipelineImpl ===
 
 class RenderPipelineImpl : public IRenderPipeline {
@@ -66,6 +143,9 @@ public:
     if (device) {
       InitFrameFences();
     }
+    if (isInitialized_) {
+      AttachPipelineCache();
+    }
   }
 
   rhi::IDevice* GetDevice() const override {
@@ -324,6 +404,8 @@ public:
     pipelineCtx_->SetSwapChain(swapChain_);
     pipelineCtx_->SetFrameGraph(frameGraph_);
 
+    AttachPipelineCache();
+
     isInitialized_ = true;
     return true;
   }
@@ -345,6 +427,7 @@ public:
     }
 
     pipelineCtx_.reset();
+    DetachPipelineCache();
     isInitialized_ = false;
   }
 
@@ -368,6 +451,34 @@ private:
     }
   }
 
+  // The device's shared pipeline cache and uniform ring live from the first Initialize or
+  // SetDevice with a device until Shutdown (or a switch to another device)
+  void AttachPipelineCache() {
+    if (!device_ || cacheDevice_ == device_) return;
+    DetachPipelineCache();
+    rendercore::IPipelineCache* cache = rendercore::GetDevicePipelineCache(device_);
+    if (!cache) return;
+    cacheDevice_ = device_;
+    RegisterFallbackPipeline(device_, cache);
+    // Precompile the PSOs recorded by the previous run on the cache's workers
+    if (config_->pipelineCachePath) {
+      cache->Load(config_->pipelineCachePath, config_->pipelineCacheVersion);
+    }
+  }
+
+  // Saves the cache and releases the device's shared objects; the GPU must be idle
+  void DetachPipelineCache() {
+    if (!cacheDevice_) return;
+    if (config_->pipelineCachePath) {
+      if (auto* cache = rendercore::GetDevicePipelineCache(cacheDevice_)) {
+        cache->Save(config_->pipelineCachePath, config_->pipelineCacheVersion);
+      }
+    }
+    rendercore::ReleaseDevicePipelineCache(cacheDevice_);
+    rendercore::ReleaseDeviceUniformRing(cacheDevice_);
+    cacheDevice_ = nullptr;
+  }
+
   void InitFrameFences() {
     // Clean up existing fences
     for (auto* fence : slotFences_) {
@@ -400,6 +511,7 @@ private:
 
 private:
   rhi::IDevice* device_{nullptr};
+  rhi::IDevice* cacheDevice_{nullptr};  // Device whose shared pipeline cache and uniform ring are in use
   RenderingConfig const* config_{&defaultConfig_};
   rhi::ISwapChain* swapChain_{nullptr};
   pipelinecore::IFrameGraph* frameGraph_{nullptr};
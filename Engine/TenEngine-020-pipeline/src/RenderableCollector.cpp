@@ -6,6 +6,7 @@
 #include <te/pipeline/detail/RenderableCollector.h>
 #include <te/pipeline/Culling.h>
 
+#include <te/pipelinecore/CollectPass.h>
 #include <te/pipelinecore/RenderItem.h>
 #include <te/world/WorldManager.h>
 #include <te/world/WorldTypes.h>
@@ -15,6 +16,7 @@
 #include <te/entity/Entity.h>
 #include <te/rendercore/IRenderElement.hpp>
 #include <te/rendercore/IRenderMesh.hpp>
+#include <te/core/profiling.h>
 
 #include <algorithm>
 #include <cmath>
@@ -115,97 +117,152 @@ static bool BoundsIntersectsFrustum(
   return true;
 }
 
-// === Renderable Collection ===
+// === Scene World Adapter ===
 
-void CollectRenderablesToRenderItemList(
-    CollectParams const& params,
-    te::resource::IResourceManager* resourceManager,
-    pipelinecore::IRenderItemList* outItems,
-    CollectStats* outStats) {
+void WorldSceneAdapter::Update(
+    te::scene::SceneRef sceneRef,
+    te::resource::IResourceManager* resourceManager) {
 
-  if (!outItems) return;
+  renderables_.clear();
+  culled_ = 0;
+  if (!sceneRef.IsValid()) return;
 
-  outItems->Clear();
-
-  if (outStats) {
-    *outStats = CollectStats{};
+  auto collect = [this](te::scene::ISceneNode*, te::world::RenderableItem const& ri) {
+    renderables_.push_back(ri);
+  };
+  auto& worldMgr = te::world::WorldManager::GetInstance();
+  if (resourceManager) {
+    worldMgr.CollectRenderables(sceneRef, resourceManager, collect);
+  } else {
+    worldMgr.CollectRenderables(sceneRef, collect);
   }
+}
 
-  // Get scene world from params
-  // The ISceneWorld interface should provide access to 029 WorldManager
-  // For now, we use WorldManager directly
+void WorldSceneAdapter::SetCollectParams(CollectParams const& params) {
+  params_ = params;
+}
 
-  auto& worldMgr = te::world::WorldManager::GetInstance();
-  te::scene::SceneRef sceneRef;
+void WorldSceneAdapter::SetChunkSize(size_t renderablesPerChunk) {
+  chunkSize_ = renderablesPerChunk > 0 ? renderablesPerChunk : 1;
+}
 
-  // Try to get scene ref from params
-  // The scene pointer could be the WorldManager's current level scene
-  sceneRef = worldMgr.GetCurrentLevelScene();
+size_t WorldSceneAdapter::GetCollectChunkCount() const {
+  return (renderables_.size() + chunkSize_ - 1) / chunkSize_;
+}
 
-  if (!sceneRef.IsValid()) {
-    return;
+void WorldSceneAdapter::CollectChunk(
+    size_t chunkIndex,
+    pipelinecore::FrameContext const& ctx,
+    pipelinecore::IRenderItemList* out) const {
+
+  (void)ctx;
+  if (!out) return;
+  size_t const begin = chunkIndex * chunkSize_;
+  size_t const end = std::min(begin + chunkSize_, renderables_.size());
+  uint32_t culled = 0;
+
+  for (size_t i = begin; i < end; ++i) {
+    te::world::RenderableItem const& ri = renderables_[i];
+
+    // Skip if no element (resource not loaded)
+    if (!ri.element) {
+      continue;
+    }
+
+    // Build RenderItem; the world matrix is copied into the item, so it stays
+    // valid after the next Update
+    pipelinecore::RenderItem item{};
+    item.element = ri.element;
+    item.submeshIndex = ri.submeshIndex;
+    std::memcpy(item.worldMatrix, ri.worldMatrix, sizeof(item.worldMatrix));
+
+    // Copy bounds
+    std::memcpy(item.bounds.min, ri.boundsMin, sizeof(item.bounds.min));
+    std::memcpy(item.bounds.max, ri.boundsMax, sizeof(item.bounds.max));
+
+    // Frustum culling
+    if (params_.enableCulling && params_.frustum) {
+      if (!BoundsIntersectsFrustum(item.bounds, params_.frustum)) {
+        culled++;
+        continue;
+      }
+    }
+
+    // Calculate sort key
+    item.sortKey = CalculateSortKey(
+      &item,
+      params_.cameraPosition[0],
+      params_.cameraPosition[1],
+      params_.cameraPosition[2],
+      true);
+
+    out->Push(item);
   }
 
-  uint32_t totalRenderables = 0;
-  uint32_t collectedRenderables = 0;
-  uint32_t culledRenderables = 0;
+  if (culled > 0) {
+    culled_ += culled;
+  }
+}
 
-  // Collect renderables from WorldManager
-  worldMgr.CollectRenderables(sceneRef, resourceManager,
-    [&](te::scene::ISceneNode* node, te::world::RenderableItem const& ri) {
-      totalRenderables++;
+// === Renderable Collection ===
 
-      // Skip if no element (resource not loaded)
-      if (!ri.element) {
-        return;
-      }
+namespace {
 
-      // Build RenderItem
-      pipelinecore::RenderItem item{};
-      item.element = ri.element;
-      item.submeshIndex = ri.submeshIndex;
-
-      // Copy world matrix pointer
-      // Note: The world matrix should remain valid during the frame
-      // In a real implementation, we'd copy or cache the matrix
-      static thread_local float s_matrix[16];
-      std::memcpy(s_matrix, ri.worldMatrix, sizeof(float) * 16);
-      item.transform = s_matrix;
-
-      // Copy bounds
-      item.bounds.min[0] = ri.boundsMin[0];
-      item.bounds.min[1] = ri.boundsMin[1];
-      item.bounds.min[2] = ri.boundsMin[2];
-      item.bounds.max[0] = ri.boundsMax[0];
-      item.bounds.max[1] = ri.boundsMax[1];
-      item.bounds.max[2] = ri.boundsMax[2];
-
-      // Frustum culling
-      if (params.enableCulling && params.frustum) {
-        if (!BoundsIntersectsFrustum(item.bounds, params.frustum)) {
-          culledRenderables++;
-          return;
-        }
-      }
+/// Adapter over the current level, reused per thread so its snapshot keeps its capacity
+WorldSceneAdapter& PrepareCurrentLevelAdapter(
+    CollectParams const& params,
+    te::resource::IResourceManager* resourceManager) {
+
+  static thread_local WorldSceneAdapter adapter;
+  adapter.SetCollectParams(params);
+  // The ISceneWorld in params is not used to locate the level yet; collect from the
+  // WorldManager's current level scene
+  adapter.Update(te::world::WorldManager::GetInstance().GetCurrentLevelScene(), resourceManager);
+  return adapter;
+}
+
+void FillCollectStats(
+    WorldSceneAdapter const& adapter,
+    pipelinecore::IRenderItemList const* outItems,
+    CollectStats* outStats) {
+
+  uint32_t const collected = static_cast<uint32_t>(outItems->Size());
+  TE_PROFILE_COUNTER("Renderables.Collected", collected);
+  TE_PROFILE_COUNTER("Renderables.Culled", adapter.GetCulledCount());
+
+  if (outStats) {
+    outStats->totalRenderables = static_cast<uint32_t>(adapter.GetRenderableCount());
+    outStats->collectedRenderables = collected;
+    outStats->culledRenderables = adapter.GetCulledCount();
+  }
+}
+
+}  // namespace
+
+void CollectRenderablesToRenderItemList(
+    CollectParams const& params,
+    te::resource::IResourceManager* resourceManager,
+    pipelinecore::IRenderItemList* outItems,
+    CollectStats* outStats) {
 
-      // Calculate sort key
-      item.sortKey = CalculateSortKey(
-        &item,
-        params.cameraPosition[0],
-        params.cameraPosition[1],
-        params.cameraPosition[2],
-        true);
+  TE_PROFILE_ZONE("CollectRenderables");
+  if (!outItems) return;
 
-      // Add to output list
-      outItems->Push(item);
-      collectedRenderables++;
-    });
+  outItems->Clear();
 
   if (outStats) {
-    outStats->totalRenderables = totalRenderables;
-    outStats->collectedRenderables = collectedRenderables;
-    outStats->culledRenderables = culledRenderables;
+    *outStats = CollectStats{};
   }
+
+  WorldSceneAdapter& adapter = PrepareCurrentLevelAdapter(params, resourceManager);
+  pipelinecore::FrameContext ctx{};
+  ctx.scene = &adapter;
+  size_t const chunkCount = adapter.GetCollectChunkCount();
+  for (size_t chunk = 0; chunk < chunkCount; ++chunk) {
+    adapter.CollectChunk(chunk, ctx, outItems);
+  }
+
+  FillCollectStats(adapter, outItems, outStats);
 }
 
 void CollectAllRenderables(
@@ -333,17 +390,24 @@ void CollectRenderablesParallel(
 
   if (!outItems) return;
 
-  outItems->Clear();
-
   if (threadCount <= 1) {
     // Single-threaded fallback
     CollectRenderablesToRenderItemList(params, resourceManager, outItems, outStats);
     return;
   }
 
-  // For now, fall back to single-threaded collection
-  // Parallel collection requires scene partitioning which is complex
-  CollectRenderablesToRenderItemList(params, resourceManager, outItems, outStats);
+  TE_PROFILE_ZONE("CollectRenderablesParallel");
+  if (outStats) {
+    *outStats = CollectStats{};
+  }
+
+  WorldSceneAdapter& adapter = PrepareCurrentLevelAdapter(params, resourceManager);
+  pipelinecore::SetCollectWorkerCount(threadCount - 1);
+  pipelinecore::FrameContext ctx{};
+  ctx.scene = &adapter;
+  pipelinecore::CollectRenderItemsParallel(nullptr, ctx, outItems);
+
+  FillCollectStats(adapter, outItems, outStats);
 }
 
 }  // namespace te::pipeline
@@ -0,0 +1,153 @@
+/**
+ * @file SnapshotStore.h
+ * @brief Incremental level snapshots for undo/redo and autosave.
+ */
+#ifndef TE_EDITOR_SNAPSHOT_STORE_H
+#define TE_EDITOR_SNAPSHOT_STORE_H
+
+#include <te/world/WorldTypes.h>
+#include <te/entity/EntityId.h>
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+namespace te {
+namespace editor {
+
+/**
+ * @brief Snapshot identifier; 0 is invalid.
+ */
+using SnapshotId = uint64_t;
+constexpr SnapshotId kInvalidSnapshotId = 0;
+
+/**
+ * @brief Snapshot store statistics.
+ */
+struct SnapshotStats {
+  size_t snapshotCount = 0;     ///< Snapshots kept in history
+  size_t recordCount = 0;       ///< Properties tracked in the head state
+  size_t chunkCount = 0;        ///< Unique values in the chunk store
+  size_t chunkBytes = 0;        ///< Bytes held by the chunk store
+  size_t lastDeltaCount = 0;    ///< Properties changed by the last capture, restore or replay
+  size_t lastSkippedCount = 0;  ///< Properties the last restore or replay could not apply
+  size_t lastJournalBytes = 0;  ///< Bytes appended by the last journal write
+};
+
+/**
+ * @brief Property-level snapshot store for a level.
+ *
+ * Each entity is captured as records keyed by (entity, component type, property index):
+ * the entity's transform, active flag and parent, plus every property of its components
+ * as described by the te::object TypeRegistry. Values live in a content-addressed chunk
+ * store and each snapshot keeps only the records that changed since the previous one,
+ * so capture, restore and journal writes cost is proportional to what changed.
+ *
+ * Restore writes property values back into live entities and components; creating or
+ * destroying entities and components stays with the command-based undo system.
+ *
+ * Records are keyed by store-assigned entity keys rather than entity addresses, so an
+ * entity created at a destroyed entity's address never receives its values. Entities
+ * loaded with the level are also tied to their position in the level asset, which is how
+ * a journal finds them again after the level is reloaded in a later session.
+ */
+class ISnapshotStore {
+public:
+  virtual ~ISnapshotStore() = default;
+
+  /**
+   * @brief Track a level; clears history and restarts the journal.
+   *
+   * Call right after the level is loaded: its entities are matched to the level asset
+   * in their current order.
+   */
+  virtual void SetLevel(te::world::LevelHandle level) = 0;
+
+  /**
+   * @brief The level was saved: match entities to the saved asset and restart the journal.
+   */
+  virtual void MarkLevelSaved() = 0;
+
+  /**
+   * @brief Capture every entity of the level.
+   * @return New snapshot ID, or the head ID if nothing changed
+   */
+  virtual SnapshotId Capture(char const* label) = 0;
+
+  /**
+   * @brief Capture only the given entities (cheap path after a known edit).
+   * @return New snapshot ID, or the head ID if nothing changed
+   */
+  virtual SnapshotId CaptureEntities(std::vector<te::entity::EntityId> const& entities,
+                                     char const* label) = 0;
+
+  /**
+   * @brief Restore the level to a snapshot in history.
+   * @return true if the snapshot exists
+   */
+  virtual bool Restore(SnapshotId id) = 0;
+
+  /**
+   * @brief Restore the previous snapshot.
+   */
+  virtual bool Undo() = 0;
+
+  /**
+   * @brief Restore the next snapshot (after Undo).
+   */
+  virtual bool Redo() = 0;
+
+  virtual bool CanUndo() const = 0;
+  virtual bool CanRedo() const = 0;
+
+  /**
+   * @brief Snapshot the level currently matches.
+   */
+  virtual SnapshotId GetHead() const = 0;
+
+  /**
+   * @brief Label of a snapshot in history, or nullptr.
+   */
+  virtual char const* GetLabel(SnapshotId id) const = 0;
+
+  /**
+   * @brief Maximum snapshots kept; the oldest are dropped first (default 100).
+   */
+  virtual void SetMaxSnapshots(size_t count) = 0;
+
+  /**
+   * @brief Append the head state to a binary journal file.
+   *
+   * The first write to a path stores the full state; later writes append only
+   * the values and records changed since the previous write.
+   * @return true on success
+   */
+  virtual bool WriteJournal(char const* path) = 0;
+
+  /**
+   * @brief Apply the state of the last complete commit in a journal to the live entities.
+   *
+   * Records after the last commit (a write cut short) and everything after a corrupt or
+   * truncated record are ignored. Values go to the entities at the same level-asset
+   * positions as when the journal was written, so the store may be a new one tracking a
+   * freshly loaded copy of the level; entities created after that load are skipped.
+   * Values are applied like Restore; history is unchanged, so Capture afterwards to make
+   * the replayed state a snapshot.
+   * @return Snapshot ID of the last commit, or kInvalidSnapshotId if the file is missing,
+   *         not a journal, was written against a different level or holds no complete commit
+   */
+  virtual SnapshotId ReplayJournal(char const* path) = 0;
+
+  /**
+   * @brief Drop all snapshots and values.
+   */
+  virtual void Clear() = 0;
+
+  virtual SnapshotStats GetStats() const = 0;
+};
+
+ISnapshotStore* CreateSnapshotStore();
+
+}  // namespace editor
+}  // namespace te
+
+#endif  // TE_EDITOR_SNAPSHOT_STORE_H
@@ -13,6 +13,7 @@
 #include <te/editor/Viewport.h>
 #include <te/editor/RenderingSettingsPanel.h>
 #include <te/editor/UndoSystem.h>
+#include <te/editor/SnapshotStore.h>
 // New components
 #include <te/editor/Gizmo.h>
 #include <te/editor/EditorCamera.h>
@@ -38,6 +39,7 @@
 #include <te/world/CameraComponent.h>
 #include <te/world/ModelComponent.h>
 #include <te/resource/ResourceManager.h>
+#include <te/resource/ResourceHotReload.h>
 #include <te/resource/ResourceTypes.h>
 #include <te/resource/Resource.h>
 #include <te/entity/EntityId.h>
@@ -107,6 +109,7 @@ public:
   EditorImpl() {
     // Existing components
     m_undoSystem = CreateUndoSystem(50);
+    m_snapshotStore = CreateSnapshotStore();
     m_sceneView = CreateSceneView();
     m_resourceView = CreateResourceView();
     m_propertyPanel = CreatePropertyPanel(m_undoSystem);
@@ -164,6 +167,7 @@ public:
     delete m_propertyPanel;
     delete m_resourceView;
     delete m_sceneView;
+    delete m_snapshotStore;
     delete m_undoSystem;
   }
 
@@ -187,6 +191,14 @@ public:
       OnGameUpdate(frameTime);
     }
 
+    // Property edits become an undo step once the drag or text edit that made them ends
+    if (ImGui::GetCurrentContext() && !ImGui::IsAnyItemActive()) CaptureEdits();
+    AutosaveIfDue();
+
+    // Apply asset changes picked up by the file watcher, batched once per frame
+    te::resource::GetHotReloadManager()->ProcessPendingReloads(
+        g_editorCtx.resourceManager ? g_editorCtx.resourceManager : te::resource::GetResourceManager());
+
 #if TE_PLATFORM_WINDOWS
     if (!ImGuiBackend_IsInitialized()) {
       ImGuiBackend_RegisterWndProcHandler(g_editorCtx.application);
@@ -300,8 +312,8 @@ public:
   void DrawMainEditorUI() {
     // Update menu states before drawing
     if (m_mainMenu) {
-      bool canUndo = m_undoSystem && m_undoSystem->CanUndo();
-      bool canRedo = m_undoSystem && m_undoSystem->CanRedo();
+      bool canUndo = (m_snapshotStore && m_snapshotStore->CanUndo()) || (m_undoSystem && m_undoSystem->CanUndo());
+      bool canRedo = (m_snapshotStore && m_snapshotStore->CanRedo()) || (m_undoSystem && m_undoSystem->CanRedo());
       bool hasSelection = m_selectionManager && m_selectionManager->GetSelectionCount() > 0;
       bool hasLevel = m_levelHandle.IsValid();
       m_mainMenu->UpdateStandardMenuStates(canUndo, canRedo, hasSelection, hasLevel);
@@ -457,10 +469,10 @@ public:
     } else if (menu == "Edit") {
       switch (itemId) {
         case IMainMenu::ID_UNDO:
-          if (m_undoSystem) m_undoSystem->Undo();
+          UndoEdit();
           break;
         case IMainMenu::ID_REDO:
-          if (m_undoSystem) m_undoSystem->Redo();
+          RedoEdit();
           break;
         case IMainMenu::ID_CUT:
           // TODO: Implement cut
@@ -745,10 +757,12 @@ public:
         te::world::WorldManager::GetInstance().UnloadLevel(m_levelHandle);
         m_levelHandle = te::world::LevelHandle();
         if (m_sceneView) m_sceneView->SetLevelHandle(nullptr);
+        if (m_snapshotStore) m_snapshotStore->SetLevel(m_levelHandle);
       }
       m_currentLevelPath.clear();
     }
     std::error_code ec;
+    std::filesystem::remove(std::filesystem::u8path(path + ".autosave"), ec);
     std::filesystem::remove(std::filesystem::u8path(path), ec);
     if (ec) {
       te::core::Log(te::core::LogLevel::Error, ("Editor: failed to delete level file: " + path).c_str());
@@ -781,14 +795,24 @@ public:
     te::resource::IResourceManager* mgr = g_editorCtx.resourceManager ? g_editorCtx.resourceManager
                                                                      : te::resource::GetResourceManager();
     if (!mgr) return;
-    std::string path = m_currentLevelPath.empty()
-                           ? te::core::PathJoin(g_editorCtx.projectRootPath ? g_editorCtx.projectRootPath : ".", "assets/levels/untitled.level.xml")
-                           : m_currentLevelPath;
+    std::string path = LevelSavePath();
     if (te::world::WorldManager::GetInstance().SaveLevel(m_levelHandle, path.c_str())) {
       m_currentLevelPath = path;
+      if (m_snapshotStore) {
+        // The saved file now holds every edit; the journal restarts against it
+        m_snapshotStore->MarkLevelSaved();
+        std::error_code ec;
+        std::filesystem::remove(std::filesystem::u8path(path + ".autosave"), ec);
+      }
     }
   }
 
+  std::string LevelSavePath() const {
+    return m_currentLevelPath.empty()
+               ? te::core::PathJoin(g_editorCtx.projectRootPath ? g_editorCtx.projectRootPath : ".", "assets/levels/untitled.level.xml")
+               : m_currentLevelPath;
+  }
+
   void OnNewScene() {
     te::core::AABB bounds;
     bounds.min = {-1000.f, -1000.f, -1000.f};
@@ -799,6 +823,7 @@ public:
     if (m_levelHandle.IsValid()) {
       m_phase = Phase::MainEditor;
       if (m_sceneView) m_sceneView->SetLevelHandle(m_levelHandle.value);
+      BeginSnapshots();
     }
   }
 
@@ -865,6 +890,84 @@ public:
       m_phase = Phase::MainEditor;
       m_currentLevelPath = path;
       if (m_sceneView) m_sceneView->SetLevelHandle(m_levelHandle.value);
+      BeginSnapshots();
+      RecoverAutosave();
+    }
+  }
+
+  /**
+   * @brief Start snapshot history for the level just created or opened.
+   */
+  void BeginSnapshots() {
+    if (!m_snapshotStore) return;
+    m_snapshotStore->SetLevel(m_levelHandle);
+    m_snapshotStore->Capture("Open Level");
+    m_lastAutosaveTime = std::chrono::steady_clock::now();
+  }
+
+  /**
+   * @brief Autosave per preferences: capture what changed and append it to the
+   * level's ".autosave" journal instead of re-exporting the whole level.
+   */
+  void AutosaveIfDue() {
+    if (!m_snapshotStore || !m_preferences || !m_levelHandle.IsValid()) return;
+    if (m_phase != Phase::MainEditor || m_playModeState != PlayModeState::Stopped) return;
+    AutoSaveSettings settings = m_preferences->GetAutoSaveSettings();
+    if (!settings.enabled || settings.intervalSeconds <= 0) return;
+    auto now = std::chrono::steady_clock::now();
+    if (now - m_lastAutosaveTime < std::chrono::seconds(settings.intervalSeconds)) return;
+    m_lastAutosaveTime = now;
+
+    m_snapshotStore->Capture("Autosave");
+    m_snapshotStore->WriteJournal((LevelSavePath() + ".autosave").c_str());
+  }
+
+  /**
+   * @brief Apply the ".autosave" journal a previous session left next to the level just
+   * opened (it is removed on save, so one exists only if edits were not saved). The
+   * recovered edits become one undoable step on top of the saved level.
+   */
+  void RecoverAutosave() {
+    if (!m_snapshotStore) return;
+    std::string const journal = LevelSavePath() + ".autosave";
+    if (!te::core::FileExists(journal)) return;
+    if (m_snapshotStore->ReplayJournal(journal.c_str()) == kInvalidSnapshotId) return;
+    m_snapshotStore->Capture("Recover Autosave");
+    te::core::Log(te::core::LogLevel::Info, ("Editor: recovered unsaved changes from " + journal).c_str());
+  }
+
+  /**
+   * @brief Snapshot the selected entities; property panel and gizmo edits write to
+   * entities directly, so this is what turns them into undo steps. No-op if nothing changed.
+   */
+  void CaptureEdits() {
+    if (!m_snapshotStore || !m_selectionManager || !m_levelHandle.IsValid()) return;
+    if (m_phase != Phase::MainEditor || m_playModeState != PlayModeState::Stopped) return;
+    if (!m_selectionManager->HasSelection()) return;
+    m_snapshotStore->CaptureEntities(m_selectionManager->GetSelection(), "Edit");
+  }
+
+  /**
+   * @brief Edit > Undo: property edits go back through the snapshot store; the command
+   * undo system handles what the snapshot history cannot (entity create/destroy).
+   */
+  void UndoEdit() {
+    if (m_playModeState != PlayModeState::Stopped) return;
+    CaptureEdits();
+    if (m_snapshotStore && m_snapshotStore->CanUndo()) {
+      m_snapshotStore->Undo();
+    } else if (m_undoSystem) {
+      m_undoSystem->Undo();
+    }
+  }
+
+  void RedoEdit() {
+    if (m_playModeState != PlayModeState::Stopped) return;
+    CaptureEdits();
+    if (m_snapshotStore && m_snapshotStore->CanRedo()) {
+      m_snapshotStore->Redo();
+    } else if (m_undoSystem) {
+      m_undoSystem->Redo();
     }
   }
 
@@ -885,6 +988,7 @@ public:
         ctx.resourceManager->SetAssetRoot(root.c_str());
         ctx.resourceManager->LoadAllManifests();
       }
+      te::resource::GetHotReloadManager()->AddWatchPath(root, true);
     }
     g_editorCtx = ctx;
     g_editorInstance = this;
@@ -1167,6 +1271,8 @@ private:
 
   // Existing components
   IUndoSystem* m_undoSystem = nullptr;
+  ISnapshotStore* m_snapshotStore = nullptr;
+  std::chrono::steady_clock::time_point m_lastAutosaveTime;
   ISceneView* m_sceneView = nullptr;
   IResourceView* m_resourceView = nullptr;
   IPropertyPanel* m_propertyPanel = nullptr;
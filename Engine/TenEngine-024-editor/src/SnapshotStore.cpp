@@ -0,0 +1,821 @@
+/**
+ * @file SnapshotStore.cpp
+ * @brief Incremental level snapshots (024-Editor).
+ *
+ * Journal layout (little-endian): "TESJ" u32 version u64 levelSignature, then records:
+ *   1 Chunk  { u64 chunkId, u32 size, bytes }     - value not yet in the file
+ *   2 Set    { u64 entity, u32 type, u32 property, u64 chunkId }  - chunkId 0 removes
+ *   3 Commit { u64 snapshotId, u32 labelSize, label }
+ *   4 Bind   { u64 entity, u32 assetIndex }       - entity's position in the level asset
+ * A reader replays Set records in order; state after the last Commit is consistent
+ * (ReplayJournal drops whatever follows it, e.g. a write cut short by a crash).
+ *
+ * Entity keys are numbered per store and never reused, so a record cannot land on an
+ * entity that took over a destroyed entity's address. A new file starts with a Bind for
+ * every entity that came from the level asset: the pre-order position is what a later
+ * session matches after loading the same asset, and the signature (entity names and
+ * child counts in that order) rejects a journal written against a different asset.
+ */
+#include <te/editor/SnapshotStore.h>
+#include <te/world/WorldManager.h>
+#include <te/entity/Entity.h>
+#include <te/entity/EntityManager.h>
+#include <te/entity/Component.h>
+#include <te/entity/PropertyReflection.h>
+#include <te/object/TypeRegistry.h>
+#include <te/scene/SceneTypes.h>
+#include <te/core/platform.h>
+#include <te/core/log.h>
+#include <algorithm>
+#include <climits>
+#include <cstring>
+#include <deque>
+#include <string>
+#include <unordered_map>
+#include <unordered_set>
+
+namespace te {
+namespace editor {
+
+namespace {
+
+constexpr uint32_t kJournalMagic = 0x4A534554u;  // "TESJ"
+constexpr uint32_t kJournalVersion = 2;
+constexpr uint8_t kJournalChunk = 1;
+constexpr uint8_t kJournalSet = 2;
+constexpr uint8_t kJournalCommit = 3;
+constexpr uint8_t kJournalBind = 4;
+
+constexpr uint32_t kNoAssetIndex = UINT32_MAX;  // Entity created after the level was loaded
+
+// Entity-level records use type 0; property indices below
+constexpr uint32_t kEntityName = 0;
+constexpr uint32_t kEntityTransform = 1;
+constexpr uint32_t kEntityActive = 2;
+constexpr uint32_t kEntityParent = 3;
+
+using ChunkId = uint64_t;  // Content hash; 0 means "absent"
+
+struct RecordKey {
+  uint64_t entity = 0;
+  uint32_t type = 0;
+  uint32_t property = 0;
+
+  bool operator==(RecordKey const& o) const {
+    return entity == o.entity && type == o.type && property == o.property;
+  }
+};
+
+struct RecordKeyHash {
+  size_t operator()(RecordKey const& k) const {
+    uint64_t h = k.entity * 0x9E3779B97F4A7C15ull;
+    h ^= (static_cast<uint64_t>(k.type) << 32 | k.property) + 0x632BE59BD9B4E019ull + (h << 6) + (h >> 2);
+    return static_cast<size_t>(h);
+  }
+};
+
+struct Chunk {
+  std::vector<uint8_t> bytes;
+  uint32_t refs = 0;
+  bool journaled = false;
+};
+
+struct DeltaEntry {
+  RecordKey key;
+  ChunkId oldChunk = 0;
+  ChunkId newChunk = 0;
+};
+
+struct Snapshot {
+  SnapshotId id = kInvalidSnapshotId;
+  std::string label;
+  std::vector<DeltaEntry> delta;  // Changes from the previous snapshot (empty for the oldest)
+};
+
+struct Field {
+  size_t offset = 0;
+  size_t size = 0;
+};
+
+/** Live entity behind an entity key. */
+struct EntityBinding {
+  te::entity::EntityId id;
+  uint64_t serial = 0;
+  uint32_t assetIndex = kNoAssetIndex;
+};
+
+uint64_t HashBytes(void const* data, size_t size) {
+  uint8_t const* p = static_cast<uint8_t const*>(data);
+  uint64_t h = 1469598103934665603ull ^ size;
+  for (size_t i = 0; i < size; ++i) {
+    h = (h ^ p[i]) * 1099511628211ull;
+  }
+  return h;
+}
+
+template <typename T>
+void Append(std::vector<uint8_t>& out, T const& value) {
+  uint8_t const* p = reinterpret_cast<uint8_t const*>(&value);
+  out.insert(out.end(), p, p + sizeof(T));
+}
+
+/** Bounds-checked reads over a journal file. */
+struct JournalReader {
+  uint8_t const* data = nullptr;
+  size_t size = 0;
+  size_t pos = 0;
+
+  template <typename T>
+  bool Read(T& value) {
+    if (size - pos < sizeof(T)) return false;
+    std::memcpy(&value, data + pos, sizeof(T));
+    pos += sizeof(T);
+    return true;
+  }
+
+  bool ReadBytes(size_t count, uint8_t const*& out) {
+    if (size - pos < count) return false;
+    out = data + pos;
+    pos += count;
+    return true;
+  }
+};
+
+struct JournalValue {
+  uint8_t const* data = nullptr;
+  uint32_t size = 0;
+};
+
+/**
+ * Entities of a level in asset order: roots as registered, each followed by its
+ * children in attach order, which is the order loading the saved asset creates them in.
+ * Inactive entities are included (scene traversal skips them).
+ */
+void CollectLevelEntities(te::world::LevelHandle level, std::vector<te::entity::Entity*>& out) {
+  out.clear();
+  std::vector<te::scene::ISceneNode*> stack;
+  te::world::WorldManager::GetInstance().GetRootNodes(level, stack);
+  std::reverse(stack.begin(), stack.end());
+  std::vector<te::scene::ISceneNode*> children;
+  while (!stack.empty()) {
+    te::scene::ISceneNode* node = stack.back();
+    stack.pop_back();
+    if (te::entity::Entity* entity = dynamic_cast<te::entity::Entity*>(node)) out.push_back(entity);
+    children.clear();
+    node->GetChildren(children);
+    stack.insert(stack.end(), children.rbegin(), children.rend());
+  }
+}
+
+uint64_t LevelSignature(std::vector<te::entity::Entity*> const& entities) {
+  uint64_t h = 1469598103934665603ull ^ entities.size();
+  for (te::entity::Entity* entity : entities) {
+    char const* name = entity->GetName();
+    h = (h ^ HashBytes(name ? name : "", name ? std::strlen(name) : 0)) * 1099511628211ull;
+    h = (h ^ entity->GetChildCount()) * 1099511628211ull;
+  }
+  return h;
+}
+
+}  // namespace
+
+class SnapshotStoreImpl : public ISnapshotStore {
+public:
+  ~SnapshotStoreImpl() override = default;
+
+  void SetLevel(te::world::LevelHandle level) override {
+    Clear();
+    m_bindings.clear();
+    m_keyById.clear();
+    m_level = level;
+    BindLevelAsset();
+  }
+
+  void MarkLevelSaved() override {
+    m_journalPath.clear();
+    BindLevelAsset();
+  }
+
+  SnapshotId Capture(char const* label) override {
+    if (!m_level.IsValid()) return GetHead();
+    std::vector<DeltaEntry> delta;
+    std::unordered_set<uint64_t> visited;
+    CollectLevelEntities(m_level, m_levelEntities);
+    for (te::entity::Entity* entity : m_levelEntities) visited.insert(ScanEntity(entity, delta));
+    std::vector<uint64_t> removed;
+    for (auto const& kv : m_bindings) {
+      if (visited.find(kv.first) == visited.end()) removed.push_back(kv.first);
+    }
+    for (uint64_t e : removed) DropEntity(e, delta);
+    return PushSnapshot(std::move(delta), label);
+  }
+
+  SnapshotId CaptureEntities(std::vector<te::entity::EntityId> const& entities,
+                             char const* label) override {
+    std::vector<DeltaEntry> delta;
+    te::entity::EntityManager& mgr = te::entity::EntityManager::GetInstance();
+    for (te::entity::EntityId id : entities) {
+      te::entity::Entity* entity = mgr.GetEntity(id);
+      if (entity) {
+        ScanEntity(entity, delta);
+      } else {
+        auto it = m_keyById.find(id);
+        if (it != m_keyById.end()) DropEntity(it->second, delta);
+      }
+    }
+    return PushSnapshot(std::move(delta), label);
+  }
+
+  bool Restore(SnapshotId id) override {
+    if (m_snapshots.empty()) return false;
+    size_t target = FindSnapshot(id);
+    if (target == SIZE_MAX) return false;
+    if (target == m_head) return true;
+
+    // Walk deltas between head and target; the last write per key is the target value
+    std::unordered_map<RecordKey, ChunkId, RecordKeyHash> changes;
+    if (target < m_head) {
+      for (size_t i = m_head; i > target; --i) {
+        for (DeltaEntry const& d : m_snapshots[i].delta) changes[d.key] = d.oldChunk;
+      }
+    } else {
+      for (size_t i = m_head + 1; i <= target; ++i) {
+        for (DeltaEntry const& d : m_snapshots[i].delta) changes[d.key] = d.newChunk;
+      }
+    }
+
+    size_t applied = 0;
+    size_t skipped = 0;
+    for (auto const& kv : changes) {
+      auto it = m_state.find(kv.first);
+      ChunkId current = it != m_state.end() ? it->second : 0;
+      if (current == kv.second) continue;
+      if (!ApplyRecord(kv.first, kv.second)) {
+        ++skipped;
+        continue;
+      }
+      SetState(kv.first, kv.second);
+      ++applied;
+    }
+    m_head = target;
+    m_lastDeltaCount = applied;
+    m_lastSkippedCount = skipped;
+    return true;
+  }
+
+  bool Undo() override { return CanUndo() && Restore(m_snapshots[m_head - 1].id); }
+  bool Redo() override { return CanRedo() && Restore(m_snapshots[m_head + 1].id); }
+  bool CanUndo() const override { return !m_snapshots.empty() && m_head > 0; }
+  bool CanRedo() const override { return m_head + 1 < m_snapshots.size(); }
+
+  SnapshotId GetHead() const override {
+    return m_snapshots.empty() ? kInvalidSnapshotId : m_snapshots[m_head].id;
+  }
+
+  char const* GetLabel(SnapshotId id) const override {
+    size_t index = FindSnapshot(id);
+    return index == SIZE_MAX ? nullptr : m_snapshots[index].label.c_str();
+  }
+
+  void SetMaxSnapshots(size_t count) override {
+    m_maxSnapshots = count < 2 ? 2 : count;
+    TrimHistory();
+  }
+
+  bool WriteJournal(char const* path) override {
+    if (!path || !*path) return false;
+    std::vector<uint8_t> out;
+    bool fresh = m_journalPath != path;
+    if (fresh) {
+      // New file: write every tracked record
+      for (auto& kv : m_chunks) kv.second.journaled = false;
+      Append(out, kJournalMagic);
+      Append(out, kJournalVersion);
+      Append(out, m_levelSignature);
+      for (auto const& kv : m_bindings) {
+        if (kv.second.assetIndex == kNoAssetIndex) continue;
+        Append(out, kJournalBind);
+        Append(out, kv.first);
+        Append(out, kv.second.assetIndex);
+      }
+      for (auto const& kv : m_state) WriteSet(out, kv.first, kv.second);
+    } else {
+      for (RecordKey const& key : m_journalDirty) {
+        auto it = m_state.find(key);
+        WriteSet(out, key, it != m_state.end() ? it->second : 0);
+      }
+    }
+    SnapshotId head = GetHead();
+    char const* label = GetLabel(head);
+    uint32_t labelSize = label ? static_cast<uint32_t>(std::strlen(label)) : 0;
+    Append(out, kJournalCommit);
+    Append(out, head);
+    Append(out, labelSize);
+    if (labelSize) out.insert(out.end(), label, label + labelSize);
+
+    if (!te::core::FileWriteBinary(path, out.data(), out.size(), fresh ? 0 : SIZE_MAX)) {
+      te::core::Log(te::core::LogLevel::Error, (std::string("SnapshotStore: failed to write journal: ") + path).c_str());
+      m_journalPath.clear();
+      return false;
+    }
+    m_journalPath = path;
+    m_journalDirty.clear();
+    m_lastJournalBytes = out.size();
+    return true;
+  }
+
+  SnapshotId ReplayJournal(char const* path) override {
+    m_lastDeltaCount = 0;
+    m_lastSkippedCount = 0;
+    if (!path || !*path) return kInvalidSnapshotId;
+    auto file = te::core::FileRead(path);
+    if (!file) return kInvalidSnapshotId;
+
+    JournalReader r{file->data(), file->size()};
+    uint32_t magic = 0;
+    uint32_t version = 0;
+    uint64_t signature = 0;
+    if (!r.Read(magic) || !r.Read(version) || magic != kJournalMagic || version != kJournalVersion ||
+        !r.Read(signature)) {
+      te::core::Log(te::core::LogLevel::Error, (std::string("SnapshotStore: not a snapshot journal: ") + path).c_str());
+      return kInvalidSnapshotId;
+    }
+    if (signature != m_levelSignature) {
+      te::core::Log(te::core::LogLevel::Warn,
+                    (std::string("SnapshotStore: journal was written for a different level, not replayed: ") + path).c_str());
+      return kInvalidSnapshotId;
+    }
+
+    // Values point into the file; Sets stay pending until their Commit is read
+    std::unordered_map<uint64_t, uint32_t> assetIndexOf;  // Journal entity key -> asset position
+    std::unordered_map<ChunkId, JournalValue> values;
+    std::unordered_map<RecordKey, ChunkId, RecordKeyHash> committed;
+    std::unordered_map<RecordKey, ChunkId, RecordKeyHash> pending;
+    SnapshotId lastCommit = kInvalidSnapshotId;
+    for (;;) {
+      size_t const recordStart = r.pos;
+      uint8_t tag = 0;
+      if (!r.Read(tag)) break;
+      bool ok = false;
+      if (tag == kJournalChunk) {
+        ChunkId id = 0;
+        JournalValue value;
+        ok = r.Read(id) && r.Read(value.size) && r.ReadBytes(value.size, value.data) && id != 0;
+        if (ok) values[id] = value;
+      } else if (tag == kJournalBind) {
+        uint64_t entity = 0;
+        uint32_t assetIndex = 0;
+        ok = r.Read(entity) && r.Read(assetIndex);
+        if (ok) assetIndexOf[entity] = assetIndex;
+      } else if (tag == kJournalSet) {
+        RecordKey key;
+        ChunkId id = 0;
+        ok = r.Read(key.entity) && r.Read(key.type) && r.Read(key.property) && r.Read(id) &&
+             (id == 0 || values.find(id) != values.end());
+        if (ok) pending[key] = id;
+      } else if (tag == kJournalCommit) {
+        SnapshotId id = kInvalidSnapshotId;
+        uint32_t labelSize = 0;
+        uint8_t const* label = nullptr;
+        ok = r.Read(id) && r.Read(labelSize) && r.ReadBytes(labelSize, label);
+        if (ok) {
+          for (auto const& kv : pending) committed[kv.first] = kv.second;
+          pending.clear();
+          lastCommit = id;
+        }
+      }
+      if (!ok) {
+        te::core::Log(te::core::LogLevel::Warn,
+                      (std::string("SnapshotStore: journal truncated or corrupt at byte ") +
+                       std::to_string(recordStart) + ", replaying up to the last commit: " + path).c_str());
+        break;
+      }
+    }
+    if (lastCommit == kInvalidSnapshotId) return kInvalidSnapshotId;
+
+    // Journal keys reach live entities through their position in the level asset
+    std::vector<te::entity::Entity*> byAssetIndex;
+    for (auto const& kv : m_bindings) {
+      uint32_t const index = kv.second.assetIndex;
+      if (index == kNoAssetIndex) continue;
+      if (byAssetIndex.size() <= index) byAssetIndex.resize(index + 1, nullptr);
+      byAssetIndex[index] = FindEntity(kv.first);
+    }
+    auto resolve = [&](uint64_t journalKey) -> te::entity::Entity* {
+      auto it = assetIndexOf.find(journalKey);
+      return it != assetIndexOf.end() && it->second < byAssetIndex.size() ? byAssetIndex[it->second] : nullptr;
+    };
+
+    size_t applied = 0;
+    size_t skipped = 0;
+    for (auto const& kv : committed) {
+      if (kv.second == 0) continue;  // Removed records are structural
+      JournalValue const& value = values[kv.second];
+      if (ApplyValue(resolve(kv.first.entity), kv.first, value.data, value.size, resolve)) {
+        ++applied;
+      } else {
+        ++skipped;
+      }
+    }
+    m_lastDeltaCount = applied;
+    m_lastSkippedCount = skipped;
+    return lastCommit;
+  }
+
+  void Clear() override {
+    m_snapshots.clear();
+    m_state.clear();
+    m_entityKeys.clear();
+    m_chunks.clear();
+    m_chunkBytes = 0;
+    m_journalDirty.clear();
+    m_journalPath.clear();
+    m_head = 0;
+    m_lastDeltaCount = 0;
+    m_lastSkippedCount = 0;
+    m_lastJournalBytes = 0;
+  }
+
+  SnapshotStats GetStats() const override {
+    SnapshotStats stats;
+    stats.snapshotCount = m_snapshots.size();
+    stats.recordCount = m_state.size();
+    stats.chunkCount = m_chunks.size();
+    stats.chunkBytes = m_chunkBytes;
+    stats.lastDeltaCount = m_lastDeltaCount;
+    stats.lastSkippedCount = m_lastSkippedCount;
+    stats.lastJournalBytes = m_lastJournalBytes;
+    return stats;
+  }
+
+private:
+  // === Chunk store ===
+
+  ChunkId Intern(void const* data, size_t size) {
+    ChunkId id = HashBytes(data, size);
+    for (;; ++id) {
+      if (id == 0) continue;
+      auto it = m_chunks.find(id);
+      if (it == m_chunks.end()) {
+        Chunk& chunk = m_chunks[id];
+        chunk.bytes.assign(static_cast<uint8_t const*>(data), static_cast<uint8_t const*>(data) + size);
+        chunk.refs = 1;
+        m_chunkBytes += size;
+        return id;
+      }
+      if (ChunkEquals(it->second, data, size)) {
+        ++it->second.refs;
+        return id;
+      }
+    }
+  }
+
+  static bool ChunkEquals(Chunk const& chunk, void const* data, size_t size) {
+    return chunk.bytes.size() == size && (size == 0 || std::memcmp(chunk.bytes.data(), data, size) == 0);
+  }
+
+  void AddRef(ChunkId id) {
+    if (id != 0) ++m_chunks[id].refs;
+  }
+
+  void Release(ChunkId id) {
+    if (id == 0) return;
+    auto it = m_chunks.find(id);
+    if (it == m_chunks.end()) return;
+    if (--it->second.refs == 0) {
+      m_chunkBytes -= it->second.bytes.size();
+      m_chunks.erase(it);
+    }
+  }
+
+  void ReleaseDelta(Snapshot& snapshot) {
+    for (DeltaEntry const& d : snapshot.delta) {
+      Release(d.oldChunk);
+      Release(d.newChunk);
+    }
+    snapshot.delta.clear();
+    snapshot.delta.shrink_to_fit();
+  }
+
+  // === Head state ===
+
+  /** Point a key at a chunk (0 erases); the caller already holds no reference for id. */
+  void SetState(RecordKey const& key, ChunkId id) {
+    auto it = m_state.find(key);
+    if (it != m_state.end()) {
+      Release(it->second);
+      if (id == 0) {
+        m_state.erase(it);
+      } else {
+        it->second = id;
+        AddRef(id);
+      }
+    } else if (id != 0) {
+      m_state.emplace(key, id);
+      AddRef(id);
+    }
+    m_journalDirty.insert(key);
+  }
+
+  /** Compare a live value against the head and record a delta if it changed. */
+  void UpdateRecord(RecordKey const& key, void const* data, size_t size, std::vector<DeltaEntry>& delta) {
+    auto it = m_state.find(key);
+    ChunkId oldId = 0;
+    if (it != m_state.end()) {
+      oldId = it->second;
+      auto chunk = m_chunks.find(oldId);
+      if (chunk != m_chunks.end() && ChunkEquals(chunk->second, data, size)) return;
+    }
+    ChunkId newId = Intern(data, size);  // Reference held by the delta entry
+    AddRef(oldId);
+    delta.push_back(DeltaEntry{key, oldId, newId});
+    SetState(key, newId);
+  }
+
+  // === Entity keys ===
+
+  /** Key of a live entity; an entity at a destroyed entity's address gets a new key. */
+  uint64_t BindEntity(te::entity::Entity* entity) {
+    te::entity::EntityId const id = entity->GetEntityId();
+    auto it = m_keyById.find(id);
+    if (it != m_keyById.end() && m_bindings[it->second].serial == entity->GetSerial()) return it->second;
+    // A stale binding stays until a Capture drops its records (FindEntity no longer matches)
+    uint64_t const key = ++m_nextEntityKey;
+    m_bindings[key] = EntityBinding{id, entity->GetSerial(), kNoAssetIndex};
+    m_keyById[id] = key;
+    return key;
+  }
+
+  te::entity::Entity* FindEntity(uint64_t key) const {
+    auto it = m_bindings.find(key);
+    if (it == m_bindings.end()) return nullptr;
+    te::entity::Entity* entity = te::entity::EntityManager::GetInstance().GetEntity(it->second.id);
+    return entity && entity->GetSerial() == it->second.serial ? entity : nullptr;
+  }
+
+  /** Tie entity keys to the level's current asset order and signature. */
+  void BindLevelAsset() {
+    for (auto& kv : m_bindings) kv.second.assetIndex = kNoAssetIndex;
+    m_levelSignature = 0;
+    if (!m_level.IsValid()) return;
+    CollectLevelEntities(m_level, m_levelEntities);
+    for (size_t i = 0; i < m_levelEntities.size(); ++i) {
+      m_bindings[BindEntity(m_levelEntities[i])].assetIndex = static_cast<uint32_t>(i);
+    }
+    m_levelSignature = LevelSignature(m_levelEntities);
+  }
+
+  /** Record that an entity is gone and forget its key. */
+  void DropEntity(uint64_t e, std::vector<DeltaEntry>& delta) {
+    RemoveEntity(e, delta);
+    auto it = m_bindings.find(e);
+    if (it == m_bindings.end()) return;
+    auto byId = m_keyById.find(it->second.id);
+    if (byId != m_keyById.end() && byId->second == e) m_keyById.erase(byId);
+    m_bindings.erase(it);
+  }
+
+  uint64_t ScanEntity(te::entity::Entity* entity, std::vector<DeltaEntry>& delta) {
+    uint64_t e = BindEntity(entity);
+    std::vector<RecordKey>& keys = m_entityKeys[e];
+    m_scanKeys.clear();
+
+    auto record = [&](uint32_t type, uint32_t property, void const* data, size_t size) {
+      RecordKey key{e, type, property};
+      m_scanKeys.push_back(key);
+      UpdateRecord(key, data, size, delta);
+    };
+
+    char const* name = entity->GetName();
+    record(0, kEntityName, name ? name : "", name ? std::strlen(name) : 0);
+    te::scene::Transform const& transform = entity->GetLocalTransform();
+    record(0, kEntityTransform, &transform, sizeof(transform));
+    uint8_t active = entity->IsActive() ? 1 : 0;
+    record(0, kEntityActive, &active, sizeof(active));
+    te::entity::Entity* parent = dynamic_cast<te::entity::Entity*>(entity->GetParent());
+    uint64_t parentKey = parent ? BindEntity(parent) : 0;
+    record(0, kEntityParent, &parentKey, sizeof(parentKey));
+
+    m_typeIds.clear();
+    entity->GetComponentTypeIds(m_typeIds);
+    std::sort(m_typeIds.begin(), m_typeIds.end());
+    for (te::object::TypeId type : m_typeIds) {
+      te::entity::Component const* component = entity->GetComponent(type);
+      std::vector<Field> const& fields = GetFields(type);
+      char const* base = reinterpret_cast<char const*>(component);
+      for (size_t i = 0; i < fields.size(); ++i) {
+        if (fields[i].size == 0) continue;
+        record(type, static_cast<uint32_t>(i), base + fields[i].offset, fields[i].size);
+      }
+    }
+
+    // Records that disappeared (component removed)
+    if (keys != m_scanKeys) {
+      std::unordered_set<RecordKey, RecordKeyHash> current(m_scanKeys.begin(), m_scanKeys.end());
+      for (RecordKey const& key : keys) {
+        if (current.find(key) == current.end()) RemoveRecord(key, delta);
+      }
+      keys = m_scanKeys;
+    }
+    return e;
+  }
+
+  void RemoveRecord(RecordKey const& key, std::vector<DeltaEntry>& delta) {
+    auto it = m_state.find(key);
+    if (it == m_state.end()) return;
+    AddRef(it->second);
+    delta.push_back(DeltaEntry{key, it->second, 0});
+    SetState(key, 0);
+  }
+
+  void RemoveEntity(uint64_t e, std::vector<DeltaEntry>& delta) {
+    auto it = m_entityKeys.find(e);
+    if (it == m_entityKeys.end()) return;
+    for (RecordKey const& key : it->second) RemoveRecord(key, delta);
+    m_entityKeys.erase(it);
+  }
+
+  /**
+   * Snapshotted fields of a component type: te::object descriptor properties when the
+   * type declares them, otherwise the editor property metadata. Variable-size values
+   * (strings, custom types) are left out because they cannot be copied byte-wise.
+   */
+  std::vector<Field> const& GetFields(te::object::TypeId type) {
+    auto it = m_fields.find(type);
+    if (it != m_fields.end()) return it->second;
+    std::vector<Field>& fields = m_fields[type];
+    te::object::TypeDescriptor const* desc = te::object::TypeRegistry::GetTypeById(type);
+    if (!desc) return fields;
+    if (desc->properties && desc->propertyCount > 0) {
+      for (size_t i = 0; i < desc->propertyCount; ++i) {
+        fields.push_back(Field{desc->properties[i].offset, desc->properties[i].size});
+      }
+      return fields;
+    }
+    te::entity::IPropertyRegistry* propReg = te::entity::GetPropertyRegistry();
+    te::entity::ComponentMeta const* meta = propReg && desc->name ? propReg->GetComponentMeta(desc->name) : nullptr;
+    if (!meta || !meta->properties) return fields;
+    for (size_t i = 0; i < meta->propertyCount; ++i) {
+      te::entity::PropertyMeta const& prop = meta->properties[i];
+      bool copyable = prop.valueType != te::entity::PropertyValueType::Unknown &&
+                      prop.valueType != te::entity::PropertyValueType::String &&
+                      prop.valueType != te::entity::PropertyValueType::Custom;
+      fields.push_back(copyable ? Field{prop.offset, prop.size} : Field{});
+    }
+    return fields;
+  }
+
+  /** Write a value into the live entity; false if the target no longer exists. */
+  bool ApplyRecord(RecordKey const& key, ChunkId id) {
+    if (id == 0) return false;  // Entity/component removal is structural
+    auto chunkIt = m_chunks.find(id);
+    if (chunkIt == m_chunks.end()) return false;
+    return ApplyValue(FindEntity(key.entity), key, chunkIt->second.bytes.data(), chunkIt->second.bytes.size(),
+                      [this](uint64_t e) { return FindEntity(e); });
+  }
+
+  /** Write a value into entity; resolve maps the entity key stored in a parent record. */
+  template <typename Resolve>
+  bool ApplyValue(te::entity::Entity* entity, RecordKey const& key, uint8_t const* bytes, size_t size,
+                  Resolve const& resolve) {
+    if (!entity) return false;
+
+    if (key.type == 0) {
+      switch (key.property) {
+        case kEntityTransform: {
+          if (size != sizeof(te::scene::Transform)) return false;
+          te::scene::Transform transform;
+          std::memcpy(&transform, bytes, sizeof(transform));
+          entity->SetLocalTransform(transform);
+          return true;
+        }
+        case kEntityActive:
+          if (size != 1) return false;
+          entity->SetActive(bytes[0] != 0);
+          return true;
+        case kEntityParent: {
+          if (size != sizeof(uint64_t)) return false;
+          uint64_t parentKey = 0;
+          std::memcpy(&parentKey, bytes, sizeof(parentKey));
+          te::entity::Entity* parent = nullptr;
+          if (parentKey != 0) {
+            parent = resolve(parentKey);
+            if (!parent) return false;
+          }
+          entity->SetParent(parent);
+          return true;
+        }
+        default:
+          return false;  // Names are indexed by EntityManager and not restored
+      }
+    }
+
+    te::entity::Component* component = entity->GetComponent(key.type);
+    if (!component) return false;
+    std::vector<Field> const& fields = GetFields(key.type);
+    if (key.property >= fields.size() || fields[key.property].size != size) return false;
+    std::memcpy(reinterpret_cast<char*>(component) + fields[key.property].offset, bytes, size);
+    return true;
+  }
+
+  // === History ===
+
+  SnapshotId PushSnapshot(std::vector<DeltaEntry>&& delta, char const* label) {
+    m_lastDeltaCount = delta.size();
+    m_lastSkippedCount = 0;
+    if (delta.empty() && !m_snapshots.empty()) return GetHead();
+
+    // A capture after Undo discards the redo branch
+    while (!m_snapshots.empty() && m_snapshots.size() > m_head + 1) {
+      ReleaseDelta(m_snapshots.back());
+      m_snapshots.pop_back();
+    }
+    Snapshot snapshot;
+    snapshot.id = ++m_nextId;
+    snapshot.label = label ? label : "";
+    if (m_snapshots.empty()) {
+      // The oldest snapshot is never left, so its delta is not needed
+      for (DeltaEntry const& d : delta) {
+        Release(d.oldChunk);
+        Release(d.newChunk);
+      }
+    } else {
+      snapshot.delta = std::move(delta);
+    }
+    m_snapshots.push_back(std::move(snapshot));
+    m_head = m_snapshots.size() - 1;
+    TrimHistory();
+    return m_snapshots[m_head].id;
+  }
+
+  void TrimHistory() {
+    while (m_snapshots.size() > m_maxSnapshots && m_head > 0) {
+      m_snapshots.pop_front();
+      ReleaseDelta(m_snapshots.front());
+      --m_head;
+    }
+  }
+
+  size_t FindSnapshot(SnapshotId id) const {
+    auto it = std::lower_bound(m_snapshots.begin(), m_snapshots.end(), id,
+      [](Snapshot const& s, SnapshotId value) { return s.id < value; });
+    if (it == m_snapshots.end() || it->id != id) return SIZE_MAX;
+    return static_cast<size_t>(it - m_snapshots.begin());
+  }
+
+  // === Journal ===
+
+  void WriteSet(std::vector<uint8_t>& out, RecordKey const& key, ChunkId id) {
+    if (id != 0) {
+      Chunk& chunk = m_chunks[id];
+      if (!chunk.journaled) {
+        uint32_t size = static_cast<uint32_t>(chunk.bytes.size());
+        Append(out, kJournalChunk);
+        Append(out, id);
+        Append(out, size);
+        out.insert(out.end(), chunk.bytes.begin(), chunk.bytes.end());
+        chunk.journaled = true;
+      }
+    }
+    Append(out, kJournalSet);
+    Append(out, key.entity);
+    Append(out, key.type);
+    Append(out, key.property);
+    Append(out, id);
+  }
+
+  te::world::LevelHandle m_level;
+  std::deque<Snapshot> m_snapshots;
+  size_t m_head = 0;
+  SnapshotId m_nextId = 0;
+  size_t m_maxSnapshots = 100;
+
+  std::unordered_map<ChunkId, Chunk> m_chunks;
+  size_t m_chunkBytes = 0;
+  std::unordered_map<RecordKey, ChunkId, RecordKeyHash> m_state;  // Head value per record
+  std::unordered_map<uint64_t, std::vector<RecordKey>> m_entityKeys;
+  std::unordered_map<uint64_t, EntityBinding> m_bindings;  // Entity key -> live entity
+  std::unordered_map<te::entity::EntityId, uint64_t, te::entity::EntityId::Hash> m_keyById;
+  uint64_t m_nextEntityKey = 0;
+  uint64_t m_levelSignature = 0;
+  std::unordered_map<te::object::TypeId, std::vector<Field>> m_fields;
+
+  std::string m_journalPath;
+  std::unordered_set<RecordKey, RecordKeyHash> m_journalDirty;  // Changed since last journal write
+
+  // Scratch reused across scans
+  std::vector<RecordKey> m_scanKeys;
+  std::vector<te::object::TypeId> m_typeIds;
+  std::vector<te::entity::Entity*> m_levelEntities;
+
+  size_t m_lastDeltaCount = 0;
+  size_t m_lastSkippedCount = 0;
+  size_t m_lastJournalBytes = 0;
+};
+
+ISnapshotStore* CreateSnapshotStore() {
+  return new SnapshotStoreImpl();
+}
+
+}  // namespace editor
+}  // namespace te
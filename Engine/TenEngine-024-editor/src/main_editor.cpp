@@ -6,10 +6,12 @@
 #include <te/application/Application.h>
 #include <te/resource/ResourceManager.h>
 #include <te/texture/TextureModuleInit.h>
+#include <te/shader/ShaderModuleInit.h>
 #include <te/material/MaterialModuleInit.h>
 #include <te/mesh/MeshModuleInit.h>
 #include <te/entity/PropertyReflection.h>
 #include <te/world/WorldModuleInit.h>
+#include <te/object/TypeRegistry.h>
 
 int main(int argc, char const** argv) {
   te::application::IApplication* app = te::application::CreateApplication();
@@ -35,9 +37,13 @@ int main(int argc, char const** argv) {
   if (resMgr) {
     te::texture::InitializeTextureModule(resMgr);
     te::mesh::InitializeMeshModule(resMgr);
+    te::shader::InitializeShaderModule(resMgr);
     te::material::InitializeMaterialModule(resMgr);
   }
 
+  // All modules and components are registered: type lookups are lock-free from here on
+  te::object::TypeRegistry::Freeze();
+
   te::editor::IEditor* editor = te::editor::CreateEditor(ctx);
   if (!editor) return 1;
 
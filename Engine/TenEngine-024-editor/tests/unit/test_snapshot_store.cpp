@@ -0,0 +1,252 @@
+/**
+ * @file test_snapshot_store.cpp
+ * @brief ISnapshotStore: capture/undo/redo round-trip on live entities, incremental journal
+ *        replay, replay of truncated or corrupt journals up to the last complete commit, and
+ *        replay against a freshly loaded copy of the level.
+ */
+#include <te/editor/SnapshotStore.h>
+#include <te/entity/Entity.h>
+#include <te/entity/EntityManager.h>
+#include <te/world/WorldManager.h>
+#include <te/world/LevelAssetDesc.h>
+#include <te/scene/ISceneNode.h>
+#include <te/scene/SceneTypes.h>
+#include <te/core/platform.h>
+#include <cassert>
+#include <cstdio>
+#include <cstdint>
+#include <string>
+#include <vector>
+
+using namespace te::editor;
+
+namespace {
+
+char const* const kJournalPath = "test_snapshot_store.tesj";
+char const* const kDamagedPath = "test_snapshot_store_damaged.tesj";
+
+te::world::SceneNodeDesc Node(char const* name) {
+  te::world::SceneNodeDesc node;
+  node.name = name;
+  return node;
+}
+
+/** Level asset: roots A (with child C) and B, plus extra roots when given. */
+te::world::LevelAssetDesc LevelDesc(std::vector<char const*> const& extraRoots = {}) {
+  te::world::LevelAssetDesc desc;
+  desc.roots.push_back(Node("A"));
+  desc.roots.back().children.push_back(Node("C"));
+  desc.roots.push_back(Node("B"));
+  for (char const* name : extraRoots) desc.roots.push_back(Node(name));
+  return desc;
+}
+
+/** A level loaded from LevelDesc; every instance gets new entities. */
+struct Level {
+  te::world::LevelHandle handle;
+  te::scene::WorldRef world;
+  te::entity::Entity* a = nullptr;
+  te::entity::Entity* b = nullptr;
+  te::entity::Entity* c = nullptr;
+
+  explicit Level(te::world::LevelAssetDesc const& desc = LevelDesc()) {
+    te::world::WorldManager& worlds = te::world::WorldManager::GetInstance();
+    handle = worlds.CreateLevelFromDesc(te::scene::SpatialIndexType::None, te::core::AABB{}, desc);
+    world = worlds.GetSceneRef(handle);
+    std::vector<te::scene::ISceneNode*> roots;
+    worlds.GetRootNodes(handle, roots);
+    assert(handle.IsValid() && roots.size() >= 2);
+    a = dynamic_cast<te::entity::Entity*>(roots[0]);
+    b = dynamic_cast<te::entity::Entity*>(roots[1]);
+    assert(a && b && std::string(a->GetName()) == "A" && std::string(b->GetName()) == "B");
+    std::vector<te::scene::ISceneNode*> children;
+    a->GetChildren(children);
+    assert(children.size() == 1);
+    c = dynamic_cast<te::entity::Entity*>(children[0]);
+    assert(c);
+  }
+  ~Level() { te::world::WorldManager::GetInstance().UnloadLevel(handle); }
+  std::vector<te::entity::EntityId> Ids() const { return {a->GetEntityId(), b->GetEntityId(), c->GetEntityId()}; }
+};
+
+void MoveTo(te::entity::Entity* entity, float x) {
+  te::scene::Transform transform = entity->GetLocalTransform();
+  transform.position.x = x;
+  entity->SetLocalTransform(transform);
+}
+
+float PositionX(te::entity::Entity* entity) {
+  return entity->GetLocalTransform().position.x;
+}
+
+std::vector<uint8_t> ReadFile(char const* path) {
+  auto bytes = te::core::FileRead(path);
+  assert(bytes);
+  return *bytes;
+}
+
+void WriteFile(char const* path, std::vector<uint8_t> const& bytes) {
+  std::remove(path);
+  assert(te::core::FileWriteBinary(path, bytes.data(), bytes.size(), 0));
+}
+
+void TestUndoRedo() {
+  Level level;
+  ISnapshotStore* store = CreateSnapshotStore();
+  SnapshotId const initial = store->CaptureEntities(level.Ids(), "initial");
+  assert(initial != kInvalidSnapshotId && !store->CanUndo());
+
+  MoveTo(level.a, 5.0f);
+  level.b->SetActive(false);
+  level.b->SetParent(level.a);
+  SnapshotId const edited = store->CaptureEntities(level.Ids(), "edit");
+  assert(edited != initial && std::string(store->GetLabel(edited)) == "edit");
+  assert(store->GetStats().lastDeltaCount == 3);  // a.transform, b.active, b.parent
+  assert(store->CaptureEntities(level.Ids(), "no-op") == edited);  // Nothing changed
+
+  assert(store->Undo() && store->GetHead() == initial);
+  assert(PositionX(level.a) == 0.0f && level.b->IsActive() && level.b->GetParent() != level.a);
+  assert(store->Redo() && store->GetHead() == edited);
+  assert(PositionX(level.a) == 5.0f && !level.b->IsActive() && level.b->GetParent() == level.a);
+
+  // A capture after Undo drops the redo branch
+  assert(store->Undo());
+  MoveTo(level.a, -1.0f);
+  SnapshotId const branch = store->CaptureEntities(level.Ids(), "branch");
+  assert(!store->CanRedo() && store->GetLabel(edited) == nullptr);
+  assert(store->Restore(initial) && PositionX(level.a) == 0.0f);
+  assert(store->Restore(branch) && PositionX(level.a) == -1.0f);
+  delete store;
+}
+
+void TestJournalReplay() {
+  Level level;
+  ISnapshotStore* store = CreateSnapshotStore();
+  store->SetLevel(level.handle);
+  std::remove(kJournalPath);
+
+  MoveTo(level.a, 1.0f);
+  SnapshotId const first = store->CaptureEntities(level.Ids(), "first");
+  assert(store->WriteJournal(kJournalPath));
+  size_t const firstBytes = store->GetStats().lastJournalBytes;
+
+  // The second write appends only the changed record
+  MoveTo(level.a, 2.0f);
+  SnapshotId const second = store->CaptureEntities(level.Ids(), "second");
+  assert(store->WriteJournal(kJournalPath));
+  size_t const secondBytes = store->GetStats().lastJournalBytes;
+  assert(secondBytes < firstBytes);
+  std::vector<uint8_t> const journal = ReadFile(kJournalPath);
+  assert(journal.size() == firstBytes + secondBytes);
+
+  // Replay brings live entities back to the last commit
+  MoveTo(level.a, 9.0f);
+  level.a->SetActive(false);
+  assert(store->ReplayJournal(kJournalPath) == second);
+  assert(PositionX(level.a) == 2.0f && level.a->IsActive());
+  size_t const nameRecords = store->GetStats().lastSkippedCount;  // Names are not restored
+  assert(store->GetStats().lastDeltaCount > 0);
+
+  // Cut inside the second write: its records are ignored, the first commit is replayed
+  WriteFile(kDamagedPath, std::vector<uint8_t>(journal.begin(), journal.end() - 1));
+  assert(store->ReplayJournal(kDamagedPath) == first && PositionX(level.a) == 1.0f);
+
+  // A corrupt record stops the replay at the last commit before it
+  std::vector<uint8_t> corrupt = journal;
+  corrupt[firstBytes] = 0x7F;
+  WriteFile(kDamagedPath, corrupt);
+  MoveTo(level.a, 9.0f);
+  assert(store->ReplayJournal(kDamagedPath) == first && PositionX(level.a) == 1.0f);
+
+  // No complete commit, or not a journal at all: nothing is applied
+  WriteFile(kDamagedPath, std::vector<uint8_t>(journal.begin(), journal.begin() + firstBytes - 1));
+  MoveTo(level.a, 9.0f);
+  assert(store->ReplayJournal(kDamagedPath) == kInvalidSnapshotId && PositionX(level.a) == 9.0f);
+  corrupt = journal;
+  corrupt[0] = 'X';
+  WriteFile(kDamagedPath, corrupt);
+  assert(store->ReplayJournal(kDamagedPath) == kInvalidSnapshotId);
+  assert(store->ReplayJournal("missing.tesj") == kInvalidSnapshotId);
+
+  // Values of entities that no longer exist are skipped
+  te::entity::Entity* extra = te::entity::EntityManager::GetInstance().CreateEntity(level.world, "Extra");
+  store->CaptureEntities({extra->GetEntityId()}, "extra");
+  assert(store->WriteJournal(kDamagedPath));  // New path: full state
+  extra->Destroy();
+  assert(store->ReplayJournal(kDamagedPath) != kInvalidSnapshotId);
+  assert(store->GetStats().lastSkippedCount > nameRecords + 1);
+
+  assert(std::remove(kJournalPath) == 0 && std::remove(kDamagedPath) == 0);
+  delete store;
+}
+
+void TestReplayOnReloadedLevel() {
+  std::remove(kJournalPath);
+  SnapshotId committed = kInvalidSnapshotId;
+  {
+    Level level;
+    ISnapshotStore* store = CreateSnapshotStore();
+    store->SetLevel(level.handle);
+    store->Capture("Open Level");
+    MoveTo(level.a, 3.0f);
+    level.b->SetActive(false);  // Inactive entities are still captured
+    level.c->SetParent(level.b);
+    committed = store->Capture("edit");
+    assert(store->WriteJournal(kJournalPath));
+    delete store;
+  }
+
+  // A later session loads the saved asset again: new entities, new addresses
+  Level reloaded;
+  assert(PositionX(reloaded.a) == 0.0f && reloaded.b->IsActive() && reloaded.c->GetParent() == reloaded.a);
+  ISnapshotStore* store = CreateSnapshotStore();
+  store->SetLevel(reloaded.handle);
+  store->Capture("Open Level");
+  assert(store->ReplayJournal(kJournalPath) == committed);
+  assert(PositionX(reloaded.a) == 3.0f && !reloaded.b->IsActive() && reloaded.c->GetParent() == reloaded.b);
+  SnapshotId const recovered = store->Capture("Recover Autosave");
+  assert(recovered != kInvalidSnapshotId && store->CanUndo());
+  assert(store->Undo() && PositionX(reloaded.a) == 0.0f && reloaded.c->GetParent() == reloaded.a);
+  delete store;
+
+  // A journal written against a different asset is not replayed
+  {
+    Level other(LevelDesc({"D"}));
+    ISnapshotStore* otherStore = CreateSnapshotStore();
+    otherStore->SetLevel(other.handle);
+    assert(otherStore->ReplayJournal(kJournalPath) == kInvalidSnapshotId);
+    assert(PositionX(other.a) == 0.0f);
+    delete otherStore;
+  }
+
+  // Entities created after load are not in the asset: their values are skipped
+  {
+    Level level;
+    ISnapshotStore* first = CreateSnapshotStore();
+    first->SetLevel(level.handle);
+    te::entity::Entity* extra = te::entity::EntityManager::GetInstance().CreateEntity(level.world, "Extra");
+    MoveTo(extra, 4.0f);
+    MoveTo(level.a, 5.0f);
+    first->Capture("edit");
+    assert(first->WriteJournal(kJournalPath));
+    delete first;
+    extra->Destroy();
+    MoveTo(level.a, 0.0f);
+
+    ISnapshotStore* second = CreateSnapshotStore();
+    second->SetLevel(level.handle);
+    assert(second->ReplayJournal(kJournalPath) != kInvalidSnapshotId && PositionX(level.a) == 5.0f);
+    delete second;
+  }
+  assert(std::remove(kJournalPath) == 0);
+}
+
+}  // namespace
+
+int main() {
+  TestUndoRedo();
+  TestJournalReplay();
+  TestReplayOnReloadedLevel();
+  std::printf("test_snapshot_store: pass\n");
+  return 0;
+}
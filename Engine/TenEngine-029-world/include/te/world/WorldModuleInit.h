@@ -9,7 +9,10 @@
 namespace te {
 namespace world {
 
-/** Call once to register 029 component types (ModelComponent) with Entity/002-Object. */
+/**
+ * Register 029 component types (ModelComponent) with Entity/002-Object. Later calls have no
+ * effect; call before TypeRegistry::Freeze so the descriptors are in the frozen table.
+ */
 void RegisterWorldModule();
 
 }  // namespace world
@@ -123,8 +123,14 @@ void WorldManager::UnloadLevel(LevelHandle handle) {
     te::scene::SceneManager& sceneMgr = te::scene::SceneManager::GetInstance();
     te::scene::SceneWorld* world = sceneMgr.GetWorld(sceneRef);
     if (world) {
+        // Walk roots and children directly: Traverse skips inactive nodes, which would outlive the scene
         std::vector<te::scene::ISceneNode*> all;
-        world->Traverse([&all](te::scene::ISceneNode* n) { all.push_back(n); });
+        world->GetRootNodes(all);
+        std::vector<te::scene::ISceneNode*> children;
+        for (size_t i = 0; i < all.size(); ++i) {
+            all[i]->GetChildren(children);
+            all.insert(all.end(), children.begin(), children.end());
+        }
         for (te::scene::ISceneNode* n : all) {
             te::entity::Entity* e = dynamic_cast<te::entity::Entity*>(n);
             if (e) e->Destroy();
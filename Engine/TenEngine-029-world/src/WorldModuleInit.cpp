@@ -173,6 +173,13 @@ static void RegisterComponentProperties() {
 }
 
 void RegisterWorldModule() {
+    // Called by the application at startup and again by WorldManager; register once
+    static bool s_registered = false;
+    if (s_registered) {
+        return;
+    }
+    s_registered = true;
+
     // Register component types in component registry
     te::entity::IComponentRegistry* reg = te::entity::GetComponentRegistry();
     if (reg) {
@@ -17,6 +17,9 @@ namespace deviceresource {
  * 
  * Manages command list pools and staging buffers per IDevice for efficient
  * synchronous and asynchronous GPU resource creation.
+ *
+ * Asynchronous uploads are batched per device by an UploadScheduler: call
+ * ProcessUploads once per frame to submit them and complete finished ones.
  */
 class DeviceResourceManager {
  public:
@@ -158,9 +161,35 @@ class DeviceResourceManager {
       rhi::IBuffer* buffer,
       rhi::IDevice* device);
 
+  // Upload scheduling
+  /**
+   * Submit pending async uploads as one batch on the copy queue and complete
+   * batches the GPU has finished (callbacks run on the calling thread).
+   * Does not block. Call once per frame; 020-Pipeline does so in PipelineContext::BeginFrame.
+   *
+   * @param device RHI device
+   */
+  static void ProcessUploads(rhi::IDevice* device);
+
+  /**
+   * Limit the bytes of async uploads submitted per ProcessUploads call.
+   *
+   * @param device RHI device
+   * @param bytes Byte budget per frame (0 = unlimited)
+   */
+  static void SetUploadBytesPerFrame(rhi::IDevice* device, size_t bytes);
+
+  /**
+   * Submit all pending async uploads, ignoring the budget, and block until they complete.
+   *
+   * @param device RHI device
+   */
+  static void WaitForUploads(rhi::IDevice* device);
+
   // Cleanup
   /**
-   * Cleanup command list pool and staging buffers for a device.
+   * Cleanup command list pool, staging buffers and upload scheduler for a device.
+   * Pending async uploads complete with success=false.
    * 
    * Call this before destroying the IDevice to free associated resources.
    * 
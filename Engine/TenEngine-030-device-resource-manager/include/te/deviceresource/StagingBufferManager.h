@@ -5,51 +5,136 @@
 
 #include <te/rhi/device.hpp>
 #include <te/rhi/resources.hpp>
+#include <cstddef>
+#include <cstdint>
+#include <deque>
 #include <mutex>
 #include <vector>
-#include <cstddef>
 
 namespace te {
 namespace deviceresource {
 
+/**
+ * A staging region: [offset, offset + size) of buffer.
+ * Ring allocations share one buffer; oversized uploads get a dedicated buffer.
+ */
+struct StagingAllocation {
+  rhi::IBuffer* buffer{nullptr};
+  size_t offset{0};
+  size_t size{0};
+  uint64_t id{0};          // Ring allocation id (0 = dedicated buffer)
+  bool dedicated{false};
+
+  explicit operator bool() const { return buffer != nullptr; }
+};
+
+/**
+ * Staging usage statistics.
+ */
+struct StagingBufferStats {
+  size_t ringCapacity{0};
+  size_t ringBytesInUse{0};        // Including alignment and wrap padding
+  size_t liveRingAllocations{0};
+  size_t liveDedicatedBuffers{0};
+  size_t dedicatedBytesInUse{0};
+  uint64_t totalRingAllocations{0};
+  uint64_t totalDedicatedAllocations{0};
+  uint64_t ringWraps{0};
+};
+
 /**
  * Staging buffer manager for efficient GPU data upload.
- * Manages multiple staging buffers of different sizes.
+ * Sub-allocates aligned regions from one ring buffer; regions are reclaimed in
+ * allocation order once retired, either explicitly (Release after the upload's fence
+ * was waited) or by fence value (ReleaseAfter + RetireCompleted).
+ * Uploads larger than the ring, or arriving while it is full, fall back to a
+ * dedicated buffer that is destroyed on retirement.
  * Thread-safe.
  */
 class StagingBufferManager {
  public:
-  explicit StagingBufferManager(rhi::IDevice* device);
+  static constexpr size_t kDefaultRingSize = 32u * 1024u * 1024u;
+  static constexpr size_t kDefaultAlignment = 256u;      // Buffer copy source alignment
+  static constexpr size_t kTextureCopyAlignment = 512u;  // Buffer-to-texture copy alignment
+
+  explicit StagingBufferManager(rhi::IDevice* device, size_t ringSize = kDefaultRingSize);
   ~StagingBufferManager();
 
   /**
-   * Allocate staging buffer of at least the requested size.
-   * Returns nullptr if allocation fails.
+   * Allocate a staging region of at least the requested size.
+   * Returns an empty allocation if allocation fails.
+   */
+  StagingAllocation Allocate(size_t size, size_t alignment = kDefaultAlignment);
+
+  /**
+   * Copy data into an allocation (at byteOffset within the region).
+   */
+  bool Write(StagingAllocation const& allocation, void const* data, size_t size, size_t byteOffset = 0);
+
+  /**
+   * Release an allocation whose GPU copy has completed.
+   */
+  void Release(StagingAllocation const& allocation);
+
+  /**
+   * Release an allocation once RetireCompleted(fenceValue or later) is called.
+   */
+  void ReleaseAfter(StagingAllocation const& allocation, uint64_t fenceValue);
+
+  /**
+   * Retire all allocations released with a fence value <= completedFenceValue.
    */
-  rhi::IBuffer* Allocate(size_t size);
+  void RetireCompleted(uint64_t completedFenceValue);
 
   /**
-   * Release staging buffer back to the pool.
+   * Get usage statistics.
    */
-  void Release(rhi::IBuffer* buffer);
+  StagingBufferStats GetStats() const;
 
   /**
-   * Clear all staging buffers.
+   * Clear all staging buffers (outstanding allocations become invalid).
    */
   void Clear();
 
  private:
-  rhi::IDevice* device_;
-  std::mutex mutex_;
-  size_t maxTotalSize_;  // Maximum total size (default 64MB)
-  size_t currentTotalSize_;
-  
-  struct BufferEntry {
+  struct RingRegion {
+    uint64_t id;
+    size_t end;            // Ring position after this region; the tail moves here on reclaim
+    size_t bytes;          // Bytes consumed including padding
+    uint64_t fenceValue;   // Pending fence value when released with ReleaseAfter
+    bool released;         // Released, waiting for fenceValue
+    bool retired;
+  };
+  struct DedicatedBuffer {
     rhi::IBuffer* buffer;
     size_t size;
-    bool inUse;
+    uint64_t fenceValue;
   };
-  std::vector<BufferEntry> buffers_;
+
+  bool EnsureRing();
+  bool TryAllocateRing(size_t size, size_t alignment, StagingAllocation& out);
+  StagingAllocation AllocateDedicated(size_t size);
+  void ReclaimRing();
+  void DestroyDedicated(rhi::IBuffer* buffer);
+
+  rhi::IDevice* device_;
+  mutable std::mutex mutex_;
+
+  // Ring buffer
+  size_t ringSize_;
+  rhi::IBuffer* ring_{nullptr};
+  size_t head_{0};   // Next allocation position
+  size_t tail_{0};   // Start of the oldest live region
+  size_t used_{0};
+  uint64_t nextId_{1};
+  std::deque<RingRegion> regions_;  // Live regions in allocation order
+
+  // Dedicated (oversized / overflow) buffers
+  std::vector<DedicatedBuffer> dedicated_;      // Live
+  std::vector<DedicatedBuffer> pendingDedicated_;  // Released, waiting for a fence value
+  size_t dedicatedBytes_{0};
+
+  StagingBufferStats stats_{};
 };
 
 }  // namespace deviceresource
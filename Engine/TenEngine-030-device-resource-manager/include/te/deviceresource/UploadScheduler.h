@@ -0,0 +1,158 @@
+/** @file UploadScheduler.h
+ *  030-DeviceResourceManager: Batched upload scheduler on the copy queue.
+ */
+#pragma once
+
+#include <te/rhi/device.hpp>
+#include <te/rhi/resources.hpp>
+#include <te/rhi/types.hpp>
+#include <te/deviceresource/CommandListPool.h>
+#include <te/deviceresource/StagingBufferManager.h>
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <deque>
+#include <mutex>
+#include <vector>
+
+namespace te {
+namespace deviceresource {
+
+/**
+ * One pending upload: either dstBuffer or dstTexture is set.
+ * data is staged when the upload is flushed and must stay valid until onComplete runs.
+ */
+struct UploadRequest {
+  rhi::IBuffer* dstBuffer{nullptr};
+  size_t dstOffset{0};                   // Buffer only
+  rhi::ITexture* dstTexture{nullptr};
+  rhi::TextureDesc textureDesc{};        // Texture only: copied extent
+  void const* data{nullptr};
+  size_t size{0};
+  rhi::ResourceState initialState{rhi::ResourceState::Common};
+  rhi::ResourceState finalState{rhi::ResourceState::Common};
+  void (*onComplete)(bool success, void* user_data){nullptr};
+  void* user_data{nullptr};
+  std::atomic<bool> const* cancelled{nullptr};  // Optional; checked before the upload is recorded
+};
+
+/**
+ * Upload scheduler statistics.
+ */
+struct UploadSchedulerStats {
+  size_t pendingUploads{0};
+  size_t pendingBytes{0};
+  size_t inFlightBatches{0};
+  uint64_t submittedValue{0};
+  uint64_t completedValue{0};
+  uint64_t totalBatches{0};
+  uint64_t totalUploads{0};
+  uint64_t totalBytes{0};
+  uint64_t throttledFlushes{0};  // Flushes that left uploads pending because of the byte budget
+};
+
+/**
+ * Coalesces pending buffer and texture uploads into one command list per Flush,
+ * submitted on the copy queue (graphics queue when the device has no copy queue).
+ *
+ * Each flush signals the next value of a timeline semaphore on the upload queue (a pooled
+ * binary fence per flush on backends without timeline semaphores). Poll compares the
+ * in-flight flushes with the completed value without blocking, retires their staging
+ * regions and invokes the completion callbacks.
+ * Call Flush and Poll once per frame (DeviceResourceManager::ProcessUploads does both;
+ * 020-Pipeline calls it at the start of every frame).
+ *
+ * Enqueue is thread-safe. Callbacks run on the thread calling Flush (failures),
+ * Poll or WaitForFenceValue.
+ */
+class UploadScheduler {
+ public:
+  UploadScheduler(rhi::IDevice* device, StagingBufferManager* staging, CommandListPool* commandListPool);
+  /** Waits for in-flight uploads; uploads never flushed complete with success=false. */
+  ~UploadScheduler();
+
+  /**
+   * Queue an upload for the next Flush. Returns false (without calling onComplete)
+   * if the request is invalid.
+   */
+  bool Enqueue(UploadRequest const& request);
+
+  /**
+   * Record and submit pending uploads within the bytes-per-frame budget (at least one
+   * upload is always taken). Returns the batch's fence value, or 0 if nothing was submitted.
+   */
+  uint64_t Flush();
+
+  /**
+   * Record and submit all pending uploads, ignoring the budget.
+   */
+  uint64_t FlushAll();
+
+  /**
+   * Non-blocking: complete every in-flight batch whose fence has signaled.
+   */
+  void Poll();
+
+  /**
+   * Block until the batch with the given fence value has completed, then Poll.
+   */
+  void WaitForFenceValue(uint64_t value);
+
+  /**
+   * FlushAll and wait for every in-flight batch.
+   */
+  void WaitIdle();
+
+  /**
+   * Limit bytes recorded per Flush (0 = unlimited).
+   */
+  void SetBytesPerFrameBudget(size_t bytes);
+  size_t GetBytesPerFrameBudget() const;
+
+  uint64_t GetSubmittedValue() const;
+  uint64_t GetCompletedValue() const;
+  /** Semaphore signaled with each flush's value, for GPU-side waits; nullptr when fences are used. */
+  rhi::ISemaphore* GetTimeline() const;
+  UploadSchedulerStats GetStats() const;
+
+ private:
+  struct Batch {
+    uint64_t fenceValue;
+    rhi::IFence* fence;  // Null when the timeline is signaled instead
+    rhi::ICommandList* cmd;
+    std::vector<UploadRequest> requests;
+  };
+  struct Completion {
+    void (*onComplete)(bool, void*);
+    void* user_data;
+    bool success;
+  };
+
+  uint64_t FlushInternal(bool ignoreBudget);
+  rhi::IFence* AcquireFence();
+  void RetireBatch(Batch& batch, std::vector<Completion>& completions);
+  static void RunCompletions(std::vector<Completion> const& completions);
+
+  rhi::IDevice* device_;
+  StagingBufferManager* staging_;
+  CommandListPool* commandListPool_;
+  rhi::IQueue* queue_{nullptr};
+  rhi::ISemaphore* timeline_{nullptr};  // Null: the backend has no timeline semaphores
+
+  // Pending uploads (Enqueue)
+  mutable std::mutex pendingMutex_;
+  std::deque<UploadRequest> pending_;
+  size_t pendingBytes_{0};
+  size_t bytesPerFrame_{0};
+
+  // Submission and completion (Flush / Poll / Wait)
+  mutable std::mutex submitMutex_;
+  std::deque<Batch> inFlight_;
+  std::vector<rhi::IFence*> freeFences_;
+  uint64_t submittedValue_{0};
+  std::atomic<uint64_t> completedValue_{0};
+  UploadSchedulerStats stats_{};
+};
+
+}  // namespace deviceresource
+}  // namespace te
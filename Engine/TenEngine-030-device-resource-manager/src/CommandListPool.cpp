@@ -4,6 +4,7 @@
 #include <te/deviceresource/CommandListPool.h>
 #include <te/rhi/device.hpp>
 #include <te/core/log.h>
+#include <algorithm>
 
 namespace te {
 namespace deviceresource {
@@ -61,13 +62,9 @@ void CommandListPool::Release(rhi::ICommandList* cmd) {
 void CommandListPool::Clear() {
   std::lock_guard<std::mutex> lock(mutex_);
   
-  // Destroy all command lists
+  // all_ holds every command list created by the pool, including available ones
   while (!available_.empty()) {
-    rhi::ICommandList* cmd = available_.front();
     available_.pop();
-    if (device_) {
-      device_->DestroyCommandList(cmd);
-    }
   }
   
   for (rhi::ICommandList* cmd : all_) {
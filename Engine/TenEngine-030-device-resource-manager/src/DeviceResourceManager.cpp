@@ -3,6 +3,7 @@
  */
 #include <te/deviceresource/DeviceResourceManager.h>
 #include <te/deviceresource/ResourceOperationTypes.h>
+#include <te/deviceresource/UploadScheduler.h>
 #include "internal/DeviceResources.h"
 #include "internal/TextureDeviceImpl.h"
 #include "internal/BufferDeviceImpl.h"
@@ -47,6 +48,13 @@ DeviceResources& GetDeviceResources(rhi::IDevice* device) {
   return it->second;
 }
 
+// Get device resources without creating them
+DeviceResources* FindDeviceResources(rhi::IDevice* device) {
+  std::lock_guard<std::mutex> lock(g_deviceResourcesMutex);
+  auto it = g_deviceResources.find(device);
+  return it != g_deviceResources.end() ? &it->second : nullptr;
+}
+
 // Get operation context
 AsyncOperationContext* GetOperationContext(ResourceOperationHandle handle) {
   std::lock_guard<std::mutex> lock(g_operationsMutex);
@@ -238,17 +246,54 @@ void DeviceResourceManager::DestroyDeviceBuffer(
   device->DestroyBuffer(buffer);
 }
 
+void DeviceResourceManager::ProcessUploads(rhi::IDevice* device) {
+  if (!device) {
+    return;
+  }
+
+  // Called every frame: a device that never uploaded gets no scheduler
+  DeviceResources* resources = FindDeviceResources(device);
+  if (!resources) {
+    return;
+  }
+
+  UploadScheduler* scheduler = resources->uploadScheduler.get();
+  scheduler->Flush();
+  scheduler->Poll();
+}
+
+void DeviceResourceManager::SetUploadBytesPerFrame(rhi::IDevice* device, size_t bytes) {
+  if (!device) {
+    return;
+  }
+
+  GetDeviceResources(device).uploadScheduler->SetBytesPerFrameBudget(bytes);
+}
+
+void DeviceResourceManager::WaitForUploads(rhi::IDevice* device) {
+  if (!device) {
+    return;
+  }
+
+  GetDeviceResources(device).uploadScheduler->WaitIdle();
+}
+
 void DeviceResourceManager::CleanupDevice(rhi::IDevice* device) {
   if (!device) {
     return;
   }
 
-  std::lock_guard<std::mutex> lock(g_deviceResourcesMutex);
-  auto it = g_deviceResources.find(device);
-  if (it != g_deviceResources.end()) {
-    // Cleanup is handled by destructors
+  DeviceResources resources;
+  {
+    std::lock_guard<std::mutex> lock(g_deviceResourcesMutex);
+    auto it = g_deviceResources.find(device);
+    if (it == g_deviceResources.end()) {
+      return;
+    }
+    resources = std::move(it->second);
     g_deviceResources.erase(it);
   }
+  // Destructors run outside the lock: the scheduler invokes completion callbacks
 }
 
 }  // namespace deviceresource
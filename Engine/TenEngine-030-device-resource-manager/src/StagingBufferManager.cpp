@@ -9,8 +9,24 @@
 namespace te {
 namespace deviceresource {
 
-StagingBufferManager::StagingBufferManager(rhi::IDevice* device)
-    : device_(device), maxTotalSize_(64 * 1024 * 1024), currentTotalSize_(0) {
+namespace {
+
+size_t AlignUp(size_t value, size_t alignment) {
+  return alignment > 1 ? (value + alignment - 1) / alignment * alignment : value;
+}
+
+rhi::BufferDesc MakeStagingDesc(size_t size) {
+  rhi::BufferDesc desc{};
+  desc.size = size;
+  desc.usage = static_cast<uint32_t>(rhi::BufferUsage::CopySrc) |
+               static_cast<uint32_t>(rhi::BufferUsage::CopyDst);
+  return desc;
+}
+
+}  // namespace
+
+StagingBufferManager::StagingBufferManager(rhi::IDevice* device, size_t ringSize)
+    : device_(device), ringSize_(ringSize) {
   if (!device_) {
     te::core::Log(te::core::LogLevel::Error, "StagingBufferManager: Invalid device");
   }
@@ -20,77 +36,248 @@ StagingBufferManager::~StagingBufferManager() {
   Clear();
 }
 
-rhi::IBuffer* StagingBufferManager::Allocate(size_t size) {
+bool StagingBufferManager::EnsureRing() {
+  if (ring_) {
+    return true;
+  }
+  if (ringSize_ == 0) {
+    return false;
+  }
+  ring_ = device_->CreateBuffer(MakeStagingDesc(ringSize_));
+  if (!ring_) {
+    te::core::Log(te::core::LogLevel::Warn, "StagingBufferManager: Failed to create ring buffer, using dedicated buffers");
+    ringSize_ = 0;
+    return false;
+  }
+  stats_.ringCapacity = ringSize_;
+  return true;
+}
+
+bool StagingBufferManager::TryAllocateRing(size_t size, size_t alignment, StagingAllocation& out) {
+  if (size > ringSize_ || !EnsureRing()) {
+    return false;
+  }
+
+  ReclaimRing();
+  if (regions_.empty()) {
+    head_ = tail_ = used_ = 0;
+  }
+
+  bool const full = !regions_.empty() && head_ == tail_;
+  if (full) {
+    return false;
+  }
+
+  size_t offset = AlignUp(head_, alignment);
+  size_t newHead = 0;
+  if (head_ >= tail_) {
+    // Free space is [head, ringSize) followed by [0, tail)
+    if (offset + size <= ringSize_) {
+      newHead = offset + size;
+    } else if (size <= tail_) {
+      // Wrap; the skipped end of the ring is charged to this region
+      offset = 0;
+      newHead = size;
+      ++stats_.ringWraps;
+    } else {
+      return false;
+    }
+  } else {
+    // Wrapped: free space is [head, tail)
+    if (offset + size > tail_) {
+      return false;
+    }
+    newHead = offset + size;
+  }
+
+  size_t const consumed = (newHead >= head_) ? newHead - head_ : (ringSize_ - head_) + newHead;
+  RingRegion region{};
+  region.id = nextId_++;
+  region.end = newHead == ringSize_ ? 0 : newHead;
+  region.bytes = consumed;
+  regions_.push_back(region);
+  head_ = region.end;
+  used_ += consumed;
+
+  out.buffer = ring_;
+  out.offset = offset;
+  out.size = size;
+  out.id = region.id;
+  out.dedicated = false;
+  ++stats_.totalRingAllocations;
+  return true;
+}
+
+StagingAllocation StagingBufferManager::AllocateDedicated(size_t size) {
+  StagingAllocation out;
+  rhi::IBuffer* buffer = device_->CreateBuffer(MakeStagingDesc(size));
+  if (!buffer) {
+    te::core::Log(te::core::LogLevel::Warn, "StagingBufferManager: Cannot allocate dedicated staging buffer");
+    return out;
+  }
+  dedicated_.push_back(DedicatedBuffer{buffer, size, 0});
+  dedicatedBytes_ += size;
+  ++stats_.totalDedicatedAllocations;
+  out.buffer = buffer;
+  out.size = size;
+  out.dedicated = true;
+  return out;
+}
+
+StagingAllocation StagingBufferManager::Allocate(size_t size, size_t alignment) {
   if (!device_ || size == 0) {
-    return nullptr;
+    return StagingAllocation{};
   }
 
   std::lock_guard<std::mutex> lock(mutex_);
 
-  // Try to find an available buffer that's large enough
-  for (auto& entry : buffers_) {
-    if (!entry.inUse && entry.size >= size) {
-      entry.inUse = true;
-      return entry.buffer;
-    }
+  StagingAllocation out;
+  if (TryAllocateRing(size, std::max<size_t>(1, alignment), out)) {
+    return out;
   }
+  // Oversized upload or ring exhausted by in-flight uploads
+  return AllocateDedicated(size);
+}
 
-  // Check if we can create a new buffer
-  if (currentTotalSize_ + size > maxTotalSize_) {
-    te::core::Log(te::core::LogLevel::Warn, "StagingBufferManager: Cannot allocate buffer, max size exceeded");
-    return nullptr;
+bool StagingBufferManager::Write(StagingAllocation const& allocation, void const* data, size_t size,
+                                 size_t byteOffset) {
+  if (!device_ || !allocation || !data || byteOffset + size > allocation.size) {
+    return false;
   }
+  // Regions are disjoint, so writes need no lock
+  device_->UpdateBuffer(allocation.buffer, allocation.offset + byteOffset, data, size);
+  return true;
+}
 
-  // Create new staging buffer
-  rhi::BufferDesc desc{};
-  desc.size = size;
-  desc.usage = static_cast<uint32_t>(rhi::BufferUsage::CopySrc) | 
-               static_cast<uint32_t>(rhi::BufferUsage::CopyDst);
-  
-  rhi::IBuffer* buffer = device_->CreateBuffer(desc);
-  if (buffer) {
-    BufferEntry entry;
-    entry.buffer = buffer;
-    entry.size = size;
-    entry.inUse = true;
-    buffers_.push_back(entry);
-    currentTotalSize_ += size;
+void StagingBufferManager::Release(StagingAllocation const& allocation) {
+  if (!allocation) {
+    return;
+  }
+
+  std::lock_guard<std::mutex> lock(mutex_);
+
+  if (allocation.dedicated) {
+    DestroyDedicated(allocation.buffer);
+    return;
+  }
+  if (regions_.empty() || allocation.id < regions_.front().id) {
+    return;
+  }
+  size_t const index = static_cast<size_t>(allocation.id - regions_.front().id);
+  if (index < regions_.size()) {
+    regions_[index].retired = true;
+    ReclaimRing();
   }
-  
-  return buffer;
 }
 
-void StagingBufferManager::Release(rhi::IBuffer* buffer) {
-  if (!buffer) {
+void StagingBufferManager::ReleaseAfter(StagingAllocation const& allocation, uint64_t fenceValue) {
+  if (!allocation) {
     return;
   }
 
   std::lock_guard<std::mutex> lock(mutex_);
-  
-  for (auto& entry : buffers_) {
-    if (entry.buffer == buffer) {
-      entry.inUse = false;
-      return;
+
+  if (allocation.dedicated) {
+    for (size_t i = 0; i < dedicated_.size(); ++i) {
+      if (dedicated_[i].buffer == allocation.buffer) {
+        dedicated_[i].fenceValue = fenceValue;
+        pendingDedicated_.push_back(dedicated_[i]);
+        dedicated_[i] = dedicated_.back();
+        dedicated_.pop_back();
+        return;
+      }
     }
+    return;
   }
-  
-  // Buffer not found in pool, destroy it
-  if (device_) {
-    device_->DestroyBuffer(buffer);
+  if (regions_.empty() || allocation.id < regions_.front().id) {
+    return;
+  }
+  size_t const index = static_cast<size_t>(allocation.id - regions_.front().id);
+  if (index < regions_.size()) {
+    regions_[index].released = true;
+    regions_[index].fenceValue = fenceValue;
   }
 }
 
+void StagingBufferManager::RetireCompleted(uint64_t completedFenceValue) {
+  std::lock_guard<std::mutex> lock(mutex_);
+
+  for (auto& region : regions_) {
+    if (region.released && region.fenceValue <= completedFenceValue) {
+      region.retired = true;
+    }
+  }
+  ReclaimRing();
+
+  for (size_t i = 0; i < pendingDedicated_.size();) {
+    if (pendingDedicated_[i].fenceValue <= completedFenceValue) {
+      if (device_) {
+        device_->DestroyBuffer(pendingDedicated_[i].buffer);
+      }
+      dedicatedBytes_ -= pendingDedicated_[i].size;
+      pendingDedicated_[i] = pendingDedicated_.back();
+      pendingDedicated_.pop_back();
+    } else {
+      ++i;
+    }
+  }
+}
+
+void StagingBufferManager::ReclaimRing() {
+  // Regions are reclaimed strictly in allocation order
+  while (!regions_.empty() && regions_.front().retired) {
+    tail_ = regions_.front().end;
+    used_ -= regions_.front().bytes;
+    regions_.pop_front();
+  }
+}
+
+void StagingBufferManager::DestroyDedicated(rhi::IBuffer* buffer) {
+  for (size_t i = 0; i < dedicated_.size(); ++i) {
+    if (dedicated_[i].buffer == buffer) {
+      dedicatedBytes_ -= dedicated_[i].size;
+      dedicated_[i] = dedicated_.back();
+      dedicated_.pop_back();
+      if (device_) {
+        device_->DestroyBuffer(buffer);
+      }
+      return;
+    }
+  }
+}
+
+StagingBufferStats StagingBufferManager::GetStats() const {
+  std::lock_guard<std::mutex> lock(mutex_);
+  StagingBufferStats stats = stats_;
+  stats.ringBytesInUse = used_;
+  stats.liveRingAllocations = regions_.size();
+  stats.liveDedicatedBuffers = dedicated_.size() + pendingDedicated_.size();
+  stats.dedicatedBytesInUse = dedicatedBytes_;
+  return stats;
+}
+
 void StagingBufferManager::Clear() {
   std::lock_guard<std::mutex> lock(mutex_);
-  
-  for (auto& entry : buffers_) {
-    if (device_ && entry.buffer) {
+
+  if (device_) {
+    if (ring_) {
+      device_->DestroyBuffer(ring_);
+    }
+    for (auto& entry : dedicated_) {
+      device_->DestroyBuffer(entry.buffer);
+    }
+    for (auto& entry : pendingDedicated_) {
       device_->DestroyBuffer(entry.buffer);
     }
   }
-  
-  buffers_.clear();
-  currentTotalSize_ = 0;
+
+  ring_ = nullptr;
+  regions_.clear();
+  head_ = tail_ = used_ = 0;
+  dedicated_.clear();
+  pendingDedicated_.clear();
+  dedicatedBytes_ = 0;
+  stats_.ringCapacity = 0;
 }
 
 }  // namespace deviceresource
@@ -0,0 +1,332 @@
+/** @file UploadScheduler.cpp
+ *  030-DeviceResourceManager implementation: Batched upload scheduler.
+ */
+#include <te/deviceresource/UploadScheduler.h>
+#include <te/rhi/command_list.hpp>
+#include <te/rhi/queue.hpp>
+#include <te/rhi/sync.hpp>
+#include <te/core/log.h>
+#include <algorithm>
+
+namespace te {
+namespace deviceresource {
+
+UploadScheduler::UploadScheduler(rhi::IDevice* device, StagingBufferManager* staging,
+                                 CommandListPool* commandListPool)
+    : device_(device), staging_(staging), commandListPool_(commandListPool) {
+  if (!device_ || !staging_ || !commandListPool_) {
+    te::core::Log(te::core::LogLevel::Error, "UploadScheduler: Invalid parameters");
+    return;
+  }
+  queue_ = device_->GetQueue(rhi::QueueType::Copy, 0);
+  if (!queue_) {
+    queue_ = device_->GetQueue(rhi::QueueType::Graphics, 0);
+  }
+  timeline_ = device_->CreateTimelineSemaphore(0);
+}
+
+UploadScheduler::~UploadScheduler() {
+  std::vector<Completion> completions;
+  {
+    std::lock_guard<std::mutex> lock(pendingMutex_);
+    for (auto const& request : pending_) {
+      completions.push_back(Completion{request.onComplete, request.user_data, false});
+    }
+    pending_.clear();
+    pendingBytes_ = 0;
+  }
+  {
+    std::lock_guard<std::mutex> lock(submitMutex_);
+    if (timeline_) {
+      timeline_->Wait(submittedValue_);
+    }
+    for (auto& batch : inFlight_) {
+      if (batch.fence) {
+        batch.fence->Wait();
+      }
+      RetireBatch(batch, completions);
+    }
+    inFlight_.clear();
+    for (rhi::IFence* fence : freeFences_) {
+      device_->DestroyFence(fence);
+    }
+    freeFences_.clear();
+    if (timeline_) {
+      device_->DestroySemaphore(timeline_);
+      timeline_ = nullptr;
+    }
+  }
+  RunCompletions(completions);
+}
+
+bool UploadScheduler::Enqueue(UploadRequest const& request) {
+  if (!queue_ || !request.data || request.size == 0 ||
+      (request.dstBuffer == nullptr) == (request.dstTexture == nullptr)) {
+    te::core::Log(te::core::LogLevel::Error, "UploadScheduler::Enqueue: Invalid upload request");
+    return false;
+  }
+  std::lock_guard<std::mutex> lock(pendingMutex_);
+  pending_.push_back(request);
+  pendingBytes_ += request.size;
+  return true;
+}
+
+uint64_t UploadScheduler::Flush() {
+  return FlushInternal(false);
+}
+
+uint64_t UploadScheduler::FlushAll() {
+  return FlushInternal(true);
+}
+
+rhi::IFence* UploadScheduler::AcquireFence() {
+  if (!freeFences_.empty()) {
+    rhi::IFence* fence = freeFences_.back();
+    freeFences_.pop_back();
+    return fence;
+  }
+  return device_->CreateFence(false);
+}
+
+uint64_t UploadScheduler::FlushInternal(bool ignoreBudget) {
+  if (!queue_) {
+    return 0;
+  }
+
+  std::vector<Completion> completions;
+  uint64_t fenceValue = 0;
+  {
+    std::lock_guard<std::mutex> submitLock(submitMutex_);
+
+    // Take uploads up to the budget; the first one is always taken so that an upload
+    // larger than the budget still makes progress
+    std::vector<UploadRequest> taken;
+    size_t takenBytes = 0;
+    {
+      std::lock_guard<std::mutex> lock(pendingMutex_);
+      while (!pending_.empty()) {
+        UploadRequest const& next = pending_.front();
+        if (!ignoreBudget && bytesPerFrame_ != 0 && !taken.empty() &&
+            takenBytes + next.size > bytesPerFrame_) {
+          ++stats_.throttledFlushes;
+          break;
+        }
+        takenBytes += next.size;
+        pendingBytes_ -= next.size;
+        taken.push_back(next);
+        pending_.pop_front();
+      }
+    }
+    if (taken.empty()) {
+      return 0;
+    }
+
+    // Stage data; cancelled or unstageable uploads complete with failure
+    std::vector<UploadRequest> batched;
+    std::vector<StagingAllocation> allocations;
+    size_t batchedBytes = 0;
+    for (auto const& request : taken) {
+      if (request.cancelled && request.cancelled->load()) {
+        completions.push_back(Completion{request.onComplete, request.user_data, false});
+        continue;
+      }
+      size_t const alignment = request.dstTexture ? StagingBufferManager::kTextureCopyAlignment
+                                                  : StagingBufferManager::kDefaultAlignment;
+      StagingAllocation alloc = staging_->Allocate(request.size, alignment);
+      if (!alloc || !staging_->Write(alloc, request.data, request.size)) {
+        te::core::Log(te::core::LogLevel::Error, "UploadScheduler::Flush: Failed to stage upload");
+        staging_->Release(alloc);
+        completions.push_back(Completion{request.onComplete, request.user_data, false});
+        continue;
+      }
+      batched.push_back(request);
+      allocations.push_back(alloc);
+      batchedBytes += request.size;
+    }
+
+    rhi::ICommandList* cmd = batched.empty() ? nullptr : commandListPool_->Acquire();
+    rhi::IFence* fence = (cmd && !timeline_) ? AcquireFence() : nullptr;
+    if (!cmd || (!timeline_ && !fence)) {
+      if (!batched.empty()) {
+        te::core::Log(te::core::LogLevel::Error, "UploadScheduler::Flush: Failed to acquire command list or fence");
+      }
+      commandListPool_->Release(cmd);
+      for (size_t i = 0; i < batched.size(); ++i) {
+        staging_->Release(allocations[i]);
+        completions.push_back(Completion{batched[i].onComplete, batched[i].user_data, false});
+      }
+    } else {
+      // One command list: all transitions to CopyDst, all copies, all final transitions
+      std::vector<rhi::BufferBarrier> bufferBarriers;
+      std::vector<rhi::TextureBarrier> textureBarriers;
+      for (auto const& request : batched) {
+        if (request.dstBuffer) {
+          bufferBarriers.push_back(rhi::BufferBarrier{request.dstBuffer, request.dstOffset, request.size,
+                                                      request.initialState, rhi::ResourceState::CopyDst});
+        } else {
+          textureBarriers.push_back(rhi::TextureBarrier{request.dstTexture, 0, 0,
+                                                        request.initialState, rhi::ResourceState::CopyDst});
+        }
+      }
+
+      cmd->Begin();
+      cmd->ResourceBarrier(static_cast<uint32_t>(bufferBarriers.size()), bufferBarriers.data(),
+                           static_cast<uint32_t>(textureBarriers.size()), textureBarriers.data());
+      for (size_t i = 0; i < batched.size(); ++i) {
+        UploadRequest const& request = batched[i];
+        if (request.dstBuffer) {
+          cmd->CopyBuffer(allocations[i].buffer, allocations[i].offset, request.dstBuffer, request.dstOffset,
+                          request.size);
+        } else {
+          rhi::TextureRegion region{};
+          region.texture = request.dstTexture;
+          region.width = request.textureDesc.width;
+          region.height = request.textureDesc.height;
+          region.depth = request.textureDesc.depth;
+          cmd->CopyBufferToTexture(allocations[i].buffer, allocations[i].offset, request.dstTexture, region);
+        }
+      }
+      size_t b = 0;
+      size_t t = 0;
+      for (auto const& request : batched) {
+        if (request.dstBuffer) {
+          bufferBarriers[b].srcState = rhi::ResourceState::CopyDst;
+          bufferBarriers[b++].dstState = request.finalState;
+        } else {
+          textureBarriers[t].srcState = rhi::ResourceState::CopyDst;
+          textureBarriers[t++].dstState = request.finalState;
+        }
+      }
+      cmd->ResourceBarrier(static_cast<uint32_t>(bufferBarriers.size()), bufferBarriers.data(),
+                           static_cast<uint32_t>(textureBarriers.size()), textureBarriers.data());
+      cmd->End();
+
+      fenceValue = ++submittedValue_;
+      if (timeline_) {
+        rhi::SemaphoreSubmit const signal{timeline_, fenceValue};
+        rhi::SubmitInfo info{};
+        info.commandLists = &cmd;
+        info.commandListCount = 1;
+        info.signals = &signal;
+        info.signalCount = 1;
+        queue_->Submit(info);
+      } else {
+        rhi::Submit(cmd, queue_, fence, nullptr, nullptr);
+      }
+      for (auto const& alloc : allocations) {
+        staging_->ReleaseAfter(alloc, fenceValue);
+      }
+
+      ++stats_.totalBatches;
+      stats_.totalUploads += batched.size();
+      stats_.totalBytes += batchedBytes;
+      inFlight_.push_back(Batch{fenceValue, fence, cmd, std::move(batched)});
+    }
+  }
+
+  RunCompletions(completions);
+  return fenceValue;
+}
+
+void UploadScheduler::RetireBatch(Batch& batch, std::vector<Completion>& completions) {
+  completedValue_.store(batch.fenceValue);
+  staging_->RetireCompleted(batch.fenceValue);
+  commandListPool_->Release(batch.cmd);
+  if (batch.fence) {
+    batch.fence->Reset();
+    freeFences_.push_back(batch.fence);
+  }
+  for (auto const& request : batch.requests) {
+    completions.push_back(Completion{request.onComplete, request.user_data, true});
+  }
+}
+
+void UploadScheduler::Poll() {
+  std::vector<Completion> completions;
+  {
+    std::lock_guard<std::mutex> lock(submitMutex_);
+    uint64_t const completed = timeline_ ? timeline_->GetCompletedValue() : 0;
+    // One queue: batches complete in submission order
+    while (!inFlight_.empty() && (timeline_ ? inFlight_.front().fenceValue <= completed
+                                            : inFlight_.front().fence->IsSignaled())) {
+      RetireBatch(inFlight_.front(), completions);
+      inFlight_.pop_front();
+    }
+  }
+  RunCompletions(completions);
+}
+
+void UploadScheduler::WaitForFenceValue(uint64_t value) {
+  std::vector<Completion> completions;
+  {
+    std::lock_guard<std::mutex> lock(submitMutex_);
+    if (timeline_) {
+      timeline_->Wait(std::min(value, submittedValue_));
+    }
+    while (!inFlight_.empty() && inFlight_.front().fenceValue <= value) {
+      if (inFlight_.front().fence) {
+        inFlight_.front().fence->Wait();
+      }
+      RetireBatch(inFlight_.front(), completions);
+      inFlight_.pop_front();
+    }
+  }
+  RunCompletions(completions);
+  Poll();
+}
+
+void UploadScheduler::WaitIdle() {
+  FlushAll();
+  uint64_t value = 0;
+  {
+    std::lock_guard<std::mutex> lock(submitMutex_);
+    value = submittedValue_;
+  }
+  WaitForFenceValue(value);
+}
+
+void UploadScheduler::RunCompletions(std::vector<Completion> const& completions) {
+  for (auto const& completion : completions) {
+    if (completion.onComplete) {
+      completion.onComplete(completion.success, completion.user_data);
+    }
+  }
+}
+
+void UploadScheduler::SetBytesPerFrameBudget(size_t bytes) {
+  std::lock_guard<std::mutex> lock(pendingMutex_);
+  bytesPerFrame_ = bytes;
+}
+
+size_t UploadScheduler::GetBytesPerFrameBudget() const {
+  std::lock_guard<std::mutex> lock(pendingMutex_);
+  return bytesPerFrame_;
+}
+
+uint64_t UploadScheduler::GetSubmittedValue() const {
+  std::lock_guard<std::mutex> lock(submitMutex_);
+  return submittedValue_;
+}
+
+uint64_t UploadScheduler::GetCompletedValue() const {
+  return completedValue_.load();
+}
+
+rhi::ISemaphore* UploadScheduler::GetTimeline() const {
+  return timeline_;
+}
+
+UploadSchedulerStats UploadScheduler::GetStats() const {
+  std::lock_guard<std::mutex> submitLock(submitMutex_);
+  std::lock_guard<std::mutex> lock(pendingMutex_);
+  UploadSchedulerStats stats = stats_;
+  stats.pendingUploads = pending_.size();
+  stats.pendingBytes = pendingBytes_;
+  stats.inFlightBatches = inFlight_.size();
+  stats.submittedValue = submittedValue_;
+  stats.completedValue = completedValue_.load();
+  return stats;
+}
+
+}  // namespace deviceresource
+}  // namespace te
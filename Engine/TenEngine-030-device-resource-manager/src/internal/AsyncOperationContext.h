@@ -4,11 +4,6 @@
 #pragma once
 
 #include <te/rhi/device.hpp>
-#include <te/rhi/command_list.hpp>
-#include <te/rhi/resources.hpp>
-#include <te/rhi/sync.hpp>
-#include <te/deviceresource/CommandListPool.h>
-#include <te/deviceresource/StagingBufferManager.h>
 #include <te/deviceresource/ResourceOperationTypes.h>
 #include <atomic>
 #include <mutex>
@@ -19,17 +14,11 @@ namespace internal {
 
 /**
  * Base class for async operation contexts.
- * Manages common resources like command lists, staging buffers, and fences.
- * Tracks operation status and progress.
+ * The upload itself is batched by the device's UploadScheduler; the context
+ * tracks operation status and progress until the completion callback runs.
  */
 struct AsyncOperationContext {
   rhi::IDevice* device;
-  CommandListPool* commandListPool;
-  StagingBufferManager* stagingBufferManager;
-  
-  rhi::ICommandList* cmd;
-  rhi::IBuffer* stagingBuffer;
-  rhi::IFence* fence;
 
   // Operation tracking
   std::atomic<ResourceOperationStatus> status{ResourceOperationStatus::Pending};
@@ -37,16 +26,8 @@ struct AsyncOperationContext {
   std::atomic<bool> cancelled{false};
   std::mutex statusMutex;  // Protect status changes
 
-  AsyncOperationContext(
-      rhi::IDevice* dev,
-      CommandListPool* pool,
-      StagingBufferManager* stagingMgr)
+  explicit AsyncOperationContext(rhi::IDevice* dev)
       : device(dev),
-        commandListPool(pool),
-        stagingBufferManager(stagingMgr),
-        cmd(nullptr),
-        stagingBuffer(nullptr),
-        fence(nullptr),
         status(ResourceOperationStatus::Pending),
         progress(0.0f),
         cancelled(false) {}
@@ -54,21 +35,19 @@ struct AsyncOperationContext {
   virtual ~AsyncOperationContext() = default;
 
   /**
-   * Cleanup resources. Should be called when operation completes or fails.
+   * Record the final status once the scheduler completes the upload.
+   * Returns true if the operation succeeded (uploaded and not cancelled).
    */
-  void Cleanup() {
-    if (commandListPool && cmd) {
-      commandListPool->Release(cmd);
-      cmd = nullptr;
-    }
-    if (stagingBufferManager && stagingBuffer) {
-      stagingBufferManager->Release(stagingBuffer);
-      stagingBuffer = nullptr;
-    }
-    if (device && fence) {
-      device->DestroyFence(fence);
-      fence = nullptr;
+  bool Finish(bool uploaded) {
+    std::lock_guard<std::mutex> lock(statusMutex);
+    bool const success = uploaded && !cancelled.load();
+    if (success) {
+      status.store(ResourceOperationStatus::Completed);
+    } else if (status.load() != ResourceOperationStatus::Cancelled) {
+      status.store(ResourceOperationStatus::Failed);
     }
+    progress.store(1.0f);
+    return success;
   }
 
   /**
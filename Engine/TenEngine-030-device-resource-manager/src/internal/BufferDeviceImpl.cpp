@@ -9,9 +9,7 @@
 #include <te/rhi/device.hpp>
 #include <te/rhi/resources.hpp>
 #include <te/rhi/command_list.hpp>
-#include <te/rhi/sync.hpp>
 #include <te/core/log.h>
-#include <te/core/thread.h>
 
 // Forward declaration for internal registration functions
 namespace te {
@@ -27,6 +25,21 @@ namespace te {
 namespace deviceresource {
 namespace internal {
 
+namespace {
+
+// State a buffer is left in after upload (based on usage)
+rhi::ResourceState FinalBufferState(rhi::BufferDesc const& bufferDesc) {
+  if (bufferDesc.usage & static_cast<uint32_t>(rhi::BufferUsage::Vertex)) {
+    return rhi::ResourceState::VertexBuffer;
+  }
+  if (bufferDesc.usage & static_cast<uint32_t>(rhi::BufferUsage::Index)) {
+    return rhi::ResourceState::IndexBuffer;
+  }
+  return rhi::ResourceState::Common;
+}
+
+}  // namespace
+
 rhi::IBuffer* CreateDeviceBufferSync(
     void const* data,
     size_t dataSize,
@@ -51,7 +64,7 @@ rhi::IBuffer* CreateDeviceBufferSync(
   }
 
   // Allocate staging buffer and copy data
-  rhi::IBuffer* stagingBuffer = AllocateAndCopyStagingBuffer(
+  StagingAllocation stagingBuffer = AllocateAndCopyStagingBuffer(
       device,
       deviceResources.stagingBufferManager.get(),
       data,
@@ -84,18 +97,11 @@ rhi::IBuffer* CreateDeviceBufferSync(
   cmd->ResourceBarrier(1, &barrier, 0, nullptr);
 
   // Copy staging buffer to GPU buffer
-  cmd->CopyBuffer(stagingBuffer, 0, buffer, 0, dataSize);
+  cmd->CopyBuffer(stagingBuffer.buffer, stagingBuffer.offset, buffer, 0, dataSize);
 
   // Resource barrier: CopyDst -> VertexBuffer/IndexBuffer (based on usage)
-  rhi::ResourceState finalState = rhi::ResourceState::Common;
-  if (bufferDesc.usage & static_cast<uint32_t>(rhi::BufferUsage::Vertex)) {
-    finalState = rhi::ResourceState::VertexBuffer;
-  } else if (bufferDesc.usage & static_cast<uint32_t>(rhi::BufferUsage::Index)) {
-    finalState = rhi::ResourceState::IndexBuffer;
-  }
-  
   barrier.srcState = rhi::ResourceState::CopyDst;
-  barrier.dstState = finalState;
+  barrier.dstState = FinalBufferState(bufferDesc);
   cmd->ResourceBarrier(1, &barrier, 0, nullptr);
 
   // End command list
@@ -116,205 +122,23 @@ rhi::IBuffer* CreateDeviceBufferSync(
   return buffer;
 }
 
-void AsyncBufferCreateWorker(void* ctx) {
+void OnBufferUploadComplete(bool success, void* ctx) {
   auto* context = static_cast<AsyncBufferCreateContext*>(ctx);
   if (!context) {
     return;
   }
 
-  // Check if cancelled
-  if (context->IsCancelled()) {
-    std::lock_guard<std::mutex> lock(context->statusMutex);
-    context->status.store(ResourceOperationStatus::Cancelled);
-    context->callback(nullptr, false, context->user_data);
-    delete context;
-    return;
-  }
-
-  // Update status: Uploading
-  {
-    std::lock_guard<std::mutex> lock(context->statusMutex);
-    context->status.store(ResourceOperationStatus::Uploading);
-  }
-  context->progress.store(0.1f);  // 10% - starting upload
-
-  // Allocate staging buffer
-  context->stagingBuffer = AllocateAndCopyStagingBuffer(
-      context->device,
-      context->stagingBufferManager,
-      context->data,
-      context->dataSize);
-  if (!context->stagingBuffer) {
-    te::core::Log(te::core::LogLevel::Error, "BufferDeviceImpl::AsyncBufferCreateWorker: Failed to allocate staging buffer");
-    std::lock_guard<std::mutex> lock(context->statusMutex);
-    context->status.store(ResourceOperationStatus::Failed);
-    context->callback(nullptr, false, context->user_data);
-    delete context;
-    return;
-  }
-
-  context->progress.store(0.3f);  // 30% - staging buffer allocated
-
-  // Check if cancelled
-  if (context->IsCancelled()) {
-    std::lock_guard<std::mutex> lock(context->statusMutex);
-    context->status.store(ResourceOperationStatus::Cancelled);
-    context->stagingBufferManager->Release(context->stagingBuffer);
-    context->callback(nullptr, false, context->user_data);
-    delete context;
-    return;
-  }
-
-  // Acquire command list from pool
-  context->cmd = context->commandListPool->Acquire();
-  if (!context->cmd) {
-    te::core::Log(te::core::LogLevel::Error, "BufferDeviceImpl::AsyncBufferCreateWorker: Failed to acquire command list");
-    std::lock_guard<std::mutex> lock(context->statusMutex);
-    context->status.store(ResourceOperationStatus::Failed);
-    context->stagingBufferManager->Release(context->stagingBuffer);
-    context->callback(nullptr, false, context->user_data);
-    delete context;
-    return;
-  }
-
-  context->progress.store(0.5f);  // 50% - command list acquired
-
-  // Check if cancelled
-  if (context->IsCancelled()) {
-    std::lock_guard<std::mutex> lock(context->statusMutex);
-    context->status.store(ResourceOperationStatus::Cancelled);
-    context->commandListPool->Release(context->cmd);
-    context->stagingBufferManager->Release(context->stagingBuffer);
-    context->callback(nullptr, false, context->user_data);
-    delete context;
-    return;
-  }
-
-  // Begin command list
-  context->cmd->Begin();
-
-  // Resource barrier: Common -> CopyDst
-  rhi::BufferBarrier barrier{};
-  barrier.buffer = context->buffer;
-  barrier.offset = 0;
-  barrier.size = context->bufferDesc.size;
-  barrier.srcState = rhi::ResourceState::Common;
-  barrier.dstState = rhi::ResourceState::CopyDst;
-  context->cmd->ResourceBarrier(1, &barrier, 0, nullptr);
-
-  // Copy staging buffer to GPU buffer
-  context->cmd->CopyBuffer(context->stagingBuffer, 0, context->buffer, 0, context->dataSize);
-
-  // Resource barrier: CopyDst -> VertexBuffer/IndexBuffer
-  rhi::ResourceState finalState = rhi::ResourceState::Common;
-  if (context->bufferDesc.usage & static_cast<uint32_t>(rhi::BufferUsage::Vertex)) {
-    finalState = rhi::ResourceState::VertexBuffer;
-  } else if (context->bufferDesc.usage & static_cast<uint32_t>(rhi::BufferUsage::Index)) {
-    finalState = rhi::ResourceState::IndexBuffer;
-  }
-  
-  barrier.srcState = rhi::ResourceState::CopyDst;
-  barrier.dstState = finalState;
-  context->cmd->ResourceBarrier(1, &barrier, 0, nullptr);
-
-  // End command list
-  context->cmd->End();
-
-  context->progress.store(0.7f);  // 70% - commands recorded
-
-  // Create fence for synchronization
-  context->fence = context->device->CreateFence(false);
-  if (!context->fence) {
-    te::core::Log(te::core::LogLevel::Error, "BufferDeviceImpl::AsyncBufferCreateWorker: Failed to create fence");
-    std::lock_guard<std::mutex> lock(context->statusMutex);
-    context->status.store(ResourceOperationStatus::Failed);
-    context->commandListPool->Release(context->cmd);
-    context->stagingBufferManager->Release(context->stagingBuffer);
-    context->callback(nullptr, false, context->user_data);
-    delete context;
-    return;
-  }
-
-  // Submit command list with fence
-  if (!SubmitCommandListAsync(context->cmd, context->device, context->fence)) {
-    std::lock_guard<std::mutex> lock(context->statusMutex);
-    context->status.store(ResourceOperationStatus::Failed);
-    context->device->DestroyFence(context->fence);
-    context->commandListPool->Release(context->cmd);
-    context->stagingBufferManager->Release(context->stagingBuffer);
-    context->callback(nullptr, false, context->user_data);
-    delete context;
-    return;
+  bool const succeeded = context->Finish(success);
+  if (!succeeded && context->buffer) {
+    // Failed or cancelled: the copy (if any) has completed, so the buffer can go
+    context->device->DestroyBuffer(context->buffer);
+    context->buffer = nullptr;
   }
 
-  // Update status: Submitted
-  {
-    std::lock_guard<std::mutex> lock(context->statusMutex);
-    context->status.store(ResourceOperationStatus::Submitted);
-  }
-  context->progress.store(0.8f);  // 80% - submitted to GPU
-
-  te::core::IThreadPool* pool = te::core::GetThreadPool();
-  te::core::ITaskExecutor* workerEx = pool ? pool->GetWorkerExecutor() : nullptr;
-  if (workerEx) {
-    workerEx->SubmitTask([](void* ctx) {
-      auto* ctxt = static_cast<AsyncBufferCreateContext*>(ctx);
-      if (!ctxt || !ctxt->fence) {
-        return;
-      }
-
-      // Wait for GPU to complete
-      ctxt->fence->Wait();
-
-      // Check if cancelled during wait
-      bool wasCancelled = ctxt->IsCancelled();
-      
-      // Update status
-      {
-        std::lock_guard<std::mutex> lock(ctxt->statusMutex);
-        if (!wasCancelled) {
-          ctxt->status.store(ResourceOperationStatus::Completed);
-        }
-      }
-      ctxt->progress.store(1.0f);  // 100% - completed
-
-      // Cleanup resources
-      ctxt->Cleanup();
-
-      // Call user callback
-      bool success = (ctxt->buffer != nullptr && !wasCancelled);
-      ctxt->callback(ctxt->buffer, success, ctxt->user_data);
-
-      // Unregister operation before deleting context
-      ResourceOperationHandle handle = reinterpret_cast<ResourceOperationHandle>(ctxt);
-      internal::UnregisterOperation(handle);
-
-      // Cleanup context
-      delete ctxt;
-    }, context);
-  } else {
-    // Fallback: synchronous wait
-    context->fence->Wait();
-    
-    bool wasCancelled = context->IsCancelled();
-    {
-      std::lock_guard<std::mutex> lock(context->statusMutex);
-      if (!wasCancelled) {
-        context->status.store(ResourceOperationStatus::Completed);
-      }
-    }
-    context->progress.store(1.0f);
-    
-    context->Cleanup();
-    bool success = (context->buffer != nullptr && !wasCancelled);
-    context->callback(context->buffer, success, context->user_data);
-    
-    // Unregister operation before deleting context
-    ResourceOperationHandle handle = reinterpret_cast<ResourceOperationHandle>(context);
-    internal::UnregisterOperation(handle);
-    
-    delete context;
-  }
+  // Unregister operation before deleting context
+  internal::UnregisterOperation(reinterpret_cast<ResourceOperationHandle>(context));
+  context->callback(context->buffer, succeeded, context->user_data);
+  delete context;
 }
 
 ResourceOperationHandle CreateDeviceBufferAsync(
@@ -351,22 +175,30 @@ ResourceOperationHandle CreateDeviceBufferAsync(
       bufferDesc,
       device,
       callback,
-      user_data,
-      deviceResources.commandListPool.get(),
-      deviceResources.stagingBufferManager.get());
+      user_data);
   context->buffer = buffer;
 
   // Register operation and get handle
   ResourceOperationHandle handle = internal::RegisterOperation(context);
 
-  te::core::IThreadPool* pool = te::core::GetThreadPool();
-  te::core::ITaskExecutor* workerEx = pool ? pool->GetWorkerExecutor() : nullptr;
-  if (workerEx) {
-    workerEx->SubmitTask(AsyncBufferCreateWorker, context);
-    return handle;
+  // Queue the copy; it is batched with other uploads on the next ProcessUploads
+  UploadRequest request{};
+  request.dstBuffer = buffer;
+  request.data = data;
+  request.size = dataSize;
+  request.finalState = FinalBufferState(bufferDesc);
+  request.onComplete = OnBufferUploadComplete;
+  request.user_data = context;
+  request.cancelled = &context->cancelled;
+  {
+    std::lock_guard<std::mutex> lock(context->statusMutex);
+    context->status.store(ResourceOperationStatus::Uploading);
+  }
+  context->progress.store(0.1f);  // 10% - queued for upload
+  if (!deviceResources.uploadScheduler->Enqueue(request)) {
+    OnBufferUploadComplete(false, context);
+    return nullptr;
   }
-  te::core::Log(te::core::LogLevel::Error, "BufferDeviceImpl::CreateDeviceBufferAsync: Thread pool not available, falling back to sync");
-  AsyncBufferCreateWorker(context);
   return handle;
 }
 
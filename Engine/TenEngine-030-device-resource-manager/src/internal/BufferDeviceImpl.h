@@ -47,10 +47,8 @@ struct AsyncBufferCreateContext : public AsyncOperationContext {
       rhi::BufferDesc const& desc,
       rhi::IDevice* dev,
       void (*cb)(rhi::IBuffer*, bool, void*),
-      void* ud,
-      CommandListPool* pool,
-      StagingBufferManager* stagingMgr)
-      : AsyncOperationContext(dev, pool, stagingMgr),
+      void* ud)
+      : AsyncOperationContext(dev),
         callback(cb),
         user_data(ud),
         data(d),
@@ -60,9 +58,9 @@ struct AsyncBufferCreateContext : public AsyncOperationContext {
 };
 
 /**
- * Worker function for async buffer creation.
+ * UploadScheduler completion callback for async buffer creation.
  */
-void AsyncBufferCreateWorker(void* ctx);
+void OnBufferUploadComplete(bool success, void* ctx);
 
 /**
  * Create GPU buffer asynchronously.
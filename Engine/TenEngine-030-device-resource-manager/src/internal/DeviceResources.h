@@ -5,6 +5,7 @@
 
 #include <te/deviceresource/CommandListPool.h>
 #include <te/deviceresource/StagingBufferManager.h>
+#include <te/deviceresource/UploadScheduler.h>
 #include <te/rhi/device.hpp>
 #include <memory>
 
@@ -18,6 +19,7 @@ namespace internal {
 struct DeviceResources {
   std::unique_ptr<CommandListPool> commandListPool;
   std::unique_ptr<StagingBufferManager> stagingBufferManager;
+  std::unique_ptr<UploadScheduler> uploadScheduler;  // Declared last: destroyed before the pool and staging
   
   // Default constructor (required for std::unordered_map)
   DeviceResources() = default;
@@ -25,7 +27,9 @@ struct DeviceResources {
   // Constructor with device
   DeviceResources(rhi::IDevice* device)
       : commandListPool(std::make_unique<CommandListPool>(device)),
-        stagingBufferManager(std::make_unique<StagingBufferManager>(device)) {
+        stagingBufferManager(std::make_unique<StagingBufferManager>(device)),
+        uploadScheduler(std::make_unique<UploadScheduler>(
+            device, stagingBufferManager.get(), commandListPool.get())) {
   }
   
   // Move constructor
@@ -71,22 +71,23 @@ bool SubmitCommandListAsync(
   return true;
 }
 
-rhi::IBuffer* AllocateAndCopyStagingBuffer(
+StagingAllocation AllocateAndCopyStagingBuffer(
     rhi::IDevice* device,
     StagingBufferManager* stagingBufferManager,
     void const* data,
-    size_t size) {
+    size_t size,
+    size_t alignment) {
   if (!device || !stagingBufferManager || !data || size == 0) {
-    return nullptr;
+    return StagingAllocation{};
   }
 
-  rhi::IBuffer* stagingBuffer = stagingBufferManager->Allocate(size);
-  if (!stagingBuffer) {
-    return nullptr;
+  StagingAllocation staging = stagingBufferManager->Allocate(size, alignment);
+  if (!staging) {
+    return StagingAllocation{};
   }
 
-  device->UpdateBuffer(stagingBuffer, 0, data, size);
-  return stagingBuffer;
+  stagingBufferManager->Write(staging, data, size);
+  return staging;
 }
 
 void CopyBufferToTexture(
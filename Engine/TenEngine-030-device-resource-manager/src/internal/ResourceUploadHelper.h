@@ -43,13 +43,14 @@ bool SubmitCommandListAsync(
     rhi::QueueType queueType = rhi::QueueType::Graphics);
 
 /**
- * Allocate staging buffer and copy data to it.
+ * Allocate staging region and copy data to it.
  */
-rhi::IBuffer* AllocateAndCopyStagingBuffer(
+StagingAllocation AllocateAndCopyStagingBuffer(
     rhi::IDevice* device,
     StagingBufferManager* stagingBufferManager,
     void const* data,
-    size_t size);
+    size_t size,
+    size_t alignment = StagingBufferManager::kDefaultAlignment);
 
 /**
  * Copy buffer to texture region.
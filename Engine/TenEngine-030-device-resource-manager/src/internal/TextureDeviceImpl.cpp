@@ -9,9 +9,7 @@
 #include <te/rhi/device.hpp>
 #include <te/rhi/resources.hpp>
 #include <te/rhi/command_list.hpp>
-#include <te/rhi/sync.hpp>
 #include <te/core/log.h>
-#include <te/core/thread.h>
 
 // Forward declaration for internal registration functions
 namespace te {
@@ -51,11 +49,12 @@ rhi::ITexture* CreateDeviceTextureSync(
   }
 
   // Allocate staging buffer and copy data
-  rhi::IBuffer* stagingBuffer = AllocateAndCopyStagingBuffer(
+  StagingAllocation stagingBuffer = AllocateAndCopyStagingBuffer(
       device,
       deviceResources.stagingBufferManager.get(),
       pixelData,
-      pixelDataSize);
+      pixelDataSize,
+      StagingBufferManager::kTextureCopyAlignment);
   if (!stagingBuffer) {
     te::core::Log(te::core::LogLevel::Error, "TextureDeviceImpl::CreateDeviceTextureSync: Failed to allocate staging buffer");
     device->DestroyTexture(texture);
@@ -78,7 +77,7 @@ rhi::ITexture* CreateDeviceTextureSync(
   SetupTextureBarrier(cmd, texture, rhi::ResourceState::Common, rhi::ResourceState::CopyDst);
 
   // Copy buffer to texture
-  CopyBufferToTexture(cmd, stagingBuffer, 0, texture, textureDesc);
+  CopyBufferToTexture(cmd, stagingBuffer.buffer, stagingBuffer.offset, texture, textureDesc);
 
   // Resource barrier: CopyDst -> ShaderResource
   SetupTextureBarrier(cmd, texture, rhi::ResourceState::CopyDst, rhi::ResourceState::ShaderResource);
@@ -101,190 +100,23 @@ rhi::ITexture* CreateDeviceTextureSync(
   return texture;
 }
 
-void AsyncTextureCreateWorker(void* ctx) {
+void OnTextureUploadComplete(bool success, void* ctx) {
   auto* context = static_cast<AsyncTextureCreateContext*>(ctx);
   if (!context) {
     return;
   }
 
-  // Check if cancelled
-  if (context->IsCancelled()) {
-    std::lock_guard<std::mutex> lock(context->statusMutex);
-    context->status.store(ResourceOperationStatus::Cancelled);
-    context->callback(nullptr, false, context->user_data);
-    delete context;
-    return;
-  }
-
-  // Update status: Uploading
-  {
-    std::lock_guard<std::mutex> lock(context->statusMutex);
-    context->status.store(ResourceOperationStatus::Uploading);
-  }
-  context->progress.store(0.1f);  // 10% - starting upload
-
-  // Allocate staging buffer
-  context->stagingBuffer = AllocateAndCopyStagingBuffer(
-      context->device,
-      context->stagingBufferManager,
-      context->pixelData,
-      context->pixelDataSize);
-  if (!context->stagingBuffer) {
-    te::core::Log(te::core::LogLevel::Error, "TextureDeviceImpl::AsyncTextureCreateWorker: Failed to allocate staging buffer");
-    std::lock_guard<std::mutex> lock(context->statusMutex);
-    context->status.store(ResourceOperationStatus::Failed);
-    context->callback(nullptr, false, context->user_data);
-    delete context;
-    return;
-  }
-
-  context->progress.store(0.3f);  // 30% - staging buffer allocated
-
-  // Check if cancelled
-  if (context->IsCancelled()) {
-    std::lock_guard<std::mutex> lock(context->statusMutex);
-    context->status.store(ResourceOperationStatus::Cancelled);
-    context->stagingBufferManager->Release(context->stagingBuffer);
-    context->callback(nullptr, false, context->user_data);
-    delete context;
-    return;
-  }
-
-  // Acquire command list from pool
-  context->cmd = context->commandListPool->Acquire();
-  if (!context->cmd) {
-    te::core::Log(te::core::LogLevel::Error, "TextureDeviceImpl::AsyncTextureCreateWorker: Failed to acquire command list");
-    std::lock_guard<std::mutex> lock(context->statusMutex);
-    context->status.store(ResourceOperationStatus::Failed);
-    context->stagingBufferManager->Release(context->stagingBuffer);
-    context->callback(nullptr, false, context->user_data);
-    delete context;
-    return;
-  }
-
-  context->progress.store(0.5f);  // 50% - command list acquired
-
-  // Check if cancelled
-  if (context->IsCancelled()) {
-    std::lock_guard<std::mutex> lock(context->statusMutex);
-    context->status.store(ResourceOperationStatus::Cancelled);
-    context->commandListPool->Release(context->cmd);
-    context->stagingBufferManager->Release(context->stagingBuffer);
-    context->callback(nullptr, false, context->user_data);
-    delete context;
-    return;
+  bool const succeeded = context->Finish(success);
+  if (!succeeded && context->texture) {
+    // Failed or cancelled: the copy (if any) has completed, so the texture can go
+    context->device->DestroyTexture(context->texture);
+    context->texture = nullptr;
   }
 
-  // Begin command list
-  context->cmd->Begin();
-
-  // Resource barrier: Common -> CopyDst
-  SetupTextureBarrier(context->cmd, context->texture, rhi::ResourceState::Common, rhi::ResourceState::CopyDst);
-
-  // Copy buffer to texture
-  CopyBufferToTexture(context->cmd, context->stagingBuffer, 0, context->texture, context->rhiDesc);
-
-  // Resource barrier: CopyDst -> ShaderResource
-  SetupTextureBarrier(context->cmd, context->texture, rhi::ResourceState::CopyDst, rhi::ResourceState::ShaderResource);
-
-  // End command list
-  context->cmd->End();
-
-  context->progress.store(0.7f);  // 70% - commands recorded
-
-  // Create fence for synchronization
-  context->fence = context->device->CreateFence(false);
-  if (!context->fence) {
-    te::core::Log(te::core::LogLevel::Error, "TextureDeviceImpl::AsyncTextureCreateWorker: Failed to create fence");
-    std::lock_guard<std::mutex> lock(context->statusMutex);
-    context->status.store(ResourceOperationStatus::Failed);
-    context->commandListPool->Release(context->cmd);
-    context->stagingBufferManager->Release(context->stagingBuffer);
-    context->callback(nullptr, false, context->user_data);
-    delete context;
-    return;
-  }
-
-  // Submit command list with fence
-  if (!SubmitCommandListAsync(context->cmd, context->device, context->fence)) {
-    std::lock_guard<std::mutex> lock(context->statusMutex);
-    context->status.store(ResourceOperationStatus::Failed);
-    context->device->DestroyFence(context->fence);
-    context->commandListPool->Release(context->cmd);
-    context->stagingBufferManager->Release(context->stagingBuffer);
-    context->callback(nullptr, false, context->user_data);
-    delete context;
-    return;
-  }
-
-  // Update status: Submitted
-  {
-    std::lock_guard<std::mutex> lock(context->statusMutex);
-    context->status.store(ResourceOperationStatus::Submitted);
-  }
-  context->progress.store(0.8f);  // 80% - submitted to GPU
-
-  te::core::IThreadPool* pool = te::core::GetThreadPool();
-  te::core::ITaskExecutor* workerEx = pool ? pool->GetWorkerExecutor() : nullptr;
-  if (workerEx) {
-    workerEx->SubmitTask([](void* ctx) {
-      auto* ctxt = static_cast<AsyncTextureCreateContext*>(ctx);
-      if (!ctxt || !ctxt->fence) {
-        return;
-      }
-
-      // Wait for GPU to complete
-      ctxt->fence->Wait();
-
-      // Check if cancelled during wait
-      bool wasCancelled = ctxt->IsCancelled();
-      
-      // Update status
-      {
-        std::lock_guard<std::mutex> lock(ctxt->statusMutex);
-        if (!wasCancelled) {
-          ctxt->status.store(ResourceOperationStatus::Completed);
-        }
-      }
-      ctxt->progress.store(1.0f);  // 100% - completed
-
-      // Cleanup resources
-      ctxt->Cleanup();
-
-      // Call user callback
-      bool success = (ctxt->texture != nullptr && !wasCancelled);
-      ctxt->callback(ctxt->texture, success, ctxt->user_data);
-
-      // Unregister operation before deleting context
-      ResourceOperationHandle handle = reinterpret_cast<ResourceOperationHandle>(ctxt);
-      internal::UnregisterOperation(handle);
-
-      // Cleanup context
-      delete ctxt;
-    }, context);
-  } else {
-    // Fallback: synchronous wait
-    context->fence->Wait();
-    
-    bool wasCancelled = context->IsCancelled();
-    {
-      std::lock_guard<std::mutex> lock(context->statusMutex);
-      if (!wasCancelled) {
-        context->status.store(ResourceOperationStatus::Completed);
-      }
-    }
-    context->progress.store(1.0f);
-    
-    context->Cleanup();
-    bool success = (context->texture != nullptr && !wasCancelled);
-    context->callback(context->texture, success, context->user_data);
-    
-    // Unregister operation before deleting context
-    ResourceOperationHandle handle = reinterpret_cast<ResourceOperationHandle>(context);
-    internal::UnregisterOperation(handle);
-    
-    delete context;
-  }
+  // Unregister operation before deleting context
+  internal::UnregisterOperation(reinterpret_cast<ResourceOperationHandle>(context));
+  context->callback(context->texture, succeeded, context->user_data);
+  delete context;
 }
 
 ResourceOperationHandle CreateDeviceTextureAsync(
@@ -321,22 +153,31 @@ ResourceOperationHandle CreateDeviceTextureAsync(
       textureDesc,
       device,
       callback,
-      user_data,
-      deviceResources.commandListPool.get(),
-      deviceResources.stagingBufferManager.get());
+      user_data);
   context->texture = texture;
 
   // Register operation and get handle
   ResourceOperationHandle handle = internal::RegisterOperation(context);
 
-  te::core::IThreadPool* pool = te::core::GetThreadPool();
-  te::core::ITaskExecutor* workerEx = pool ? pool->GetWorkerExecutor() : nullptr;
-  if (workerEx) {
-    workerEx->SubmitTask(AsyncTextureCreateWorker, context);
-    return handle;
+  // Queue the copy; it is batched with other uploads on the next ProcessUploads
+  UploadRequest request{};
+  request.dstTexture = texture;
+  request.textureDesc = textureDesc;
+  request.data = pixelData;
+  request.size = pixelDataSize;
+  request.finalState = rhi::ResourceState::ShaderResource;
+  request.onComplete = OnTextureUploadComplete;
+  request.user_data = context;
+  request.cancelled = &context->cancelled;
+  {
+    std::lock_guard<std::mutex> lock(context->statusMutex);
+    context->status.store(ResourceOperationStatus::Uploading);
+  }
+  context->progress.store(0.1f);  // 10% - queued for upload
+  if (!deviceResources.uploadScheduler->Enqueue(request)) {
+    OnTextureUploadComplete(false, context);
+    return nullptr;
   }
-  te::core::Log(te::core::LogLevel::Error, "TextureDeviceImpl::CreateDeviceTextureAsync: Thread pool not available, falling back to sync");
-  AsyncTextureCreateWorker(context);
   return handle;
 }
 
@@ -358,11 +199,12 @@ bool UpdateDeviceTexture(
   }
 
   // Allocate staging buffer
-  rhi::IBuffer* stagingBuffer = AllocateAndCopyStagingBuffer(
+  StagingAllocation stagingBuffer = AllocateAndCopyStagingBuffer(
       device,
       deviceResources.stagingBufferManager.get(),
       data,
-      size);
+      size,
+      StagingBufferManager::kTextureCopyAlignment);
   if (!stagingBuffer) {
     te::core::Log(te::core::LogLevel::Error, "TextureDeviceImpl::UpdateDeviceTexture: Failed to allocate staging buffer");
     return false;
@@ -383,7 +225,7 @@ bool UpdateDeviceTexture(
   SetupTextureBarrier(cmd, texture, rhi::ResourceState::ShaderResource, rhi::ResourceState::CopyDst);
 
   // Copy buffer to texture using provided texture description
-  CopyBufferToTexture(cmd, stagingBuffer, 0, texture, textureDesc);
+  CopyBufferToTexture(cmd, stagingBuffer.buffer, stagingBuffer.offset, texture, textureDesc);
 
   // Resource barrier: CopyDst -> ShaderResource
   SetupTextureBarrier(cmd, texture, rhi::ResourceState::CopyDst, rhi::ResourceState::ShaderResource);
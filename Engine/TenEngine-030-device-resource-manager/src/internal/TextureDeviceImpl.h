@@ -47,10 +47,8 @@ struct AsyncTextureCreateContext : public AsyncOperationContext {
       rhi::TextureDesc const& desc,
       rhi::IDevice* dev,
       void (*cb)(rhi::ITexture*, bool, void*),
-      void* ud,
-      CommandListPool* pool,
-      StagingBufferManager* stagingMgr)
-      : AsyncOperationContext(dev, pool, stagingMgr),
+      void* ud)
+      : AsyncOperationContext(dev),
         callback(cb),
         user_data(ud),
         pixelData(pData),
@@ -60,9 +58,9 @@ struct AsyncTextureCreateContext : public AsyncOperationContext {
 };
 
 /**
- * Worker function for async texture creation.
+ * UploadScheduler completion callback for async texture creation.
  */
-void AsyncTextureCreateWorker(void* ctx);
+void OnTextureUploadComplete(bool success, void* ctx);
 
 /**
  * Create GPU texture asynchronously.
@@ -0,0 +1,107 @@
+/** @file test_staging_buffer_manager.cpp
+ *  030-DeviceResourceManager unit tests: ring staging allocator (Null RHI backend).
+ */
+#include <te/deviceresource/StagingBufferManager.h>
+#include <te/rhi/backend_null.hpp>
+#include <te/rhi/device.hpp>
+
+#include <cassert>
+#include <cstdio>
+#include <cstring>
+#include <vector>
+
+using namespace te::deviceresource;
+
+namespace {
+
+constexpr size_t kRingSize = 4096;
+
+// Small uploads share the ring buffer with aligned offsets
+void TestSubAllocation(te::rhi::IDevice* device) {
+  StagingBufferManager mgr(device, kRingSize);
+  StagingAllocation a = mgr.Allocate(100);
+  StagingAllocation b = mgr.Allocate(100);
+  assert(a && b && !a.dedicated && !b.dedicated);
+  assert(a.buffer == b.buffer);
+  assert(a.offset == 0);
+  assert(b.offset == StagingBufferManager::kDefaultAlignment);
+
+  unsigned char bytes[100];
+  std::memset(bytes, 0xAB, sizeof(bytes));
+  assert(mgr.Write(b, bytes, sizeof(bytes)));
+  assert(!mgr.Write(b, bytes, sizeof(bytes), 1));  // Past the end of the region
+  auto* ring = static_cast<unsigned char*>(te::rhi::GetNullBufferData(b.buffer, nullptr));
+  assert(std::memcmp(ring + b.offset, bytes, sizeof(bytes)) == 0);
+
+  StagingBufferStats stats = mgr.GetStats();
+  assert(stats.ringCapacity == kRingSize);
+  assert(stats.liveRingAllocations == 2);
+  assert(stats.totalDedicatedAllocations == 0);
+
+  mgr.Release(a);
+  mgr.Release(b);
+  assert(mgr.GetStats().ringBytesInUse == 0);
+}
+
+// Regions retire in allocation order and the ring wraps around
+void TestFenceRetirementAndWrap(te::rhi::IDevice* device) {
+  StagingBufferManager mgr(device, kRingSize);
+  std::vector<StagingAllocation> frame1;
+  for (int i = 0; i < 3; ++i) frame1.push_back(mgr.Allocate(1000));
+  StagingAllocation frame2 = mgr.Allocate(1000);
+  assert(frame2 && !frame2.dedicated && frame2.offset == 3072);
+
+  // Ring is full: overflow goes to a dedicated buffer
+  StagingAllocation overflow = mgr.Allocate(1000);
+  assert(overflow && overflow.dedicated);
+  mgr.Release(overflow);
+
+  for (auto const& alloc : frame1) mgr.ReleaseAfter(alloc, 1);
+  mgr.ReleaseAfter(frame2, 2);
+  mgr.RetireCompleted(0);
+  assert(mgr.GetStats().liveRingAllocations == 4);
+
+  mgr.RetireCompleted(1);
+  StagingBufferStats stats = mgr.GetStats();
+  assert(stats.liveRingAllocations == 1);
+  assert(stats.ringBytesInUse == 1024);
+
+  // Does not fit at the end: wraps to the reclaimed start of the ring
+  StagingAllocation wrapped = mgr.Allocate(2048);
+  assert(wrapped && !wrapped.dedicated && wrapped.offset == 0);
+  assert(mgr.GetStats().ringWraps == 1);
+  mgr.Release(wrapped);
+  mgr.RetireCompleted(2);
+  assert(mgr.GetStats().ringBytesInUse == 0);
+}
+
+// Uploads larger than the ring use dedicated buffers destroyed on retirement
+void TestOversizedFallback(te::rhi::IDevice* device) {
+  StagingBufferManager mgr(device, kRingSize);
+  StagingAllocation big = mgr.Allocate(kRingSize * 2);
+  assert(big && big.dedicated && big.offset == 0);
+  assert(mgr.GetStats().dedicatedBytesInUse == kRingSize * 2);
+  mgr.ReleaseAfter(big, 5);
+  mgr.RetireCompleted(4);
+  assert(mgr.GetStats().liveDedicatedBuffers == 1);
+  mgr.RetireCompleted(5);
+  StagingBufferStats stats = mgr.GetStats();
+  assert(stats.liveDedicatedBuffers == 0 && stats.dedicatedBytesInUse == 0);
+}
+
+}  // namespace
+
+int main() {
+  te::rhi::IDevice* device = te::rhi::CreateDevice(te::rhi::Backend::Null);
+  if (!device) {
+    std::printf("Null RHI backend unavailable; skip test_staging_buffer_manager\n");
+    return 0;
+  }
+  TestSubAllocation(device);
+  TestFenceRetirementAndWrap(device);
+  TestOversizedFallback(device);
+  assert(te::rhi::GetNullDeviceCounters(device).liveResourceBytes == 0);
+  te::rhi::DestroyDevice(device);
+  std::printf("test_staging_buffer_manager passed\n");
+  return 0;
+}
@@ -0,0 +1,204 @@
+/** @file test_upload_scheduler.cpp
+ *  030-DeviceResourceManager unit tests: batched uploads, polling and throttling (Null RHI backend).
+ */
+#include <te/deviceresource/UploadScheduler.h>
+#include <te/deviceresource/DeviceResourceManager.h>
+#include <te/rhi/backend_null.hpp>
+#include <te/rhi/device.hpp>
+#include <te/rhi/sync.hpp>
+
+#include <atomic>
+#include <cassert>
+#include <cstdio>
+#include <cstring>
+#include <vector>
+
+using namespace te::deviceresource;
+
+namespace {
+
+struct Completions {
+  int succeeded{0};
+  int failed{0};
+};
+
+void OnComplete(bool success, void* user_data) {
+  auto* c = static_cast<Completions*>(user_data);
+  if (success) {
+    ++c->succeeded;
+  } else {
+    ++c->failed;
+  }
+}
+
+te::rhi::IBuffer* MakeBuffer(te::rhi::IDevice* device, size_t size) {
+  te::rhi::BufferDesc desc{};
+  desc.size = size;
+  desc.usage = static_cast<uint32_t>(te::rhi::BufferUsage::Vertex) |
+               static_cast<uint32_t>(te::rhi::BufferUsage::CopyDst);
+  return device->CreateBuffer(desc);
+}
+
+// Many uploads are recorded into one command list and complete on Poll
+void TestCoalescing(te::rhi::IDevice* device) {
+  StagingBufferManager staging(device, 64 * 1024);
+  CommandListPool pool(device);
+  UploadScheduler scheduler(device, &staging, &pool);
+  te::rhi::ResetNullDeviceCounters(device);
+
+  Completions done;
+  std::vector<te::rhi::IBuffer*> buffers;
+  unsigned char bytes[8][128];
+  for (int i = 0; i < 8; ++i) {
+    std::memset(bytes[i], i + 1, sizeof(bytes[i]));
+    buffers.push_back(MakeBuffer(device, sizeof(bytes[i])));
+    UploadRequest request{};
+    request.dstBuffer = buffers.back();
+    request.data = bytes[i];
+    request.size = sizeof(bytes[i]);
+    request.finalState = te::rhi::ResourceState::VertexBuffer;
+    request.onComplete = OnComplete;
+    request.user_data = &done;
+    assert(scheduler.Enqueue(request));
+  }
+  te::rhi::TextureDesc td{};
+  td.width = 4;
+  td.height = 4;
+  td.depth = 1;
+  te::rhi::ITexture* texture = device->CreateTexture(td);
+  unsigned char pixels[4 * 4 * 4];
+  std::memset(pixels, 0x7F, sizeof(pixels));
+  UploadRequest texRequest{};
+  texRequest.dstTexture = texture;
+  texRequest.textureDesc = td;
+  texRequest.data = pixels;
+  texRequest.size = sizeof(pixels);
+  texRequest.finalState = te::rhi::ResourceState::ShaderResource;
+  texRequest.onComplete = OnComplete;
+  texRequest.user_data = &done;
+  assert(scheduler.Enqueue(texRequest));
+
+  assert(scheduler.Flush() == 1);
+  te::rhi::NullDeviceCounters c = te::rhi::GetNullDeviceCounters(device);
+  assert(c.submits == 1);
+  assert(c.barriers == 2 * 9);
+  assert(done.succeeded == 0);  // Completion is reported by Poll only
+  assert(scheduler.GetStats().inFlightBatches == 1);
+  assert(scheduler.GetTimeline() && scheduler.GetTimeline()->GetCompletedValue() == 1);  // Signaled by the copy
+
+  scheduler.Poll();
+  assert(done.succeeded == 9 && done.failed == 0);
+  assert(scheduler.GetCompletedValue() == 1);
+  assert(staging.GetStats().ringBytesInUse == 0);
+  for (int i = 0; i < 8; ++i) {
+    assert(std::memcmp(te::rhi::GetNullBufferData(buffers[i], nullptr), bytes[i], sizeof(bytes[i])) == 0);
+  }
+  assert(std::memcmp(te::rhi::GetNullTextureData(texture, nullptr), pixels, sizeof(pixels)) == 0);
+
+  // Nothing pending: no empty submissions
+  assert(scheduler.Flush() == 0);
+  assert(te::rhi::GetNullDeviceCounters(device).submits == 1);
+
+  for (auto* buffer : buffers) device->DestroyBuffer(buffer);
+  device->DestroyTexture(texture);
+}
+
+// The byte budget spreads uploads over several flushes; cancelled uploads fail
+void TestThrottlingAndCancel(te::rhi::IDevice* device) {
+  StagingBufferManager staging(device, 64 * 1024);
+  CommandListPool pool(device);
+  UploadScheduler scheduler(device, &staging, &pool);
+  scheduler.SetBytesPerFrameBudget(1000);
+  te::rhi::ResetNullDeviceCounters(device);
+
+  Completions done;
+  std::atomic<bool> cancelled{false};
+  unsigned char bytes[400] = {};
+  te::rhi::IBuffer* buffer = MakeBuffer(device, 6 * sizeof(bytes));
+  for (int i = 0; i < 6; ++i) {
+    UploadRequest request{};
+    request.dstBuffer = buffer;
+    request.dstOffset = i * sizeof(bytes);
+    request.data = bytes;
+    request.size = sizeof(bytes);
+    request.onComplete = OnComplete;
+    request.user_data = &done;
+    request.cancelled = (i == 5) ? &cancelled : nullptr;
+    assert(scheduler.Enqueue(request));
+  }
+  cancelled.store(true);
+
+  assert(scheduler.Flush() == 1);
+  assert(scheduler.GetStats().pendingUploads == 4);
+  assert(scheduler.Flush() == 2);
+  assert(scheduler.Flush() == 3);  // Last real upload; the cancelled one fails here
+  assert(done.failed == 1);
+  assert(scheduler.Flush() == 0);
+
+  UploadSchedulerStats stats = scheduler.GetStats();
+  assert(stats.totalBatches == 3 && stats.totalUploads == 5);
+  assert(stats.throttledFlushes == 2);
+  assert(te::rhi::GetNullDeviceCounters(device).submits == 3);
+
+  scheduler.WaitForFenceValue(2);
+  assert(done.succeeded == 5);  // Poll after the wait also retires batch 3
+  assert(scheduler.GetCompletedValue() == 3);
+  device->DestroyBuffer(buffer);
+}
+
+struct BufferResult {
+  int completed{0};
+  te::rhi::IBuffer* buffer{nullptr};
+};
+
+void OnBufferCreated(te::rhi::IBuffer* buffer, bool success, void* user_data) {
+  auto* r = static_cast<BufferResult*>(user_data);
+  assert(success && buffer);
+  ++r->completed;
+  r->buffer = buffer;
+}
+
+// Async creation through DeviceResourceManager completes on ProcessUploads
+void TestManagerAsync(te::rhi::IDevice* device) {
+  te::rhi::ResetNullDeviceCounters(device);
+  unsigned char bytes[3][256];
+  BufferResult results[3];
+  ResourceOperationHandle handles[3];
+  for (int i = 0; i < 3; ++i) {
+    std::memset(bytes[i], 0x10 * (i + 1), sizeof(bytes[i]));
+    te::rhi::BufferDesc desc{};
+    desc.size = sizeof(bytes[i]);
+    desc.usage = static_cast<uint32_t>(te::rhi::BufferUsage::Index);
+    handles[i] = DeviceResourceManager::CreateDeviceBufferAsync(
+        bytes[i], sizeof(bytes[i]), desc, device, OnBufferCreated, &results[i]);
+    assert(handles[i]);
+    assert(DeviceResourceManager::GetOperationStatus(handles[i]) == ResourceOperationStatus::Uploading);
+  }
+  assert(results[0].completed == 0);
+
+  DeviceResourceManager::ProcessUploads(device);
+  assert(te::rhi::GetNullDeviceCounters(device).submits == 1);
+  for (int i = 0; i < 3; ++i) {
+    assert(results[i].completed == 1);
+    assert(std::memcmp(te::rhi::GetNullBufferData(results[i].buffer, nullptr), bytes[i], sizeof(bytes[i])) == 0);
+    DeviceResourceManager::DestroyDeviceBuffer(results[i].buffer, device);
+  }
+  DeviceResourceManager::CleanupDevice(device);
+}
+
+}  // namespace
+
+int main() {
+  te::rhi::IDevice* device = te::rhi::CreateDevice(te::rhi::Backend::Null);
+  if (!device) {
+    std::printf("Null RHI backend unavailable; skip test_upload_scheduler\n");
+    return 0;
+  }
+  TestCoalescing(device);
+  TestThrottlingAndCancel(device);
+  TestManagerAsync(device);
+  assert(te::rhi::GetNullDeviceCounters(device).liveResourceBytes == 0);
+  te::rhi::DestroyDevice(device);
+  std::printf("test_upload_scheduler passed\n");
+  return 0;
+}
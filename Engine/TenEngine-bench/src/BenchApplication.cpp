@@ -0,0 +1,85 @@
+/**
+ * @file BenchApplication.cpp
+ * @brief TenEngine-bench: 003-Application event queue and frame pacing benchmarks.
+ */
+
+#include "Benchmark.h"
+
+#include <te/application/Event.h>
+#include <te/application/FramePacer.h>
+#include <te/core/platform.h>
+
+#include <chrono>
+#include <thread>
+
+namespace te::bench {
+namespace {
+
+te::application::Event MakeMouseEvent(int32_t i) {
+  te::application::Event event{};
+  event.type = te::application::EventType::MouseMove;
+  event.mouse.x = i;
+  event.mouse.y = -i;
+  return event;
+}
+
+/// Arg() events pushed, then popped one at a time (Input-style consumer loop)
+void EventQueuePushPop(State& state) {
+  int32_t const count = static_cast<int32_t>(state.Arg());
+  te::application::EventQueue queue(static_cast<std::size_t>(count));
+  te::application::Event event{};
+  while (state.KeepRunning()) {
+    for (int32_t i = 0; i < count; ++i) {
+      queue.Push(MakeMouseEvent(i));
+    }
+    while (queue.Pop(event)) {
+      DoNotOptimize(event);
+    }
+  }
+  state.SetItemsProcessed(state.Iterations() * count);
+}
+
+/// Arg() events pushed, then drained in batches of 64
+void EventQueuePushDrain(State& state) {
+  int32_t const count = static_cast<int32_t>(state.Arg());
+  te::application::EventQueue queue(static_cast<std::size_t>(count));
+  te::application::Event batch[64];
+  while (state.KeepRunning()) {
+    for (int32_t i = 0; i < count; ++i) {
+      queue.Push(MakeMouseEvent(i));
+    }
+    while (std::size_t drained = queue.Drain(batch, 64)) {
+      DoNotOptimize(batch[drained - 1]);
+    }
+  }
+  state.SetItemsProcessed(state.Iterations() * count);
+}
+
+/// One paced frame at Arg() Hz; the median should equal the period, the spread is jitter
+void FramePacerWait(State& state) {
+  te::application::FramePacer pacer;
+  pacer.SetTargetPeriod(1.0 / static_cast<double>(state.Arg()));
+  pacer.Reset(te::core::HighResolutionTimer());
+  while (state.KeepRunning()) {
+    pacer.RecordFrame(pacer.WaitForNextFrame());
+  }
+  state.SetItemsProcessed(state.Iterations());
+}
+
+/// Baseline for FramePacerWait: one sleep_for of the Arg() Hz period (scheduler overshoot included)
+void SleepForPeriod(State& state) {
+  auto const period = std::chrono::duration<double>(1.0 / static_cast<double>(state.Arg()));
+  while (state.KeepRunning()) {
+    std::this_thread::sleep_for(period);
+  }
+  state.SetItemsProcessed(state.Iterations());
+}
+
+}  // namespace
+
+TE_BENCHMARK("Application/EventQueuePushPop", EventQueuePushPop, 256, 4096);
+TE_BENCHMARK("Application/EventQueuePushDrain", EventQueuePushDrain, 256, 4096);
+TE_BENCHMARK("Application/FramePacerWait", FramePacerWait, 1000, 240);
+TE_BENCHMARK("Application/SleepForPeriod", SleepForPeriod, 1000, 240);
+
+}  // namespace te::bench
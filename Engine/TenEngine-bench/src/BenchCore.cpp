@@ -0,0 +1,46 @@
+/**
+ * @file BenchCore.cpp
+ * @brief TenEngine-bench: 001-Core allocation benchmarks.
+ */
+
+#include "Benchmark.h"
+
+#include <te/core/alloc.h>
+
+namespace te::bench {
+namespace {
+
+/// One Alloc/Free pair of Arg() bytes
+void AllocFree(State& state) {
+  std::size_t const size = static_cast<std::size_t>(state.Arg());
+  while (state.KeepRunning()) {
+    void* p = te::core::Alloc(size, 16);
+    DoNotOptimize(p);
+    te::core::Free(p);
+  }
+  state.SetItemsProcessed(state.Iterations());
+}
+
+/// 256 live blocks of Arg() bytes, freed in allocation order
+void AllocFreeBatch(State& state) {
+  constexpr int kBlocks = 256;
+  std::size_t const size = static_cast<std::size_t>(state.Arg());
+  void* blocks[kBlocks];
+  while (state.KeepRunning()) {
+    for (int i = 0; i < kBlocks; ++i) {
+      blocks[i] = te::core::Alloc(size, 16);
+    }
+    DoNotOptimize(blocks);
+    for (int i = 0; i < kBlocks; ++i) {
+      te::core::Free(blocks[i]);
+    }
+  }
+  state.SetItemsProcessed(state.Iterations() * kBlocks);
+}
+
+}  // namespace
+
+TE_BENCHMARK("Core/AllocFree", AllocFree, 16, 256, 4096, 65536);
+TE_BENCHMARK("Core/AllocFreeBatch", AllocFreeBatch, 64, 4096);
+
+}  // namespace te::bench
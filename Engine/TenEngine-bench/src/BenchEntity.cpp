@@ -0,0 +1,119 @@
+/**
+ * @file BenchEntity.cpp
+ * @brief TenEngine-bench: 005-Entity EntityManager component query benchmarks.
+ */
+
+#include "Benchmark.h"
+
+#include <te/entity/Component.h>
+#include <te/entity/Entity.h>
+#include <te/entity/EntityManager.h>
+#include <te/object/TypeRegistry.h>
+#include <te/scene/SceneManager.h>
+
+#include <typeinfo>
+#include <vector>
+
+namespace te::bench {
+namespace {
+
+struct BenchTransformComponent : public te::entity::Component {
+  float position[3]{};
+};
+
+struct BenchRenderComponent : public te::entity::Component {
+  uint32_t meshIndex{0};
+};
+
+constexpr te::object::TypeId kFirstComponentTypeId = 0xBE001000u;
+
+/// Entity::AddComponent instantiates through TypeRegistry::CreateInstance and resolves T by
+/// typeid name when no TE_REGISTER_COMPONENT_TYPE_NAME is given, so register both types that way
+template <typename T>
+void RegisterBenchComponent(te::object::TypeId id) {
+  te::object::TypeDescriptor desc;
+  desc.id = id;
+  desc.name = typeid(T).name();
+  desc.size = sizeof(T);
+  desc.createInstance = []() -> void* { return new T(); };
+  te::object::TypeRegistry::RegisterType(desc);
+}
+
+void RegisterBenchComponents() {
+  static bool s_registered = false;
+  if (s_registered) return;
+  s_registered = true;
+  RegisterBenchComponent<BenchTransformComponent>(kFirstComponentTypeId);
+  RegisterBenchComponent<BenchRenderComponent>(kFirstComponentTypeId + 1);
+}
+
+/// Arg() entities, all with BenchTransformComponent and every fourth with BenchRenderComponent
+class EntityScene {
+ public:
+  explicit EntityScene(uint32_t count) {
+    RegisterBenchComponents();
+    world_ = te::scene::SceneManager::GetInstance().CreateWorld(te::scene::SpatialIndexType::None,
+                                                                te::core::AABB{});
+    auto& manager = te::entity::EntityManager::GetInstance();
+    entities_.reserve(count);
+    for (uint32_t i = 0; i < count; ++i) {
+      te::entity::Entity* entity = manager.CreateEntity(world_);
+      if (!entity) continue;
+      entity->AddComponent<BenchTransformComponent>();
+      if (i % 4 == 0) {
+        if (BenchRenderComponent* render = entity->AddComponent<BenchRenderComponent>()) {
+          render->meshIndex = i;
+        }
+      }
+      entities_.push_back(entity);
+    }
+  }
+
+  ~EntityScene() {
+    auto& manager = te::entity::EntityManager::GetInstance();
+    for (te::entity::Entity* entity : entities_) {
+      // Entity::~Entity does not leave the scene world, so unregister before destroying
+      te::scene::SceneManager::GetInstance().UnregisterNode(entity);
+      manager.DestroyEntity(entity);
+    }
+    te::scene::SceneManager::GetInstance().DestroyWorld(world_);
+  }
+
+  EntityScene(EntityScene const&) = delete;
+  EntityScene& operator=(EntityScene const&) = delete;
+
+ private:
+  te::scene::WorldRef world_;
+  std::vector<te::entity::Entity*> entities_;
+};
+
+void QuerySingleComponent(State& state) {
+  uint32_t const count = static_cast<uint32_t>(state.Arg());
+  EntityScene scene(count);
+  auto& manager = te::entity::EntityManager::GetInstance();
+  std::vector<te::entity::Entity*> results;
+  while (state.KeepRunning()) {
+    manager.QueryEntitiesWithComponent<BenchRenderComponent>(results);
+    DoNotOptimize(results.data());
+  }
+  state.SetItemsProcessed(state.Iterations() * count);
+}
+
+void QueryTwoComponents(State& state) {
+  uint32_t const count = static_cast<uint32_t>(state.Arg());
+  EntityScene scene(count);
+  auto& manager = te::entity::EntityManager::GetInstance();
+  std::vector<te::entity::Entity*> results;
+  while (state.KeepRunning()) {
+    manager.QueryEntitiesWithComponents<BenchTransformComponent, BenchRenderComponent>(results);
+    DoNotOptimize(results.data());
+  }
+  state.SetItemsProcessed(state.Iterations() * count);
+}
+
+}  // namespace
+
+TE_BENCHMARK("Entity/QuerySingleComponent", QuerySingleComponent, 1000, 10000);
+TE_BENCHMARK("Entity/QueryTwoComponents", QueryTwoComponents, 1000, 10000);
+
+}  // namespace te::bench
@@ -0,0 +1,126 @@
+/**
+ * @file BenchFrame.cpp
+ * @brief TenEngine-bench: headless end-to-end frame on the Null RHI backend.
+ *
+ * One iteration is one frame over a synthetic N-node scene: animate transforms,
+ * SceneWorld::UpdateTransforms, build and frustum-cull render items, then run the
+ * PipelineContext phases in RenderPipeline::RenderFrame order (build logical pipeline,
+ * collect, prepare, convert, record, submit). Culled items are injected between the
+ * build and collect phases because RenderFrame collects from the level scene only.
+ */
+
+#include "Benchmark.h"
+#include "Fixtures.h"
+
+#include <te/pipeline/Culling.h>
+#include <te/pipeline/PipelineContext.h>
+#include <te/pipeline/RenderingConfig.h>
+#include <te/pipelinecore/FrameContext.h>
+#include <te/pipelinecore/FrameGraph.h>
+#include <te/pipelinecore/RenderItem.h>
+#include <te/rhi/device.hpp>
+#include <te/scene/SceneWorld.h>
+
+#include <cmath>
+
+namespace te::bench {
+namespace {
+
+constexpr float kWorldExtent = 1024.0f;
+constexpr uint32_t kElementCount = 64;
+
+void RunFrames(State& state, uint32_t recordWorkers) {
+  uint32_t const count = static_cast<uint32_t>(state.Arg());
+  te::rhi::IDevice* device = te::rhi::CreateDevice(te::rhi::Backend::Null);
+  if (!device) {
+    state.SkipWithMessage("Null RHI backend unavailable (TE_RHI_NULL=OFF)");
+    return;
+  }
+
+  {
+    auto nodes = MakeNodes(count, kWorldExtent, 1.0f);
+    te::core::AABB bounds;
+    bounds.min = {-kWorldExtent, -kWorldExtent, -kWorldExtent};
+    bounds.max = {kWorldExtent, kWorldExtent, kWorldExtent};
+    te::scene::SceneWorld world(te::scene::SpatialIndexType::None, bounds);
+    for (auto const& node : nodes) {
+      world.RegisterNode(node.get());
+    }
+
+    std::vector<std::unique_ptr<BenchElement>> elements;
+    for (uint32_t i = 0; i < kElementCount; ++i) {
+      elements.push_back(std::make_unique<BenchElement>(36));
+      elements.back()->CreateBuffers(device);
+    }
+
+    te::pipelinecore::IFrameGraph* graph = te::pipelinecore::CreateFrameGraph();
+    te::pipelinecore::IPassBuilder* pass = graph->AddPass("Opaque");
+    pass->SetCullMode(te::pipelinecore::CullMode::FrustumCull);
+    pass->SetRenderType(te::pipelinecore::RenderType::Opaque);
+
+    te::pipeline::RenderingConfig config{};
+    config.enableMultithreadedRendering = recordWorkers > 0;
+    config.workerThreadCount = recordWorkers;
+
+    te::pipeline::PipelineContext context;
+    context.SetDevice(device);
+    context.SetRenderingConfig(&config);
+    context.SetFrameGraph(graph);
+
+    te::pipelinecore::FrameContext frame{};
+    frame.viewport.width = 1280;
+    frame.viewport.height = 720;
+
+    te::pipelinecore::IRenderItemList* allItems = te::pipelinecore::CreateRenderItemList();
+    te::pipeline::Frustum const frustum = MakeBoxFrustum(kWorldExtent * 0.3f);
+    uint64_t frameIndex = 0;
+    uint64_t visibleTotal = 0;
+
+    while (state.KeepRunning()) {
+      // Game update: every node drifts along x
+      float const offset = 0.5f * std::sin(static_cast<float>(frameIndex) * 0.1f);
+      for (auto const& node : nodes) {
+        te::scene::Transform t = node->GetLocalTransform();
+        t.position.x += offset;
+        node->SetLocalTransform(t);
+      }
+      world.UpdateTransforms();
+
+      frame.frameSlotId = static_cast<te::pipelinecore::FrameSlotId>(frameIndex % 2);
+      context.BeginFrame(frame);
+      context.BuildLogicalPipeline();
+      FillRenderItems(nodes, elements, allItems);
+      visibleTotal += te::pipeline::FrustumCull(allItems, frustum, context.GetVisibleRenderItems(0));
+      context.CollectVisibleObjects();
+      context.PrepareResources();
+      context.BuildBatches();
+      context.ConvertToLogicalCommandBuffer();
+      context.ExecutePasses();
+      context.Submit();
+      context.Present();
+      context.EndFrame();
+      ++frameIndex;
+    }
+    DoNotOptimize(visibleTotal);
+    state.SetItemsProcessed(state.Iterations() * count);
+
+    te::pipelinecore::DestroyRenderItemList(allItems);
+    for (auto const& node : nodes) {
+      world.UnregisterNode(node.get());
+    }
+    context.SetFrameGraph(nullptr);
+    te::pipelinecore::DestroyFrameGraph(graph);
+    // elements and context release their device objects here, before the device
+  }
+  te::rhi::DestroyDevice(device);
+}
+
+void HeadlessFrame(State& state) { RunFrames(state, 0); }
+void HeadlessFrameParallelRecord(State& state) { RunFrames(state, 4); }
+
+}  // namespace
+
+TE_BENCHMARK("Frame/Headless", HeadlessFrame, 1000, 10000);
+TE_BENCHMARK("Frame/HeadlessParallelRecord", HeadlessFrameParallelRecord, 1000, 10000);
+
+}  // namespace te::bench
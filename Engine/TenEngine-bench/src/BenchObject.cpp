@@ -0,0 +1,218 @@
+/**
+ * @file BenchObject.cpp
+ * @brief TenEngine-bench: 002-Object TypeRegistry lookup and serializer throughput benchmarks.
+ */
+
+#include "Benchmark.h"
+
+#include <te/core/alloc.h>
+#include <te/object/PropertyBag.h>
+#include <te/object/Serializer.h>
+#include <te/object/TypeRegistry.h>
+
+#include <cstddef>
+#include <memory>
+#include <string>
+
+namespace te::bench {
+namespace {
+
+using te::object::PropertyDescriptor;
+using te::object::TypeDescriptor;
+using te::object::TypeId;
+
+constexpr TypeId kFirstLookupTypeId = 0xBE000000u;
+constexpr uint32_t kLookupTypeCount = 256;
+constexpr TypeId kRecordTypeId = 0xBE00FFFFu;
+
+/// Flat record with one property of every scalar width the serializers handle
+struct BenchRecord {
+  std::int32_t id;
+  std::uint32_t flags;
+  std::int64_t timestamp;
+  float x;
+  float y;
+  float z;
+  double weight;
+  std::int32_t parent;
+};
+
+}  // namespace
+}  // namespace te::bench
+
+TE_OBJECT_TYPE_NAME(te::bench::BenchRecord, "BenchRecord")
+
+namespace te::bench {
+namespace {
+
+std::vector<std::string>& LookupTypeNames() {
+  static std::vector<std::string> s_names;
+  return s_names;
+}
+
+/// Register the lookup types and BenchRecord once (the registry is process-wide)
+void RegisterBenchTypes() {
+  static bool s_registered = false;
+  if (s_registered) return;
+  s_registered = true;
+
+  auto& names = LookupTypeNames();
+  names.reserve(kLookupTypeCount);
+  for (uint32_t i = 0; i < kLookupTypeCount; ++i) {
+    names.push_back("BenchLookupType" + std::to_string(i));
+  }
+  for (uint32_t i = 0; i < kLookupTypeCount; ++i) {
+    TypeDescriptor desc;
+    desc.id = kFirstLookupTypeId + i;
+    desc.name = names[i].c_str();
+    desc.size = 16;
+    te::object::TypeRegistry::RegisterType(desc);
+  }
+
+  static PropertyDescriptor const s_props[] = {
+      {"id", 0, offsetof(BenchRecord, id), sizeof(std::int32_t), nullptr},
+      {"flags", 0, offsetof(BenchRecord, flags), sizeof(std::uint32_t), nullptr},
+      {"timestamp", 0, offsetof(BenchRecord, timestamp), sizeof(std::int64_t), nullptr},
+      {"x", 0, offsetof(BenchRecord, x), sizeof(float), nullptr},
+      {"y", 0, offsetof(BenchRecord, y), sizeof(float), nullptr},
+      {"z", 0, offsetof(BenchRecord, z), sizeof(float), nullptr},
+      {"weight", 0, offsetof(BenchRecord, weight), sizeof(double), nullptr},
+      {"parent", 0, offsetof(BenchRecord, parent), sizeof(std::int32_t), nullptr},
+  };
+  TypeDescriptor record;
+  record.id = kRecordTypeId;
+  record.name = "BenchRecord";
+  record.size = sizeof(BenchRecord);
+  record.properties = s_props;
+  record.propertyCount = sizeof(s_props) / sizeof(s_props[0]);
+  te::object::TypeRegistry::RegisterType(record);
+}
+
+void TypeLookupById(State& state) {
+  RegisterBenchTypes();
+  uint32_t i = 0;
+  while (state.KeepRunning()) {
+    DoNotOptimize(te::object::TypeRegistry::GetTypeById(kFirstLookupTypeId + (i++ % kLookupTypeCount)));
+  }
+  state.SetItemsProcessed(state.Iterations());
+}
+
+void TypeLookupByName(State& state) {
+  RegisterBenchTypes();
+  auto const& names = LookupTypeNames();
+  uint32_t i = 0;
+  while (state.KeepRunning()) {
+    DoNotOptimize(te::object::TypeRegistry::GetTypeByName(names[i++ % kLookupTypeCount].c_str()));
+  }
+  state.SetItemsProcessed(state.Iterations());
+}
+
+std::unique_ptr<te::object::ISerializer> MakeSerializer(te::object::SerializationFormat format) {
+  switch (format) {
+    case te::object::SerializationFormat::Binary:
+      return std::unique_ptr<te::object::ISerializer>(te::object::CreateBinarySerializer());
+    case te::object::SerializationFormat::JSON:
+      return std::unique_ptr<te::object::ISerializer>(te::object::CreateJSONSerializer());
+    case te::object::SerializationFormat::XML:
+      return std::unique_ptr<te::object::ISerializer>(te::object::CreateXMLSerializer());
+  }
+  return nullptr;
+}
+
+/// Serialize + deserialize one BenchRecord per iteration; bytes = serialized size
+void SerializeRoundTrip(State& state, std::unique_ptr<te::object::ISerializer> serializer) {
+  RegisterBenchTypes();
+  if (!serializer) {
+    state.SkipWithMessage("serializer unavailable");
+    return;
+  }
+  BenchRecord const original{42, 0xF00Du, 1234567890123ll, 1.5f, -2.25f, 3.0f, 0.125, -1};
+  BenchRecord decoded{};
+  te::object::SerializedBuffer buffer{};
+  uint64_t bytes = 0;
+  while (state.KeepRunning()) {
+    serializer->Serialize(buffer, &original, kRecordTypeId);
+    serializer->Deserialize(buffer, &decoded, kRecordTypeId);
+    bytes += buffer.size;
+    DoNotOptimize(decoded);
+  }
+  if (buffer.data) te::core::Free(buffer.data);
+  state.SetItemsProcessed(state.Iterations());
+  state.SetBytesProcessed(bytes);
+}
+
+void SerializeBinary(State& state) { SerializeRoundTrip(state, MakeSerializer(te::object::SerializationFormat::Binary)); }
+void SerializeBinarySchema(State& state) {
+  SerializeRoundTrip(state, std::unique_ptr<te::object::ISerializer>(
+                                te::object::CreateBinarySerializer(te::object::BinaryLayout::Schema)));
+}
+/// Cached descriptor of a named type: one atomic load after the first call
+void TypeOfCached(State& state) {
+  RegisterBenchTypes();
+  while (state.KeepRunning()) {
+    DoNotOptimize(te::object::TypeOf<BenchRecord>());
+  }
+  state.SetItemsProcessed(state.Iterations());
+}
+
+/// Name-based access: hashes the property name on every call
+void PropertyGetByName(State& state) {
+  RegisterBenchTypes();
+  BenchRecord record{};
+  te::object::PropertyBag bag(&record, te::object::TypeRegistry::GetTypeById(kRecordTypeId));
+  double weight = 0.0;
+  while (state.KeepRunning()) {
+    bag.GetProperty(&weight, "weight");
+    DoNotOptimize(weight);
+  }
+  state.SetItemsProcessed(state.Iterations());
+}
+
+/// Handle resolved once, typed access afterwards
+void PropertyGetHandle(State& state) {
+  RegisterBenchTypes();
+  BenchRecord record{};
+  te::object::PropertyBag bag(&record, te::object::TypeRegistry::GetTypeById(kRecordTypeId));
+  te::object::PropertyHandle const handle = bag.GetHandle("weight");
+  double weight = 0.0;
+  while (state.KeepRunning()) {
+    bag.Get(handle, weight);
+    DoNotOptimize(weight);
+  }
+  state.SetItemsProcessed(state.Iterations());
+}
+
+/// Multi-selection edit: one property written on Arg() instances of one type
+void PropertySetBatch(State& state) {
+  RegisterBenchTypes();
+  std::vector<BenchRecord> records(static_cast<std::size_t>(state.Arg()));
+  std::vector<void*> instances;
+  for (BenchRecord& record : records) instances.push_back(&record);
+  te::object::PropertyHandle const handle =
+      te::object::PropertyBag::ResolveProperty(te::object::TypeRegistry::GetTypeById(kRecordTypeId), "x");
+  float x = 0.0f;
+  while (state.KeepRunning()) {
+    x += 1.0f;
+    te::object::PropertyBag::SetPropertyBatch(handle, instances.data(), instances.size(), &x);
+    DoNotOptimize(records.data());
+  }
+  state.SetItemsProcessed(state.Iterations() * records.size());
+}
+
+void SerializeJSON(State& state) { SerializeRoundTrip(state, MakeSerializer(te::object::SerializationFormat::JSON)); }
+void SerializeXML(State& state) { SerializeRoundTrip(state, MakeSerializer(te::object::SerializationFormat::XML)); }
+
+}  // namespace
+
+TE_BENCHMARK("Object/TypeLookupById", TypeLookupById);
+TE_BENCHMARK("Object/TypeLookupByName", TypeLookupByName);
+TE_BENCHMARK("Object/TypeOf", TypeOfCached);
+TE_BENCHMARK("Object/PropertyGetByName", PropertyGetByName);
+TE_BENCHMARK("Object/PropertyGetHandle", PropertyGetHandle);
+TE_BENCHMARK("Object/PropertySetBatch", PropertySetBatch, 5000);
+TE_BENCHMARK("Object/SerializeBinary", SerializeBinary);
+TE_BENCHMARK("Object/SerializeBinarySchema", SerializeBinarySchema);
+TE_BENCHMARK("Object/SerializeJSON", SerializeJSON);
+TE_BENCHMARK("Object/SerializeXML", SerializeXML);
+
+}  // namespace te::bench
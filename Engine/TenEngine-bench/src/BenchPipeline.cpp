@@ -0,0 +1,86 @@
+/**
+ * @file BenchPipeline.cpp
+ * @brief TenEngine-bench: 020 FrustumCull and 019 ConvertToLogicalCommandBuffer / depth sort benchmarks.
+ */
+
+#include "Benchmark.h"
+#include "Fixtures.h"
+
+#include <te/pipeline/Culling.h>
+#include <te/pipelinecore/CollectPass.h>
+#include <te/pipelinecore/LogicalCommandBuffer.h>
+#include <te/pipelinecore/RenderItem.h>
+
+namespace te::bench {
+namespace {
+
+constexpr float kWorldExtent = 1024.0f;
+constexpr uint32_t kElementCount = 64;
+
+/// Owns a generated item list for Arg() nodes spread over kElementCount elements
+struct ItemScene {
+  explicit ItemScene(uint32_t count) {
+    nodes = MakeNodes(count, kWorldExtent, 1.0f);
+    for (uint32_t i = 0; i < kElementCount; ++i) {
+      elements.push_back(std::make_unique<BenchElement>(36));
+    }
+    items = te::pipelinecore::CreateRenderItemList();
+    FillRenderItems(nodes, elements, items);
+  }
+  ~ItemScene() { te::pipelinecore::DestroyRenderItemList(items); }
+  ItemScene(ItemScene const&) = delete;
+  ItemScene& operator=(ItemScene const&) = delete;
+
+  std::vector<std::unique_ptr<BenchNode>> nodes;
+  std::vector<std::unique_ptr<BenchElement>> elements;
+  te::pipelinecore::IRenderItemList* items{nullptr};
+};
+
+/// Cull Arg() items against a box covering about a quarter of the world
+void FrustumCull(State& state) {
+  uint32_t const count = static_cast<uint32_t>(state.Arg());
+  ItemScene scene(count);
+  te::pipeline::Frustum const frustum = MakeBoxFrustum(kWorldExtent * 0.3f);
+  te::pipelinecore::IRenderItemList* visible = te::pipelinecore::CreateRenderItemList();
+  while (state.KeepRunning()) {
+    DoNotOptimize(te::pipeline::FrustumCull(scene.items, frustum, visible));
+  }
+  te::pipelinecore::DestroyRenderItemList(visible);
+  state.SetItemsProcessed(state.Iterations() * count);
+}
+
+/// Convert Arg() items (kElementCount distinct elements) into merged logical draws
+void ConvertToLogicalCommandBuffer(State& state) {
+  uint32_t const count = static_cast<uint32_t>(state.Arg());
+  ItemScene scene(count);
+  while (state.KeepRunning()) {
+    te::pipelinecore::ILogicalCommandBuffer* cb = nullptr;
+    te::pipelinecore::ConvertToLogicalCommandBuffer(scene.items, nullptr, &cb);
+    DoNotOptimize(cb);
+    te::pipelinecore::DestroyLogicalCommandBuffer(cb);
+  }
+  state.SetItemsProcessed(state.Iterations() * count);
+}
+
+/// Depth-sort Arg() items, alternating orders so every iteration reorders the list
+void SortRenderItemsByDistance(State& state) {
+  uint32_t const count = static_cast<uint32_t>(state.Arg());
+  ItemScene scene(count);
+  float const camera[3] = {kWorldExtent * 0.25f, 0.0f, -kWorldExtent * 0.25f};
+  bool backToFront = false;
+  while (state.KeepRunning()) {
+    te::pipelinecore::SortRenderItemsByDistance(
+        scene.items, camera,
+        backToFront ? te::pipelinecore::DepthSortOrder::BackToFront : te::pipelinecore::DepthSortOrder::FrontToBack);
+    backToFront = !backToFront;
+  }
+  state.SetItemsProcessed(state.Iterations() * count);
+}
+
+}  // namespace
+
+TE_BENCHMARK("Pipeline/FrustumCull", FrustumCull, 1000, 10000, 100000);
+TE_BENCHMARK("Pipeline/ConvertToLogicalCommandBuffer", ConvertToLogicalCommandBuffer, 1000, 10000, 100000);
+TE_BENCHMARK("Pipeline/SortRenderItemsByDistance", SortRenderItemsByDistance, 1000, 10000, 50000);
+
+}  // namespace te::bench
@@ -0,0 +1,151 @@
+/**
+ * @file BenchResource.cpp
+ * @brief TenEngine-bench: 013-Resource ResourceManager::LoadSync benchmarks on generated assets.
+ */
+
+#include "Benchmark.h"
+
+#include <te/core/alloc.h>
+#include <te/object/Guid.h>
+#include <te/resource/Resource.h>
+#include <te/resource/ResourceManager.h>
+
+#include <cstdio>
+#include <filesystem>
+#include <memory>
+#include <string>
+#include <vector>
+
+namespace te::bench {
+namespace {
+
+constexpr uint32_t kAssetCount = 64;
+
+/// Resource that reads its whole file through IResource::LoadDataFile. ResourceManager::Unload
+/// calls Release once per reference, so like MeshResource it does not delete itself; instances
+/// are owned by BlobPool and freed once the benchmark has unloaded them.
+class BenchBlobResource : public te::resource::IResource {
+ public:
+  BenchBlobResource() : id_(te::object::GUID::Generate()) {}
+
+  te::resource::ResourceType GetResourceType() const override { return te::resource::ResourceType::Custom; }
+  te::resource::ResourceId GetResourceId() const override { return id_; }
+  void Release() override {}
+
+  bool Load(char const* path, te::resource::IResourceManager*) override {
+    void* data = nullptr;
+    std::size_t size = 0;
+    if (!LoadDataFile(path, &data, &size)) return false;
+    size_ = size;
+    te::core::Free(data);
+    return true;
+  }
+
+ protected:
+  bool OnConvertSourceFile(char const*, void**, std::size_t*) override { return false; }
+  void* OnCreateAssetDesc() override { return nullptr; }
+
+ private:
+  te::resource::ResourceId id_;
+  std::size_t size_{0};
+};
+
+std::vector<std::unique_ptr<BenchBlobResource>>& BlobPool() {
+  static std::vector<std::unique_ptr<BenchBlobResource>> s_pool;
+  return s_pool;
+}
+
+te::resource::IResource* CreateBenchBlob(te::resource::ResourceType) {
+  BlobPool().push_back(std::make_unique<BenchBlobResource>());
+  return BlobPool().back().get();
+}
+
+/// kAssetCount files of Arg() bytes under the temp directory; removed on destruction
+class GeneratedAssets {
+ public:
+  explicit GeneratedAssets(std::size_t size) {
+    std::error_code ec;
+    dir_ = std::filesystem::temp_directory_path(ec) / "tenengine_bench_assets";
+    std::filesystem::create_directories(dir_, ec);
+    std::vector<unsigned char> bytes(size);
+    for (std::size_t i = 0; i < size; ++i) bytes[i] = static_cast<unsigned char>(i * 31u);
+    for (uint32_t i = 0; i < kAssetCount; ++i) {
+      std::string path = (dir_ / ("blob_" + std::to_string(size) + "_" + std::to_string(i) + ".bin")).string();
+      if (FILE* f = std::fopen(path.c_str(), "wb")) {
+        bool const ok = std::fwrite(bytes.data(), 1, bytes.size(), f) == bytes.size();
+        if (std::fclose(f) == 0 && ok) paths_.push_back(std::move(path));
+      }
+    }
+  }
+
+  ~GeneratedAssets() {
+    std::error_code ec;
+    for (auto const& path : paths_) std::filesystem::remove(path, ec);
+  }
+
+  GeneratedAssets(GeneratedAssets const&) = delete;
+  GeneratedAssets& operator=(GeneratedAssets const&) = delete;
+
+  bool IsValid() const { return paths_.size() == kAssetCount; }
+  char const* Path(uint32_t i) const { return paths_[i % kAssetCount].c_str(); }
+
+ private:
+  std::filesystem::path dir_;
+  std::vector<std::string> paths_;
+};
+
+te::resource::IResourceManager* PrepareManager(State& state) {
+  te::resource::IResourceManager* manager = te::resource::GetResourceManager();
+  if (!manager) {
+    state.SkipWithMessage("resource manager unavailable");
+    return nullptr;
+  }
+  manager->RegisterResourceFactory(te::resource::ResourceType::Custom, CreateBenchBlob);
+  return manager;
+}
+
+/// Cold load: every iteration reads the file and creates the resource, then unloads it
+void LoadSyncCold(State& state) {
+  te::resource::IResourceManager* manager = PrepareManager(state);
+  GeneratedAssets assets(static_cast<std::size_t>(state.Arg()));
+  if (manager && !assets.IsValid()) state.SkipWithMessage("cannot write generated assets");
+  uint32_t i = 0;
+  while (state.KeepRunning()) {
+    te::resource::IResource* resource = manager->LoadSync(assets.Path(i++), te::resource::ResourceType::Custom);
+    if (resource) manager->Unload(resource);
+  }
+  BlobPool().clear();
+  state.SetItemsProcessed(state.Iterations());
+  state.SetBytesProcessed(state.Iterations() * static_cast<uint64_t>(state.Arg()));
+}
+
+/// Cache hit: all assets stay loaded; measures path lookup, cache access and the matching Unload
+void LoadSyncCached(State& state) {
+  te::resource::IResourceManager* manager = PrepareManager(state);
+  GeneratedAssets assets(static_cast<std::size_t>(state.Arg()));
+  if (manager && !assets.IsValid()) state.SkipWithMessage("cannot write generated assets");
+  std::vector<te::resource::IResource*> loaded;
+  if (!state.IsSkipped()) {
+    for (uint32_t i = 0; i < kAssetCount; ++i) {
+      loaded.push_back(manager->LoadSync(assets.Path(i), te::resource::ResourceType::Custom));
+    }
+  }
+  uint32_t i = 0;
+  while (state.KeepRunning()) {
+    te::resource::IResource* resource = manager->LoadSync(assets.Path(i++), te::resource::ResourceType::Custom);
+    DoNotOptimize(resource);
+    manager->Unload(resource);
+  }
+  for (te::resource::IResource* resource : loaded) {
+    if (resource) manager->Unload(resource);
+  }
+  BlobPool().clear();
+  state.SetItemsProcessed(state.Iterations());
+}
+
+}  // namespace
+
+TE_BENCHMARK("Resource/LoadSyncCold", LoadSyncCold, 4096, 1 << 20);
+TE_BENCHMARK("Resource/LoadSyncCached", LoadSyncCached, 4096);
+
+}  // namespace te::bench
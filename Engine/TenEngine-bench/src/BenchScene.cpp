@@ -0,0 +1,91 @@
+/**
+ * @file BenchScene.cpp
+ * @brief TenEngine-bench: 004-Scene Octree and SceneWorld::UpdateTransforms benchmarks.
+ */
+
+#include "Benchmark.h"
+#include "Fixtures.h"
+
+#include <te/scene/Octree.h>
+#include <te/scene/SceneWorld.h>
+
+namespace te::bench {
+namespace {
+
+constexpr float kWorldExtent = 1024.0f;
+
+te::core::AABB WorldBounds() {
+  te::core::AABB bounds;
+  bounds.min = {-kWorldExtent * 0.5f, -kWorldExtent * 0.5f, -kWorldExtent * 0.5f};
+  bounds.max = {kWorldExtent * 0.5f, kWorldExtent * 0.5f, kWorldExtent * 0.5f};
+  return bounds;
+}
+
+/// Build an octree of Arg() nodes per iteration
+void OctreeInsert(State& state) {
+  uint32_t const count = static_cast<uint32_t>(state.Arg());
+  auto nodes = MakeNodes(count, kWorldExtent, 1.0f);
+  while (state.KeepRunning()) {
+    te::scene::Octree octree(WorldBounds());
+    for (auto const& node : nodes) {
+      octree.Insert(node.get());
+    }
+    DoNotOptimize(octree.GetNodeCount());
+    state.PauseTiming();
+    octree.Clear();
+    state.ResumeTiming();
+  }
+  state.SetItemsProcessed(state.Iterations() * count);
+}
+
+/// AABB query covering one eighth of the world against Arg() nodes
+void OctreeQueryAABB(State& state) {
+  uint32_t const count = static_cast<uint32_t>(state.Arg());
+  auto nodes = MakeNodes(count, kWorldExtent, 1.0f);
+  te::scene::Octree octree(WorldBounds());
+  for (auto const& node : nodes) {
+    octree.Insert(node.get());
+  }
+  te::core::AABB query;
+  query.min = {0.0f, 0.0f, 0.0f};
+  query.max = {kWorldExtent * 0.5f, kWorldExtent * 0.5f, kWorldExtent * 0.5f};
+  uint64_t found = 0;
+  while (state.KeepRunning()) {
+    octree.QueryAABB(query, [&found](te::scene::ISceneNode*) { ++found; });
+  }
+  DoNotOptimize(found);
+  state.SetItemsProcessed(found);
+}
+
+/// Arg() dirty nodes (one root per eight nodes, the rest its children) per UpdateTransforms
+void UpdateTransforms(State& state) {
+  uint32_t const count = static_cast<uint32_t>(state.Arg());
+  auto nodes = MakeNodes(count, kWorldExtent, 1.0f);
+  te::scene::SceneWorld world(te::scene::SpatialIndexType::None, WorldBounds());
+  for (uint32_t i = 0; i < count; ++i) {
+    if (i % 8 != 0) {
+      nodes[i]->SetParent(nodes[i - i % 8].get());
+    }
+    world.RegisterNode(nodes[i].get());
+  }
+  while (state.KeepRunning()) {
+    state.PauseTiming();
+    for (auto const& node : nodes) {
+      node->SetDirty(true);
+    }
+    state.ResumeTiming();
+    world.UpdateTransforms();
+  }
+  for (auto const& node : nodes) {
+    world.UnregisterNode(node.get());
+  }
+  state.SetItemsProcessed(state.Iterations() * count);
+}
+
+}  // namespace
+
+TE_BENCHMARK("Scene/OctreeInsert", OctreeInsert, 1000, 10000);
+TE_BENCHMARK("Scene/OctreeQueryAABB", OctreeQueryAABB, 1000, 10000);
+TE_BENCHMARK("Scene/UpdateTransforms", UpdateTransforms, 1000, 10000);
+
+}  // namespace te::bench
@@ -0,0 +1,237 @@
+/**
+ * @file Benchmark.cpp
+ * @brief TenEngine-bench: benchmark registry, runner and JSON report.
+ */
+
+#include "Benchmark.h"
+
+#include <algorithm>
+#include <cmath>
+#include <cstdio>
+#include <ctime>
+#include <thread>
+
+namespace te::bench {
+
+namespace {
+
+constexpr uint64_t kMaxIterations = 1000000000ull;
+
+std::vector<BenchmarkDesc>& Registry() {
+  static std::vector<BenchmarkDesc> s_benchmarks;
+  return s_benchmarks;
+}
+
+std::string MakeName(BenchmarkDesc const& desc, int64_t arg) {
+  if (desc.args.empty()) return desc.name;
+  return desc.name + "/" + std::to_string(arg);
+}
+
+State RunOnce(BenchmarkFn fn, int64_t arg, uint64_t iterations) {
+  State state(arg, iterations);
+  fn(state);
+  return state;
+}
+
+BenchmarkResult Measure(BenchmarkDesc const& desc, int64_t arg, RunOptions const& options) {
+  BenchmarkResult result;
+  result.name = MakeName(desc, arg);
+  result.arg = arg;
+
+  // Grow the iteration count until one run reaches the minimum time
+  double const minNs = std::max(0.0, options.minTimeSec) * 1e9;
+  uint64_t iterations = 1;
+  for (;;) {
+    State state = RunOnce(desc.fn, arg, iterations);
+    if (state.IsSkipped()) {
+      result.skipped = true;
+      result.message = state.GetMessage();
+      return result;
+    }
+    double const elapsed = state.GetElapsedNs();
+    if (elapsed >= minNs || iterations >= kMaxIterations) break;
+    double const scale = elapsed > 0.0 ? (minNs * 1.4) / elapsed : 10.0;
+    uint64_t const next = static_cast<uint64_t>(static_cast<double>(iterations) * std::min(scale, 10.0));
+    iterations = std::min(kMaxIterations, std::max(iterations + 1, next));
+  }
+
+  uint32_t const repetitions = std::max(1u, options.repetitions);
+  std::vector<double> perIteration;
+  perIteration.reserve(repetitions);
+  double items = 0.0;
+  double bytes = 0.0;
+  double totalNs = 0.0;
+  for (uint32_t r = 0; r < repetitions; ++r) {
+    State state = RunOnce(desc.fn, arg, iterations);
+    perIteration.push_back(state.GetElapsedNs() / static_cast<double>(iterations));
+    items += static_cast<double>(state.GetItemsProcessed());
+    bytes += static_cast<double>(state.GetBytesProcessed());
+    totalNs += state.GetElapsedNs();
+  }
+
+  std::sort(perIteration.begin(), perIteration.end());
+  double sum = 0.0;
+  for (double v : perIteration) sum += v;
+  double const mean = sum / static_cast<double>(perIteration.size());
+  double variance = 0.0;
+  for (double v : perIteration) variance += (v - mean) * (v - mean);
+  if (perIteration.size() > 1) variance /= static_cast<double>(perIteration.size() - 1);
+  size_t const mid = perIteration.size() / 2;
+
+  result.iterations = iterations;
+  result.repetitions = repetitions;
+  result.meanNs = mean;
+  result.medianNs = (perIteration.size() % 2) ? perIteration[mid] : 0.5 * (perIteration[mid - 1] + perIteration[mid]);
+  result.minNs = perIteration.front();
+  result.stddevNs = std::sqrt(variance);
+  if (totalNs > 0.0) {
+    result.itemsPerSecond = items * 1e9 / totalNs;
+    result.bytesPerSecond = bytes * 1e9 / totalNs;
+  }
+  return result;
+}
+
+void AppendJsonString(std::string& out, std::string const& s) {
+  out += '"';
+  for (char c : s) {
+    if (c == '"' || c == '\\') {
+      out += '\\';
+      out += c;
+    } else if (static_cast<unsigned char>(c) < 0x20) {
+      char buf[8];
+      std::snprintf(buf, sizeof(buf), "\\u%04x", static_cast<unsigned>(c));
+      out += buf;
+    } else {
+      out += c;
+    }
+  }
+  out += '"';
+}
+
+void AppendJsonNumber(std::string& out, double v) {
+  char buf[32];
+  std::snprintf(buf, sizeof(buf), "%.6g", std::isfinite(v) ? v : 0.0);
+  out += buf;
+}
+
+std::string CurrentUtcTime() {
+  std::time_t const now = std::time(nullptr);
+  std::tm tm{};
+#if defined(_WIN32)
+  gmtime_s(&tm, &now);
+#else
+  gmtime_r(&now, &tm);
+#endif
+  char buf[32];
+  std::strftime(buf, sizeof(buf), "%Y-%m-%dT%H:%M:%SZ", &tm);
+  return buf;
+}
+
+char const* CompilerName() {
+#if defined(__clang__)
+  return "clang " __clang_version__;
+#elif defined(__GNUC__)
+  return "gcc " __VERSION__;
+#elif defined(_MSC_VER)
+  return "msvc";
+#else
+  return "unknown";
+#endif
+}
+
+}  // namespace
+
+int RegisterBenchmark(char const* name, BenchmarkFn fn, std::initializer_list<int64_t> args) {
+  BenchmarkDesc desc;
+  desc.name = name ? name : "";
+  desc.fn = fn;
+  desc.args.assign(args.begin(), args.end());
+  Registry().push_back(std::move(desc));
+  return static_cast<int>(Registry().size());
+}
+
+std::vector<BenchmarkDesc> const& GetBenchmarks() {
+  auto& benchmarks = Registry();
+  std::stable_sort(benchmarks.begin(), benchmarks.end(),
+                   [](BenchmarkDesc const& a, BenchmarkDesc const& b) { return a.name < b.name; });
+  return benchmarks;
+}
+
+void RunBenchmarks(RunOptions const& options, std::vector<BenchmarkResult>& out) {
+  out.clear();
+  std::printf("%-48s %14s %14s %12s %14s\n", "Benchmark", "Median (ns)", "Stddev (ns)", "Iterations", "Items/s");
+  for (auto const& desc : GetBenchmarks()) {
+    std::vector<int64_t> args = desc.args;
+    if (args.empty()) args.push_back(0);
+    for (int64_t arg : args) {
+      if (!options.filter.empty() && MakeName(desc, arg).find(options.filter) == std::string::npos) {
+        continue;
+      }
+      BenchmarkResult result = Measure(desc, arg, options);
+      if (result.skipped) {
+        std::printf("%-48s skipped: %s\n", result.name.c_str(), result.message.c_str());
+      } else {
+        std::printf("%-48s %14.1f %14.1f %12llu %14.4g\n", result.name.c_str(), result.medianNs, result.stddevNs,
+                    static_cast<unsigned long long>(result.iterations), result.itemsPerSecond);
+      }
+      std::fflush(stdout);
+      out.push_back(std::move(result));
+    }
+  }
+}
+
+std::string ResultsToJson(RunOptions const& options, std::vector<BenchmarkResult> const& results) {
+  std::string out;
+  out += "{\n  \"context\": {\"engine\": \"TenEngine\", \"tag\": ";
+  AppendJsonString(out, options.tag);
+  out += ", \"date\": ";
+  AppendJsonString(out, CurrentUtcTime());
+  out += ", \"compiler\": ";
+  AppendJsonString(out, CompilerName());
+#if defined(NDEBUG)
+  out += ", \"build_type\": \"release\"";
+#else
+  out += ", \"build_type\": \"debug\"";
+#endif
+  out += ", \"cpu_count\": " + std::to_string(std::thread::hardware_concurrency());
+  out += ", \"min_time_s\": ";
+  AppendJsonNumber(out, options.minTimeSec);
+  out += ", \"repetitions\": " + std::to_string(options.repetitions);
+  out += "},\n  \"benchmarks\": [";
+  for (size_t i = 0; i < results.size(); ++i) {
+    BenchmarkResult const& r = results[i];
+    out += i ? ",\n    {" : "\n    {";
+    out += "\"name\": ";
+    AppendJsonString(out, r.name);
+    if (r.skipped) {
+      out += ", \"skipped\": true, \"message\": ";
+      AppendJsonString(out, r.message);
+      out += "}";
+      continue;
+    }
+    out += ", \"arg\": " + std::to_string(r.arg);
+    out += ", \"iterations\": " + std::to_string(r.iterations);
+    out += ", \"repetitions\": " + std::to_string(r.repetitions);
+    out += ", \"mean_ns\": ";
+    AppendJsonNumber(out, r.meanNs);
+    out += ", \"median_ns\": ";
+    AppendJsonNumber(out, r.medianNs);
+    out += ", \"min_ns\": ";
+    AppendJsonNumber(out, r.minNs);
+    out += ", \"stddev_ns\": ";
+    AppendJsonNumber(out, r.stddevNs);
+    out += ", \"items_per_second\": ";
+    AppendJsonNumber(out, r.itemsPerSecond);
+    out += ", \"bytes_per_second\": ";
+    AppendJsonNumber(out, r.bytesPerSecond);
+    out += "}";
+  }
+  out += results.empty() ? "]\n}\n" : "\n  ]\n}\n";
+  return out;
+}
+
+namespace detail {
+void UseCharPointer(char const volatile*) {}
+}  // namespace detail
+
+}  // namespace te::bench
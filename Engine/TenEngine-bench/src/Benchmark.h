@@ -0,0 +1,156 @@
+/**
+ * @file Benchmark.h
+ * @brief TenEngine-bench: in-tree benchmark harness (registration, timing loop, JSON report).
+ *
+ * A benchmark body loops `while (state.KeepRunning())`. The harness grows the iteration
+ * count until one run lasts at least the minimum time, then repeats that run and reports
+ * per-iteration statistics. Setup before the loop and teardown after it are not timed.
+ */
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <chrono>
+#include <initializer_list>
+#include <string>
+#include <vector>
+
+namespace te::bench {
+
+/// Per-run state handed to a benchmark body
+class State {
+ public:
+  State(int64_t arg, uint64_t iterations) : arg_(arg), iterations_(iterations), remaining_(iterations) {}
+
+  /// True while iterations remain; starts the timer on the first call and stops it on the last
+  bool KeepRunning() {
+    if (remaining_ > 0 && !skipped_) {
+      if (remaining_-- == iterations_) {
+        start_ = Clock::now();
+      }
+      return true;
+    }
+    StopTimer();
+    return false;
+  }
+
+  /// Benchmark argument (0 when registered without arguments)
+  int64_t Arg() const { return arg_; }
+
+  /// Iterations of this run
+  uint64_t Iterations() const { return iterations_; }
+
+  /// Exclude per-iteration setup from the measured time
+  void PauseTiming() { pauseStart_ = Clock::now(); }
+  void ResumeTiming() { paused_ += Clock::now() - pauseStart_; }
+
+  /// Total items / bytes handled by the run (reported as per-second rates)
+  void SetItemsProcessed(uint64_t items) { items_ = items; }
+  void SetBytesProcessed(uint64_t bytes) { bytes_ = bytes; }
+
+  /// Skip the benchmark (e.g. missing backend); call before the loop
+  void SkipWithMessage(char const* message) {
+    skipped_ = true;
+    message_ = message ? message : "";
+  }
+
+  bool IsSkipped() const { return skipped_; }
+  std::string const& GetMessage() const { return message_; }
+  double GetElapsedNs() const { return elapsedNs_; }
+  uint64_t GetItemsProcessed() const { return items_; }
+  uint64_t GetBytesProcessed() const { return bytes_; }
+
+ private:
+  using Clock = std::chrono::steady_clock;
+
+  void StopTimer() {
+    if (stopped_ || skipped_) return;
+    stopped_ = true;
+    if (iterations_ == 0) return;
+    auto const elapsed = Clock::now() - start_ - paused_;
+    elapsedNs_ = static_cast<double>(std::chrono::duration_cast<std::chrono::nanoseconds>(elapsed).count());
+  }
+
+  int64_t arg_;
+  uint64_t iterations_;
+  uint64_t remaining_;
+  Clock::time_point start_{};
+  Clock::time_point pauseStart_{};
+  Clock::duration paused_{};
+  double elapsedNs_{0.0};
+  uint64_t items_{0};
+  uint64_t bytes_{0};
+  bool stopped_{false};
+  bool skipped_{false};
+  std::string message_;
+};
+
+using BenchmarkFn = void (*)(State&);
+
+/// A registered benchmark; run once per argument (or once with 0 when there are none)
+struct BenchmarkDesc {
+  std::string name;  ///< "Group/Name"
+  BenchmarkFn fn{nullptr};
+  std::vector<int64_t> args;
+};
+
+/// Register a benchmark; used by TE_BENCHMARK at static-initialization time
+int RegisterBenchmark(char const* name, BenchmarkFn fn, std::initializer_list<int64_t> args);
+
+/// All registered benchmarks, sorted by name
+std::vector<BenchmarkDesc> const& GetBenchmarks();
+
+/// Runner options
+struct RunOptions {
+  double minTimeSec{0.2};      ///< Minimum duration of one measured run
+  uint32_t repetitions{5};     ///< Measured runs per benchmark
+  std::string filter;          ///< Substring of "Group/Name/arg"; empty runs everything
+  std::string tag;             ///< Free-form label (version, commit) stored in the report
+};
+
+/// Result of one benchmark / argument pair
+struct BenchmarkResult {
+  std::string name;            ///< "Group/Name" or "Group/Name/arg"
+  int64_t arg{0};
+  uint64_t iterations{0};      ///< Iterations per measured run
+  uint32_t repetitions{0};
+  double meanNs{0.0};          ///< Per-iteration time statistics over repetitions
+  double medianNs{0.0};
+  double minNs{0.0};
+  double stddevNs{0.0};
+  double itemsPerSecond{0.0};  ///< 0 when the benchmark reports no items
+  double bytesPerSecond{0.0};
+  bool skipped{false};
+  std::string message;
+};
+
+/// Run the benchmarks matching options.filter; progress goes to stdout
+void RunBenchmarks(RunOptions const& options, std::vector<BenchmarkResult>& out);
+
+/// Report as JSON: {"context": {...}, "benchmarks": [...]}
+std::string ResultsToJson(RunOptions const& options, std::vector<BenchmarkResult> const& results);
+
+namespace detail {
+void UseCharPointer(char const volatile* p);
+}  // namespace detail
+
+/// Keep \a value (and the work producing it) from being optimized away
+template <typename T>
+inline void DoNotOptimize(T const& value) {
+#if defined(__GNUC__) || defined(__clang__)
+  asm volatile("" : : "r,m"(value) : "memory");
+#else
+  detail::UseCharPointer(&reinterpret_cast<char const volatile&>(value));
+#endif
+}
+
+}  // namespace te::bench
+
+#define TE_BENCH_CONCAT_IMPL(a, b) a##b
+#define TE_BENCH_CONCAT(a, b) TE_BENCH_CONCAT_IMPL(a, b)
+
+/// Register \a fn as benchmark \a name ("Group/Name"), optionally once per argument
+#define TE_BENCHMARK(name, fn, ...)                                                   \
+  static int const TE_BENCH_CONCAT(te_bench_registered_, __LINE__) =                 \
+      ::te::bench::RegisterBenchmark(name, fn, {__VA_ARGS__})
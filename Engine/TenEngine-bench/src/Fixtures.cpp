@@ -0,0 +1,134 @@
+/**
+ * @file Fixtures.cpp
+ * @brief TenEngine-bench: synthetic scene nodes, render elements and frustums.
+ */
+
+#include "Fixtures.h"
+
+#include <te/rhi/device.hpp>
+#include <te/rhi/resources.hpp>
+
+#include <algorithm>
+#include <cstring>
+
+namespace te::bench {
+
+BenchNode::BenchNode(uint32_t index, te::core::Vector3 const& position, float halfExtent)
+    : index_(index), halfExtent_(halfExtent) {
+  local_.position = position;
+  for (int i = 0; i < 4; ++i) worldMatrix_.m[i][i] = 1.0f;
+}
+
+void BenchNode::SetParent(te::scene::ISceneNode* parent) {
+  if (auto* old = dynamic_cast<BenchNode*>(parent_)) {
+    old->children_.erase(std::remove(old->children_.begin(), old->children_.end(), this), old->children_.end());
+  }
+  parent_ = parent;
+  if (auto* p = dynamic_cast<BenchNode*>(parent)) {
+    p->children_.push_back(this);
+  }
+  dirty_ = true;
+}
+
+void BenchNode::SetLocalTransform(te::scene::Transform const& t) {
+  local_ = t;
+  worldMatrix_.m[3][0] = t.position.x;
+  worldMatrix_.m[3][1] = t.position.y;
+  worldMatrix_.m[3][2] = t.position.z;
+  dirty_ = true;
+}
+
+te::core::AABB BenchNode::GetAABB() const {
+  te::core::AABB box;
+  box.min = {local_.position.x - halfExtent_, local_.position.y - halfExtent_, local_.position.z - halfExtent_};
+  box.max = {local_.position.x + halfExtent_, local_.position.y + halfExtent_, local_.position.z + halfExtent_};
+  return box;
+}
+
+std::vector<std::unique_ptr<BenchNode>> MakeNodes(uint32_t count, float extent, float halfExtent) {
+  std::vector<std::unique_ptr<BenchNode>> nodes;
+  nodes.reserve(count);
+  // xorshift: the same scene on every run and platform
+  uint32_t state = 0x9E3779B9u;
+  auto next = [&state]() {
+    state ^= state << 13;
+    state ^= state >> 17;
+    state ^= state << 5;
+    return static_cast<float>(state & 0xFFFFFFu) / static_cast<float>(0xFFFFFFu) - 0.5f;
+  };
+  for (uint32_t i = 0; i < count; ++i) {
+    te::core::Vector3 position{next() * extent, next() * extent, next() * extent};
+    nodes.push_back(std::make_unique<BenchNode>(i, position, halfExtent));
+  }
+  return nodes;
+}
+
+BenchElement::~BenchElement() {
+  DestroyBuffers();
+}
+
+void BenchElement::CreateBuffers(te::rhi::IDevice* device) {
+  DestroyBuffers();
+  if (!device) return;
+  device_ = device;
+  te::rhi::BufferDesc desc{};
+  desc.size = 24u * 32u;
+  desc.usage = static_cast<uint32_t>(te::rhi::BufferUsage::Vertex);
+  vertexBuffer_ = device->CreateBuffer(desc);
+  desc.size = indexCount_ * sizeof(uint32_t);
+  desc.usage = static_cast<uint32_t>(te::rhi::BufferUsage::Index);
+  indexBuffer_ = device->CreateBuffer(desc);
+}
+
+void BenchElement::DestroyBuffers() {
+  if (!device_) return;
+  if (vertexBuffer_) device_->DestroyBuffer(vertexBuffer_);
+  if (indexBuffer_) device_->DestroyBuffer(indexBuffer_);
+  vertexBuffer_ = nullptr;
+  indexBuffer_ = nullptr;
+  device_ = nullptr;
+}
+
+bool BenchElement::GetSubmesh(std::uint32_t index, te::rendercore::SubmeshRange* out) const {
+  if (index != 0 || !out) return false;
+  out->indexOffset = 0;
+  out->indexCount = indexCount_;
+  out->vertexOffset = 0;
+  return true;
+}
+
+void FillRenderItems(std::vector<std::unique_ptr<BenchNode>> const& nodes,
+                     std::vector<std::unique_ptr<BenchElement>> const& elements,
+                     te::pipelinecore::IRenderItemList* out) {
+  out->Clear();
+  if (elements.empty()) return;
+  for (auto const& node : nodes) {
+    te::pipelinecore::RenderItem item;
+    item.element = elements[node->GetIndex() % elements.size()].get();
+    item.transform = const_cast<te::core::Matrix4*>(&node->GetWorldMatrix());
+    std::memcpy(item.worldMatrix, node->GetWorldMatrix().m, sizeof(item.worldMatrix));
+    te::core::AABB const box = node->GetAABB();
+    item.bounds.min[0] = box.min.x;
+    item.bounds.min[1] = box.min.y;
+    item.bounds.min[2] = box.min.z;
+    item.bounds.max[0] = box.max.x;
+    item.bounds.max[1] = box.max.y;
+    item.bounds.max[2] = box.max.z;
+    item.sortKey = node->GetIndex();
+    out->Push(item);
+  }
+}
+
+te::pipeline::Frustum MakeBoxFrustum(float halfExtent) {
+  te::pipeline::Frustum frustum{};
+  // Planes face inward: a*x + b*y + c*z + d >= 0 inside
+  frustum.planes[0] = {1.0f, 0.0f, 0.0f, halfExtent};
+  frustum.planes[1] = {-1.0f, 0.0f, 0.0f, halfExtent};
+  frustum.planes[2] = {0.0f, -1.0f, 0.0f, halfExtent};
+  frustum.planes[3] = {0.0f, 1.0f, 0.0f, halfExtent};
+  frustum.planes[4] = {0.0f, 0.0f, 1.0f, halfExtent};
+  frustum.planes[5] = {0.0f, 0.0f, -1.0f, halfExtent};
+  return frustum;
+}
+
+}  // namespace te::bench
@@ -0,0 +1,106 @@
+/**
+ * @file Fixtures.h
+ * @brief TenEngine-bench: synthetic scene nodes, render elements and frustums shared by benchmarks.
+ */
+
+#pragma once
+
+#include <te/scene/ISceneNode.h>
+#include <te/pipeline/Culling.h>
+#include <te/pipelinecore/RenderItem.h>
+#include <te/rendercore/IRenderElement.hpp>
+#include <te/rendercore/IRenderMesh.hpp>
+
+#include <cstdint>
+#include <memory>
+#include <vector>
+
+namespace te::rhi {
+struct IDevice;
+struct IBuffer;
+}  // namespace te::rhi
+
+namespace te::bench {
+
+/// Minimal scene node with an AABB; world transform is cached by the node itself
+class BenchNode : public te::scene::ISceneNode {
+ public:
+  BenchNode(uint32_t index, te::core::Vector3 const& position, float halfExtent);
+
+  te::scene::ISceneNode* GetParent() const override { return parent_; }
+  void SetParent(te::scene::ISceneNode* parent) override;
+  void GetChildren(std::vector<te::scene::ISceneNode*>& out) const override { out = children_; }
+  size_t GetChildCount() const override { return children_.size(); }
+  te::scene::Transform const& GetLocalTransform() const override { return local_; }
+  void SetLocalTransform(te::scene::Transform const& t) override;
+  te::scene::Transform const& GetWorldTransform() const override { return local_; }
+  te::core::Matrix4 const& GetWorldMatrix() const override { return worldMatrix_; }
+  te::scene::NodeId GetNodeId() const override { return te::scene::NodeId(const_cast<BenchNode*>(this)); }
+  char const* GetName() const override { return "BenchNode"; }
+  bool IsActive() const override { return true; }
+  void SetActive(bool) override {}
+  te::scene::NodeType GetNodeType() const override { return te::scene::NodeType::Dynamic; }
+  bool HasAABB() const override { return true; }
+  te::core::AABB GetAABB() const override;
+  bool IsDirty() const override { return dirty_; }
+  void SetDirty(bool dirty) override { dirty_ = dirty; }
+
+  uint32_t GetIndex() const { return index_; }
+
+ private:
+  uint32_t index_;
+  float halfExtent_;
+  te::scene::ISceneNode* parent_{nullptr};
+  std::vector<te::scene::ISceneNode*> children_;
+  te::scene::Transform local_;
+  te::core::Matrix4 worldMatrix_;
+  bool dirty_{true};
+};
+
+/// Deterministic positions in a cube of side \a extent centered at the origin
+std::vector<std::unique_ptr<BenchNode>> MakeNodes(uint32_t count, float extent, float halfExtent);
+
+/// Render element with a fixed one-submesh mesh; buffers are optional (null device-less)
+class BenchElement : public te::rendercore::IRenderElement, private te::rendercore::IRenderMesh {
+ public:
+  explicit BenchElement(uint32_t indexCount) : indexCount_(indexCount) {}
+  ~BenchElement() override;
+
+  /// Create small vertex / index buffers on \a device so draws are recorded
+  void CreateBuffers(te::rhi::IDevice* device);
+  void DestroyBuffers();
+
+  te::rendercore::IRenderMesh* GetMesh() override { return this; }
+  te::rendercore::IRenderMesh const* GetMesh() const override { return this; }
+  te::rendercore::IRenderMaterial* GetMaterial() override { return nullptr; }
+  te::rendercore::IRenderMaterial const* GetMaterial() const override { return nullptr; }
+
+ private:
+  te::rhi::IBuffer* GetVertexBuffer() override { return vertexBuffer_; }
+  te::rhi::IBuffer const* GetVertexBuffer() const override { return vertexBuffer_; }
+  te::rhi::IBuffer* GetIndexBuffer() override { return indexBuffer_; }
+  te::rhi::IBuffer const* GetIndexBuffer() const override { return indexBuffer_; }
+  std::uint32_t GetSubmeshCount() const override { return 1; }
+  bool GetSubmesh(std::uint32_t index, te::rendercore::SubmeshRange* out) const override;
+  void SetDataVertex(void const*, std::size_t) override {}
+  void SetDataIndex(void const*, std::size_t) override {}
+  void SetDataIndexType(te::rendercore::IndexType) override {}
+  void SetDataSubmeshCount(std::uint32_t) override {}
+  void SetDataSubmesh(std::uint32_t, te::rendercore::SubmeshRange const&) override {}
+  void UpdateDeviceResource(te::rhi::IDevice*) override {}
+
+  uint32_t indexCount_;
+  te::rhi::IDevice* device_{nullptr};
+  te::rhi::IBuffer* vertexBuffer_{nullptr};
+  te::rhi::IBuffer* indexBuffer_{nullptr};
+};
+
+/// Fill \a out with one item per node, cycling through \a elements
+void FillRenderItems(std::vector<std::unique_ptr<BenchNode>> const& nodes,
+                     std::vector<std::unique_ptr<BenchElement>> const& elements,
+                     te::pipelinecore::IRenderItemList* out);
+
+/// Axis-aligned box frustum [-halfExtent, halfExtent]^3
+te::pipeline::Frustum MakeBoxFrustum(float halfExtent);
+
+}  // namespace te::bench
@@ -0,0 +1,99 @@
+/**
+ * @file main.cpp
+ * @brief TenEngine-bench entry point.
+ *
+ * Usage: tenengine_bench [--filter=SUBSTR] [--min-time=SEC] [--repetitions=N]
+ *                        [--json=PATH|-] [--tag=LABEL] [--list]
+ */
+
+#include "Benchmark.h"
+
+#include <te/core/engine.h>
+
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <string>
+
+namespace {
+
+bool ParseOption(char const* arg, char const* name, std::string& value) {
+  std::size_t const len = std::strlen(name);
+  if (std::strncmp(arg, name, len) != 0 || arg[len] != '=') return false;
+  value = arg + len + 1;
+  return true;
+}
+
+void PrintUsage() {
+  std::printf(
+      "Usage: tenengine_bench [options]\n"
+      "  --filter=SUBSTR     run benchmarks whose name contains SUBSTR\n"
+      "  --min-time=SEC      minimum duration of one measured run (default 0.2)\n"
+      "  --repetitions=N     measured runs per benchmark (default 5)\n"
+      "  --json=PATH         write the JSON report to PATH ('-' for stdout)\n"
+      "  --tag=LABEL         label stored in the report context (version, commit)\n"
+      "  --list              list benchmarks and exit\n");
+}
+
+}  // namespace
+
+int main(int argc, char** argv) {
+  te::bench::RunOptions options;
+  std::string jsonPath;
+  bool list = false;
+  for (int i = 1; i < argc; ++i) {
+    std::string value;
+    if (ParseOption(argv[i], "--filter", value)) {
+      options.filter = value;
+    } else if (ParseOption(argv[i], "--min-time", value)) {
+      options.minTimeSec = std::atof(value.c_str());
+    } else if (ParseOption(argv[i], "--repetitions", value)) {
+      options.repetitions = static_cast<uint32_t>(std::strtoul(value.c_str(), nullptr, 10));
+    } else if (ParseOption(argv[i], "--json", value)) {
+      jsonPath = value;
+    } else if (ParseOption(argv[i], "--tag", value)) {
+      options.tag = value;
+    } else if (std::strcmp(argv[i], "--list") == 0) {
+      list = true;
+    } else {
+      PrintUsage();
+      return std::strcmp(argv[i], "--help") == 0 ? 0 : 1;
+    }
+  }
+
+  if (list) {
+    for (auto const& desc : te::bench::GetBenchmarks()) {
+      if (desc.args.empty()) {
+        std::printf("%s\n", desc.name.c_str());
+      }
+      for (int64_t arg : desc.args) {
+        std::printf("%s/%lld\n", desc.name.c_str(), static_cast<long long>(arg));
+      }
+    }
+    return 0;
+  }
+
+  if (!te::core::Init(nullptr)) {
+    std::fprintf(stderr, "tenengine_bench: core initialization failed\n");
+    return 1;
+  }
+
+  std::vector<te::bench::BenchmarkResult> results;
+  te::bench::RunBenchmarks(options, results);
+  std::string const json = te::bench::ResultsToJson(options, results);
+
+  int status = 0;
+  if (jsonPath == "-") {
+    std::fputs(json.c_str(), stdout);
+  } else if (!jsonPath.empty()) {
+    FILE* f = std::fopen(jsonPath.c_str(), "wb");
+    bool const ok = f && std::fwrite(json.data(), 1, json.size(), f) == json.size();
+    if (!f || std::fclose(f) != 0 || !ok) {
+      std::fprintf(stderr, "tenengine_bench: cannot write %s\n", jsonPath.c_str());
+      status = 1;
+    }
+  }
+
+  te::core::Shutdown();
+  return status;
+}